@@ -6,6 +6,8 @@ BSLS_IDENT_RCSID(balber_berdecoder_cpp, "$Id$ $CSID$")
 
 #include <balber_berencoder.h>          // for testing only
 
+#include <bsl_climits.h>
+
 namespace BloombergLP {
 
                    // --------------------------------------
@@ -17,6 +19,144 @@ balber::BerDecoder::MemOutStream::~MemOutStream()
 }
 
 namespace balber {
+namespace {
+namespace u {
+
+// The following constants are those used by 'BerUtil' to decode identifier
+// and length octets.
+
+enum {
+    k_TAG_CLASS_MASK              = 0xC0,
+    k_TAG_TYPE_MASK               = 0x20,
+    k_TAG_NUMBER_MASK             = 0x1F,
+    k_NUM_VALUE_BITS_IN_TAG_OCTET = 7,
+    k_MAX_TAG_NUMBER_OCTETS       = (sizeof(int) * CHAR_BIT) /
+                                        k_NUM_VALUE_BITS_IN_TAG_OCTET + 1,
+    k_CHAR_MSB_MASK               = 0x80,
+    k_SEVEN_BITS_MASK             = 0x7F,
+    k_INDEFINITE_LENGTH_OCTET     = 0x80,
+    k_LONG_FORM_LENGTH_FLAG_MASK  = 0x80,
+    k_LONG_FORM_LENGTH_VALUE_MASK = 0x7F
+};
+
+/// Decode the identifier octets at the read position of the specified
+/// `buffer`, load the tag class, tag type, and tag number they encode into
+/// the specified `tagClass`, `tagType`, and `tagNumber`, advance `buffer`
+/// past them, and add their number to the specified
+/// `accumNumBytesConsumed`.  Return 0 on success, and a non-zero value
+/// otherwise.  Note that this function decodes the same encodings as
+/// `BerUtil::getIdentifierOctets`.
+int getIdentifierOctets(BerConstants::TagClass         *tagClass,
+                        BerConstants::TagType          *tagType,
+                        int                            *tagNumber,
+                        int                            *accumNumBytesConsumed,
+                        BerDecoder_ContiguousStreamBuf *buffer)
+{
+    const unsigned char *cursor =
+                reinterpret_cast<const unsigned char *>(buffer->cursor());
+    const unsigned char *end    =
+                reinterpret_cast<const unsigned char *>(buffer->end());
+
+    if (cursor == end) {
+        return -1;                                                    // RETURN
+    }
+
+    int nextOctet = *cursor++;
+
+    *tagClass = static_cast<BerConstants::TagClass>(nextOctet &
+                                                    k_TAG_CLASS_MASK);
+    *tagType  = static_cast<BerConstants::TagType>(nextOctet &
+                                                   k_TAG_TYPE_MASK);
+
+    if (k_TAG_NUMBER_MASK != (nextOctet & k_TAG_NUMBER_MASK)) {
+        *tagNumber = nextOctet & k_TAG_NUMBER_MASK;
+    }
+    else {
+        *tagNumber = 0;
+
+        int numOctets = 0;
+        do {
+            if (k_MAX_TAG_NUMBER_OCTETS == numOctets || cursor == end) {
+                return -1;                                            // RETURN
+            }
+
+            nextOctet = *cursor++;
+            ++numOctets;
+
+            *tagNumber <<= k_NUM_VALUE_BITS_IN_TAG_OCTET;
+            *tagNumber |= nextOctet & k_SEVEN_BITS_MASK;
+        } while (nextOctet & k_CHAR_MSB_MASK);
+    }
+
+    const int numBytes = static_cast<int>(
+                   cursor - reinterpret_cast<const unsigned char *>(
+                                                           buffer->cursor()));
+    buffer->advance(numBytes);
+    *accumNumBytesConsumed += numBytes;
+    return 0;
+}
+
+/// Decode the length octets at the read position of the specified
+/// `buffer`, load the length they encode, or `BerUtil::k_INDEFINITE_LENGTH`,
+/// into the specified `result`, advance `buffer` past them, and add their
+/// number to the specified `accumNumBytesConsumed`.  Return 0 on success,
+/// and a non-zero value otherwise.  Note that this function decodes the
+/// same encodings as `BerUtil::getLength`.
+int getLength(int                            *result,
+              int                            *accumNumBytesConsumed,
+              BerDecoder_ContiguousStreamBuf *buffer)
+{
+    const unsigned char *cursor =
+                reinterpret_cast<const unsigned char *>(buffer->cursor());
+
+    if (0 == buffer->numAvailable()) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned int numOctets = *cursor;
+
+    if (k_INDEFINITE_LENGTH_OCTET == numOctets) {
+        *result = BerUtil::k_INDEFINITE_LENGTH;
+        buffer->advance(1);
+        ++*accumNumBytesConsumed;
+        return 0;                                                     // RETURN
+    }
+
+    if (!(numOctets & k_LONG_FORM_LENGTH_FLAG_MASK)) {
+        *result = numOctets;
+        buffer->advance(1);
+        ++*accumNumBytesConsumed;
+        return 0;                                                     // RETURN
+    }
+
+    numOctets &= k_LONG_FORM_LENGTH_VALUE_MASK;
+
+    if (numOctets > sizeof(int) || numOctets >= buffer->numAvailable()) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = 0;
+    for (unsigned int i = 1; i <= numOctets; ++i) {
+        *result <<= CHAR_BIT;
+        *result |= cursor[i];
+    }
+
+    buffer->advance(static_cast<int>(numOctets) + 1);
+    *accumNumBytesConsumed += static_cast<int>(numOctets) + 1;
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                   // --------------------------------------------
+                   // private class BerDecoder_ContiguousStreamBuf
+                   // --------------------------------------------
+
+// CREATORS
+BerDecoder_ContiguousStreamBuf::~BerDecoder_ContiguousStreamBuf()
+{
+}
 
                               // ----------------
                               // class BerDecoder
@@ -30,6 +170,7 @@ BerDecoder::BerDecoder(const BerDecoderOptions *options,
 , d_logStream(0)
 , d_severity(e_BER_SUCCESS)
 , d_streamBuf(0)
+, d_contiguousStreamBuf(0)
 , d_currentDepth(0)
 , d_numUnknownElementsSkipped(0)
 , d_topNode(0)
@@ -227,24 +368,72 @@ int BerDecoder_Node::decode(bsl::vector<unsigned char> *variable,
     }
 }
 
+int BerDecoder_Node::decode(bsl::string                *variable,
+                            bdlat_TypeCategory::Simple  )
+{
+    BerDecoder_ContiguousStreamBuf *buffer = d_decoder->d_contiguousStreamBuf;
+    if (!buffer || d_expectedLength <= 0) {
+        // Empty strings are decoded according to the 'defaultEmptyStrings'
+        // option, and strings of indefinite length are rejected, by
+        // 'BerUtil'.
+
+        return decode<bsl::string>(variable,
+                                   bdlat_TypeCategory::Simple());     // RETURN
+    }
+
+    if (d_tagType != BerConstants::e_PRIMITIVE) {
+        return logError("Expected PRIMITIVE tag type for simple type");
+                                                                      // RETURN
+    }
+
+    if (static_cast<bsl::size_t>(d_expectedLength) > buffer->numAvailable()) {
+        return logError("Error reading value for simple type");       // RETURN
+    }
+
+    variable->assign(buffer->cursor(), d_expectedLength);
+    buffer->advance(d_expectedLength);
+
+    d_consumedBodyBytes = d_expectedLength;
+
+    return BerDecoder::e_BER_SUCCESS;
+}
+
 int BerDecoder_Node::readTagHeader()
 {
     if (d_decoder->maxDepthExceeded()) {
         return logError("Max depth exceeded");                        // RETURN
     }
 
-    if (0 != BerUtil::getIdentifierOctets(d_decoder->d_streamBuf,
-                                          &d_tagClass,
-                                          &d_tagType,
-                                          &d_tagNumber,
-                                          &d_consumedHeaderBytes)) {
-        return logError("Error reading BER tag");                     // RETURN
+    if (BerDecoder_ContiguousStreamBuf *buffer =
+                                           d_decoder->d_contiguousStreamBuf) {
+        if (0 != u::getIdentifierOctets(&d_tagClass,
+                                        &d_tagType,
+                                        &d_tagNumber,
+                                        &d_consumedHeaderBytes,
+                                        buffer)) {
+            return logError("Error reading BER tag");                 // RETURN
+        }
+
+        if (0 != u::getLength(&d_expectedLength,
+                              &d_consumedHeaderBytes,
+                              buffer)) {
+            return logError("Error reading BER length");              // RETURN
+        }
     }
+    else {
+        if (0 != BerUtil::getIdentifierOctets(d_decoder->d_streamBuf,
+                                              &d_tagClass,
+                                              &d_tagType,
+                                              &d_tagNumber,
+                                              &d_consumedHeaderBytes)) {
+            return logError("Error reading BER tag");                 // RETURN
+        }
 
-    if (0 != BerUtil::getLength(d_decoder->d_streamBuf,
-                                &d_expectedLength,
-                                &d_consumedHeaderBytes)) {
-        return logError("Error reading BER length");                  // RETURN
+        if (0 != BerUtil::getLength(d_decoder->d_streamBuf,
+                                    &d_expectedLength,
+                                    &d_consumedHeaderBytes)) {
+            return logError("Error reading BER length");              // RETURN
+        }
     }
 
     if (d_decoder->decoderOptions()->traceLevel() > 0) {
@@ -257,9 +446,22 @@ int BerDecoder_Node::readTagHeader()
 
 int BerDecoder_Node::readTagTrailer()
 {
+    BerDecoder_ContiguousStreamBuf *buffer = d_decoder->d_contiguousStreamBuf;
+
     if (BerUtil::k_INDEFINITE_LENGTH == d_expectedLength) {
-        if (0 != BerUtil::getEndOfContentOctets(d_decoder->d_streamBuf,
-                                                &d_consumedTailBytes)) {
+        if (buffer) {
+            d_consumedTailBytes += 2;
+
+            if (2 > buffer->numAvailable()
+             || 0 != buffer->cursor()[0]
+             || 0 != buffer->cursor()[1]) {
+                return logError("Error reading end-of-contents octets");
+                                                                      // RETURN
+            }
+            buffer->advance(2);
+        }
+        else if (0 != BerUtil::getEndOfContentOctets(d_decoder->d_streamBuf,
+                                                     &d_consumedTailBytes)) {
             return logError("Error reading end-of-contents octets");  // RETURN
         }
     }
@@ -284,6 +486,20 @@ int BerDecoder_Node::skipField()
     }
 
     if (BerUtil::k_INDEFINITE_LENGTH != d_expectedLength) {
+        if (BerDecoder_ContiguousStreamBuf *buffer =
+                                           d_decoder->d_contiguousStreamBuf) {
+            if (static_cast<bsl::size_t>(d_expectedLength) >
+                                                      buffer->numAvailable()) {
+                return logError("Error reading stream while skipping field");
+                                                                      // RETURN
+            }
+
+            buffer->advance(d_expectedLength);
+            d_consumedBodyBytes += d_expectedLength;
+
+            return BerDecoder::e_BER_SUCCESS;                         // RETURN
+        }
+
         // We would do this, but not every streambuf is seekable:
         //..
         //  d_decoder->d_streamBuf->pubseekoff(d_expectedLength,
@@ -365,13 +581,28 @@ int BerDecoder_Node::readVectorChar(bsl::vector<char> *variable)
                                                                       // RETURN
     }
 
-    variable->resize(d_expectedLength);
+    if (BerDecoder_ContiguousStreamBuf *buffer =
+                                           d_decoder->d_contiguousStreamBuf) {
+        if (static_cast<bsl::size_t>(d_expectedLength) >
+                                                      buffer->numAvailable()) {
+            return logError("Stream error while reading 'vector<char>'");
+                                                                      // RETURN
+        }
 
-    if (0 != d_expectedLength &&
+        variable->assign(buffer->cursor(),
+                         buffer->cursor() + d_expectedLength);
+        buffer->advance(d_expectedLength);
+    }
+    else {
+        variable->resize(d_expectedLength);
+
+        if (0 != d_expectedLength &&
         d_expectedLength !=
-            d_decoder->d_streamBuf->sgetn(&(*variable)[0], d_expectedLength)) {
-        return logError("Stream error while reading 'vector<char>'");
+            d_decoder->d_streamBuf->sgetn(&(*variable)[0],
+                                          d_expectedLength)) {
+            return logError("Stream error while reading 'vector<char>'");
                                                                       // RETURN
+        }
     }
 
     d_consumedBodyBytes += d_expectedLength;
@@ -404,14 +635,29 @@ int BerDecoder_Node::readVectorUnsignedChar(
                                                                       // RETURN
     }
 
-    variable->resize(length);
-
-    if (length != 0) {
-        char *data = reinterpret_cast<char *>(variable->data());
-        if (length != d_decoder->d_streamBuf->sgetn(data, length)) {
+    if (BerDecoder_ContiguousStreamBuf *buffer =
+                                           d_decoder->d_contiguousStreamBuf) {
+        if (static_cast<bsl::size_t>(length) > buffer->numAvailable()) {
             return logError(
               "Stream error while reading 'vector<unsigned char>'");  // RETURN
         }
+
+        const unsigned char *data =
+                    reinterpret_cast<const unsigned char *>(buffer->cursor());
+        variable->assign(data, data + length);
+        buffer->advance(length);
+    }
+    else {
+        variable->resize(length);
+
+        if (length != 0) {
+            char *data = reinterpret_cast<char *>(variable->data());
+            if (length != d_decoder->d_streamBuf->sgetn(data, length)) {
+                return logError(
+                  "Stream error while reading 'vector<unsigned char>'");
+                                                                      // RETURN
+            }
+        }
     }
 
     d_consumedBodyBytes += length;
@@ -16,9 +16,30 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized `decode` function.  The `decode` function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The `decode` method is overloaded
-// for two types of input streams:
+// for the following sources of input:
 // * `bsl::streambuf`
 // * `bsl::istream`
+// * a contiguous buffer, specified by its address and length
+// * `bdlbb::Blob`
+//
+///Decoding from Contiguous Memory
+///-------------------------------
+// When decoding from a stream, the decoder reads the identifier and length
+// octets of each element one at a time through the `bsl::streambuf`
+// interface, and reads the content of each `bsl::string` and
+// `bsl::vector<char>` with a call to `sgetn`.  Each of these reads may require
+// a virtual function call (e.g., for a stream buffer that reads from a socket
+// as required).
+//
+// When the whole encoding is in contiguous memory, clients should instead
+// call the `decode` overload taking the address and length of that memory.
+// That overload reads the identifier, length, and end-of-contents octets, and
+// skips unknown elements, by direct access to the memory, and loads the
+// content of each `bsl::string`, `bsl::vector<char>`, and
+// `bsl::vector<unsigned char>` with a single allocation and copy.  The
+// `decode` overload taking a `bdlbb::Blob` uses the same path if the data of
+// the blob is held in a single buffer, and reads the blob through a
+// `bdlbb::InBlobStreamBuf` otherwise.
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the `bdlat` framework.
@@ -58,17 +79,16 @@ BSLS_IDENT("$Id: $")
 // assert( 0 == rc);
 // assert(18 == osb.length());
 // ```
-// Now, we create a `bdlsb::FixedMemInStreamBuf` object to manage our access
-// to the data portion of the `bdlsb::MemOutStreamBuf` (where our BER encoding
-// resides), decode the values found there, and use them to set the value
-// of an `usage::EmployeeRecord` object.
+// Now, we decode the values found in the data portion of the
+// `bdlsb::MemOutStreamBuf` (where our BER encoding resides), and use them to
+// set the value of an `usage::EmployeeRecord` object.  As the encoding is in
+// contiguous memory, we pass its address and length to the decoder:
 // ```
-// balber::BerDecoderOptions  options;
-// balber::BerDecoder         decoder(&options);
-// bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
-// usage::EmployeeRecord      obj;
+// balber::BerDecoderOptions options;
+// balber::BerDecoder        decoder(&options);
+// usage::EmployeeRecord     obj;
 //
-// rc = decoder.decode(&isb, &obj);
+// rc = decoder.decode(osb.data(), osb.length(), &obj);
 // assert(0 == rc);
 // ```
 // Finally, we confirm that the object defined by the BER encoding has the
@@ -99,6 +119,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bslma_allocator.h>
@@ -109,8 +132,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_istream.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
@@ -121,6 +146,52 @@ class BerDecoder_Node;
 class BerDecoder_NodeVisitor;
 class BerDecoder_UniversalElementVisitor;
 
+                   // ============================================
+                   // private class BerDecoder_ContiguousStreamBuf
+                   // ============================================
+
+/// This component-private class provides a `bsl::streambuf` whose get area
+/// is a contiguous buffer supplied at construction, and that gives the
+/// decoder direct access to the unread portion of that buffer.
+class BerDecoder_ContiguousStreamBuf : public bsl::streambuf {
+
+    // NOT IMPLEMENTED
+    BerDecoder_ContiguousStreamBuf(const BerDecoder_ContiguousStreamBuf&);
+    BerDecoder_ContiguousStreamBuf& operator=(
+                                        const BerDecoder_ContiguousStreamBuf&);
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer that reads the specified `length` bytes at
+    /// the specified `buffer`.  The behavior is undefined unless `buffer`
+    /// remains valid for the lifetime of this object.
+    BerDecoder_ContiguousStreamBuf(const char *buffer, bsl::size_t length);
+
+    /// Destroy this object.
+    ~BerDecoder_ContiguousStreamBuf() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Advance the read position of this stream buffer by the specified
+    /// `numBytes`.  The behavior is undefined unless
+    /// `0 <= numBytes <= numAvailable()`.
+    void advance(int numBytes);
+
+    // ACCESSORS
+
+    /// Return the address of the next byte to be read from this stream
+    /// buffer.
+    const char *cursor() const;
+
+    /// Return the address one past the last byte of this stream buffer.
+    const char *end() const;
+
+    /// Return the number of bytes that remain to be read from this stream
+    /// buffer.
+    bsl::size_t numAvailable() const;
+};
+
                               // ================
                               // class BerDecoder
                               // ================
@@ -203,6 +274,14 @@ class BerDecoder {
 
     ErrorSeverity                    d_severity;     // error severity level
     bsl::streambuf                  *d_streamBuf;    // held, not owned
+
+    BerDecoder_ContiguousStreamBuf  *d_contiguousStreamBuf;
+                                                     // 'd_streamBuf' if
+                                                     // decoding from
+                                                     // contiguous memory, and
+                                                     // 0 otherwise; held, not
+                                                     // owned
+
     int                              d_currentDepth; // current depth
 
     int                              d_numUnknownElementsSkipped;
@@ -265,6 +344,26 @@ class BerDecoder {
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
 
+    /// Decode an object of parameterized `TYPE` from the specified `length`
+    /// bytes at the specified `buffer` and load the result into the
+    /// specified `variable`.  Return 0 on success, and a non-zero value
+    /// otherwise.  The behavior is undefined unless `buffer` refers to at
+    /// least `length` bytes or `0 == length`.  Note that bytes following the
+    /// encoding of `variable` are ignored, and that this overload does not
+    /// read the encoding through the `bsl::streambuf` interface (see
+    /// {Decoding from Contiguous Memory}).
+    template <typename TYPE>
+    int decode(const char *buffer, bsl::size_t length, TYPE *variable);
+
+    /// Decode an object of parameterized `TYPE` from the data of the
+    /// specified `blob` and load the result into the specified `variable`.
+    /// Return 0 on success, and a non-zero value otherwise.  Note that
+    /// bytes following the encoding of `variable` are ignored, and that the
+    /// data of `blob` is read as contiguous memory if it is held in a single
+    /// buffer (see {Decoding from Contiguous Memory}).
+    template <typename TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *variable);
+
     /// Set the number of unknown elements skipped by the decoder during the
     /// current decoding operation to the specified `value`.  The behavior
     /// is undefined unless `0 <= value`.
@@ -338,6 +437,7 @@ class BerDecoder_Node {
     int decode(bsl::vector<char> *variable, bdlat_TypeCategory::Array);
     int decode(bsl::vector<unsigned char> *variable,
                bdlat_TypeCategory::Array);
+    int decode(bsl::string *variable, bdlat_TypeCategory::Simple);
     template <typename TYPE>
     int decode(TYPE *variable, bdlat_TypeCategory::Array);
     template <typename TYPE>
@@ -589,6 +689,49 @@ int balber::BerDecoder::MemOutStream::length() const
 }
 
 namespace balber {
+                   // --------------------------------------------
+                   // private class BerDecoder_ContiguousStreamBuf
+                   // --------------------------------------------
+
+// CREATORS
+inline
+BerDecoder_ContiguousStreamBuf::BerDecoder_ContiguousStreamBuf(
+                                                    const char  *buffer,
+                                                    bsl::size_t  length)
+{
+    char *begin = const_cast<char *>(buffer);
+    setg(begin, begin, begin + length);
+}
+
+// MANIPULATORS
+inline
+void BerDecoder_ContiguousStreamBuf::advance(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(static_cast<bsl::size_t>(numBytes) <= numAvailable());
+
+    gbump(numBytes);
+}
+
+// ACCESSORS
+inline
+const char *BerDecoder_ContiguousStreamBuf::cursor() const
+{
+    return gptr();
+}
+
+inline
+const char *BerDecoder_ContiguousStreamBuf::end() const
+{
+    return egptr();
+}
+
+inline
+bsl::size_t BerDecoder_ContiguousStreamBuf::numAvailable() const
+{
+    return egptr() - gptr();
+}
+
                               // ----------------
                               // class BerDecoder
                               // ----------------
@@ -665,6 +808,42 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
     return rc;
 }
 
+template <typename TYPE>
+int BerDecoder::decode(const char  *buffer,
+                       bsl::size_t  length,
+                       TYPE        *variable)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(0 == d_contiguousStreamBuf);
+
+    BerDecoder_ContiguousStreamBuf streamBuf(buffer, length);
+
+    d_contiguousStreamBuf = &streamBuf;
+
+    const int rc = decode(static_cast<bsl::streambuf *>(&streamBuf),
+                          variable);
+
+    d_contiguousStreamBuf = 0;
+    return rc;
+}
+
+template <typename TYPE>
+int BerDecoder::decode(const bdlbb::Blob& blob, TYPE *variable)
+{
+    if (0 == blob.numDataBuffers()) {
+        return decode("", 0, variable);                               // RETURN
+    }
+
+    if (1 == blob.numDataBuffers()) {
+        return decode(blob.buffer(0).data(),
+                      static_cast<bsl::size_t>(blob.length()),
+                      variable);                                      // RETURN
+    }
+
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+    return decode(static_cast<bsl::streambuf *>(&streamBuf), variable);
+}
+
 inline
 void BerDecoder::setNumUnknownElementsSkipped(int value)
 {
@@ -755,7 +934,16 @@ BerDecoder_Node::hasMore()
     BSLS_ASSERT(d_tagType == BerConstants::e_CONSTRUCTED);
 
     if (BerUtil::k_INDEFINITE_LENGTH == d_expectedLength) {
-        return 0 != d_decoder->d_streamBuf->sgetc();
+        const BerDecoder_ContiguousStreamBuf *buffer =
+                                             d_decoder->d_contiguousStreamBuf;
+        if (buffer) {
+            // As for 'sgetc', the end of the buffer is not an end-of-contents
+            // octet; the next attempt to read an element will fail.
+
+            return buffer->cursor() == buffer->end()
+                || 0 != *buffer->cursor();                            // RETURN
+        }
+        return 0 != d_decoder->d_streamBuf->sgetc();                  // RETURN
     }
 
     return d_expectedLength > d_consumedBodyBytes;
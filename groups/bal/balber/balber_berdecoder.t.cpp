@@ -28,6 +28,9 @@
 #include <bdlat_selectioninfo.h>
 #include <bdlat_valuetypefunctions.h>
 #include <bdlb_string.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 
@@ -81,6 +84,9 @@ namespace test = BloombergLP::s_baltst;
 // [19] int BerDeocder::decode(bsl::istream&   stream   , TYPE *variable)
 //
 // [20] int decode(bsl::streambuf *streamBuf, TYPE *variable)
+//
+// [25] int decode(const char *buffer, size_t length, TYPE *variable);
+// [25] int decode(const bdlbb::Blob& blob, TYPE *variable);
 // ----------------------------------------------------------------------------
 // [ 1] FUNDAMENTALS TEST
 // [ 2] ENCODE AND DECODE REAL/FLOATING-POINT
@@ -106,7 +112,8 @@ namespace test = BloombergLP::s_baltst;
 // [22] DECODE DATE/TIME WITH LENGTH ANOMALIES
 // [23] FUZZ TEST BUG (DRQS 175594554)
 // [24] FUZZ TEST BUG (DRQS 175741365)
-// [25] USAGE EXAMPLE
+// [25] DECODE FROM CONTIGUOUS MEMORY
+// [26] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
 
@@ -2221,17 +2228,16 @@ static void usageExample()
     ASSERT( 0 == rc);
     ASSERT(18 == osb.length());
 // ```
-// Now, we create a `bdlsb::FixedMemInStreamBuf` object to manage our access
-// to the data portion of the `bdlsb::MemOutStreamBuf` (where our BER encoding
-// resides), decode the values found there, and use them to set the value
-// of an `usage::EmployeeRecord` object.
+// Now, we decode the values found in the data portion of the
+// `bdlsb::MemOutStreamBuf` (where our BER encoding resides), and use them to
+// set the value of an `usage::EmployeeRecord` object.  As the encoding is in
+// contiguous memory, we pass its address and length to the decoder:
 // ```
-    balber::BerDecoderOptions  options;
-    balber::BerDecoder         decoder(&options);
-    bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
-    usage::EmployeeRecord      obj;
+    balber::BerDecoderOptions options;
+    balber::BerDecoder        decoder(&options);
+    usage::EmployeeRecord     obj;
 
-    rc = decoder.decode(&isb, &obj);
+    rc = decoder.decode(osb.data(), osb.length(), &obj);
     ASSERT(0 == rc);
 // ```
 // Finally, we confirm that the object defined by the BER encoding has the
@@ -2270,6 +2276,19 @@ bool tryDeserialize(const uint8_t                    *bytes,
     TYPE                       outValue;
 
     int rc = decoder.decode(&streamBuf, &outValue);
+
+    // Decoding from contiguous memory must accept exactly the same inputs.
+
+    TYPE      contiguousValue;
+    const int contiguousRc = decoder.decode(
+                                         reinterpret_cast<const char*>(bytes),
+                                         size,
+                                         &contiguousValue);
+    ASSERTV(rc, contiguousRc, (0 == rc) == (0 == contiguousRc));
+    if (0 == rc && 0 == contiguousRc) {
+        ASSERT(outValue == contiguousValue);
+    }
+
     return rc == 0;
 }
 
@@ -2344,7 +2363,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2368,6 +2387,162 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of test.\n";
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // DECODE FROM CONTIGUOUS MEMORY
+        //
+        // Concerns:
+        // 1. Decoding from contiguous memory produces the same value as
+        //    decoding the same bytes from a stream buffer, including for
+        //    strings and `vector<char>`/`vector<unsigned char>` values that
+        //    are empty, short, and longer than 127 bytes (having long-form
+        //    lengths).
+        //
+        // 2. Decoding any proper prefix of an encoding fails, both from
+        //    contiguous memory and from a stream buffer.
+        //
+        // 3. Bytes following the encoding are ignored.
+        //
+        // 4. A blob is decoded correctly whether its data is held in a single
+        //    buffer or in several.
+        //
+        // Plan:
+        // 1. Encode objects having string and vector members of various
+        //    lengths, and decode each encoding, and each proper prefix of
+        //    it, from a `bdlsb::FixedMemInStreamBuf`, from its address and
+        //    length, and from its address and length with extra trailing
+        //    bytes.  (C-1..3)
+        //
+        // 2. Decode each encoding from blobs having buffers larger than, and
+        //    much smaller than, the encoding.  (C-4)
+        //
+        // Testing:
+        //   int decode(const char *buffer, size_t length, TYPE *variable);
+        //   int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODE FROM CONTIGUOUS MEMORY"
+                             "\n=============================\n";
+
+        static const int LENGTHS[] = { 0, 1, 5, 127, 128, 300, 70000 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            test::Employee employee;
+            employee.name().assign(LENGTH, 'n');
+            employee.homeAddress().street().assign(LENGTH / 2, 's');
+            employee.homeAddress().city() = "New York";
+            employee.age()                = LENGTH;
+
+            test::RawData rawData;
+            for (int i = 0; i < LENGTH; ++i) {
+                rawData.charvec().push_back(static_cast<char>(i));
+                rawData.ucharvec().push_back(
+                                     static_cast<unsigned char>(LENGTH - i));
+            }
+
+            bdlsb::MemOutStreamBuf employeeOsb;
+            ASSERT(0 == encoder.encode(&employeeOsb, employee));
+
+            bdlsb::MemOutStreamBuf rawDataOsb;
+            ASSERT(0 == encoder.encode(&rawDataOsb, rawData));
+
+            const bsl::string EMPLOYEE(employeeOsb.data(),
+                                       employeeOsb.length());
+            const bsl::string RAW_DATA(rawDataOsb.data(),
+                                       rawDataOsb.length());
+
+            // P-1
+
+            for (int len = 0; len <= static_cast<int>(EMPLOYEE.size());
+                 len += LENGTH < 300 ? 1 : 97) {
+                const bool COMPLETE = static_cast<int>(EMPLOYEE.size()) == len;
+
+                bdlsb::FixedMemInStreamBuf isb(EMPLOYEE.data(), len);
+                test::Employee             fromStream;
+                test::Employee             fromMemory;
+
+                ASSERTV(LENGTH, len,
+                        COMPLETE == (0 == decoder.decode(&isb, &fromStream)));
+                ASSERTV(LENGTH, len,
+                        COMPLETE == (0 == decoder.decode(EMPLOYEE.data(),
+                                                         len,
+                                                         &fromMemory)));
+                if (COMPLETE) {
+                    ASSERTV(LENGTH, employee == fromStream);
+                    ASSERTV(LENGTH, employee == fromMemory);
+                }
+            }
+
+            for (int len = 0; len <= static_cast<int>(RAW_DATA.size());
+                 len += LENGTH < 300 ? 1 : 97) {
+                const bool COMPLETE = static_cast<int>(RAW_DATA.size()) == len;
+
+                bdlsb::FixedMemInStreamBuf isb(RAW_DATA.data(), len);
+                test::RawData              fromStream;
+                test::RawData              fromMemory;
+
+                ASSERTV(LENGTH, len,
+                        COMPLETE == (0 == decoder.decode(&isb, &fromStream)));
+                ASSERTV(LENGTH, len,
+                        COMPLETE == (0 == decoder.decode(RAW_DATA.data(),
+                                                         len,
+                                                         &fromMemory)));
+                if (COMPLETE) {
+                    ASSERTV(LENGTH, rawData == fromStream);
+                    ASSERTV(LENGTH, rawData == fromMemory);
+                }
+            }
+
+            {
+                const bsl::string PADDED =
+                              EMPLOYEE + bsl::string("\x00\x01garbage", 9);
+
+                test::Employee value;
+                ASSERTV(LENGTH, 0 == decoder.decode(PADDED.data(),
+                                                    PADDED.size(),
+                                                    &value));
+                ASSERTV(LENGTH, employee == value);
+            }
+
+            // P-2
+
+            static const int BUFFER_SIZES[] = { 3, 1024 * 1024 };
+
+            for (int bi = 0; bi < 2; ++bi) {
+                bdlbb::PooledBlobBufferFactory factory(BUFFER_SIZES[bi]);
+
+                bdlbb::Blob employeeBlob(&factory);
+                bdlbb::BlobUtil::append(&employeeBlob,
+                                        EMPLOYEE.data(),
+                                        static_cast<int>(EMPLOYEE.size()));
+
+                bdlbb::Blob rawDataBlob(&factory);
+                bdlbb::BlobUtil::append(&rawDataBlob,
+                                        RAW_DATA.data(),
+                                        static_cast<int>(RAW_DATA.size()));
+
+                ASSERTV(LENGTH, bi, (1 == employeeBlob.numDataBuffers())
+                                                                == (1 == bi));
+
+                test::Employee employeeValue;
+                ASSERTV(LENGTH, bi, 0 == decoder.decode(employeeBlob,
+                                                        &employeeValue));
+                ASSERTV(LENGTH, bi, employee == employeeValue);
+
+                test::RawData rawDataValue;
+                ASSERTV(LENGTH, bi, 0 == decoder.decode(rawDataBlob,
+                                                        &rawDataValue));
+                ASSERTV(LENGTH, bi, rawData == rawDataValue);
+            }
+        }
+
+        if (verbose) cout << "\nEnd of test.\n";
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // FUZZ TEST BUG (DRQS 175741365)
@@ -17,6 +17,44 @@ namespace BloombergLP {
 // CREATORS
 balber::BerEncoder::MemOutStream::~MemOutStream()
 {
+}
+
+                 // -------------------------------------------
+                 // class balber::BerEncoder::CountingStreamBuf
+                 // -------------------------------------------
+
+// PROTECTED MANIPULATORS
+balber::BerEncoder::CountingStreamBuf::int_type
+balber::BerEncoder::CountingStreamBuf::overflow(int_type c)
+{
+    d_count += pptr() - pbase();
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    ++d_count;
+    return c;
+}
+
+bsl::streamsize
+balber::BerEncoder::CountingStreamBuf::xsputn(const char      *,
+                                              bsl::streamsize  length)
+{
+    d_count += length;
+    return length;
+}
+
+// CREATORS
+balber::BerEncoder::CountingStreamBuf::CountingStreamBuf()
+: d_count(0)
+{
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+}
+
+balber::BerEncoder::CountingStreamBuf::~CountingStreamBuf()
+{
 }
 
 namespace balber {
@@ -34,6 +72,10 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_severity     (e_BER_SUCCESS)
 , d_streamBuf    (0)
 , d_currentDepth (0)
+, d_lengthMode   (e_INDEFINITE_LENGTH)
+, d_countingStreamBuf(0)
+, d_lengths      (basicAllocator)
+, d_nextLength   (0)
 {
 }
 
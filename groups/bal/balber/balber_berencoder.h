@@ -22,6 +22,25 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the `bdlat` framework.
 //
+///Definite-Length Encoding
+///------------------------
+// By default, constructed elements (sequences, choices, arrays, and nillable
+// values) are encoded using the indefinite form of length octets, and their
+// contents are terminated by end-of-contents octets.  This allows the encoder
+// to write its output in a single pass, without knowing the length of an
+// element before writing it.  If the `encodeDefiniteLength` option is `true`,
+// the encoder instead writes the definite form of length octets for every
+// element.  To do so, it first visits the object once, writing to an internal
+// stream buffer that only counts the octets it is given, and records the
+// length of each constructed element in the order in which the elements are
+// begun.  It then visits the object a second time, writing directly to the
+// output stream buffer and consuming the recorded lengths in the same order.
+// No part of the encoding is buffered, and nothing is written to the output
+// if the first pass fails.  The resulting encoding is at least as compact as
+// the indefinite-length encoding for elements with fewer than 128 octets of
+// contents, and can be consumed by decoders that do not support the
+// indefinite form.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -183,7 +202,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_keyword.h>
 #include <bsls_objectbuffer.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsl_typeinfo.h>
@@ -258,6 +279,50 @@ class BerEncoder {
         int length() const;
     };
 
+    /// This class provides an output stream buffer that discards the
+    /// characters written to it, and keeps count of them.
+    class CountingStreamBuf : public bsl::streambuf {
+
+        // PRIVATE CONSTANTS
+        enum { k_BUFFER_SIZE = 64 };
+
+        // DATA
+        char            d_buffer[k_BUFFER_SIZE];  // put area
+        bsl::streamsize d_count;                  // number of characters
+                                                  // flushed from the put area
+
+        // NOT IMPLEMENTED
+        CountingStreamBuf(const CountingStreamBuf&);             // = delete;
+        CountingStreamBuf& operator=(const CountingStreamBuf&);  // = delete;
+
+      protected:
+        // PROTECTED MANIPULATORS
+
+        /// Discard the contents of the put area, and count the specified
+        /// `c` unless it is `eof`.  Return `c`, or a value other than `eof`
+        /// if `c` is `eof`.
+        int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE;
+
+        /// Count, and discard, the specified `length` characters of the
+        /// specified `source`.  Return `length`.
+        bsl::streamsize xsputn(const char      *source,
+                               bsl::streamsize  length) BSLS_KEYWORD_OVERRIDE;
+
+      public:
+        // CREATORS
+
+        /// Create a stream buffer that has counted no characters.
+        CountingStreamBuf();
+
+        /// Destroy this object.
+        ~CountingStreamBuf() BSLS_KEYWORD_OVERRIDE;
+
+        // ACCESSORS
+
+        /// Return the number of characters written to this stream buffer.
+        bsl::streamsize count() const;
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -271,6 +336,16 @@ class BerEncoder {
     };
 
   private:
+    // PRIVATE TYPES
+    enum LengthMode {
+        // Enumeration of the ways in which the length octets of constructed
+        // elements are written.
+
+        e_INDEFINITE_LENGTH,  // indefinite form, end-of-contents octets
+        e_COMPUTE_LENGTHS,    // counting pass; `d_lengths` is being filled
+        e_DEFINITE_LENGTH     // definite form, taken from `d_lengths`
+    };
+
     // DATA
     const BerEncoderOptions          *d_options;        // held, not owned
     bslma::Allocator                 *d_allocator;      // held, not owned
@@ -287,6 +362,22 @@ class BerEncoder {
     bsl::streambuf                   *d_streamBuf;      // held, not owned
     int                               d_currentDepth;   // current depth
 
+    LengthMode                        d_lengthMode;     // how to write the
+                                                        // lengths of
+                                                        // constructed elements
+
+    CountingStreamBuf                *d_countingStreamBuf;
+                                                        // counting pass
+                                                        // stream buffer, or 0
+
+    // lengths of the contents of the constructed elements, in the order in
+    // which the elements are begun
+    bsl::vector<int>                  d_lengths;
+
+    bsl::size_t                       d_nextLength;     // index in `d_lengths`
+                                                        // of the next length
+                                                        // to be written
+
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
     BerEncoder& operator=(const BerEncoder&);  // = delete;
@@ -311,6 +402,26 @@ class BerEncoder {
     /// created yet, it will be created during this call.
     bsl::ostream& logStream();
 
+    /// Write the length octets of a constructed element whose identifier
+    /// octets have just been written, as appropriate for the current length
+    /// mode, and load into the specified `token` a value to be supplied to
+    /// the matching call to `endConstructedContents`.  Return 0 on success,
+    /// and a non-zero value otherwise.
+    int beginConstructedContents(int *token);
+
+    /// Terminate the contents of the constructed element begun by the call
+    /// to `beginConstructedContents` that loaded the specified `token`, as
+    /// appropriate for the current length mode.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    int endConstructedContents(int token);
+
+    /// Encode the specified `value` as the top-level element, using the
+    /// options currently held by this encoder, to the stream buffer
+    /// currently held by this encoder.  Return 0 on success, and a non-zero
+    /// value otherwise.
+    template <typename TYPE>
+    int encodeTopLevel(const TYPE& value);
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -574,6 +685,17 @@ int balber::BerEncoder::MemOutStream::length() const
     return static_cast<int>(d_sb.length());
 }
 
+                 // -------------------------------------------
+                 // class balber::BerEncoder::CountingStreamBuf
+                 // -------------------------------------------
+
+// ACCESSORS
+inline
+bsl::streamsize balber::BerEncoder::CountingStreamBuf::count() const
+{
+    return d_count + (pptr() - pbase());
+}
+
 namespace balber {
 
                         // ----------------------------
@@ -682,18 +804,11 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
     if (! d_options) {
         BerEncoderOptions options;  // temporary options object
         d_options = &options;
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-
-        rc = visitor(value);
+        rc = encodeTopLevel(value);
         d_options = 0;
     }
     else {
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-        rc = visitor(value);
+        rc = encodeTopLevel(value);
     }
 
     d_streamBuf = 0;
@@ -718,6 +833,96 @@ int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
 }
 
 // PRIVATE MANIPULATORS
+inline
+int BerEncoder::beginConstructedContents(int *token)
+{
+    BSLS_ASSERT(token);
+
+    switch (d_lengthMode) {
+      case e_COMPUTE_LENGTHS: {
+        // Remember where the contents begin; 'endConstructedContents'
+        // replaces this with the length of the contents.
+
+        *token = static_cast<int>(d_lengths.size());
+        d_lengths.push_back(static_cast<int>(d_countingStreamBuf->count()));
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        *token = 0;
+        return BerUtil::putLength(d_streamBuf,
+                                  d_lengths[d_nextLength++]);         // RETURN
+      }
+      default: {
+        *token = 0;
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+    }
+}
+
+inline
+int BerEncoder::endConstructedContents(int token)
+{
+    switch (d_lengthMode) {
+      case e_COMPUTE_LENGTHS: {
+        int& length = d_lengths[token];
+        length = static_cast<int>(d_countingStreamBuf->count()) - length;
+
+        // Count the length octets, which in the second pass precede the
+        // contents rather than follow them.
+
+        return BerUtil::putLength(d_streamBuf, length);               // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+    }
+}
+
+template <typename TYPE>
+int BerEncoder::encodeTopLevel(const TYPE& value)
+{
+    if (d_options->encodeDefiniteLength()) {
+        bsl::streambuf    *streamBuf = d_streamBuf;
+        CountingStreamBuf  countingStreamBuf;
+
+        d_streamBuf         = &countingStreamBuf;
+        d_countingStreamBuf = &countingStreamBuf;
+        d_lengthMode        = e_COMPUTE_LENGTHS;
+        d_lengths.clear();
+
+        int rc;
+        {
+            BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+            rc = visitor(value);
+        }
+
+        d_streamBuf         = streamBuf;
+        d_countingStreamBuf = 0;
+        d_lengthMode        = e_DEFINITE_LENGTH;
+        d_nextLength        = 0;
+
+        if (0 != rc) {
+            d_lengthMode = e_INDEFINITE_LENGTH;
+            return rc;                                                // RETURN
+        }
+    }
+
+    BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+    const int rc = visitor(value);
+
+    d_lengthMode = e_INDEFINITE_LENGTH;
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
                            BerConstants::TagClass     tagClass,
@@ -733,13 +938,16 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    int outerToken;
+    if (rc | beginConstructedContents(&outerToken)) {
         return k_FAILURE;                                             // RETURN
     }
 
     const bool isUntagged = formattingMode
                           & bdlat_FormattingMode::e_UNTAGGED;
 
+    int innerToken = 0;
+
     if (!isUntagged) {
         // According to X.694 (clause 20.4), an XML choice (not anonymous)
         // element is encoded as a sequence with 1 element.
@@ -748,7 +956,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginConstructedContents(&innerToken)) {
             return k_FAILURE;
         }
     }
@@ -782,10 +990,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        endConstructedContents(innerToken);
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents(outerToken);
 }
 
 template <typename TYPE>
@@ -807,7 +1015,8 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        int token;
+        if (rc | beginConstructedContents(&token)) {
             return k_FAILURE;
         }
 
@@ -825,7 +1034,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return endConstructedContents(token);
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -899,13 +1108,14 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int token;
+    rc |= beginConstructedContents(&token);
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= endConstructedContents(token);
 
     return rc;
 }
@@ -967,7 +1177,8 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int token;
+    rc |= beginConstructedContents(&token);
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -986,7 +1197,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents(token);
 }
 
 template <typename TYPE>
@@ -90,7 +90,8 @@ using bsl::flush;
 // [11] NILLABLE VALUES
 // [12] ARRAYS WITH `encodeEmptyArrays` OPTION {DRQS 29114951 <GO>}
 // [13] DATE/TIME COMPONENTS
-// [14] USAGE EXAMPLE
+// [14] DEFINITE-LENGTH ENCODING
+// [15] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
 
@@ -243,6 +244,135 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+/// Read from the specified `streamBuf` the BER elements that make up the
+/// contents of a constructed element having the specified `length`, which
+/// is `balber::BerUtil::k_INDEFINITE_LENGTH` if the contents are terminated
+/// by end-of-contents octets, and append to the specified `primitives` the
+/// tag number and contents of each primitive element found (at any depth),
+/// in order.  Increment the specified `numIndefinite` for each constructed
+/// element having an indefinite length, and add the number of octets read to
+/// the specified `accumNumBytesConsumed`.  Return 0 on success, and a
+/// non-zero value if the data is not well formed.
+int flattenBer(bsl::string    *primitives,
+               int            *numIndefinite,
+               bsl::streambuf *streamBuf,
+               int             length,
+               int            *accumNumBytesConsumed)
+{
+    const bool isIndefinite = balber::BerUtil::k_INDEFINITE_LENGTH == length;
+    const int  end          = *accumNumBytesConsumed + length;
+
+    while (isIndefinite || *accumNumBytesConsumed < end) {
+        if (isIndefinite && 0 == streamBuf->sgetc()) {
+            return balber::BerUtil::getEndOfContentOctets(
+                                                   streamBuf,
+                                                   accumNumBytesConsumed);
+                                                                      // RETURN
+        }
+
+        balber::BerConstants::TagClass tagClass;
+        balber::BerConstants::TagType  tagType;
+        int                            tagNumber;
+        int                            elementLength;
+
+        if (0 != balber::BerUtil::getIdentifierOctets(streamBuf,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      accumNumBytesConsumed)
+         || 0 != balber::BerUtil::getLength(streamBuf,
+                                            &elementLength,
+                                            accumNumBytesConsumed)) {
+            return -1;                                                // RETURN
+        }
+
+        if (balber::BerConstants::e_CONSTRUCTED == tagType) {
+            if (balber::BerUtil::k_INDEFINITE_LENGTH == elementLength) {
+                ++*numIndefinite;
+            }
+            if (0 != flattenBer(primitives,
+                                numIndefinite,
+                                streamBuf,
+                                elementLength,
+                                accumNumBytesConsumed)) {
+                return -1;                                            // RETURN
+            }
+            continue;
+        }
+
+        bsl::string contents(elementLength, '\0');
+        if (elementLength != streamBuf->sgetn(contents.data(),
+                                              elementLength)) {
+            return -1;                                                // RETURN
+        }
+        *accumNumBytesConsumed += elementLength;
+
+        primitives->push_back(static_cast<char>(tagNumber));
+        primitives->append(contents);
+    }
+
+    return *accumNumBytesConsumed == end ? 0 : -1;
+}
+
+/// Encode the specified `value` using the specified `options`, both with
+/// and without definite lengths, and verify that the two encodings contain
+/// the same primitive elements, that only the second contains no
+/// indefinite lengths, and that it is no longer than the first.  Return the
+/// number of verifications that failed.
+template <class TYPE>
+int verifyDefiniteLengthEncoding(const TYPE&                      value,
+                                 const balber::BerEncoderOptions& options)
+{
+    balber::BerEncoderOptions definiteOptions(options);
+    definiteOptions.setEncodeDefiniteLength(true);
+
+    balber::BerEncoder     encoder(&options);
+    balber::BerEncoder     definiteEncoder(&definiteOptions);
+    bdlsb::MemOutStreamBuf osb;
+    bdlsb::MemOutStreamBuf definiteOsb;
+
+    int numFailures = 0;
+
+    if (0 != encoder.encode(&osb, value)
+     || 0 != definiteEncoder.encode(&definiteOsb, value)) {
+        return 1;                                                     // RETURN
+    }
+
+    if (veryVerbose) {
+        P(definiteOsb.length())
+        printBuffer(definiteOsb.data(), definiteOsb.length());
+    }
+
+    bsl::string primitives;
+    bsl::string definitePrimitives;
+    int         numIndefinite         = 0;
+    int         numDefiniteIndefinite = 0;
+    int         numBytes              = 0;
+    int         numDefiniteBytes      = 0;
+
+    bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+    bdlsb::FixedMemInStreamBuf definiteIsb(definiteOsb.data(),
+                                           definiteOsb.length());
+
+    numFailures += 0 != flattenBer(&primitives,
+                                   &numIndefinite,
+                                   &isb,
+                                   static_cast<int>(osb.length()),
+                                   &numBytes);
+    numFailures += 0 != flattenBer(&definitePrimitives,
+                                   &numDefiniteIndefinite,
+                                   &definiteIsb,
+                                   static_cast<int>(definiteOsb.length()),
+                                   &numDefiniteBytes);
+
+    numFailures += 0 == numIndefinite;
+    numFailures += 0 != numDefiniteIndefinite;
+    numFailures += primitives != definitePrimitives;
+    numFailures += osb.length() < definiteOsb.length();
+
+    return numFailures;
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -825,7 +955,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -847,6 +977,119 @@ int main(int argc, char *argv[])
                              "\n=============\n";
         usageExample();
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // DEFINITE-LENGTH ENCODING
+        //
+        // Concerns:
+        // 1. When the `encodeDefiniteLength` option is `true`, every
+        //    constructed element is encoded with a definite length.
+        //
+        // 2. The definite-length encoding contains the same primitive
+        //    elements, in the same order, as the indefinite-length encoding.
+        //
+        // 3. Lengths requiring more than one length octet are computed
+        //    correctly.
+        //
+        // 4. Sequences, choices (tagged and anonymous), arrays, and nillable
+        //    values are all supported.
+        //
+        // 5. An encoder can be reused after a definite-length encoding fails.
+        //
+        // Plan:
+        // 1. For a set of values exercising each kind of constructed element,
+        //    encode the value with and without definite lengths, walk both
+        //    encodings element by element, and verify that only the latter
+        //    has no indefinite lengths and that both have the same primitive
+        //    elements.  (C-1..4)
+        //
+        // 2. Encode an unselected choice with the
+        //    `disableUnselectedChoiceEncoding` option set, verify that the
+        //    encoding fails without writing any output, and that a following
+        //    encoding succeeds.  (C-5)
+        //
+        // Testing:
+        //   DEFINITE-LENGTH ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDEFINITE-LENGTH ENCODING"
+                             "\n========================\n";
+
+        balber::BerEncoderOptions options;
+
+        if (verbose) cout << "\tSequences\n";
+        {
+            test::MySequence value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+        }
+
+        if (verbose) cout << "\tChoices\n";
+        {
+            test::MyChoice value;
+            value.makeSelection2("Hello");
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+        }
+        {
+            test::MySequenceWithAnonymousChoice value;
+            value.attribute1() = 34;
+            value.choice().makeMyChoice2("World!");
+            value.attribute2() = "Hello";
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+        }
+
+        if (verbose) cout << "\tNillable values\n";
+        {
+            test::MySequenceWithNillable value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+
+            value.myNillable() = "World!";
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+        }
+
+        if (verbose) cout << "\tArrays\n";
+        {
+            test::MySequenceWithArray value;
+            value.attribute1() = 34;
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+
+            for (int i = 0; i < 100; ++i) {
+                value.attribute2().push_back("Hello, World!");
+            }
+
+            ASSERT(0 == verifyDefiniteLengthEncoding(value, options));
+        }
+
+        if (verbose) cout << "\tFailure\n";
+        {
+            balber::BerEncoderOptions definiteOptions;
+            definiteOptions.setEncodeDefiniteLength(true);
+            definiteOptions.setDisableUnselectedChoiceEncoding(true);
+
+            balber::BerEncoder     encoder(&definiteOptions);
+            bdlsb::MemOutStreamBuf osb;
+
+            test::MyChoice value;
+            ASSERT(value.isUndefinedValue());
+
+            ASSERT(0 != encoder.encode(&osb, value));
+            ASSERT(0 == osb.length());
+
+            value.makeSelection1(34);
+
+            ASSERT(0 == encoder.encode(&osb, value));
+            ASSERT(0 <  osb.length());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // DATE/TIME COMPONENTS
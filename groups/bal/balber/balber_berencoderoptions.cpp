@@ -43,6 +43,8 @@ const bool BerEncoderOptions::DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCO
 
 const bool BerEncoderOptions::DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO = false;
 
+const bool BerEncoderOptions::DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH = false;
+
 const bdlat_AttributeInfo BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         ATTRIBUTE_ID_TRACE_LEVEL,
@@ -92,6 +94,13 @@ const bdlat_AttributeInfo BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("PreserveSignOfNegativeZero") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH,
+        "EncodeDefiniteLength",
+        sizeof("EncodeDefiniteLength") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -101,7 +110,7 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 7; ++i) {
+    for (int i = 0; i < 8; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
                     BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -132,6 +141,8 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING];
       case ATTRIBUTE_ID_PRESERVE_SIGN_OF_NEGATIVE_ZERO:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO];
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH];
       default:
         return 0;
     }
@@ -147,6 +158,7 @@ BerEncoderOptions::BerEncoderOptions()
 , d_encodeDateAndTimeTypesAsBinary(DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY)
 , d_disableUnselectedChoiceEncoding(DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING)
 , d_preserveSignOfNegativeZero(DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO)
+, d_encodeDefiniteLength(DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH)
 {
 }
 
@@ -158,6 +170,7 @@ BerEncoderOptions::BerEncoderOptions(const BerEncoderOptions& original)
 , d_encodeDateAndTimeTypesAsBinary(original.d_encodeDateAndTimeTypesAsBinary)
 , d_disableUnselectedChoiceEncoding(original.d_disableUnselectedChoiceEncoding)
 , d_preserveSignOfNegativeZero(original.d_preserveSignOfNegativeZero)
+, d_encodeDefiniteLength(original.d_encodeDefiniteLength)
 {
 }
 
@@ -178,6 +191,7 @@ BerEncoderOptions::operator=(const BerEncoderOptions& rhs)
         d_datetimeFractionalSecondPrecision = rhs.d_datetimeFractionalSecondPrecision;
         d_disableUnselectedChoiceEncoding = rhs.d_disableUnselectedChoiceEncoding;
         d_preserveSignOfNegativeZero = rhs.d_preserveSignOfNegativeZero;
+        d_encodeDefiniteLength = rhs.d_encodeDefiniteLength;
     }
 
     return *this;
@@ -196,6 +210,7 @@ BerEncoderOptions::operator=(BerEncoderOptions&& rhs)
         d_datetimeFractionalSecondPrecision = bsl::move(rhs.d_datetimeFractionalSecondPrecision);
         d_disableUnselectedChoiceEncoding = bsl::move(rhs.d_disableUnselectedChoiceEncoding);
         d_preserveSignOfNegativeZero = bsl::move(rhs.d_preserveSignOfNegativeZero);
+        d_encodeDefiniteLength = bsl::move(rhs.d_encodeDefiniteLength);
     }
 
     return *this;
@@ -211,6 +226,7 @@ void BerEncoderOptions::reset()
     d_datetimeFractionalSecondPrecision = DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND_PRECISION;
     d_disableUnselectedChoiceEncoding = DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING;
     d_preserveSignOfNegativeZero = DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO;
+    d_encodeDefiniteLength = DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
 }
 
 // ACCESSORS
@@ -229,6 +245,7 @@ bsl::ostream& BerEncoderOptions::print(
     printer.printAttribute("datetimeFractionalSecondPrecision", this->datetimeFractionalSecondPrecision());
     printer.printAttribute("disableUnselectedChoiceEncoding", this->disableUnselectedChoiceEncoding());
     printer.printAttribute("preserveSignOfNegativeZero", this->preserveSignOfNegativeZero());
+    printer.printAttribute("encodeDefiniteLength", this->encodeDefiniteLength());
     printer.end();
     return stream;
 }
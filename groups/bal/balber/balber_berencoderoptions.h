@@ -99,6 +99,16 @@ class BerEncoderOptions {
     // eventually be deprecated, and the default value changed to `true`.
     bool  d_preserveSignOfNegativeZero;
 
+    // This option controls whether constructed elements (sequences,
+    // choices, arrays, and nillable values) are encoded using the definite
+    // form of length octets.  By default the encoder uses the indefinite
+    // form, terminated by end-of-contents octets, which it can write in a
+    // single pass.  If this option is `true`, the encoder first computes
+    // the length of each constructed element in a pass over the object
+    // that writes no output, and then writes the encoding, with definite
+    // lengths, directly to the output.
+    bool  d_encodeDefiniteLength;
+
   public:
     // TYPES
     enum {
@@ -109,10 +119,11 @@ class BerEncoderOptions {
       , ATTRIBUTE_ID_DATETIME_FRACTIONAL_SECOND_PRECISION = 4
       , ATTRIBUTE_ID_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
       , ATTRIBUTE_ID_PRESERVE_SIGN_OF_NEGATIVE_ZERO       = 6
+      , ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH               = 7
     };
 
     enum {
-        NUM_ATTRIBUTES = 7
+        NUM_ATTRIBUTES = 8
     };
 
     enum {
@@ -123,6 +134,7 @@ class BerEncoderOptions {
       , ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION = 4
       , ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
       , ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO       = 6
+      , ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH               = 7
     };
 
     // CONSTANTS
@@ -142,6 +154,8 @@ class BerEncoderOptions {
 
     static const bool DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO;
 
+    static const bool DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -271,6 +285,10 @@ class BerEncoderOptions {
     /// specified `value`.
     void setPreserveSignOfNegativeZero(bool value);
 
+    /// Set the "EncodeDefiniteLength" attribute of this object to the
+    /// specified `value`.
+    void setEncodeDefiniteLength(bool value);
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -351,6 +369,10 @@ class BerEncoderOptions {
     /// Return the value of the "PreserveSignOfNegativeZero" attribute of
     /// this object.
     bool preserveSignOfNegativeZero() const;
+
+    /// Return the value of the "EncodeDefiniteLength" attribute of this
+    /// object.
+    bool encodeDefiniteLength() const;
 };
 
 // FREE OPERATORS
@@ -393,7 +415,7 @@ namespace balber {
 inline
 int BerEncoderOptions::maxSupportedBdexVersion()
 {
-    return 2;  // versions start at 1.
+    return 3;  // versions start at 1.
 }
 
 // MANIPULATORS
@@ -402,6 +424,16 @@ STREAM& BerEncoderOptions::bdexStreamIn(STREAM& stream, int version)
 {
     if (stream) {
         switch (version) {
+          case 3: {
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_traceLevel, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_bdeVersionConformance, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeEmptyArrays, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeDateAndTimeTypesAsBinary, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_datetimeFractionalSecondPrecision, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_disableUnselectedChoiceEncoding, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_preserveSignOfNegativeZero, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeDefiniteLength, 1);
+          } break;
           case 2: {
             bslx::InStreamFunctions::bdexStreamIn(stream, d_traceLevel, 1);
             bslx::InStreamFunctions::bdexStreamIn(stream, d_bdeVersionConformance, 1);
@@ -469,6 +501,11 @@ int BerEncoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -499,6 +536,9 @@ int BerEncoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
       case ATTRIBUTE_ID_PRESERVE_SIGN_OF_NEGATIVE_ZERO: {
         return manipulator(&d_preserveSignOfNegativeZero, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO]);
       }
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return manipulator(&d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      }
       default:
         return NOT_FOUND;
     }
@@ -563,11 +603,27 @@ void BerEncoderOptions::setPreserveSignOfNegativeZero(bool value)
     d_preserveSignOfNegativeZero = value;
 }
 
+inline
+void BerEncoderOptions::setEncodeDefiniteLength(bool value)
+{
+    d_encodeDefiniteLength = value;
+}
+
 // ACCESSORS
 template <class STREAM>
 STREAM& BerEncoderOptions::bdexStreamOut(STREAM& stream, int version) const
 {
     switch (version) {
+      case 3: {
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->traceLevel(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->bdeVersionConformance(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeEmptyArrays(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeDateAndTimeTypesAsBinary(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->datetimeFractionalSecondPrecision(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->disableUnselectedChoiceEncoding(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->preserveSignOfNegativeZero(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeDefiniteLength(), 1);
+      } break;
       case 2: {
         bslx::OutStreamFunctions::bdexStreamOut(stream, this->traceLevel(), 1);
         bslx::OutStreamFunctions::bdexStreamOut(stream, this->bdeVersionConformance(), 1);
@@ -632,6 +688,11 @@ int BerEncoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -662,6 +723,9 @@ int BerEncoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
       case ATTRIBUTE_ID_PRESERVE_SIGN_OF_NEGATIVE_ZERO: {
         return accessor(d_preserveSignOfNegativeZero, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO]);
       }
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return accessor(d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      }
       default:
         return NOT_FOUND;
     }
@@ -726,6 +790,12 @@ bool BerEncoderOptions::preserveSignOfNegativeZero() const
     return d_preserveSignOfNegativeZero;
 }
 
+inline
+bool BerEncoderOptions::encodeDefiniteLength() const
+{
+    return d_encodeDefiniteLength;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -741,7 +811,8 @@ bool balber::operator==(
          && lhs.encodeDateAndTimeTypesAsBinary() == rhs.encodeDateAndTimeTypesAsBinary()
          && lhs.datetimeFractionalSecondPrecision() == rhs.datetimeFractionalSecondPrecision()
          && lhs.disableUnselectedChoiceEncoding() == rhs.disableUnselectedChoiceEncoding()
-         && lhs.preserveSignOfNegativeZero() == rhs.preserveSignOfNegativeZero();
+         && lhs.preserveSignOfNegativeZero() == rhs.preserveSignOfNegativeZero()
+         && lhs.encodeDefiniteLength() == rhs.encodeDefiniteLength();
 }
 
 inline
@@ -698,6 +698,7 @@ int main(int argc, char *argv[])
         const int   D5   = 3;            // `datetimeFractionalSecondPrecision`
         const int   D6   = false;        // `disableUnselectedChoiceEncoding`
         const bool  D7   = false;        // `preserveSignOfNegativeZero`
+        const bool  D8   = false;        // `encodeDefiniteLength`
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -721,6 +722,8 @@ int main(int argc, char *argv[])
                      D6 == X.disableUnselectedChoiceEncoding());
         LOOP2_ASSERT(D7, X.preserveSignOfNegativeZero(),
                      D7 == X.preserveSignOfNegativeZero());
+        LOOP2_ASSERT(D8, X.encodeDefiniteLength(),
+                     D8 == X.encodeDefiniteLength());
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -759,6 +762,7 @@ int main(int argc, char *argv[])
         typedef int   T5;        // `datetimeFractionalSecondPrecision`
         typedef int   T6;        // `disableUnselectedChoiceEncoding`
         typedef bool  T7;        // `preserveSignOfNegativeZero`
+        typedef bool  T8;        // `encodeDefiniteLength`
 
         // Attribute 1 Values: `traceLevel`
 
@@ -795,6 +799,11 @@ int main(int argc, char *argv[])
         const T7 D7 = false;    // default value
         const T7 A7 = true;
 
+        // Attribute 8 Values: `encodeDefiniteLength`
+
+        const T8 D8 = false;    // default value
+        const T8 A8 = true;
+
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
         if (verbose) cout << "\n 1. Create an object `w` (default ctor)."
@@ -812,6 +821,7 @@ int main(int argc, char *argv[])
         ASSERT(D5 == W.datetimeFractionalSecondPrecision());
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
         ASSERT(D7 == W.preserveSignOfNegativeZero());
+        ASSERT(D8 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                   "\tb. Try equality operators: `w` <op> `w`." << endl;
@@ -835,6 +845,7 @@ int main(int argc, char *argv[])
         ASSERT(D5 == X.datetimeFractionalSecondPrecision());
         ASSERT(D6 == X.disableUnselectedChoiceEncoding());
         ASSERT(D7 == X.preserveSignOfNegativeZero());
+        ASSERT(D8 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                    "\tb. Try equality operators: `x` <op> `w`, `x`." << endl;
@@ -854,6 +865,7 @@ int main(int argc, char *argv[])
         mX.setDatetimeFractionalSecondPrecision(A5);
         mX.setDisableUnselectedChoiceEncoding(A6);
         mX.setPreserveSignOfNegativeZero(A7);
+        mX.setEncodeDefiniteLength(A8);
 
         if (veryVerbose) cout << "\ta. Check new value of `x`." << endl;
         if (veryVeryVerbose) { T_ T_ P(X) }
@@ -865,6 +877,7 @@ int main(int argc, char *argv[])
         ASSERT(A5 == X.datetimeFractionalSecondPrecision());
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
         ASSERT(A7 == X.preserveSignOfNegativeZero());
+        ASSERT(A8 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: `x` <op> `w`, `x`." << endl;
@@ -885,6 +898,7 @@ int main(int argc, char *argv[])
         mY.setDatetimeFractionalSecondPrecision(A5);
         mY.setDisableUnselectedChoiceEncoding(A6);
         mY.setPreserveSignOfNegativeZero(A7);
+        mY.setEncodeDefiniteLength(A8);
 
         if (veryVerbose) cout << "\ta. Check initial value of `y`." << endl;
         if (veryVeryVerbose) { T_ T_ P(Y) }
@@ -896,6 +910,7 @@ int main(int argc, char *argv[])
         ASSERT(A5 == Y.datetimeFractionalSecondPrecision());
         ASSERT(A6 == Y.disableUnselectedChoiceEncoding());
         ASSERT(A7 == Y.preserveSignOfNegativeZero());
+        ASSERT(A8 == Y.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: `y` <op> `w`, `x`, `y`" << endl;
@@ -921,6 +936,7 @@ int main(int argc, char *argv[])
         ASSERT(A5 == Z.datetimeFractionalSecondPrecision());
         ASSERT(A6 == Z.disableUnselectedChoiceEncoding());
         ASSERT(A7 == Z.preserveSignOfNegativeZero());
+        ASSERT(A8 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `z` <op> `w`, `x`, `y`, `z`." << endl;
@@ -942,6 +958,7 @@ int main(int argc, char *argv[])
         mZ.setDatetimeFractionalSecondPrecision(D5);
         mZ.setDisableUnselectedChoiceEncoding(D6);
         mZ.setPreserveSignOfNegativeZero(D7);
+        mZ.setEncodeDefiniteLength(D8);
 
         if (veryVerbose) cout << "\ta. Check new value of `z`." << endl;
         if (veryVeryVerbose) { T_ T_ P(Z) }
@@ -953,6 +970,7 @@ int main(int argc, char *argv[])
         ASSERT(D5 == Z.datetimeFractionalSecondPrecision());
         ASSERT(D6 == Z.disableUnselectedChoiceEncoding());
         ASSERT(D7 == Z.preserveSignOfNegativeZero());
+        ASSERT(D8 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `z` <op> `w`, `x`, `y`, `z`." << endl;
@@ -978,6 +996,7 @@ int main(int argc, char *argv[])
         ASSERT(A5 == W.datetimeFractionalSecondPrecision());
         ASSERT(A6 == W.disableUnselectedChoiceEncoding());
         ASSERT(A7 == W.preserveSignOfNegativeZero());
+        ASSERT(A8 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `w` <op> `w`, `x`, `y`, `z`." << endl;
@@ -1003,6 +1022,7 @@ int main(int argc, char *argv[])
         ASSERT(D5 == W.datetimeFractionalSecondPrecision());
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
         ASSERT(D7 == W.preserveSignOfNegativeZero());
+        ASSERT(D8 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `x` <op> `w`, `x`, `y`, `z`." << endl;
@@ -1028,6 +1048,7 @@ int main(int argc, char *argv[])
         ASSERT(A5 == X.datetimeFractionalSecondPrecision());
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
         ASSERT(A7 == X.preserveSignOfNegativeZero());
+        ASSERT(A8 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `x` <op> `w`, `x`, `y`, `z`." << endl;
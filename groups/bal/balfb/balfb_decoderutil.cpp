@@ -0,0 +1,77 @@
+// balfb_decoderutil.cpp                                              -*-C++-*-
+#include <balfb_decoderutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balfb_decoderutil_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balfb {
+
+                           // ---------------------
+                           // class DecoderUtil_Imp
+                           // ---------------------
+
+// ACCESSORS
+int DecoderUtil_Imp::decodeSlot(bsl::string                *value,
+                                bsl::size_t                 slot,
+                                bdlat_TypeCategory::Simple) const
+{
+    const char  *data;
+    bsl::size_t  dataLength;
+    if (0 != getBytes(&data, &dataLength, slot)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(data, dataLength);
+    return 0;
+}
+
+int DecoderUtil_Imp::decodeSlot(bsl::vector<char>         *value,
+                                bsl::size_t                slot,
+                                bdlat_TypeCategory::Array) const
+{
+    const char  *data;
+    bsl::size_t  dataLength;
+    if (0 != getBytes(&data, &dataLength, slot)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(data, data + dataLength);
+    return 0;
+}
+
+int DecoderUtil_Imp::getBytes(const char  **data,
+                              bsl::size_t  *dataLength,
+                              bsl::size_t   slot) const
+{
+    bsl::size_t position;
+    if (0 != FormatUtil::followOffset(&position, d_buffer_p, d_length, slot)
+     || 0 == position) {
+        return -1;                                                    // RETURN
+    }
+
+    return FormatUtil::getString(data,
+                                 dataLength,
+                                 d_buffer_p,
+                                 d_length,
+                                 position);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,599 @@
+// balfb_decoderutil.h                                                -*-C++-*-
+#ifndef INCLUDED_BALFB_DECODERUTIL
+#define INCLUDED_BALFB_DECODERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functions to decode values in the flat binary format.
+//
+//@CLASSES:
+//  balfb::DecoderUtil: namespace for decoding `bdlat` types from flat format
+//
+//@SEE_ALSO: balfb_encoder, balfb_view, balfb_formatutil
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `balfb::DecoderUtil`, that serves as a namespace for functions that decode
+// objects of types supported by the `bdlat` framework from the "flat" binary
+// format described in `balfb_formatutil` (and produced by `balfb::Encoder`).
+// `decode` decodes a complete encoding, and `decodeSlot` decodes the value
+// whose slot is at a given position within an encoding, so that a part of an
+// encoded object found using `balfb_view` can be decoded on its own.
+//
+// The decoding functions check that every byte they read is within the
+// supplied buffer, so decoding malformed (or malicious) input fails, rather
+// than having undefined behavior.
+//
+///Schema Evolution
+///----------------
+// The attributes of an encoded sequence are identified by their ids.  An
+// attribute of the type being decoded that is absent from the encoding is
+// left with its default value (or null, if it is nullable), and an attribute
+// in the encoding whose id is not that of an attribute of the type being
+// decoded is ignored.  Therefore, a sequence type may gain or lose attributes
+// (having new ids) without invalidating existing encodings.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding an Employee Record
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that the class `test::Employee` represents an employee record (see
+// {`balfb_encoder`|Example 1: Encoding an Employee Record}), and that we have
+// encoded a record in the flat format:
+// ```
+// test::Employee bob;
+// bob.name()                 = "Bob";
+// bob.homeAddress().street() = "Lexington Ave";
+// bob.homeAddress().city()   = "New York City";
+// bob.homeAddress().state()  = "New York";
+// bob.age()                  = 56;
+//
+// bdlsb::MemOutStreamBuf streamBuf;
+// balfb::Encoder         encoder;
+// int                    rc = encoder.encode(&streamBuf, bob);
+// assert(0 == rc);
+// ```
+// We can decode the complete record:
+// ```
+// test::Employee employee;
+// rc = balfb::DecoderUtil::decode(&employee,
+//                                 streamBuf.data(),
+//                                 streamBuf.length());
+// assert(0   == rc);
+// assert(bob == employee);
+// ```
+
+#include <balscm_version.h>
+
+#include <balfb_formatutil.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+#include <bdlat_valuetypefunctions.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+                             // ==================
+                             // struct DecoderUtil
+                             // ==================
+
+/// This `struct` provides a namespace for functions that decode objects of
+/// types supported by the `bdlat` framework from the flat format.
+struct DecoderUtil {
+
+    // CLASS METHODS
+
+    /// Load into the specified `result` the value encoded in the specified
+    /// `buffer` of the specified `length`.  Return 0 on success, and a
+    /// non-zero value otherwise.  On failure, `result` is left in a valid,
+    /// but unspecified, state.
+    template <class TYPE>
+    static int decode(TYPE *result, const char *buffer, bsl::size_t length);
+
+    /// Load into the specified `result` the value whose slot is at the
+    /// specified `slot` position in the encoding in the specified `buffer`
+    /// of the specified `length`.  Return 0 on success, and a non-zero value
+    /// otherwise.  On failure, `result` is left in a valid, but unspecified,
+    /// state.  Note that the attributes of a sequence that are absent from
+    /// the encoding are made null, if they are nullable, and are not
+    /// modified otherwise.
+    template <class TYPE>
+    static int decodeSlot(TYPE        *result,
+                          const char  *buffer,
+                          bsl::size_t  length,
+                          bsl::size_t  slot);
+};
+
+                           // =====================
+                           // class DecoderUtil_Imp
+                           // =====================
+
+/// This component-private class provides the implementation of the
+/// functions of `DecoderUtil`, decoding values from an encoding held in a
+/// buffer supplied at construction.
+class DecoderUtil_Imp {
+
+    // DATA
+    const char  *d_buffer_p;  // encoding (held, not owned)
+    bsl::size_t  d_length;    // length of the encoding
+
+  public:
+    // CREATORS
+
+    /// Create an object that decodes values from the specified `buffer` of
+    /// the specified `length`.
+    DecoderUtil_Imp(const char *buffer, bsl::size_t length);
+
+    // ACCESSORS
+
+    /// Load into the specified `value` the value whose slot is at the
+    /// specified `slot` position.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE>
+    int decodeSlot(TYPE *value, bsl::size_t slot) const;
+    int decodeSlot(bsl::string                *value,
+                   bsl::size_t                 slot,
+                   bdlat_TypeCategory::Simple) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                       *value,
+                   bsl::size_t                 slot,
+                   bdlat_TypeCategory::Simple) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                            *value,
+                   bsl::size_t                      slot,
+                   bdlat_TypeCategory::Enumeration) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                               *value,
+                   bsl::size_t                         slot,
+                   bdlat_TypeCategory::CustomizedType) const;
+    int decodeSlot(bsl::vector<char>         *value,
+                   bsl::size_t                slot,
+                   bdlat_TypeCategory::Array) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                      *value,
+                   bsl::size_t                slot,
+                   bdlat_TypeCategory::Array) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                         *value,
+                   bsl::size_t                   slot,
+                   bdlat_TypeCategory::Sequence) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                       *value,
+                   bsl::size_t                 slot,
+                   bdlat_TypeCategory::Choice) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                              *value,
+                   bsl::size_t                        slot,
+                   bdlat_TypeCategory::NullableValue) const;
+    template <class TYPE>
+    int decodeSlot(TYPE                            *value,
+                   bsl::size_t                      slot,
+                   bdlat_TypeCategory::DynamicType) const;
+
+    /// Load into the specified `value` the value of the attribute having the
+    /// specified `id` in the table at the specified `table` position, if the
+    /// table has such an attribute, and otherwise (if `value` is nullable)
+    /// make `value` null.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE>
+    int decodeAttribute(TYPE                              *value,
+                        bsl::size_t                        table,
+                        int                                id,
+                        bdlat_TypeCategory::NullableValue) const;
+    template <class TYPE, class CATEGORY>
+    int decodeAttribute(TYPE        *value,
+                        bsl::size_t  table,
+                        int          id,
+                        CATEGORY) const;
+
+    /// Load into the specified `data` and `dataLength` the address and
+    /// length of the data of the string (or binary value) whose slot is at
+    /// the specified `slot` position.  Return 0 on success, and a non-zero
+    /// value otherwise.
+    int getBytes(const char  **data,
+                 bsl::size_t  *dataLength,
+                 bsl::size_t   slot) const;
+};
+
+                     // ==================================
+                     // class DecoderUtil_SlotManipulator
+                     // ==================================
+
+/// This component-private class provides a manipulator that decodes a series
+/// of values whose slots are consecutive.
+class DecoderUtil_SlotManipulator {
+
+    // DATA
+    const DecoderUtil_Imp *d_imp_p;  // decoder (held, not owned)
+    bsl::size_t            d_slot;   // position of the slot of the next value
+
+  public:
+    // CREATORS
+
+    /// Create a manipulator that decodes values using the specified `imp`,
+    /// the first of which has its slot at the specified `slot` position.
+    DecoderUtil_SlotManipulator(const DecoderUtil_Imp *imp, bsl::size_t slot);
+
+    // MANIPULATORS
+
+    /// Load into the specified `value` the value of the next slot, and
+    /// advance to the slot following it.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class TYPE>
+    int operator()(TYPE *value);
+    template <class TYPE, class INFO>
+    int operator()(TYPE *value, const INFO&);
+};
+
+                  // =======================================
+                  // class DecoderUtil_AttributeManipulator
+                  // =======================================
+
+/// This component-private class provides a manipulator that decodes each
+/// attribute of a sequence from the table of the sequence.
+class DecoderUtil_AttributeManipulator {
+
+    // DATA
+    const DecoderUtil_Imp *d_imp_p;  // decoder (held, not owned)
+    bsl::size_t            d_table;  // position of the table
+
+  public:
+    // CREATORS
+
+    /// Create a manipulator that decodes attributes from the table at the
+    /// specified `table` position using the specified `imp`.
+    DecoderUtil_AttributeManipulator(const DecoderUtil_Imp *imp,
+                                     bsl::size_t            table);
+
+    // MANIPULATORS
+
+    /// Load into the specified `value` the value of the attribute described
+    /// by the specified `info`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE, class INFO>
+    int operator()(TYPE *value, const INFO& info);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // struct DecoderUtil
+                             // ------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+int DecoderUtil::decode(TYPE *result, const char *buffer, bsl::size_t length)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    bdlat_ValueTypeFunctions::reset(result);
+    return DecoderUtil_Imp(buffer, length).decodeSlot(result, 0);
+}
+
+template <class TYPE>
+inline
+int DecoderUtil::decodeSlot(TYPE        *result,
+                            const char  *buffer,
+                            bsl::size_t  length,
+                            bsl::size_t  slot)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    return DecoderUtil_Imp(buffer, length).decodeSlot(result, slot);
+}
+
+                           // ---------------------
+                           // class DecoderUtil_Imp
+                           // ---------------------
+
+// CREATORS
+inline
+DecoderUtil_Imp::DecoderUtil_Imp(const char *buffer, bsl::size_t length)
+: d_buffer_p(buffer)
+, d_length(length)
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int DecoderUtil_Imp::decodeSlot(TYPE *value, bsl::size_t slot) const
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return decodeSlot(value, slot, Category());
+}
+
+template <class TYPE>
+inline
+int DecoderUtil_Imp::decodeSlot(TYPE                       *value,
+                                bsl::size_t                 slot,
+                                bdlat_TypeCategory::Simple) const
+{
+    return FormatUtil::getValueAt(value, d_buffer_p, d_length, slot);
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                            *value,
+                                bsl::size_t                      slot,
+                                bdlat_TypeCategory::Enumeration) const
+{
+    int intValue;
+    if (0 != FormatUtil::getValueAt(&intValue, d_buffer_p, d_length, slot)) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat_EnumFunctions::fromInt(value, intValue);
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                               *value,
+                                bsl::size_t                         slot,
+                                bdlat_TypeCategory::CustomizedType) const
+{
+    typedef typename bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type
+                                                                      BaseType;
+
+    BaseType base;
+    if (0 != decodeSlot(&base, slot)) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat_CustomizedTypeFunctions::convertFromBaseType(value, base);
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                      *value,
+                                bsl::size_t                slot,
+                                bdlat_TypeCategory::Array) const
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    bsl::size_t position;
+    if (0 != FormatUtil::followOffset(&position, d_buffer_p, d_length, slot)
+     || 0 == position) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::size_t numElements;
+    if (0 != FormatUtil::getArrayLength(
+                                   &numElements,
+                                   d_buffer_p,
+                                   d_length,
+                                   position,
+                                   FormatUtil::InlineSize<ElementType>::value)
+     || static_cast<bsl::size_t>(INT_MAX) < numElements) {
+        return -1;                                                    // RETURN
+    }
+
+    bdlat_ArrayFunctions::resize(value, static_cast<int>(numElements));
+
+    DecoderUtil_SlotManipulator manipulator(
+                                        this,
+                                        position + FormatUtil::k_LENGTH_SIZE);
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        const int rc = bdlat_ArrayFunctions::manipulateElement(
+                                                         value,
+                                                         manipulator,
+                                                         static_cast<int>(i));
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                         *value,
+                                bsl::size_t                   slot,
+                                bdlat_TypeCategory::Sequence) const
+{
+    bsl::size_t table;
+    if (0 != FormatUtil::followOffset(&table, d_buffer_p, d_length, slot)
+     || 0 == table) {
+        return -1;                                                    // RETURN
+    }
+
+    DecoderUtil_AttributeManipulator manipulator(this, table);
+    return bdlat_SequenceFunctions::manipulateAttributes(value, manipulator);
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                       *value,
+                                bsl::size_t                 slot,
+                                bdlat_TypeCategory::Choice) const
+{
+    bsl::size_t position;
+    int         selectionId;
+    if (0 != FormatUtil::followOffset(&position, d_buffer_p, d_length, slot)
+     || 0 == position
+     || 0 != FormatUtil::getValueAt(&selectionId,
+                                    d_buffer_p,
+                                    d_length,
+                                    position)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID == selectionId) {
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+
+    if (0 != bdlat_ChoiceFunctions::makeSelection(value, selectionId)) {
+        return -1;                                                    // RETURN
+    }
+
+    DecoderUtil_SlotManipulator manipulator(
+                                  this,
+                                  position + FormatUtil::k_SELECTION_ID_SIZE);
+    return bdlat_ChoiceFunctions::manipulateSelection(value, manipulator);
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeSlot(TYPE                              *value,
+                                bsl::size_t                        slot,
+                                bdlat_TypeCategory::NullableValue) const
+{
+    bsl::size_t position;
+    if (0 != FormatUtil::followOffset(&position, d_buffer_p, d_length, slot)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == position) {
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+
+    bdlat_NullableValueFunctions::makeValue(value);
+
+    DecoderUtil_SlotManipulator manipulator(this, position);
+    return bdlat_NullableValueFunctions::manipulateValue(value, manipulator);
+}
+
+template <class TYPE>
+inline
+int DecoderUtil_Imp::decodeSlot(TYPE                            *,
+                                bsl::size_t                      ,
+                                bdlat_TypeCategory::DynamicType) const
+{
+    return -1;
+}
+
+template <class TYPE>
+int DecoderUtil_Imp::decodeAttribute(
+                                 TYPE                              *value,
+                                 bsl::size_t                        table,
+                                 int                                id,
+                                 bdlat_TypeCategory::NullableValue) const
+{
+    bsl::size_t slot;
+    if (0 != FormatUtil::lookupAttribute(&slot,
+                                         d_buffer_p,
+                                         d_length,
+                                         table,
+                                         id)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == slot) {
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+
+    bdlat_NullableValueFunctions::makeValue(value);
+
+    DecoderUtil_SlotManipulator manipulator(this, slot);
+    return bdlat_NullableValueFunctions::manipulateValue(value, manipulator);
+}
+
+template <class TYPE, class CATEGORY>
+int DecoderUtil_Imp::decodeAttribute(TYPE        *value,
+                                     bsl::size_t  table,
+                                     int          id,
+                                     CATEGORY) const
+{
+    bsl::size_t slot;
+    if (0 != FormatUtil::lookupAttribute(&slot,
+                                         d_buffer_p,
+                                         d_length,
+                                         table,
+                                         id)) {
+        return -1;                                                    // RETURN
+    }
+
+    return 0 == slot ? 0 : decodeSlot(value, slot, CATEGORY());
+}
+
+                     // ---------------------------------
+                     // class DecoderUtil_SlotManipulator
+                     // ---------------------------------
+
+// CREATORS
+inline
+DecoderUtil_SlotManipulator::DecoderUtil_SlotManipulator(
+                                                 const DecoderUtil_Imp *imp,
+                                                 bsl::size_t            slot)
+: d_imp_p(imp)
+, d_slot(slot)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int DecoderUtil_SlotManipulator::operator()(TYPE *value)
+{
+    const bsl::size_t slot = d_slot;
+    d_slot += FormatUtil::InlineSize<TYPE>::value;
+    return d_imp_p->decodeSlot(value, slot);
+}
+
+template <class TYPE, class INFO>
+inline
+int DecoderUtil_SlotManipulator::operator()(TYPE *value, const INFO&)
+{
+    return (*this)(value);
+}
+
+                  // --------------------------------------
+                  // class DecoderUtil_AttributeManipulator
+                  // --------------------------------------
+
+// CREATORS
+inline
+DecoderUtil_AttributeManipulator::DecoderUtil_AttributeManipulator(
+                                                const DecoderUtil_Imp *imp,
+                                                bsl::size_t            table)
+: d_imp_p(imp)
+, d_table(table)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int DecoderUtil_AttributeManipulator::operator()(TYPE        *value,
+                                                 const INFO&  info)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return d_imp_p->decodeAttribute(value, d_table, info.id(), Category());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,849 @@
+// balfb_decoderutil.t.cpp                                            -*-C++-*-
+#include <balfb_decoderutil.h>
+
+#include <balfb_encoder.h>        // for testing only
+#include <balfb_formatutil.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_basicrecord.h>
+#include <s_baltst_customint.h>
+#include <s_baltst_customizedstring.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_mychoice.h>
+#include <s_baltst_myenumeration.h>
+#include <s_baltst_mysequence.h>
+#include <s_baltst_mysequencewitharray.h>
+#include <s_baltst_mysequencewithchoice.h>
+#include <s_baltst_mysequencewithnullable.h>
+#include <s_baltst_mysequencewithnullables.h>
+
+#include <bdlb_nullablevalue.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_time.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility that decodes the flat format.  Since
+// the encoder is tested against hand-made encodings, we test the decoder by
+// decoding the output of `balfb::Encoder` for values of each category, and
+// comparing the results with the encoded values.  Since the decoder must
+// reject malformed input without reading outside of it, we also decode every
+// truncation of several encodings, each copied to a buffer of exactly its
+// length, and encodings having each byte replaced by several values.
+// Finally, we decode encodings of one sequence type into another having
+// different attributes, to check the rules given under "Schema Evolution".
+//
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] int decode(TYPE *, const char *, size_t);  // simple
+// [ 2] int decode(TYPE *, const char *, size_t);  // nullable, array, choice
+// [ 3] int decode(TYPE *, const char *, size_t);  // sequence
+// [ 4] int decodeSlot(TYPE *, const char *, size_t, size_t);
+// [ 5] int decode(TYPE *, const char *, size_t);  // malformed input
+// [ 6] int decode(TYPE *, const char *, size_t);  // schema evolution
+// ----------------------------------------------------------------------------
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balfb::DecoderUtil Util;
+
+namespace test {
+
+typedef s_baltst::Address  Address;
+typedef s_baltst::Employee Employee;
+
+}  // close namespace test
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the encoding of the specified `value`.
+template <class TYPE>
+bsl::string encode(const TYPE& value)
+{
+    bdlsb::MemOutStreamBuf streamBuf;
+    balfb::Encoder         encoder;
+    const int              rc = encoder.encode(&streamBuf, value);
+    ASSERTV(rc, 0 == rc);
+
+    return bsl::string(streamBuf.data(), streamBuf.length());
+}
+
+/// Encode the specified `value`, decode the encoding into an object of the
+/// (template parameter) `TYPE`, and return `true` if decoding succeeds and
+/// the result is equal to `value`, and `false` otherwise.
+template <class TYPE>
+bool roundTrip(const TYPE& value)
+{
+    const bsl::string encoding = encode(value);
+
+    TYPE result;
+    return 0 == Util::decode(&result, encoding.data(), encoding.length())
+        && value == result;
+}
+
+/// Encode the specified `value`, and decode every proper prefix of the
+/// encoding, each copied to a buffer of exactly its length, into an object of
+/// the (template parameter) `TYPE`, asserting that decoding fails.  Use the
+/// specified `line` to identify failures.
+template <class TYPE>
+void testTruncation(int line, const TYPE& value)
+{
+    const bsl::string encoding = encode(value);
+
+    for (bsl::size_t len = 0; len < encoding.length(); ++len) {
+        bsl::vector<char> buffer(encoding.begin(), encoding.begin() + len);
+
+        TYPE      result;
+        const int rc = Util::decode(&result, buffer.data(), len);
+        ASSERTV(line, len, rc, 0 != rc);
+    }
+}
+
+/// Encode the specified `value`, and decode the encodings obtained by
+/// replacing each byte of the encoding by each of several values into an
+/// object of the (template parameter) `TYPE`.  Return the number of
+/// modified encodings that decode successfully.  Note that the purpose of
+/// this function is to exercise the checks of the decoder (e.g., under a
+/// memory checker); a modified encoding may well be valid.
+template <class TYPE>
+int testCorruption(const TYPE& value)
+{
+    static const char BYTES[] = { 0x00, 0x01, 0x02, 0x7F,
+                                  -0x80, -0x02, -0x01 };
+
+    const bsl::string encoding = encode(value);
+
+    int numSuccesses = 0;
+    for (bsl::size_t i = 0; i < encoding.length(); ++i) {
+        for (bsl::size_t j = 0; j < sizeof BYTES; ++j) {
+            bsl::vector<char> buffer(encoding.begin(), encoding.end());
+            buffer[i] = BYTES[j];
+
+            TYPE result;
+            if (0 == Util::decode(&result, buffer.data(), buffer.size())) {
+                ++numSuccesses;
+            }
+        }
+    }
+    return numSuccesses;
+}
+
+/// Return a value of `s_baltst::Employee` whose attributes are derived from
+/// the specified `name`.
+test::Employee makeEmployee(const char *name)
+{
+    test::Employee employee;
+    employee.name()                 = name;
+    employee.homeAddress().street() = "Lexington Ave";
+    employee.homeAddress().city()   = "New York City";
+    employee.homeAddress().state()  = "New York";
+    employee.age()                  = static_cast<int>(bsl::strlen(name));
+    return employee;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout  << endl
+                           << "USAGE EXAMPLE" << endl
+                           << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding an Employee Record
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that the class `test::Employee` represents an employee record (see
+// {`balfb_encoder`|Example 1: Encoding an Employee Record}), and that we have
+// encoded a record in the flat format:
+// ```
+    test::Employee bob;
+    bob.name()                 = "Bob";
+    bob.homeAddress().street() = "Lexington Ave";
+    bob.homeAddress().city()   = "New York City";
+    bob.homeAddress().state()  = "New York";
+    bob.age()                  = 56;
+
+    bdlsb::MemOutStreamBuf streamBuf;
+    balfb::Encoder         encoder;
+    int                    rc = encoder.encode(&streamBuf, bob);
+    ASSERT(0 == rc);
+// ```
+// We can decode the complete record:
+// ```
+    test::Employee employee;
+    rc = balfb::DecoderUtil::decode(&employee,
+                                    streamBuf.data(),
+                                    streamBuf.length());
+    ASSERT(0   == rc);
+    ASSERT(bob == employee);
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SCHEMA EVOLUTION
+        //
+        // Concerns:
+        // 1. An attribute that is absent from the encoding, because it was
+        //    null or because its id is beyond the vtable, is null after
+        //    `decode`, if it is nullable, and has its default value
+        //    otherwise.
+        //
+        // 2. An attribute in the encoding whose id is not that of an
+        //    attribute of the type being decoded is ignored.
+        //
+        // 3. A non-null nullable attribute can be decoded into an attribute
+        //    of its underlying type, and vice versa.
+        //
+        // Plan:
+        // 1. Encode values of `MySequence`, `MySequenceWithNullable`, and
+        //    `MySequenceWithNullables`, whose attributes having the same id
+        //    have compatible types, and decode each encoding into the other
+        //    types.  (C-1..3)
+        //
+        // Testing:
+        //   int decode(TYPE *, const char *, size_t);  // schema evolution
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCHEMA EVOLUTION" << endl
+                          << "========================" << endl;
+
+        // `MySequence`:              { int, string }
+        // `MySequenceWithNullable`:  { int, nullable string }
+        // `MySequenceWithNullables`: { nullable int, nullable string,
+        //                              nullable `MySequence` }
+
+        s_baltst::MySequence a;
+        a.attribute1() = 1;
+        a.attribute2() = "a";
+
+        s_baltst::MySequenceWithNullable b;
+        b.attribute1() = 2;
+
+        s_baltst::MySequenceWithNullables c;
+        c.attribute2().makeValue("c");
+        c.attribute3().makeValue(a);
+
+        if (verbose) cout << "\nTesting non-null nullable values." << endl;
+        {
+            const bsl::string encoding = encode(a);
+
+            s_baltst::MySequenceWithNullable x;
+            ASSERT(0 == Util::decode(&x, encoding.data(), encoding.length()));
+            ASSERT(1   == x.attribute1());
+            ASSERT("a" == x.attribute2().value());
+
+            s_baltst::MySequenceWithNullables y;
+            ASSERT(0 == Util::decode(&y, encoding.data(), encoding.length()));
+            ASSERT(1   == y.attribute1().value());
+            ASSERT("a" == y.attribute2().value());
+            ASSERT(y.attribute3().isNull());
+        }
+
+        if (verbose) cout << "\nTesting absent attributes." << endl;
+        {
+            const bsl::string encoding = encode(b);
+
+            // `attribute2` is null in `b`, and is absent from its encoding.
+
+            s_baltst::MySequence x;
+            x.attribute2() = "garbage";
+            ASSERT(0 == Util::decode(&x, encoding.data(), encoding.length()));
+            ASSERT(2  == x.attribute1());
+            ASSERT("" == x.attribute2());
+
+            // `attribute3` is beyond the vtable of the encoding.
+
+            s_baltst::MySequenceWithNullables y;
+            y.attribute3().makeValue(a);
+            ASSERT(0 == Util::decode(&y, encoding.data(), encoding.length()));
+            ASSERT(2 == y.attribute1().value());
+            ASSERT(y.attribute2().isNull());
+            ASSERT(y.attribute3().isNull());
+        }
+
+        if (verbose) cout << "\nTesting unknown attributes." << endl;
+        {
+            const bsl::string encoding = encode(c);
+
+            // `attribute1` is absent from the encoding, and `attribute3` is
+            // unknown to `MySequenceWithNullable`.
+
+            s_baltst::MySequenceWithNullable x;
+            x.attribute1() = 99;
+            ASSERT(0 == Util::decode(&x, encoding.data(), encoding.length()));
+            ASSERT(0   == x.attribute1());
+            ASSERT("c" == x.attribute2().value());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING MALFORMED INPUT
+        //
+        // Concerns:
+        // 1. Decoding any truncation of an encoding fails, without reading
+        //    outside of the supplied buffer.
+        //
+        // 2. Decoding an encoding having any byte modified does not read
+        //    outside of the supplied buffer (though it may succeed).
+        //
+        // 3. Decoding fails if an enumeration, selection id, or `bool` has a
+        //    value that is not valid for the type being decoded.
+        //
+        // 4. Decoding fails if the slot of a non-nullable value held out of
+        //    line has an offset of 0.
+        //
+        // Plan:
+        // 1. Decode every truncation of encodings of values of several types,
+        //    each copied to a buffer of exactly its length.  (C-1)
+        //
+        // 2. Decode encodings of the same values having each byte replaced by
+        //    each of several values.  (C-2)
+        //
+        // 3. Decode encodings modified by hand.  (C-3..4)
+        //
+        // Testing:
+        //   int decode(TYPE *, const char *, size_t);  // malformed input
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MALFORMED INPUT" << endl
+                          << "=======================" << endl;
+
+        s_baltst::MyChoice choice;
+        choice.makeSelection2("choice");
+
+        s_baltst::MySequenceWithArray withArray;
+        withArray.attribute1() = 3;
+        withArray.attribute2().push_back("x");
+        withArray.attribute2().push_back("yz");
+
+        s_baltst::MySequenceWithNullables withNullables;
+        withNullables.attribute1().makeValue(-1);
+        withNullables.attribute3().makeValue();
+
+        bsl::vector<bdlb::NullableValue<int> > nullables(2);
+        nullables[1].makeValue(5);
+
+        if (verbose) cout << "\nTesting truncation." << endl;
+        {
+            testTruncation(L_, 42);
+            testTruncation(L_, bsl::string("truncated"));
+            testTruncation(L_, bsl::vector<int>(3, 7));
+            testTruncation(L_, bsl::vector<char>(3, 'x'));
+            testTruncation(L_, nullables);
+            testTruncation(L_, choice);
+            testTruncation(L_, s_baltst::MyChoice());
+            testTruncation(L_, withArray);
+            testTruncation(L_, withNullables);
+            testTruncation(L_, s_baltst::MySequenceWithNullables());
+            testTruncation(L_, makeEmployee("Bob"));
+        }
+
+        if (verbose) cout << "\nTesting corruption." << endl;
+        {
+            int n = 0;
+            n += testCorruption(bsl::string("corrupt"));
+            n += testCorruption(bsl::vector<bsl::string>(2, "ab"));
+            n += testCorruption(nullables);
+            n += testCorruption(choice);
+            n += testCorruption(withArray);
+            n += testCorruption(withNullables);
+            n += testCorruption(makeEmployee("Bob"));
+            if (veryVerbose) { P(n); }
+        }
+
+        if (verbose) cout << "\nTesting invalid values." << endl;
+        {
+            s_baltst::MyEnumeration::Value enumeration;
+
+            bsl::string encoding = encode(1);
+            ASSERT(0 == Util::decode(&enumeration,
+                                     encoding.data(),
+                                     encoding.length()));
+            ASSERT(s_baltst::MyEnumeration::VALUE2 == enumeration);
+
+            encoding = encode(2);
+            ASSERT(0 != Util::decode(&enumeration,
+                                     encoding.data(),
+                                     encoding.length()));
+
+            bool boolean;
+            encoding = encode(static_cast<char>(2));
+            ASSERT(0 != Util::decode(&boolean,
+                                     encoding.data(),
+                                     encoding.length()));
+
+            // Replace the selection id of `choice`.
+
+            encoding = encode(choice);
+            balfb::FormatUtil::putValue(&encoding[4], 7);
+
+            s_baltst::MyChoice result;
+            ASSERT(0 != Util::decode(&result,
+                                     encoding.data(),
+                                     encoding.length()));
+
+            // Replace the offset of a sequence, an array, and a choice by 0.
+
+            encoding = encode(withArray);
+            balfb::FormatUtil::putUint32(&encoding[0], 0);
+            s_baltst::MySequenceWithArray array;
+            ASSERT(0 != Util::decode(&array,
+                                     encoding.data(),
+                                     encoding.length()));
+
+            encoding = encode(bsl::vector<int>(1, 1));
+            balfb::FormatUtil::putUint32(&encoding[0], 0);
+            bsl::vector<int> vector;
+            ASSERT(0 != Util::decode(&vector,
+                                     encoding.data(),
+                                     encoding.length()));
+
+            encoding = encode(choice);
+            balfb::FormatUtil::putUint32(&encoding[0], 0);
+            ASSERT(0 != Util::decode(&result,
+                                     encoding.data(),
+                                     encoding.length()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `decodeSlot`
+        //
+        // Concerns:
+        // 1. `decodeSlot` decodes the value whose slot is at the specified
+        //    position, so that a part of an encoding can be decoded on its
+        //    own.
+        //
+        // 2. `decodeSlot` does not modify the non-nullable attributes of a
+        //    sequence that are absent from the encoding, whereas `decode`
+        //    resets them.
+        //
+        // 3. `decodeSlot` fails if the slot is outside of the buffer.
+        //
+        // Plan:
+        // 1. Find the slots of attributes of an encoded `Employee` using
+        //    `balfb::FormatUtil`, and decode them.  (C-1, 3)
+        //
+        // 2. Decode an encoding having an absent attribute into an object
+        //    whose corresponding attribute does not have its default value,
+        //    using both functions.  (C-2)
+        //
+        // Testing:
+        //   int decodeSlot(TYPE *, const char *, size_t, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `decodeSlot`" << endl
+                          << "====================" << endl;
+
+        const test::Employee EMPLOYEE = makeEmployee("Alice");
+        const bsl::string    ENCODING = encode(EMPLOYEE);
+        const char          *DATA     = ENCODING.data();
+        const bsl::size_t    LENGTH   = ENCODING.length();
+
+        bsl::size_t table;
+        ASSERT(0 == balfb::FormatUtil::followOffset(&table, DATA, LENGTH, 0));
+
+        bsl::size_t slot;
+        const int HOME_ADDRESS = test::Employee::ATTRIBUTE_ID_HOME_ADDRESS;
+        const int AGE          = test::Employee::ATTRIBUTE_ID_AGE;
+
+        ASSERT(0 == balfb::FormatUtil::lookupAttribute(&slot,
+                                                       DATA,
+                                                       LENGTH,
+                                                       table,
+                                                       HOME_ADDRESS));
+
+        test::Address address;
+        ASSERT(0 == Util::decodeSlot(&address, DATA, LENGTH, slot));
+        ASSERT(EMPLOYEE.homeAddress() == address);
+
+        ASSERT(0 == balfb::FormatUtil::lookupAttribute(&slot,
+                                                       DATA,
+                                                       LENGTH,
+                                                       table,
+                                                       AGE));
+
+        int age;
+        ASSERT(0 == Util::decodeSlot(&age, DATA, LENGTH, slot));
+        ASSERT(5 == age);
+
+        ASSERT(0 != Util::decodeSlot(&age, DATA, LENGTH, LENGTH - 3));
+        ASSERT(0 != Util::decodeSlot(&age, DATA, LENGTH, LENGTH + 1));
+
+        test::Employee employee;
+        ASSERT(0 == Util::decodeSlot(&employee, DATA, LENGTH, 0));
+        ASSERT(EMPLOYEE == employee);
+
+        // Absent attributes.
+
+        s_baltst::MySequenceWithNullable value;
+        value.attribute1() = 1;
+        const bsl::string encoding = encode(value);
+
+        s_baltst::MySequence result;
+        result.attribute2() = "kept";
+        ASSERT(0 == Util::decodeSlot(&result,
+                                     encoding.data(),
+                                     encoding.length(),
+                                     0));
+        ASSERT(1      == result.attribute1());
+        ASSERT("kept" == result.attribute2());
+
+        ASSERT(0 == Util::decode(&result,
+                                 encoding.data(),
+                                 encoding.length()));
+        ASSERT(1  == result.attribute1());
+        ASSERT("" == result.attribute2());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SEQUENCES
+        //
+        // Concerns:
+        // 1. Sequences having attributes of each category are decoded.
+        //
+        // 2. Null and non-null nullable attributes are decoded.
+        //
+        // 3. Sequences nested in sequences, arrays, and choices are decoded.
+        //
+        // 4. The result does not depend on its value before decoding.
+        //
+        // Plan:
+        // 1. Round trip values of several sequence types.  (C-1..3)
+        //
+        // 2. Decode into an object having a different, non-default, value.
+        //    (C-4)
+        //
+        // Testing:
+        //   int decode(TYPE *, const char *, size_t);  // sequence
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SEQUENCES" << endl
+                          << "=================" << endl;
+
+        ASSERT(roundTrip(test::Employee()));
+        ASSERT(roundTrip(makeEmployee("Bob")));
+
+        bsl::vector<test::Employee> employees;
+        employees.push_back(makeEmployee("Bob"));
+        employees.push_back(makeEmployee("Carol"));
+        ASSERT(roundTrip(employees));
+
+        s_baltst::BasicRecord record;
+        record.i1() = -1;
+        record.i2() = 1 << 30;
+        record.dt() = bdlt::DatetimeTz(
+                               bdlt::Datetime(2024, 2, 29, 12, 0, 0, 1, 2),
+                               -300);
+        record.s()  = "record";
+        ASSERT(roundTrip(record));
+
+        s_baltst::MySequenceWithArray withArray;
+        ASSERT(roundTrip(withArray));
+        withArray.attribute1() = 3;
+        withArray.attribute2().push_back("");
+        withArray.attribute2().push_back("yz");
+        ASSERT(roundTrip(withArray));
+
+        s_baltst::MySequenceWithChoice withChoice;
+        ASSERT(roundTrip(withChoice));
+        withChoice.mode().makeChoiceA(17);
+        ASSERT(roundTrip(withChoice));
+
+        s_baltst::MySequenceWithNullables withNullables;
+        ASSERT(roundTrip(withNullables));
+        withNullables.attribute1().makeValue(0);
+        ASSERT(roundTrip(withNullables));
+        withNullables.attribute3().makeValue();
+        withNullables.attribute3().value().attribute2() = "nested";
+        ASSERT(roundTrip(withNullables));
+        withNullables.attribute1().reset();
+        withNullables.attribute2().makeValue("");
+        ASSERT(roundTrip(withNullables));
+
+        const bsl::string ENCODING = encode(withNullables);
+
+        s_baltst::MySequenceWithNullables result;
+        result.attribute1().makeValue(5);
+        result.attribute3().makeValue();
+        ASSERT(0 == Util::decode(&result, ENCODING.data(), ENCODING.length()));
+        ASSERT(withNullables == result);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING NULLABLE VALUES, ARRAYS, AND CHOICES
+        //
+        // Concerns:
+        // 1. Null and non-null nullable values are decoded.
+        //
+        // 2. Empty and non-empty arrays of values held inline, and of values
+        //    held out of line, are decoded, replacing the elements of the
+        //    result.
+        //
+        // 3. Choices having each selection, and no selection, are decoded.
+        //
+        // Plan:
+        // 1. Round trip values of each kind.  (C-1..3)
+        //
+        // Testing:
+        //   int decode(TYPE *, const char *, size_t);  // nullable, array, ...
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING NULLABLE VALUES, ARRAYS, AND CHOICES"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        if (verbose) cout << "\nTesting nullable values." << endl;
+        {
+            bdlb::NullableValue<int> value;
+            ASSERT(roundTrip(value));
+            value.makeValue(-7);
+            ASSERT(roundTrip(value));
+
+            bdlb::NullableValue<bsl::string> str;
+            ASSERT(roundTrip(str));
+            str.makeValue("");
+            ASSERT(roundTrip(str));
+
+            bsl::vector<bdlb::NullableValue<double> > nullables(3);
+            nullables[1].makeValue(2.5);
+            ASSERT(roundTrip(nullables));
+        }
+
+        if (verbose) cout << "\nTesting arrays." << endl;
+        {
+            ASSERT(roundTrip(bsl::vector<int>()));
+            ASSERT(roundTrip(bsl::vector<int>(100, -3)));
+            ASSERT(roundTrip(bsl::vector<char>()));
+            ASSERT(roundTrip(bsl::vector<char>(5, '\0')));
+            ASSERT(roundTrip(bsl::vector<bsl::string>(3, "abc")));
+
+            const bsl::vector<int> INNER(2, 9);
+            ASSERT(roundTrip(bsl::vector<bsl::vector<int> >(2, INNER)));
+
+            ASSERT(roundTrip(bsl::vector<s_baltst::MyEnumeration::Value>(
+                                          2,
+                                          s_baltst::MyEnumeration::VALUE2)));
+
+            const bsl::string ENCODING = encode(bsl::vector<int>(2, 1));
+
+            bsl::vector<int> result(5, 5);
+            ASSERT(0 == Util::decode(&result,
+                                     ENCODING.data(),
+                                     ENCODING.length()));
+            ASSERT(bsl::vector<int>(2, 1) == result);
+        }
+
+        if (verbose) cout << "\nTesting choices." << endl;
+        {
+            s_baltst::MyChoice value;
+            ASSERT(roundTrip(value));
+            value.makeSelection1(-1);
+            ASSERT(roundTrip(value));
+            value.makeSelection2("selection");
+            ASSERT(roundTrip(value));
+
+            const bsl::string ENCODING = encode(s_baltst::MyChoice());
+
+            s_baltst::MyChoice result;
+            result.makeSelection1(1);
+            ASSERT(0 == Util::decode(&result,
+                                     ENCODING.data(),
+                                     ENCODING.length()));
+            ASSERT(result.isUndefinedValue());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING SIMPLE VALUES
+        //
+        // Concerns:
+        // 1. Values of each simple type, enumerations, and customized types
+        //    are decoded.
+        //
+        // 2. Strings, including empty strings and strings containing null
+        //    characters, are decoded.
+        //
+        // Plan:
+        // 1. Round trip values of each kind.  (C-1..2)
+        //
+        // Testing:
+        //   int decode(TYPE *, const char *, size_t);  // simple
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SIMPLE VALUES" << endl
+                          << "=====================" << endl;
+
+        ASSERT(roundTrip(true));
+        ASSERT(roundTrip('c'));
+        ASSERT(roundTrip(static_cast<short>(-2)));
+        ASSERT(roundTrip(123456789));
+        ASSERT(roundTrip(static_cast<bsls::Types::Int64>(-1) << 40));
+        ASSERT(roundTrip(0.1f));
+        ASSERT(roundTrip(0.1));
+        ASSERT(roundTrip(BDLDFP_DECIMAL_DD(0.1)));
+        ASSERT(roundTrip(bdlt::Date(2000, 1, 1)));
+        ASSERT(roundTrip(bdlt::Time(1, 2, 3, 4, 5)));
+        ASSERT(roundTrip(bdlt::DatetimeTz()));
+
+        ASSERT(roundTrip(bsl::string()));
+        ASSERT(roundTrip(bsl::string("string")));
+        ASSERT(roundTrip(bsl::string("a\0b", 3)));
+        ASSERT(roundTrip(bsl::string(1000, 'x')));
+
+        ASSERT(roundTrip(s_baltst::MyEnumeration::VALUE1));
+        ASSERT(roundTrip(s_baltst::MyEnumeration::VALUE2));
+
+        ASSERT(roundTrip(s_baltst::CustomInt(-5)));
+        ASSERT(roundTrip(s_baltst::CustomizedString("custom")));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,73 @@
+// balfb_encoder.cpp                                                  -*-C++-*-
+#include <balfb_encoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balfb_encoder_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+int Encoder::putOffset(bsl::size_t slot, bsl::size_t position)
+{
+    BSLS_ASSERT(slot < position);
+    BSLS_ASSERT(slot + FormatUtil::k_OFFSET_SIZE <= d_buffer.size());
+
+    const bsl::size_t offset = position - slot;
+    if (0xFFFFFFFFu < offset) {
+        return -1;                                                    // RETURN
+    }
+
+    FormatUtil::putUint32(&d_buffer[slot], static_cast<unsigned int>(offset));
+    return 0;
+}
+
+int Encoder::encodeBytes(bsl::size_t  slot,
+                         const char  *data,
+                         bsl::size_t  length)
+{
+    if (0xFFFFFFFFu < length) {
+        return -1;                                                    // RETURN
+    }
+
+    // The body is the length, the data, and a terminating null byte (already
+    // zero after 'append').
+
+    const bsl::size_t position = append(FormatUtil::k_LENGTH_SIZE
+                                      + length
+                                      + 1);
+    FormatUtil::putUint32(&d_buffer[position],
+                          static_cast<unsigned int>(length));
+    if (0 < length) {
+        bsl::memcpy(&d_buffer[position + FormatUtil::k_LENGTH_SIZE],
+                    data,
+                    length);
+    }
+
+    return putOffset(slot, position);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1054 @@
+// balfb_encoder.h                                                    -*-C++-*-
+#ifndef INCLUDED_BALFB_ENCODER
+#define INCLUDED_BALFB_ENCODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an encoder for the random-access flat binary format.
+//
+//@CLASSES:
+//  balfb::Encoder: encoder of `bdlat`-compatible types in the flat format
+//
+//@SEE_ALSO: balfb_formatutil, balfb_view, balfb_decoderutil
+//
+//@DESCRIPTION: This component provides a class, `balfb::Encoder`, that
+// encodes objects of types supported by the `bdlat` framework in the "flat"
+// binary format described in `balfb_formatutil`.  Unlike the BER and `bslx`
+// encodings, which must be decoded sequentially, the flat format places each
+// scalar attribute of a sequence at a fixed position in its table, and
+// records the position of every other attribute in a per-table vtable, so
+// that `balfb::TableView` (see `balfb_view`) can read a single attribute of
+// an encoded object without decoding the rest of it.
+//
+// An encoder builds each encoding in an internal buffer (whose capacity is
+// reused by subsequent calls to `encode`), because the offsets in the
+// encoding of a value are known only after the values it refers to are
+// encoded, and then writes the encoding to the supplied stream buffer.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding an Employee Record
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that an "employee record" consists of a sequence of attributes:
+// `name`, `homeAddress` (itself a sequence of `street`, `city`, and `state`),
+// and `age`, and that the classes `test::Employee` and `test::Address`
+// represent these records and conform to the `bdlat` sequence protocol (e.g.,
+// they were generated from an XML schema).
+//
+// First, we create an employee record:
+// ```
+// test::Address address;
+// address.street() = "Lexington Ave";
+// address.city()   = "New York City";
+// address.state()  = "New York";
+//
+// test::Employee bob;
+// bob.name()        = "Bob";
+// bob.homeAddress() = address;
+// bob.age()         = 56;
+// ```
+// Then, we encode the record to a stream buffer:
+// ```
+// bdlsb::MemOutStreamBuf streamBuf;
+//
+// balfb::Encoder encoder;
+// int            rc = encoder.encode(&streamBuf, bob);
+// assert(0 == rc);
+// ```
+// Now, we look up the `age` of the employee directly in the encoding.  We
+// use the primitive functions of `balfb::FormatUtil` to illustrate the
+// format; clients would normally use a `balfb::TableView` (see `balfb_view`)
+// instead.  The slot at the start of the encoding holds the offset of the
+// table of `bob`, whose vtable gives the slot of `age`:
+// ```
+// const char        *data   = streamBuf.data();
+// const bsl::size_t  length = streamBuf.length();
+//
+// bsl::size_t employee;
+// rc = balfb::FormatUtil::followOffset(&employee, data, length, 0);
+// assert(0 == rc);
+//
+// bsl::size_t slot;
+// rc = balfb::FormatUtil::lookupAttribute(&slot,
+//                                         data,
+//                                         length,
+//                                         employee,
+//                                         test::Employee::ATTRIBUTE_ID_AGE);
+// assert(0 == rc);
+//
+// int age;
+// rc = balfb::FormatUtil::getValueAt(&age, data, length, slot);
+// assert(0  == rc);
+// assert(56 == age);
+// ```
+// Finally, we read the `city` of the home address, again without decoding the
+// rest of the record:
+// ```
+// const int HOME_ADDRESS = test::Employee::ATTRIBUTE_ID_HOME_ADDRESS;
+//
+// rc = balfb::FormatUtil::lookupAttribute(&slot,
+//                                         data,
+//                                         length,
+//                                         employee,
+//                                         HOME_ADDRESS);
+// assert(0 == rc);
+//
+// bsl::size_t homeAddress;
+// rc = balfb::FormatUtil::followOffset(&homeAddress, data, length, slot);
+// assert(0 == rc);
+//
+// rc = balfb::FormatUtil::lookupAttribute(&slot,
+//                                         data,
+//                                         length,
+//                                         homeAddress,
+//                                         test::Address::ATTRIBUTE_ID_CITY);
+// assert(0 == rc);
+//
+// bsl::size_t city;
+// rc = balfb::FormatUtil::followOffset(&city, data, length, slot);
+// assert(0 == rc);
+//
+// const char  *cityData;
+// bsl::size_t  cityLength;
+// rc = balfb::FormatUtil::getString(&cityData,
+//                                   &cityLength,
+//                                   data,
+//                                   length,
+//                                   city);
+// assert(0                                == rc);
+// assert(bsl::string("New York City") == bsl::string(cityData, cityLength));
+// ```
+
+#include <balscm_version.h>
+
+#include <balfb_formatutil.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+class Encoder_SlotVisitor;
+class Encoder_BodyVisitor;
+class Encoder_AttributeSlotVisitor;
+class Encoder_AttributeBodyVisitor;
+class Encoder_EntryVisitor;
+
+                               // =============
+                               // class Encoder
+                               // =============
+
+/// This class provides a mechanism for encoding objects of types supported
+/// by the `bdlat` framework in the flat format.
+class Encoder {
+
+    // DATA
+    bsl::vector<char> d_buffer;  // encoding being built
+
+    // FRIENDS
+    friend class Encoder_SlotVisitor;
+    friend class Encoder_BodyVisitor;
+    friend class Encoder_AttributeSlotVisitor;
+    friend class Encoder_AttributeBodyVisitor;
+    friend class Encoder_EntryVisitor;
+
+    // NOT IMPLEMENTED
+    Encoder(const Encoder&);
+    Encoder& operator=(const Encoder&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append the specified `numBytes` zero bytes to the encoding, and
+    /// return the position of the first of them.
+    bsl::size_t append(bsl::size_t numBytes);
+
+    /// Write to the slot at the specified `slot` position the offset from
+    /// `slot` to the specified `position`.  Return 0 on success, and a
+    /// non-zero value if the offset is too large.  The behavior is undefined
+    /// unless `slot < position`.
+    int putOffset(bsl::size_t slot, bsl::size_t position);
+
+    /// Append to the encoding the slot of the specified `value`.  For a
+    /// value held out of line, the slot is left zero, to be filled in by the
+    /// corresponding call to `encodeBody`.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class TYPE>
+    int encodeSlot(const TYPE& value);
+    int encodeSlot(const bsl::string& value, bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int encodeSlot(const TYPE& value, bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int encodeSlot(const TYPE& value, bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int encodeSlot(const TYPE& value, bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int encodeSlot(const TYPE& value, bdlat_TypeCategory::DynamicType);
+    template <class TYPE, class CATEGORY>
+    int encodeSlot(const TYPE& value, CATEGORY);
+
+    /// Append to the encoding the body of the specified `value`, if it is
+    /// held out of line, and write the offset of the body to the slot at the
+    /// specified `slot` position.  Return 0 on success, and a non-zero value
+    /// otherwise.  The behavior is undefined unless `slot` is the position
+    /// of the slot appended for `value` by `encodeSlot`.
+    template <class TYPE>
+    int encodeBody(bsl::size_t slot, const TYPE& value);
+    int encodeBody(bsl::size_t                slot,
+                   const bsl::string&         value,
+                   bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                slot,
+                   const TYPE&                value,
+                   bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                     slot,
+                   const TYPE&                     value,
+                   bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                        slot,
+                   const TYPE&                        value,
+                   bdlat_TypeCategory::CustomizedType);
+    int encodeBody(bsl::size_t               slot,
+                   const bsl::vector<char>&  value,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeBody(bsl::size_t               slot,
+                   const TYPE&               value,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                  slot,
+                   const TYPE&                  value,
+                   bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                slot,
+                   const TYPE&                value,
+                   bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                       slot,
+                   const TYPE&                       value,
+                   bdlat_TypeCategory::NullableValue);
+    template <class TYPE>
+    int encodeBody(bsl::size_t                     slot,
+                   const TYPE&                     value,
+                   bdlat_TypeCategory::DynamicType);
+
+    /// Append the body of a string or binary value having the specified
+    /// `data` and `length`, and write its offset to the slot at the
+    /// specified `slot` position.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int encodeBytes(bsl::size_t slot, const char *data, bsl::size_t length);
+
+    /// Append to the table at the specified `table` position the slot of the
+    /// specified `value` of the attribute having the specified `id`, unless
+    /// `value` is a null nullable value, and record the position of the slot
+    /// in the vtable.  Return 0 on success, and a non-zero value otherwise.
+    template <class TYPE>
+    int encodeAttributeSlot(bsl::size_t                       table,
+                            int                               id,
+                            const TYPE&                       value,
+                            bdlat_TypeCategory::NullableValue);
+    template <class TYPE, class CATEGORY>
+    int encodeAttributeSlot(bsl::size_t  table,
+                            int          id,
+                            const TYPE&  value,
+                            CATEGORY);
+
+    /// Append to the table at the specified `table` position the slot of the
+    /// specified `value` of the attribute having the specified `id`, and
+    /// record the position of the slot in the vtable.  Return 0 on success,
+    /// and a non-zero value if the table would exceed
+    /// `FormatUtil::k_MAX_TABLE_SIZE` bytes.
+    template <class TYPE>
+    int encodeEntry(bsl::size_t table, int id, const TYPE& value);
+
+    /// Append the body of the specified `value` of the attribute having the
+    /// specified `id` of the table at the specified `table` position, if the
+    /// table has a slot for the attribute.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class TYPE>
+    int encodeAttributeBody(bsl::size_t                       table,
+                            int                               id,
+                            const TYPE&                       value,
+                            bdlat_TypeCategory::NullableValue);
+    template <class TYPE, class CATEGORY>
+    int encodeAttributeBody(bsl::size_t  table,
+                            int          id,
+                            const TYPE&  value,
+                            CATEGORY);
+
+    /// Return the position of the slot of the attribute having the
+    /// specified `id` in the table at the specified `table` position, or 0
+    /// if the table has no slot for the attribute.
+    bsl::size_t entry(bsl::size_t table, int id) const;
+
+  public:
+    // CREATORS
+
+    /// Create an encoder.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit Encoder(bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Encode the specified `value` of the (template parameter) `TYPE` to the
+    /// specified `streamBuf`.  Return 0 on success, and a non-zero value
+    /// otherwise.  `TYPE` must be a type supported by the `bdlat` framework
+    /// whose values, directly or indirectly, are not of "dynamic" type, and
+    /// whose sequences have attribute ids in the range
+    /// `[0 .. FormatUtil::k_MAX_ATTRIBUTE_ID]`.  If `value` cannot be
+    /// encoded, nothing is written to `streamBuf`.  Note that if `streamBuf`
+    /// does not accept the whole encoding, a non-zero value is returned, and
+    /// part of the encoding may have been written.
+    template <class TYPE>
+    int encode(bsl::streambuf *streamBuf, const TYPE& value);
+};
+
+                         // =========================
+                         // class Encoder_SlotVisitor
+                         // =========================
+
+/// This component-private class provides a visitor that appends the slot of
+/// each value it visits.
+class Encoder_SlotVisitor {
+
+    // DATA
+    Encoder *d_encoder_p;  // encoder (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends slots using the specified `encoder`.
+    explicit Encoder_SlotVisitor(Encoder *encoder);
+
+    // MANIPULATORS
+
+    /// Append the slot of the specified `value`.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class TYPE>
+    int operator()(const TYPE& value);
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO&);
+};
+
+                         // =========================
+                         // class Encoder_BodyVisitor
+                         // =========================
+
+/// This component-private class provides a visitor that appends the bodies
+/// of a series of values whose slots are consecutive.
+class Encoder_BodyVisitor {
+
+    // DATA
+    Encoder     *d_encoder_p;  // encoder (held, not owned)
+    bsl::size_t  d_slot;       // position of the slot of the next value
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends bodies using the specified `encoder`,
+    /// the first of which is of the value whose slot is at the specified
+    /// `slot` position.
+    Encoder_BodyVisitor(Encoder *encoder, bsl::size_t slot);
+
+    // MANIPULATORS
+
+    /// Append the body of the specified `value`, and advance to the slot
+    /// following that of `value`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE>
+    int operator()(const TYPE& value);
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO&);
+};
+
+                     // ==================================
+                     // class Encoder_AttributeSlotVisitor
+                     // ==================================
+
+/// This component-private class provides a visitor that appends the slot of
+/// each attribute of a sequence to the table of the sequence.
+class Encoder_AttributeSlotVisitor {
+
+    // DATA
+    Encoder     *d_encoder_p;  // encoder (held, not owned)
+    bsl::size_t  d_table;      // position of the table
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends slots to the table at the specified
+    /// `table` position using the specified `encoder`.
+    Encoder_AttributeSlotVisitor(Encoder *encoder, bsl::size_t table);
+
+    // MANIPULATORS
+
+    /// Append the slot of the specified `value` of the attribute described
+    /// by the specified `info`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO& info);
+};
+
+                     // ==================================
+                     // class Encoder_AttributeBodyVisitor
+                     // ==================================
+
+/// This component-private class provides a visitor that appends the body of
+/// each attribute of a sequence.
+class Encoder_AttributeBodyVisitor {
+
+    // DATA
+    Encoder     *d_encoder_p;  // encoder (held, not owned)
+    bsl::size_t  d_table;      // position of the table
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends the bodies of the attributes of the
+    /// table at the specified `table` position using the specified
+    /// `encoder`.
+    Encoder_AttributeBodyVisitor(Encoder *encoder, bsl::size_t table);
+
+    // MANIPULATORS
+
+    /// Append the body of the specified `value` of the attribute described
+    /// by the specified `info`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO& info);
+};
+
+                         // ==========================
+                         // class Encoder_EntryVisitor
+                         // ==========================
+
+/// This component-private class provides a visitor that appends the slot of
+/// the value of a non-null nullable attribute to the table of a sequence.
+class Encoder_EntryVisitor {
+
+    // DATA
+    Encoder     *d_encoder_p;  // encoder (held, not owned)
+    bsl::size_t  d_table;      // position of the table
+    int          d_id;         // id of the attribute
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends the slot of the attribute having the
+    /// specified `id` to the table at the specified `table` position using
+    /// the specified `encoder`.
+    Encoder_EntryVisitor(Encoder *encoder, bsl::size_t table, int id);
+
+    // MANIPULATORS
+
+    /// Append the slot of the specified `value`.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class TYPE>
+    int operator()(const TYPE& value);
+};
+
+                        // ===========================
+                        // struct Encoder_MaxIdVisitor
+                        // ===========================
+
+/// This component-private `struct` provides a visitor that finds the
+/// smallest and largest ids of the attributes of a sequence.
+struct Encoder_MaxIdVisitor {
+
+    // DATA
+    int d_minId;          // smallest id visited
+    int d_maxId;          // largest id visited
+    int d_numAttributes;  // number of attributes visited
+
+    // CREATORS
+
+    /// Create a visitor that has visited no attributes.
+    Encoder_MaxIdVisitor();
+
+    // MANIPULATORS
+
+    /// Record the id of the attribute described by the specified `info`.
+    /// Return 0.
+    template <class TYPE, class INFO>
+    int operator()(const TYPE&, const INFO& info);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+inline
+bsl::size_t Encoder::append(bsl::size_t numBytes)
+{
+    const bsl::size_t position = d_buffer.size();
+    d_buffer.resize(position + numBytes);
+    return position;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return encodeSlot(value, Category());
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const TYPE& value, bdlat_TypeCategory::Simple)
+{
+    const bsl::size_t position = append(FormatUtil::InlineSize<TYPE>::value);
+    FormatUtil::putValue(&d_buffer[position], value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSlot(const bsl::string&, bdlat_TypeCategory::Simple)
+{
+    append(FormatUtil::k_OFFSET_SIZE);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const TYPE& value, bdlat_TypeCategory::Enumeration)
+{
+    int intValue;
+    bdlat_EnumFunctions::toInt(&intValue, value);
+
+    const bsl::size_t position = append(FormatUtil::InlineSize<TYPE>::value);
+    FormatUtil::putValue(&d_buffer[position], intValue);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const TYPE& value, bdlat_TypeCategory::CustomizedType)
+{
+    return encodeSlot(bdlat_CustomizedTypeFunctions::convertToBaseType(value));
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const TYPE&, bdlat_TypeCategory::DynamicType)
+{
+    return -1;
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Encoder::encodeSlot(const TYPE&, CATEGORY)
+{
+    append(FormatUtil::k_OFFSET_SIZE);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeBody(bsl::size_t slot, const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return encodeBody(slot, value, Category());
+}
+
+inline
+int Encoder::encodeBody(bsl::size_t                slot,
+                        const bsl::string&         value,
+                        bdlat_TypeCategory::Simple)
+{
+    return encodeBytes(slot, value.data(), value.length());
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeBody(bsl::size_t, const TYPE&, bdlat_TypeCategory::Simple)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeBody(bsl::size_t,
+                        const TYPE&,
+                        bdlat_TypeCategory::Enumeration)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeBody(bsl::size_t                        slot,
+                        const TYPE&                        value,
+                        bdlat_TypeCategory::CustomizedType)
+{
+    return encodeBody(slot,
+                      bdlat_CustomizedTypeFunctions::convertToBaseType(value));
+}
+
+inline
+int Encoder::encodeBody(bsl::size_t               slot,
+                        const bsl::vector<char>&  value,
+                        bdlat_TypeCategory::Array)
+{
+    return encodeBytes(slot, value.data(), value.size());
+}
+
+template <class TYPE>
+int Encoder::encodeBody(bsl::size_t               slot,
+                        const TYPE&               value,
+                        bdlat_TypeCategory::Array)
+{
+    const bsl::size_t numElements = bdlat_ArrayFunctions::size(value);
+    if (0xFFFFFFFFu < numElements) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t position = append(FormatUtil::k_LENGTH_SIZE);
+    FormatUtil::putUint32(&d_buffer[position],
+                          static_cast<unsigned int>(numElements));
+
+    Encoder_SlotVisitor slotVisitor(this);
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        const int rc = bdlat_ArrayFunctions::accessElement(
+                                                         value,
+                                                         slotVisitor,
+                                                         static_cast<int>(i));
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    Encoder_BodyVisitor bodyVisitor(this,
+                                    position + FormatUtil::k_LENGTH_SIZE);
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        const int rc = bdlat_ArrayFunctions::accessElement(
+                                                         value,
+                                                         bodyVisitor,
+                                                         static_cast<int>(i));
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    return putOffset(slot, position);
+}
+
+template <class TYPE>
+int Encoder::encodeBody(bsl::size_t                  slot,
+                        const TYPE&                  value,
+                        bdlat_TypeCategory::Sequence)
+{
+    Encoder_MaxIdVisitor maxIdVisitor;
+    bdlat_SequenceFunctions::accessAttributes(value, maxIdVisitor);
+
+    if (0 < maxIdVisitor.d_numAttributes
+     && (maxIdVisitor.d_minId < 0
+      || FormatUtil::k_MAX_ATTRIBUTE_ID < maxIdVisitor.d_maxId)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int numEntries = 0 < maxIdVisitor.d_numAttributes
+                         ? maxIdVisitor.d_maxId + 1
+                         : 0;
+
+    const bsl::size_t table = append(FormatUtil::k_VTABLE_ENTRY_SIZE
+                                   + FormatUtil::k_VTABLE_ENTRY_SIZE
+                                                                * numEntries);
+    if (FormatUtil::k_MAX_TABLE_SIZE < d_buffer.size() - table) {
+        return -1;                                                    // RETURN
+    }
+    FormatUtil::putUint16(&d_buffer[table],
+                          static_cast<unsigned short>(numEntries));
+
+    Encoder_AttributeSlotVisitor slotVisitor(this, table);
+    int rc = bdlat_SequenceFunctions::accessAttributes(value, slotVisitor);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    Encoder_AttributeBodyVisitor bodyVisitor(this, table);
+    rc = bdlat_SequenceFunctions::accessAttributes(value, bodyVisitor);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    return putOffset(slot, table);
+}
+
+template <class TYPE>
+int Encoder::encodeBody(bsl::size_t                slot,
+                        const TYPE&                value,
+                        bdlat_TypeCategory::Choice)
+{
+    const int selectionId = bdlat_ChoiceFunctions::selectionId(value);
+
+    const bsl::size_t position = append(FormatUtil::k_SELECTION_ID_SIZE);
+    FormatUtil::putValue(&d_buffer[position], selectionId);
+
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID != selectionId) {
+        Encoder_SlotVisitor slotVisitor(this);
+        int rc = bdlat_ChoiceFunctions::accessSelection(value, slotVisitor);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+
+        Encoder_BodyVisitor bodyVisitor(
+                                 this,
+                                 position + FormatUtil::k_SELECTION_ID_SIZE);
+        rc = bdlat_ChoiceFunctions::accessSelection(value, bodyVisitor);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    return putOffset(slot, position);
+}
+
+template <class TYPE>
+int Encoder::encodeBody(bsl::size_t                       slot,
+                        const TYPE&                       value,
+                        bdlat_TypeCategory::NullableValue)
+{
+    if (bdlat_NullableValueFunctions::isNull(value)) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t position = d_buffer.size();
+
+    Encoder_SlotVisitor slotVisitor(this);
+    int rc = bdlat_NullableValueFunctions::accessValue(value, slotVisitor);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    Encoder_BodyVisitor bodyVisitor(this, position);
+    rc = bdlat_NullableValueFunctions::accessValue(value, bodyVisitor);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    return putOffset(slot, position);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeBody(bsl::size_t,
+                        const TYPE&,
+                        bdlat_TypeCategory::DynamicType)
+{
+    return -1;
+}
+
+template <class TYPE>
+int Encoder::encodeAttributeSlot(bsl::size_t                       table,
+                                 int                               id,
+                                 const TYPE&                       value,
+                                 bdlat_TypeCategory::NullableValue)
+{
+    if (bdlat_NullableValueFunctions::isNull(value)) {
+        return 0;                                                     // RETURN
+    }
+
+    Encoder_EntryVisitor entryVisitor(this, table, id);
+    return bdlat_NullableValueFunctions::accessValue(value, entryVisitor);
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Encoder::encodeAttributeSlot(bsl::size_t  table,
+                                 int          id,
+                                 const TYPE&  value,
+                                 CATEGORY)
+{
+    return encodeEntry(table, id, value);
+}
+
+template <class TYPE>
+int Encoder::encodeEntry(bsl::size_t table, int id, const TYPE& value)
+{
+    const bsl::size_t slot = d_buffer.size() - table;
+    if (FormatUtil::k_MAX_TABLE_SIZE
+                         < slot + FormatUtil::InlineSize<TYPE>::value) {
+        return -1;                                                    // RETURN
+    }
+
+    FormatUtil::putUint16(&d_buffer[table
+                                  + FormatUtil::k_VTABLE_ENTRY_SIZE
+                                  + FormatUtil::k_VTABLE_ENTRY_SIZE * id],
+                          static_cast<unsigned short>(slot));
+    return encodeSlot(value);
+}
+
+template <class TYPE>
+int Encoder::encodeAttributeBody(bsl::size_t                       table,
+                                 int                               id,
+                                 const TYPE&                       value,
+                                 bdlat_TypeCategory::NullableValue)
+{
+    const bsl::size_t slot = entry(table, id);
+    if (0 == slot) {
+        return 0;                                                     // RETURN
+    }
+
+    Encoder_BodyVisitor bodyVisitor(this, slot);
+    return bdlat_NullableValueFunctions::accessValue(value, bodyVisitor);
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Encoder::encodeAttributeBody(bsl::size_t  table,
+                                 int          id,
+                                 const TYPE&  value,
+                                 CATEGORY)
+{
+    const bsl::size_t slot = entry(table, id);
+    BSLS_ASSERT(0 != slot);
+
+    return encodeBody(slot, value);
+}
+
+// PRIVATE ACCESSORS
+inline
+bsl::size_t Encoder::entry(bsl::size_t table, int id) const
+{
+    const bsl::size_t offset = FormatUtil::getUint16(
+                             &d_buffer[table
+                                     + FormatUtil::k_VTABLE_ENTRY_SIZE
+                                     + FormatUtil::k_VTABLE_ENTRY_SIZE * id]);
+    return 0 == offset ? 0 : table + offset;
+}
+
+// CREATORS
+inline
+Encoder::Encoder(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Encoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    BSLS_ASSERT(streamBuf);
+
+    d_buffer.clear();
+
+    int rc = encodeSlot(value);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    rc = encodeBody(0, value);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const bsl::streamsize length = static_cast<bsl::streamsize>(
+                                                             d_buffer.size());
+    return length == streamBuf->sputn(d_buffer.data(), length) ? 0 : -1;
+}
+
+                         // -------------------------
+                         // class Encoder_SlotVisitor
+                         // -------------------------
+
+// CREATORS
+inline
+Encoder_SlotVisitor::Encoder_SlotVisitor(Encoder *encoder)
+: d_encoder_p(encoder)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_SlotVisitor::operator()(const TYPE& value)
+{
+    return d_encoder_p->encodeSlot(value);
+}
+
+template <class TYPE, class INFO>
+inline
+int Encoder_SlotVisitor::operator()(const TYPE& value, const INFO&)
+{
+    return d_encoder_p->encodeSlot(value);
+}
+
+                         // -------------------------
+                         // class Encoder_BodyVisitor
+                         // -------------------------
+
+// CREATORS
+inline
+Encoder_BodyVisitor::Encoder_BodyVisitor(Encoder *encoder, bsl::size_t slot)
+: d_encoder_p(encoder)
+, d_slot(slot)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_BodyVisitor::operator()(const TYPE& value)
+{
+    const bsl::size_t slot = d_slot;
+    d_slot += FormatUtil::InlineSize<TYPE>::value;
+    return d_encoder_p->encodeBody(slot, value);
+}
+
+template <class TYPE, class INFO>
+inline
+int Encoder_BodyVisitor::operator()(const TYPE& value, const INFO&)
+{
+    return (*this)(value);
+}
+
+                     // ----------------------------------
+                     // class Encoder_AttributeSlotVisitor
+                     // ----------------------------------
+
+// CREATORS
+inline
+Encoder_AttributeSlotVisitor::Encoder_AttributeSlotVisitor(
+                                                      Encoder     *encoder,
+                                                      bsl::size_t  table)
+: d_encoder_p(encoder)
+, d_table(table)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_AttributeSlotVisitor::operator()(const TYPE& value,
+                                             const INFO& info)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return d_encoder_p->encodeAttributeSlot(d_table,
+                                            info.id(),
+                                            value,
+                                            Category());
+}
+
+                     // ----------------------------------
+                     // class Encoder_AttributeBodyVisitor
+                     // ----------------------------------
+
+// CREATORS
+inline
+Encoder_AttributeBodyVisitor::Encoder_AttributeBodyVisitor(
+                                                      Encoder     *encoder,
+                                                      bsl::size_t  table)
+: d_encoder_p(encoder)
+, d_table(table)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_AttributeBodyVisitor::operator()(const TYPE& value,
+                                             const INFO& info)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+    return d_encoder_p->encodeAttributeBody(d_table,
+                                            info.id(),
+                                            value,
+                                            Category());
+}
+
+                         // --------------------------
+                         // class Encoder_EntryVisitor
+                         // --------------------------
+
+// CREATORS
+inline
+Encoder_EntryVisitor::Encoder_EntryVisitor(Encoder     *encoder,
+                                           bsl::size_t  table,
+                                           int          id)
+: d_encoder_p(encoder)
+, d_table(table)
+, d_id(id)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_EntryVisitor::operator()(const TYPE& value)
+{
+    return d_encoder_p->encodeEntry(d_table, d_id, value);
+}
+
+                        // ---------------------------
+                        // struct Encoder_MaxIdVisitor
+                        // ---------------------------
+
+// CREATORS
+inline
+Encoder_MaxIdVisitor::Encoder_MaxIdVisitor()
+: d_minId(0)
+, d_maxId(0)
+, d_numAttributes(0)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_MaxIdVisitor::operator()(const TYPE&, const INFO& info)
+{
+    const int id = info.id();
+    if (0 == d_numAttributes || id < d_minId) {
+        d_minId = id;
+    }
+    if (0 == d_numAttributes || d_maxId < id) {
+        d_maxId = id;
+    }
+    ++d_numAttributes;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
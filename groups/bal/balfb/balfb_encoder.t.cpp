@@ -0,0 +1,717 @@
+// balfb_encoder.t.cpp                                                -*-C++-*-
+#include <balfb_encoder.h>
+
+#include <balfb_formatutil.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_customint.h>
+#include <s_baltst_customizedstring.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_mychoice.h>
+#include <s_baltst_myenumeration.h>
+#include <s_baltst_mysequence.h>
+#include <s_baltst_mysequencewithnullables.h>
+
+#include <bdlb_nullablevalue.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_date.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an encoder whose output is completely
+// determined by the format described in `balfb_formatutil`.  We therefore
+// test the encoder by comparing its output, for values of each category, with
+// encodings built by hand.  Since the order of the slots and bodies is fixed
+// by the format, a byte-for-byte comparison also checks the offsets.  The
+// decoder is tested against this encoder in `balfb_decoderutil`.
+//
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 5] explicit Encoder(bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 1] int encode(bsl::streambuf *, const TYPE&);  // simple
+// [ 2] int encode(bsl::streambuf *, const TYPE&);  // nullable, array
+// [ 3] int encode(bsl::streambuf *, const TYPE&);  // choice
+// [ 4] int encode(bsl::streambuf *, const TYPE&);  // sequence
+// [ 5] int encode(bsl::streambuf *, const TYPE&);  // errors, reuse
+// ----------------------------------------------------------------------------
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balfb::Encoder Obj;
+
+namespace test {
+
+typedef s_baltst::Address  Address;
+typedef s_baltst::Employee Employee;
+
+}  // close namespace test
+
+static bool veryVerbose = false;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Print the specified `length` bytes at the specified `data` in
+/// hexadecimal.
+void printBytes(const char *data, bsl::size_t length)
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        bsl::printf("%02x ", static_cast<unsigned char>(data[i]));
+    }
+    bsl::printf("\n");
+}
+
+/// Encode the specified `value` and return `true` if the encoding consists
+/// of the specified `length` bytes at the specified `expected`, and `false`
+/// otherwise.
+template <class TYPE>
+bool encodesTo(const TYPE& value, const char *expected, bsl::size_t length)
+{
+    bdlsb::MemOutStreamBuf streamBuf;
+    Obj                    encoder;
+    if (0 != encoder.encode(&streamBuf, value)) {
+        return false;                                                 // RETURN
+    }
+
+    const bool result = bsl::string(streamBuf.data(), streamBuf.length())
+                     == bsl::string(expected, length);
+    if (!result && veryVerbose) {
+        printBytes(streamBuf.data(), streamBuf.length());
+        printBytes(expected, length);
+    }
+    return result;
+}
+
+#define ENCODES_TO(VALUE, EXPECTED)                                           \
+    ASSERT(encodesTo(VALUE, EXPECTED, sizeof EXPECTED))
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    veryVerbose          = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout  << endl
+                           << "USAGE EXAMPLE" << endl
+                           << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding an Employee Record
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that an "employee record" consists of a sequence of attributes:
+// `name`, `homeAddress` (itself a sequence of `street`, `city`, and `state`),
+// and `age`, and that the classes `test::Employee` and `test::Address`
+// represent these records and conform to the `bdlat` sequence protocol (e.g.,
+// they were generated from an XML schema).
+//
+// First, we create an employee record:
+// ```
+    test::Address address;
+    address.street() = "Lexington Ave";
+    address.city()   = "New York City";
+    address.state()  = "New York";
+
+    test::Employee bob;
+    bob.name()        = "Bob";
+    bob.homeAddress() = address;
+    bob.age()         = 56;
+// ```
+// Then, we encode the record to a stream buffer:
+// ```
+    bdlsb::MemOutStreamBuf streamBuf;
+
+    balfb::Encoder encoder;
+    int            rc = encoder.encode(&streamBuf, bob);
+    ASSERT(0 == rc);
+// ```
+// Now, we look up the `age` of the employee directly in the encoding.  We
+// use the primitive functions of `balfb::FormatUtil` to illustrate the
+// format; clients would normally use a `balfb::TableView` (see `balfb_view`)
+// instead.  The slot at the start of the encoding holds the offset of the
+// table of `bob`, whose vtable gives the slot of `age`:
+// ```
+    const char        *data   = streamBuf.data();
+    const bsl::size_t  length = streamBuf.length();
+
+    bsl::size_t employee;
+    rc = balfb::FormatUtil::followOffset(&employee, data, length, 0);
+    ASSERT(0 == rc);
+
+    bsl::size_t slot;
+    rc = balfb::FormatUtil::lookupAttribute(&slot,
+                                            data,
+                                            length,
+                                            employee,
+                                            test::Employee::ATTRIBUTE_ID_AGE);
+    ASSERT(0 == rc);
+
+    int age;
+    rc = balfb::FormatUtil::getValueAt(&age, data, length, slot);
+    ASSERT(0  == rc);
+    ASSERT(56 == age);
+// ```
+// Finally, we read the `city` of the home address, again without decoding the
+// rest of the record:
+// ```
+    const int HOME_ADDRESS = test::Employee::ATTRIBUTE_ID_HOME_ADDRESS;
+
+    rc = balfb::FormatUtil::lookupAttribute(&slot,
+                                            data,
+                                            length,
+                                            employee,
+                                            HOME_ADDRESS);
+    ASSERT(0 == rc);
+
+    bsl::size_t homeAddress;
+    rc = balfb::FormatUtil::followOffset(&homeAddress, data, length, slot);
+    ASSERT(0 == rc);
+
+    rc = balfb::FormatUtil::lookupAttribute(&slot,
+                                            data,
+                                            length,
+                                            homeAddress,
+                                            test::Address::ATTRIBUTE_ID_CITY);
+    ASSERT(0 == rc);
+
+    bsl::size_t city;
+    rc = balfb::FormatUtil::followOffset(&city, data, length, slot);
+    ASSERT(0 == rc);
+
+    const char  *cityData;
+    bsl::size_t  cityLength;
+    rc = balfb::FormatUtil::getString(&cityData,
+                                      &cityLength,
+                                      data,
+                                      length,
+                                      city);
+    ASSERT(0                                == rc);
+    ASSERT(bsl::string("New York City") == bsl::string(cityData, cityLength));
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ERRORS AND REUSE
+        //
+        // Concerns:
+        // 1. `encode` returns a non-zero value if the stream buffer does not
+        //    accept the whole encoding.
+        //
+        // 2. Each call to `encode` writes only the encoding of its argument,
+        //    whatever was encoded before.
+        //
+        // 3. Memory is supplied by the allocator passed at construction, and
+        //    the default allocator is not used.
+        //
+        // Plan:
+        // 1. Encode a value to a fixed-size stream buffer that is too small.
+        //    (C-1)
+        //
+        // 2. Encode a large value, then a small one, with the same encoder,
+        //    and compare the second encoding with that of a new encoder.
+        //    (C-2)
+        //
+        // 3. Encode values using an encoder created with a test allocator,
+        //    while a second test allocator is installed as the default.
+        //    (C-3)
+        //
+        // Testing:
+        //   explicit Encoder(bslma::Allocator *basicAllocator = 0);
+        //   int encode(bsl::streambuf *, const TYPE&);  // errors, reuse
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ERRORS AND REUSE" << endl
+                          << "========================" << endl;
+
+        test::Employee bob;
+        bob.name()                 = "Bob";
+        bob.homeAddress().street() = "Lexington Ave";
+        bob.homeAddress().city()   = "New York City";
+        bob.homeAddress().state()  = "New York";
+        bob.age()                  = 56;
+
+        if (verbose) cout << "\nTesting a full stream buffer." << endl;
+        {
+            char                        buffer[16];
+            bdlsb::FixedMemOutStreamBuf streamBuf(buffer, sizeof buffer);
+
+            Obj encoder;
+            ASSERT(0 != encoder.encode(&streamBuf, bob));
+        }
+
+        if (verbose) cout << "\nTesting reuse." << endl;
+        {
+            s_baltst::MySequence small;
+            small.attribute1() = 1;
+            small.attribute2() = "x";
+
+            bdlsb::MemOutStreamBuf expected;
+            Obj                    other;
+            ASSERT(0 == other.encode(&expected, small));
+
+            Obj encoder;
+
+            bdlsb::MemOutStreamBuf first;
+            ASSERT(0 == encoder.encode(&first, bob));
+            ASSERT(expected.length() < first.length());
+
+            bdlsb::MemOutStreamBuf second;
+            ASSERT(0 == encoder.encode(&second, small));
+            ASSERT(bsl::string(expected.data(), expected.length())
+                          == bsl::string(second.data(), second.length()));
+        }
+
+        if (verbose) cout << "\nTesting allocators." << endl;
+        {
+            bslma::TestAllocator         da("default",  veryVeryVerbose);
+            bslma::TestAllocator         sa("supplied", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            // The stream buffer uses the supplied allocator, too, so that
+            // only the encoder can use the default allocator.
+
+            bdlsb::MemOutStreamBuf streamBuf(&sa);
+            {
+                Obj encoder(&sa);
+                ASSERT(0 == encoder.encode(&streamBuf, bob));
+                ASSERT(0 <  sa.numBlocksInUse());
+            }
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlsb::MemOutStreamBuf streamBuf;
+            Obj                    encoder;
+
+            ASSERT_PASS(encoder.encode(&streamBuf, 1));
+            ASSERT_FAIL(encoder.encode(0, 1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING SEQUENCES
+        //
+        // Concerns:
+        // 1. A sequence is encoded as an offset to a table whose vtable has
+        //    an entry for each id up to the largest id of an attribute.
+        //
+        // 2. The slots of the attributes follow the vtable in the order of
+        //    the attributes, and the bodies follow the table.
+        //
+        // 3. A null nullable attribute has no slot, and a vtable entry of 0.
+        //
+        // 4. A non-null nullable attribute has the slot of its underlying
+        //    type.
+        //
+        // Plan:
+        // 1. Compare the encodings of sequences having scalar, string, and
+        //    nullable attributes with encodings built by hand.  (C-1..4)
+        //
+        // Testing:
+        //   int encode(bsl::streambuf *, const TYPE&);  // sequence
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SEQUENCES" << endl
+                          << "=================" << endl;
+
+        {
+            s_baltst::MySequence value;
+            value.attribute1() = 5;
+            value.attribute2() = "ab";
+
+            const char EXP[] = { 4, 0, 0, 0,             // offset to table
+                                 2, 0,                   // vtable
+                                 6, 0,
+                                 10, 0,
+                                 5, 0, 0, 0,             // attribute1
+                                 4, 0, 0, 0,             // attribute2
+                                 2, 0, 0, 0, 'a', 'b', 0 };
+            ENCODES_TO(value, EXP);
+        }
+        {
+            s_baltst::MySequenceWithNullables value;
+
+            const char EXP[] = { 4, 0, 0, 0,
+                                 3, 0,
+                                 0, 0,
+                                 0, 0,
+                                 0, 0 };
+            ENCODES_TO(value, EXP);
+        }
+        {
+            s_baltst::MySequenceWithNullables value;
+            value.attribute1().makeValue(3);
+
+            const char EXP[] = { 4, 0, 0, 0,
+                                 3, 0,
+                                 8, 0,
+                                 0, 0,
+                                 0, 0,
+                                 3, 0, 0, 0 };
+            ENCODES_TO(value, EXP);
+        }
+        {
+            s_baltst::MySequenceWithNullables value;
+            value.attribute2().makeValue("z");
+            value.attribute3().makeValue();
+            value.attribute3().value().attribute1() = 7;
+
+            // The table of `attribute3` follows the body of `attribute2`.
+
+            const char EXP[] = { 4, 0, 0, 0,
+                                 3, 0,                   // outer vtable
+                                 0, 0,
+                                 8, 0,
+                                 12, 0,
+                                 8, 0, 0, 0,             // attribute2
+                                 10, 0, 0, 0,            // attribute3
+                                 1, 0, 0, 0, 'z', 0,     // "z"
+                                 2, 0,                   // inner vtable
+                                 6, 0,
+                                 10, 0,
+                                 7, 0, 0, 0,             // attribute1
+                                 4, 0, 0, 0,             // attribute2
+                                 0, 0, 0, 0, 0 };        // ""
+            ENCODES_TO(value, EXP);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CHOICES
+        //
+        // Concerns:
+        // 1. A choice is encoded as an offset to its selection id, followed
+        //    by the slot of the selection.
+        //
+        // 2. A choice having no selection has no slot after the id.
+        //
+        // Plan:
+        // 1. Compare the encodings of choices having each selection, and no
+        //    selection, with encodings built by hand.  (C-1..2)
+        //
+        // Testing:
+        //   int encode(bsl::streambuf *, const TYPE&);  // choice
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CHOICES" << endl
+                          << "===============" << endl;
+
+        s_baltst::MyChoice value;
+        {
+            const char EXP[] = { 4, 0, 0, 0, -1, -1, -1, -1 };
+            ENCODES_TO(value, EXP);
+        }
+
+        value.makeSelection1(7);
+        {
+            const char EXP[] = { 4, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0 };
+            ENCODES_TO(value, EXP);
+        }
+
+        value.makeSelection2("x");
+        {
+            const char EXP[] = { 4, 0, 0, 0,
+                                 1, 0, 0, 0,
+                                 4, 0, 0, 0,
+                                 1, 0, 0, 0, 'x', 0 };
+            ENCODES_TO(value, EXP);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING NULLABLE VALUES AND ARRAYS
+        //
+        // Concerns:
+        // 1. A nullable value that is not an attribute is encoded as an
+        //    offset, which is 0 if the value is null.
+        //
+        // 2. An array is encoded as an offset to its number of elements,
+        //    followed by the slots of the elements, followed by their bodies.
+        //
+        // 3. A `bsl::vector<char>` is encoded as a string.
+        //
+        // Plan:
+        // 1. Compare the encodings of nullable values and arrays with
+        //    encodings built by hand.  (C-1..3)
+        //
+        // Testing:
+        //   int encode(bsl::streambuf *, const TYPE&);  // nullable, array
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING NULLABLE VALUES AND ARRAYS" << endl
+                          << "==================================" << endl;
+
+        if (verbose) cout << "\nTesting nullable values." << endl;
+        {
+            bdlb::NullableValue<int> value;
+            {
+                const char EXP[] = { 0, 0, 0, 0 };
+                ENCODES_TO(value, EXP);
+            }
+
+            value.makeValue(5);
+            {
+                const char EXP[] = { 4, 0, 0, 0, 5, 0, 0, 0 };
+                ENCODES_TO(value, EXP);
+            }
+
+            bdlb::NullableValue<bsl::string> str;
+            str.makeValue("a");
+            {
+                const char EXP[] = { 4, 0, 0, 0,
+                                     4, 0, 0, 0,
+                                     1, 0, 0, 0, 'a', 0 };
+                ENCODES_TO(str, EXP);
+            }
+        }
+
+        if (verbose) cout << "\nTesting arrays." << endl;
+        {
+            bsl::vector<int> value;
+            {
+                const char EXP[] = { 4, 0, 0, 0, 0, 0, 0, 0 };
+                ENCODES_TO(value, EXP);
+            }
+
+            value.push_back(1);
+            value.push_back(-2);
+            {
+                const char EXP[] = { 4, 0, 0, 0,
+                                     2, 0, 0, 0,
+                                     1, 0, 0, 0,
+                                     -2, -1, -1, -1 };
+                ENCODES_TO(value, EXP);
+            }
+
+            bsl::vector<bsl::string> strings;
+            strings.push_back("a");
+            strings.push_back("bc");
+            {
+                const char EXP[] = { 4, 0, 0, 0,
+                                     2, 0, 0, 0,          // count
+                                     8, 0, 0, 0,          // element 0
+                                     10, 0, 0, 0,         // element 1
+                                     1, 0, 0, 0, 'a', 0,
+                                     2, 0, 0, 0, 'b', 'c', 0 };
+                ENCODES_TO(strings, EXP);
+            }
+
+            bsl::vector<char> binary;
+            binary.push_back('\x01');
+            binary.push_back('\0');
+            {
+                const char EXP[] = { 4, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0 };
+                ENCODES_TO(binary, EXP);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING SIMPLE VALUES
+        //
+        // Concerns:
+        // 1. A scalar is encoded as its slot.
+        //
+        // 2. A string is encoded as an offset to its length, data, and null
+        //    terminator.
+        //
+        // 3. An enumeration is encoded as its integer value.
+        //
+        // 4. A customized type is encoded as its base type.
+        //
+        // Plan:
+        // 1. Compare the encodings of values of each kind with encodings built
+        //    by hand.  (C-1..4)
+        //
+        // Testing:
+        //   int encode(bsl::streambuf *, const TYPE&);  // simple
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SIMPLE VALUES" << endl
+                          << "=====================" << endl;
+
+        {
+            const char EXP[] = { 1 };
+            ENCODES_TO(true, EXP);
+        }
+        {
+            const char EXP[] = { 0x04, 0x03, 0x02, 0x01 };
+            ENCODES_TO(0x01020304, EXP);
+        }
+        {
+            const char EXP[] = { 0, 0, 0, 0, 0, 0, -16, 63 };
+            ENCODES_TO(1.0, EXP);
+        }
+        {
+            const char EXP[] = { 0x07, 0x07, 12, 31 };
+            ENCODES_TO(bdlt::Date(1799, 12, 31), EXP);
+        }
+        {
+            const char EXP[] = { 4, 0, 0, 0, 0, 0, 0, 0, 0 };
+            ENCODES_TO(bsl::string(), EXP);
+        }
+        {
+            const char EXP[] = { 4, 0, 0, 0, 3, 0, 0, 0, 'a', 'b', 'c', 0 };
+            ENCODES_TO(bsl::string("abc"), EXP);
+        }
+        {
+            const char EXP[] = { 1, 0, 0, 0 };
+            ENCODES_TO(s_baltst::MyEnumeration::VALUE2, EXP);
+        }
+        {
+            const char EXP[] = { 9, 0, 0, 0 };
+            ENCODES_TO(s_baltst::CustomInt(9), EXP);
+        }
+        {
+            const char EXP[] = { 4, 0, 0, 0, 1, 0, 0, 0, 'q', 0 };
+            ENCODES_TO(s_baltst::CustomizedString("q"), EXP);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
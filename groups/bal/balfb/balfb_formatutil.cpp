@@ -0,0 +1,370 @@
+// balfb_formatutil.cpp                                               -*-C++-*-
+#include <balfb_formatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balfb_formatutil_cpp,"$Id$ $CSID$")
+
+#include <bdldfp_decimalconvertutil.h>
+
+namespace BloombergLP {
+namespace balfb {
+namespace {
+
+const bsls::Types::Int64 k_MICROSECONDS_PER_SECOND = 1000000;
+const bsls::Types::Int64 k_MICROSECONDS_PER_MINUTE =
+                                                60 * k_MICROSECONDS_PER_SECOND;
+const bsls::Types::Int64 k_MICROSECONDS_PER_HOUR   =
+                                                60 * k_MICROSECONDS_PER_MINUTE;
+
+/// Return the number of microseconds since midnight represented by the
+/// specified `time`.  Note that the default value of `bdlt::Time` (24:00)
+/// results in 24 hours.
+bsls::Types::Int64 toMicroseconds(const bdlt::Time& time)
+{
+    int hour, minute, second, millisecond, microsecond;
+    time.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    return hour   * k_MICROSECONDS_PER_HOUR
+         + minute * k_MICROSECONDS_PER_MINUTE
+         + second * k_MICROSECONDS_PER_SECOND
+         + millisecond * 1000
+         + microsecond;
+}
+
+/// Load into the specified `hour`, `minute`, `second`, `millisecond`, and
+/// `microsecond` the time of day represented by the specified number of
+/// `microseconds` since midnight.  Return 0 on success, and a non-zero value
+/// if `microseconds` is not in the range `[0 .. 24 hours]`.
+int fromMicroseconds(int                *hour,
+                     int                *minute,
+                     int                *second,
+                     int                *millisecond,
+                     int                *microsecond,
+                     bsls::Types::Int64  microseconds)
+{
+    if (microseconds < 0 || 24 * k_MICROSECONDS_PER_HOUR < microseconds) {
+        return -1;                                                    // RETURN
+    }
+
+    *hour         = static_cast<int>(microseconds / k_MICROSECONDS_PER_HOUR);
+    microseconds %= k_MICROSECONDS_PER_HOUR;
+    *minute       = static_cast<int>(microseconds / k_MICROSECONDS_PER_MINUTE);
+    microseconds %= k_MICROSECONDS_PER_MINUTE;
+    *second       = static_cast<int>(microseconds / k_MICROSECONDS_PER_SECOND);
+    microseconds %= k_MICROSECONDS_PER_SECOND;
+    *millisecond  = static_cast<int>(microseconds / 1000);
+    *microsecond  = static_cast<int>(microseconds % 1000);
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                              // -----------------
+                              // struct FormatUtil
+                              // -----------------
+
+// CLASS METHODS
+
+                        // Scalar Values
+
+void FormatUtil::putValue(char *buffer, bdldfp::Decimal64 value)
+{
+    // 'decimal64ToBID' writes the BID encoding in host byte order.
+
+    unsigned char       bid[sizeof(bsls::Types::Uint64)];
+    bsls::Types::Uint64 bits;
+    bdldfp::DecimalConvertUtil::decimal64ToBID(bid, value);
+    bsl::memcpy(&bits, bid, sizeof bits);
+    putValue(buffer, bits);
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::Date& value)
+{
+    int year, month, day;
+    value.getYearMonthDay(&year, &month, &day);
+
+    putUint16(buffer, static_cast<unsigned short>(year));
+    buffer[2] = static_cast<char>(month);
+    buffer[3] = static_cast<char>(day);
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::DateTz& value)
+{
+    putValue(buffer, value.localDate());
+    putValue(buffer + FormatUtil_SimpleSize<bdlt::Date>::value,
+             value.offset());
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::Datetime& value)
+{
+    putValue(buffer, value.date());
+    putValue(buffer + FormatUtil_SimpleSize<bdlt::Date>::value,
+             value.time());
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::DatetimeTz& value)
+{
+    putValue(buffer, value.localDatetime());
+    putValue(buffer + FormatUtil_SimpleSize<bdlt::Datetime>::value,
+             value.offset());
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::Time& value)
+{
+    putValue(buffer, toMicroseconds(value));
+}
+
+void FormatUtil::putValue(char *buffer, const bdlt::TimeTz& value)
+{
+    putValue(buffer, value.localTime());
+    putValue(buffer + FormatUtil_SimpleSize<bdlt::Time>::value,
+             value.offset());
+}
+
+int FormatUtil::getValue(bdldfp::Decimal64 *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    unsigned char       bid[sizeof(bsls::Types::Uint64)];
+    bsls::Types::Uint64 bits;
+    getValue(&bits, buffer);
+    bsl::memcpy(bid, &bits, sizeof bits);
+    *value = bdldfp::DecimalConvertUtil::decimal64FromBID(bid);
+    return 0;
+}
+
+int FormatUtil::getValue(bdlt::Date *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    return value->setYearMonthDayIfValid(
+                                 getUint16(buffer),
+                                 static_cast<unsigned char>(buffer[2]),
+                                 static_cast<unsigned char>(buffer[3]));
+}
+
+int FormatUtil::getValue(bdlt::DateTz *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bdlt::Date date;
+    int        offset;
+    if (0 != getValue(&date, buffer)) {
+        return -1;                                                    // RETURN
+    }
+    getValue(&offset, buffer + FormatUtil_SimpleSize<bdlt::Date>::value);
+
+    return value->setDateTzIfValid(date, offset);
+}
+
+int FormatUtil::getValue(bdlt::Datetime *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bdlt::Date         date;
+    bsls::Types::Int64 microseconds;
+    if (0 != getValue(&date, buffer)) {
+        return -1;                                                    // RETURN
+    }
+    getValue(&microseconds,
+             buffer + FormatUtil_SimpleSize<bdlt::Date>::value);
+
+    int hour, minute, second, millisecond, microsecond;
+    if (0 != fromMicroseconds(&hour,
+                              &minute,
+                              &second,
+                              &millisecond,
+                              &microsecond,
+                              microseconds)) {
+        return -1;                                                    // RETURN
+    }
+    return value->setDatetimeIfValid(date,
+                                     hour,
+                                     minute,
+                                     second,
+                                     millisecond,
+                                     microsecond);
+}
+
+int FormatUtil::getValue(bdlt::DatetimeTz *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bdlt::Datetime datetime;
+    int            offset;
+    if (0 != getValue(&datetime, buffer)) {
+        return -1;                                                    // RETURN
+    }
+    getValue(&offset, buffer + FormatUtil_SimpleSize<bdlt::Datetime>::value);
+
+    return value->setDatetimeTzIfValid(datetime, offset);
+}
+
+int FormatUtil::getValue(bdlt::Time *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bsls::Types::Int64 microseconds;
+    getValue(&microseconds, buffer);
+
+    int hour, minute, second, millisecond, microsecond;
+    if (0 != fromMicroseconds(&hour,
+                              &minute,
+                              &second,
+                              &millisecond,
+                              &microsecond,
+                              microseconds)) {
+        return -1;                                                    // RETURN
+    }
+    return value->setTimeIfValid(hour,
+                                 minute,
+                                 second,
+                                 millisecond,
+                                 microsecond);
+}
+
+int FormatUtil::getValue(bdlt::TimeTz *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bdlt::Time time;
+    int        offset;
+    if (0 != getValue(&time, buffer)) {
+        return -1;                                                    // RETURN
+    }
+    getValue(&offset, buffer + FormatUtil_SimpleSize<bdlt::Time>::value);
+
+    return value->setTimeTzIfValid(time, offset);
+}
+
+                        // Navigation
+
+int FormatUtil::followOffset(bsl::size_t *position,
+                             const char  *buffer,
+                             bsl::size_t  length,
+                             bsl::size_t  slot)
+{
+    BSLS_ASSERT(position);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length < slot || length - slot < k_OFFSET_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t offset = getUint32(buffer + slot);
+    if (0 == offset) {
+        *position = 0;
+        return 0;                                                     // RETURN
+    }
+    if (length - slot <= offset) {
+        return -1;                                                    // RETURN
+    }
+
+    *position = slot + offset;
+    return 0;
+}
+
+int FormatUtil::lookupAttribute(bsl::size_t *slot,
+                                const char  *buffer,
+                                bsl::size_t  length,
+                                bsl::size_t  table,
+                                int          id)
+{
+    BSLS_ASSERT(slot);
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(0 <= id);
+
+    if (length < table || length - table < k_VTABLE_ENTRY_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t numEntries = getUint16(buffer + table);
+    if (numEntries <= static_cast<bsl::size_t>(id)) {
+        *slot = 0;
+        return 0;                                                     // RETURN
+    }
+    if ((length - table) / k_VTABLE_ENTRY_SIZE <= numEntries) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t entry = getUint16(buffer + table
+                                               + k_VTABLE_ENTRY_SIZE
+                                               + k_VTABLE_ENTRY_SIZE * id);
+    if (0 == entry) {
+        *slot = 0;
+        return 0;                                                     // RETURN
+    }
+    if (length - table <= entry) {
+        return -1;                                                    // RETURN
+    }
+
+    *slot = table + entry;
+    return 0;
+}
+
+int FormatUtil::getArrayLength(bsl::size_t *numElements,
+                               const char  *buffer,
+                               bsl::size_t  length,
+                               bsl::size_t  position,
+                               bsl::size_t  elementSize)
+{
+    BSLS_ASSERT(numElements);
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(0 < elementSize);
+
+    if (length < position || length - position < k_LENGTH_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t count = getUint32(buffer + position);
+    if ((length - position - k_LENGTH_SIZE) / elementSize < count) {
+        return -1;                                                    // RETURN
+    }
+
+    *numElements = count;
+    return 0;
+}
+
+int FormatUtil::getString(const char  **data,
+                          bsl::size_t  *dataLength,
+                          const char   *buffer,
+                          bsl::size_t   length,
+                          bsl::size_t   position)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(dataLength);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length < position || length - position < k_LENGTH_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t count = getUint32(buffer + position);
+    if (length - position - k_LENGTH_SIZE <= count
+     || 0 != buffer[position + k_LENGTH_SIZE + count]) {
+        return -1;                                                    // RETURN
+    }
+
+    *data       = buffer + position + k_LENGTH_SIZE;
+    *dataLength = count;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
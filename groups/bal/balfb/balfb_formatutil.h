@@ -0,0 +1,683 @@
+// balfb_formatutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALFB_FORMATUTIL
+#define INCLUDED_BALFB_FORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the layout of, and primitive access to, the flat format.
+//
+//@CLASSES:
+//  balfb::FormatUtil: namespace for reading and writing flat-format primitives
+//
+//@SEE_ALSO: balfb_encoder, balfb_decoderutil, balfb_view
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `balfb::FormatUtil`, that defines the "flat" binary format used by the
+// `balfb` package, and serves as a namespace for functions that read and
+// write the primitive constructs of that format.  The flat format encodes
+// values of types supported by the `bdlat` framework such that a single
+// attribute of an encoded object can be read directly from the encoded bytes
+// in time independent of the size of the object, without decoding the rest of
+// the object.
+//
+// Note that this is a low-level component.  Clients should use
+// `balfb_encoder` to encode objects, and `balfb_view` or `balfb_decoderutil`
+// to read them.
+//
+///The Flat Format
+///---------------
+// All integers in the flat format are little-endian, and no value is aligned
+// (i.e., values are read and written a byte at a time, or by `memcpy`).
+//
+// Each value has an *inline* *representation* (or *slot*) whose size depends
+// only on the type of the value:
+// ```
+//  Type                                         Slot
+//  -------------------------------------------  ----------------------------
+//  bool, char, signed char, unsigned char       the value (1 byte)
+//  short, unsigned short                        the value (2 bytes)
+//  int, unsigned int, float                     the value (4 bytes)
+//  bsls::Types::Int64, bsls::Types::Uint64      the value (8 bytes)
+//  double                                       the value (8 bytes)
+//  bdldfp::Decimal64                            the BID encoding (8 bytes)
+//  bdlt::Date                                   year (2), month, day
+//  bdlt::Time                                   microseconds since midnight
+//                                               (8 bytes)
+//  bdlt::Datetime                               the date, then the time
+//  bdlt::DateTz, bdlt::TimeTz, bdlt::DatetimeTz the local value, then the
+//                                               offset in minutes (4 bytes)
+//  enumeration                                  the integer value (4 bytes)
+//  customized type                              the slot of the base type
+//  string, array, sequence, choice, nullable    an offset (4 bytes)
+// ```
+// An offset is an unsigned integer giving the distance, in bytes, from the
+// slot holding the offset to the *body* of the value, which always follows
+// the slot.  An offset of 0 in the slot of a nullable value indicates that the
+// value is null.  The body of each kind of value is as follows:
+//
+// * A `bsl::string`, or a `bsl::vector<char>`, has a 4-byte length, followed
+//   by that many bytes of data, followed by a null byte (so that the data can
+//   be used as a null-terminated string).
+//
+// * Any other array has a 4-byte number of elements, followed by the slots
+//   of the elements, so that each element is at a fixed position.
+//
+// * A sequence is a *table*.  A table begins with a *vtable*: a 2-byte number
+//   of entries, `N`, followed by `N` 2-byte entries.  The entry at index `i`
+//   is the distance from the start of the table to the slot of the attribute
+//   having the id `i`, or 0 if the table has no such attribute (e.g., the
+//   attribute is null).  The slots of the attributes follow the vtable.  Note
+//   that the slot of a nullable attribute is that of its underlying type, so
+//   that the scalar attributes of a table are at fixed positions.
+//
+// * A choice has a 4-byte selection id, followed by the slot of the
+//   selection, unless the selection id is
+//   `bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID`.
+//
+// * A nullable value that is not an attribute of a sequence has the slot of
+//   its underlying type.
+//
+// The encoding of an object of a given type is the slot of the object,
+// followed by the bodies of the values that it refers to, directly or
+// indirectly.  Since each offset refers to a later position in the encoding,
+// a reader following the offsets always terminates.
+//
+// Note that the ids of the attributes of a sequence must be in the range
+// `[0 .. k_MAX_ATTRIBUTE_ID]`, that the table of a sequence (i.e., its vtable
+// and slots, excluding the bodies they refer to) must not exceed
+// `k_MAX_TABLE_SIZE` bytes, and that the flat format does not support
+// "dynamic" types or the `bdlb::Variant` date-and-time types.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading an Attribute of a Table
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding the encoding of a sequence having an `int`
+// attribute with the id 1.  The encoding starts with the slot of the
+// sequence, an offset to its table, which has a vtable of 2 entries (for the
+// ids 0 and 1, the first of which is unused) followed by the slot of the
+// attribute:
+// ```
+// const char buffer[] = {
+//     4, 0, 0, 0,   // offset to the table
+//     2, 0,         // number of vtable entries
+//     0, 0,         // slot of the attribute having id 0 (absent)
+//     6, 0,         // slot of the attribute having id 1
+//     42, 0, 0, 0   // value of the attribute having id 1
+// };
+// ```
+// First, we find the table by following the offset in the slot at the start
+// of the buffer:
+// ```
+// bsl::size_t table;
+// int rc = balfb::FormatUtil::followOffset(&table,
+//                                          buffer,
+//                                          sizeof buffer,
+//                                          0);
+// assert(0 == rc);
+// assert(4 == table);
+// ```
+// Then, we find the slot of the attribute having the id 1:
+// ```
+// bsl::size_t slot;
+// rc = balfb::FormatUtil::lookupAttribute(&slot,
+//                                         buffer,
+//                                         sizeof buffer,
+//                                         table,
+//                                         1);
+// assert(0  == rc);
+// assert(10 == slot);
+// ```
+// Finally, we load the value of the attribute from its slot:
+// ```
+// int value;
+// rc = balfb::FormatUtil::getValueAt(&value, buffer, sizeof buffer, slot);
+// assert(0  == rc);
+// assert(42 == value);
+// ```
+
+#include <balscm_version.h>
+
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_typecategory.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+template <class TYPE>
+struct FormatUtil_SimpleSize;
+
+template <class TYPE, class CATEGORY>
+struct FormatUtil_InlineSize;
+
+                              // =================
+                              // struct FormatUtil
+                              // =================
+
+/// This `struct` provides a namespace for constants describing the flat
+/// format, and for functions that read and write its primitive constructs.
+/// Functions named `get...At` and the navigation functions check that the
+/// bytes they read are within the buffer supplied to them, and return a
+/// non-zero value if not.
+struct FormatUtil {
+
+    // TYPES
+    enum {
+        k_OFFSET_SIZE       = 4,       // size of an offset
+        k_LENGTH_SIZE       = 4,       // size of a length or element count
+        k_SELECTION_ID_SIZE = 4,       // size of a selection id
+        k_VTABLE_ENTRY_SIZE = 2,       // size of a vtable entry (and count)
+        k_MAX_ATTRIBUTE_ID  = 0xFFFE,  // largest id of an attribute
+        k_MAX_TABLE_SIZE    = 0xFFFF   // largest size of a table
+    };
+
+    /// This meta-function provides a member `value` that is the size, in
+    /// bytes, of the slot of a value of the (template parameter) `TYPE`.
+    template <class TYPE>
+    struct InlineSize {
+
+        enum {
+            value = FormatUtil_InlineSize<
+                      TYPE,
+                      typename bdlat_TypeCategory::Select<TYPE>::Type>::value
+        };
+    };
+
+    // CLASS METHODS
+
+                        // Unsigned Integers
+
+    /// Write the specified `value` to the 2 bytes at the specified `buffer`.
+    static void putUint16(char *buffer, unsigned short value);
+
+    /// Write the specified `value` to the 4 bytes at the specified `buffer`.
+    static void putUint32(char *buffer, unsigned int value);
+
+    /// Return the value of the 2 bytes at the specified `buffer`.
+    static unsigned short getUint16(const char *buffer);
+
+    /// Return the value of the 4 bytes at the specified `buffer`.
+    static unsigned int getUint32(const char *buffer);
+
+                        // Scalar Values
+
+    /// Write the slot of the specified `value` to the
+    /// `InlineSize<TYPE>::value` bytes at the specified `buffer`.
+    static void putValue(char *buffer, bool                      value);
+    static void putValue(char *buffer, char                      value);
+    static void putValue(char *buffer, signed char               value);
+    static void putValue(char *buffer, unsigned char             value);
+    static void putValue(char *buffer, short                     value);
+    static void putValue(char *buffer, unsigned short            value);
+    static void putValue(char *buffer, int                       value);
+    static void putValue(char *buffer, unsigned int              value);
+    static void putValue(char *buffer, bsls::Types::Int64        value);
+    static void putValue(char *buffer, bsls::Types::Uint64       value);
+    static void putValue(char *buffer, float                     value);
+    static void putValue(char *buffer, double                    value);
+    static void putValue(char *buffer, bdldfp::Decimal64         value);
+    static void putValue(char *buffer, const bdlt::Date&         value);
+    static void putValue(char *buffer, const bdlt::DateTz&       value);
+    static void putValue(char *buffer, const bdlt::Datetime&     value);
+    static void putValue(char *buffer, const bdlt::DatetimeTz&   value);
+    static void putValue(char *buffer, const bdlt::Time&         value);
+    static void putValue(char *buffer, const bdlt::TimeTz&       value);
+
+    /// Load into the specified `value` the value of the slot in the
+    /// `InlineSize<TYPE>::value` bytes at the specified `buffer`.  Return 0
+    /// on success, and a non-zero value (with no effect on `value`) if the
+    /// slot does not hold a valid value of its type.
+    static int getValue(bool                *value, const char *buffer);
+    static int getValue(char                *value, const char *buffer);
+    static int getValue(signed char         *value, const char *buffer);
+    static int getValue(unsigned char       *value, const char *buffer);
+    static int getValue(short               *value, const char *buffer);
+    static int getValue(unsigned short      *value, const char *buffer);
+    static int getValue(int                 *value, const char *buffer);
+    static int getValue(unsigned int        *value, const char *buffer);
+    static int getValue(bsls::Types::Int64  *value, const char *buffer);
+    static int getValue(bsls::Types::Uint64 *value, const char *buffer);
+    static int getValue(float               *value, const char *buffer);
+    static int getValue(double              *value, const char *buffer);
+    static int getValue(bdldfp::Decimal64   *value, const char *buffer);
+    static int getValue(bdlt::Date          *value, const char *buffer);
+    static int getValue(bdlt::DateTz        *value, const char *buffer);
+    static int getValue(bdlt::Datetime      *value, const char *buffer);
+    static int getValue(bdlt::DatetimeTz    *value, const char *buffer);
+    static int getValue(bdlt::Time          *value, const char *buffer);
+    static int getValue(bdlt::TimeTz        *value, const char *buffer);
+
+    /// Load into the specified `value` the value of the slot at the
+    /// specified `slot` position in the specified `buffer` of the specified
+    /// `length`.  Return 0 on success, and a non-zero value (with no effect
+    /// on `value`) if the slot is not within the buffer or does not hold a
+    /// valid value of the (template parameter) `TYPE`, which must be one of
+    /// the types supported by `getValue`.
+    template <class TYPE>
+    static int getValueAt(TYPE        *value,
+                          const char  *buffer,
+                          bsl::size_t  length,
+                          bsl::size_t  slot);
+
+                        // Navigation
+
+    /// Load into the specified `position` the position of the body referred
+    /// to by the offset in the slot at the specified `slot` position in the
+    /// specified `buffer` of the specified `length`, or 0 if the offset is 0
+    /// (i.e., the value is null).  Return 0 on success, and a non-zero value
+    /// if the slot, or the position it refers to, is not within the buffer.
+    static int followOffset(bsl::size_t *position,
+                            const char  *buffer,
+                            bsl::size_t  length,
+                            bsl::size_t  slot);
+
+    /// Load into the specified `slot` the position of the slot of the
+    /// attribute having the specified `id` in the table at the specified
+    /// `table` position in the specified `buffer` of the specified `length`,
+    /// or 0 if the table has no such attribute.  Return 0 on success, and a
+    /// non-zero value if the vtable, or the position of the slot, is not
+    /// within the buffer.
+    static int lookupAttribute(bsl::size_t *slot,
+                               const char  *buffer,
+                               bsl::size_t  length,
+                               bsl::size_t  table,
+                               int          id);
+
+    /// Load into the specified `numElements` the number of elements of the
+    /// array whose body is at the specified `position` in the specified
+    /// `buffer` of the specified `length`, having slots of the specified
+    /// `elementSize`.  Return 0 on success, and a non-zero value if the
+    /// body, including the slots of all of its elements, is not within the
+    /// buffer.
+    static int getArrayLength(bsl::size_t *numElements,
+                              const char  *buffer,
+                              bsl::size_t  length,
+                              bsl::size_t  position,
+                              bsl::size_t  elementSize);
+
+    /// Load into the specified `data` and `dataLength` the address and
+    /// length of the data of the string whose body is at the specified
+    /// `position` in the specified `buffer` of the specified `length`.
+    /// Return 0 on success, and a non-zero value if the body is not within
+    /// the buffer or is not null-terminated.
+    static int getString(const char  **data,
+                         bsl::size_t  *dataLength,
+                         const char   *buffer,
+                         bsl::size_t   length,
+                         bsl::size_t   position);
+};
+
+                        // ============================
+                        // struct FormatUtil_SimpleSize
+                        // ============================
+
+/// This component-private meta-function provides a member `value` that is
+/// the size of the slot of the (template parameter) simple `TYPE`.  It is
+/// specialized for each simple type supported by the flat format.
+template <class TYPE>
+struct FormatUtil_SimpleSize;
+
+#define BALFB_FORMATUTIL_SIMPLE_SIZE(TYPE, SIZE)                              \
+    template <>                                                               \
+    struct FormatUtil_SimpleSize<TYPE> {                                      \
+        enum { value = SIZE };                                                \
+    }
+
+BALFB_FORMATUTIL_SIMPLE_SIZE(bool,                1);
+BALFB_FORMATUTIL_SIMPLE_SIZE(char,                1);
+BALFB_FORMATUTIL_SIMPLE_SIZE(signed char,         1);
+BALFB_FORMATUTIL_SIMPLE_SIZE(unsigned char,       1);
+BALFB_FORMATUTIL_SIMPLE_SIZE(short,               2);
+BALFB_FORMATUTIL_SIMPLE_SIZE(unsigned short,      2);
+BALFB_FORMATUTIL_SIMPLE_SIZE(int,                 4);
+BALFB_FORMATUTIL_SIMPLE_SIZE(unsigned int,        4);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bsls::Types::Int64,  8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bsls::Types::Uint64, 8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(float,               4);
+BALFB_FORMATUTIL_SIMPLE_SIZE(double,              8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdldfp::Decimal64,   8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::Date,          4);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::DateTz,        8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::Datetime,      12);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::DatetimeTz,    16);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::Time,          8);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bdlt::TimeTz,        12);
+BALFB_FORMATUTIL_SIMPLE_SIZE(bsl::string,         FormatUtil::k_OFFSET_SIZE);
+
+#undef BALFB_FORMATUTIL_SIMPLE_SIZE
+
+                        // ============================
+                        // struct FormatUtil_InlineSize
+                        // ============================
+
+/// This component-private meta-function provides a member `value` that is
+/// the size of the slot of the (template parameter) `TYPE` having the
+/// (template parameter) `CATEGORY`.  Values of the categories for which it is
+/// not specialized (arrays, sequences, choices, and nullable values) are
+/// held out of line.
+template <class TYPE, class CATEGORY>
+struct FormatUtil_InlineSize {
+
+    enum { value = FormatUtil::k_OFFSET_SIZE };
+};
+
+template <class TYPE>
+struct FormatUtil_InlineSize<TYPE, bdlat_TypeCategory::Simple> {
+
+    enum { value = FormatUtil_SimpleSize<TYPE>::value };
+};
+
+template <class TYPE>
+struct FormatUtil_InlineSize<TYPE, bdlat_TypeCategory::Enumeration> {
+
+    enum { value = 4 };
+};
+
+template <class TYPE>
+struct FormatUtil_InlineSize<TYPE, bdlat_TypeCategory::CustomizedType> {
+
+    typedef typename bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type
+                                                                      BaseType;
+
+    enum {
+        value = FormatUtil_InlineSize<
+                  BaseType,
+                  typename bdlat_TypeCategory::Select<BaseType>::Type>::value
+    };
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct FormatUtil
+                              // -----------------
+
+// CLASS METHODS
+
+                        // Unsigned Integers
+
+inline
+void FormatUtil::putUint16(char *buffer, unsigned short value)
+{
+    value = BSLS_BYTEORDER_HOST_U16_TO_LE(value);
+    bsl::memcpy(buffer, &value, sizeof value);
+}
+
+inline
+void FormatUtil::putUint32(char *buffer, unsigned int value)
+{
+    value = BSLS_BYTEORDER_HOST_U32_TO_LE(value);
+    bsl::memcpy(buffer, &value, sizeof value);
+}
+
+inline
+unsigned short FormatUtil::getUint16(const char *buffer)
+{
+    unsigned short value;
+    bsl::memcpy(&value, buffer, sizeof value);
+    return BSLS_BYTEORDER_LE_U16_TO_HOST(value);
+}
+
+inline
+unsigned int FormatUtil::getUint32(const char *buffer)
+{
+    unsigned int value;
+    bsl::memcpy(&value, buffer, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+                        // Scalar Values
+
+inline
+void FormatUtil::putValue(char *buffer, bool value)
+{
+    *buffer = value ? 1 : 0;
+}
+
+inline
+void FormatUtil::putValue(char *buffer, char value)
+{
+    *buffer = value;
+}
+
+inline
+void FormatUtil::putValue(char *buffer, signed char value)
+{
+    *buffer = static_cast<char>(value);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, unsigned char value)
+{
+    *buffer = static_cast<char>(value);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, short value)
+{
+    putUint16(buffer, static_cast<unsigned short>(value));
+}
+
+inline
+void FormatUtil::putValue(char *buffer, unsigned short value)
+{
+    putUint16(buffer, value);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, int value)
+{
+    putUint32(buffer, static_cast<unsigned int>(value));
+}
+
+inline
+void FormatUtil::putValue(char *buffer, unsigned int value)
+{
+    putUint32(buffer, value);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, bsls::Types::Int64 value)
+{
+    putValue(buffer, static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+void FormatUtil::putValue(char *buffer, bsls::Types::Uint64 value)
+{
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    bsl::memcpy(buffer, &value, sizeof value);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, float value)
+{
+    unsigned int bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    putUint32(buffer, bits);
+}
+
+inline
+void FormatUtil::putValue(char *buffer, double value)
+{
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    putValue(buffer, bits);
+}
+
+inline
+int FormatUtil::getValue(bool *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    if (0 != *buffer && 1 != *buffer) {
+        return -1;                                                    // RETURN
+    }
+    *value = 1 == *buffer;
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(char *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = *buffer;
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(signed char *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = static_cast<signed char>(*buffer);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(unsigned char *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = static_cast<unsigned char>(*buffer);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(short *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = static_cast<short>(getUint16(buffer));
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(unsigned short *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = getUint16(buffer);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(int *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = static_cast<int>(getUint32(buffer));
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(unsigned int *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    *value = getUint32(buffer);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(bsls::Types::Int64 *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bsls::Types::Uint64 bits;
+    getValue(&bits, buffer);
+    *value = static_cast<bsls::Types::Int64>(bits);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(bsls::Types::Uint64 *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, buffer, sizeof bits);
+    *value = BSLS_BYTEORDER_LE_U64_TO_HOST(bits);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(float *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    const unsigned int bits = getUint32(buffer);
+    bsl::memcpy(value, &bits, sizeof bits);
+    return 0;
+}
+
+inline
+int FormatUtil::getValue(double *value, const char *buffer)
+{
+    BSLS_ASSERT(value);
+
+    bsls::Types::Uint64 bits;
+    getValue(&bits, buffer);
+    bsl::memcpy(value, &bits, sizeof bits);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int FormatUtil::getValueAt(TYPE        *value,
+                           const char  *buffer,
+                           bsl::size_t  length,
+                           bsl::size_t  slot)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length < slot || length - slot < FormatUtil_SimpleSize<TYPE>::value) {
+        return -1;                                                    // RETURN
+    }
+    return getValue(value, buffer + slot);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
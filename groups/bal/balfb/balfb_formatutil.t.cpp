@@ -0,0 +1,912 @@
+// balfb_formatutil.t.cpp                                             -*-C++-*-
+#include <balfb_formatutil.h>
+
+#include <s_baltst_customint.h>
+#include <s_baltst_customizedstring.h>
+#include <s_baltst_myenumeration.h>
+#include <s_baltst_mychoice.h>
+#include <s_baltst_mysequence.h>
+
+#include <bdlb_nullablevalue.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility defining the primitive constructs of
+// the flat format.  The functions writing and reading unsigned integers are
+// tested first, by checking the bytes they produce, since every other
+// function is built on them.  The functions writing and reading scalar values
+// are then tested by round trips over tables of values, together with the
+// rejection of bytes that do not represent a valid value.  Finally, the
+// navigation functions are tested on small hand-made buffers, including
+// buffers that are truncated or whose offsets refer outside of the buffer.
+//
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] void putUint16(char *buffer, unsigned short value);
+// [ 1] void putUint32(char *buffer, unsigned int value);
+// [ 1] unsigned short getUint16(const char *buffer);
+// [ 1] unsigned int getUint32(const char *buffer);
+// [ 2] void putValue(char *buffer, TYPE value);
+// [ 2] int getValue(TYPE *value, const char *buffer);
+// [ 3] int getValueAt(TYPE *, const char *, size_t, size_t);
+// [ 4] int followOffset(size_t *, const char *, size_t, size_t);
+// [ 5] int lookupAttribute(size_t *, const char *, size_t, size_t, int);
+// [ 6] int getArrayLength(size_t *, const char *, size_t, size_t, ...);
+// [ 6] int getString(const char **, size_t *, const char *, size_t, ...);
+// ----------------------------------------------------------------------------
+// [ 7] InlineSize<TYPE>::value
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balfb::FormatUtil  Util;
+typedef bsls::Types::Int64 Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Write the specified `value` to a buffer using `putValue`, read it back
+/// using `getValue`, and return `true` if the value read is equal to
+/// `value`, and the number of bytes written is the size of the slot of the
+/// (template parameter) `TYPE`.
+template <class TYPE>
+bool roundTrip(const TYPE& value)
+{
+    enum { k_SIZE = Util::InlineSize<TYPE>::value };
+
+    // Fill the buffer with a marker so that writes past the slot are caught.
+
+    char buffer[k_SIZE + 1];
+    bsl::memset(buffer, 0x5A, sizeof buffer);
+
+    Util::putValue(buffer, value);
+    if (0x5A != buffer[k_SIZE]) {
+        return false;                                                 // RETURN
+    }
+
+    TYPE result;
+    if (0 != Util::getValue(&result, buffer)) {
+        return false;                                                 // RETURN
+    }
+    return value == result;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout  << endl
+                           << "USAGE EXAMPLE" << endl
+                           << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading an Attribute of a Table
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding the encoding of a sequence having an `int`
+// attribute with the id 1.  The encoding starts with the slot of the
+// sequence, an offset to its table, which has a vtable of 2 entries (for the
+// ids 0 and 1, the first of which is unused) followed by the slot of the
+// attribute:
+// ```
+    const char buffer[] = {
+        4, 0, 0, 0,   // offset to the table
+        2, 0,         // number of vtable entries
+        0, 0,         // slot of the attribute having id 0 (absent)
+        6, 0,         // slot of the attribute having id 1
+        42, 0, 0, 0   // value of the attribute having id 1
+    };
+// ```
+// First, we find the table by following the offset in the slot at the start
+// of the buffer:
+// ```
+    bsl::size_t table;
+    int rc = balfb::FormatUtil::followOffset(&table,
+                                             buffer,
+                                             sizeof buffer,
+                                             0);
+    ASSERT(0 == rc);
+    ASSERT(4 == table);
+// ```
+// Then, we find the slot of the attribute having the id 1:
+// ```
+    bsl::size_t slot;
+    rc = balfb::FormatUtil::lookupAttribute(&slot,
+                                            buffer,
+                                            sizeof buffer,
+                                            table,
+                                            1);
+    ASSERT(0  == rc);
+    ASSERT(10 == slot);
+// ```
+// Finally, we load the value of the attribute from its slot:
+// ```
+    int value;
+    rc = balfb::FormatUtil::getValueAt(&value, buffer, sizeof buffer, slot);
+    ASSERT(0  == rc);
+    ASSERT(42 == value);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `InlineSize`
+        //
+        // Concerns:
+        // 1. The slot of a simple type has the size given in the table in the
+        //    component documentation.
+        //
+        // 2. The slot of an enumeration has 4 bytes.
+        //
+        // 3. The slot of a customized type is that of its base type.
+        //
+        // 4. The slot of a string, array, sequence, choice, or nullable value
+        //    is an offset.
+        //
+        // Plan:
+        // 1. Check `InlineSize<TYPE>::value` for a type of each category.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   InlineSize<TYPE>::value
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `InlineSize`" << endl
+                          << "====================" << endl;
+
+        const int OFFSET = Util::k_OFFSET_SIZE;
+
+        ASSERT( 1 == Util::InlineSize<bool>::value);
+        ASSERT( 1 == Util::InlineSize<char>::value);
+        ASSERT( 1 == Util::InlineSize<unsigned char>::value);
+        ASSERT( 2 == Util::InlineSize<short>::value);
+        ASSERT( 4 == Util::InlineSize<int>::value);
+        ASSERT( 4 == Util::InlineSize<float>::value);
+        ASSERT( 8 == Util::InlineSize<Int64>::value);
+        ASSERT( 8 == Util::InlineSize<Uint64>::value);
+        ASSERT( 8 == Util::InlineSize<double>::value);
+        ASSERT( 8 == Util::InlineSize<bdldfp::Decimal64>::value);
+        ASSERT( 4 == Util::InlineSize<bdlt::Date>::value);
+        ASSERT( 8 == Util::InlineSize<bdlt::DateTz>::value);
+        ASSERT(12 == Util::InlineSize<bdlt::Datetime>::value);
+        ASSERT(16 == Util::InlineSize<bdlt::DatetimeTz>::value);
+        ASSERT( 8 == Util::InlineSize<bdlt::Time>::value);
+        ASSERT(12 == Util::InlineSize<bdlt::TimeTz>::value);
+
+        ASSERT( 4 == Util::InlineSize<s_baltst::MyEnumeration::Value>::value);
+
+        ASSERT( 4 == Util::InlineSize<s_baltst::CustomInt>::value);
+        ASSERT(OFFSET == Util::InlineSize<s_baltst::CustomizedString>::value);
+
+        ASSERT(OFFSET == Util::InlineSize<bsl::string>::value);
+        ASSERT(OFFSET == Util::InlineSize<bsl::vector<char> >::value);
+        ASSERT(OFFSET == Util::InlineSize<bsl::vector<int> >::value);
+        ASSERT(OFFSET == Util::InlineSize<s_baltst::MySequence>::value);
+        ASSERT(OFFSET == Util::InlineSize<s_baltst::MyChoice>::value);
+        ASSERT(OFFSET == Util::InlineSize<bdlb::NullableValue<int> >::value);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING `getArrayLength` AND `getString`
+        //
+        // Concerns:
+        // 1. `getArrayLength` loads the number of elements of a body that
+        //    holds that many elements of the specified size.
+        //
+        // 2. `getArrayLength` fails if the count, or the elements, do not fit
+        //    in the buffer.
+        //
+        // 3. `getString` loads the address and length of the data of a string
+        //    body, and the address refers into the buffer.
+        //
+        // 4. `getString` fails if the length, data, or null terminator do not
+        //    fit in the buffer, or if the byte after the data is not null.
+        //
+        // 5. An empty array or string is supported.
+        //
+        // Plan:
+        // 1. Build bodies by hand in a buffer, and call the functions with
+        //    the full buffer, and with every shorter prefix of it.  (C-1..5)
+        //
+        // Testing:
+        //   int getArrayLength(size_t *, const char *, size_t, size_t, ...);
+        //   int getString(const char **, size_t *, const char *, size_t, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TESTING `getArrayLength` AND `getString`" << endl
+                 << "========================================" << endl;
+
+        if (verbose) cout << "\nTesting `getArrayLength`." << endl;
+        {
+            // 2 bytes of padding, then 3 elements of 2 bytes.
+
+            const char BUFFER[] = { 'x', 'x', 3, 0, 0, 0, 1, 0, 2, 0, 3, 0 };
+            const bsl::size_t LENGTH = sizeof BUFFER;
+
+            for (bsl::size_t len = 0; len <= LENGTH; ++len) {
+                bsl::size_t n = 99;
+                const int   rc = Util::getArrayLength(&n, BUFFER, len, 2, 2);
+                if (LENGTH == len) {
+                    ASSERTV(len, rc, 0 == rc);
+                    ASSERTV(len, n, 3 == n);
+                }
+                else {
+                    ASSERTV(len, rc, 0 != rc);
+                    ASSERTV(len, n, 99 == n);
+                }
+            }
+
+            // Elements larger than the remaining bytes.
+
+            bsl::size_t n;
+            ASSERT(0 != Util::getArrayLength(&n, BUFFER, LENGTH, 2, 3));
+
+            // A count too large for the buffer, even if elements have 1 byte.
+
+            char tooLong[] = { -1, -1, -1, -1, 0 };
+            ASSERT(0 != Util::getArrayLength(&n,
+                                             tooLong,
+                                             sizeof tooLong,
+                                             0,
+                                             1));
+
+            // An empty array.
+
+            const char EMPTY[] = { 0, 0, 0, 0 };
+            ASSERT(0 == Util::getArrayLength(&n, EMPTY, sizeof EMPTY, 0, 8));
+            ASSERT(0 == n);
+
+            // A position past the end.
+
+            ASSERT(0 != Util::getArrayLength(&n, EMPTY, sizeof EMPTY, 5, 1));
+        }
+
+        if (verbose) cout << "\nTesting `getString`." << endl;
+        {
+            const char BUFFER[] = { 'x', 3, 0, 0, 0, 'a', 'b', 'c', 0 };
+            const bsl::size_t LENGTH = sizeof BUFFER;
+
+            for (bsl::size_t len = 0; len <= LENGTH; ++len) {
+                const char  *data    = 0;
+                bsl::size_t  dataLen = 99;
+                const int    rc      = Util::getString(&data,
+                                                       &dataLen,
+                                                       BUFFER,
+                                                       len,
+                                                       1);
+                if (LENGTH == len) {
+                    ASSERTV(len, rc, 0 == rc);
+                    ASSERTV(len, BUFFER + 5 == data);
+                    ASSERTV(len, dataLen, 3 == dataLen);
+                }
+                else {
+                    ASSERTV(len, rc, 0 != rc);
+                    ASSERTV(len, 0 == data);
+                    ASSERTV(len, dataLen, 99 == dataLen);
+                }
+            }
+
+            // A missing null terminator.
+
+            char unterminated[] = { 1, 0, 0, 0, 'a', 'b' };
+
+            const char  *data;
+            bsl::size_t  dataLen;
+            ASSERT(0 != Util::getString(&data,
+                                        &dataLen,
+                                        unterminated,
+                                        sizeof unterminated,
+                                        0));
+
+            unterminated[5] = 0;
+            ASSERT(0 == Util::getString(&data,
+                                        &dataLen,
+                                        unterminated,
+                                        sizeof unterminated,
+                                        0));
+            ASSERT(1 == dataLen);
+            ASSERT('a' == *data);
+
+            // An empty string.
+
+            const char EMPTY[] = { 0, 0, 0, 0, 0 };
+            ASSERT(0 == Util::getString(&data,
+                                        &dataLen,
+                                        EMPTY,
+                                        sizeof EMPTY,
+                                        0));
+            ASSERT(0 == dataLen);
+            ASSERT('\0' == *data);
+
+            // A length too large for the buffer.
+
+            const char TOO_LONG[] = { -1, -1, -1, -1, 0 };
+            ASSERT(0 != Util::getString(&data,
+                                        &dataLen,
+                                        TOO_LONG,
+                                        sizeof TOO_LONG,
+                                        0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `lookupAttribute`
+        //
+        // Concerns:
+        // 1. The slot of an attribute recorded in the vtable is loaded as the
+        //    position of the table plus the entry.
+        //
+        // 2. An entry of 0, or an id not less than the number of entries,
+        //    results in a slot of 0 (i.e., an absent attribute), so that a
+        //    table encoded for an older schema can be read with a newer one.
+        //
+        // 3. The function fails if the vtable, or an entry, does not fit in
+        //    the buffer.
+        //
+        // Plan:
+        // 1. Build a table by hand and look up every id in `[0 .. 4]`, with
+        //    the full buffer and with every shorter prefix of it.  (C-1..3)
+        //
+        // Testing:
+        //   int lookupAttribute(size_t *, const char *, size_t, size_t, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `lookupAttribute`" << endl
+                          << "=========================" << endl;
+
+        // A table at position 1 with 3 entries: id 0 at 8, id 1 absent, id 2
+        // at 9.
+
+        const char BUFFER[] = { 'x', 3, 0, 8, 0, 0, 0, 9, 0, 7, 7 };
+        const bsl::size_t LENGTH = sizeof BUFFER;
+        const bsl::size_t TABLE  = 1;
+
+        static const struct {
+            int         d_line;
+            int         d_id;
+            bsl::size_t d_slot;  // expected slot
+        } DATA[] = {
+            //LINE  ID  SLOT
+            //----  --  ----
+            { L_,    0,    9 },
+            { L_,    1,    0 },
+            { L_,    2,   10 },
+            { L_,    3,    0 },
+            { L_,    4,    0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const int         ID   = DATA[ti].d_id;
+            const bsl::size_t SLOT = DATA[ti].d_slot;
+
+            bsl::size_t slot = 99;
+            int         rc   = Util::lookupAttribute(&slot,
+                                                     BUFFER,
+                                                     LENGTH,
+                                                     TABLE,
+                                                     ID);
+            ASSERTV(LINE, rc, 0 == rc);
+            ASSERTV(LINE, slot, SLOT == slot);
+
+            // The count must fit in the buffer, and, for an id within the
+            // vtable, so must the vtable and the slot of a present attribute.
+
+            for (bsl::size_t len = 0; len < LENGTH; ++len) {
+                const bool SUCCESS = ID < 3
+                                   ? 9 <= len && (0 == SLOT || SLOT < len)
+                                   : 3 <= len;
+
+                slot = 99;
+                rc   = Util::lookupAttribute(&slot, BUFFER, len, TABLE, ID);
+                if (SUCCESS) {
+                    ASSERTV(LINE, len, rc, 0 == rc);
+                    ASSERTV(LINE, len, slot, SLOT == slot);
+                }
+                else {
+                    ASSERTV(LINE, len, rc, 0 != rc);
+                }
+            }
+        }
+
+        // An id beyond the vtable needs only the count.
+
+        bsl::size_t slot = 99;
+        ASSERT(0 == Util::lookupAttribute(&slot, BUFFER, 3, TABLE, 3));
+        ASSERT(0 == slot);
+
+        // A table position past the end.
+
+        ASSERT(0 != Util::lookupAttribute(&slot, BUFFER, LENGTH, LENGTH, 0));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::lookupAttribute(&slot, BUFFER, LENGTH, 1, 0));
+            ASSERT_FAIL(Util::lookupAttribute(&slot, BUFFER, LENGTH, 1, -1));
+            ASSERT_FAIL(Util::lookupAttribute(0, BUFFER, LENGTH, 1, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `followOffset`
+        //
+        // Concerns:
+        // 1. A non-zero offset is added to the position of the slot.
+        //
+        // 2. An offset of 0 results in a position of 0 (i.e., a null value).
+        //
+        // 3. The function fails if the slot does not fit in the buffer, or if
+        //    the offset refers to the end of the buffer, or beyond it.
+        //
+        // Plan:
+        // 1. Build slots by hand and follow them with the full buffer, and
+        //    with every shorter prefix of it.  (C-1..3)
+        //
+        // Testing:
+        //   int followOffset(size_t *, const char *, size_t, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `followOffset`" << endl
+                          << "======================" << endl;
+
+        // A slot at 1 with an offset of 5 (to position 6), and a null slot at
+        // 5.
+
+        const char BUFFER[] = { 'x', 5, 0, 0, 0, 0, 0, 0, 0, 'y' };
+        const bsl::size_t LENGTH = sizeof BUFFER;
+
+        for (bsl::size_t len = 0; len <= LENGTH; ++len) {
+            bsl::size_t position = 99;
+            const int   rc       = Util::followOffset(&position,
+                                                      BUFFER,
+                                                      len,
+                                                      1);
+            if (7 <= len) {
+                ASSERTV(len, rc, 0 == rc);
+                ASSERTV(len, position, 6 == position);
+            }
+            else {
+                ASSERTV(len, rc, 0 != rc);
+                ASSERTV(len, position, 99 == position);
+            }
+
+            position = 99;
+            const int rc2 = Util::followOffset(&position, BUFFER, len, 5);
+            if (9 <= len) {
+                ASSERTV(len, rc2, 0 == rc2);
+                ASSERTV(len, position, 0 == position);
+            }
+            else {
+                ASSERTV(len, rc2, 0 != rc2);
+            }
+        }
+
+        // An offset that would wrap around.
+
+        const char WRAP[] = { -1, -1, -1, -1, 0, 0 };
+        bsl::size_t position;
+        ASSERT(0 != Util::followOffset(&position, WRAP, sizeof WRAP, 0));
+
+        // A slot position past the end.
+
+        ASSERT(0 != Util::followOffset(&position, BUFFER, LENGTH, LENGTH));
+        const bsl::size_t MAX = bsl::numeric_limits<bsl::size_t>::max();
+        ASSERT(0 != Util::followOffset(&position, BUFFER, LENGTH, MAX));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `getValueAt`
+        //
+        // Concerns:
+        // 1. The value in a slot that fits in the buffer is loaded.
+        //
+        // 2. The function fails, without reading outside of the buffer, if
+        //    the slot does not fit.
+        //
+        // 3. The function fails if the bytes do not represent a valid value.
+        //
+        // Plan:
+        // 1. Write values at the end of a buffer, and read them with the full
+        //    buffer and with every shorter prefix.  (C-1..2)
+        //
+        // 2. Read an invalid date.  (C-3)
+        //
+        // Testing:
+        //   int getValueAt(TYPE *, const char *, size_t, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `getValueAt`" << endl
+                          << "====================" << endl;
+
+        char buffer[16];
+        bsl::memset(buffer, 0, sizeof buffer);
+
+        Util::putValue(buffer + 8, static_cast<Int64>(-12345678901LL));
+
+        for (bsl::size_t len = 0; len <= sizeof buffer; ++len) {
+            Int64     value = 7;
+            const int rc    = Util::getValueAt(&value, buffer, len, 8);
+            if (16 == len) {
+                ASSERTV(len, rc, 0 == rc);
+                ASSERTV(len, value, -12345678901LL == value);
+            }
+            else {
+                ASSERTV(len, rc, 0 != rc);
+                ASSERTV(len, value, 7 == value);
+            }
+        }
+
+        int value;
+        ASSERT(0 == Util::getValueAt(&value, buffer, sizeof buffer, 12));
+        ASSERT(0 != Util::getValueAt(&value, buffer, sizeof buffer, 13));
+        ASSERT(0 != Util::getValueAt(&value, buffer, sizeof buffer, 17));
+        ASSERT(0 != Util::getValueAt(
+                                     &value,
+                                     buffer,
+                                     sizeof buffer,
+                                     bsl::numeric_limits<bsl::size_t>::max()));
+
+        // Month 13.
+
+        const char BAD_DATE[] = { 0x07, 0x07, 13, 1 };
+        bdlt::Date date;
+        ASSERT(0 != Util::getValueAt(&date, BAD_DATE, sizeof BAD_DATE, 0));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `putValue` AND `getValue`
+        //
+        // Concerns:
+        // 1. Each value read by `getValue` is equal to the value written by
+        //    `putValue`.
+        //
+        // 2. `putValue` writes exactly the bytes of the slot of the type.
+        //
+        // 3. Integers are little-endian.
+        //
+        // 4. `getValue` fails on a `bool` other than 0 or 1, and on dates and
+        //    times that are not valid.
+        //
+        // 5. The default `bdlt::Time` (24:00) is supported.
+        //
+        // Plan:
+        // 1. Round trip values, including boundary values, of each supported
+        //    type.  (C-1..2, 5)
+        //
+        // 2. Check the bytes written for a few values.  (C-3)
+        //
+        // 3. Read hand-made invalid slots.  (C-4)
+        //
+        // Testing:
+        //   void putValue(char *buffer, TYPE value);
+        //   int getValue(TYPE *value, const char *buffer);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `putValue` AND `getValue`" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\nTesting round trips." << endl;
+        {
+            ASSERT(roundTrip(true));
+            ASSERT(roundTrip(false));
+            ASSERT(roundTrip('a'));
+            ASSERT(roundTrip(static_cast<signed char>(-128)));
+            ASSERT(roundTrip(static_cast<unsigned char>(255)));
+            ASSERT(roundTrip(static_cast<short>(-32768)));
+            ASSERT(roundTrip(static_cast<unsigned short>(65535)));
+            ASSERT(roundTrip(bsl::numeric_limits<int>::min()));
+            ASSERT(roundTrip(bsl::numeric_limits<int>::max()));
+            ASSERT(roundTrip(bsl::numeric_limits<unsigned int>::max()));
+            ASSERT(roundTrip(bsl::numeric_limits<Int64>::min()));
+            ASSERT(roundTrip(bsl::numeric_limits<Uint64>::max()));
+            ASSERT(roundTrip(1.5f));
+            ASSERT(roundTrip(-0.0f));
+            ASSERT(roundTrip(3.141592653589793));
+            ASSERT(roundTrip(bsl::numeric_limits<double>::max()));
+            ASSERT(roundTrip(bsl::numeric_limits<double>::infinity()));
+            ASSERT(roundTrip(BDLDFP_DECIMAL_DD(1.25)));
+            ASSERT(roundTrip(BDLDFP_DECIMAL_DD(-9999999999999999e369)));
+
+            ASSERT(roundTrip(bdlt::Date(1, 1, 1)));
+            ASSERT(roundTrip(bdlt::Date(2024, 2, 29)));
+            ASSERT(roundTrip(bdlt::Date(9999, 12, 31)));
+            ASSERT(roundTrip(bdlt::DateTz(bdlt::Date(2024, 2, 29), -1439)));
+            ASSERT(roundTrip(bdlt::Time()));
+            ASSERT(roundTrip(bdlt::Time(0, 0)));
+            ASSERT(roundTrip(bdlt::Time(23, 59, 59, 999, 999)));
+            ASSERT(roundTrip(bdlt::TimeTz(bdlt::Time(12, 34, 56, 7, 8),
+                                          1439)));
+            ASSERT(roundTrip(bdlt::Datetime()));
+            ASSERT(roundTrip(bdlt::Datetime(2024, 2, 29, 23, 59, 59, 1, 2)));
+            ASSERT(roundTrip(
+                        bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999)));
+            ASSERT(roundTrip(bdlt::DatetimeTz(
+                                      bdlt::Datetime(1, 1, 1, 0, 0, 0, 0, 1),
+                                      -300)));
+        }
+
+        if (verbose) cout << "\nTesting byte order." << endl;
+        {
+            char buffer[8];
+
+            Util::putValue(buffer, static_cast<short>(0x0102));
+            ASSERT(0x02 == buffer[0] && 0x01 == buffer[1]);
+
+            Util::putValue(buffer, 0x01020304);
+            ASSERT(0x04 == buffer[0] && 0x03 == buffer[1]);
+            ASSERT(0x02 == buffer[2] && 0x01 == buffer[3]);
+
+            Util::putValue(buffer, static_cast<Int64>(0x0102030405060708LL));
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, 8 - i == buffer[i]);
+            }
+
+            Util::putValue(buffer, bdlt::Date(2024, 3, 15));
+            ASSERT(0x07 == static_cast<unsigned char>(buffer[1]));
+            ASSERT(0xE8 == static_cast<unsigned char>(buffer[0]));
+            ASSERT(3    == buffer[2]);
+            ASSERT(15   == buffer[3]);
+
+            Util::putValue(buffer, bdlt::Time(0, 0, 1));
+            Int64 microseconds;
+            Util::getValue(&microseconds, buffer);
+            ASSERT(1000000 == microseconds);
+        }
+
+        if (verbose) cout << "\nTesting invalid values." << endl;
+        {
+            char buffer[16];
+            bsl::memset(buffer, 0, sizeof buffer);
+
+            bool b;
+            buffer[0] = 2;
+            ASSERT(0 != Util::getValue(&b, buffer));
+            buffer[0] = 1;
+            ASSERT(0 == Util::getValue(&b, buffer));
+            ASSERT(true == b);
+
+            // Year 0.
+
+            bdlt::Date date;
+            Util::putUint16(buffer, 0);
+            buffer[2] = 1;
+            buffer[3] = 1;
+            ASSERT(0 != Util::getValue(&date, buffer));
+
+            // February 30.
+
+            Util::putUint16(buffer, 2024);
+            buffer[2] = 2;
+            buffer[3] = 30;
+            ASSERT(0 != Util::getValue(&date, buffer));
+
+            // An offset of a day.
+
+            bdlt::DateTz dateTz;
+            buffer[3] = 1;
+            Util::putValue(buffer + 4, 1440);
+            ASSERT(0 != Util::getValue(&dateTz, buffer));
+            Util::putValue(buffer + 4, 1439);
+            ASSERT(0 == Util::getValue(&dateTz, buffer));
+
+            // Times outside of `[0 .. 24:00]`.
+
+            bdlt::Time time;
+            Util::putValue(buffer, static_cast<Int64>(-1));
+            ASSERT(0 != Util::getValue(&time, buffer));
+            Util::putValue(buffer, static_cast<Int64>(86400000001LL));
+            ASSERT(0 != Util::getValue(&time, buffer));
+            Util::putValue(buffer, static_cast<Int64>(86400000000LL));
+            ASSERT(0 == Util::getValue(&time, buffer));
+            ASSERT(bdlt::Time() == time);
+
+            // A datetime whose time is past 24:00.
+
+            bdlt::Datetime datetime;
+            Util::putValue(buffer, bdlt::Date(2024, 1, 1));
+            Util::putValue(buffer + 4, static_cast<Int64>(86400000001LL));
+            ASSERT(0 != Util::getValue(&datetime, buffer));
+            Util::putValue(buffer + 4, static_cast<Int64>(86399999999LL));
+            ASSERT(0 == Util::getValue(&datetime, buffer));
+            ASSERT(bdlt::Datetime(2024, 1, 1, 23, 59, 59, 999, 999)
+                                                                  == datetime);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING UNSIGNED INTEGERS
+        //
+        // Concerns:
+        // 1. `putUint16` and `putUint32` write their argument in
+        //    little-endian byte order, and write no other byte.
+        //
+        // 2. `getUint16` and `getUint32` read what was written.
+        //
+        // 3. The functions do not require alignment.
+        //
+        // Plan:
+        // 1. Write and read values at every offset in a buffer, and check the
+        //    bytes written.  (C-1..3)
+        //
+        // Testing:
+        //   void putUint16(char *buffer, unsigned short value);
+        //   void putUint32(char *buffer, unsigned int value);
+        //   unsigned short getUint16(const char *buffer);
+        //   unsigned int getUint32(const char *buffer);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING UNSIGNED INTEGERS" << endl
+                          << "=========================" << endl;
+
+        for (int offset = 0; offset < 8; ++offset) {
+            char buffer[16];
+            bsl::memset(buffer, 0x5A, sizeof buffer);
+
+            Util::putUint16(buffer + offset, 0xABCD);
+            ASSERTV(offset, 0xCD == (unsigned char)buffer[offset]);
+            ASSERTV(offset, 0xAB == (unsigned char)buffer[offset + 1]);
+            ASSERTV(offset, 0x5A == buffer[offset + 2]);
+            ASSERTV(offset, 0xABCD == Util::getUint16(buffer + offset));
+
+            bsl::memset(buffer, 0x5A, sizeof buffer);
+
+            Util::putUint32(buffer + offset, 0x89ABCDEFu);
+            ASSERTV(offset, 0xEF == (unsigned char)buffer[offset]);
+            ASSERTV(offset, 0xCD == (unsigned char)buffer[offset + 1]);
+            ASSERTV(offset, 0xAB == (unsigned char)buffer[offset + 2]);
+            ASSERTV(offset, 0x89 == (unsigned char)buffer[offset + 3]);
+            ASSERTV(offset, 0x5A == buffer[offset + 4]);
+            ASSERTV(offset, 0x89ABCDEFu == Util::getUint32(buffer + offset));
+
+            if (0 < offset) {
+                ASSERTV(offset, 0x5A == buffer[offset - 1]);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,170 @@
+// balfb_view.cpp                                                     -*-C++-*-
+#include <balfb_view.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balfb_view_cpp,"$Id$ $CSID$")
+
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+                              // ---------------
+                              // class TableView
+                              // ---------------
+
+// MANIPULATORS
+int TableView::resetSlot(const char  *buffer,
+                         bsl::size_t  length,
+                         bsl::size_t  slot)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    // Looking up an attribute checks that the vtable is within the buffer.
+
+    bsl::size_t table;
+    bsl::size_t attributeSlot;
+    if (0 != FormatUtil::followOffset(&table, buffer, length, slot)
+     || 0 == table
+     || 0 != FormatUtil::lookupAttribute(&attributeSlot,
+                                         buffer,
+                                         length,
+                                         table,
+                                         0)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_buffer_p = buffer;
+    d_length   = length;
+    d_table    = table;
+    return 0;
+}
+
+// ACCESSORS
+int TableView::lookupAttribute(bsl::size_t *slot, int id) const
+{
+    BSLS_ASSERT(slot);
+
+    if (0 == d_table) {
+        return -1;                                                    // RETURN
+    }
+    if (id < 0) {
+        return 1;                                                     // RETURN
+    }
+
+    if (0 != FormatUtil::lookupAttribute(slot,
+                                         d_buffer_p,
+                                         d_length,
+                                         d_table,
+                                         id)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 == *slot ? 1 : 0;
+}
+
+                              // ---------------
+                              // class ArrayView
+                              // ---------------
+
+// MANIPULATORS
+int ArrayView::resetSlot(const char  *buffer,
+                         bsl::size_t  length,
+                         bsl::size_t  slot)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    // Each slot is at least one byte, so checking the number of elements
+    // against an element size of 1 bounds it by the size of the buffer.  The
+    // slot of each element is checked when it is read.
+
+    bsl::size_t position;
+    bsl::size_t numElements;
+    if (0 != FormatUtil::followOffset(&position, buffer, length, slot)
+     || 0 == position
+     || 0 != FormatUtil::getArrayLength(&numElements,
+                                        buffer,
+                                        length,
+                                        position,
+                                        1)
+     || static_cast<bsl::size_t>(INT_MAX) < numElements) {
+        return -1;                                                    // RETURN
+    }
+
+    d_buffer_p    = buffer;
+    d_length      = length;
+    d_elements    = position + FormatUtil::k_LENGTH_SIZE;
+    d_numElements = numElements;
+    return 0;
+}
+
+                              // ----------------
+                              // class ChoiceView
+                              // ----------------
+
+// MANIPULATORS
+int ChoiceView::resetSlot(const char  *buffer,
+                          bsl::size_t  length,
+                          bsl::size_t  slot)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    bsl::size_t position;
+    int         selectionId;
+    if (0 != FormatUtil::followOffset(&position, buffer, length, slot)
+     || 0 == position
+     || 0 != FormatUtil::getValueAt(&selectionId, buffer, length, position)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_buffer_p    = buffer;
+    d_length      = length;
+    d_selection   = position + FormatUtil::k_SELECTION_ID_SIZE;
+    d_selectionId = selectionId;
+    return 0;
+}
+
+                              // ----------------
+                              // struct View_Util
+                              // ----------------
+
+// CLASS METHODS
+int View_Util::getValue(bsl::string_view *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot)
+{
+    bsl::size_t  position;
+    const char  *data;
+    bsl::size_t  dataLength;
+    if (0 != FormatUtil::followOffset(&position, buffer, length, slot)
+     || 0 == position
+     || 0 != FormatUtil::getString(&data,
+                                   &dataLength,
+                                   buffer,
+                                   length,
+                                   position)) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = bsl::string_view(data, dataLength);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,529 @@
+// balfb_view.h                                                       -*-C++-*-
+#ifndef INCLUDED_BALFB_VIEW
+#define INCLUDED_BALFB_VIEW
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide in-place, random-access views of flat-format encodings.
+//
+//@CLASSES:
+//  balfb::TableView: view of an encoded sequence
+//  balfb::ArrayView: view of an encoded array
+//  balfb::ChoiceView: view of an encoded choice
+//
+//@SEE_ALSO: balfb_encoder, balfb_decoderutil, balfb_formatutil
+//
+//@DESCRIPTION: This component provides three classes, `balfb::TableView`,
+// `balfb::ArrayView`, and `balfb::ChoiceView`, that refer to an encoded
+// sequence, array, and choice, respectively, within a buffer holding an
+// encoding in the "flat" binary format described in `balfb_formatutil` (as
+// produced by `balfb::Encoder`).  A view reads the parts of the value it
+// refers to directly from the buffer, without decoding the rest of the
+// encoding and without allocating memory, so that reading one attribute of an
+// encoded object takes time independent of the size of the object.  A view
+// does not own the buffer, which must remain valid, and unmodified, while the
+// view is used.
+//
+// The accessors of the views take the type of the value to be read as a
+// template parameter, which must be the type of the corresponding value in
+// the encoded object (or a type having the same slot, e.g., `int` for an
+// enumeration), or one of the following:
+//
+// * `bsl::string_view`, for a `bsl::string` or `bsl::vector<char>` value, in
+//   which case the result refers to the data in the buffer (which is followed
+//   by a null byte).
+// * `balfb::TableView`, `balfb::ArrayView`, or `balfb::ChoiceView`, for a
+//   sequence, array, or choice value, respectively, in which case the result
+//   refers to the value in the buffer.
+//
+// Any other type is decoded from the buffer using `balfb::DecoderUtil`.  The
+// value of a non-null nullable attribute of a sequence is read as a value of
+// its underlying type.
+//
+// A view checks that every byte it reads is within the buffer, so reading a
+// malformed (or malicious) encoding fails, rather than having undefined
+// behavior.  Each accessor returns 0 on success, a positive value if the
+// requested value is absent (e.g., a null nullable attribute), and a negative
+// value if the encoding is malformed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Cached Object
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache holds many encoded employee records (see
+// {`balfb_encoder`|Example 1: Encoding an Employee Record}), and that we
+// need only the name and age of each.
+//
+// First, we encode a record, as the cache would have done when storing it:
+// ```
+// test::Employee bob;
+// bob.name()                 = "Bob";
+// bob.homeAddress().street() = "Lexington Ave";
+// bob.homeAddress().city()   = "New York City";
+// bob.homeAddress().state()  = "New York";
+// bob.age()                  = 56;
+//
+// bdlsb::MemOutStreamBuf streamBuf;
+// balfb::Encoder         encoder;
+// int                    rc = encoder.encode(&streamBuf, bob);
+// assert(0 == rc);
+//
+// const char        *data   = streamBuf.data();
+// const bsl::size_t  length = streamBuf.length();
+// ```
+// Then, we create a view of the encoded record:
+// ```
+// balfb::TableView employee;
+// rc = employee.reset(data, length);
+// assert(0 == rc);
+// ```
+// Now, we read the name, which refers to the data in the buffer:
+// ```
+// bsl::string_view name;
+// rc = employee.getAttribute(&name, test::Employee::ATTRIBUTE_ID_NAME);
+// assert(0     == rc);
+// assert("Bob" == name);
+// assert(data  <  name.data() && name.data() < data + length);
+// ```
+// Finally, we read the age:
+// ```
+// int age;
+// rc = employee.getAttribute(&age, test::Employee::ATTRIBUTE_ID_AGE);
+// assert(0  == rc);
+// assert(56 == age);
+// ```
+
+#include <balscm_version.h>
+
+#include <balfb_decoderutil.h>
+#include <balfb_formatutil.h>
+
+#include <bdlat_choicefunctions.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace balfb {
+
+class ArrayView;
+class ChoiceView;
+
+                              // ===============
+                              // class TableView
+                              // ===============
+
+/// This class provides a view of an encoded sequence.  A default-constructed
+/// view refers to no sequence, and each of its accessors fails.
+class TableView {
+
+    // DATA
+    const char  *d_buffer_p;  // encoding (held, not owned)
+    bsl::size_t  d_length;    // length of the encoding
+    bsl::size_t  d_table;     // position of the table, or 0 if none
+
+  public:
+    // CREATORS
+
+    /// Create a view that refers to no sequence.
+    TableView();
+
+    // MANIPULATORS
+
+    /// Make this view refer to the sequence encoded in the specified
+    /// `buffer` of the specified `length`.  Return 0 on success, and a
+    /// non-zero value (with no effect) if the buffer does not begin with the
+    /// slot of a sequence.
+    int reset(const char *buffer, bsl::size_t length);
+
+    /// Make this view refer to the sequence whose slot is at the specified
+    /// `slot` position in the specified `buffer` of the specified `length`.
+    /// Return 0 on success, and a non-zero value (with no effect) if `slot`
+    /// does not refer to a table within the buffer.
+    int resetSlot(const char *buffer, bsl::size_t length, bsl::size_t slot);
+
+    // ACCESSORS
+
+    /// Load into the specified `value` the value of the attribute having the
+    /// specified `id`.  Return 0 on success, a positive value if the
+    /// sequence has no such attribute (e.g., it is a null nullable
+    /// attribute), and a negative value if the encoding is malformed.  See
+    /// {Description} for the supported types of `value`.
+    template <class TYPE>
+    int getAttribute(TYPE *value, int id) const;
+
+    /// Return `true` if the sequence has the attribute having the specified
+    /// `id` (i.e., the attribute is a member of the encoded type and not
+    /// null), and `false` otherwise.
+    bool hasAttribute(int id) const;
+
+    /// Load into the specified `slot` the position of the slot of the
+    /// attribute having the specified `id`.  Return 0 on success, a positive
+    /// value if the sequence has no such attribute, and a negative value if
+    /// the encoding is malformed.  Note that `slot` can be supplied to
+    /// `DecoderUtil::decodeSlot`.
+    int lookupAttribute(bsl::size_t *slot, int id) const;
+};
+
+                              // ===============
+                              // class ArrayView
+                              // ===============
+
+/// This class provides a view of an encoded array (other than a
+/// `bsl::vector<char>`, which is read as a `bsl::string_view`).  A
+/// default-constructed view refers to an empty array.
+class ArrayView {
+
+    // DATA
+    const char  *d_buffer_p;     // encoding (held, not owned)
+    bsl::size_t  d_length;       // length of the encoding
+    bsl::size_t  d_elements;     // position of the slot of the first element
+    bsl::size_t  d_numElements;  // number of elements
+
+  public:
+    // CREATORS
+
+    /// Create a view that refers to an empty array.
+    ArrayView();
+
+    // MANIPULATORS
+
+    /// Make this view refer to the array encoded in the specified `buffer`
+    /// of the specified `length`.  Return 0 on success, and a non-zero value
+    /// (with no effect) if the buffer does not begin with the slot of an
+    /// array.
+    int reset(const char *buffer, bsl::size_t length);
+
+    /// Make this view refer to the array whose slot is at the specified
+    /// `slot` position in the specified `buffer` of the specified `length`.
+    /// Return 0 on success, and a non-zero value (with no effect) if `slot`
+    /// does not refer to an array within the buffer.
+    int resetSlot(const char *buffer, bsl::size_t length, bsl::size_t slot);
+
+    // ACCESSORS
+
+    /// Load into the specified `value` the value of the element at the
+    /// specified `index`.  Return 0 on success, and a negative value if the
+    /// encoding is malformed.  The behavior is undefined unless
+    /// `0 <= index < length()`.  See {Description} for the supported types
+    /// of `value`.
+    template <class TYPE>
+    int getElement(TYPE *value, int index) const;
+
+    /// Return the number of elements in the array.
+    int length() const;
+};
+
+                              // ================
+                              // class ChoiceView
+                              // ================
+
+/// This class provides a view of an encoded choice.  A default-constructed
+/// view refers to a choice having no selection.
+class ChoiceView {
+
+    // DATA
+    const char  *d_buffer_p;     // encoding (held, not owned)
+    bsl::size_t  d_length;       // length of the encoding
+    bsl::size_t  d_selection;    // position of the slot of the selection
+    int          d_selectionId;  // id of the selection
+
+  public:
+    // CREATORS
+
+    /// Create a view that refers to a choice having no selection.
+    ChoiceView();
+
+    // MANIPULATORS
+
+    /// Make this view refer to the choice encoded in the specified `buffer`
+    /// of the specified `length`.  Return 0 on success, and a non-zero value
+    /// (with no effect) if the buffer does not begin with the slot of a
+    /// choice.
+    int reset(const char *buffer, bsl::size_t length);
+
+    /// Make this view refer to the choice whose slot is at the specified
+    /// `slot` position in the specified `buffer` of the specified `length`.
+    /// Return 0 on success, and a non-zero value (with no effect) if `slot`
+    /// does not refer to a choice within the buffer.
+    int resetSlot(const char *buffer, bsl::size_t length, bsl::size_t slot);
+
+    // ACCESSORS
+
+    /// Load into the specified `value` the value of the selection.  Return 0
+    /// on success, a positive value if the choice has no selection, and a
+    /// negative value if the encoding is malformed.  See {Description} for
+    /// the supported types of `value`.
+    template <class TYPE>
+    int getSelection(TYPE *value) const;
+
+    /// Return the id of the selection, or
+    /// `bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID` if the choice has no
+    /// selection.
+    int selectionId() const;
+};
+
+                              // ================
+                              // struct View_Util
+                              // ================
+
+/// This component-private `struct` provides a namespace for functions that
+/// read a value of any of the types supported by the views from its slot.
+struct View_Util {
+
+    // TYPES
+
+    /// This meta-function provides a member `value` that is the size of the
+    /// slot read into a value of the (template parameter) `TYPE`.
+    template <class TYPE>
+    struct InlineSize {
+
+        enum { value = FormatUtil::InlineSize<TYPE>::value };
+    };
+
+    // CLASS METHODS
+
+    /// Load into the specified `value` the value whose slot is at the
+    /// specified `slot` position in the specified `buffer` of the specified
+    /// `length`.  Return 0 on success, and a negative value otherwise.
+    template <class TYPE>
+    static int getValue(TYPE        *value,
+                        const char  *buffer,
+                        bsl::size_t  length,
+                        bsl::size_t  slot);
+    static int getValue(bsl::string_view *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot);
+    static int getValue(TableView        *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot);
+    static int getValue(ArrayView        *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot);
+    static int getValue(ChoiceView       *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot);
+};
+
+template <>
+struct View_Util::InlineSize<bsl::string_view> {
+
+    enum { value = FormatUtil::k_OFFSET_SIZE };
+};
+
+template <>
+struct View_Util::InlineSize<TableView> {
+
+    enum { value = FormatUtil::k_OFFSET_SIZE };
+};
+
+template <>
+struct View_Util::InlineSize<ArrayView> {
+
+    enum { value = FormatUtil::k_OFFSET_SIZE };
+};
+
+template <>
+struct View_Util::InlineSize<ChoiceView> {
+
+    enum { value = FormatUtil::k_OFFSET_SIZE };
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class TableView
+                              // ---------------
+
+// CREATORS
+inline
+TableView::TableView()
+: d_buffer_p(0)
+, d_length(0)
+, d_table(0)
+{
+}
+
+// MANIPULATORS
+inline
+int TableView::reset(const char *buffer, bsl::size_t length)
+{
+    return resetSlot(buffer, length, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int TableView::getAttribute(TYPE *value, int id) const
+{
+    BSLS_ASSERT(value);
+
+    bsl::size_t slot;
+    const int   rc = lookupAttribute(&slot, id);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    return View_Util::getValue(value, d_buffer_p, d_length, slot);
+}
+
+inline
+bool TableView::hasAttribute(int id) const
+{
+    bsl::size_t slot;
+    return 0 == lookupAttribute(&slot, id);
+}
+
+                              // ---------------
+                              // class ArrayView
+                              // ---------------
+
+// CREATORS
+inline
+ArrayView::ArrayView()
+: d_buffer_p(0)
+, d_length(0)
+, d_elements(0)
+, d_numElements(0)
+{
+}
+
+// MANIPULATORS
+inline
+int ArrayView::reset(const char *buffer, bsl::size_t length)
+{
+    return resetSlot(buffer, length, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int ArrayView::getElement(TYPE *value, int index) const
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(static_cast<bsl::size_t>(index) < d_numElements);
+
+    const bsl::size_t slot = d_elements
+                           + index * View_Util::InlineSize<TYPE>::value;
+    return View_Util::getValue(value, d_buffer_p, d_length, slot);
+}
+
+inline
+int ArrayView::length() const
+{
+    return static_cast<int>(d_numElements);
+}
+
+                              // ----------------
+                              // class ChoiceView
+                              // ----------------
+
+// CREATORS
+inline
+ChoiceView::ChoiceView()
+: d_buffer_p(0)
+, d_length(0)
+, d_selection(0)
+, d_selectionId(bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID)
+{
+}
+
+// MANIPULATORS
+inline
+int ChoiceView::reset(const char *buffer, bsl::size_t length)
+{
+    return resetSlot(buffer, length, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int ChoiceView::getSelection(TYPE *value) const
+{
+    BSLS_ASSERT(value);
+
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID == d_selectionId) {
+        return 1;                                                     // RETURN
+    }
+    return View_Util::getValue(value, d_buffer_p, d_length, d_selection);
+}
+
+inline
+int ChoiceView::selectionId() const
+{
+    return d_selectionId;
+}
+
+                              // ----------------
+                              // struct View_Util
+                              // ----------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+int View_Util::getValue(TYPE        *value,
+                        const char  *buffer,
+                        bsl::size_t  length,
+                        bsl::size_t  slot)
+{
+    return 0 == DecoderUtil::decodeSlot(value, buffer, length, slot) ? 0 : -1;
+}
+
+inline
+int View_Util::getValue(TableView        *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot)
+{
+    return 0 == value->resetSlot(buffer, length, slot) ? 0 : -1;
+}
+
+inline
+int View_Util::getValue(ArrayView        *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot)
+{
+    return 0 == value->resetSlot(buffer, length, slot) ? 0 : -1;
+}
+
+inline
+int View_Util::getValue(ChoiceView       *value,
+                        const char       *buffer,
+                        bsl::size_t       length,
+                        bsl::size_t       slot)
+{
+    return 0 == value->resetSlot(buffer, length, slot) ? 0 : -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,870 @@
+// balfb_view.t.cpp                                                   -*-C++-*-
+#include <balfb_view.h>
+
+#include <balfb_decoderutil.h>
+#include <balfb_encoder.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_mychoice.h>
+#include <s_baltst_mysequencewitharray.h>
+#include <s_baltst_mysequencewithchoice.h>
+#include <s_baltst_mysequencewithnullables.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides three views of encoded values, each of
+// which reads parts of the value it refers to directly from the encoding.  We
+// test each view on the output of `balfb::Encoder`, comparing the values read
+// through the view with those that were encoded, for each kind of value the
+// views support (including the other views).  We then check that the views
+// distinguish absent values from malformed encodings, and that reading
+// through a view from a truncated encoding never succeeds with a wrong value.
+//
+// ----------------------------------------------------------------------------
+// TableView
+// [ 1] TableView();
+// [ 1] int reset(const char *buffer, bsl::size_t length);
+// [ 1] int resetSlot(const char *, bsl::size_t, bsl::size_t);
+// [ 1] int getAttribute(TYPE *value, int id) const;
+// [ 1] bool hasAttribute(int id) const;
+// [ 1] int lookupAttribute(bsl::size_t *slot, int id) const;
+//
+// ArrayView
+// [ 2] ArrayView();
+// [ 2] int reset(const char *buffer, bsl::size_t length);
+// [ 2] int resetSlot(const char *, bsl::size_t, bsl::size_t);
+// [ 2] int getElement(TYPE *value, int index) const;
+// [ 2] int length() const;
+//
+// ChoiceView
+// [ 3] ChoiceView();
+// [ 3] int reset(const char *buffer, bsl::size_t length);
+// [ 3] int resetSlot(const char *, bsl::size_t, bsl::size_t);
+// [ 3] int getSelection(TYPE *value) const;
+// [ 3] int selectionId() const;
+// ----------------------------------------------------------------------------
+// [ 4] MALFORMED INPUT
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+typedef s_baltst::Address  Address;
+typedef s_baltst::Employee Employee;
+
+}  // close namespace test
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the encoding of the specified `value`.
+template <class TYPE>
+bsl::string encode(const TYPE& value)
+{
+    bdlsb::MemOutStreamBuf streamBuf;
+    balfb::Encoder         encoder;
+    const int              rc = encoder.encode(&streamBuf, value);
+    ASSERTV(rc, 0 == rc);
+
+    return bsl::string(streamBuf.data(), streamBuf.length());
+}
+
+/// Return a value of `s_baltst::Employee` whose attributes are derived from
+/// the specified `name`.
+test::Employee makeEmployee(const char *name)
+{
+    test::Employee employee;
+    employee.name()                 = name;
+    employee.homeAddress().street() = "Lexington Ave";
+    employee.homeAddress().city()   = "New York City";
+    employee.homeAddress().state()  = "New York";
+    employee.age()                  = static_cast<int>(bsl::strlen(name));
+    return employee;
+}
+
+/// Return `true` if the specified `view` refers to data within the
+/// specified `buffer`, and `false` otherwise.
+bool isWithin(const bsl::string_view& view, const bsl::string& buffer)
+{
+    return buffer.data() <= view.data()
+        && view.data() + view.length() < buffer.data() + buffer.length();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout  << endl
+                           << "USAGE EXAMPLE" << endl
+                           << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Cached Object
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache holds many encoded employee records (see
+// {`balfb_encoder`|Example 1: Encoding an Employee Record}), and that we
+// need only the name and age of each.
+//
+// First, we encode a record, as the cache would have done when storing it:
+// ```
+    test::Employee bob;
+    bob.name()                 = "Bob";
+    bob.homeAddress().street() = "Lexington Ave";
+    bob.homeAddress().city()   = "New York City";
+    bob.homeAddress().state()  = "New York";
+    bob.age()                  = 56;
+
+    bdlsb::MemOutStreamBuf streamBuf;
+    balfb::Encoder         encoder;
+    int                    rc = encoder.encode(&streamBuf, bob);
+    ASSERT(0 == rc);
+
+    const char        *data   = streamBuf.data();
+    const bsl::size_t  length = streamBuf.length();
+// ```
+// Then, we create a view of the encoded record:
+// ```
+    balfb::TableView employee;
+    rc = employee.reset(data, length);
+    ASSERT(0 == rc);
+// ```
+// Now, we read the name, which refers to the data in the buffer:
+// ```
+    bsl::string_view name;
+    rc = employee.getAttribute(&name, test::Employee::ATTRIBUTE_ID_NAME);
+    ASSERT(0     == rc);
+    ASSERT("Bob" == name);
+    ASSERT(data  <  name.data() && name.data() < data + length);
+// ```
+// Finally, we read the age:
+// ```
+    int age;
+    rc = employee.getAttribute(&age, test::Employee::ATTRIBUTE_ID_AGE);
+    ASSERT(0  == rc);
+    ASSERT(56 == age);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING MALFORMED INPUT
+        //
+        // Concerns:
+        // 1. Reading through a view from a truncated encoding either fails
+        //    with a negative value, or yields the encoded value.
+        //
+        // 2. No read is outside of the buffer.
+        //
+        // Plan:
+        // 1. For every truncation of the encoding of an `Employee`, copied to
+        //    a buffer of exactly its length, reset a view and read each
+        //    attribute, including those of the home address.  (C-1..2)
+        //
+        // Testing:
+        //   MALFORMED INPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MALFORMED INPUT" << endl
+                          << "=======================" << endl;
+
+        const test::Employee EMPLOYEE = makeEmployee("Truncated");
+        const bsl::string    ENCODING = encode(EMPLOYEE);
+
+        for (bsl::size_t len = 0; len < ENCODING.length(); ++len) {
+            const bsl::vector<char> buffer(ENCODING.begin(),
+                                           ENCODING.begin() + len);
+
+            balfb::TableView employee;
+            if (0 != employee.reset(buffer.data(), len)) {
+                continue;
+            }
+
+            bsl::string_view name;
+            int rc = employee.getAttribute(&name,
+                                           test::Employee::ATTRIBUTE_ID_NAME);
+            ASSERTV(len, rc, rc < 0 || EMPLOYEE.name() == name);
+
+            int age;
+            rc = employee.getAttribute(&age, test::Employee::ATTRIBUTE_ID_AGE);
+            ASSERTV(len, rc, rc < 0 || EMPLOYEE.age() == age);
+
+            balfb::TableView address;
+            rc = employee.getAttribute(
+                                    &address,
+                                    test::Employee::ATTRIBUTE_ID_HOME_ADDRESS);
+            ASSERTV(len, rc, rc <= 0);
+            if (0 == rc) {
+                bsl::string_view city;
+                rc = address.getAttribute(&city,
+                                          test::Address::ATTRIBUTE_ID_CITY);
+                ASSERTV(len, rc, rc < 0
+                                   || EMPLOYEE.homeAddress().city() == city);
+            }
+
+            test::Address decoded;
+            rc = employee.getAttribute(
+                                    &decoded,
+                                    test::Employee::ATTRIBUTE_ID_HOME_ADDRESS);
+            ASSERTV(len, rc, rc < 0 || EMPLOYEE.homeAddress() == decoded);
+
+            // The state is the last value of the encoding.
+
+            ASSERTV(len, 0 != rc);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `ChoiceView`
+        //
+        // Concerns:
+        // 1. A default-constructed view has no selection.
+        //
+        // 2. `reset` and `resetSlot` make the view refer to an encoded choice,
+        //    and fail, with no effect, if the slot is not that of a choice.
+        //
+        // 3. `selectionId` returns the id of the selection, and
+        //    `getSelection` reads the selection as any supported type.
+        //
+        // 4. `getSelection` returns a positive value for a choice having no
+        //    selection.
+        //
+        // Plan:
+        // 1. Read encodings of `MyChoice` having each selection, and no
+        //    selection, and of a sequence having a choice attribute.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   ChoiceView();
+        //   int reset(const char *buffer, bsl::size_t length);
+        //   int resetSlot(const char *, bsl::size_t, bsl::size_t);
+        //   int getSelection(TYPE *value) const;
+        //   int selectionId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `ChoiceView`" << endl
+                          << "====================" << endl;
+
+        typedef s_baltst::MyChoice Choice;
+
+        {
+            balfb::ChoiceView view;
+            ASSERT(Choice::SELECTION_ID_UNDEFINED == view.selectionId());
+
+            int value;
+            ASSERT(0 < view.getSelection(&value));
+        }
+
+        {
+            const bsl::string ENCODING = encode(Choice());
+
+            balfb::ChoiceView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(Choice::SELECTION_ID_UNDEFINED == view.selectionId());
+
+            int value;
+            ASSERT(0 < view.getSelection(&value));
+        }
+
+        {
+            Choice choice;
+            choice.makeSelection1(-5);
+            const bsl::string ENCODING = encode(choice);
+
+            balfb::ChoiceView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(Choice::SELECTION_ID_SELECTION1 == view.selectionId());
+
+            int value;
+            ASSERT(0  == view.getSelection(&value));
+            ASSERT(-5 == value);
+        }
+
+        {
+            Choice choice;
+            choice.makeSelection2("two");
+            const bsl::string ENCODING = encode(choice);
+
+            balfb::ChoiceView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(Choice::SELECTION_ID_SELECTION2 == view.selectionId());
+
+            bsl::string_view value;
+            ASSERT(0     == view.getSelection(&value));
+            ASSERT("two" == value);
+            ASSERT(isWithin(value, ENCODING));
+
+            bsl::string str;
+            ASSERT(0     == view.getSelection(&str));
+            ASSERT("two" == str);
+
+            // A failed `reset` has no effect.
+
+            ASSERT(0 != view.reset(ENCODING.data(), 3));
+            ASSERT(0 != view.resetSlot(ENCODING.data(),
+                                       ENCODING.length(),
+                                       ENCODING.length()));
+            ASSERT(Choice::SELECTION_ID_SELECTION2 == view.selectionId());
+            ASSERT(0     == view.getSelection(&value));
+            ASSERT("two" == value);
+        }
+
+        {
+            s_baltst::MySequenceWithChoice sequence;
+            sequence.mode().makeChoiceA(8);
+            const bsl::string ENCODING = encode(sequence);
+
+            balfb::TableView table;
+            ASSERT(0 == table.reset(ENCODING.data(), ENCODING.length()));
+
+            balfb::ChoiceView view;
+            const int MODE = s_baltst::MySequenceWithChoice::ATTRIBUTE_ID_MODE;
+            ASSERT(0 == table.getAttribute(&view, MODE));
+            ASSERT(0 == view.selectionId());
+
+            int value;
+            ASSERT(0 == view.getSelection(&value));
+            ASSERT(8 == value);
+
+            bsl::size_t slot;
+            ASSERT(0 == table.lookupAttribute(&slot, 0));
+
+            balfb::ChoiceView other;
+            ASSERT(0 == other.resetSlot(ENCODING.data(),
+                                        ENCODING.length(),
+                                        slot));
+            ASSERT(0 == other.selectionId());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `ArrayView`
+        //
+        // Concerns:
+        // 1. A default-constructed view is empty.
+        //
+        // 2. `reset` and `resetSlot` make the view refer to an encoded array,
+        //    and fail, with no effect, if the slot is not that of an array.
+        //
+        // 3. `length` returns the number of elements, and `getElement` reads
+        //    each element as any supported type.
+        //
+        // 4. `getElement` asserts that the index is in range.
+        //
+        // Plan:
+        // 1. Read encodings of arrays of integers, strings, sequences, and
+        //    arrays.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for an index out of range.  (C-4)
+        //
+        // Testing:
+        //   ArrayView();
+        //   int reset(const char *buffer, bsl::size_t length);
+        //   int resetSlot(const char *, bsl::size_t, bsl::size_t);
+        //   int getElement(TYPE *value, int index) const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `ArrayView`" << endl
+                          << "===================" << endl;
+
+        {
+            balfb::ArrayView view;
+            ASSERT(0 == view.length());
+        }
+
+        if (verbose) cout << "\nTesting arrays of scalars." << endl;
+        {
+            bsl::vector<int> array;
+            for (int i = 0; i < 10; ++i) {
+                array.push_back(i * i);
+            }
+            const bsl::string ENCODING = encode(array);
+
+            balfb::ArrayView view;
+            ASSERT(0  == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(10 == view.length());
+
+            for (int i = 0; i < view.length(); ++i) {
+                int value;
+                ASSERTV(i, 0     == view.getElement(&value, i));
+                ASSERTV(i, i * i == value);
+            }
+
+            const bsl::string EMPTY = encode(bsl::vector<int>());
+            ASSERT(0 == view.reset(EMPTY.data(), EMPTY.length()));
+            ASSERT(0 == view.length());
+
+            // A failed `reset` has no effect.
+
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(0 != view.reset(ENCODING.data(), 7));
+            ASSERT(0 != view.reset(0, 0));
+            ASSERT(10 == view.length());
+        }
+
+        if (verbose) cout << "\nTesting arrays of strings." << endl;
+        {
+            bsl::vector<bsl::string> array;
+            array.push_back("");
+            array.push_back("one");
+            array.push_back("two");
+            const bsl::string ENCODING = encode(array);
+
+            balfb::ArrayView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(3 == view.length());
+
+            for (int i = 0; i < view.length(); ++i) {
+                bsl::string_view value;
+                ASSERTV(i, 0        == view.getElement(&value, i));
+                ASSERTV(i, array[i] == value);
+                ASSERTV(i, isWithin(value, ENCODING));
+            }
+        }
+
+        if (verbose) cout << "\nTesting arrays of sequences and arrays."
+                          << endl;
+        {
+            bsl::vector<test::Employee> employees;
+            employees.push_back(makeEmployee("Alice"));
+            employees.push_back(makeEmployee("Bob"));
+            const bsl::string ENCODING = encode(employees);
+
+            balfb::ArrayView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+            ASSERT(2 == view.length());
+
+            balfb::TableView employee;
+            ASSERT(0 == view.getElement(&employee, 1));
+
+            bsl::string_view name;
+            ASSERT(0 == employee.getAttribute(
+                                           &name,
+                                           test::Employee::ATTRIBUTE_ID_NAME));
+            ASSERT("Bob" == name);
+
+            test::Employee decoded;
+            ASSERT(0            == view.getElement(&decoded, 0));
+            ASSERT(employees[0] == decoded);
+
+            bsl::vector<bsl::vector<int> > nested(3);
+            nested[2].push_back(22);
+            const bsl::string NESTED = encode(nested);
+
+            ASSERT(0 == view.reset(NESTED.data(), NESTED.length()));
+            ASSERT(3 == view.length());
+
+            balfb::ArrayView inner;
+            ASSERT(0 == view.getElement(&inner, 0));
+            ASSERT(0 == inner.length());
+            ASSERT(0 == view.getElement(&inner, 2));
+            ASSERT(1 == inner.length());
+
+            int value;
+            ASSERT(0  == inner.getElement(&value, 0));
+            ASSERT(22 == value);
+        }
+
+        if (verbose) cout << "\nTesting an array attribute." << endl;
+        {
+            s_baltst::MySequenceWithArray sequence;
+            sequence.attribute2().push_back("element");
+            const bsl::string ENCODING = encode(sequence);
+
+            balfb::TableView table;
+            ASSERT(0 == table.reset(ENCODING.data(), ENCODING.length()));
+
+            balfb::ArrayView view;
+            ASSERT(0 == table.getAttribute(&view, 1));
+            ASSERT(1 == view.length());
+
+            bsl::size_t slot;
+            ASSERT(0 == table.lookupAttribute(&slot, 1));
+
+            balfb::ArrayView other;
+            ASSERT(0 == other.resetSlot(ENCODING.data(),
+                                        ENCODING.length(),
+                                        slot));
+            ASSERT(1 == other.length());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::string ENCODING = encode(bsl::vector<int>(2, 0));
+
+            balfb::ArrayView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+
+            int value;
+            ASSERT_PASS(view.getElement(&value, 0));
+            ASSERT_PASS(view.getElement(&value, 1));
+            ASSERT_FAIL(view.getElement(&value, 2));
+            ASSERT_FAIL(view.getElement(&value, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING `TableView`
+        //
+        // Concerns:
+        // 1. A default-constructed view refers to no sequence, and its
+        //    accessors fail.
+        //
+        // 2. `reset` and `resetSlot` make the view refer to an encoded
+        //    sequence, and fail, with no effect, if the slot is not that of a
+        //    sequence.
+        //
+        // 3. `getAttribute` reads attributes of each kind, as any supported
+        //    type, and a string read as a `bsl::string_view` refers to the
+        //    buffer.
+        //
+        // 4. `getAttribute` and `lookupAttribute` return a positive value for
+        //    a null attribute, an id beyond the vtable, and a negative id, and
+        //    `hasAttribute` returns `false` for them.
+        //
+        // 5. The slot loaded by `lookupAttribute` can be decoded by
+        //    `DecoderUtil::decodeSlot`.
+        //
+        // Plan:
+        // 1. Read encodings of `Employee` and `MySequenceWithNullables`.
+        //    (C-1..5)
+        //
+        // Testing:
+        //   TableView();
+        //   int reset(const char *buffer, bsl::size_t length);
+        //   int resetSlot(const char *, bsl::size_t, bsl::size_t);
+        //   int getAttribute(TYPE *value, int id) const;
+        //   bool hasAttribute(int id) const;
+        //   int lookupAttribute(bsl::size_t *slot, int id) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `TableView`" << endl
+                          << "===================" << endl;
+
+        const int NAME         = test::Employee::ATTRIBUTE_ID_NAME;
+        const int HOME_ADDRESS = test::Employee::ATTRIBUTE_ID_HOME_ADDRESS;
+        const int AGE          = test::Employee::ATTRIBUTE_ID_AGE;
+        const int STATE        = test::Address::ATTRIBUTE_ID_STATE;
+
+        if (verbose) cout << "\nTesting a default view." << endl;
+        {
+            balfb::TableView view;
+
+            int value;
+            ASSERT(0 > view.getAttribute(&value, 0));
+            ASSERT(false == view.hasAttribute(0));
+
+            bsl::size_t slot;
+            ASSERT(0 > view.lookupAttribute(&slot, 0));
+        }
+
+        if (verbose) cout << "\nTesting `Employee`." << endl;
+        {
+            const test::Employee EMPLOYEE = makeEmployee("Alice");
+            const bsl::string    ENCODING = encode(EMPLOYEE);
+
+            balfb::TableView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+
+            ASSERT(view.hasAttribute(NAME));
+            ASSERT(view.hasAttribute(HOME_ADDRESS));
+            ASSERT(view.hasAttribute(AGE));
+            ASSERT(!view.hasAttribute(3));
+            ASSERT(!view.hasAttribute(-1));
+
+            bsl::string_view name;
+            ASSERT(0       == view.getAttribute(&name, NAME));
+            ASSERT("Alice" == name);
+            ASSERT(isWithin(name, ENCODING));
+            ASSERT('\0'    == name.data()[name.length()]);
+
+            bsl::string nameString;
+            ASSERT(0       == view.getAttribute(&nameString, NAME));
+            ASSERT("Alice" == nameString);
+
+            int age;
+            ASSERT(0 == view.getAttribute(&age, AGE));
+            ASSERT(5 == age);
+
+            ASSERT(0 < view.getAttribute(&age, 3));
+            ASSERT(0 < view.getAttribute(&age, -1));
+
+            balfb::TableView address;
+            ASSERT(0 == view.getAttribute(&address, HOME_ADDRESS));
+
+            bsl::string_view state;
+            ASSERT(0 == address.getAttribute(&state, STATE));
+            ASSERT("New York" == state);
+
+            test::Address decoded;
+            ASSERT(0 == view.getAttribute(&decoded, HOME_ADDRESS));
+            ASSERT(EMPLOYEE.homeAddress() == decoded);
+
+            bsl::size_t slot;
+            ASSERT(0 == view.lookupAttribute(&slot, HOME_ADDRESS));
+            ASSERT(0 == balfb::DecoderUtil::decodeSlot(&decoded,
+                                                       ENCODING.data(),
+                                                       ENCODING.length(),
+                                                       slot));
+            ASSERT(EMPLOYEE.homeAddress() == decoded);
+
+            ASSERT(0 == address.resetSlot(ENCODING.data(),
+                                          ENCODING.length(),
+                                          slot));
+            ASSERT(0 == address.getAttribute(&state, STATE));
+            ASSERT("New York" == state);
+
+            // A failed `reset` has no effect.
+
+            ASSERT(0 != view.reset(ENCODING.data(), 4));
+            ASSERT(0 != view.resetSlot(ENCODING.data(),
+                                       ENCODING.length(),
+                                       ENCODING.length() - 2));
+            ASSERT(0 == view.getAttribute(&age, AGE));
+            ASSERT(5 == age);
+        }
+
+        if (verbose) cout << "\nTesting nullable attributes." << endl;
+        {
+            s_baltst::MySequenceWithNullables value;
+            value.attribute2().makeValue("two");
+            const bsl::string ENCODING = encode(value);
+
+            balfb::TableView view;
+            ASSERT(0 == view.reset(ENCODING.data(), ENCODING.length()));
+
+            ASSERT(!view.hasAttribute(0));
+            ASSERT( view.hasAttribute(1));
+            ASSERT(!view.hasAttribute(2));
+
+            int i;
+            ASSERT(0 < view.getAttribute(&i, 0));
+
+            bsl::string_view str;
+            ASSERT(0     == view.getAttribute(&str, 1));
+            ASSERT("two" == str);
+
+            balfb::TableView nested;
+            ASSERT(0 < view.getAttribute(&nested, 2));
+
+            bsl::size_t slot;
+            ASSERT(0 < view.lookupAttribute(&slot, 0));
+            ASSERT(0 < view.lookupAttribute(&slot, 99));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Reading one attribute through a view takes time independent of
+        //    the size of the encoded object, unlike decoding the object.
+        //
+        // Plan:
+        // 1. Encode sequences having arrays of various sizes, and compare the
+        //    time taken to read their scalar attribute through a view with
+        //    the time taken to decode them.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = 100;
+
+        for (int size = 1; size <= 10000; size *= 10) {
+            s_baltst::MySequenceWithArray value;
+            value.attribute1() = size;
+            value.attribute2().assign(size, "a typical string element");
+
+            const bsl::string ENCODING = encode(value);
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            int sum = 0;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                balfb::TableView view;
+                view.reset(ENCODING.data(), ENCODING.length());
+
+                int attribute1;
+                view.getAttribute(&attribute1, 0);
+                sum += attribute1;
+            }
+
+            timer.stop();
+            const double viewTime = timer.elapsedTime();
+            ASSERT(sum == size * NUM_ITERATIONS);
+
+            timer.reset();
+            timer.start();
+
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                s_baltst::MySequenceWithArray decoded;
+                balfb::DecoderUtil::decode(&decoded,
+                                           ENCODING.data(),
+                                           ENCODING.length());
+                sum += decoded.attribute1();
+            }
+
+            timer.stop();
+            const double decodeTime = timer.elapsedTime();
+
+            bsl::printf("elements: %5d  bytes: %7d  view: %8.3f us  "
+                        "decode: %10.3f us\n",
+                        size,
+                        static_cast<int>(ENCODING.length()),
+                        viewTime * 1e6 / NUM_ITERATIONS,
+                        decodeTime * 1e6 / NUM_ITERATIONS);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -170,6 +170,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_formattingmode.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_sequencefunctions.h>
+#include <bdlat_sequenceutil.h>
 #include <bdlat_typecategory.h>
 #include <bdlat_valuetypefunctions.h>
 
@@ -429,17 +430,32 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
         // This is an anonymous element.  Do not read anything and instead
         // decode into the corresponding sub-element.
 
-        if (bdlat_SequenceFunctions::hasAttribute(
-                                   *value,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+        const int nameLength = static_cast<int>(d_elementName.length());
+
+        int        attributeId;
+        const bool hasId = 0 == bdlat::SequenceUtil::lookupIndexedAttributeId(
+                                                        &attributeId,
+                                                        *value,
+                                                        d_elementName.data(),
+                                                        nameLength);
+
+        if (hasId || bdlat_SequenceFunctions::hasAttribute(
+                                                        *value,
+                                                        d_elementName.data(),
+                                                        nameLength)) {
             Decoder_ElementVisitor visitor = { this, mode };
 
-            if (0 != bdlat_SequenceFunctions::manipulateAttribute(
-                                   value,
-                                   visitor,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+            const int rc = hasId
+                         ? bdlat_SequenceFunctions::manipulateAttribute(
+                                                        value,
+                                                        visitor,
+                                                        attributeId)
+                         : bdlat_SequenceFunctions::manipulateAttribute(
+                                                        value,
+                                                        visitor,
+                                                        d_elementName.data(),
+                                                        nameLength);
+            if (0 != rc) {
                 d_logStream << "Could not decode sequence, error decoding "
                             << "element or bad element name '"
                             << d_elementName << "' \n";
@@ -490,10 +506,23 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
-                                     *value,
-                                     elementName.data(),
-                                     static_cast<int>(elementName.length()))) {
+            const int nameLength = static_cast<int>(elementName.length());
+
+            // Look up the attribute by id where possible, so that the name is
+            // looked up only once.
+
+            int        attributeId;
+            const bool hasId =
+                            0 == bdlat::SequenceUtil::lookupIndexedAttributeId(
+                                                          &attributeId,
+                                                          *value,
+                                                          elementName.data(),
+                                                          nameLength);
+
+            if (hasId || bdlat_SequenceFunctions::hasAttribute(
+                                                          *value,
+                                                          elementName.data(),
+                                                          nameLength)) {
                 d_elementName = elementName;
 
                 rc = d_tokenizer.advanceToNextToken();
@@ -505,11 +534,16 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
 
                 Decoder_ElementVisitor visitor = { this, mode };
 
-                if (0 != bdlat_SequenceFunctions::manipulateAttribute(
-                                   value,
-                                   visitor,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+                rc = hasId
+                   ? bdlat_SequenceFunctions::manipulateAttribute(value,
+                                                                  visitor,
+                                                                  attributeId)
+                   : bdlat_SequenceFunctions::manipulateAttribute(
+                                                        value,
+                                                        visitor,
+                                                        d_elementName.data(),
+                                                        nameLength);
+                if (0 != rc) {
                     d_logStream << "Could not decode sequence, error decoding "
                                 << "element or bad element name '"
                                 << d_elementName << "' \n";
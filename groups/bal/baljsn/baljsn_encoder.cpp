@@ -7,6 +7,35 @@ BSLS_IDENT_RCSID(baljsn_encoder_cpp,"$Id$ $CSID$")
 #include <bdlde_base64encoder.h>
 
 namespace BloombergLP {
+namespace {
+namespace u {
+
+/// Encode the JSON representation of the specified non-empty array of
+/// numbers `value` to the specified `formatter` using the specified
+/// `options`, formatting the numbers in bulk.  Return 0 on success, and a
+/// non-zero value otherwise.
+template <class TYPE>
+int encodeNumbers(baljsn::Formatter             *formatter,
+                  const bsl::vector<TYPE>&       value,
+                  const baljsn::EncoderOptions&  options)
+{
+    BSLS_ASSERT(!value.empty());
+
+    formatter->openArray();
+
+    const int rc = formatter->putValues(value.data(), value.size(), &options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    formatter->closeArray();
+
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
 namespace baljsn {
 
                         // -----------------------------
@@ -50,6 +79,60 @@ int Encoder_EncodeImplUtil::encodeCharArray(
                   encoderOptions);
 }
 
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                                        Formatter                *formatter,
+                                        bsl::ostream             *,
+                                        const bsl::vector<int>&   value,
+                                        const EncoderOptions&     options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                                   Formatter                        *formatter,
+                                   bsl::ostream                     *,
+                                   const bsl::vector<unsigned int>&  value,
+                                   const EncoderOptions&             options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *,
+                             const bsl::vector<bsls::Types::Int64>&  value,
+                             const EncoderOptions&                   options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *,
+                             const bsl::vector<bsls::Types::Uint64>& value,
+                             const EncoderOptions&                   options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                                        Formatter                *formatter,
+                                        bsl::ostream             *,
+                                        const bsl::vector<float>& value,
+                                        const EncoderOptions&     options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
+int Encoder_EncodeImplUtil::encodeNonEmptyArray(
+                                       Formatter                  *formatter,
+                                       bsl::ostream               *,
+                                       const bsl::vector<double>&  value,
+                                       const EncoderOptions&       options)
+{
+    return u::encodeNumbers(formatter, value, options);
+}
+
                                // Member Encoding
 
 int Encoder_EncodeImplUtil::encodeMember(
@@ -474,6 +474,45 @@ struct Encoder_EncodeImplUtil {
                                    const TYPE&            value,
                                    const EncoderOptions&  options);
 
+    /// Encode the JSON representation of the specified `value` to the
+    /// specified JSON `formatter`, formatting the numbers in bulk (see
+    /// `baljsn::Formatter::putValues`).  Use the specified `options` to
+    /// configure aspects of the JSON representation of the `value`.  Return
+    /// 0 on success, and a non-zero value otherwise.  The specified
+    /// `logStream` is unused.  The behavior is undefined unless the `value`
+    /// is non-empty.  Note that the result is the same as that of the
+    /// overload for an arbitrary array type.
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<int>&                 value,
+                             const EncoderOptions&                   options);
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<unsigned int>&        value,
+                             const EncoderOptions&                   options);
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<bsls::Types::Int64>&  value,
+                             const EncoderOptions&                   options);
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<bsls::Types::Uint64>& value,
+                             const EncoderOptions&                   options);
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<float>&               value,
+                             const EncoderOptions&                   options);
+    static int encodeNonEmptyArray(
+                             Formatter                              *formatter,
+                             bsl::ostream                           *logStream,
+                             const bsl::vector<double>&              value,
+                             const EncoderOptions&                   options);
+
     // Encoding Generalized Members
 
     /// Encode the JSON representation of the specified object `member`
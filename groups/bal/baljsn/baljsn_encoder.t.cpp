@@ -128,7 +128,8 @@ using bsl::endl;
 // [20] ENCODING UNSET CHOICE
 // [21] ENCODING NULL CHOICE
 // [22] ENCODING VECTORS OF VECTORS
-// [23] USAGE EXAMPLE
+// [23] ENCODING ARRAYS OF NUMBERS
+// [24] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1148,6 +1149,87 @@ class EmptySequenceExample {
 // TRAITS
 BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(u::EmptySequenceExample)
 
+namespace {
+namespace u {
+
+/// Verify that encoding the specified `values`, and an array of arrays of
+/// them, using the specified `options` yields the same return code and JSON
+/// as encoding the same values held in `bdlb::NullableValue` objects, which
+/// are encoded one element at a time.  Use the specified `line` to report
+/// errors.
+template <class TYPE>
+void verifyNumericArrayEncoding(int                           line,
+                                const bsl::vector<TYPE>&      values,
+                                const baljsn::EncoderOptions& options)
+{
+    typedef bdlb::NullableValue<TYPE> Nullable;
+
+    const bsl::vector<Nullable> nullables(values.begin(), values.end());
+
+    const bsl::vector<bsl::vector<TYPE> >     nested(2, values);
+    const bsl::vector<bsl::vector<Nullable> > nestedNullables(2, nullables);
+
+    baljsn::Encoder encoder;
+
+    {
+        bsl::ostringstream os;
+        bsl::ostringstream exp;
+
+        const int rc    = encoder.encode(os,  values,    options);
+        const int expRc = encoder.encode(exp, nullables, options);
+
+        ASSERTV(line, rc, expRc, (0 == rc) == (0 == expRc));
+        if (0 == expRc) {
+            ASSERTV(line, os.str(), exp.str(), os.str() == exp.str());
+        }
+    }
+    {
+        bsl::ostringstream os;
+        bsl::ostringstream exp;
+
+        const int rc    = encoder.encode(os,  nested,          options);
+        const int expRc = encoder.encode(exp, nestedNullables, options);
+
+        ASSERTV(line, rc, expRc, (0 == rc) == (0 == expRc));
+        if (0 == expRc) {
+            ASSERTV(line, os.str(), exp.str(), os.str() == exp.str());
+        }
+    }
+}
+
+/// Verify the encoding of arrays of the (template parameter) `TYPE` made of
+/// the specified `numValues` elements of the specified `values` followed by
+/// the specified `numRandomValues` values derived from them, and of each of
+/// the arrays made of one element of `values`, using each of the specified
+/// `numOptions` elements of `options`.  Use the specified `line` to report
+/// errors.
+template <class TYPE>
+void verifyNumericArraysEncoding(int                           line,
+                                 const TYPE                   *values,
+                                 bsl::size_t                   numValues,
+                                 int                           numRandomValues,
+                                 const baljsn::EncoderOptions *options,
+                                 int                           numOptions)
+{
+    bsl::vector<TYPE> array(values, values + numValues);
+    for (int i = 0; i < numRandomValues; ++i) {
+        array.push_back(static_cast<TYPE>(values[i % numValues] / (i + 2)));
+    }
+
+    for (int oi = 0; oi < numOptions; ++oi) {
+        verifyNumericArrayEncoding(line, array, options[oi]);
+
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            verifyNumericArrayEncoding(line,
+                                       bsl::vector<TYPE>(1, values[i]),
+                                       options[oi]);
+        }
+    }
+}
+
+}  // close u namespace
+}  // close unnamed namespace
+
 }  // close enterprise namespace
 
 // ============================================================================
@@ -1168,7 +1250,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1285,6 +1367,127 @@ int main(int argc, char *argv[])
     ASSERT(EXP_OUTPUT == os.str());
 // ```
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING ENCODING ARRAYS OF NUMBERS
+        //   This case tests that `bsl::vector`s of numbers, which are encoded
+        //   in bulk, are encoded the same way as arrays of other types are.
+        //
+        // Concerns:
+        // 1. `bsl::vector`s of `int`, `unsigned int`, `bsls::Types::Int64`,
+        //    `bsls::Types::Uint64`, `float`, and `double` encode to the same
+        //    JSON as arrays whose elements are encoded one at a time, both at
+        //    the top level and as elements of arrays.
+        //
+        // 2. The encoding style, the indentation options, and the floating
+        //    point precision and infinity and NaN options are obeyed.
+        //
+        // 3. Arrays of non-finite floating point values fail to encode unless
+        //    the option to encode them as strings is set.
+        //
+        // Plan:
+        // 1. For arrays of each type holding boundary values and many values
+        //    derived from them, and for arrays of one element, compare the
+        //    return code and result of encoding the array, and an array of
+        //    copies of it, with those of encoding the same values held in
+        //    `bdlb::NullableValue` objects, using a set of options.  (C-1..3)
+        //
+        // Testing:
+        //   ENCODING ARRAYS OF NUMBERS
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TESTING ENCODING ARRAYS OF NUMBERS" << endl
+                 << "==================================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        baljsn::EncoderOptions OPTIONS[5];
+
+        OPTIONS[1].setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+        OPTIONS[1].setInitialIndentLevel(1);
+        OPTIONS[1].setSpacesPerLevel(2);
+
+        OPTIONS[2].setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+        OPTIONS[2].setSpacesPerLevel(4);
+        OPTIONS[2].setEncodeInfAndNaNAsStrings(true);
+
+        OPTIONS[3].setMaxFloatPrecision(4);
+        OPTIONS[3].setMaxDoublePrecision(9);
+
+        OPTIONS[4].setEncodeInfAndNaNAsStrings(true);
+
+        const int NUM_OPTIONS = sizeof OPTIONS / sizeof *OPTIONS;
+
+        const int INTS[] = { 0, -1, 7, 99999999, 100000000,
+                             bsl::numeric_limits<int>::min(),
+                             bsl::numeric_limits<int>::max() };
+        u::verifyNumericArraysEncoding(L_,
+                                       INTS,
+                                       sizeof INTS / sizeof *INTS,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        const unsigned int UINTS[] = { 0, 1, 4294967295u };
+        u::verifyNumericArraysEncoding(L_,
+                                       UINTS,
+                                       sizeof UINTS / sizeof *UINTS,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        const Int64 INT64S[] = { 0, -12345678901LL, 9999999999999999LL,
+                                 bsl::numeric_limits<Int64>::min(),
+                                 bsl::numeric_limits<Int64>::max() };
+        u::verifyNumericArraysEncoding(L_,
+                                       INT64S,
+                                       sizeof INT64S / sizeof *INT64S,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        const Uint64 UINT64S[] = { 0, 10000000000000000ULL,
+                                   bsl::numeric_limits<Uint64>::max() };
+        u::verifyNumericArraysEncoding(L_,
+                                       UINT64S,
+                                       sizeof UINT64S / sizeof *UINT64S,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        const float FLOATS[] = { 0.0f, -1.5f, 0.1f, 3.4028235e38f,
+                                 1.0e-45f };
+        u::verifyNumericArraysEncoding(L_,
+                                       FLOATS,
+                                       sizeof FLOATS / sizeof *FLOATS,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        const double DOUBLES[] = { 0.0, -0.0, 0.1, 1e21, -1e-7,
+                                   1.7976931348623157e308,
+                                   4.9406564584124654e-324 };
+        u::verifyNumericArraysEncoding(L_,
+                                       DOUBLES,
+                                       sizeof DOUBLES / sizeof *DOUBLES,
+                                       300,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+
+        typedef bsl::numeric_limits<double> Lim;
+
+        const double SPECIALS[] = { 1.0, Lim::infinity(), -Lim::infinity(),
+                                    Lim::quiet_NaN() };
+        u::verifyNumericArraysEncoding(L_,
+                                       SPECIALS,
+                                       sizeof SPECIALS / sizeof *SPECIALS,
+                                       0,
+                                       OPTIONS,
+                                       NUM_OPTIONS);
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING ENCODING VECTORS OF VECTORS
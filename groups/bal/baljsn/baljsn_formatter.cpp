@@ -7,7 +7,84 @@ BSLS_IDENT_RCSID(baljsn_formatter_cpp,"$Id$ $CSID$")
 #include <baljsn_encoderoptions.h>
 #include <baljsn_printutil.h>
 
+#include <bdlb_float.h>
+#include <bdlb_numericformatutil.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_string_view.h>
+
 namespace BloombergLP {
+namespace {
+namespace u {
+
+enum {
+    k_BUFFER_SIZE          = 2048,  // size of the local buffer into which
+                                    // 'putNumbers' formats values
+
+    k_MAX_SEPARATOR_LENGTH = 130    // maximum length of an array element
+                                    // separator, including the indentation,
+                                    // for which values are formatted in bulk
+};
+
+/// Write to the specified `stream` the specified `numValues` elements of the
+/// specified `values` array, separated by the specified `separator`,
+/// formatting as many values as fit at a time into a local buffer.  The
+/// behavior is undefined unless
+/// `separator.length() <= k_MAX_SEPARATOR_LENGTH`.
+template <class TYPE>
+void writeNumbers(bsl::ostream&            stream,
+                  const TYPE              *values,
+                  bsl::size_t              numValues,
+                  const bsl::string_view&  separator)
+{
+    typedef bslalg::NumericFormatterUtil NfUtil;
+
+    BSLS_ASSERT(separator.length() <= k_MAX_SEPARATOR_LENGTH);
+
+    const bsl::size_t chunkSize =
+                     k_BUFFER_SIZE / (NfUtil::ToCharsMaxLength<TYPE>::k_VALUE +
+                                      separator.length());
+
+    char buffer[k_BUFFER_SIZE];
+
+    for (bsl::size_t i = 0; i < numValues; i += chunkSize) {
+        if (0 != i) {
+            stream.write(separator.data(), separator.length());
+        }
+
+        const bsl::size_t numChunkValues = bsl::min(chunkSize, numValues - i);
+
+        const char *end = bdlb::NumericFormatUtil::formatArray(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       values + i,
+                                                       numChunkValues,
+                                                       separator);
+        BSLS_ASSERT(end);
+
+        stream.write(buffer, end - buffer);
+    }
+}
+
+/// Return `true` if each of the specified `numValues` elements of the
+/// specified `values` array is finite, and `false` otherwise.
+template <class TYPE>
+bool areFinite(const TYPE *values, bsl::size_t numValues)
+{
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (!bdlb::Float::isFinite(values[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
 namespace baljsn {
 
                           // ---------------
@@ -32,6 +109,64 @@ Formatter::Formatter(bsl::ostream&     stream,
     d_callSequence.append(false);
 }
 
+// PRIVATE MANIPULATORS
+template <class TYPE>
+int Formatter::putEachValue(const TYPE           *values,
+                            bsl::size_t           numValues,
+                            const EncoderOptions *options)
+{
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (0 != i) {
+            addArrayElementSeparator();
+        }
+
+        const int rc = putValue(values[i], options);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+int Formatter::putNumbers(const TYPE *values, bsl::size_t numValues)
+{
+    const bool indentValues = d_usePrettyStyle && isArrayElement();
+
+    // The separator is what 'addArrayElementSeparator' writes, followed by
+    // the indentation 'putValue' writes before a value.
+
+    const int numSpaces = indentValues
+                        ? bsl::max(d_indentLevel, 0) *
+                          (d_spacesPerLevel < 0 ? -d_spacesPerLevel
+                                                :  d_spacesPerLevel)
+                        : 0;
+
+    if (numSpaces > u::k_MAX_SEPARATOR_LENGTH - 2) {
+        return putEachValue(values, numValues, 0);                    // RETURN
+    }
+
+    char        separator[u::k_MAX_SEPARATOR_LENGTH];
+    bsl::size_t separatorLength = 0;
+
+    separator[separatorLength++] = ',';
+    if (d_usePrettyStyle) {
+        separator[separatorLength++] = '\n';
+    }
+    bsl::memset(separator + separatorLength, ' ', numSpaces);
+    separatorLength += numSpaces;
+
+    if (indentValues) {
+        indent();
+    }
+
+    u::writeNumbers(d_outputStream,
+                    values,
+                    numValues,
+                    bsl::string_view(separator, separatorLength));
+    return 0;
+}
+
 // MANIPULATORS
 void Formatter::openObject()
 {
@@ -124,6 +259,56 @@ void Formatter::addArrayElementSeparator()
     }
 }
 
+int Formatter::putValues(const int            *values,
+                         bsl::size_t           numValues,
+                         const EncoderOptions *)
+{
+    return putNumbers(values, numValues);
+}
+
+int Formatter::putValues(const unsigned int   *values,
+                         bsl::size_t           numValues,
+                         const EncoderOptions *)
+{
+    return putNumbers(values, numValues);
+}
+
+int Formatter::putValues(const bsls::Types::Int64 *values,
+                         bsl::size_t               numValues,
+                         const EncoderOptions     *)
+{
+    return putNumbers(values, numValues);
+}
+
+int Formatter::putValues(const bsls::Types::Uint64 *values,
+                         bsl::size_t                numValues,
+                         const EncoderOptions      *)
+{
+    return putNumbers(values, numValues);
+}
+
+int Formatter::putValues(const float          *values,
+                         bsl::size_t           numValues,
+                         const EncoderOptions *options)
+{
+    if ((options && 0 != options->maxFloatPrecision()) ||
+        !u::areFinite(values, numValues)) {
+        return putEachValue(values, numValues, options);              // RETURN
+    }
+    return putNumbers(values, numValues);
+}
+
+int Formatter::putValues(const double         *values,
+                         bsl::size_t           numValues,
+                         const EncoderOptions *options)
+{
+    if ((options && 0 != options->maxDoublePrecision()) ||
+        !u::areFinite(values, numValues)) {
+        return putEachValue(values, numValues, options);              // RETURN
+    }
+    return putNumbers(values, numValues);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
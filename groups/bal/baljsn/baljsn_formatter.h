@@ -29,7 +29,9 @@ BSLS_IDENT("$Id: $")
 //   `Formatter` `class` provides the `openArray` and `closeArray` method to
 //   open and close an array.  Additionally the `Formatter` `class` allows of
 //   separation of array items by a comma via the `addArrayElementSeparator`
-//   method.
+//   method.  The elements of an array of numbers can also be written all at
+//   once (including the separators between them) using `putValues`, which
+//   formats them in bulk (see `bdlb_numericformatutil`).
 //
 // The `Formatter` `class` also provides the ability to specify formatting
 // options at construction.  The options that can be provided include the
@@ -192,6 +194,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
 
 #include <bsl_string.h>
 #include <bsl_string_view.h>
@@ -235,6 +240,23 @@ class Formatter {
     /// not check that `d_usePrettyStyle` is `true` before indenting.
     void indent();
 
+    /// Print onto the stream supplied at construction the specified
+    /// `numValues` elements of the specified `values` array, separated by
+    /// array element separators, one at a time using `putValue` with the
+    /// specified `options`.  Return 0 on success and a non-zero value
+    /// otherwise.
+    template <class TYPE>
+    int putEachValue(const TYPE           *values,
+                     bsl::size_t           numValues,
+                     const EncoderOptions *options);
+
+    /// Print onto the stream supplied at construction the specified
+    /// `numValues` elements of the specified `values` array of finite
+    /// numbers, separated by array element separators, formatting them in
+    /// bulk.  Return 0 on success and a non-zero value otherwise.
+    template <class TYPE>
+    int putNumbers(const TYPE *values, bsl::size_t numValues);
+
     // PRIVATE ACCESSORS
 
     /// Return `true` if the value being encoded is an element of an array, and
@@ -319,6 +341,39 @@ class Formatter {
     template <class TYPE>
     int putValue(const TYPE& value, const EncoderOptions *options = 0);
 
+    /// Print onto the stream supplied at construction the specified
+    /// `numValues` elements of the specified `values` array as consecutive
+    /// elements of the array currently being formatted, separated by array
+    /// element separators (i.e., with the same result as calling `putValue`
+    /// for each element, with `addArrayElementSeparator` between the calls).
+    /// Optionally specify `options` according which the values should be
+    /// encoded.  Return 0 on success and a non-zero value otherwise.  The
+    /// behavior is undefined unless this `Formatter` is currently formatting
+    /// an array.  Note that, unless a maximum precision is specified in the
+    /// `options` for floating point values, or a floating point value is
+    /// not finite, the values are formatted a block at a time into a local
+    /// buffer, which is significantly faster than calling `putValue` for
+    /// each element.  Also note that integers are always written in decimal,
+    /// regardless of the formatting state of the stream.
+    int putValues(const int                 *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+    int putValues(const unsigned int        *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+    int putValues(const bsls::Types::Int64  *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+    int putValues(const bsls::Types::Uint64 *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+    int putValues(const float               *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+    int putValues(const double              *values,
+                  bsl::size_t                numValues,
+                  const EncoderOptions      *options = 0);
+
     /// Print onto the stream supplied at construction the sequence of
     /// characters designating the end of an member (referred to as a
     /// "name/value pair" in JSON).  The behavior is undefined unless this
@@ -41,6 +41,7 @@
 #include <bslmf_assert.h>
 
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
@@ -86,9 +87,10 @@ namespace test = BloombergLP::s_baltst;
 // [ 8] int putNullValue();
 // [ 9] void closeMember();
 // [11] void addArrayElementSeparator();
+// [12] int putValues(const NUMBER *, size_t, const EncoderOptions *);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -223,6 +225,96 @@ void testPutValue(int            line,
     }
 }
 
+/// Verify that calling `putValues` for the specified `numValues` elements of
+/// the specified `values` with the specified `options` on a formatter
+/// created using the specified `style`, `indent`, and `spl` inside an array
+/// produces the same output and return value as calling `putValue` on each
+/// element with `addArrayElementSeparator` between the calls.  Use the
+/// specified `line` to report errors.
+template <class TYPE>
+void testPutValues(int            line,
+                   int            style,
+                   int            indent,
+                   int            spl,
+                   const TYPE    *values,
+                   bsl::size_t    numValues,
+                   const Options *options)
+{
+    bsl::ostringstream os;
+    bsl::ostringstream exp;
+
+    Obj mX = g(os, style, indent, spl);
+    Obj mE = g(exp, style, indent, spl);
+
+    mX.openArray();
+    mE.openArray();
+
+    const int rc = mX.putValues(values, numValues, options);
+
+    int expRc = 0;
+    for (bsl::size_t i = 0; i < numValues && 0 == expRc; ++i) {
+        if (0 != i) {
+            mE.addArrayElementSeparator();
+        }
+        expRc = mE.putValue(values[i], options);
+    }
+
+    ASSERTV(line, rc, expRc, (0 == rc) == (0 == expRc));
+    if (0 == expRc) {
+        mX.closeArray();
+        mE.closeArray();
+
+        ASSERTV(line, os.str(), exp.str(), os.str() == exp.str());
+    }
+}
+
+/// Verify `putValues` for arrays of the (template parameter) `TYPE` made of
+/// the specified `numValues` elements of the specified `values`, and of
+/// each of their prefixes, in several encoding styles, with the specified
+/// `options` and without options.  Use the specified `line` to report
+/// errors.
+template <class TYPE>
+void testPutValuesAllStyles(int            line,
+                            const TYPE    *values,
+                            bsl::size_t    numValues,
+                            const Options *options)
+{
+    static const struct {
+        int d_style;
+        int d_indent;
+        int d_spl;
+    } STYLES[] = {
+        { -1, -1, -1 },
+        {  0, -1, -1 },
+        {  1, -1, -1 },
+        {  1,  0,  0 },
+        {  1,  1,  2 },
+        {  1,  3, -4 },
+        {  1, -2,  4 },
+        {  1, 40,  4 },   // indentation too deep to format values in bulk
+    };
+    const int NUM_STYLES = sizeof STYLES / sizeof *STYLES;
+
+    for (int si = 0; si < NUM_STYLES; ++si) {
+        for (bsl::size_t n = 1; n <= numValues; ++n) {
+            testPutValues(line,
+                          STYLES[si].d_style,
+                          STYLES[si].d_indent,
+                          STYLES[si].d_spl,
+                          values,
+                          n,
+                          options);
+            testPutValues(line,
+                          STYLES[si].d_style,
+                          STYLES[si].d_indent,
+                          STYLES[si].d_spl,
+                          values,
+                          n,
+                          0);
+        }
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -243,7 +335,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -399,6 +491,138 @@ int main(int argc, char *argv[])
     ASSERT(EXPECTED == os.str());
 // ```
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING `putValues` METHOD
+        //
+        // Concerns:
+        // 1. `putValues` writes the same text as calling `putValue` for each
+        //    element with `addArrayElementSeparator` between the calls, in
+        //    all encoding styles and at all indentation levels.
+        //
+        // 2. Arrays long enough to be formatted in several blocks are written
+        //    correctly.
+        //
+        // 3. Floating point values are written with the maximum precision
+        //    specified in the options, if any, and non-finite values are
+        //    either rejected or written as strings, as specified by the
+        //    options.
+        //
+        // Plan:
+        // 1. For arrays of each supported type, including boundary values,
+        //    compare the output of `putValues` with that of a second formatter
+        //    on which `putValue` and `addArrayElementSeparator` are called,
+        //    for every prefix of the array, for a set of encoding styles and
+        //    indentations, with and without options.  (C-1, 3)
+        //
+        // 2. Repeat P-1 for arrays of 1000 elements.  (C-2)
+        //
+        // Testing:
+        //   int putValues(const NUMBER *, size_t, const EncoderOptions *);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TESTING `putValues` METHOD" << endl
+                 << "==========================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        Options options;
+
+        Options precisionOptions;
+        precisionOptions.setMaxFloatPrecision(3);
+        precisionOptions.setMaxDoublePrecision(5);
+
+        Options infAndNaNOptions;
+        infAndNaNOptions.setEncodeInfAndNaNAsStrings(true);
+
+        if (verbose) cout << "Integers" << endl;
+        {
+            const int INTS[] = { 0, -1, 12345678, 123456789,
+                                 bsl::numeric_limits<int>::min(),
+                                 bsl::numeric_limits<int>::max() };
+            const bsl::size_t NUM_INTS = sizeof INTS / sizeof *INTS;
+            testPutValuesAllStyles(L_, INTS, NUM_INTS, &options);
+
+            const unsigned int UINTS[] = { 0, 7, 4294967295u };
+            const bsl::size_t NUM_UINTS = sizeof UINTS / sizeof *UINTS;
+            testPutValuesAllStyles(L_, UINTS, NUM_UINTS, &options);
+
+            const Int64 INT64S[] = {
+                0, -9999999999999999LL, 10000000000000000LL,
+                bsl::numeric_limits<Int64>::min(),
+                bsl::numeric_limits<Int64>::max()
+            };
+            const bsl::size_t NUM_INT64S = sizeof INT64S / sizeof *INT64S;
+            testPutValuesAllStyles(L_, INT64S, NUM_INT64S, &options);
+
+            const Uint64 UINT64S[] = {
+                1, 99999999, 100000000, bsl::numeric_limits<Uint64>::max()
+            };
+            const bsl::size_t NUM_UINT64S = sizeof UINT64S / sizeof *UINT64S;
+            testPutValuesAllStyles(L_, UINT64S, NUM_UINT64S, &options);
+        }
+
+        if (verbose) cout << "Floating point values" << endl;
+        {
+            const float FLOATS[] = { 0.0f, -1.5f, 0.1f, 3.4028235e38f,
+                                     1.0e-45f };
+            const bsl::size_t NUM_FLOATS = sizeof FLOATS / sizeof *FLOATS;
+            testPutValuesAllStyles(L_, FLOATS, NUM_FLOATS, &options);
+            testPutValuesAllStyles(L_, FLOATS, NUM_FLOATS, &precisionOptions);
+
+            const double DOUBLES[] = { 0.0, -0.0, 0.1, 1e21, 1e-7,
+                                       1.7976931348623157e308,
+                                       4.9406564584124654e-324 };
+            const bsl::size_t NUM_DOUBLES = sizeof DOUBLES / sizeof *DOUBLES;
+            testPutValuesAllStyles(L_, DOUBLES, NUM_DOUBLES, &options);
+            testPutValuesAllStyles(L_,
+                                   DOUBLES,
+                                   NUM_DOUBLES,
+                                   &precisionOptions);
+
+            typedef bsl::numeric_limits<double> Lim;
+
+            const double SPECIALS[] = { 1.0, Lim::infinity(), 2.0,
+                                        -Lim::infinity(), Lim::quiet_NaN() };
+            const bsl::size_t NUM_SPECIALS = sizeof SPECIALS /
+                                                             sizeof *SPECIALS;
+            testPutValuesAllStyles(L_, SPECIALS, NUM_SPECIALS, &options);
+            testPutValuesAllStyles(L_,
+                                   SPECIALS,
+                                   NUM_SPECIALS,
+                                   &infAndNaNOptions);
+        }
+
+        if (verbose) cout << "Long arrays" << endl;
+        {
+            bsl::vector<Int64>  int64s(1000);
+            bsl::vector<double> doubles(1000);
+            for (int i = 0; i < 1000; ++i) {
+                int64s[i]  = (i % 2 ? -1 : 1) * 1234567891234LL * i;
+                doubles[i] = 1.0 / (i + 1);
+            }
+
+            for (int style = 0; style < 2; ++style) {
+                testPutValues(L_,
+                              style,
+                              2,
+                              4,
+                              int64s.data(),
+                              int64s.size(),
+                              &options);
+                testPutValues(L_,
+                              style,
+                              2,
+                              4,
+                              doubles.data(),
+                              doubles.size(),
+                              &options);
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING `addArrayElementSeparator` METHOD
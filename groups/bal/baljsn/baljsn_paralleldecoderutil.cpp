@@ -0,0 +1,168 @@
+// baljsn_paralleldecoderutil.cpp                                     -*-C++-*-
+#include <baljsn_paralleldecoderutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_paralleldecoderutil_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace baljsn {
+namespace {
+
+/// Return `true` if the specified `c` is a JSON whitespace character, and
+/// `false` otherwise.
+inline
+bool isJsonSpace(char c)
+{
+    return ' ' == c || '\n' == c || '\r' == c || '\t' == c;
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is not JSON whitespace, or `end` if there is none.
+inline
+const char *skipSpace(const char *begin, const char *end)
+{
+    while (begin < end && isJsonSpace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+/// Return the address one past the last character in the specified range
+/// `[begin, end)` that is not JSON whitespace, or `begin` if there is none.
+inline
+const char *trimSpace(const char *begin, const char *end)
+{
+    while (begin < end && isJsonSpace(end[-1])) {
+        --end;
+    }
+    return end;
+}
+
+}  // close unnamed namespace
+
+                         // --------------------------
+                         // struct ParallelDecoderUtil
+                         // --------------------------
+
+// CLASS METHODS
+void ParallelDecoderUtil::splitLines(bsl::vector<bsl::string_view> *records,
+                                     const bsl::string_view&        input)
+{
+    BSLS_ASSERT(records);
+
+    records->clear();
+
+    const char *current = input.data();
+    const char *end     = current + input.size();
+
+    while (current < end) {
+        const char *newline = static_cast<const char *>(
+                               bsl::memchr(current, '\n', end - current));
+        const char *lineEnd = newline ? newline : end;
+
+        const char *recordBegin = skipSpace(current, lineEnd);
+        if (recordBegin < lineEnd) {
+            const char *recordEnd = trimSpace(recordBegin, lineEnd);
+            records->push_back(bsl::string_view(recordBegin,
+                                                recordEnd - recordBegin));
+        }
+
+        current = newline ? newline + 1 : end;
+    }
+}
+
+int ParallelDecoderUtil::splitArray(bsl::vector<bsl::string_view> *elements,
+                                    const bsl::string_view&        input)
+{
+    BSLS_ASSERT(elements);
+
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    elements->clear();
+
+    const char *end     = input.data() + input.size();
+    const char *current = skipSpace(input.data(), end);
+
+    if (current == end || '[' != *current) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    current = skipSpace(current + 1, end);
+    if (current < end && ']' == *current) {
+        return skipSpace(current + 1, end) == end ? k_SUCCESS
+                                                  : k_FAILURE;        // RETURN
+    }
+
+    while (true) {
+        // Find the ',' or ']' that ends this element at a nesting depth of 0.
+
+        const char *elementBegin = current;
+        int         depth        = 0;
+
+        for (; current < end; ++current) {
+            const char c = *current;
+
+            if ('"' == c) {
+                for (++current; current < end && '"' != *current; ++current) {
+                    if ('\\' == *current) {
+                        ++current;
+                    }
+                }
+                if (current >= end) {
+                    return k_FAILURE;                                 // RETURN
+                }
+            }
+            else if ('[' == c || '{' == c) {
+                ++depth;
+            }
+            else if (']' == c || '}' == c) {
+                if (0 == depth) {
+                    break;
+                }
+                --depth;
+            }
+            else if (',' == c && 0 == depth) {
+                break;
+            }
+        }
+
+        if (current == end || '}' == *current) {
+            return k_FAILURE;                                         // RETURN
+        }
+
+        const char *elementEnd = trimSpace(elementBegin, current);
+        if (elementBegin == elementEnd) {
+            return k_FAILURE;                                         // RETURN
+        }
+        elements->push_back(bsl::string_view(elementBegin,
+                                             elementEnd - elementBegin));
+
+        if (']' == *current) {
+            break;
+        }
+        current = skipSpace(current + 1, end);
+    }
+
+    return skipSpace(current + 1, end) == end ? k_SUCCESS : k_FAILURE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,565 @@
+// baljsn_paralleldecoderutil.h                                       -*-C++-*-
+#ifndef INCLUDED_BALJSN_PARALLELDECODERUTIL
+#define INCLUDED_BALJSN_PARALLELDECODERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to decode sequences of JSON records in parallel.
+//
+//@CLASSES:
+//  baljsn::ParallelDecoderUtil: decode JSON records on a thread pool
+//
+//@SEE_ALSO: baljsn_decoder, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a `struct`,
+// `baljsn::ParallelDecoderUtil`, that decodes a sequence of independent JSON
+// records into a `bsl::vector` of objects of a `bdeat`-compatible type, using
+// the threads of a `bdlmt::FixedThreadPool`.  Two layouts of the input are
+// supported:
+//
+// * `decodeLines` decodes newline-delimited JSON ("JSON Lines"), in which
+//   each non-blank line holds one record.
+// * `decodeArray` decodes a single top-level JSON array, each element of
+//   which is one record.
+//
+// The input is first split into records by a single, fast scan of its
+// structure that does not decode any values (`splitLines` and `splitArray`,
+// which are also available to clients).  Splitting newline-delimited JSON is
+// safe at every newline character, since a newline cannot occur unescaped
+// within a JSON string.  Splitting an array requires tracking the nesting
+// depth of the elements and whether the scan is inside a string, but nothing
+// more.  The records are then divided into contiguous ranges, and each range
+// is decoded into the corresponding elements of the result, which is sized
+// before any decoding starts, using a `baljsn::Decoder` of the thread that
+// decodes it.  The ranges are claimed, one at a time, both by jobs enqueued
+// on the thread pool and by the calling thread, which therefore decodes every
+// range not claimed by a thread of the pool.  The calling thread then blocks
+// until the ranges claimed by the threads of the pool have been decoded.
+//
+// Since the calling thread never waits for a job that has not started, the
+// decoding functions may be called from a job running on the thread pool
+// they are given (e.g., by a job that decodes one of several files), even if
+// every thread of the pool is busy.  Jobs that start after every range has
+// been claimed return immediately.
+//
+// The records are decoded exactly as `baljsn::Decoder::decode` would decode
+// each of them on its own, using the supplied `baljsn::DecoderOptions`.  A
+// structural error that prevents the input from being split (e.g., an
+// unterminated string in an array) causes the whole operation to fail before
+// any record is decoded.
+//
+///Thread Safety
+///-------------
+// The elements of the result are constructed by the calling thread, but are
+// assigned their decoded values by the threads of the thread pool.
+// Therefore, the allocator of the result vector, which is also used by its
+// elements, must be thread-safe (as are the default and global allocators).
+// The input must not be modified until the decoding functions return.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Newline-Delimited JSON
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a file in which each line is the JSON encoding of
+// an employee record of the (`bas_codegen.pl`-generated) type
+// `s_baltst::Employee`, and we want to make use of several processors to
+// decode it.
+//
+// First, we create and start a thread pool:
+// ```
+// bdlmt::FixedThreadPool threadPool(4, 100);
+// int rc = threadPool.start();
+// assert(0 == rc);
+// ```
+// Then, we obtain the contents of the file (here, from a string literal):
+// ```
+// const char INPUT[] =
+//     "{\"name\":\"Bob\",\"homeAddress\":{\"street\":\"Some Street\","
+//     "\"city\":\"Some City\",\"state\":\"Some State\"},\"age\":21}\n"
+//     "{\"name\":\"Sue\",\"homeAddress\":{\"street\":\"Other Street\","
+//     "\"city\":\"Other City\",\"state\":\"Other State\"},\"age\":35}\n";
+// ```
+// Next, we decode the records into a vector:
+// ```
+// bsl::vector<s_baltst::Employee> employees;
+// baljsn::DecoderOptions          options;
+//
+// rc = baljsn::ParallelDecoderUtil::decodeLines(&employees,
+//                                               INPUT,
+//                                               options,
+//                                               &threadPool);
+// assert(0 == rc);
+// ```
+// Finally, we verify the decoded records:
+// ```
+// assert(2     == employees.size());
+// assert("Bob" == employees[0].name());
+// assert(21    == employees[0].age());
+// assert("Sue" == employees[1].name());
+// assert(35    == employees[1].age());
+// ```
+
+#include <balscm_version.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                         // ==========================
+                         // struct ParallelDecoderUtil
+                         // ==========================
+
+/// This `struct` provides a namespace for functions that decode sequences of
+/// JSON records in parallel, using a thread pool.
+struct ParallelDecoderUtil {
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Decode each of the specified `records` into the element of the
+    /// specified `result` having the same index, using the specified
+    /// `options` and the threads of the specified `threadPool`.  Return 0 on
+    /// success, and a non-zero value otherwise.  If decoding fails and the
+    /// specified `failedIndex` is not 0, load into `failedIndex` the lowest
+    /// index of a record that could not be decoded.
+    template <class TYPE>
+    static int decodeRecords(
+                          bsl::vector<TYPE>                     *result,
+                          const bsl::vector<bsl::string_view>&   records,
+                          const DecoderOptions&                  options,
+                          bdlmt::FixedThreadPool                *threadPool,
+                          bsl::size_t                           *failedIndex);
+
+  public:
+    // CLASS METHODS
+
+    /// Load into the specified `result` one element per non-blank line of
+    /// the specified `input`, decoded from the JSON record on that line
+    /// using the specified `options`, and using the threads of the
+    /// specified `threadPool`.  A line is blank if it contains only JSON
+    /// whitespace.  Return 0 on success, and a non-zero value otherwise.  If
+    /// decoding fails and the optionally specified `failedIndex` is not 0,
+    /// load into `failedIndex` the lowest index of a record that could not
+    /// be decoded; the contents of `result` are unspecified in that case.
+    /// `TYPE` shall be a `bdeat`-compatible sequence, choice, or array type,
+    /// or a `bdeat`-compatible dynamic type referring to one of those types.
+    /// The behavior is undefined unless the allocator of `result` is
+    /// thread-safe.  Note that the calling thread decodes the records not
+    /// decoded by the threads of `threadPool` (all of them if `threadPool`
+    /// is not enabled), so that this function may be called from a job
+    /// running on `threadPool`.
+    template <class TYPE>
+    static int decodeLines(bsl::vector<TYPE>       *result,
+                           const bsl::string_view&  input,
+                           const DecoderOptions&    options,
+                           bdlmt::FixedThreadPool  *threadPool,
+                           bsl::size_t             *failedIndex = 0);
+
+    /// Load into the specified `result` one element per element of the
+    /// top-level JSON array in the specified `input`, decoded from that
+    /// element using the specified `options`, and using the threads of the
+    /// specified `threadPool`.  Return 0 on success, and a non-zero value
+    /// otherwise.  If decoding fails and the optionally specified
+    /// `failedIndex` is not 0, load into `failedIndex` the lowest index of
+    /// an element that could not be decoded, or the number of elements found
+    /// if `input` could not be split into elements (see `splitArray`); the
+    /// contents of `result` are unspecified in either case.  `TYPE` shall be
+    /// a `bdeat`-compatible sequence, choice, or array type, or a
+    /// `bdeat`-compatible dynamic type referring to one of those types.  The
+    /// behavior is undefined unless the allocator of `result` is
+    /// thread-safe.  Note that the calling thread decodes the elements not
+    /// decoded by the threads of `threadPool` (all of them if `threadPool`
+    /// is not enabled), so that this function may be called from a job
+    /// running on `threadPool`.
+    template <class TYPE>
+    static int decodeArray(bsl::vector<TYPE>       *result,
+                           const bsl::string_view&  input,
+                           const DecoderOptions&    options,
+                           bdlmt::FixedThreadPool  *threadPool,
+                           bsl::size_t             *failedIndex = 0);
+
+    /// Load into the specified `records` the non-blank lines of the
+    /// specified `input`, in order, each excluding its terminating newline
+    /// character.  A line is blank if it contains only JSON whitespace.
+    /// Note that the lines are not otherwise examined.
+    static void splitLines(bsl::vector<bsl::string_view> *records,
+                           const bsl::string_view&        input);
+
+    /// Load into the specified `elements` the elements of the top-level JSON
+    /// array in the specified `input`, in order, each excluding surrounding
+    /// whitespace.  Return 0 on success, and a non-zero value if `input`
+    /// (excluding leading and trailing whitespace) is not a single array, or
+    /// if an element is empty or contains unbalanced brackets, braces, or
+    /// quotation marks, in which case `elements` holds the elements found
+    /// before the error.  Note that the elements are not otherwise
+    /// validated.
+    static int splitArray(bsl::vector<bsl::string_view> *elements,
+                          const bsl::string_view&        input);
+};
+
+                      // ==================================
+                      // class ParallelDecoderUtil_JobState
+                      // ==================================
+
+/// This component-private class holds the state shared by the threads that
+/// decode a sequence of JSON records: the records, the elements of the
+/// result into which they are decoded, the division of the records into
+/// ranges, the next range to be claimed, and the outcome of each range.
+template <class TYPE>
+class ParallelDecoderUtil_JobState {
+
+    // DATA
+    TYPE                     *d_values_p;    // first value (held, not owned)
+    const bsl::string_view   *d_records_p;   // first record (held, not owned)
+    bsl::size_t               d_numRecords;  // number of records
+    const DecoderOptions     *d_options_p;   // options (held, not owned)
+    bsl::vector<bsl::size_t>  d_failures;    // offset of the first failure
+                                             // in each range, or the size of
+                                             // the range
+    bsls::AtomicInt           d_nextRange;   // index of the next range to
+                                             // be claimed
+    bslmt::Latch              d_latch;       // counts down the ranges
+                                             // decoded
+
+    // NOT IMPLEMENTED
+    ParallelDecoderUtil_JobState(const ParallelDecoderUtil_JobState&);
+    ParallelDecoderUtil_JobState& operator=(
+                                          const ParallelDecoderUtil_JobState&);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the first record of the range having the
+    /// specified `range` index.
+    bsl::size_t rangeBegin(bsl::size_t range) const;
+
+  public:
+    // CREATORS
+
+    /// Create a state for decoding the specified `numRecords` `records`
+    /// into the corresponding elements of the specified `values` using the
+    /// specified `options`, divided into the specified `numRanges` ranges.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless
+    /// `0 < numRanges <= numRecords`.
+    ParallelDecoderUtil_JobState(TYPE                   *values,
+                                 const bsl::string_view *records,
+                                 bsl::size_t             numRecords,
+                                 const DecoderOptions   *options,
+                                 int                     numRanges,
+                                 bslma::Allocator       *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Claim and decode ranges of records until every range has been
+    /// claimed.
+    void run();
+
+    /// Block until every range has been decoded.
+    void wait();
+
+    // ACCESSORS
+
+    /// Return the index of the first record that could not be decoded, or
+    /// the number of records if there is none.  The behavior is undefined
+    /// unless `wait` has returned.
+    bsl::size_t failedIndex() const;
+};
+
+                       // =============================
+                       // class ParallelDecoderUtil_Job
+                       // =============================
+
+/// This component-private class provides a functor, to be enqueued on a
+/// thread pool, that decodes ranges of JSON records by calling `run` on a
+/// shared `ParallelDecoderUtil_JobState`, which it keeps alive.
+template <class TYPE>
+class ParallelDecoderUtil_Job {
+
+    // DATA
+    bsl::shared_ptr<ParallelDecoderUtil_JobState<TYPE> > d_state;
+
+  public:
+    // CREATORS
+
+    /// Create a job that decodes ranges of records of the specified `state`.
+    explicit ParallelDecoderUtil_Job(
+                 const bsl::shared_ptr<ParallelDecoderUtil_JobState<TYPE> >&
+                                                                        state);
+
+    // ACCESSORS
+
+    /// Decode the ranges of records of this job's state that are not
+    /// claimed by another thread.
+    void operator()() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct ParallelDecoderUtil
+                         // --------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+int ParallelDecoderUtil::decodeRecords(
+                           bsl::vector<TYPE>                     *result,
+                           const bsl::vector<bsl::string_view>&   records,
+                           const DecoderOptions&                  options,
+                           bdlmt::FixedThreadPool                *threadPool,
+                           bsl::size_t                           *failedIndex)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(threadPool);
+
+    // Use a few more ranges than threads (including the calling thread), so
+    // that a thread that finishes early can take on the ranges not yet
+    // claimed by a slower one.
+
+    enum { k_RANGES_PER_THREAD = 4 };
+
+    const bsl::size_t numRecords = records.size();
+
+    result->clear();
+    result->resize(numRecords);
+
+    if (0 == numRecords) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numThreads = threadPool->numThreads();
+    const int numRanges  = static_cast<int>(bsl::min(
+                         numRecords,
+                         static_cast<bsl::size_t>(numThreads + 1) *
+                                                         k_RANGES_PER_THREAD));
+
+    // The state is allocated from the default allocator, rather than that of
+    // 'result', since jobs that start after this function returns still hold
+    // it.
+
+    bsl::shared_ptr<ParallelDecoderUtil_JobState<TYPE> > state;
+    state.createInplace(bslma::Default::defaultAllocator(),
+                        result->data(),
+                        records.data(),
+                        numRecords,
+                        &options,
+                        numRanges,
+                        bslma::Default::defaultAllocator());
+
+    // A job that cannot be enqueued (e.g., because the queue is full or the
+    // pool is not enabled) is not needed, since the calling thread decodes
+    // every range not claimed by a thread of the pool.
+
+    const ParallelDecoderUtil_Job<TYPE> job(state);
+    for (int i = 0; i < numThreads && i + 1 < numRanges; ++i) {
+        if (0 != threadPool->tryEnqueueJob(bsl::function<void()>(job))) {
+            break;
+        }
+    }
+
+    state->run();
+    state->wait();
+
+    const bsl::size_t failed = state->failedIndex();
+    if (failed < numRecords) {
+        if (failedIndex) {
+            *failedIndex = failed;
+        }
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+// CLASS METHODS
+template <class TYPE>
+int ParallelDecoderUtil::decodeLines(bsl::vector<TYPE>       *result,
+                                     const bsl::string_view&  input,
+                                     const DecoderOptions&    options,
+                                     bdlmt::FixedThreadPool  *threadPool,
+                                     bsl::size_t             *failedIndex)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(threadPool);
+
+    bsl::vector<bsl::string_view> records(result->get_allocator());
+    splitLines(&records, input);
+
+    return decodeRecords(result, records, options, threadPool, failedIndex);
+}
+
+template <class TYPE>
+int ParallelDecoderUtil::decodeArray(bsl::vector<TYPE>       *result,
+                                     const bsl::string_view&  input,
+                                     const DecoderOptions&    options,
+                                     bdlmt::FixedThreadPool  *threadPool,
+                                     bsl::size_t             *failedIndex)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(threadPool);
+
+    bsl::vector<bsl::string_view> records(result->get_allocator());
+    if (0 != splitArray(&records, input)) {
+        if (failedIndex) {
+            *failedIndex = records.size();
+        }
+        return -1;                                                    // RETURN
+    }
+
+    return decodeRecords(result, records, options, threadPool, failedIndex);
+}
+
+                      // ----------------------------------
+                      // class ParallelDecoderUtil_JobState
+                      // ----------------------------------
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t ParallelDecoderUtil_JobState<TYPE>::rangeBegin(
+                                                       bsl::size_t range) const
+{
+    return d_numRecords * range / d_failures.size();
+}
+
+// CREATORS
+template <class TYPE>
+ParallelDecoderUtil_JobState<TYPE>::ParallelDecoderUtil_JobState(
+                                        TYPE                   *values,
+                                        const bsl::string_view *records,
+                                        bsl::size_t             numRecords,
+                                        const DecoderOptions   *options,
+                                        int                     numRanges,
+                                        bslma::Allocator       *basicAllocator)
+: d_values_p(values)
+, d_records_p(records)
+, d_numRecords(numRecords)
+, d_options_p(options)
+, d_failures(numRanges, 0, basicAllocator)
+, d_nextRange(0)
+, d_latch(numRanges)
+{
+    BSLS_ASSERT(0 < numRanges);
+    BSLS_ASSERT(static_cast<bsl::size_t>(numRanges) <= numRecords);
+}
+
+// MANIPULATORS
+template <class TYPE>
+void ParallelDecoderUtil_JobState<TYPE>::run()
+{
+    const int numRanges = static_cast<int>(d_failures.size());
+
+    Decoder decoder;
+
+    for (int range = d_nextRange.add(1) - 1;
+         range < numRanges;
+         range = d_nextRange.add(1) - 1) {
+        const bsl::size_t begin = rangeBegin(range);
+        const bsl::size_t end   = rangeBegin(range + 1);
+
+        bsl::size_t i = begin;
+        for (; i < end; ++i) {
+            bdlsb::FixedMemInStreamBuf streamBuf(d_records_p[i].data(),
+                                                 d_records_p[i].size());
+
+            if (0 != decoder.decode(&streamBuf,
+                                    d_values_p + i,
+                                    *d_options_p)) {
+                break;
+            }
+        }
+
+        d_failures[range] = i - begin;
+        d_latch.arrive();
+    }
+}
+
+template <class TYPE>
+inline
+void ParallelDecoderUtil_JobState<TYPE>::wait()
+{
+    d_latch.wait();
+}
+
+// ACCESSORS
+template <class TYPE>
+bsl::size_t ParallelDecoderUtil_JobState<TYPE>::failedIndex() const
+{
+    for (bsl::size_t range = 0; range < d_failures.size(); ++range) {
+        const bsl::size_t begin = rangeBegin(range);
+
+        if (begin + d_failures[range] < rangeBegin(range + 1)) {
+            return begin + d_failures[range];                         // RETURN
+        }
+    }
+
+    return d_numRecords;
+}
+
+                       // -----------------------------
+                       // class ParallelDecoderUtil_Job
+                       // -----------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ParallelDecoderUtil_Job<TYPE>::ParallelDecoderUtil_Job(
+                 const bsl::shared_ptr<ParallelDecoderUtil_JobState<TYPE> >&
+                                                                         state)
+: d_state(state)
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+void ParallelDecoderUtil_Job<TYPE>::operator()() const
+{
+    d_state->run();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
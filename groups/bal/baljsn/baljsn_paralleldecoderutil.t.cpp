@@ -0,0 +1,849 @@
+// baljsn_paralleldecoderutil.t.cpp                                   -*-C++-*-
+#include <baljsn_paralleldecoderutil.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_employee.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a utility that decodes sequences of JSON
+// records, laid out either one per line or as the elements of a top-level
+// array, on the threads of a thread pool.  The functions that split the input
+// into records are tested first, on their own, using tables of inputs.  The
+// decoding functions are then tested by comparing their results with those of
+// decoding each record with `baljsn::Decoder` on the calling thread, for
+// various numbers of records and threads, with inputs containing invalid
+// records, and from jobs running on the thread pool that is used.
+//
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int decodeLines(vector<TYPE> *, string_view, options, pool *, *);
+// [ 4] int decodeArray(vector<TYPE> *, string_view, options, pool *, *);
+// [ 1] void splitLines(bsl::vector<bsl::string_view> *, string_view);
+// [ 2] int splitArray(bsl::vector<bsl::string_view> *, string_view);
+// ----------------------------------------------------------------------------
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::ParallelDecoderUtil Util;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the JSON encoding, on a single line, of an address whose fields
+/// are derived from the specified `index`.
+bsl::string makeAddressRecord(int index)
+{
+    char buffer[128];
+    bsl::sprintf(buffer,
+                 "{\"street\":\"%d Main St\",\"city\":\"City %d\","
+                 "\"state\":\"S%d\"}",
+                 index,
+                 index % 97,
+                 index % 50);
+    return buffer;
+}
+
+/// Return a string holding the records obtained by concatenating the
+/// results of `makeAddressRecord` for the indices `[0, numRecords)`, each
+/// preceded by the specified `prefix` (except for the first) and followed
+/// by the specified `suffix`, and the whole surrounded by the specified
+/// `begin` and `end`.
+bsl::string makeInput(int         numRecords,
+                      const char *begin,
+                      const char *prefix,
+                      const char *suffix,
+                      const char *end)
+{
+    bsl::string result(begin);
+    for (int i = 0; i < numRecords; ++i) {
+        if (i) {
+            result += prefix;
+        }
+        result += makeAddressRecord(i);
+        result += suffix;
+    }
+    result += end;
+    return result;
+}
+
+/// Decode each of the specified `records` on the calling thread and append
+/// the results to the specified `result`.  Return 0 on success, and a
+/// non-zero value otherwise.
+int decodeSerially(bsl::vector<s_baltst::Address>       *result,
+                   const bsl::vector<bsl::string_view>&  records)
+{
+    baljsn::Decoder        decoder;
+    baljsn::DecoderOptions options;
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        bdlsb::FixedMemInStreamBuf streamBuf(records[i].data(),
+                                             records[i].size());
+
+        result->push_back(s_baltst::Address());
+        if (0 != decoder.decode(&streamBuf, &result->back(), options)) {
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+/// Decode the lines of the specified `input` into the specified `result`
+/// using the specified `threadPool`, and load the status returned by
+/// `decodeLines` into the specified `status`.
+void decodeLinesJob(bsl::vector<s_baltst::Address> *result,
+                    int                            *status,
+                    const bsl::string              *input,
+                    bdlmt::FixedThreadPool         *threadPool)
+{
+    *status = Util::decodeLines(result,
+                                *input,
+                                baljsn::DecoderOptions(),
+                                threadPool);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout  << endl
+                           << "USAGE EXAMPLE" << endl
+                           << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Newline-Delimited JSON
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a file in which each line is the JSON encoding of
+// an employee record of the (`bas_codegen.pl`-generated) type
+// `s_baltst::Employee`, and we want to make use of several processors to
+// decode it.
+//
+// First, we create and start a thread pool:
+// ```
+    bdlmt::FixedThreadPool threadPool(4, 100);
+    int rc = threadPool.start();
+    ASSERT(0 == rc);
+// ```
+// Then, we obtain the contents of the file (here, from a string literal):
+// ```
+    const char INPUT[] =
+        "{\"name\":\"Bob\",\"homeAddress\":{\"street\":\"Some Street\","
+        "\"city\":\"Some City\",\"state\":\"Some State\"},\"age\":21}\n"
+        "{\"name\":\"Sue\",\"homeAddress\":{\"street\":\"Other Street\","
+        "\"city\":\"Other City\",\"state\":\"Other State\"},\"age\":35}\n";
+// ```
+// Next, we decode the records into a vector:
+// ```
+    bsl::vector<s_baltst::Employee> employees;
+    baljsn::DecoderOptions          options;
+
+    rc = baljsn::ParallelDecoderUtil::decodeLines(&employees,
+                                                  INPUT,
+                                                  options,
+                                                  &threadPool);
+    ASSERT(0 == rc);
+// ```
+// Finally, we verify the decoded records:
+// ```
+    ASSERT(2     == employees.size());
+    ASSERT("Bob" == employees[0].name());
+    ASSERT(21    == employees[0].age());
+    ASSERT("Sue" == employees[1].name());
+    ASSERT(35    == employees[1].age());
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DECODE ARRAY
+        //
+        // Concerns:
+        // 1. Each element of the top-level array is decoded into the element
+        //    of the result having the same index, with the same value as
+        //    `baljsn::Decoder` produces for that element on its own.
+        //
+        // 2. The result is correct for any number of elements, including 0,
+        //    and for any number of threads.
+        //
+        // 3. If an element cannot be decoded, the function fails and reports
+        //    the lowest index of such an element.
+        //
+        // 4. If the input is not a well-formed array, the function fails and
+        //    reports the number of elements found before the error.
+        //
+        // 5. If the thread pool is not enabled, the elements are decoded by
+        //    the calling thread.
+        //
+        // Plan:
+        // 1. For a range of numbers of elements and threads, build an array of
+        //    address records, decode it with `decodeArray`, and compare the
+        //    result with decoding each element with `baljsn::Decoder`.
+        //    (C-1..2)
+        //
+        // 2. Corrupt one or two elements of an array, and verify the result
+        //    and the reported index.  (C-3)
+        //
+        // 3. Decode an array that is not terminated.  (C-4)
+        //
+        // 4. Decode an array using a thread pool that has not been started.
+        //    (C-5)
+        //
+        // Testing:
+        //   int decodeArray(vector<TYPE> *, string_view, options, pool *, *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODE ARRAY" << endl
+                          << "============" << endl;
+
+        baljsn::DecoderOptions options;
+
+        const int NUM_RECORDS[] = { 0, 1, 2, 3, 7, 16, 100, 1000 };
+        const int NUM_THREADS[] = { 1, 2, 3, 8 };
+
+        for (bsl::size_t ti = 0;
+             ti < sizeof NUM_THREADS / sizeof *NUM_THREADS;
+             ++ti) {
+            bdlmt::FixedThreadPool threadPool(NUM_THREADS[ti], 1000);
+            ASSERT(0 == threadPool.start());
+
+            for (bsl::size_t ri = 0;
+                 ri < sizeof NUM_RECORDS / sizeof *NUM_RECORDS;
+                 ++ri) {
+                const int N = NUM_RECORDS[ri];
+
+                if (veryVerbose) { T_ P_(NUM_THREADS[ti]) P(N) }
+
+                const bsl::string input = makeInput(N, " [ ", ",\n", " ", "]");
+
+                bsl::vector<bsl::string_view> records;
+                ASSERTV(N, 0 == Util::splitArray(&records, input));
+
+                bsl::vector<s_baltst::Address> expected;
+                ASSERTV(N, 0 == decodeSerially(&expected, records));
+
+                bsl::vector<s_baltst::Address> result(3);
+                bsl::size_t                    failedIndex = 99;
+                ASSERTV(N, 0 == Util::decodeArray(&result,
+                                                  input,
+                                                  options,
+                                                  &threadPool,
+                                                  &failedIndex));
+                ASSERTV(N, expected == result);
+                ASSERTV(N, 99 == failedIndex);
+            }
+        }
+
+        if (verbose) cout << "\nInvalid elements." << endl;
+        {
+            bdlmt::FixedThreadPool threadPool(3, 1000);
+            ASSERT(0 == threadPool.start());
+
+            const int N = 100;
+
+            bsl::string input = makeInput(N, "[", ",", "", "]");
+
+            bsl::vector<bsl::string_view> records;
+            ASSERT(0 == Util::splitArray(&records, input));
+
+            // Replace the first ':' of elements 57 and 83 with a ',', which
+            // leaves the structure of the array intact.
+
+            input[records[83].data() + records[83].find(':') - input.data()] =
+                                                                           ',';
+            input[records[57].data() + records[57].find(':') - input.data()] =
+                                                                           ',';
+
+            bsl::vector<s_baltst::Address> result;
+            bsl::size_t                    failedIndex = 0;
+            ASSERT(0 != Util::decodeArray(&result,
+                                          input,
+                                          options,
+                                          &threadPool,
+                                          &failedIndex));
+            ASSERTV(failedIndex, 57 == failedIndex);
+
+            ASSERT(0 != Util::decodeArray(&result,
+                                          input,
+                                          options,
+                                          &threadPool));
+        }
+
+        if (verbose) cout << "\nUnterminated array." << endl;
+        {
+            bdlmt::FixedThreadPool threadPool(2, 1000);
+            ASSERT(0 == threadPool.start());
+
+            const bsl::string input = makeInput(5, "[", ",", "", "");
+
+            bsl::vector<s_baltst::Address> result;
+            bsl::size_t                    failedIndex = 0;
+            ASSERT(0 != Util::decodeArray(&result,
+                                          input,
+                                          options,
+                                          &threadPool,
+                                          &failedIndex));
+            ASSERTV(failedIndex, 4 == failedIndex);
+        }
+
+        if (verbose) cout << "\nDisabled thread pool." << endl;
+        {
+            bdlmt::FixedThreadPool threadPool(2, 1000);
+
+            const bsl::string input = makeInput(10, "[", ",", "", "]");
+
+            bsl::vector<bsl::string_view> records;
+            ASSERT(0 == Util::splitArray(&records, input));
+
+            bsl::vector<s_baltst::Address> expected;
+            ASSERT(0 == decodeSerially(&expected, records));
+
+            bsl::vector<s_baltst::Address> result;
+            ASSERT(0 == Util::decodeArray(&result,
+                                          input,
+                                          options,
+                                          &threadPool));
+            ASSERT(expected == result);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECODE LINES
+        //
+        // Concerns:
+        // 1. Each non-blank line is decoded into the element of the result
+        //    having the same index, with the same value as `baljsn::Decoder`
+        //    produces for that line on its own.
+        //
+        // 2. The result is correct for any number of records, including 0,
+        //    and for any number of threads.
+        //
+        // 3. If a record cannot be decoded, the function fails and reports
+        //    the lowest index of such a record.
+        //
+        // 4. The memory used by the decoded values is supplied by the
+        //    allocator of the result.
+        //
+        // 5. The function may be called from jobs running on the thread pool
+        //    it uses, even if every thread of the pool is running such a job.
+        //
+        // Plan:
+        // 1. For a range of numbers of records and threads, build an input
+        //    having one address record per line, with blank lines and
+        //    whitespace in between, decode it with `decodeLines`, and compare
+        //    the result with decoding each line with `baljsn::Decoder`.
+        //    (C-1..2)
+        //
+        // 2. Corrupt one or two records, and verify the result and the
+        //    reported index.  (C-3)
+        //
+        // 3. Supply a result vector using a test allocator, and verify that
+        //    it is used.  (C-4)
+        //
+        // 4. For thread pools of 1 and 3 threads, enqueue as many jobs as
+        //    there are threads, each calling `decodeLines` with the same pool,
+        //    wait for the pool to become idle, and verify the results.  (C-5)
+        //
+        // Testing:
+        //   int decodeLines(vector<TYPE> *, string_view, options, pool *, *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODE LINES" << endl
+                          << "============" << endl;
+
+        baljsn::DecoderOptions options;
+
+        const int NUM_RECORDS[] = { 0, 1, 2, 3, 7, 16, 100, 1000 };
+        const int NUM_THREADS[] = { 1, 2, 3, 8 };
+
+        for (bsl::size_t ti = 0;
+             ti < sizeof NUM_THREADS / sizeof *NUM_THREADS;
+             ++ti) {
+            bdlmt::FixedThreadPool threadPool(NUM_THREADS[ti], 1000);
+            ASSERT(0 == threadPool.start());
+
+            for (bsl::size_t ri = 0;
+                 ri < sizeof NUM_RECORDS / sizeof *NUM_RECORDS;
+                 ++ri) {
+                const int N = NUM_RECORDS[ri];
+
+                if (veryVerbose) { T_ P_(NUM_THREADS[ti]) P(N) }
+
+                const bsl::string input =
+                                     makeInput(N, "\n \n", "\r\n\t", " ", "");
+
+                bsl::vector<bsl::string_view> records;
+                Util::splitLines(&records, input);
+                ASSERTV(N, records.size(), N == (int)records.size());
+
+                bsl::vector<s_baltst::Address> expected;
+                ASSERTV(N, 0 == decodeSerially(&expected, records));
+
+                bsl::vector<s_baltst::Address> result(3);
+                ASSERTV(N, 0 == Util::decodeLines(&result,
+                                                  input,
+                                                  options,
+                                                  &threadPool));
+                ASSERTV(N, expected == result);
+            }
+        }
+
+        if (verbose) cout << "\nInvalid records." << endl;
+        {
+            bdlmt::FixedThreadPool threadPool(3, 1000);
+            ASSERT(0 == threadPool.start());
+
+            const int N = 100;
+
+            bsl::string input = makeInput(N, "", "\n", "", "\n");
+
+            bsl::vector<bsl::string_view> records;
+            Util::splitLines(&records, input);
+            ASSERT(N == (int)records.size());
+
+            // Truncate records 12 and 90 by replacing their last character.
+
+            input[records[90].data() + records[90].size() - 1 -
+                                                         input.data()] = ' ';
+            input[records[12].data() + records[12].size() - 1 -
+                                                         input.data()] = ' ';
+
+            bsl::vector<s_baltst::Address> result;
+            bsl::size_t                    failedIndex = 0;
+            ASSERT(0 != Util::decodeLines(&result,
+                                          input,
+                                          options,
+                                          &threadPool,
+                                          &failedIndex));
+            ASSERTV(failedIndex, 12 == failedIndex);
+        }
+
+        if (verbose) cout << "\nAllocator of the result." << endl;
+        {
+            bdlmt::FixedThreadPool threadPool(2, 1000);
+            ASSERT(0 == threadPool.start());
+
+            bslma::TestAllocator ta("result", veryVeryVerbose);
+
+            // Use records whose strings are too long for the short-string
+            // optimization.
+
+            const bsl::string input =
+                "{\"street\":\"A street name long enough to allocate\"}\n"
+                "{\"city\":\"A city name that is long enough to allocate\"}\n";
+
+            {
+                bsl::vector<s_baltst::Address> result(&ta);
+                ASSERT(0 == Util::decodeLines(&result,
+                                              input,
+                                              options,
+                                              &threadPool));
+                ASSERT(2 == result.size());
+                ASSERT(&ta == result[0].street().get_allocator().mechanism());
+                ASSERT(&ta == result[1].city().get_allocator().mechanism());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nCalls from jobs on the thread pool." << endl;
+        {
+            const int N = 200;
+
+            const bsl::string input = makeInput(N, "", "\n", "", "\n");
+
+            bsl::vector<bsl::string_view> records;
+            Util::splitLines(&records, input);
+
+            bsl::vector<s_baltst::Address> expected;
+            ASSERT(0 == decodeSerially(&expected, records));
+
+            const int NUM_THREADS[] = { 1, 3 };
+
+            for (bsl::size_t ti = 0;
+                 ti < sizeof NUM_THREADS / sizeof *NUM_THREADS;
+                 ++ti) {
+                const int NT = NUM_THREADS[ti];
+
+                if (veryVerbose) { T_ P(NT) }
+
+                bdlmt::FixedThreadPool threadPool(NT, 1000);
+                ASSERT(0 == threadPool.start());
+
+                bsl::vector<bsl::vector<s_baltst::Address> > results(NT);
+                bsl::vector<int>                             status(NT, -1);
+
+                for (int i = 0; i < NT; ++i) {
+                    ASSERT(0 == threadPool.enqueueJob(
+                                       bdlf::BindUtil::bind(&decodeLinesJob,
+                                                            &results[i],
+                                                            &status[i],
+                                                            &input,
+                                                            &threadPool)));
+                }
+
+                threadPool.drain();
+
+                for (int i = 0; i < NT; ++i) {
+                    ASSERTV(NT, i, status[i], 0 == status[i]);
+                    ASSERTV(NT, i, expected == results[i]);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SPLIT ARRAY
+        //
+        // Concerns:
+        // 1. The elements of a top-level array are found, excluding
+        //    surrounding whitespace, regardless of their type.
+        //
+        // 2. Commas and brackets within nested values and within strings
+        //    (including after escaped quotation marks) do not end an element.
+        //
+        // 3. An input that is not a single array, that has an empty element,
+        //    or that has unbalanced delimiters is rejected.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, split a set of inputs, and
+        //    verify the status and the elements found.  (C-1..3)
+        //
+        // Testing:
+        //   int splitArray(bsl::vector<bsl::string_view> *, string_view);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SPLIT ARRAY" << endl
+                          << "===========" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input;     // input
+            int         d_status;    // expected status (0 or -1)
+            const char *d_elements;  // expected elements, separated by '|'
+        } DATA[] = {
+            //LINE  INPUT                     STATUS  ELEMENTS
+            //----  ------------------------  ------  -------------------
+            { L_,   "[]",                          0, ""                  },
+            { L_,   " \n[ \t]\r\n",                0, ""                  },
+            { L_,   "[1]",                         0, "1"                 },
+            { L_,   "[ 1 , 2 ]",                   0, "1|2"               },
+            { L_,   "[{},[],\"\",null]",           0, "{}|[]|\"\"|null"   },
+            { L_,   "[{\"a\":[1,2]},{\"b\":{}}]",  0,
+                                                  "{\"a\":[1,2]}|{\"b\":{}}" },
+            { L_,   "[\"a,b]\",\"c}\"]",           0, "\"a,b]\"|\"c}\""   },
+            { L_,   "[\"a\\\",b\",1]",             0, "\"a\\\",b\"|1"     },
+            { L_,   "[\"a\\\\\",1]",               0, "\"a\\\\\"|1"       },
+            { L_,   "[[[1],[2]],[3]]",             0, "[[1],[2]]|[3]"     },
+
+            { L_,   "",                           -1, ""                  },
+            { L_,   "  ",                         -1, ""                  },
+            { L_,   "{}",                         -1, ""                  },
+            { L_,   "[",                          -1, ""                  },
+            { L_,   "[1",                         -1, ""                  },
+            { L_,   "[1,2",                       -1, "1"                 },
+            { L_,   "[1,]",                       -1, "1"                 },
+            { L_,   "[,1]",                       -1, ""                  },
+            { L_,   "[1,,2]",                     -1, "1"                 },
+            { L_,   "[1}",                        -1, ""                  },
+            { L_,   "[{]",                        -1, ""                  },
+            { L_,   "[\"abc]",                    -1, ""                  },
+            { L_,   "[\"abc\\\"]",                -1, ""                  },
+            { L_,   "[1] 2",                      -1, "1"                 },
+            { L_,   "[1][2]",                     -1, "1"                 },
+            { L_,   "[] x",                       -1, ""                  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *INPUT    = DATA[ti].d_input;
+            const int   STATUS   = DATA[ti].d_status;
+            const char *ELEMENTS = DATA[ti].d_elements;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bsl::vector<bsl::string_view> elements;
+            elements.push_back("garbage");
+
+            const int status = Util::splitArray(&elements, INPUT);
+            ASSERTV(LINE, status, STATUS == status);
+
+            bsl::string joined;
+            for (bsl::size_t i = 0; i < elements.size(); ++i) {
+                if (i) {
+                    joined += '|';
+                }
+                joined.append(elements[i].data(), elements[i].size());
+            }
+            ASSERTV(LINE, joined, ELEMENTS == joined);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // SPLIT LINES
+        //
+        // Concerns:
+        // 1. Each non-blank line is found, excluding surrounding whitespace
+        //    and its terminating newline character.
+        //
+        // 2. Blank lines, including lines holding only whitespace, are
+        //    skipped.
+        //
+        // 3. The last line need not be terminated.
+        //
+        // 4. The contents of lines are not otherwise examined.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, split a set of inputs, and
+        //    verify the lines found.  (C-1..4)
+        //
+        // Testing:
+        //   void splitLines(bsl::vector<bsl::string_view> *, string_view);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SPLIT LINES" << endl
+                          << "===========" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input;    // input
+            const char *d_records;  // expected records, separated by '|'
+        } DATA[] = {
+            //LINE  INPUT                          RECORDS
+            //----  -----------------------------  ----------------------
+            { L_,   "",                            ""                     },
+            { L_,   "\n",                          ""                     },
+            { L_,   " \t\r\n\n  \n",               ""                     },
+            { L_,   "{}",                          "{}"                   },
+            { L_,   "{}\n",                        "{}"                   },
+            { L_,   "{}\r\n[]\r\n",                "{}|[]"                },
+            { L_,   "\n\n {\"a\":1} \n\n[2]",      "{\"a\":1}|[2]"        },
+            { L_,   "a b\nc",                      "a b|c"                },
+            { L_,   "{\n}",                        "{|}"                  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *INPUT   = DATA[ti].d_input;
+            const char *RECORDS = DATA[ti].d_records;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bsl::vector<bsl::string_view> records;
+            records.push_back("garbage");
+
+            Util::splitLines(&records, INPUT);
+
+            bsl::string joined;
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                if (i) {
+                    joined += '|';
+                }
+                joined.append(records[i].data(), records[i].size());
+            }
+            ASSERTV(LINE, joined, RECORDS == joined);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Decoding newline-delimited JSON on several threads is faster
+        //    than decoding it on one.
+        //
+        // Plan:
+        // 1. Decode a large number of records, using thread pools of
+        //    increasing size, and report the elapsed time for each.  The
+        //    number of threads is given by the second argument, if any.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int MAX_THREADS = argc > 2 ? bsl::atoi(argv[2]) : 4;
+        const int N           = 200000;
+
+        const bsl::string input = makeInput(N, "", "\n", "", "\n");
+
+        baljsn::DecoderOptions options;
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            bdlmt::FixedThreadPool threadPool(numThreads, 1000);
+            ASSERT(0 == threadPool.start());
+
+            bsl::vector<s_baltst::Address> result;
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            ASSERT(0 == Util::decodeLines(&result,
+                                          input,
+                                          options,
+                                          &threadPool));
+
+            timer.stop();
+
+            ASSERT(N == (int)result.size());
+
+            cout << "threads: " << numThreads
+                 << "\trecords/s: "
+                 << static_cast<int>(N / timer.elapsedTime()) << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
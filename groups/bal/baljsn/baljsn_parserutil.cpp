@@ -250,24 +250,11 @@ int ParserUtil::getValue(double *value, const bsl::string_view& data)
         return u::loadInfOrNan(value, data);                          // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
-
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bdlb::CharType::isDigit(*(dataString.end() - 1))) {
+    double           tmp;
+    bsl::string_view rest;
+    if (0 != bdlb::NumericParseUtil::parseDouble(&tmp, &rest, data)
+     || !rest.empty()
+     || !bdlb::CharType::isDigit(data[data.length() - 1])) {
         return -1;                                                    // RETURN
     }
 
@@ -502,9 +489,12 @@ int ParserUtil::getValue(bsl::vector<char>       *value,
     value->resize(static_cast<bsl::size_t>(
                               bdlde::Base64Decoder::maxDecodedLength(length)));
 
-    rc = base64Decoder.convert(value->begin(),
-                               base64String.begin(),
-                               base64String.end());
+    // Supply `const char *` input so that the decoder translates the data a
+    // block at a time.
+
+    rc = base64Decoder.convert(value->data(),
+                               base64String.cbegin(),
+                               base64String.cend());
 
     if (rc < 0) {
         return rc;                                                    // RETURN
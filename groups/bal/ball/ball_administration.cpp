@@ -7,6 +7,7 @@ BSLS_IDENT_RCSID(ball_administration_cpp,"$Id$ $CSID$")
 #include <ball_categorymanager.h>
 #include <ball_loggercategoryutil.h>
 #include <ball_loggermanager.h>
+#include <ball_samplingpolicy.h>
 
 #include <bsls_assert.h>
 
@@ -84,6 +85,20 @@ int Administration::setThresholdLevels(const char *pattern,
                                                   triggerAllLevel);
 }
 
+int Administration::setSamplingPolicy(const char            *pattern,
+                                      const SamplingPolicy&  policy)
+{
+    return LoggerCategoryUtil::setSamplingPolicy(&LoggerManager::singleton(),
+                                                 pattern,
+                                                 policy);
+}
+
+int Administration::publishSamplingSummaries()
+{
+    return LoggerCategoryUtil::publishSamplingSummaries(
+                                                &LoggerManager::singleton());
+}
+
 void Administration::resetDefaultThresholdLevels()
 {
     LoggerManager::singleton().resetDefaultThresholdLevels();
@@ -141,6 +156,21 @@ int Administration::triggerAllLevel(const char *categoryName)
     return category ? category->triggerAllLevel() : FAILURE;
 }
 
+int Administration::samplingPolicy(SamplingPolicy *result,
+                                   const char     *categoryName)
+{
+    BSLS_ASSERT(result);
+
+    enum { FAILURE = -1 };
+    const Category *category =
+                  LoggerManager::singleton().lookupCategory(categoryName);
+    if (!category) {
+        return FAILURE;                                               // RETURN
+    }
+    *result = category->samplingPolicy();
+    return 0;
+}
+
 int Administration::maxNumCategories()
 {
     return LoggerManager::singleton().maxNumCategories();
@@ -18,10 +18,13 @@ BSLS_IDENT("$Id: $")
 // are provided for adding a category to the registry maintained by the
 // singleton instance of `ball::LoggerManager` (hereafter the "logger
 // manager"), for setting the threshold levels of one or more categories, for
-// setting a limit on the maximum number of categories allowed, and for
-// retrieving the threshold levels of (established) categories.  Note that a
-// precondition of all of the utility functions is that the logger manager
-// singleton must be initialized and not in the process of being shut down.
+// setting the sampling policy of one or more categories and publishing the
+// summaries of the records suppressed by those policies, for setting a limit
+// on the maximum number of categories allowed, and for retrieving the
+// threshold levels and sampling policies of (established) categories.  Note
+// that a precondition of all of the utility functions is that the logger
+// manager singleton must be initialized and not in the process of being shut
+// down.
 //
 ///Usage
 ///-----
@@ -173,6 +176,8 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace ball {
 
+class SamplingPolicy;
+
                       // =====================
                       // struct Administration
                       // =====================
@@ -249,6 +254,35 @@ struct Administration {
                                   int         triggerLevel,
                                   int         triggerAllLevel);
 
+    /// Set the sampling policy of each category currently in the registry
+    /// of the logger manager singleton whose name matches the specified
+    /// `pattern` to the specified `policy`.  Return the number of
+    /// categories whose sampling policy was set.  `pattern` is assumed to
+    /// be of the form "X" or "X*" where X is a sequence of 0 or more
+    /// characters and `*` matches any string (including the empty string).
+    /// The behavior is undefined unless the logger manager singleton has
+    /// been initialized and is not in the process of being shut down.  Note
+    /// that setting an inactive policy (e.g., `SamplingPolicy()`) restores
+    /// the publication of every record logged to the matching categories.
+    /// Also note that this function has no effect on the sampling policy of
+    /// categories added to the registry after it is called.  See
+    /// `ball_recordsampler` for how the policy is applied by the logging
+    /// macros, and for when suppressed records are reported.
+    static int setSamplingPolicy(const char            *pattern,
+                                 const SamplingPolicy&  policy);
+
+    /// Log to each category in the registry of the logger manager singleton
+    /// whose sampling period has elapsed with records suppressed a summary
+    /// record that reports the number of those records, and return the
+    /// number of summary records logged.  The behavior is undefined unless
+    /// the logger manager singleton has been initialized and is not in the
+    /// process of being shut down.  Note that this function is intended to
+    /// be called periodically (e.g., by a `bdlmt::EventScheduler`), so that
+    /// suppressed records are reported even if no further record is logged
+    /// to their category.  See
+    /// `LoggerCategoryUtil::publishSamplingSummaries` for details.
+    static int publishSamplingSummaries();
+
     /// Reset the default threshold levels to the original
     /// "factory-supplied" values.  The behavior is undefined unless the
     /// logger manager singleton has been initialized and is not in the
@@ -283,6 +317,15 @@ struct Administration {
     /// process of being shut down.
     static int triggerAllLevel(const char *categoryName);
 
+    /// Load into the specified `result` the sampling policy currently set
+    /// for the category having the specified `categoryName`.  Return 0 on
+    /// success, and a non-zero value, with no effect on `result`, if no
+    /// such category exists.  The behavior is undefined unless the logger
+    /// manager singleton has been initialized and is not in the process of
+    /// being shut down.
+    static int samplingPolicy(SamplingPolicy *result,
+                              const char     *categoryName);
+
     /// Return the default record threshold level.  The behavior is
     /// undefined unless the logger manager singleton has been initialized
     /// and is not in the process of being shut down.
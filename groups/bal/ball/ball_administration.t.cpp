@@ -3,14 +3,23 @@
 
 #include <ball_loggermanager.h>
 #include <ball_loggermanagerconfiguration.h>
+#include <ball_recordsampler.h>
+#include <ball_samplingpolicy.h>
 #include <ball_severity.h>
+#include <ball_testobserver.h>
 
 #include <bslim_testutil.h>
 
+#include <bslmt_threadutil.h>
+
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_cstring.h>
 
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
 
 using namespace BloombergLP;
@@ -48,8 +57,11 @@ using namespace bsl;
 // [ 2] static int maxNumCategories();
 // [ 1] static int numCategories();
 // [ 2] static void setMaxNumCategories(int length);
+// [ 4] static int setSamplingPolicy(const char *, const SamplingPolicy&);
+// [ 4] static int samplingPolicy(SamplingPolicy *, const char *);
+// [ 5] static int publishSamplingSummaries();
 //-----------------------------------------------------------------------------
-// [ 3] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -129,6 +141,26 @@ const int   DEFAULT_TRIGGERALL_THRESHOLD_LEVEL    = 0;
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+/// Request the admission of the specified `numRecords` records from the
+/// record sampler of the category having the specified `categoryName` in
+/// the logger manager singleton, and return the number of records admitted.
+/// The behavior is undefined unless that category exists and has a sampler.
+int admitRecords(const char *categoryName, int numRecords)
+{
+    const ball::Category *category =
+                ball::LoggerManager::singleton().lookupCategory(categoryName);
+    ball::RecordSampler  *sampler  = category->sampler();
+
+    int numAdmitted = 0;
+    for (int i = 0; i < numRecords; ++i) {
+        bsls::Types::Int64 numSuppressed;
+        if (sampler->admit(&numSuppressed)) {
+            ++numAdmitted;
+        }
+    }
+    return numAdmitted;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -143,7 +175,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 4: {
+      case 6: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -314,6 +346,216 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING: publishSamplingSummaries
+        //
+        // Concerns:
+        // 1. `publishSamplingSummaries` logs a summary record to each
+        //    category whose sampling period has elapsed with records
+        //    suppressed, without another record being logged to it, and
+        //    returns the number of summaries logged.
+        //
+        // 2. A summary is reported only once, and no summary is logged for a
+        //    category whose period has not elapsed, that has no sampler, or
+        //    that suppressed no records.
+        //
+        // 3. A summary is logged at the pass threshold level of its
+        //    category, or at `e_INFO` if that level is less severe.
+        //
+        // Plan:
+        // 1. Register a test observer, and set policies having a short and a
+        //    long period on a few categories.  Suppress records in some of
+        //    them, wait for the short period to elapse, publish the
+        //    summaries, and verify the return value and the record
+        //    published.  (C-1..3)
+        //
+        // 2. Publish the summaries again, and verify that nothing is
+        //    logged.  (C-2)
+        //
+        // 3. Repeat P-1..2 for a category having a different pass threshold
+        //    level.  (C-1..3)
+        //
+        // Testing:
+        //   static int publishSamplingSummaries();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing publishSamplingSummaries" << endl
+                          << "================================" << endl;
+
+        ball::LoggerManagerConfiguration lmConfig;
+        ball::LoggerManagerScopedGuard   lmGuard(lmConfig);
+        ball::LoggerManager&             manager =
+                                             ball::LoggerManager::singleton();
+
+        bsl::shared_ptr<ball::TestObserver> observer =
+                                 bsl::make_shared<ball::TestObserver>(&cout);
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        const int TRACE = ball::Severity::e_TRACE;
+        const int INFO  = ball::Severity::e_INFO;
+        const int WARN  = ball::Severity::e_WARN;
+
+        ASSERT(0 == Obj::addCategory("SHORT.TRACE", 0, TRACE, 0, 0));
+        ASSERT(0 == Obj::addCategory("SHORT.WARN",  0, WARN,  0, 0));
+        ASSERT(0 == Obj::addCategory("SHORT.IDLE",  0, TRACE, 0, 0));
+        ASSERT(0 == Obj::addCategory("LONG",        0, TRACE, 0, 0));
+        ASSERT(0 == Obj::addCategory("OTHER",       0, TRACE, 0, 0));
+
+        ASSERT(3 == Obj::setSamplingPolicy(
+                                "SHORT*",
+                                ball::SamplingPolicy(
+                                             1,
+                                             1,
+                                             bsls::TimeInterval(0, 1000000))));
+        ASSERT(1 == Obj::setSamplingPolicy(
+                                "LONG",
+                                ball::SamplingPolicy(
+                                               1,
+                                               1,
+                                               bsls::TimeInterval(3600, 0))));
+
+        ASSERT(1 == admitRecords("SHORT.TRACE", 5));
+        ASSERT(1 == admitRecords("LONG", 5));
+
+        bslmt::ThreadUtil::microSleep(20 * 1000);
+
+        ASSERT(0 == observer->numPublishedRecords());
+
+        ASSERT(1 == Obj::publishSamplingSummaries());
+        ASSERT(1 == observer->numPublishedRecords());
+        {
+            const ball::RecordAttributes& attributes =
+                                observer->lastPublishedRecord().fixedFields();
+
+            ASSERTV(attributes.category(),
+                    0 == bsl::strcmp("SHORT.TRACE", attributes.category()));
+            ASSERTV(attributes.severity(), INFO == attributes.severity());
+            ASSERTV(attributes.message(),
+                    0 == bsl::strcmp(
+                           "--- 4 RECORD(S) SUPPRESSED BY SAMPLING POLICY ---",
+                           attributes.message()));
+        }
+
+        ASSERT(0 == Obj::publishSamplingSummaries());
+        ASSERT(1 == observer->numPublishedRecords());
+
+        ASSERT(1 == admitRecords("SHORT.WARN", 3));
+
+        bslmt::ThreadUtil::microSleep(20 * 1000);
+
+        ASSERT(1 == Obj::publishSamplingSummaries());
+        ASSERT(2 == observer->numPublishedRecords());
+        {
+            const ball::RecordAttributes& attributes =
+                                observer->lastPublishedRecord().fixedFields();
+
+            ASSERTV(attributes.category(),
+                    0 == bsl::strcmp("SHORT.WARN", attributes.category()));
+            ASSERTV(attributes.severity(), WARN == attributes.severity());
+            ASSERTV(attributes.message(),
+                    0 == bsl::strcmp(
+                           "--- 2 RECORD(S) SUPPRESSED BY SAMPLING POLICY ---",
+                           attributes.message()));
+        }
+
+        ASSERT(0 == Obj::publishSamplingSummaries());
+        ASSERT(2 == observer->numPublishedRecords());
+        ASSERT(0 == manager.lookupCategory("OTHER")->sampler());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING: setSamplingPolicy
+        //
+        // Concerns:
+        // 1. `setSamplingPolicy` sets the policy of exactly the categories
+        //    matching the supplied pattern, and returns their number.
+        //
+        // 2. `samplingPolicy` returns the policy of an existing category, and
+        //    fails for a non-existent one.
+        //
+        // 3. The sampler of each category having an active policy applies
+        //    that policy, and categories having no policy have no sampler.
+        //
+        // 4. Setting an inactive policy ends the current period.
+        //
+        // Plan:
+        // 1. Create categories, set a rate-limiting policy on a subset of
+        //    them using a pattern, and verify the return value and the
+        //    policies of all categories.  (C-1..2)
+        //
+        // 2. Request the admission of records from the samplers of the
+        //    categories, and verify the number of records admitted.  (C-3)
+        //
+        // 3. Make the policy inactive, request the admission of another
+        //    record, and verify that it is admitted and reports the number
+        //    of records suppressed.  (C-4)
+        //
+        // Testing:
+        //   static int setSamplingPolicy(const char *, const SamplingPolicy&);
+        //   static int samplingPolicy(SamplingPolicy *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "Testing setSamplingPolicy" << endl
+                                  << "=========================" << endl;
+
+        ball::LoggerManagerConfiguration lmConfig;
+        ball::LoggerManagerScopedGuard   lmGuard(lmConfig);
+        ball::LoggerManager&             manager =
+                                             ball::LoggerManager::singleton();
+
+        const int PASS = ball::Severity::e_TRACE;
+
+        ASSERT(0 == Obj::addCategory("SAMPLE.A", 0, PASS, 0, 0));
+        ASSERT(0 == Obj::addCategory("SAMPLE.B", 0, PASS, 0, 0));
+        ASSERT(0 == Obj::addCategory("OTHER",    0, PASS, 0, 0));
+
+        const ball::SamplingPolicy POLICY(1, 2, bsls::TimeInterval(3600, 0));
+
+        ASSERT(2 == Obj::setSamplingPolicy("SAMPLE*", POLICY));
+        ASSERT(0 == Obj::setSamplingPolicy("NONE", POLICY));
+
+        ball::SamplingPolicy policy;
+        ASSERT(0 == Obj::samplingPolicy(&policy, "SAMPLE.A"));
+        ASSERT(POLICY == policy);
+        ASSERT(0 == Obj::samplingPolicy(&policy, "SAMPLE.B"));
+        ASSERT(POLICY == policy);
+        ASSERT(0 == Obj::samplingPolicy(&policy, "OTHER"));
+        ASSERT(ball::SamplingPolicy() == policy);
+        ASSERT(0 != Obj::samplingPolicy(&policy, "NONE"));
+        ASSERT(ball::SamplingPolicy() == policy);
+
+        const ball::Category *sampled = manager.lookupCategory("SAMPLE.A");
+        const ball::Category *other   = manager.lookupCategory("OTHER");
+
+        ASSERT(0 == other->sampler());
+
+        ball::RecordSampler *sampler = sampled->sampler();
+        ASSERT(0 != sampler);
+
+        if (sampler) {
+            ASSERT(POLICY == sampler->policy());
+
+            bsls::Types::Int64 numSuppressed;
+            int                numAdmitted = 0;
+
+            for (int i = 0; i < 10; ++i) {
+                if (sampler->admit(&numSuppressed)) {
+                    ++numAdmitted;
+                }
+                ASSERTV(numSuppressed, 0 == numSuppressed);
+            }
+            ASSERTV(numAdmitted, 2 == numAdmitted);
+
+            ASSERT(1 == Obj::setSamplingPolicy("SAMPLE.A",
+                                               ball::SamplingPolicy()));
+            ASSERT(sampler == sampled->sampler());
+
+            ASSERT(sampler->admit(&numSuppressed));
+            ASSERTV(numSuppressed, 8 == numSuppressed);
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING: setAllThresholdLevels
@@ -347,11 +347,9 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
     BSLS_ASSERT(levels);
     BSLS_ASSERT(category);
 
-    // Set the default levels for 'category'.
-    levels->setLevels(category->recordLevel(),
-                      category->passLevel(),
-                      category->triggerLevel(),
-                      category->triggerAllLevel());
+    // Set the default levels for 'category'.  Note that the levels are
+    // obtained from a single (lock-free) snapshot of the category thresholds.
+    *levels = category->thresholdLevels();
 
     RuleSet::MaskType relevantRulesMask = category->relevantRuleMask();
 
@@ -41,21 +41,35 @@ Category::Category(const char       *categoryName,
                    int               triggerLevel,
                    int               triggerAllLevel,
                    bslma::Allocator *basicAllocator)
-: d_thresholdLevels(recordLevel, passLevel, triggerLevel, triggerAllLevel)
+: d_leadingPad()
+, d_thresholdLevels(packLevels(recordLevel,
+                               passLevel,
+                               triggerLevel,
+                               triggerAllLevel))
 , d_threshold(ThresholdAggregate::maxLevel(recordLevel,
                                            passLevel,
                                            triggerLevel,
                                            triggerAllLevel))
-, d_categoryName(categoryName, basicAllocator)
-, d_categoryHolder_p(0)
 , d_relevantRuleMask()
 , d_ruleThreshold(0)
+, d_sampler_p(0)
+, d_pad()
+, d_categoryName(categoryName, basicAllocator)
+, d_categoryHolder_p(0)
 , d_mutex()
 {
     BSLS_ASSERT(categoryName);
     bsls::AtomicOperations::initUint(&d_relevantRuleMask, 0);
 }
 
+Category::~Category()
+{
+    RecordSampler *sampler = d_sampler_p.loadRelaxed();
+    if (sampler) {
+        d_categoryName.get_allocator().mechanism()->deleteObject(sampler);
+    }
+}
+
 // PRIVATE MANIPULATORS
 void
 Category::linkCategoryHolder(CategoryHolder *categoryHolder)
@@ -65,7 +79,7 @@ Category::linkCategoryHolder(CategoryHolder *categoryHolder)
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     if (!categoryHolder->category()) {
         categoryHolder->setThreshold(bsl::max(d_threshold.loadRelaxed(),
-                                              d_ruleThreshold));
+                                              d_ruleThreshold.loadRelaxed()));
         categoryHolder->setCategory(this);
         categoryHolder->setNext(d_categoryHolder_p);
         d_categoryHolder_p = categoryHolder;
@@ -94,7 +108,7 @@ void Category::updateThresholdForHolders()
     if (d_categoryHolder_p) {
         CategoryHolder *holder = d_categoryHolder_p;
         const int       threshold = bsl::max(d_threshold.loadRelaxed(),
-                                             d_ruleThreshold);
+                                             d_ruleThreshold.loadRelaxed());
         if (threshold != holder->threshold()) {
             do {
                 holder->setThreshold(threshold);
@@ -116,10 +130,10 @@ int Category::setLevels(int recordLevel,
                                           triggerAllLevel)) {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-        d_thresholdLevels.setLevels(recordLevel,
-                                    passLevel,
-                                    triggerLevel,
-                                    triggerAllLevel);
+        d_thresholdLevels.storeRelease(packLevels(recordLevel,
+                                                  passLevel,
+                                                  triggerLevel,
+                                                  triggerAllLevel));
 
         d_threshold = ThresholdAggregate::maxLevel(recordLevel,
                                                    passLevel,
@@ -133,6 +147,30 @@ int Category::setLevels(int recordLevel,
     return -1;
 }
 
+void Category::setSamplingPolicy(const SamplingPolicy& policy)
+{
+    RecordSampler *sampler = d_sampler_p.loadAcquire();
+
+    if (!sampler) {
+        if (!policy.isActive()) {
+            return;                                                   // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        sampler = d_sampler_p.loadRelaxed();
+        if (!sampler) {
+            bslma::Allocator *allocator =
+                                    d_categoryName.get_allocator().mechanism();
+
+            d_sampler_p.storeRelease(new (*allocator) RecordSampler(policy));
+            return;                                                   // RETURN
+        }
+    }
+
+    sampler->setPolicy(policy);
+}
+
                         // --------------------
                         // class CategoryHolder
                         // --------------------
@@ -94,7 +94,9 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <ball_recordsampler.h>
 #include <ball_ruleset.h>
+#include <ball_samplingpolicy.h>
 #include <ball_thresholdaggregate.h>
 
 #include <bdlb_bitutil.h>
@@ -106,6 +108,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bslmt_platform.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
@@ -133,32 +136,80 @@ class CategoryHolder;
 /// `ball_attributecontext`).  They are not meant to be modified by users
 /// of the logging system, and may be modified by `const` operations of the
 /// logging system.
+///
+/// Implementation Note: The members read by logging threads (the four
+/// threshold levels, their maximum, the rule threshold, the relevant rule
+/// mask, and the record sampler) are atomic, so that reading them never
+/// blocks.  They are preceded and followed by a full cache line of padding,
+/// so that, wherever the allocator places a `Category` object, no cache
+/// line holding them also holds the mutex-protected members or the data of
+/// a neighbouring object; locking the mutex (e.g., while rules are
+/// re-evaluated) therefore does not invalidate the cache lines from which
+/// they are read.  (The object is allocated by `CategoryManager` from an
+/// allocator that does not honor over-alignment, so the members cannot
+/// instead be aligned on a cache-line boundary.)  The four threshold levels
+/// are packed into a single word so that a consistent snapshot of them can
+/// be obtained with a single atomic load.
 class Category {
 
+    // PRIVATE TYPES
+    enum {
+        // bit offsets of the threshold levels in `d_thresholdLevels`
+
+        k_RECORD_SHIFT      = 24,
+        k_PASS_SHIFT        = 16,
+        k_TRIGGER_SHIFT     =  8,
+        k_TRIGGER_ALL_SHIFT =  0,
+
+        k_LEVEL_MASK        = 0xff
+    };
+
     // DATA
-    ThresholdAggregate    d_thresholdLevels; // record, pass, trigger, and
-                                             // trigger-all levels
+    char                  d_leadingPad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                             // padding to prevent the
+                                             // subsequent data from being in
+                                             // the same cache line as the
+                                             // data preceding this object
+
+    bsls::AtomicUint      d_thresholdLevels; // record, pass, trigger, and
+                                             // trigger-all levels, packed
 
     bsls::AtomicInt       d_threshold;       // numerical maximum of the four
                                              // levels
 
-    const bsl::string     d_categoryName;    // category name
-
-    CategoryHolder       *d_categoryHolder_p; // linked list of holders of this
-                                              // category
-
     mutable bsls::AtomicOperations::AtomicTypes::Uint
                           d_relevantRuleMask; // the mask indicating which
                                               // rules are relevant (i.e., have
                                               // been attached to this
                                               // category)
 
-    mutable int           d_ruleThreshold;    // numerical maximum of all four
+    mutable bsls::AtomicInt
+                          d_ruleThreshold;    // numerical maximum of all four
                                               // levels for all relevant rules
 
+    bsls::AtomicPointer<RecordSampler>
+                          d_sampler_p;        // sampler applying the sampling
+                                              // policy of this category, or 0
+                                              // if no policy was ever set
+                                              // (owned)
+
+    char                  d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                              // padding to prevent the
+                                              // subsequent (mutex-protected)
+                                              // data from being in the same
+                                              // cache line as the prior data
+
+    const bsl::string     d_categoryName;    // category name
+
+    CategoryHolder       *d_categoryHolder_p; // linked list of holders of this
+                                              // category
+
     mutable bslmt::Mutex  d_mutex;            // mutex providing mutually
-                                              // exclusive access to all
-                                              // non-atomic members
+                                              // exclusive access to
+                                              // `d_categoryHolder_p`, and
+                                              // serializing modifications of
+                                              // the thresholds and the
+                                              // creation of the sampler
 
     // FRIENDS
     friend class CategoryManagerImpUtil;
@@ -168,6 +219,21 @@ class Category {
     Category& operator=(const Category&);
 
   private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the specified `recordLevel`, `passLevel`, `triggerLevel`, and
+    /// `triggerAllLevel` packed into a single value suitable for storing in
+    /// `d_thresholdLevels`.  The behavior is undefined unless each of the
+    /// levels is in the range `[0 .. 255]`.
+    static unsigned int packLevels(int recordLevel,
+                                   int passLevel,
+                                   int triggerLevel,
+                                   int triggerAllLevel);
+
+    /// Return the threshold aggregate represented by the specified
+    /// `packedLevels` value obtained from `packLevels`.
+    static ThresholdAggregate unpackLevels(unsigned int packedLevels);
+
     // PRIVATE MANIPULATORS
 
     /// Load this category and its corresponding `maxLevel()` into the
@@ -219,7 +285,7 @@ class Category {
              bslma::Allocator *basicAllocator = 0);
 
     /// Destroy this object.
-    //! ~Category() = default;
+    ~Category();
 
     // MANIPULATORS
 
@@ -233,6 +299,18 @@ class Category {
                   int triggerLevel,
                   int triggerAllLevel);
 
+    /// Set the sampling policy applied to the records logged to this
+    /// category to the specified `policy`.  The first time an active
+    /// `policy` is set, a record sampler is created for this category (see
+    /// `sampler`); that sampler is retained, and updated in place, for the
+    /// lifetime of this category.  Note that the policy is applied by the
+    /// logging macros (see `Log::isRecordAdmitted`), and that the number of
+    /// records suppressed during a period is reported when the next record
+    /// is logged to this category, or by
+    /// `Administration::publishSamplingSummaries` (see
+    /// `ball_recordsampler`).
+    void setSamplingPolicy(const SamplingPolicy& policy);
+
     // ACCESSORS
 
     // BDE_VERIFY pragma: push
@@ -288,6 +366,16 @@ class Category {
     /// applies to this category if the rule's pattern matches the name
     /// returned by `categoryName`.
     RuleSet::MaskType relevantRuleMask() const;
+
+    /// Return the address of the modifiable record sampler that applies
+    /// the sampling policy of this category, or 0 if no active sampling
+    /// policy has ever been set for this category.  Note that the returned
+    /// sampler remains valid for the lifetime of this category.
+    RecordSampler *sampler() const;
+
+    /// Return the sampling policy applied to the records logged to this
+    /// category.
+    SamplingPolicy samplingPolicy() const;
     // BDE_VERIFY pragma: pop
 };
 
@@ -443,6 +531,29 @@ class CategoryManagerImpUtil {
 // BDE_VERIFY pragma: push
 // BDE_VERIFY pragma: -FABC01: Functions not in alphanumeric order
 
+// PRIVATE CLASS METHODS
+inline
+unsigned int Category::packLevels(int recordLevel,
+                                  int passLevel,
+                                  int triggerLevel,
+                                  int triggerAllLevel)
+{
+    return static_cast<unsigned int>(recordLevel)     << k_RECORD_SHIFT
+         | static_cast<unsigned int>(passLevel)       << k_PASS_SHIFT
+         | static_cast<unsigned int>(triggerLevel)    << k_TRIGGER_SHIFT
+         | static_cast<unsigned int>(triggerAllLevel) << k_TRIGGER_ALL_SHIFT;
+}
+
+inline
+ThresholdAggregate Category::unpackLevels(unsigned int packedLevels)
+{
+    return ThresholdAggregate(packedLevels >> k_RECORD_SHIFT  & k_LEVEL_MASK,
+                              packedLevels >> k_PASS_SHIFT    & k_LEVEL_MASK,
+                              packedLevels >> k_TRIGGER_SHIFT & k_LEVEL_MASK,
+                              packedLevels >> k_TRIGGER_ALL_SHIFT
+                                                               & k_LEVEL_MASK);
+}
+
 // CLASS METHODS
 inline
 bool Category::areValidThresholdLevels(int recordLevel,
@@ -478,36 +589,32 @@ int Category::maxLevel() const
 inline
 int Category::recordLevel() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_thresholdLevels.recordLevel();
+    return d_thresholdLevels.loadAcquire() >> k_RECORD_SHIFT & k_LEVEL_MASK;
 }
 
 inline
 int Category::passLevel() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_thresholdLevels.passLevel();
+    return d_thresholdLevels.loadAcquire() >> k_PASS_SHIFT & k_LEVEL_MASK;
 }
 
 inline
 int Category::triggerLevel() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_thresholdLevels.triggerLevel();
+    return d_thresholdLevels.loadAcquire() >> k_TRIGGER_SHIFT & k_LEVEL_MASK;
 }
 
 inline
 int Category::triggerAllLevel() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_thresholdLevels.triggerAllLevel();
+    return d_thresholdLevels.loadAcquire() >> k_TRIGGER_ALL_SHIFT
+                                                                & k_LEVEL_MASK;
 }
 
 inline
 ThresholdAggregate Category::thresholdLevels() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_thresholdLevels;
+    return unpackLevels(d_thresholdLevels.loadAcquire());
 }
 
 inline
@@ -519,8 +626,7 @@ int Category::threshold() const
 inline
 int Category::ruleThreshold() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    return d_ruleThreshold;
+    return d_ruleThreshold.loadAcquire();
 }
 
 inline
@@ -529,6 +635,19 @@ RuleSet::MaskType Category::relevantRuleMask() const
     return bsls::AtomicOperations::getUintAcquire(&d_relevantRuleMask);
 }
 
+inline
+RecordSampler *Category::sampler() const
+{
+    return d_sampler_p.loadAcquire();
+}
+
+inline
+SamplingPolicy Category::samplingPolicy() const
+{
+    const RecordSampler *sampler = d_sampler_p.loadAcquire();
+    return sampler ? sampler->policy() : SamplingPolicy();
+}
+
                         // --------------------
                         // class CategoryHolder
                         // --------------------
@@ -610,7 +729,7 @@ void CategoryManagerImpUtil::setRuleThreshold(Category *category,
                                               int       ruleThreshold)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&category->d_mutex);
-    category->d_ruleThreshold = ruleThreshold;
+    category->d_ruleThreshold.storeRelease(ruleThreshold);
 }
 
 inline
@@ -12,13 +12,16 @@ BSLS_IDENT_RCSID(ball_log_cpp,"$Id$ $CSID$")
 #include <ball_loggercategoryutil.h>
 #include <ball_loggermanagerconfiguration.h>  // for testing only
 #include <ball_record.h>
+#include <ball_recordsampler.h>
 #include <ball_streamobserver.h>              // for testing only
 #include <ball_testobserver.h>                // for testing only
+#include <ball_thresholdaggregate.h>
 
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdarg.h>
 #include <bsl_cstdio.h>
@@ -37,6 +40,53 @@ namespace ball {
                          // ----------
 
 // CLASS METHODS
+bool Log::admitSampledRecord(const Category&  category,
+                             int              severity,
+                             const char      *fileName,
+                             int              lineNumber)
+{
+    RecordSampler *sampler = category.sampler();
+
+    BSLS_ASSERT(sampler);
+
+    if (!LoggerManager::isInitialized()) {
+        return true;                                                  // RETURN
+    }
+
+    // Records that trigger the publication of buffered records are never
+    // suppressed.
+
+    ThresholdAggregate levels;
+    if (category.relevantRuleMask()) {
+        AttributeContext::getContext()->determineThresholdLevels(&levels,
+                                                                 &category);
+    }
+    else {
+        levels = category.thresholdLevels();
+    }
+
+    if (severity <= levels.triggerLevel()
+     || severity <= levels.triggerAllLevel()) {
+        return true;                                                  // RETURN
+    }
+
+    bsls::Types::Int64 numSuppressed;
+    const bool         admitted = sampler->admit(&numSuppressed);
+
+    if (0 < numSuppressed) {
+        char message[96];
+        RecordSampler::formatSummary(message, sizeof message, numSuppressed);
+
+        LoggerManager::singleton().getLogger().logMessage(category,
+                                                          severity,
+                                                          fileName,
+                                                          lineNumber,
+                                                          message);
+    }
+
+    return admitted;
+}
+
 int Log::format(char *buffer, bsl::size_t numBytes, const char *format, ...)
 {
     bsl::va_list args;
@@ -314,8 +364,11 @@ Log_Formatter::~Log_Formatter()
 // been destroyed.  The 'isCategoryEnabled' method performs a more-refined
 // (but relatively cheap, in the vast majority of cases) analysis of whether a
 // record must actually be logged.  Only if 'isCategoryEnabled' returns 'true'
-// is a 'ball::Log_Stream' object constructed (or a 'ball::Log_Formatter'
-// object in the case of the 'printf'-style macros) and a record logged.
+// (and 'isRecordAdmitted' admits the record under the sampling policy of the
+// category, if any) is a 'ball::Log_Stream' object constructed (or a
+// 'ball::Log_Formatter' object in the case of the 'printf'-style macros) and
+// a record logged.  Note that 'isRecordAdmitted' loads only the sampler
+// pointer of the category unless a sampling policy has been set.
 //
 // Note that the above condition is *always* 'true' for dynamic categories.
 // Since category holders for dynamic categories are not 'static', as are
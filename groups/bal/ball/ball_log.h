@@ -1106,8 +1106,10 @@ namespace {                                                                   \
 
 #define BALL_LOG_STREAM_CONST_IMP(SEVERITY)                                   \
 for (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =       \
-               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
-                        ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER)); \
+               BloombergLP::ball::Log::categoryHolderIfAdmitted<(SEVERITY)>(  \
+                        ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER),  \
+                        __FILE__,                                             \
+                        __LINE__);                                            \
      ball_log_cAtEgOrYhOlDeR;                                                 \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
@@ -1127,7 +1129,11 @@ for (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =       \
      ball_log_cAtEgOrYhOlDeR                                                  \
      && ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY)                    \
      && BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR,    \
-                                                  (SEVERITY));                \
+                                                  (SEVERITY))                 \
+     && BloombergLP::ball::Log::isRecordAdmitted(ball_log_cAtEgOrYhOlDeR,     \
+                                                 (SEVERITY),                  \
+                                                 __FILE__,                    \
+                                                 __LINE__);                   \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
                                          ball_log_cAtEgOrYhOlDeR->category(), \
@@ -1199,8 +1205,10 @@ for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
 
 #define BALL_LOGCB_STREAM_CONST_IMP(SEVERITY, CALLBACK)                       \
 for (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =       \
-               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
-                        ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER)); \
+               BloombergLP::ball::Log::categoryHolderIfAdmitted<(SEVERITY)>(  \
+                        ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER),  \
+                        __FILE__,                                             \
+                        __LINE__);                                            \
      ball_log_cAtEgOrYhOlDeR;                                                 \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
@@ -1221,7 +1229,11 @@ for (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =       \
      ball_log_cAtEgOrYhOlDeR                                                  \
      && ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY)                    \
      && BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR,    \
-                                                  (SEVERITY));                \
+                                                  (SEVERITY))                 \
+     && BloombergLP::ball::Log::isRecordAdmitted(ball_log_cAtEgOrYhOlDeR,     \
+                                                 (SEVERITY),                  \
+                                                 __FILE__,                    \
+                                                 __LINE__);                   \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
                                          ball_log_cAtEgOrYhOlDeR->category(), \
@@ -1308,8 +1320,10 @@ for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
 #define BALL_LOGVA_CONST_IMP(SEVERITY, ...)                                   \
 do {                                                                          \
     if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
-               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
-                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+               BloombergLP::ball::Log::categoryHolderIfAdmitted<(SEVERITY)>(  \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER),    \
+                      __FILE__,                                               \
+                      __LINE__)) {                                            \
         BloombergLP::ball::Log_Formatter ball_log_fOrMaTtEr(                  \
                                        ball_log_cAtEgOrYhOlDeR->category(),   \
                                        __FILE__,                              \
@@ -1334,7 +1348,11 @@ do {                                                                          \
                          ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
     if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
            BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
-                                                     (SEVERITY))) {           \
+                                                     (SEVERITY)) &&           \
+           BloombergLP::ball::Log::isRecordAdmitted(ball_log_cAtEgOrYhOlDeR,  \
+                                                    (SEVERITY),               \
+                                                    __FILE__,                 \
+                                                    __LINE__)) {              \
         BloombergLP::ball::Log_Formatter ball_log_fOrMaTtEr(                  \
                                        ball_log_cAtEgOrYhOlDeR->category(),   \
                                        __FILE__,                              \
@@ -1535,6 +1553,19 @@ struct Log {
     /// initialized.
     static const Category *setCategory(const char *categoryName);
 
+    /// Return `true` if a record logged to the specified `category` at the
+    /// specified `severity` is admitted by the sampling policy of
+    /// `category`, and `false` otherwise.  If this call ends a sampling
+    /// period during which records were suppressed, first log to `category`
+    /// at `severity` a summary record, having the specified `fileName` and
+    /// `lineNumber`, that reports the number of records suppressed.  The
+    /// behavior is undefined unless `category.sampler()` is non-zero.  Note
+    /// that this method is an implementation detail of `isRecordAdmitted`.
+    static bool admitSampledRecord(const Category&  category,
+                                   int              severity,
+                                   const char      *fileName,
+                                   int              lineNumber);
+
     /// Return the specified `categoryHolder` if the severity warrants
     /// logging according to the specified `t_SEVERITY` and
     /// `categoryHolder`, and 0 otherwise.
@@ -1542,6 +1573,18 @@ struct Log {
     static const CategoryHolder *categoryHolderIfEnabled(
                                          const CategoryHolder *categoryHolder);
 
+    /// Return the specified `categoryHolder` if the severity warrants
+    /// logging according to the specified `t_SEVERITY` and
+    /// `categoryHolder`, and a record logged at `t_SEVERITY`, having the
+    /// specified `fileName` and `lineNumber`, is admitted by the sampling
+    /// policy of the associated category (see `isRecordAdmitted`); return
+    /// 0 otherwise.
+    template <int t_SEVERITY>
+    static const CategoryHolder *categoryHolderIfAdmitted(
+                                          const CategoryHolder *categoryHolder,
+                                          const char           *fileName,
+                                          int                   lineNumber);
+
     /// Load into the specified `categoryHolder` the address of the
     /// non-modifiable category having the specified `categoryName` if such
     /// a category exists, or if a new category having `categoryName` can
@@ -1597,6 +1640,25 @@ struct Log {
     /// singleton is not initialized; return `false` otherwise.
     static bool isCategoryEnabled(const CategoryHolder *categoryHolder,
                                   int                   severity);
+
+    /// Return `true` if a record logged, at the specified `severity`, to
+    /// the category associated with the specified `categoryHolder` is
+    /// admitted by the sampling policy of that category (see
+    /// `Category::setSamplingPolicy`), and `false` otherwise.  If this call
+    /// ends a sampling period during which records were suppressed, first
+    /// log a summary record, having the specified `fileName` and
+    /// `lineNumber`, that reports the number of records suppressed.  Records
+    /// whose `severity` is at least as severe as the trigger or trigger-all
+    /// threshold level of the category are always admitted, as are all
+    /// records if the category has no sampling policy, or if the logger
+    /// manager singleton is not initialized.  The behavior is undefined
+    /// unless `isCategoryEnabled(categoryHolder, severity)` is `true`.  Note
+    /// that the logging macros call this method before the record is
+    /// created, so that suppressed records are never formatted.
+    static bool isRecordAdmitted(const CategoryHolder *categoryHolder,
+                                 int                   severity,
+                                 const char           *fileName,
+                                 int                   lineNumber);
 };
 
                         // ================
@@ -1813,6 +1875,38 @@ const CategoryHolder *Log::categoryHolderIfEnabled(
     return 0;
 }
 
+template <int t_SEVERITY>
+inline
+const CategoryHolder *Log::categoryHolderIfAdmitted(
+                                          const CategoryHolder *categoryHolder,
+                                          const char           *fileName,
+                                          int                   lineNumber)
+{
+    const CategoryHolder *holder =
+                          categoryHolderIfEnabled<t_SEVERITY>(categoryHolder);
+
+    return holder
+        && Log::isRecordAdmitted(holder, t_SEVERITY, fileName, lineNumber)
+           ? holder
+           : 0;
+}
+
+inline
+bool Log::isRecordAdmitted(const CategoryHolder *categoryHolder,
+                           int                   severity,
+                           const char           *fileName,
+                           int                   lineNumber)
+{
+    const Category *category = categoryHolder->category();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!category
+                                            || !category->sampler())) {
+        return true;                                                  // RETURN
+    }
+
+    return admitSampledRecord(*category, severity, fileName, lineNumber);
+}
+
 inline
 const Category *Log::setCategoryHierarchically(const char *categoryName)
 {
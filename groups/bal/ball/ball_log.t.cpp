@@ -12,6 +12,7 @@
 #include <ball_record.h>
 #include <ball_recordstringformatter.h>
 #include <ball_rule.h>
+#include <ball_samplingpolicy.h>
 #include <ball_scopedattribute.h>
 #include <ball_streamobserver.h>
 #include <ball_testobserver.h>
@@ -51,6 +52,7 @@
 #include <bsls_keyword.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
@@ -167,15 +169,18 @@ using bsl::flush;
 // [34] BALL_LOG_SET_DYNAMIC_CATEGORY_HIERARCHICALLY(const char *);
 // [34] BALL_LOG_SET_CATEGORY_HIERARCHICALLY(const char *);
 // [35] BALL_LOG_SET_CLASS_CATEGORY_HIERARCHICALLY(const char *);
+// [37] bool isRecordAdmitted(Holder *, int, const char *, int);
 // ----------------------------------------------------------------------------
 // [30] CONCERN: `BALL_LOG_*_BLOCK` MACROS
 // [31] CONCERN: `BALL_LOGCB_*_BLOCK` MACROS
 // [32] CONCERN: DEGENERATE LOG MACROS USAGE
 // [36] CONCERN: The logging macros can be used recursively
-// [37] USAGE EXAMPLE
-// [38] RULE-BASED LOGGING USAGE EXAMPLE
-// [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
-// [40] BASIC LOGGING USAGE EXAMPLE
+// [37] CONCERN: Records suppressed by sampling are not formatted
+// [38] USAGE EXAMPLE
+// [39] RULE-BASED LOGGING USAGE EXAMPLE
+// [40] CLASS-SCOPE LOGGING USAGE EXAMPLE
+// [41] BASIC LOGGING USAGE EXAMPLE
+// [-3] PERFORMANCE: DISABLED LOG STATEMENTS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -953,6 +958,28 @@ void recurseCallbackMacrosCallback(BloombergLP::ball::UserFields      *fields,
 
 }  // close namespace BALL_LOG_TEST_CASE_35
 
+// ============================================================================
+//                         CASE 37 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_37 {
+
+int numEvaluations = 0;
+
+/// Increment the number of evaluations, and return the new number.
+int evaluate()
+{
+    return ++numEvaluations;
+}
+
+/// Do nothing with the specified `fields`.
+void noopCallback(BloombergLP::ball::UserFields *fields)
+{
+    (void)fields;
+}
+
+}  // close namespace BALL_LOG_TEST_CASE_37
+
 // ============================================================================
 //            HIERARCHICAL CATEGORIES -- CASE 32, CASE 33, CASE 34
 // ----------------------------------------------------------------------------
@@ -2898,6 +2925,60 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+BloombergLP::bsls::AtomicBool done(false);
+
+/// Repeatedly add and remove a logging rule, and change the thresholds of
+/// an unrelated category, until `done` is set.  Note that the rule does
+/// *not* apply to the category used by `disabledTraceLoop`.
+extern "C" void *ruleChurnThread(void *)
+{
+    using namespace BloombergLP;  // okay here
+
+    ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+    ball::Rule rule("CHURN*",
+                    ball::Severity::e_TRACE,
+                    ball::Severity::e_TRACE,
+                    ball::Severity::e_TRACE,
+                    ball::Severity::e_TRACE);
+
+    int level = 0;
+    while (!done) {
+        manager.addRule(rule);
+        manager.removeRule(rule);
+        ball::Administration::setThresholdLevels("CHURN.OTHER",
+                                                 level,
+                                                 ball::Severity::e_OFF,
+                                                 ball::Severity::e_OFF,
+                                                 ball::Severity::e_OFF);
+        level = (level + 1) % (ball::Severity::e_TRACE + 1);
+    }
+    return 0;
+}
+
+/// Invoke a disabled `BALL_LOG_TRACE` statement the specified
+/// `numIterations` times, and return the number of nanoseconds taken.
+BloombergLP::bsls::Types::Int64 disabledTraceLoop(int numIterations)
+{
+    using namespace BloombergLP;  // okay here
+
+    BALL_LOG_SET_CATEGORY("PERFORMANCE.DISABLED");
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numIterations; ++i) {
+        BALL_LOG_TRACE << "disabled " << i;
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2915,7 +2996,7 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 40: {
+      case 41: {
         // --------------------------------------------------------------------
         // BASIC LOGGING USAGE EXAMPLE
         //
@@ -2991,7 +3072,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
 // logging configuration.  The special macro `BALL_LOG_OUTPUT_STREAM` provides
 // access to the log stream within the code.
       } break;
-      case 39: {
+      case 40: {
         // --------------------------------------------------------------------
         // CLASS-SCOPE LOGGING USAGE EXAMPLE
         //
@@ -3058,7 +3139,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
         }
 
       } break;
-      case 38: {
+      case 39: {
         // --------------------------------------------------------------------
         // RULE-BASED LOGGING USAGE EXAMPLE
         //
@@ -3135,7 +3216,7 @@ if (verbose) bsl::cout << "Example 1: A Basic Logging Example" << bsl::endl;
 //  ERROR example.cpp:129 EXAMPLE.CATEGORY Processing the third message.
 // ```
       } break;
-      case 37: {
+      case 38: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -3392,6 +3473,144 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
         }
 
       } break;
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING SAMPLING IN THE LOGGING MACROS
+        //
+        // Concerns:
+        // 1. The logging macros apply the sampling policy of the category
+        //    before the record is created, so that the message of a
+        //    suppressed record is never formatted.
+        //
+        // 2. Every flavor of logging macro applies the policy.
+        //
+        // 3. Records at least as severe as the trigger or trigger-all
+        //    threshold level of the category are never suppressed.
+        //
+        // 4. Records logged directly through the logger are not sampled.
+        //
+        // 5. The number of suppressed records is reported in a summary record
+        //    logged before the record that starts a new period.
+        //
+        // Plan:
+        // 1. Set a rate-limiting policy on a category, log records to it
+        //    using the various macros, with messages that count their own
+        //    evaluation, and verify the output of a stream observer and the
+        //    number of evaluations.  (C-1..4)
+        //
+        // 2. Make the policy inactive, log another record, and verify that a
+        //    summary record reporting the suppressed records is published
+        //    before it.  (C-5)
+        //
+        // Testing:
+        //   bool isRecordAdmitted(Holder *, int, const char *, int);
+        //   CONCERN: Records suppressed by sampling are not formatted
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "TESTING SAMPLING IN THE LOGGING MACROS\n"
+                               << "======================================\n";
+
+        using namespace BALL_LOG_TEST_CASE_37;
+
+        typedef BloombergLP::ball::StreamObserver  StreamObserver;
+        typedef BloombergLP::ball::SamplingPolicy  SamplingPolicy;
+
+        TestAllocator ta(veryVeryVeryVerbose);
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        BloombergLP::ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        LoggerManager& manager = LoggerManager::singleton();
+
+        bsl::ostringstream              os(&ta);
+        bsl::shared_ptr<StreamObserver> observer(
+                                       new (ta) StreamObserver(&os, &ta), &ta);
+
+        observer->setRecordFormatFunctor(
+                             BloombergLP::ball::RecordStringFormatter("%m\n"));
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        const Cat *category = manager.setCategory("Sampled",
+                                                  Sev::e_OFF,
+                                                  Sev::e_TRACE,
+                                                  Sev::e_ERROR,
+                                                  Sev::e_FATAL);
+        ASSERT(0 != category);
+
+        const SamplingPolicy POLICY(1, 2, BloombergLP::bsls::TimeInterval(3600,
+                                                                          0));
+
+        ASSERT(1 == BloombergLP::ball::Administration::setSamplingPolicy(
+                                                                   "Sampled",
+                                                                   POLICY));
+
+        BALL_LOG_SET_CATEGORY("Sampled");
+
+        const int WARN = Sev::e_WARN;
+
+        // The first two records are admitted.
+
+        for (int i = 0; i < 3; ++i) {
+            BALL_LOG_WARN << "stream " << evaluate();
+        }
+        ASSERTV(numEvaluations, 2 == numEvaluations);
+
+        // Every other macro is subject to the same limit.
+
+        BALL_LOG_STREAM(WARN) << evaluate();
+        BALL_LOG_WARN_BLOCK { evaluate(); }
+        BALL_LOG_STREAM_BLOCK(WARN) { evaluate(); }
+        BALL_LOGCB_WARN(&noopCallback) << evaluate();
+        BALL_LOGCB_STREAM(WARN, &noopCallback) << evaluate();
+        BALL_LOGVA_WARN("%d", evaluate());
+        BALL_LOGVA(WARN, "%d", evaluate());
+        ASSERTV(numEvaluations, 2 == numEvaluations);
+
+        // Testing whether logging is enabled does not consume an admission.
+
+        ASSERT(BALL_LOG_IS_ENABLED(Sev::e_WARN));
+
+        // Triggering records and direct calls are never suppressed.
+
+        BALL_LOG_ERROR << "error " << evaluate();
+        BALL_LOG_FATAL << "fatal " << evaluate();
+        ASSERTV(numEvaluations, 4 == numEvaluations);
+
+        manager.getLogger().logMessage(*category,
+                                       Sev::e_WARN,
+                                       __FILE__,
+                                       __LINE__,
+                                       "direct");
+
+        // Ending the period reports the 8 suppressed records.
+
+        ASSERT(1 == BloombergLP::ball::Administration::setSamplingPolicy(
+                                                           "Sampled",
+                                                           SamplingPolicy()));
+
+        BALL_LOG_WARN << "after";
+
+        const char EXPECTED_LOG[] =
+                  "stream 1\n"
+                  "stream 2\n"
+                  "error 3\n"
+                  "--- BEGIN RECORD DUMP CAUSED BY TRIGGER ---\n"
+                  "--- END RECORD DUMP CAUSED BY TRIGGER ---\n"
+                  "fatal 4\n"
+                  "--- BEGIN RECORD DUMP CAUSED BY TRIGGER ---\n"
+                  "--- END RECORD DUMP CAUSED BY TRIGGER ---\n"
+                  "--- BEGIN RECORD DUMP CAUSED BY TRIGGER ALL ---\n"
+                  "--- END RECORD DUMP CAUSED BY TRIGGER ALL ---\n"
+                  "direct\n"
+                  "--- 8 RECORD(S) SUPPRESSED BY SAMPLING POLICY ---\n"
+                  "after\n";
+
+        ASSERTV(EXPECTED_LOG, os.str(), EXPECTED_LOG == os.str());
+
+        ASSERT(0 == manager.deregisterObserver("test"));
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // TESTING RECURSIVE USE OF LOGGING MACROS
@@ -11977,6 +12196,69 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DISABLED LOG STATEMENTS
+        //
+        // Concerns:
+        // 1. A log statement whose severity is below the threshold of its
+        //    category costs a single (relaxed) load of the threshold cached
+        //    in the category holder, i.e., on the order of a nanosecond.
+        //
+        // 2. The cost in 1 is unaffected by concurrent changes to the logging
+        //    rules and to the thresholds of other categories (i.e., the
+        //    disabled check never waits on a lock held by the thread making
+        //    the change).
+        //
+        // Plan:
+        // 1. Using a logger manager whose default thresholds disable `TRACE`
+        //    records, time a large number of `BALL_LOG_TRACE` statements, and
+        //    report the average time of each.  (C-1)
+        //
+        // 2. Repeat P-1 while a separate thread continuously adds and removes
+        //    a logging rule and changes category thresholds.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: DISABLED LOG STATEMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "PERFORMANCE TEST: DISABLED LOG STATEMENTS"
+                               << bsl::endl
+                               << "========================================="
+                               << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+        using namespace BloombergLP;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 100000000;
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(ball::Severity::e_WARN,
+                                             ball::Severity::e_OFF,
+                                             ball::Severity::e_OFF,
+                                             ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard lmg(lmc, &ta);
+
+        disabledTraceLoop(1000);  // warm up; initialize the category holder
+
+        bsls::Types::Int64 quiet = disabledTraceLoop(NUM_ITERATIONS);
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle, ruleChurnThread, 0));
+
+        bsls::Types::Int64 churn = disabledTraceLoop(NUM_ITERATIONS);
+
+        done = true;
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        bsl::cout << "Disabled log statement (quiet):      "
+                  << static_cast<double>(quiet) / NUM_ITERATIONS
+                  << " ns" << bsl::endl
+                  << "Disabled log statement (rule churn): "
+                  << static_cast<double>(churn) / NUM_ITERATIONS
+                  << " ns" << bsl::endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -6,19 +6,35 @@ BSLS_IDENT_RCSID(ball_loggercategoryutil_cpp,"$Id$ $CSID$")
 
 #include <ball_categorymanager.h>
 #include <ball_loggermanager.h>
+#include <ball_recordsampler.h>
+#include <ball_samplingpolicy.h>
+#include <ball_severity.h>
 #include <ball_thresholdaggregate.h>
 
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>    // strlen(), strncmp()
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
 
+namespace {
+
+/// Categories whose sampling period has elapsed, and the number of records
+/// suppressed during that period.
+typedef bsl::vector<bsl::pair<const Category *, bsls::Types::Int64> >
+                                                             SamplingSummaries;
+
+}  // close unnamed namespace
+
 // STATIC HELPER FUNCTIONS
 
 /// If the specified `category` has a name that begins with the specified
@@ -47,6 +63,42 @@ static void setThesholdIfMatchingCategoryPrefix(
     }
 }
 
+/// If the specified `category` has a name that begins with the specified
+/// `prefix`, then set the sampling policy of the category to the specified
+/// `policy` and increment `matchCount`.  This operation has no effect if
+/// the name of `category` does not begin with `prefix`.
+static void setSamplingPolicyIfMatchingCategoryPrefix(
+                                        Category                 *category,
+                                        int                      *matchCount,
+                                        const bsl::string_view&   prefix,
+                                        const SamplingPolicy&     policy)
+{
+    if (0 == bsl::strncmp(category->categoryName(),
+                          prefix.data(),
+                          prefix.length())) {
+        category->setSamplingPolicy(policy);
+        ++(*matchCount);
+    }
+}
+
+/// If the specified `category` has a record sampler whose current period
+/// has elapsed, end that period and, if records were suppressed during it,
+/// append `category` and the number of those records to the specified
+/// `summaries`.
+static void endExpiredSamplingPeriod(SamplingSummaries *summaries,
+                                     const Category    *category)
+{
+    RecordSampler *sampler = category->sampler();
+    if (!sampler) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 numSuppressed = sampler->endExpiredPeriod();
+    if (0 < numSuppressed) {
+        summaries->push_back(bsl::make_pair(category, numSuppressed));
+    }
+}
+
 /// If the specified `category` has a name that is a prefix of
 /// `categoryName` longer than `minPrefixLength`, then populate `result`
 /// with `category`, and populate `minPrefixLength` with the length of
@@ -195,6 +247,86 @@ int LoggerCategoryUtil::setThresholdLevels(LoggerManager *loggerManager,
                                             triggerAllLevel);
 }
 
+int LoggerCategoryUtil::setSamplingPolicy(LoggerManager         *loggerManager,
+                                          const char            *pattern,
+                                          const SamplingPolicy&  policy)
+{
+    BSLS_ASSERT(loggerManager);
+    BSLS_ASSERT(pattern);
+
+    bsl::size_t len = bsl::strlen(pattern);
+
+    if (0 == len || '*' != pattern[len - 1]) {
+        Category *category = loggerManager->lookupCategory(pattern);
+        if (!category) {
+            return 0;                                                 // RETURN
+        }
+        category->setSamplingPolicy(policy);
+        return 1;                                                     // RETURN
+    }
+
+    int matchCount = 0;
+
+    using namespace bdlf::PlaceHolders;
+    loggerManager->visitCategories(
+        bdlf::BindUtil::bind(setSamplingPolicyIfMatchingCategoryPrefix,
+                             _1,
+                             &matchCount,
+                             bsl::string_view(pattern, len - 1),
+                             policy));
+    return matchCount;
+}
+
+int LoggerCategoryUtil::publishSamplingSummaries(LoggerManager *loggerManager)
+{
+    BSLS_ASSERT(loggerManager);
+
+    // The summaries are collected first, and published once the registry of
+    // categories is no longer being visited.
+
+    SamplingSummaries summaries;
+    {
+        using namespace bdlf::PlaceHolders;
+        loggerManager->visitCategories(
+                                 bdlf::BindUtil::bind(endExpiredSamplingPeriod,
+                                                      &summaries,
+                                                      _1));
+    }
+
+    int numPublished = 0;
+
+    for (bsl::size_t i = 0; i < summaries.size(); ++i) {
+        const Category& category = *summaries[i].first;
+
+        // A summary is logged at the pass threshold level of its category
+        // (or at 'e_INFO', if that level is less severe), so that it is
+        // published immediately.  If the category publishes nothing, the
+        // summary is logged at its record threshold level, if any, instead.
+
+        const int level = category.passLevel() ? category.passLevel()
+                                                : category.recordLevel();
+        if (0 == level) {
+            continue;                                               // CONTINUE
+        }
+
+        char message[96];
+        RecordSampler::formatSummary(message,
+                                     sizeof message,
+                                     summaries[i].second);
+
+        loggerManager->getLogger().logMessage(
+                                category,
+                                bsl::min(level,
+                                         static_cast<int>(Severity::e_INFO)),
+                                __FILE__,
+                                __LINE__,
+                                message);
+        ++numPublished;
+    }
+
+    return numPublished;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
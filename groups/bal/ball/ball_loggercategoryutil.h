@@ -20,6 +20,10 @@ BSLS_IDENT("$Id: $")
 // the specified string as a prefix.  The `addCategoryHierarchically` function
 // creates a new category that inherits threshold levels from the exiting
 // category whose name is the longest prefix match, if such a category exists.
+// The `setSamplingPolicy` function applies a `ball::SamplingPolicy` to each
+// category whose name matches a pattern, and the `publishSamplingSummaries`
+// function publishes a summary record for each category whose sampling period
+// has elapsed with records suppressed (see `ball_recordsampler`).
 //
 ///Deprecation Notice
 ///------------------
@@ -122,6 +126,7 @@ namespace ball {
 
 class LoggerManager;
 class Category;
+class SamplingPolicy;
 
                         // =========================
                         // struct LoggerCategoryUtil
@@ -185,6 +190,38 @@ struct LoggerCategoryUtil {
                                   int            passLevel,
                                   int            triggerLevel,
                                   int            triggerAllLevel);
+
+    /// Set the sampling policy of each category currently in the registry
+    /// of the specified `loggerManager` whose name matches the specified
+    /// `pattern` to the specified `policy`.  Return the number of
+    /// categories whose sampling policy was set.  `pattern` is assumed to
+    /// be of the form "X" or "X*" where X is a sequence of 0 or more
+    /// characters and `*` matches any string (including the empty string).
+    /// The behavior is undefined unless `loggerManager` is not in the
+    /// process of being destroyed.  Note that only a `*` located at the end
+    /// of `pattern` is recognized as a special character.  Also note that
+    /// this function has no effect on the sampling policy of categories
+    /// added to the registry after it is called.
+    static int setSamplingPolicy(LoggerManager         *loggerManager,
+                                 const char            *pattern,
+                                 const SamplingPolicy&  policy);
+
+    /// End the sampling period of each category in the registry of the
+    /// specified `loggerManager` whose period has elapsed (or whose sampling
+    /// policy has been made inactive), and log to each such category during
+    /// whose period records were suppressed a summary record that reports
+    /// the number of those records.  Return the number of summary records
+    /// logged.  A summary record is logged at the pass threshold level of
+    /// its category (or at `Severity::e_INFO`, if that level is less
+    /// severe), or, if the pass threshold level is 0, at the record
+    /// threshold level of the category; no summary is logged if both levels
+    /// are 0.  The behavior
+    /// is undefined unless `loggerManager` is not in the process of being
+    /// destroyed.  Note that this function is intended to be called
+    /// periodically, so that the records suppressed during a period are
+    /// reported even if no further record is logged to the category (see
+    /// `ball_recordsampler`).
+    static int publishSamplingSummaries(LoggerManager *loggerManager);
 };
 
 }  // close package namespace
@@ -354,7 +354,12 @@ for (static BloombergLP::bdlmt::Throttle ball_logthrottle_tHrOtTlE =          \
                              BDLMT_THROTTLE_INIT((MAX_SIMULTANEOUS_MESSAGES), \
                                                  (NANOSECONDS_PER_MESSAGE));  \
      ball_logthrottle_cAtEgOrYhOlDeR                                          \
-    && ball_logthrottle_tHrOtTlE.requestPermission();                         \
+    && ball_logthrottle_tHrOtTlE.requestPermission()                          \
+    && BloombergLP::ball::Log::isRecordAdmitted(                              \
+                                          ball_logthrottle_cAtEgOrYhOlDeR,    \
+                                          (SEVERITY),                         \
+                                          __FILE__,                           \
+                                          __LINE__);                          \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
                                  ball_logthrottle_cAtEgOrYhOlDeR->category(), \
@@ -379,7 +384,12 @@ for (static BloombergLP::bdlmt::Throttle ball_logthrottle_tHrOtTlE =          \
                      BDLMT_THROTTLE_INIT((MAX_SIMULTANEOUS_MESSAGES),         \
                                          (NANOSECONDS_PER_MESSAGE));          \
      ball_logthrottle_cAtEgOrYhOlDeR                                          \
-    && ball_logthrottle_tHrOtTlE.requestPermission();                         \
+    && ball_logthrottle_tHrOtTlE.requestPermission()                          \
+    && BloombergLP::ball::Log::isRecordAdmitted(                              \
+                                          ball_logthrottle_cAtEgOrYhOlDeR,    \
+                                          (SEVERITY),                         \
+                                          __FILE__,                           \
+                                          __LINE__);                          \
      )                                                                        \
 for (BloombergLP::ball::Log_Stream ball_log_lOg_StReAm(                       \
                                  ball_logthrottle_cAtEgOrYhOlDeR->category(), \
@@ -402,7 +412,12 @@ do {                                                                          \
             = BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(    \
                       ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER));   \
     if (ball_logthrottle_cAtEgOrYhOlDeR &&                                    \
-                           ball_logthrottle_tHrOtTlE.requestPermission()) {   \
+                           ball_logthrottle_tHrOtTlE.requestPermission() &&   \
+                           BloombergLP::ball::Log::isRecordAdmitted(          \
+                                           ball_logthrottle_cAtEgOrYhOlDeR,   \
+                                           (SEVERITY),                        \
+                                           __FILE__,                          \
+                                           __LINE__)) {                       \
         BloombergLP::ball::Log_Formatter ball_logthrottle_fOrMaTtEr(          \
                                ball_logthrottle_cAtEgOrYhOlDeR->category(),   \
                                __FILE__,                                      \
@@ -534,7 +549,12 @@ do {                                                                          \
        && BloombergLP::ball::Log::isCategoryEnabled(                          \
                                             ball_logthrottle_cAtEgOrYhOlDeR,  \
                                             (SEVERITY))                       \
-       && ball_logthrottle_tHrOtTlE.requestPermission()) {                    \
+       && ball_logthrottle_tHrOtTlE.requestPermission()                       \
+       && BloombergLP::ball::Log::isRecordAdmitted(                           \
+                                            ball_logthrottle_cAtEgOrYhOlDeR,  \
+                                            (SEVERITY),                       \
+                                            __FILE__,                         \
+                                            __LINE__)) {                      \
         BloombergLP::ball::Log_Formatter ball_logthrottle_fOrMaTtEr(          \
                                  ball_logthrottle_cAtEgOrYhOlDeR->category(), \
                                  __FILE__,                                    \
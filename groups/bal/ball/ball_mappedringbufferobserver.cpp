@@ -0,0 +1,481 @@
+// ball_mappedringbufferobserver.cpp                                  -*-C++-*-
+#include <ball_mappedringbufferobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedringbufferobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>                // for testing only
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdls_memoryutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_epochutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+///Implementation Notes
+///--------------------
+// The ring buffer file has the following layout:
+// ```
+//  +--------------+---------+---------+-----+-------------------+
+//  | FileHeader   | slot 0  | slot 1  | ... | slot numSlots - 1 |
+//  | (+ padding)  |         |         |     |                   |
+//  +--------------+---------+---------+-----+-------------------+
+//   <- slotSize -> <- slotSize ->
+// ```
+// The header occupies the first slot-sized block of the file, so that every
+// slot is aligned on a multiple of the slot size.  Each slot starts with a
+// `SlotHeader`, followed by the (truncated) category name, file name, and
+// message of the record, in that order.
+//
+// The `d_sequence` field of a slot is the primary means of detecting
+// consistent slots:
+//
+// * 0 (`k_EMPTY`) indicates a slot that was never written.
+// * `k_BUSY` indicates a slot that is being written (or that was being
+//   written when the recording process terminated).
+// * Any other value is one more than the sequence number of the record held
+//   in the slot.
+//
+// A publisher claims a sequence number `s` from the header, and then attempts
+// to atomically swap the `d_sequence` field of slot `s % numSlots` from its
+// current (non-busy) value to `k_BUSY`.  If the slot is busy (i.e., the ring
+// wrapped around while another thread is still writing that slot), or already
+// holds a newer record, the record is dropped rather than waiting; otherwise
+// the slot is written, and its `d_sequence` is set to `s + 1` (with release
+// semantics).  Hence no two threads write a slot concurrently, and publishing
+// never blocks.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef bsls::AtomicOperations                      AtomicOps;
+typedef bsls::AtomicOperations::AtomicTypes::Uint64 AtomicUint64;
+typedef bsls::Types::Int64                          Int64;
+typedef bsls::Types::Uint64                         Uint64;
+
+const char   k_MAGIC[8] = { 'B', 'A', 'L', 'L', 'R', 'I', 'N', 'G' };
+const int    k_VERSION  = 1;
+
+const Uint64 k_EMPTY    = 0;
+const Uint64 k_BUSY     = ~static_cast<Uint64>(0);
+
+/// This `struct` describes the header at the start of a ring buffer file.
+struct FileHeader {
+
+    // DATA
+    char         d_magic[8];      // `k_MAGIC`
+    unsigned int d_version;       // `k_VERSION`
+    unsigned int d_slotSize;      // size of each slot (and of the header
+                                  // block)
+    Uint64       d_numSlots;      // number of slots
+    AtomicUint64 d_nextSequence;  // sequence number of the next record
+};
+
+/// This `struct` describes the fixed-size header of a slot of a ring buffer
+/// file.  The text of the record follows the header.
+struct SlotHeader {
+
+    // DATA
+    AtomicUint64 d_sequence;        // `k_EMPTY`, `k_BUSY`, or the sequence
+                                    // number of the record plus one
+
+    Int64        d_timestamp;       // microseconds since the epoch
+
+    Uint64       d_threadId;        // thread id
+
+    int          d_processId;       // process id
+
+    int          d_lineNumber;      // line number
+
+    int          d_severity;        // severity
+
+    unsigned int d_categoryLength;  // length of the (truncated) category
+
+    unsigned int d_fileNameLength;  // length of the (truncated) file name
+
+    unsigned int d_messageLength;   // length of the (truncated) message
+};
+
+BSLMF_ASSERT(sizeof(FileHeader) <=
+                          MappedRingBufferObserver::k_MIN_SLOT_SIZE);
+BSLMF_ASSERT(sizeof(SlotHeader) <
+                          MappedRingBufferObserver::k_MIN_SLOT_SIZE);
+
+/// Copy at most the specified `capacity` bytes of the specified `text` to
+/// the specified `destination`, and return the number of bytes copied.
+inline
+unsigned int copyTruncated(char                     *destination,
+                           bsl::size_t               capacity,
+                           const bslstl::StringRef&  text)
+{
+    const bsl::size_t length = bsl::min(capacity, text.length());
+    bsl::memcpy(destination, text.data(), length);
+    return static_cast<unsigned int>(length);
+}
+
+/// Return `true` if the specified `header` describes a valid ring buffer
+/// whose slots fit in a file of the specified `fileSize`, and `false`
+/// otherwise.
+bool isValidHeader(const FileHeader& header, Uint64 fileSize)
+{
+    if (0 != bsl::memcmp(header.d_magic, k_MAGIC, sizeof k_MAGIC)
+     || k_VERSION != static_cast<int>(header.d_version)
+     || header.d_slotSize < MappedRingBufferObserver::k_MIN_SLOT_SIZE
+     || 0 != header.d_slotSize % 8
+     || 0 == header.d_numSlots) {
+        return false;                                                 // RETURN
+    }
+    const Uint64 numBlocks = fileSize / header.d_slotSize;
+    return 0 < numBlocks && header.d_numSlots <= numBlocks - 1;
+}
+
+/// Write the record held in the specified `slot` of the specified
+/// `slotSize` to the specified `stream`.  Return `true` if the slot holds a
+/// consistent record, and `false` (with no effect on `stream`) otherwise.
+bool printSlot(bsl::ostream& stream, const char *slot, unsigned int slotSize)
+{
+    const SlotHeader& header   = *reinterpret_cast<const SlotHeader *>(slot);
+    const Uint64      capacity = slotSize - sizeof(SlotHeader);
+
+    if (static_cast<Uint64>(header.d_categoryLength)
+                  + header.d_fileNameLength + header.d_messageLength
+                                                                > capacity) {
+        return false;                                                 // RETURN
+    }
+
+    bdlt::Datetime timestamp(bdlt::EpochUtil::epoch());
+    if (0 != timestamp.addMicrosecondsIfValid(header.d_timestamp)) {
+        return false;                                                 // RETURN
+    }
+
+    const char *category = slot + sizeof(SlotHeader);
+    const char *fileName = category + header.d_categoryLength;
+    const char *message  = fileName + header.d_fileNameLength;
+
+    const int bufferSize = 64;
+    char      buffer[bufferSize];
+    const int fractionalSecondPrecision = 3;
+
+    const int numBytesWritten = timestamp.printToBuffer(
+                                                    buffer,
+                                                    bufferSize,
+                                                    fractionalSecondPrecision);
+
+    const char *severity = Severity::toAscii(
+                               static_cast<Severity::Level>(header.d_severity));
+
+    stream.write(buffer, numBytesWritten);
+    stream << ' ' << header.d_processId
+           << ' ' << header.d_threadId
+           << ' ' << severity
+           << ' ';
+    stream.write(fileName, header.d_fileNameLength);
+    stream << ' ' << header.d_lineNumber << ' ';
+    stream.write(category, header.d_categoryLength);
+    stream << ' ';
+    stream.write(message, header.d_messageLength);
+    stream << '\n';
+
+    return true;
+}
+
+}  // close unnamed namespace
+
+                      // ------------------------------
+                      // class MappedRingBufferObserver
+                      // ------------------------------
+
+// CLASS METHODS
+int MappedRingBufferObserver::decodeFile(bsl::ostream&  stream,
+                                         const char    *fileName)
+{
+    BSLS_ASSERT(fileName);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileDescriptor fd = FileUtil::open(fileName,
+                                       FileUtil::e_OPEN,
+                                       FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const FileUtil::Offset fileSize = FileUtil::getFileSize(fd);
+    if (fileSize < static_cast<FileUtil::Offset>(k_MIN_SLOT_SIZE)) {
+        FileUtil::close(fd);
+        return -2;                                                    // RETURN
+    }
+
+    void *mapping = 0;
+    if (0 != FileUtil::map(fd,
+                           &mapping,
+                           0,
+                           static_cast<bsl::size_t>(fileSize),
+                           bdls::MemoryUtil::k_ACCESS_READ)) {
+        FileUtil::close(fd);
+        return -3;                                                    // RETURN
+    }
+
+    const char       *base   = static_cast<const char *>(mapping);
+    const FileHeader& header = *reinterpret_cast<const FileHeader *>(base);
+
+    int rc = 0;
+    if (!isValidHeader(header, static_cast<Uint64>(fileSize))) {
+        rc = -4;
+    }
+    else {
+        const unsigned int  slotSize = header.d_slotSize;
+        const char         *slots    = base + slotSize;
+
+        // Order the slots holding a record by sequence number.
+
+        typedef bsl::pair<Uint64, Uint64> SequenceAndIndex;
+
+        bsl::vector<SequenceAndIndex> records;
+        for (Uint64 i = 0; i < header.d_numSlots; ++i) {
+            const SlotHeader *slot = reinterpret_cast<const SlotHeader *>(
+                                                         slots + i * slotSize);
+            const Uint64 sequence = AtomicOps::getUint64Acquire(
+                                                             &slot->d_sequence);
+            if (k_EMPTY != sequence && k_BUSY != sequence) {
+                records.push_back(SequenceAndIndex(sequence, i));
+            }
+        }
+        bsl::sort(records.begin(), records.end());
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            printSlot(stream, slots + records[i].second * slotSize, slotSize);
+        }
+        stream << bsl::flush;
+    }
+
+    FileUtil::unmap(mapping, static_cast<bsl::size_t>(fileSize));
+    FileUtil::close(fd);
+    return rc;
+}
+
+// CREATORS
+MappedRingBufferObserver::MappedRingBufferObserver(
+                                              const allocator_type& allocator)
+: d_fileName(allocator)
+, d_fd(bdls::FilesystemUtil::k_INVALID_FD)
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_slotSize(0)
+{
+}
+
+MappedRingBufferObserver::~MappedRingBufferObserver()
+{
+    close();
+}
+
+// MANIPULATORS
+void MappedRingBufferObserver::close()
+{
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+    bdls::FilesystemUtil::close(d_fd);
+
+    d_fileName.clear();
+    d_fd          = bdls::FilesystemUtil::k_INVALID_FD;
+    d_mapping_p   = 0;
+    d_mappingSize = 0;
+    d_slots_p     = 0;
+    d_numSlots    = 0;
+    d_slotSize    = 0;
+}
+
+int MappedRingBufferObserver::open(const char          *fileName,
+                                   bsls::Types::Uint64  numSlots,
+                                   int                  slotSize)
+{
+    BSLS_ASSERT(fileName);
+    BSLS_ASSERT(0 < numSlots);
+    BSLS_ASSERT(k_MIN_SLOT_SIZE <= slotSize);
+    BSLS_ASSERT(0 == slotSize % 8);
+    BSLS_ASSERT(!isOpen());
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    const Uint64 fileSize = (numSlots + 1) * static_cast<Uint64>(slotSize);
+    if (fileSize / slotSize != numSlots + 1
+     || fileSize != static_cast<bsl::size_t>(fileSize)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string name(fileName, d_fileName.get_allocator());
+
+    FileDescriptor fd = FileUtil::open(fileName,
+                                       FileUtil::e_OPEN_OR_CREATE,
+                                       FileUtil::e_READ_WRITE,
+                                       FileUtil::e_TRUNCATE);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -2;                                                    // RETURN
+    }
+
+    if (0 != FileUtil::growFile(fd,
+                                static_cast<FileUtil::Offset>(fileSize),
+                                true)) {
+        FileUtil::close(fd);
+        return -3;                                                    // RETURN
+    }
+
+    void *mapping = 0;
+    if (0 != FileUtil::map(fd,
+                           &mapping,
+                           0,
+                           static_cast<bsl::size_t>(fileSize),
+                           bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FileUtil::close(fd);
+        return -4;                                                    // RETURN
+    }
+
+    // Note that 'growFile' leaves the contents of the file unspecified, so
+    // every slot is explicitly marked as empty.  The header is written last,
+    // so that a partially initialized file is not recognized as a ring
+    // buffer.
+
+    char *base = static_cast<char *>(mapping);
+    bsl::memset(base, 0, static_cast<bsl::size_t>(fileSize));
+
+    FileHeader *header = reinterpret_cast<FileHeader *>(base);
+    header->d_version  = k_VERSION;
+    header->d_slotSize = slotSize;
+    header->d_numSlots = numSlots;
+    AtomicOps::initUint64(&header->d_nextSequence, 0);
+    bsl::memcpy(header->d_magic, k_MAGIC, sizeof k_MAGIC);
+
+    d_fileName.swap(name);
+    d_fd          = fd;
+    d_mapping_p   = base;
+    d_mappingSize = static_cast<bsl::size_t>(fileSize);
+    d_slots_p     = base + slotSize;
+    d_numSlots    = numSlots;
+    d_slotSize    = slotSize;
+
+    return 0;
+}
+
+void MappedRingBufferObserver::publish(
+                                    const bsl::shared_ptr<const Record>& record,
+                                    const Context&)
+{
+    BSLS_ASSERT(record);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_mapping_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    FileHeader *fileHeader = reinterpret_cast<FileHeader *>(d_mapping_p);
+
+    const Uint64 sequence =
+               AtomicOps::addUint64NvAcqRel(&fileHeader->d_nextSequence, 1) - 1;
+
+    char       *slot   = d_slots_p + (sequence % d_numSlots) * d_slotSize;
+    SlotHeader *header = reinterpret_cast<SlotHeader *>(slot);
+
+    // Claim the slot, unless it is being written by another thread, or
+    // already holds a newer record (see the implementation notes).
+
+    const Uint64 current = AtomicOps::getUint64Acquire(&header->d_sequence);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    k_BUSY == current
+                 || sequence + 1 < current
+                 || current != AtomicOps::testAndSwapUint64AcqRel(
+                                                           &header->d_sequence,
+                                                           current,
+                                                           k_BUSY))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    const RecordAttributes& fixedFields = record->fixedFields();
+
+    header->d_timestamp  = (fixedFields.timestamp() -
+                                  bdlt::EpochUtil::epoch()).totalMicroseconds();
+    header->d_threadId   = fixedFields.threadID();
+    header->d_processId  = fixedFields.processID();
+    header->d_lineNumber = fixedFields.lineNumber();
+    header->d_severity   = fixedFields.severity();
+
+    char        *text     = slot + sizeof(SlotHeader);
+    bsl::size_t  capacity = d_slotSize - sizeof(SlotHeader);
+
+    header->d_categoryLength = copyTruncated(text,
+                                             capacity,
+                                             fixedFields.category());
+    text     += header->d_categoryLength;
+    capacity -= header->d_categoryLength;
+
+    header->d_fileNameLength = copyTruncated(text,
+                                             capacity,
+                                             fixedFields.fileName());
+    text     += header->d_fileNameLength;
+    capacity -= header->d_fileNameLength;
+
+    header->d_messageLength  = copyTruncated(text,
+                                             capacity,
+                                             fixedFields.messageRef());
+
+    AtomicOps::setUint64Release(&header->d_sequence, sequence + 1);
+}
+
+int MappedRingBufferObserver::sync(bool waitFlag)
+{
+    if (!d_mapping_p) {
+        return 0;                                                     // RETURN
+    }
+
+    // The size of the mapping is a multiple of the slot size, but not
+    // necessarily of the page size, as required by 'sync'.
+
+    const bsl::size_t pageSize = bdls::MemoryUtil::pageSize();
+    const bsl::size_t numBytes = (d_mappingSize + pageSize - 1)
+                                                         / pageSize * pageSize;
+
+    return bdls::FilesystemUtil::sync(d_mapping_p, numBytes, waitFlag);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,395 @@
+// ball_mappedringbufferobserver.h                                    -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDRINGBUFFEROBSERVER
+#define INCLUDED_BALL_MAPPEDRINGBUFFEROBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer recording log records to a memory-mapped ring.
+//
+//@CLASSES:
+//  ball::MappedRingBufferObserver: observer writing records to a mapped ring
+//
+//@SEE_ALSO: ball_fixedsizerecordbuffer, ball_observer, ball_fileobserver2
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// `ball::Observer` protocol, `ball::MappedRingBufferObserver`, that writes
+// each log record it receives, in a fixed-size binary form, into a ring of
+// slots held in a memory-mapped file:
+// ```
+//           ,------------------------------.
+//          ( ball::MappedRingBufferObserver )
+//           `------------------------------'
+//                          |              ctor
+//                          |              open
+//                          |              close
+//                          |              sync
+//                          |              isOpen
+//                          |              fileName
+//                          |              numSlots
+//                          |              slotSize
+//                          |              decodeFile
+//                          V
+//                   ,--------------.
+//                  ( ball::Observer )
+//                   `--------------'
+//                                         publish
+//                                         releaseRecords
+//                                         dtor
+// ```
+// The observer is intended for "flight recording": logging every record
+// (typically at `TRACE` level) at a negligible cost, so that the most recent
+// records are available for post-mortem analysis.  Unlike an in-process
+// record buffer (see {`ball_fixedsizerecordbuffer`}), the ring is backed by a
+// shared file mapping, so its contents survive the abnormal termination of the
+// process (the operating system writes the dirty pages of the mapping to the
+// file even if the process crashes).  Note that `sync` can be called to also
+// protect the contents against the failure of the host itself.
+//
+///Ring Buffer Format
+///------------------
+// The mapped file consists of a header followed by `numSlots()` slots, each
+// `slotSize()` bytes long.  The header identifies the file format and
+// contains a sequence counter from which each call to `publish` claims a
+// sequence number (using a single atomic increment); the record is then
+// written to the slot at index `sequenceNumber % numSlots()`, overwriting
+// the oldest record in the ring.  Each slot holds the timestamp, process id,
+// thread id, severity, and line number of the record, followed by as much of
+// the category name, file name, and message of the record as fits in the
+// slot (longer values are truncated).  User fields and attributes are not
+// recorded.  A slot is marked as being written before, and stamped with its
+// sequence number after, its contents are copied, so a slot that was being
+// written when the process terminated is recognized (and skipped) when the
+// ring is decoded.
+//
+// The file is written in the native byte order and layout of the host, and
+// is intended to be decoded on a host of the same architecture.
+//
+///Decoding a Ring Buffer File
+///---------------------------
+// The class method `decodeFile` reads a ring buffer file (e.g., one left
+// behind by a crashed process) and writes the records it contains, oldest
+// first, in a human-readable text format to an output stream.  Each record is
+// written on one line having the format:
+// ```
+// DATE_TIME PID THREAD-ID SEVERITY FILE LINE CATEGORY MESSAGE
+// ```
+// which matches the default format of {`ball_streamobserver`}.  Note that
+// `decodeFile` does not require an observer object, and so is suitable for
+// use in a stand-alone decoding tool.
+//
+///Performance
+///-----------
+// `publish` acquires no locks, performs no memory allocation, and makes no
+// system calls: it increments the shared sequence counter and copies the
+// fixed fields of the record into the mapped memory.  The cost of publishing
+// a record is therefore dominated by the cost of formatting the log message
+// (which is paid by the logging macros, not the observer).
+//
+///Thread Safety
+///-------------
+// `publish` and `releaseRecords` are thread-safe, and may be called
+// concurrently by multiple threads.  `open`, `close` and `sync` are *not*
+// thread-safe, and must not be called concurrently with each other, or with
+// `publish`; i.e., a ring buffer file should be opened before the observer is
+// registered with the logger manager, and closed (if at all) after the
+// observer is deregistered.  Note that if more threads publish concurrently
+// than there are slots in the ring, a slot may be written by two threads at
+// once; such a slot is detected as corrupt by `decodeFile` and skipped.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Flight Recording to a Ring Buffer File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record log records to a ring buffer file, and then
+// decode the contents of the file.
+//
+// First, we create an observer, and open a ring buffer file having 1024 slots
+// of 256 bytes each:
+// ```
+// ball::MappedRingBufferObserver observer;
+//
+// int rc = observer.open(fileName, 1024, 256);
+// assert(0 == rc);
+// assert(observer.isOpen());
+// ```
+// Then, we create a record and publish it to the observer:
+// ```
+// ball::RecordAttributes attributes;
+// attributes.setCategory("EXAMPLE");
+// attributes.setSeverity(ball::Severity::e_TRACE);
+// attributes.setFileName("example.cpp");
+// attributes.setLineNumber(42);
+// attributes.setMessage("Hello, flight recorder!");
+//
+// bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+// const bsl::shared_ptr<const ball::Record>
+//            record(new (*ga) ball::Record(attributes, ball::UserFields(), ga),
+//                   ga);
+//
+// observer.publish(record, ball::Context());
+// ```
+// Now, we close the observer (a crash of the process would have left the
+// same file behind):
+// ```
+// observer.close();
+// ```
+// Finally, we decode the file, and verify that the record is found:
+// ```
+// bsl::ostringstream os;
+//
+// rc = ball::MappedRingBufferObserver::decodeFile(os, fileName);
+// assert(0 == rc);
+// assert(bsl::string::npos != os.str().find("Hello, flight recorder!"));
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_bslallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                      // ==============================
+                      // class MappedRingBufferObserver
+                      // ==============================
+
+/// This class provides a concrete implementation of the `Observer`
+/// protocol that writes the log records it receives, in a fixed-size binary
+/// format, into a ring of slots held in a memory-mapped file.  The contents
+/// of the file can be converted to text using `decodeFile`.
+class MappedRingBufferObserver : public Observer {
+
+  public:
+    // TYPES
+    typedef bsl::allocator<char> allocator_type;
+
+    enum {
+        k_DEFAULT_NUM_SLOTS = 64 * 1024,  // default number of slots
+
+        k_DEFAULT_SLOT_SIZE = 256,        // default size of a slot (bytes)
+
+        k_MIN_SLOT_SIZE     = 64          // minimum size of a slot (bytes)
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+
+    // DATA
+    bsl::string     d_fileName;     // name of the ring buffer file (empty
+                                    // if not open)
+
+    FileDescriptor  d_fd;           // descriptor of the ring buffer file
+
+    char           *d_mapping_p;    // address of the file mapping (0 if not
+                                    // open)
+
+    bsl::size_t     d_mappingSize;  // size of the file mapping
+
+    char           *d_slots_p;      // address of the first slot
+
+    bsls::Types::Uint64
+                    d_numSlots;     // number of slots in the ring
+
+    int             d_slotSize;     // size of each slot (bytes)
+
+    // NOT IMPLEMENTED
+    MappedRingBufferObserver(const MappedRingBufferObserver&);
+    MappedRingBufferObserver& operator=(const MappedRingBufferObserver&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MappedRingBufferObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Write the records held in the ring buffer file having the specified
+    /// `fileName` to the specified `stream`, oldest first, one record per
+    /// line, in the format described in {Decoding a Ring Buffer File}.
+    /// Return 0 on success, and a non-zero value (with no effect on
+    /// `stream`) if the file could not be opened or mapped, or is not a
+    /// ring buffer file.  Slots that were never written, or whose contents
+    /// are not consistent (e.g., were being written when the recording
+    /// process terminated), are skipped.
+    static int decodeFile(bsl::ostream& stream, const char *fileName);
+
+    // CREATORS
+
+    /// Create a mapped ring buffer observer that is not open (i.e., that
+    /// discards any records it receives until `open` is called).
+    /// Optionally specify an `allocator` (e.g., the address of a
+    /// `bslma::Allocator` object) to supply memory; otherwise, the default
+    /// allocator is used.
+    explicit
+    MappedRingBufferObserver(const allocator_type& allocator =
+                                                             allocator_type());
+
+    /// Close this observer (if open), and destroy it.
+    ~MappedRingBufferObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Unmap and close the ring buffer file of this observer, if open.
+    /// Subsequently published records are discarded.  The file itself is
+    /// *not* removed.  The behavior is undefined if this method is called
+    /// concurrently with any other manipulator of this object.
+    void close();
+
+    /// Create (or truncate) the file having the specified `fileName`, size
+    /// it to hold a ring of the optionally specified `numSlots` slots of
+    /// the optionally specified `slotSize` bytes each, map it into memory,
+    /// and record subsequently published records into it.  If `numSlots`
+    /// is not specified, `k_DEFAULT_NUM_SLOTS` is used; if `slotSize` is
+    /// not specified, `k_DEFAULT_SLOT_SIZE` is used.  Return 0 on success,
+    /// and a non-zero value (with this observer left closed) otherwise.
+    /// The behavior is undefined unless `0 < numSlots`,
+    /// `k_MIN_SLOT_SIZE <= slotSize`, `slotSize` is a multiple of 8, and
+    /// this observer is not open.  Note that the storage for the file is
+    /// reserved (not allocated on demand) so that writing the ring can not
+    /// fail due to lack of disk space.
+    int open(const char          *fileName,
+             bsls::Types::Uint64  numSlots = k_DEFAULT_NUM_SLOTS,
+             int                  slotSize = k_DEFAULT_SLOT_SIZE);
+
+    using Observer::publish;
+
+    /// Process the specified log `record` having the specified publishing
+    /// `context` by writing the fixed fields of `record` into the next slot
+    /// of the ring buffer file, overwriting the oldest record held in the
+    /// ring.  If this observer is not open, `record` is ignored.  Note that
+    /// this method does not block, allocate memory, or make system calls.
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context)
+                                                         BSLS_KEYWORD_OVERRIDE;
+
+    /// Discard any shared reference to a `Record` object that was supplied
+    /// to the `publish` method, and is held by this observer.  Note that
+    /// this observer holds no such references, so this method has no
+    /// effect.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    /// Schedule the contents of the mapped ring buffer file to be written to
+    /// disk, and, if the optionally specified `waitFlag` is `true`, block
+    /// until the write has completed.  Return 0 on success, and a non-zero
+    /// value otherwise.  This method has no effect (and returns 0) if this
+    /// observer is not open.  Note that calling this method is necessary
+    /// only to protect the recorded records against a failure of the host
+    /// (the operating system preserves them if the process terminates).
+    int sync(bool waitFlag = false);
+
+    // ACCESSORS
+
+    /// Return the name of the ring buffer file of this observer, or the
+    /// empty string if this observer is not open.
+    const bsl::string& fileName() const;
+
+    /// Return `true` if this observer has an open ring buffer file, and
+    /// `false` otherwise.
+    bool isOpen() const;
+
+    /// Return the number of slots in the ring buffer of this observer, or 0
+    /// if this observer is not open.
+    bsls::Types::Uint64 numSlots() const;
+
+    /// Return the size, in bytes, of each slot of the ring buffer of this
+    /// observer, or 0 if this observer is not open.
+    int slotSize() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.  Note
+    /// that if no allocator was supplied at construction the default
+    /// allocator in effect at construction is used.
+    allocator_type get_allocator() const;
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                      // ------------------------------
+                      // class MappedRingBufferObserver
+                      // ------------------------------
+
+// MANIPULATORS
+inline
+void MappedRingBufferObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+inline
+const bsl::string& MappedRingBufferObserver::fileName() const
+{
+    return d_fileName;
+}
+
+inline
+bool MappedRingBufferObserver::isOpen() const
+{
+    return 0 != d_mapping_p;
+}
+
+inline
+bsls::Types::Uint64 MappedRingBufferObserver::numSlots() const
+{
+    return d_numSlots;
+}
+
+inline
+int MappedRingBufferObserver::slotSize() const
+{
+    return d_slotSize;
+}
+
+                                  // Aspects
+
+inline
+MappedRingBufferObserver::allocator_type
+MappedRingBufferObserver::get_allocator() const
+{
+    return d_fileName.get_allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
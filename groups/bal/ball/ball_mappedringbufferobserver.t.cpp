@@ -0,0 +1,804 @@
+// ball_mappedringbufferobserver.t.cpp                                -*-C++-*-
+#include <ball_mappedringbufferobserver.h>
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_tempdirectoryguard.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that writes log records into a
+// ring of fixed-size slots held in a memory-mapped file, together with a class
+// method that decodes such a file.  The tests publish records to an observer
+// and verify, using `decodeFile`, the contents of the resulting file.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int decodeFile(bsl::ostream& stream, const char *fileName);
+//
+// CREATORS
+// [ 2] MappedRingBufferObserver(const allocator_type& allocator);
+// [ 2] ~MappedRingBufferObserver();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const char *fileName, Uint64 numSlots, int slotSize);
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 3] void releaseRecords();
+// [ 2] int sync(bool waitFlag);
+//
+// ACCESSORS
+// [ 2] const bsl::string& fileName() const;
+// [ 2] bool isOpen() const;
+// [ 2] Uint64 numSlots() const;
+// [ 2] int slotSize() const;
+// [ 2] allocator_type get_allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT PUBLICATION
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::MappedRingBufferObserver Obj;
+typedef bsl::shared_ptr<const ball::Record> RecordSP;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return a record having the specified `category`, `severity`, `fileName`,
+/// `lineNumber`, and `message`, using the specified `allocator` to supply
+/// memory.
+RecordSP makeRecord(const char       *category,
+                    int               severity,
+                    const char       *fileName,
+                    int               lineNumber,
+                    const char       *message,
+                    bslma::Allocator *allocator)
+{
+    ball::RecordAttributes attributes(allocator);
+    attributes.setTimestamp(bdlt::Datetime(2026, 10, 18, 12, 34, 56, 789));
+    attributes.setProcessID(1234);
+    attributes.setThreadID(5678);
+    attributes.setCategory(category);
+    attributes.setSeverity(severity);
+    attributes.setFileName(fileName);
+    attributes.setLineNumber(lineNumber);
+    attributes.setMessage(message);
+
+    return bsl::allocate_shared<ball::Record>(allocator,
+                                              attributes,
+                                              ball::UserFields(allocator));
+}
+
+/// Decode the ring buffer file having the specified `fileName`, and load
+/// each decoded line into the specified `lines`.  Return the status
+/// returned by `decodeFile`.
+int decodeLines(bsl::vector<bsl::string> *lines, const bsl::string& fileName)
+{
+    bsl::ostringstream os;
+    const int          rc = Obj::decodeFile(os, fileName.c_str());
+
+    lines->clear();
+    bsl::istringstream is(os.str());
+    bsl::string        line;
+    while (bsl::getline(is, line)) {
+        lines->push_back(line);
+    }
+    return rc;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+//=============================================================================
+//                  CONCURRENCY TEST (CASE 4) HELPERS
+//-----------------------------------------------------------------------------
+
+namespace MAPPEDRINGBUFFEROBSERVER_TEST_CASE_4 {
+
+enum {
+    k_NUM_THREADS         = 8,
+    k_RECORDS_PER_THREAD  = 1000
+};
+
+Obj *observer;
+
+extern "C" void *publishRecords(void *)
+{
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    RecordSP record = u::makeRecord("CONCURRENT",
+                                    ball::Severity::e_TRACE,
+                                    "thread.cpp",
+                                    1,
+                                    "concurrent message",
+                                    allocator);
+
+    for (int i = 0; i < k_RECORDS_PER_THREAD; ++i) {
+        observer->publish(record, ball::Context());
+    }
+    return 0;
+}
+
+}  // close namespace MAPPEDRINGBUFFEROBSERVER_TEST_CASE_4
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileNameStr(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileNameStr, "flight.ring");
+        const char *fileName = fileNameStr.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Flight Recording to a Ring Buffer File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record log records to a ring buffer file, and then
+// decode the contents of the file.
+//
+// First, we create an observer, and open a ring buffer file having 1024 slots
+// of 256 bytes each:
+// ```
+    ball::MappedRingBufferObserver observer;
+
+    int rc = observer.open(fileName, 1024, 256);
+    ASSERT(0 == rc);
+    ASSERT(observer.isOpen());
+// ```
+// Then, we create a record and publish it to the observer:
+// ```
+    ball::RecordAttributes attributes;
+    attributes.setCategory("EXAMPLE");
+    attributes.setSeverity(ball::Severity::e_TRACE);
+    attributes.setFileName("example.cpp");
+    attributes.setLineNumber(42);
+    attributes.setMessage("Hello, flight recorder!");
+
+    bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+    const bsl::shared_ptr<const ball::Record>
+             record(new (*ga) ball::Record(attributes, ball::UserFields(), ga),
+                    ga);
+
+    observer.publish(record, ball::Context());
+// ```
+// Now, we close the observer (a crash of the process would have left the
+// same file behind):
+// ```
+    observer.close();
+// ```
+// Finally, we decode the file, and verify that the record is found:
+// ```
+    bsl::ostringstream os;
+
+    rc = ball::MappedRingBufferObserver::decodeFile(os, fileName);
+    ASSERT(0 == rc);
+    ASSERT(bsl::string::npos != os.str().find("Hello, flight recorder!"));
+// ```
+
+        if (veryVerbose) cout << os.str();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        // 1. `publish` can be called concurrently from multiple threads.
+        //
+        // 2. Every record published concurrently (to a ring large enough to
+        //    hold all of them) is decoded intact.
+        //
+        // Plan:
+        // 1. Publish records from several threads concurrently to a ring
+        //    having room for all of them, and verify that every record is
+        //    decoded, and that each decoded line holds the expected text.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT PUBLICATION"
+                          << "\n======================" << endl;
+
+        using namespace MAPPEDRINGBUFFEROBSERVER_TEST_CASE_4;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "concurrent.ring");
+
+        Obj mX(&ta);
+        ASSERT(0 == mX.open(fileName.c_str(),
+                            k_NUM_THREADS * k_RECORDS_PER_THREAD));
+        observer = &mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  publishRecords,
+                                                  0));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        mX.close();
+
+        bsl::vector<bsl::string> lines(&ta);
+        ASSERT(0 == u::decodeLines(&lines, fileName));
+        ASSERTV(lines.size(),
+                k_NUM_THREADS * k_RECORDS_PER_THREAD == lines.size());
+
+        for (bsl::size_t i = 0; i < lines.size(); ++i) {
+            ASSERTV(i, lines[i],
+                    bsl::string::npos != lines[i].find(
+                            "TRACE thread.cpp 1 CONCURRENT concurrent message"));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `publish`
+        //
+        // Concerns:
+        // 1. Each published record is written to the ring, and decoded in
+        //    the order of publication, in the documented format.
+        //
+        // 2. When more records are published than the ring has slots, only
+        //    the most recent `numSlots()` records are retained.
+        //
+        // 3. Category names, file names, and messages that do not fit in a
+        //    slot are truncated.
+        //
+        // 4. Records published to an observer that is not open are ignored.
+        //
+        // 5. `publish` allocates no memory.
+        //
+        // 6. `releaseRecords` has no effect.
+        //
+        // Plan:
+        // 1. Publish a small number of records and verify the decoded text.
+        //    (C-1)
+        //
+        // 2. Publish more records than there are slots, and verify that the
+        //    decoded records are the most recent ones, in order.  (C-2)
+        //
+        // 3. Publish a record whose message is longer than a slot, and verify
+        //    that its decoded message is a (non-empty) prefix of the original
+        //    message.  (C-3)
+        //
+        // 4. Publish to a closed observer, and verify that no memory is
+        //    allocated, and nothing is written.  (C-4..5)
+        //
+        // 5. Monitor the default and object allocators while publishing.
+        //    (C-5)
+        //
+        // Testing:
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `publish`"
+                          << "\n=================" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "publish.ring");
+
+        bsl::vector<bsl::string> lines(&ta);
+
+        if (verbose) cout << "\tRecords are decoded in order." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), 8, 128));
+
+            mX.publish(u::makeRecord("CAT.A", ball::Severity::e_INFO,
+                                     "a.cpp", 10, "first", &ta),
+                       ball::Context());
+            mX.publish(u::makeRecord("CAT.B", ball::Severity::e_ERROR,
+                                     "b.cpp", 20, "second", &ta),
+                       ball::Context());
+            mX.releaseRecords();
+
+            ASSERT(0 == u::decodeLines(&lines, fileName));
+            ASSERTV(lines.size(), 2 == lines.size());
+            if (2 == lines.size()) {
+                ASSERTV(lines[0],
+                        "18OCT2026_12:34:56.789 1234 5678 INFO a.cpp 10 "
+                        "CAT.A first" == lines[0]);
+                ASSERTV(lines[1],
+                        "18OCT2026_12:34:56.789 1234 5678 ERROR b.cpp 20 "
+                        "CAT.B second" == lines[1]);
+            }
+        }
+
+        if (verbose) cout << "\tOnly the most recent records are kept."
+                          << endl;
+        {
+            const int NUM_SLOTS   = 16;
+            const int NUM_RECORDS = 100;
+
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), NUM_SLOTS, 128));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bsl::ostringstream message;
+                message << "message " << i;
+                mX.publish(u::makeRecord("WRAP", ball::Severity::e_TRACE,
+                                         "wrap.cpp", i,
+                                         message.str().c_str(), &ta),
+                           ball::Context());
+            }
+
+            ASSERT(0 == u::decodeLines(&lines, fileName));
+            ASSERTV(lines.size(), NUM_SLOTS == static_cast<int>(lines.size()));
+            for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                bsl::ostringstream expected;
+                expected << "message " << NUM_RECORDS - NUM_SLOTS + i;
+
+                const bsl::string& LINE = lines[i];
+                const bsl::string  END  = expected.str();
+                ASSERTV(i, LINE, END,
+                        LINE.size() > END.size() &&
+                        0 == LINE.compare(LINE.size() - END.size(),
+                                          END.size(),
+                                          END));
+            }
+        }
+
+        if (verbose) cout << "\tLong fields are truncated." << endl;
+        {
+            const bsl::string LONG(1000, 'x', &ta);
+
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), 4, 128));
+
+            mX.publish(u::makeRecord("LONG", ball::Severity::e_WARN,
+                                     "long.cpp", 1, LONG.c_str(), &ta),
+                       ball::Context());
+
+            ASSERT(0 == u::decodeLines(&lines, fileName));
+            ASSERTV(lines.size(), 1 == lines.size());
+            if (1 == lines.size()) {
+                const bsl::size_t pos = lines[0].find(" LONG x");
+                ASSERTV(lines[0], bsl::string::npos != pos);
+                ASSERTV(lines[0].size(), lines[0].size() < 128);
+            }
+        }
+
+        if (verbose) cout << "\tClosed observer ignores records." << endl;
+        {
+            Obj mX(&ta);
+
+            RecordSP record = u::makeRecord("CLOSED", ball::Severity::e_WARN,
+                                            "closed.cpp", 1, "ignored", &ta);
+
+            bsls::Types::Int64 numAllocations = ta.numAllocations();
+            bsls::Types::Int64 numDefault     =
+                                            defaultAllocator.numAllocations();
+
+            mX.publish(record, ball::Context());
+
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(numDefault     == defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\t`publish` allocates no memory." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), 4, 128));
+
+            RecordSP record = u::makeRecord("ALLOC", ball::Severity::e_WARN,
+                                            "alloc.cpp", 1, "message", &ta);
+
+            bsls::Types::Int64 numAllocations = ta.numAllocations();
+            bsls::Types::Int64 numDefault     =
+                                            defaultAllocator.numAllocations();
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(record, ball::Context());
+            }
+
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(numDefault     == defaultAllocator.numAllocations());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `open`, `close`, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed observer is not open, and its accessors
+        //    return their documented default values.
+        //
+        // 2. `open` creates a file of the expected size, and the accessors
+        //    reflect the supplied arguments.
+        //
+        // 3. `close` returns the observer to its default state, and leaves
+        //    the file in place; a closed observer can be re-opened.
+        //
+        // 4. `open` fails (leaving the observer closed) if the file can not
+        //    be created.
+        //
+        // 5. `decodeFile` fails for a non-existent file and for a file that
+        //    is not a ring buffer file, and succeeds (with no output) for an
+        //    empty ring.
+        //
+        // 6. `sync` succeeds on an open and on a closed observer.
+        //
+        // 7. The object allocator is used to supply memory, and the
+        //    destructor closes the observer.
+        //
+        // 8. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Exercise each manipulator and accessor, and verify the results.
+        //    (C-1..7)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   MappedRingBufferObserver(const allocator_type& allocator);
+        //   ~MappedRingBufferObserver();
+        //   void close();
+        //   int open(const char *fileName, Uint64 numSlots, int slotSize);
+        //   int sync(bool waitFlag);
+        //   static int decodeFile(bsl::ostream& stream, const char *fileName);
+        //   const bsl::string& fileName() const;
+        //   bool isOpen() const;
+        //   Uint64 numSlots() const;
+        //   int slotSize() const;
+        //   allocator_type get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `open`, `close`, AND ACCESSORS"
+                          << "\n======================================"
+                          << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "open.ring");
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isOpen());
+            ASSERT(""    == X.fileName());
+            ASSERT(0     == X.numSlots());
+            ASSERT(0     == X.slotSize());
+            ASSERT(&ta   == X.get_allocator());
+            ASSERT(0     == mX.sync());
+
+            ASSERT(0 == mX.open(fileName.c_str(), 100, 64));
+
+            ASSERT(true     == X.isOpen());
+            ASSERT(fileName == X.fileName());
+            ASSERT(100      == X.numSlots());
+            ASSERT(64       == X.slotSize());
+            ASSERT(101 * 64 == bdls::FilesystemUtil::getFileSize(fileName));
+            ASSERT(0        == mX.sync());
+            ASSERT(0        == mX.sync(true));
+
+            bsl::vector<bsl::string> lines(&ta);
+            ASSERT(0 == u::decodeLines(&lines, fileName));
+            ASSERT(lines.empty());
+
+            mX.close();
+
+            ASSERT(false == X.isOpen());
+            ASSERT(""    == X.fileName());
+            ASSERT(0     == X.numSlots());
+            ASSERT(0     == X.slotSize());
+            ASSERT(bdls::FilesystemUtil::exists(fileName));
+
+            mX.close();  // closing a closed observer has no effect
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+
+            ASSERT(Obj::k_DEFAULT_NUM_SLOTS == X.numSlots());
+            ASSERT(Obj::k_DEFAULT_SLOT_SIZE == X.slotSize());
+        }
+
+        {
+            bsl::string badName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&badName, "no_such_dir");
+            bdls::PathUtil::appendRaw(&badName, "bad.ring");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0     != mX.open(badName.c_str()));
+            ASSERT(false == X.isOpen());
+
+            bsl::ostringstream os;
+            ASSERT(0 != Obj::decodeFile(os, badName.c_str()));
+            ASSERT(os.str().empty());
+        }
+
+        {
+            bsl::string textName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&textName, "text.log");
+
+            bdls::FilesystemUtil::FileDescriptor fd =
+                bdls::FilesystemUtil::open(
+                                   textName,
+                                   bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+                                   bdls::FilesystemUtil::e_READ_WRITE);
+            ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+
+            const bsl::string TEXT(256, 'a', &ta);
+            bdls::FilesystemUtil::write(fd,
+                                        TEXT.data(),
+                                        static_cast<int>(TEXT.size()));
+            bdls::FilesystemUtil::close(fd);
+
+            bsl::ostringstream os;
+            ASSERT(0 != Obj::decodeFile(os, textName.c_str()));
+            ASSERT(os.str().empty());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_FAIL(mX.open(0));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 0));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 4, 32));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 4, 100));
+            ASSERT_PASS(mX.open(fileName.c_str(), 4, 64));
+            ASSERT_FAIL(mX.open(fileName.c_str(), 4, 64));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Open an observer, publish a record, and decode the file.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "breathing.ring");
+
+        Obj mX(&ta);
+        ASSERT(0 == mX.open(fileName.c_str(), 4));
+
+        mX.publish(u::makeRecord("BREATHING", ball::Severity::e_INFO,
+                                 "breathing.cpp", 1, "hello", &ta),
+                   ball::Context());
+
+        bsl::ostringstream os;
+        ASSERT(0 == Obj::decodeFile(os, fileName.c_str()));
+        ASSERTV(os.str(),
+                bsl::string::npos != os.str().find("BREATHING hello"));
+
+        if (veryVerbose) cout << os.str();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Publishing a record costs on the order of tens of nanoseconds.
+        //
+        // Plan:
+        // 1. Publish a large number of records, and report the average time
+        //    taken by each call to `publish`.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "performance.ring");
+
+        Obj mX(&ta);
+        ASSERT(0 == mX.open(fileName.c_str()));
+
+        RecordSP record = u::makeRecord("PERFORMANCE",
+                                        ball::Severity::e_TRACE,
+                                        __FILE__,
+                                        __LINE__,
+                                        "a typical trace message of modest "
+                                        "length, e.g., 'value = 42'",
+                                        &ta);
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            mX.publish(record, ball::Context());
+        }
+        timer.stop();
+
+        cout << "publish: "
+             << timer.accumulatedWallTime() * 1e9 / NUM_RECORDS
+             << " ns" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
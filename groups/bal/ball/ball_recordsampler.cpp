@@ -0,0 +1,219 @@
+// ball_recordsampler.cpp                                             -*-C++-*-
+#include <ball_recordsampler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_recordsampler_cpp,"$Id$ $CSID$")
+
+#include <bdlmt_stripeutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+/// Value of `d_periodStart` indicating that no period is in progress.
+const bsls::Types::Int64 k_NO_PERIOD =
+                                bsl::numeric_limits<bsls::Types::Int64>::min();
+
+/// Value of `d_periodStart` indicating that a thread is starting a new
+/// period.
+const bsls::Types::Int64 k_ROLLOVER = k_NO_PERIOD + 1;
+
+/// Format of the message of a summary record.
+const char *const k_SUMMARY_FORMAT =
+                        "--- %lld RECORD(S) SUPPRESSED BY SAMPLING POLICY ---";
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class RecordSampler
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 RecordSampler::collectSuppressed()
+{
+    bsls::Types::Int64 numSuppressed = 0;
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        if (0 != d_stripes[i].d_numSuppressed.loadRelaxed()) {
+            numSuppressed += d_stripes[i].d_numSuppressed.swapAcqRel(0);
+        }
+    }
+    return numSuppressed;
+}
+
+RecordSampler::Stripe& RecordSampler::currentStripe()
+{
+    return d_stripes[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
+}
+
+// CLASS METHODS
+int RecordSampler::formatSummary(char               *buffer,
+                                 bsl::size_t         numBytes,
+                                 bsls::Types::Int64  numSuppressed)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+
+    return bsl::snprintf(buffer,
+                         numBytes,
+                         k_SUMMARY_FORMAT,
+                         static_cast<long long>(numSuppressed));
+}
+
+// CREATORS
+RecordSampler::RecordSampler()
+: d_sampleInterval(1)
+, d_maxRecordsPerPeriod(0)
+, d_period(bsls::TimeInterval(1, 0).totalNanoseconds())
+, d_periodStart(k_NO_PERIOD)
+, d_pad1()
+, d_numAdmitted(0)
+, d_pad2()
+{
+}
+
+RecordSampler::RecordSampler(const SamplingPolicy& policy)
+: d_sampleInterval(policy.sampleInterval())
+, d_maxRecordsPerPeriod(policy.maxRecordsPerPeriod())
+, d_period(policy.period().totalNanoseconds())
+, d_periodStart(k_NO_PERIOD)
+, d_pad1()
+, d_numAdmitted(0)
+, d_pad2()
+{
+}
+
+// MANIPULATORS
+bool RecordSampler::admit(bsls::Types::Int64 *numSuppressed,
+                          bsls::Types::Int64  now)
+{
+    BSLS_ASSERT(numSuppressed);
+
+    *numSuppressed = 0;
+
+    const int                sampleInterval = d_sampleInterval.loadRelaxed();
+    const int                maxRecords = d_maxRecordsPerPeriod.loadRelaxed();
+    const bsls::Types::Int64 periodStart    = d_periodStart.loadAcquire();
+
+    if (1 == sampleInterval && 0 == maxRecords) {
+        // The policy is inactive.  If it was active until recently, the
+        // first caller to notice closes the period and reports the records
+        // suppressed during it.
+
+        if (k_NO_PERIOD != periodStart
+         && k_ROLLOVER  != periodStart
+         && periodStart == d_periodStart.testAndSwapAcqRel(periodStart,
+                                                           k_NO_PERIOD)) {
+            *numSuppressed = collectSuppressed();
+        }
+        return true;                                                  // RETURN
+    }
+
+    Stripe& stripe = currentStripe();
+
+    if (k_ROLLOVER == periodStart) {
+        // Another thread is starting a new period, and `d_numAdmitted` may
+        // not have been reset yet.
+
+        stripe.d_numSuppressed.addRelaxed(1);
+        return false;                                                 // RETURN
+    }
+
+    if (k_NO_PERIOD == periodStart
+     || now - periodStart >= d_period.loadRelaxed()) {
+        // Only the caller that succeeds in replacing `periodStart` starts
+        // the new period.  `d_numAdmitted` is reset before the new period
+        // becomes visible to other threads.
+
+        if (periodStart == d_periodStart.testAndSwapAcqRel(periodStart,
+                                                           k_ROLLOVER)) {
+            d_numAdmitted.storeRelaxed(0);
+            *numSuppressed = collectSuppressed();
+            d_periodStart.storeRelease(now);
+        }
+    }
+
+    if (1 < sampleInterval
+     && 0 != (stripe.d_numLogged.addRelaxed(1) - 1) % sampleInterval) {
+        stripe.d_numSuppressed.addRelaxed(1);
+        return false;                                                 // RETURN
+    }
+
+    // Once the limit has been reached, `d_numAdmitted` is only read, so that
+    // its cache line is not contended for the remainder of the period.
+
+    if (0 < maxRecords
+     && (d_numAdmitted.loadRelaxed() >= maxRecords
+      || d_numAdmitted.addRelaxed(1) > maxRecords)) {
+        stripe.d_numSuppressed.addRelaxed(1);
+        return false;                                                 // RETURN
+    }
+
+    return true;
+}
+
+bsls::Types::Int64 RecordSampler::endExpiredPeriod(bsls::Types::Int64 now)
+{
+    const bsls::Types::Int64 periodStart = d_periodStart.loadAcquire();
+
+    if (k_NO_PERIOD == periodStart || k_ROLLOVER == periodStart) {
+        return 0;                                                     // RETURN
+    }
+
+    if (isActive() && now - periodStart < d_period.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    // Only the caller that succeeds in replacing 'periodStart' ends the
+    // period.  The next call to 'admit' finds no period in progress, and
+    // starts a new one.
+
+    if (periodStart != d_periodStart.testAndSwapAcqRel(periodStart,
+                                                       k_NO_PERIOD)) {
+        return 0;                                                     // RETURN
+    }
+
+    return collectSuppressed();
+}
+
+void RecordSampler::setPolicy(const SamplingPolicy& policy)
+{
+    d_period.storeRelaxed(policy.period().totalNanoseconds());
+    d_maxRecordsPerPeriod.storeRelaxed(policy.maxRecordsPerPeriod());
+    d_sampleInterval.storeRelaxed(policy.sampleInterval());
+}
+
+// ACCESSORS
+SamplingPolicy RecordSampler::policy() const
+{
+    bsls::TimeInterval period;
+    period.setTotalNanoseconds(d_period.loadRelaxed());
+
+    return SamplingPolicy(d_sampleInterval.loadRelaxed(),
+                          d_maxRecordsPerPeriod.loadRelaxed(),
+                          period);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,351 @@
+// ball_recordsampler.h                                               -*-C++-*-
+#ifndef INCLUDED_BALL_RECORDSAMPLER
+#define INCLUDED_BALL_RECORDSAMPLER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a scalable mechanism that applies a log sampling policy.
+//
+//@CLASSES:
+//  ball::RecordSampler: thread-safe, low-contention sampling policy enforcer
+//
+//@SEE_ALSO: ball_samplingpolicy, ball_category, ball_loggermanager
+//
+//@DESCRIPTION: This component provides a mechanism, `ball::RecordSampler`,
+// that decides, for each record logged to a category, whether the record is
+// published or suppressed according to a `ball::SamplingPolicy`, and that
+// counts the suppressed records so that their number can be reported once
+// per period.  A `ball::Category` creates a `ball::RecordSampler` the first
+// time a sampling policy is applied to it (see
+// `ball::Administration::setSamplingPolicy`).  The logging macros of
+// `ball_log` and `ball_logthrottle` consult the sampler (see
+// `ball::Log::isRecordAdmitted`) for every record that passes the category's
+// threshold levels, *before* the record is created and its message is
+// formatted, so that a suppressed record costs little more than a disabled
+// one.  Records whose severity is at least as severe as the trigger or
+// trigger-all threshold level of the category are never suppressed.  Note
+// that records logged directly through `ball::Logger::logMessage` are not
+// sampled.
+//
+///Sampling and Rate Limiting
+///--------------------------
+// The two constraints of the policy are applied in turn:
+//
+// 1. **Sampling**: of the records logged by each thread, one in every
+//    `sampleInterval` (starting with the first) is considered further; the
+//    others are suppressed.  Note that threads that map to the same stripe
+//    (see {Performance}) share a sampling counter.
+// 2. **Rate limiting**: of the records that were sampled, at most
+//    `maxRecordsPerPeriod` records (shared by all threads) are admitted in
+//    each `period`; the others are suppressed.  Note that a record being
+//    admitted by a thread concurrently with the start of a new period may be
+//    counted against the preceding period, so the limit may be exceeded by
+//    at most one record per logging thread at a period boundary.
+//
+// Note that the sampling counters are per stripe rather than per thread
+// (see {Performance}), and that there is no per-thread rate limit: a limit
+// applied to each thread separately would let the total number of records
+// published grow with the number of logging threads, and so would not
+// protect the I/O of the process from a log storm, while keeping sampling
+// state for each pair of thread and category would cost a lookup in
+// thread-specific storage for every record logged.
+//
+///Reporting Suppressed Records
+///----------------------------
+// The number of records suppressed during a period is reported by the first
+// of the following calls made after the period has elapsed, so that the
+// caller can publish a summary:
+//
+// * `admit`, which also starts a new period, loads the number into its
+//   `numSuppressed` argument.
+// * `endExpiredPeriod` returns the number, and ends the period without
+//   starting a new one (the next call to `admit` starts it).
+//
+// The sampler has no timer of its own.  The logging macros report the
+// suppressed records of a category when the next record is logged to it (see
+// `ball::Log::isRecordAdmitted`), and
+// `ball::Administration::publishSamplingSummaries`, which is intended to be
+// called periodically (e.g., by a `bdlmt::EventScheduler`), reports those of
+// every category whose period has elapsed, so that a summary is published
+// even if no further record is logged to the category.  Changing the policy
+// to an inactive one (see `SamplingPolicy::isActive`) ends the current
+// period, and the pending count is reported by the next call to either
+// function.
+//
+///Thread Safety
+///-------------
+// `ball::RecordSampler` is fully *thread-safe*, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.
+//
+///Performance
+///-----------
+// `admit` is lock-free, and is designed so that the sampler does not become
+// a point of contention during a log storm:
+//
+// * The per-thread sampling counters and the suppressed counts are kept in
+//   `k_NUM_STRIPES` stripes, each on its own cache line, that are selected by
+//   the identifier of the calling thread (see `bdlmt_stripeutil`).
+// * The shared count of records admitted during the current period is
+//   modified at most `maxRecordsPerPeriod` times per period (plus once per
+//   contending thread); once the limit has been reached, it is only read.
+// * The current time is obtained (using `bsls::TimeUtil::getTimer`) only if
+//   the policy is active.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Limiting a Log Storm
+///- - - - - - - - - - - - - - - -
+// Suppose that we want to admit at most 3 records per second, and report the
+// number of records that were suppressed.  We create a sampler with a
+// suitable policy:
+// ```
+// ball::RecordSampler sampler(ball::SamplingPolicy(1,
+//                                                  3,
+//                                                  bsls::TimeInterval(1, 0)));
+// ```
+// Then, we simulate a burst of 10 records logged at time 0 (for illustration
+// we supply the current time, in nanoseconds, explicitly):
+// ```
+// bsls::Types::Int64 numSuppressed;
+// int                numAdmitted = 0;
+//
+// for (int i = 0; i < 10; ++i) {
+//     if (sampler.admit(&numSuppressed, 0)) {
+//         ++numAdmitted;
+//     }
+//     assert(0 == numSuppressed);
+// }
+// assert(3 == numAdmitted);
+// ```
+// Finally, the first record logged after the period has elapsed is admitted,
+// and reports the number of records suppressed during the preceding period:
+// ```
+// assert(sampler.admit(&numSuppressed, 1000 * 1000 * 1000));
+// assert(7 == numSuppressed);
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_samplingpolicy.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                            // ===================
+                            // class RecordSampler
+                            // ===================
+
+/// This mechanism class applies a `SamplingPolicy` to the records logged by
+/// any number of threads, and counts the records it suppresses.  See the
+/// component-level documentation for details.
+class RecordSampler {
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_NUM_STRIPES = 16  // number of (cache-line sized) stripes over which
+                            // per-thread state is distributed
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// State shared by the threads whose identifiers map to the same stripe.
+    struct Stripe {
+
+        // DATA
+        bsls::AtomicInt64 d_numLogged;      // records logged (for sampling)
+
+        bsls::AtomicInt64 d_numSuppressed;  // records suppressed and not yet
+                                            // reported
+
+        char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                - 2 * sizeof(bsls::AtomicInt64)];
+                                            // padding to a full cache line
+    };
+
+    // DATA
+    bsls::AtomicInt    d_sampleInterval;       // policy attribute
+
+    bsls::AtomicInt    d_maxRecordsPerPeriod;  // policy attribute
+
+    bsls::AtomicInt64  d_period;               // policy attribute, in
+                                               // nanoseconds
+
+    bsls::AtomicInt64  d_periodStart;          // timer value at which the
+                                               // current period started, or
+                                               // a sentinel value
+
+    char               d_pad1[  bslmt::Platform::e_CACHE_LINE_SIZE
+                              - 2 * sizeof(bsls::AtomicInt)
+                              - 2 * sizeof(bsls::AtomicInt64)];
+                                               // padding separating the
+                                               // read-mostly data above from
+                                               // the counter below
+
+    bsls::AtomicInt    d_numAdmitted;          // records admitted during the
+                                               // current period
+
+    char               d_pad2[  bslmt::Platform::e_CACHE_LINE_SIZE
+                              - sizeof(bsls::AtomicInt)];
+                                               // padding separating
+                                               // `d_numAdmitted` from the
+                                               // stripes
+
+    Stripe             d_stripes[k_NUM_STRIPES];
+                                               // per-thread counters
+
+    // NOT IMPLEMENTED
+    RecordSampler(const RecordSampler&);
+    RecordSampler& operator=(const RecordSampler&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Reset the suppressed counts of all stripes to 0, and return the sum
+    /// of their values prior to the reset.
+    bsls::Types::Int64 collectSuppressed();
+
+    /// Return a reference providing modifiable access to the stripe
+    /// assigned to the calling thread.
+    Stripe& currentStripe();
+
+  public:
+    // CLASS METHODS
+
+    /// Write to the specified `buffer` of the specified `numBytes` the
+    /// null-terminated message of the summary record that reports the
+    /// specified `numSuppressed` records, truncated if necessary, and return
+    /// the length of the complete message.  The behavior is undefined
+    /// unless `buffer` has room for at least `numBytes` characters.
+    static int formatSummary(char               *buffer,
+                             bsl::size_t         numBytes,
+                             bsls::Types::Int64  numSuppressed);
+
+    // CREATORS
+
+    /// Create a record sampler that applies an inactive sampling policy
+    /// (i.e., one that admits every record).
+    RecordSampler();
+
+    /// Create a record sampler that applies the specified `policy`.
+    explicit RecordSampler(const SamplingPolicy& policy);
+
+    /// Destroy this object.
+    //! ~RecordSampler() = default;
+
+    // MANIPULATORS
+
+    /// Return `true` if a record logged by the calling thread at the
+    /// current time should be published, and `false` if it should be
+    /// suppressed.  Load into the specified `numSuppressed` the number of
+    /// records suppressed during the preceding period(s) if this call
+    /// started a new period (or closed a period after the policy was made
+    /// inactive), and 0 otherwise.
+    bool admit(bsls::Types::Int64 *numSuppressed);
+
+    /// Return `true` if a record logged by the calling thread at the
+    /// specified `now` should be published, and `false` if it should be
+    /// suppressed.  Load into the specified `numSuppressed` the number of
+    /// records suppressed during the preceding period(s) if this call
+    /// started a new period (or closed a period after the policy was made
+    /// inactive), and 0 otherwise.  `now` is expressed in nanoseconds
+    /// relative to an arbitrary, fixed origin, as returned by
+    /// `bsls::TimeUtil::getTimer`.  The behavior is undefined unless `now`
+    /// is not less than the value supplied by any earlier call that started
+    /// the current period.
+    bool admit(bsls::Types::Int64 *numSuppressed, bsls::Types::Int64 now);
+
+    /// End the current period if it has elapsed at the current time, or if
+    /// the policy applied by this object is inactive, and return the number
+    /// of records suppressed during the preceding period(s); return 0, with
+    /// no effect, if no period has elapsed.  The next call to `admit` starts
+    /// a new period.
+    bsls::Types::Int64 endExpiredPeriod();
+
+    /// End the current period if it has elapsed at the specified `now`, or
+    /// if the policy applied by this object is inactive, and return the
+    /// number of records suppressed during the preceding period(s); return
+    /// 0, with no effect, if no period has elapsed.  The next call to
+    /// `admit` starts a new period.  `now` is expressed in nanoseconds
+    /// relative to an arbitrary, fixed origin, as returned by
+    /// `bsls::TimeUtil::getTimer`.  The behavior is undefined unless `now`
+    /// is not less than the value supplied by any earlier call that started
+    /// the current period.
+    bsls::Types::Int64 endExpiredPeriod(bsls::Types::Int64 now);
+
+    /// Set the sampling policy applied by this object to the specified
+    /// `policy`.  Records suppressed under the previous policy remain
+    /// pending, and are reported by a later call to `admit`.
+    void setPolicy(const SamplingPolicy& policy);
+
+    // ACCESSORS
+
+    /// Return `true` if the sampling policy applied by this object is
+    /// active, and `false` otherwise.
+    bool isActive() const;
+
+    /// Return the sampling policy applied by this object.
+    SamplingPolicy policy() const;
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class RecordSampler
+                            // -------------------
+
+// MANIPULATORS
+inline
+bool RecordSampler::admit(bsls::Types::Int64 *numSuppressed)
+{
+    return admit(numSuppressed, isActive() ? bsls::TimeUtil::getTimer() : 0);
+}
+
+inline
+bsls::Types::Int64 RecordSampler::endExpiredPeriod()
+{
+    return endExpiredPeriod(isActive() ? bsls::TimeUtil::getTimer() : 0);
+}
+
+// ACCESSORS
+inline
+bool RecordSampler::isActive() const
+{
+    return 1 < d_sampleInterval.loadRelaxed()
+        || 0 < d_maxRecordsPerPeriod.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,779 @@
+// ball_recordsampler.t.cpp                                           -*-C++-*-
+#include <ball_recordsampler.h>
+
+#include <ball_samplingpolicy.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // strcmp()
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe mechanism that applies a sampling
+// policy.  The single-threaded tests supply the current time explicitly, so
+// that period boundaries are deterministic.  The concurrent test verifies
+// that no record is lost from the accounting (every record logged is either
+// admitted or reported as suppressed), and that the rate limit holds within
+// its documented tolerance.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 7] int formatSummary(char *, size_t, Int64);
+//
+// CREATORS
+// [ 2] RecordSampler();
+// [ 2] explicit RecordSampler(const SamplingPolicy& policy);
+//
+// MANIPULATORS
+// [ 3] bool admit(Int64 *numSuppressed);
+// [ 3] bool admit(Int64 *numSuppressed, Int64 now);
+// [ 7] Int64 endExpiredPeriod();
+// [ 7] Int64 endExpiredPeriod(Int64 now);
+// [ 2] void setPolicy(const SamplingPolicy& policy);
+//
+// ACCESSORS
+// [ 2] bool isActive() const;
+// [ 2] SamplingPolicy policy() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] RATE LIMITING AND PERIODS
+// [ 5] CHANGING THE POLICY
+// [ 6] CONCURRENT ADMISSION
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RecordSampler  Obj;
+typedef ball::SamplingPolicy Policy;
+typedef bsls::Types::Int64   Int64;
+
+const Int64 k_SECOND = 1000 * 1000 * 1000;  // one second, in nanoseconds
+
+//=============================================================================
+//                         CASE 6 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace RECORDSAMPLER_TEST_CASE_6 {
+
+enum {
+    k_NUM_THREADS         = 8,
+    k_RECORDS_PER_THREAD  = 20000,
+    k_SAMPLE_INTERVAL     = 2,
+    k_MAX_RECORDS         = 1000
+};
+
+Obj              *sampler;
+bsls::AtomicInt64 numAdmitted;
+bsls::AtomicInt64 numReported;
+
+extern "C" void *logRecords(void *)
+{
+    for (int i = 0; i < k_RECORDS_PER_THREAD; ++i) {
+        Int64 numSuppressed;
+        if (sampler->admit(&numSuppressed, 0)) {
+            ++numAdmitted;
+        }
+        numReported += numSuppressed;
+    }
+    return 0;
+}
+
+}  // close namespace RECORDSAMPLER_TEST_CASE_6
+
+//=============================================================================
+//                         CASE -1 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace RECORDSAMPLER_TEST_CASE_MINUS_1 {
+
+Obj *sampler;
+int  numIterations;
+
+extern "C" void *benchmarkAdmit(void *)
+{
+    Int64 numSuppressed;
+    for (int i = 0; i < numIterations; ++i) {
+        sampler->admit(&numSuppressed);
+    }
+    return 0;
+}
+
+}  // close namespace RECORDSAMPLER_TEST_CASE_MINUS_1
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        ball::RecordSampler sampler(ball::SamplingPolicy(
+                                                    1,
+                                                    3,
+                                                    bsls::TimeInterval(1, 0)));
+
+        bsls::Types::Int64 numSuppressed;
+        int                numAdmitted = 0;
+
+        for (int i = 0; i < 10; ++i) {
+            if (sampler.admit(&numSuppressed, 0)) {
+                ++numAdmitted;
+            }
+            ASSERT(0 == numSuppressed);
+        }
+        ASSERT(3 == numAdmitted);
+
+        ASSERT(sampler.admit(&numSuppressed, 1000 * 1000 * 1000));
+        ASSERT(7 == numSuppressed);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // ENDING EXPIRED PERIODS
+        //
+        // Concerns:
+        // 1. `endExpiredPeriod` has no effect, and returns 0, unless a period
+        //    is in progress and has elapsed.
+        //
+        // 2. `endExpiredPeriod` ends an elapsed period, and returns the
+        //    number of records suppressed during it exactly once; the next
+        //    call to `admit` starts a new period, and reports nothing.
+        //
+        // 3. `endExpiredPeriod` ends the period immediately once the policy
+        //    has been made inactive.
+        //
+        // 4. `formatSummary` writes the number of suppressed records, and
+        //    truncates the message to fit the buffer.
+        //
+        // Plan:
+        // 1. Suppress records at explicitly supplied times, and verify the
+        //    values returned by `endExpiredPeriod` before and after the end
+        //    of the period, and the subsequent behavior of `admit`.  (C-1..2)
+        //
+        // 2. Suppress records, make the policy inactive, and verify that
+        //    `endExpiredPeriod` reports them regardless of the time.  (C-3)
+        //
+        // 3. Format summaries into buffers of various sizes, and verify the
+        //    result.  (C-4)
+        //
+        // Testing:
+        //   int formatSummary(char *, size_t, Int64);
+        //   Int64 endExpiredPeriod();
+        //   Int64 endExpiredPeriod(Int64 now);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nENDING EXPIRED PERIODS"
+                          << "\n======================" << endl;
+
+        Int64 numSuppressed;
+
+        if (veryVerbose) cout << "\tElapsed periods." << endl;
+        {
+            Obj mX(Policy(1, 2, bsls::TimeInterval(1, 0)));
+
+            ASSERT(0 == mX.endExpiredPeriod(0));
+            ASSERT(0 == mX.endExpiredPeriod());
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, (i < 2) == mX.admit(&numSuppressed, 100));
+            }
+
+            ASSERT(0 == mX.endExpiredPeriod(100));
+            ASSERT(0 == mX.endExpiredPeriod(100 + k_SECOND - 1));
+
+            ASSERT(3 == mX.endExpiredPeriod(100 + k_SECOND));
+            ASSERT(0 == mX.endExpiredPeriod(100 + k_SECOND));
+            ASSERT(0 == mX.endExpiredPeriod(100 + 5 * k_SECOND));
+
+            // The next record starts a new period, with a fresh limit.
+
+            ASSERT( mX.admit(&numSuppressed, 100 + 5 * k_SECOND));
+            ASSERT(0 == numSuppressed);
+            ASSERT( mX.admit(&numSuppressed, 100 + 5 * k_SECOND));
+            ASSERT(!mX.admit(&numSuppressed, 100 + 5 * k_SECOND));
+            ASSERT(0 == numSuppressed);
+
+            ASSERT(0 == mX.endExpiredPeriod(100 + 6 * k_SECOND - 1));
+            ASSERT(1 == mX.endExpiredPeriod(100 + 6 * k_SECOND));
+        }
+
+        if (veryVerbose) cout << "\tInactive policy." << endl;
+        {
+            Obj mX(Policy(2, 0, bsls::TimeInterval(3600, 0)));
+
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, (0 == i % 2) == mX.admit(&numSuppressed, 0));
+            }
+
+            ASSERT(0 == mX.endExpiredPeriod(0));
+
+            mX.setPolicy(Policy());
+
+            ASSERT(3 == mX.endExpiredPeriod());
+            ASSERT(0 == mX.endExpiredPeriod());
+
+            ASSERT(mX.admit(&numSuppressed));
+            ASSERT(0 == numSuppressed);
+        }
+
+        if (veryVerbose) cout << "\tFormatting summaries." << endl;
+        {
+            const char *EXPECTED =
+                          "--- 42 RECORD(S) SUPPRESSED BY SAMPLING POLICY ---";
+            const int   LENGTH   = static_cast<int>(bsl::strlen(EXPECTED));
+
+            char buffer[96];
+
+            ASSERT(LENGTH == Obj::formatSummary(buffer, sizeof buffer, 42));
+            ASSERTV(buffer, 0 == bsl::strcmp(EXPECTED, buffer));
+
+            ASSERT(LENGTH == Obj::formatSummary(buffer, 8, 42));
+            ASSERTV(buffer, 0 == bsl::strcmp("--- 42 ", buffer));
+
+            ASSERT(LENGTH == Obj::formatSummary(0, 0, 42));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ADMISSION
+        //
+        // Concerns:
+        // 1. Every record logged concurrently is either admitted or counted
+        //    as suppressed, exactly once.
+        //
+        // 2. The number of records admitted during a period does not exceed
+        //    the limit by more than one record per thread.
+        //
+        // Plan:
+        // 1. Concurrently log records from several threads, all within one
+        //    period, under a policy that both samples and limits the rate.
+        //
+        // 2. Make the policy inactive, and verify that the number of admitted
+        //    records and the number of reported suppressed records add up to
+        //    the number of records logged, and that the number of admitted
+        //    records is within the expected range.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT ADMISSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT ADMISSION"
+                          << "\n====================" << endl;
+
+        using namespace RECORDSAMPLER_TEST_CASE_6;
+
+        Obj mX(Policy(k_SAMPLE_INTERVAL,
+                      k_MAX_RECORDS,
+                      bsls::TimeInterval(1, 0)));
+        sampler = &mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  logRecords,
+                                                  0));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        // Making the policy inactive reports every pending suppressed record.
+
+        mX.setPolicy(Policy());
+
+        Int64 numSuppressed;
+        ASSERT(mX.admit(&numSuppressed));
+
+        const Int64 ADMITTED = numAdmitted;
+        const Int64 REPORTED = numReported + numSuppressed;
+
+        if (veryVerbose) { P_(ADMITTED) P(REPORTED) }
+
+        ASSERTV(ADMITTED, REPORTED,
+                k_NUM_THREADS * k_RECORDS_PER_THREAD == ADMITTED + REPORTED);
+        ASSERTV(ADMITTED, k_MAX_RECORDS <= ADMITTED);
+        ASSERTV(ADMITTED, k_MAX_RECORDS + k_NUM_THREADS >= ADMITTED);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CHANGING THE POLICY
+        //
+        // Concerns:
+        // 1. A policy change takes effect for subsequent calls to `admit`.
+        //
+        // 2. Records suppressed under an active policy are reported by the
+        //    first call to `admit` after the policy is made inactive, and
+        //    only by that call.
+        //
+        // 3. Re-activating the policy starts a new period.
+        //
+        // Plan:
+        // 1. Suppress records under an active policy, make the policy
+        //    inactive, and verify the value reported by subsequent calls to
+        //    `admit`.  (C-1..2)
+        //
+        // 2. Re-activate the policy, and verify that the limit applies afresh
+        //    regardless of the time supplied.  (C-3)
+        //
+        // Testing:
+        //   CHANGING THE POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCHANGING THE POLICY"
+                          << "\n===================" << endl;
+
+        Obj   mX(Policy(1, 1, bsls::TimeInterval(1, 0)));
+        Int64 numSuppressed;
+
+        ASSERT( mX.admit(&numSuppressed, 0));
+        ASSERT(0 == numSuppressed);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT(!mX.admit(&numSuppressed, 0));
+            ASSERT(0 == numSuppressed);
+        }
+
+        mX.setPolicy(Policy());
+
+        ASSERT( mX.admit(&numSuppressed, 0));
+        ASSERTV(numSuppressed, 5 == numSuppressed);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT( mX.admit(&numSuppressed));
+            ASSERT(0 == numSuppressed);
+        }
+
+        mX.setPolicy(Policy(1, 2, bsls::TimeInterval(1, 0)));
+
+        ASSERT( mX.admit(&numSuppressed, 10 * k_SECOND));
+        ASSERT( mX.admit(&numSuppressed, 10 * k_SECOND));
+        ASSERT(!mX.admit(&numSuppressed, 10 * k_SECOND));
+        ASSERT(0 == numSuppressed);
+
+        ASSERT( mX.admit(&numSuppressed, 11 * k_SECOND));
+        ASSERT(1 == numSuppressed);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RATE LIMITING AND PERIODS
+        //
+        // Concerns:
+        // 1. At most `maxRecordsPerPeriod` sampled records are admitted per
+        //    period.
+        //
+        // 2. The first call made once `period` has elapsed since the start
+        //    of the current period starts a new period, and reports the
+        //    number of records suppressed since the previous report.
+        //
+        // 3. Periods in which no record is logged do not cause a report.
+        //
+        // 4. Sampling and rate limiting compose.
+        //
+        // Plan:
+        // 1. Log records at explicitly supplied times around the period
+        //    boundaries, and verify the result of each call and the reported
+        //    counts.  (C-1..4)
+        //
+        // Testing:
+        //   RATE LIMITING AND PERIODS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nRATE LIMITING AND PERIODS"
+                          << "\n=========================" << endl;
+
+        Int64 numSuppressed;
+
+        if (veryVerbose) cout << "\tRate limiting only." << endl;
+        {
+            Obj mX(Policy(1, 3, bsls::TimeInterval(1, 0)));
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, (i < 3) == mX.admit(&numSuppressed, 100));
+                ASSERTV(i, 0 == numSuppressed);
+            }
+
+            // Still within the first period.
+
+            ASSERT(!mX.admit(&numSuppressed, 100 + k_SECOND - 1));
+            ASSERT(0 == numSuppressed);
+
+            ASSERT( mX.admit(&numSuppressed, 100 + k_SECOND));
+            ASSERTV(numSuppressed, 8 == numSuppressed);
+
+            ASSERT( mX.admit(&numSuppressed, 100 + k_SECOND));
+            ASSERT(0 == numSuppressed);
+
+            // Several idle periods elapse; nothing is pending.
+
+            ASSERT( mX.admit(&numSuppressed, 100 + 5 * k_SECOND));
+            ASSERT(0 == numSuppressed);
+        }
+
+        if (veryVerbose) cout << "\tSampling and rate limiting." << endl;
+        {
+            Obj mX(Policy(4, 2, bsls::TimeInterval(0, 1000)));
+
+            // Records 0, 4, 8, ... are sampled; records 0 and 4 are admitted.
+
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, (0 == i || 4 == i) == mX.admit(&numSuppressed, 0));
+            }
+
+            ASSERT( mX.admit(&numSuppressed, 1000));  // record 20
+            ASSERTV(numSuppressed, 18 == numSuppressed);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `admit`
+        //
+        // Concerns:
+        // 1. An inactive policy admits every record, and reports nothing.
+        //
+        // 2. With `sampleInterval` N, the first, and then every Nth, record
+        //    logged by a thread is admitted.
+        //
+        // 3. The records suppressed by sampling are reported at the end of
+        //    the period.
+        //
+        // 4. The overload that obtains the current time itself behaves
+        //    consistently.
+        //
+        // 5. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Log a sequence of records under various sampling intervals, and
+        //    verify the result of each call to `admit`.  (C-1..4)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a null `numSuppressed`.  (C-5)
+        //
+        // Testing:
+        //   bool admit(Int64 *numSuppressed);
+        //   bool admit(Int64 *numSuppressed, Int64 now);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `admit`"
+                          << "\n===============" << endl;
+
+        Int64 numSuppressed;
+
+        {
+            Obj mX;
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(mX.admit(&numSuppressed, i * k_SECOND));
+                ASSERT(0 == numSuppressed);
+                ASSERT(mX.admit(&numSuppressed));
+                ASSERT(0 == numSuppressed);
+            }
+        }
+
+        for (int interval = 1; interval <= 7; ++interval) {
+            Obj mX(Policy(interval, 0, bsls::TimeInterval(1, 0)));
+
+            for (int i = 0; i < 50; ++i) {
+                ASSERTV(interval, i,
+                        (0 == i % interval) == mX.admit(&numSuppressed, 0));
+                ASSERTV(interval, i, 0 == numSuppressed);
+            }
+
+            const Int64 EXPECTED = 50 - (50 + interval - 1) / interval;
+
+            ASSERTV(interval,
+                    (0 == 50 % interval) == mX.admit(&numSuppressed,
+                                                     k_SECOND));
+            ASSERTV(interval, numSuppressed, EXPECTED == numSuppressed);
+        }
+
+        {
+            Obj mX(Policy(3, 0, bsls::TimeInterval(3600, 0)));
+
+            for (int i = 0; i < 30; ++i) {
+                ASSERTV(i, (0 == i % 3) == mX.admit(&numSuppressed));
+                ASSERTV(i, 0 == numSuppressed);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.admit(&numSuppressed, 0));
+            ASSERT_FAIL(mX.admit(0, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, `setPolicy`, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The default constructor creates a sampler applying the default
+        //    (inactive) policy.
+        //
+        // 2. The value constructor and `setPolicy` set the policy returned by
+        //    `policy`, and `isActive` reflects it.
+        //
+        // Plan:
+        // 1. Create samplers with, and set, a variety of policies, and verify
+        //    the values returned by the accessors.  (C-1..2)
+        //
+        // Testing:
+        //   RecordSampler();
+        //   explicit RecordSampler(const SamplingPolicy& policy);
+        //   void setPolicy(const SamplingPolicy& policy);
+        //   bool isActive() const;
+        //   SamplingPolicy policy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CREATORS, `setPolicy`, AND ACCESSORS"
+                          << "\n============================================"
+                          << endl;
+
+        const Policy POLICIES[] = {
+            Policy(),
+            Policy(2, 0, bsls::TimeInterval(1, 0)),
+            Policy(1, 5, bsls::TimeInterval(0, 1000)),
+            Policy(10, 100, bsls::TimeInterval(60, 0)),
+            Policy(1, 0, bsls::TimeInterval(2, 500)),
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        {
+            const Obj X;
+            ASSERT(Policy() == X.policy());
+            ASSERT(!X.isActive());
+        }
+
+        for (int i = 0; i < NUM_POLICIES; ++i) {
+            const Policy& POLICY = POLICIES[i];
+
+            const Obj X(POLICY);
+            ASSERTV(i, POLICY            == X.policy());
+            ASSERTV(i, POLICY.isActive() == X.isActive());
+
+            for (int j = 0; j < NUM_POLICIES; ++j) {
+                Obj mY(POLICIES[j]);  const Obj& Y = mY;
+
+                mY.setPolicy(POLICY);
+                ASSERTV(i, j, POLICY            == Y.policy());
+                ASSERTV(i, j, POLICY.isActive() == Y.isActive());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a sampler, apply a policy, and admit some records.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj   mX;
+        Int64 numSuppressed = -1;
+
+        ASSERT(mX.admit(&numSuppressed));
+        ASSERT(0 == numSuppressed);
+
+        mX.setPolicy(Policy(2, 0, bsls::TimeInterval(1, 0)));
+        ASSERT(mX.isActive());
+
+        ASSERT( mX.admit(&numSuppressed, 0));
+        ASSERT(!mX.admit(&numSuppressed, 0));
+        ASSERT( mX.admit(&numSuppressed, 0));
+        ASSERT(!mX.admit(&numSuppressed, k_SECOND / 2));
+        ASSERT( mX.admit(&numSuppressed, k_SECOND));
+        ASSERT(2 == numSuppressed);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. The cost of `admit` during a log storm, when every record is
+        //    suppressed, remains low as the number of logging threads grows.
+        //
+        // Plan:
+        // 1. For an increasing number of threads, call `admit` repeatedly
+        //    under a policy whose limit is exhausted, and report the average
+        //    time per call.  The number of calls per thread may be specified
+        //    as the second command-line argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        using namespace RECORDSAMPLER_TEST_CASE_MINUS_1;
+
+        numIterations = argc > 2 ? atoi(argv[2]) : 1000 * 1000;
+        if (numIterations <= 0) {
+            numIterations = 1000 * 1000;
+        }
+
+        Obj mX(Policy(10, 1, bsls::TimeInterval(3600, 0)));
+        sampler = &mX;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            bslmt::ThreadUtil::Handle handles[8];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numThreads; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      benchmarkAdmit,
+                                                      0));
+            }
+            for (int i = 0; i < numThreads; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            timer.stop();
+
+            const double nsPerCall = timer.elapsedTime() * 1e9
+                                   / numIterations / numThreads;
+
+            cout << "threads: " << numThreads
+                 << "\tns per call: " << nsPerCall << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
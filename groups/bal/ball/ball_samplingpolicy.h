@@ -0,0 +1,319 @@
+// ball_samplingpolicy.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_SAMPLINGPOLICY
+#define INCLUDED_BALL_SAMPLINGPOLICY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a value-semantic description of a log sampling policy.
+//
+//@CLASSES:
+//  ball::SamplingPolicy: sampling interval, rate limit, and reporting period
+//
+//@SEE_ALSO: ball_recordsampler, ball_administration
+//
+//@DESCRIPTION: This component implements a simply-constrained
+// value-semantic attribute class, `ball::SamplingPolicy`, that describes how
+// the records logged to a category are to be thinned out before they are
+// published.  A sampling policy has three attributes:
+//
+// ```
+// Name                 Type               Default   Constraint
+// -------------------  -----------------  --------  ----------
+// sampleInterval       int                1         >= 1
+// maxRecordsPerPeriod  int                0         >= 0
+// period               bsls::TimeInterval 1 second  > 0
+// ```
+//
+// * `sampleInterval`: only one in every `sampleInterval` records is
+//   considered for publication; a value of 1 admits every record.
+// * `maxRecordsPerPeriod`: at most `maxRecordsPerPeriod` records are
+//   published in each `period`; a value of 0 imposes no limit.
+// * `period`: the length of the time window over which
+//   `maxRecordsPerPeriod` is applied, and at the end of which the number of
+//   records suppressed during the window is reported.
+//
+// A policy having the default value is *inactive* (see `isActive`): it admits
+// every record, and a category configured with it behaves exactly as a
+// category to which no policy was ever applied.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following code fragment describes a policy that considers one in every
+// ten records, and publishes at most 100 of those in any one-second period:
+// ```
+// ball::SamplingPolicy policy;
+// assert(!policy.isActive());
+//
+// policy.setSampleInterval(10);
+// policy.setMaxRecordsPerPeriod(100);
+// assert( policy.isActive());
+// assert(bsls::TimeInterval(1, 0) == policy.period());
+// ```
+
+#include <balscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                            // ====================
+                            // class SamplingPolicy
+                            // ====================
+
+/// This simply-constrained attribute class describes the sampling interval,
+/// the maximum number of records per period, and the period that together
+/// determine which of the records logged to a category are published.  See
+/// the component-level documentation for the constraints on each attribute.
+class SamplingPolicy {
+
+    // DATA
+    int                d_sampleInterval;       // admit one in this many
+
+    int                d_maxRecordsPerPeriod;  // limit per period (0 means
+                                               // unlimited)
+
+    bsls::TimeInterval d_period;               // rate limit and reporting
+                                               // period
+
+    // FRIENDS
+    friend bool operator==(const SamplingPolicy&, const SamplingPolicy&);
+
+  public:
+    // CLASS METHODS
+
+    /// Return `true` if the specified `sampleInterval`,
+    /// `maxRecordsPerPeriod`, and `period` satisfy the constraints
+    /// documented at the component level (i.e., `1 <= sampleInterval`,
+    /// `0 <= maxRecordsPerPeriod`, and `bsls::TimeInterval() < period`), and
+    /// `false` otherwise.
+    static bool isValid(int                       sampleInterval,
+                        int                       maxRecordsPerPeriod,
+                        const bsls::TimeInterval& period);
+
+    // CREATORS
+
+    /// Create an inactive sampling policy having a `sampleInterval` of 1, a
+    /// `maxRecordsPerPeriod` of 0, and a `period` of one second.
+    SamplingPolicy();
+
+    /// Create a sampling policy having the specified `sampleInterval`,
+    /// `maxRecordsPerPeriod`, and `period`.  The behavior is undefined
+    /// unless `isValid(sampleInterval, maxRecordsPerPeriod, period)`.
+    SamplingPolicy(int                       sampleInterval,
+                   int                       maxRecordsPerPeriod,
+                   const bsls::TimeInterval& period);
+
+    /// Create a sampling policy having the same value as the specified
+    /// `original` policy.
+    //! SamplingPolicy(const SamplingPolicy& original) = default;
+
+    /// Destroy this object.
+    //! ~SamplingPolicy() = default;
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` policy, and
+    /// return a reference providing modifiable access to this object.
+    //! SamplingPolicy& operator=(const SamplingPolicy& rhs) = default;
+
+    /// Set the `sampleInterval` attribute of this object to the specified
+    /// `value`.  The behavior is undefined unless `1 <= value`.
+    void setSampleInterval(int value);
+
+    /// Set the `maxRecordsPerPeriod` attribute of this object to the
+    /// specified `value`.  The behavior is undefined unless `0 <= value`.
+    void setMaxRecordsPerPeriod(int value);
+
+    /// Set the `period` attribute of this object to the specified `value`.
+    /// The behavior is undefined unless `bsls::TimeInterval() < value`.
+    void setPeriod(const bsls::TimeInterval& value);
+
+    // ACCESSORS
+
+    /// Return `true` if this policy may suppress records (i.e., if
+    /// `1 < sampleInterval()` or `0 < maxRecordsPerPeriod()`), and `false`
+    /// otherwise.
+    bool isActive() const;
+
+    /// Return the `sampleInterval` attribute of this object.
+    int sampleInterval() const;
+
+    /// Return the `maxRecordsPerPeriod` attribute of this object.
+    int maxRecordsPerPeriod() const;
+
+    /// Return a reference providing non-modifiable access to the `period`
+    /// attribute of this object.
+    const bsls::TimeInterval& period() const;
+
+    /// Format this object to the specified output `stream` at the
+    /// (absolute value of) the optionally specified indentation `level`
+    /// and return a reference to `stream`.  If `level` is specified,
+    /// optionally specify `spacesPerLevel`, the number of spaces per
+    /// indentation level for this and all of its nested objects.  If
+    /// `level` is negative, suppress indentation of the first line.  If
+    /// `spacesPerLevel` is negative, format the entire output on one line,
+    /// suppressing all but the initial indentation (as governed by
+    /// `level`).  If `stream` is not valid on entry, this operation has no
+    /// effect.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` policies have the same
+/// value, and `false` otherwise.  Two policies have the same value if each
+/// of their respective attributes has the same value.
+bool operator==(const SamplingPolicy& lhs, const SamplingPolicy& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` policies do not have the
+/// same value, and `false` otherwise.  Two policies do not have the same
+/// value if any of their respective attributes differ in value.
+bool operator!=(const SamplingPolicy& lhs, const SamplingPolicy& rhs);
+
+/// Write the value of the specified `policy` to the specified output
+/// `stream` in a single-line format, and return a reference to `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const SamplingPolicy& policy);
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class SamplingPolicy
+                            // --------------------
+
+// CLASS METHODS
+inline
+bool SamplingPolicy::isValid(int                       sampleInterval,
+                             int                       maxRecordsPerPeriod,
+                             const bsls::TimeInterval& period)
+{
+    return 1 <= sampleInterval
+        && 0 <= maxRecordsPerPeriod
+        && bsls::TimeInterval() < period;
+}
+
+// CREATORS
+inline
+SamplingPolicy::SamplingPolicy()
+: d_sampleInterval(1)
+, d_maxRecordsPerPeriod(0)
+, d_period(1, 0)
+{
+}
+
+inline
+SamplingPolicy::SamplingPolicy(int                       sampleInterval,
+                               int                       maxRecordsPerPeriod,
+                               const bsls::TimeInterval& period)
+: d_sampleInterval(sampleInterval)
+, d_maxRecordsPerPeriod(maxRecordsPerPeriod)
+, d_period(period)
+{
+    BSLS_ASSERT(isValid(sampleInterval, maxRecordsPerPeriod, period));
+}
+
+// MANIPULATORS
+inline
+void SamplingPolicy::setSampleInterval(int value)
+{
+    BSLS_ASSERT(1 <= value);
+
+    d_sampleInterval = value;
+}
+
+inline
+void SamplingPolicy::setMaxRecordsPerPeriod(int value)
+{
+    BSLS_ASSERT(0 <= value);
+
+    d_maxRecordsPerPeriod = value;
+}
+
+inline
+void SamplingPolicy::setPeriod(const bsls::TimeInterval& value)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < value);
+
+    d_period = value;
+}
+
+// ACCESSORS
+inline
+bool SamplingPolicy::isActive() const
+{
+    return 1 < d_sampleInterval || 0 < d_maxRecordsPerPeriod;
+}
+
+inline
+int SamplingPolicy::sampleInterval() const
+{
+    return d_sampleInterval;
+}
+
+inline
+int SamplingPolicy::maxRecordsPerPeriod() const
+{
+    return d_maxRecordsPerPeriod;
+}
+
+inline
+const bsls::TimeInterval& SamplingPolicy::period() const
+{
+    return d_period;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool ball::operator==(const SamplingPolicy& lhs, const SamplingPolicy& rhs)
+{
+    return lhs.d_sampleInterval      == rhs.d_sampleInterval
+        && lhs.d_maxRecordsPerPeriod == rhs.d_maxRecordsPerPeriod
+        && lhs.d_period              == rhs.d_period;
+}
+
+inline
+bool ball::operator!=(const SamplingPolicy& lhs, const SamplingPolicy& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& ball::operator<<(bsl::ostream&         stream,
+                               const SamplingPolicy& policy)
+{
+    return policy.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
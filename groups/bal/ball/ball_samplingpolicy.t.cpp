@@ -0,0 +1,488 @@
+// ball_samplingpolicy.t.cpp                                          -*-C++-*-
+#include <ball_samplingpolicy.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a simply-constrained attribute class.  We test
+// the value constructor and the manipulators against the basic accessors,
+// then the remaining accessors, the output operations, and the equality
+// operators.  Precondition violations are verified using the `bsls_asserttest`
+// facility.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] static bool isValid(int, int, const bsls::TimeInterval&);
+//
+// CREATORS
+// [ 2] SamplingPolicy();
+// [ 2] SamplingPolicy(int, int, const bsls::TimeInterval&);
+//
+// MANIPULATORS
+// [ 2] void setSampleInterval(int value);
+// [ 2] void setMaxRecordsPerPeriod(int value);
+// [ 2] void setPeriod(const bsls::TimeInterval& value);
+//
+// ACCESSORS
+// [ 3] bool isActive() const;
+// [ 2] int sampleInterval() const;
+// [ 2] int maxRecordsPerPeriod() const;
+// [ 2] const bsls::TimeInterval& period() const;
+// [ 4] bsl::ostream& print(bsl::ostream&, int, int) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const SamplingPolicy&, const SamplingPolicy&);
+// [ 5] bool operator!=(const SamplingPolicy&, const SamplingPolicy&);
+// [ 4] bsl::ostream& operator<<(bsl::ostream&, const SamplingPolicy&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::SamplingPolicy Obj;
+
+static const struct {
+    int       d_line;                 // line number
+    int       d_sampleInterval;       // sample interval
+    int       d_maxRecordsPerPeriod;  // records per period
+    long long d_seconds;              // period (seconds part)
+    int       d_nanoseconds;          // period (nanoseconds part)
+    bool      d_isValid;              // if the above attributes are valid
+    bool      d_isActive;             // if the policy is active
+} DATA[] = {
+    //line  interval  max       seconds  nanos      valid  active
+    //----  --------  --------  -------  ---------  -----  ------
+    { L_,   1,        0,        1,       0,         true,  false },
+    { L_,   1,        0,        0,       1,         true,  false },
+    { L_,   2,        0,        1,       0,         true,  true  },
+    { L_,   1,        1,        1,       0,         true,  true  },
+    { L_,   10,       100,      0,       500000000, true,  true  },
+    { L_,   INT_MAX,  INT_MAX,  3600,    0,         true,  true  },
+    { L_,   0,        0,        1,       0,         false, false },
+    { L_,   -1,       0,        1,       0,         false, false },
+    { L_,   1,        -1,       1,       0,         false, false },
+    { L_,   1,        0,        0,       0,         false, false },
+    { L_,   1,        0,        -1,      0,         false, false },
+    { L_,   INT_MIN,  INT_MIN,  0,       0,         false, false },
+};
+const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Concerns:
+        // 1. The usage example compiles and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate the usage example from the header file into the test
+        //    driver.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "Testing Usage Example"
+                          << endl << "=====================" << endl;
+
+        ball::SamplingPolicy policy;
+        ASSERT(!policy.isActive());
+
+        policy.setSampleInterval(10);
+        policy.setMaxRecordsPerPeriod(100);
+        ASSERT( policy.isActive());
+        ASSERT(bsls::TimeInterval(1, 0) == policy.period());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING EQUALITY OPERATORS
+        //
+        // Concerns:
+        // 1. Two objects compare equal if and only if each of their
+        //    attributes compare equal.
+        //
+        // 2. `operator!=` is the negation of `operator==`.
+        //
+        // Plan:
+        // 1. For each pair of valid entries in `DATA`, create two objects and
+        //    verify the result of both operators.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const SamplingPolicy&, const SamplingPolicy&);
+        //   bool operator!=(const SamplingPolicy&, const SamplingPolicy&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "Testing Equality Operators"
+                          << endl << "==========================" << endl;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            if (!DATA[i].d_isValid) {
+                continue;
+            }
+            const Obj X(DATA[i].d_sampleInterval,
+                        DATA[i].d_maxRecordsPerPeriod,
+                        bsls::TimeInterval(DATA[i].d_seconds,
+                                           DATA[i].d_nanoseconds));
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                if (!DATA[j].d_isValid) {
+                    continue;
+                }
+                const Obj Y(DATA[j].d_sampleInterval,
+                            DATA[j].d_maxRecordsPerPeriod,
+                            bsls::TimeInterval(DATA[j].d_seconds,
+                                               DATA[j].d_nanoseconds));
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        // 1. `print` and `operator<<` format each attribute, by name.
+        //
+        // 2. `operator<<` produces single-line output.
+        //
+        // Plan:
+        // 1. Format an object with both functions and compare the output to
+        //    the expected text.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream&, int, int) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const SamplingPolicy&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing Print and Output Operator" << endl
+                          << "=================================" << endl;
+
+        const Obj X(10, 100, bsls::TimeInterval(2, 0));
+
+        {
+            bsl::ostringstream os;
+            os << X;
+            ASSERTV(os.str(),
+                    "[ sampleInterval = 10 maxRecordsPerPeriod = 100"
+                    " period = (2, 0) ]" == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            X.print(os, 1, 2);
+            ASSERTV(os.str(),
+                    "  [\n"
+                    "    sampleInterval = 10\n"
+                    "    maxRecordsPerPeriod = 100\n"
+                    "    period = (2, 0)\n"
+                    "  ]\n" == os.str());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `isValid` AND `isActive`
+        //
+        // Concerns:
+        // 1. `isValid` returns `true` if and only if each attribute satisfies
+        //    its constraint.
+        //
+        // 2. `isActive` returns `true` if and only if the policy may suppress
+        //    records.
+        //
+        // Plan:
+        // 1. Use the table-driven technique to verify both functions.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   static bool isValid(int, int, const bsls::TimeInterval&);
+        //   bool isActive() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing `isValid` and `isActive`" << endl
+                          << "================================" << endl;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int                LINE     = DATA[i].d_line;
+            const int                INTERVAL = DATA[i].d_sampleInterval;
+            const int                MAX      = DATA[i].d_maxRecordsPerPeriod;
+            const bsls::TimeInterval PERIOD(DATA[i].d_seconds,
+                                            DATA[i].d_nanoseconds);
+
+            ASSERTV(LINE, DATA[i].d_isValid ==
+                                         Obj::isValid(INTERVAL, MAX, PERIOD));
+
+            if (DATA[i].d_isValid) {
+                const Obj X(INTERVAL, MAX, PERIOD);
+                ASSERTV(LINE, DATA[i].d_isActive == X.isActive());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, MANIPULATORS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The default constructor creates an inactive policy having the
+        //    documented default attribute values.
+        //
+        // 2. The value constructor and each manipulator set the corresponding
+        //    attribute, and only that attribute.
+        //
+        // 3. Copy construction and assignment copy every attribute.
+        //
+        // 4. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create a default object and verify its attributes.  (C-1)
+        //
+        // 2. For each valid entry in `DATA`, create an object using the value
+        //    constructor, and another using the manipulators, and verify the
+        //    attributes of both, and of copies of both.  (C-2..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid attribute values.  (C-4)
+        //
+        // Testing:
+        //   SamplingPolicy();
+        //   SamplingPolicy(int, int, const bsls::TimeInterval&);
+        //   void setSampleInterval(int value);
+        //   void setMaxRecordsPerPeriod(int value);
+        //   void setPeriod(const bsls::TimeInterval& value);
+        //   int sampleInterval() const;
+        //   int maxRecordsPerPeriod() const;
+        //   const bsls::TimeInterval& period() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing Creators and Manipulators" << endl
+                          << "=================================" << endl;
+
+        {
+            const Obj X;
+            ASSERT(1                        == X.sampleInterval());
+            ASSERT(0                        == X.maxRecordsPerPeriod());
+            ASSERT(bsls::TimeInterval(1, 0) == X.period());
+            ASSERT(!X.isActive());
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int                LINE     = DATA[i].d_line;
+            const int                INTERVAL = DATA[i].d_sampleInterval;
+            const int                MAX      = DATA[i].d_maxRecordsPerPeriod;
+            const bsls::TimeInterval PERIOD(DATA[i].d_seconds,
+                                            DATA[i].d_nanoseconds);
+
+            if (!DATA[i].d_isValid) {
+                continue;
+            }
+
+            if (veryVerbose) { P_(LINE) P_(INTERVAL) P_(MAX) P(PERIOD) }
+
+            const Obj X(INTERVAL, MAX, PERIOD);
+            ASSERTV(LINE, INTERVAL == X.sampleInterval());
+            ASSERTV(LINE, MAX      == X.maxRecordsPerPeriod());
+            ASSERTV(LINE, PERIOD   == X.period());
+
+            Obj mY;  const Obj& Y = mY;
+
+            mY.setSampleInterval(INTERVAL);
+            ASSERTV(LINE, INTERVAL                 == Y.sampleInterval());
+            ASSERTV(LINE, 0                        == Y.maxRecordsPerPeriod());
+            ASSERTV(LINE, bsls::TimeInterval(1, 0) == Y.period());
+
+            mY.setMaxRecordsPerPeriod(MAX);
+            ASSERTV(LINE, INTERVAL                 == Y.sampleInterval());
+            ASSERTV(LINE, MAX                      == Y.maxRecordsPerPeriod());
+            ASSERTV(LINE, bsls::TimeInterval(1, 0) == Y.period());
+
+            mY.setPeriod(PERIOD);
+            ASSERTV(LINE, INTERVAL == Y.sampleInterval());
+            ASSERTV(LINE, MAX      == Y.maxRecordsPerPeriod());
+            ASSERTV(LINE, PERIOD   == Y.period());
+
+            const Obj Z(Y);
+            ASSERTV(LINE, X == Z);
+
+            Obj mW;  const Obj& W = mW;
+            mW = X;
+            ASSERTV(LINE, Z == W);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsls::TimeInterval ONE(1, 0);
+            const bsls::TimeInterval ZERO;
+
+            ASSERT_PASS(Obj(1, 0, ONE));
+            ASSERT_FAIL(Obj(0, 0, ONE));
+            ASSERT_FAIL(Obj(1, -1, ONE));
+            ASSERT_FAIL(Obj(1, 0, ZERO));
+
+            Obj mX;
+
+            ASSERT_PASS(mX.setSampleInterval(1));
+            ASSERT_FAIL(mX.setSampleInterval(0));
+
+            ASSERT_PASS(mX.setMaxRecordsPerPeriod(0));
+            ASSERT_FAIL(mX.setMaxRecordsPerPeriod(-1));
+
+            ASSERT_PASS(mX.setPeriod(ONE));
+            ASSERT_FAIL(mX.setPeriod(ZERO));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create, modify, copy, and compare objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X.isActive());
+
+        const Obj Y(5, 10, bsls::TimeInterval(0.5));
+        ASSERT( Y.isActive());
+        ASSERT(X != Y);
+
+        mX.setSampleInterval(5);
+        mX.setMaxRecordsPerPeriod(10);
+        mX.setPeriod(bsls::TimeInterval(0.5));
+        ASSERT(X == Y);
+
+        if (veryVerbose) { P(X) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,10 +14,13 @@ namespace balm {
                          // ------------------------
 
 // PRIVATE CLASS METHODS
-void BdlmMetricsAdapter::metricCb(bsl::vector<MetricRecord> *records,
-                                  bool                       resetFlag,
-                                  MetricId                   id,
-                                  const Callback&            callback)
+void BdlmMetricsAdapter::metricCb(
+                                  bsl::vector<MetricRecord>    *records,
+                                  bool                          resetFlag,
+                                  MetricId                      id,
+                                  const bsl::vector<double>&    quantiles,
+                                  const bsl::vector<MetricId>&  quantileIds,
+                                  const Callback&               callback)
 {
     (void)resetFlag;
 
@@ -32,6 +35,13 @@ void BdlmMetricsAdapter::metricCb(bsl::vector<MetricRecord> *records,
 
         records->push_back(record);
     }
+    else if (value.isHistogram()) {
+        HistogramMetric::appendRecords(records,
+                                       id,
+                                       value.theHistogram(),
+                                       quantiles,
+                                       quantileIds);
+    }
 }
 
 // CREATORS
@@ -68,12 +78,31 @@ BdlmMetricsAdapter::registerCollectionCallback(
     MetricId id = d_metricsManager_p->metricRegistry().getId(
                                    md.metricNamespace().c_str(), name.c_str());
 
+    // The metrics holding the quantiles of a histogram value are registered
+    // up front, as the registry must not be modified during collection.
+
+    bsl::vector<double> quantiles(allocator());
+    HistogramMetric::defaultQuantiles(&quantiles);
+
+    bsl::vector<MetricId> quantileIds(allocator());
+    bsl::string           quantileName(allocator());
+    for (bsl::size_t i = 0; i < quantiles.size(); ++i) {
+        HistogramMetric::quantileName(&quantileName, name, quantiles[i]);
+        quantileIds.push_back(d_metricsManager_p->metricRegistry().getId(
+                                                  md.metricNamespace().c_str(),
+                                                  quantileName.c_str()));
+    }
+
     return d_metricsManager_p->registerCollectionCallback(
                                    md.metricNamespace().c_str(),
-                                   bdlf::BindUtil::bind(&metricCb,
+                                   bdlf::BindUtil::bindS(
+                                                        allocator(),
+                                                        &metricCb,
                                                         bdlf::PlaceHolders::_1,
                                                         bdlf::PlaceHolders::_2,
                                                         id,
+                                                        quantiles,
+                                                        quantileIds,
                                                         callback));
 }
 
@@ -17,6 +17,16 @@ BSLS_IDENT("$Id: $")
 // `balm::MetricsManager`.  `balm::BdlmMetricsAdapter` also provides methods to
 // aid in population of default `bdlm::MetricDescriptor` attribute values.
 //
+// A gauge metric value (see `bdlm_metric`) is published as a record having a
+// count of 1 and a total equal to the gauge.  A histogram metric value is
+// published as a record having the count, sum, minimum, and maximum of the
+// histogram, and, if the histogram is not empty, a record for each of the
+// default quantiles of `balm::HistogramMetric` (e.g., the 99th percentile),
+// named by appending `.p` and the digits of the quantile to the name of the
+// metric (e.g., `.p99`; see `balm_histogrammetric`).  Note that a callback
+// supplying a histogram is responsible for resetting it, if appropriate,
+// between collections.
+//
 ///Thread Safety
 ///-------------
 // This class is *thread-aware* (see {`bsldoc_glossary`|Thread-Aware}).
@@ -81,6 +91,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogrammetric.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 #include <balm_metricsmanager.h>
@@ -113,11 +124,15 @@ class BdlmMetricsAdapter : public bdlm::MetricsAdapter {
     /// Load into the specified `records` a new record with the specified
     /// `id` and statistics obtained from the specified `callback` and, if
     /// the specified `resetFlag` is `true`, reset the statistics to their
-    /// default state.
-    static void metricCb(bsl::vector<MetricRecord> *records,
-                         bool                       resetFlag,
-                         MetricId                   id,
-                         const Callback&            callback);
+    /// default state.  If the statistics are a histogram, also load a
+    /// record for each of the specified `quantiles`, identified by the
+    /// corresponding element of the specified `quantileIds`.
+    static void metricCb(bsl::vector<MetricRecord>    *records,
+                         bool                          resetFlag,
+                         MetricId                      id,
+                         const bsl::vector<double>&    quantiles,
+                         const bsl::vector<MetricId>&  quantileIds,
+                         const Callback&               callback);
 
     // DATA
     MetricsManager    *d_metricsManager_p;        // held, but not owned,
@@ -174,8 +189,10 @@ class BdlmMetricsAdapter : public bdlm::MetricsAdapter {
     /// attribute during registration.  The category name supplied to the
     /// `MetricsManager` provided at construction is the concatenation of
     /// the object type name attribute, a period, the metric name attribute,
-    /// a period, and the object identifier attribute.  Return the callback
-    /// handle to be used with `removeCollectionCallback`.
+    /// a period, and the object identifier attribute.  The metrics holding
+    /// the quantiles of a histogram value are also registered (see
+    /// {Description}).  Return the callback handle to be used with
+    /// `removeCollectionCallback`.
     CallbackHandle registerCollectionCallback(
                  const bdlm::MetricDescriptor& metricDescriptor,
                  const Callback&               callback) BSLS_KEYWORD_OVERRIDE;
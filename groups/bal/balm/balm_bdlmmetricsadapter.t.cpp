@@ -2,7 +2,9 @@
 #include <balm_bdlmmetricsadapter.h>
 
 #include <balm_metricsmanager.h>
+#include <balm_streampublisher.h>
 
+#include <bdlm_histogram.h>
 #include <bdlm_metricdescriptor.h>
 
 #include <bsla_maybeunused.h>
@@ -20,6 +22,7 @@
 #include <bsl_cstddef.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 
@@ -47,7 +50,8 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: In no case does memory come from the default allocator.
-// [ 3] USAGE EXAMPLE
+// [ 3] CONCERN: Histogram values publish their quantiles.
+// [ 4] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -118,6 +122,17 @@ void testMetric(BloombergLP::bdlm::Metric *value)
     ++s_testMetricCount;
 }
 
+/// Load into the specified `value` a histogram of the integers in the range
+/// `[1 .. 100]`.
+void testHistogramMetric(BloombergLP::bdlm::Metric *value)
+{
+    BloombergLP::bdlm::Histogram histogram;
+    for (int i = 1; i <= 100; ++i) {
+        histogram.add(i);
+    }
+    *value = histogram;
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -175,7 +190,7 @@ int main(int argc, char *argv[])
     bool expectDefaultAllocation = false;
 
     switch (test) { case 0:
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -235,6 +250,59 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HISTOGRAM VALUES
+        //   Ensure a callback supplying a histogram publishes its quantiles.
+        //
+        // Concerns:
+        // 1. A histogram value is published as a record for the metric and a
+        //    record for each of the default quantiles.
+        //
+        // Plan:
+        // 1. Register a callback supplying a histogram, publish using a
+        //    `balm::StreamPublisher`, and verify the published text.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Histogram values publish their quantiles.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "HISTOGRAM VALUES" << endl
+                                  << "================" << endl;
+
+        expectDefaultAllocation = true;
+
+        bsl::ostringstream stream;
+
+        balm::MetricsManager manager;
+
+        bsl::shared_ptr<balm::Publisher> publisher(
+                                        new balm::StreamPublisher(stream));
+        manager.addGeneralPublisher(publisher);
+
+        Obj mX(&manager, "namespace", "prefix");
+
+        bdlm::MetricDescriptor descriptor("ns", "n", 1, "otn", "oa", "oid");
+
+        bdlm::MetricsAdapter::CallbackHandle handle =
+                            mX.registerCollectionCallback(descriptor,
+                                                          testHistogramMetric);
+
+        manager.publishAll();
+
+        const bsl::string output = stream.str();
+        if (veryVerbose) {
+            P(output);
+        }
+
+        ASSERT(bsl::string::npos != output.find("count = 100,"));
+        ASSERT(bsl::string::npos != output.find(".p50["));
+        ASSERT(bsl::string::npos != output.find(".p90["));
+        ASSERT(bsl::string::npos != output.find(".p99["));
+        ASSERT(bsl::string::npos != output.find(".p999["));
+
+        ASSERT(0 == mX.removeCollectionCallback(handle));
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // CALLBACK REGISTRATON
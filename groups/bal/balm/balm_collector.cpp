@@ -4,12 +4,139 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_new.h>
+
 namespace BloombergLP {
+namespace balm {
+
+                          // ------------------------
+                          // struct Collector::Stripe
+                          // ------------------------
+
+// MANIPULATORS
+void Collector::Stripe::drain(MetricRecord *record)
+{
+    typedef CollectorUtil Util;
+
+    const double total = Util::fromBits(d_total.swap(Util::toBits(0.0)));
+    const double min   = Util::fromBits(
+                        d_min.swap(Util::toBits(MetricRecord::k_DEFAULT_MIN)));
+    const double max   = Util::fromBits(
+                        d_max.swap(Util::toBits(MetricRecord::k_DEFAULT_MAX)));
+
+    record->count() += d_count.swap(0);
+    record->total() += total;
+    record->min()   =  bsl::min(record->min(), min);
+    record->max()   =  bsl::max(record->max(), max);
+}
+
+void Collector::Stripe::set(int count, double total, double min, double max)
+{
+    d_count = count;
+    d_total = CollectorUtil::toBits(total);
+    d_min   = CollectorUtil::toBits(min);
+    d_max   = CollectorUtil::toBits(max);
+}
+
+// ACCESSORS
+void Collector::Stripe::combine(MetricRecord *record) const
+{
+    typedef CollectorUtil Util;
+
+    record->count() += d_count;
+    record->total() += Util::fromBits(d_total);
+    record->min()   =  bsl::min(record->min(), Util::fromBits(d_min));
+    record->max()   =  bsl::max(record->max(), Util::fromBits(d_max));
+}
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE ACCESSORS
+void Collector::initRecord(MetricRecord *record) const
+{
+    // Note that a stripe having default aggregates does not alter the
+    // combined aggregates.
+
+    record->metricId() = d_metricId;
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+}
+
+// CREATORS
+Collector::Collector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    BSLMF_ASSERT(sizeof(Stripe) == bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                         d_stripeBuffer,
+                                         bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    d_stripes_p = reinterpret_cast<Stripe *>(d_stripeBuffer + offset);
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        new (d_stripes_p + i) Stripe();
+    }
+}
+
+Collector::~Collector()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].~Stripe();
+    }
+}
+
+// MANIPULATORS
+void Collector::reset()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].set(0,
+                           0.0,
+                           MetricRecord::k_DEFAULT_MIN,
+                           MetricRecord::k_DEFAULT_MAX);
+    }
+}
+
+void Collector::loadAndReset(MetricRecord *record)
+{
+    initRecord(record);
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].drain(record);
+    }
+}
+
+void Collector::setCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max)
+{
+    for (int i = 1; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].set(0,
+                           0.0,
+                           MetricRecord::k_DEFAULT_MIN,
+                           MetricRecord::k_DEFAULT_MAX);
+    }
+    d_stripes_p[0].set(count, total, min, max);
+}
+
+// ACCESSORS
+void Collector::load(MetricRecord *record) const
+{
+    initRecord(record);
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].combine(record);
+    }
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -22,9 +22,9 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // value, a `load` operator to populate a `balm::MetricRecord` with the current
 // state of the collector, a `reset` method to reset the current state of the
 // collector, and finally a combined `loadAndReset` method that performs both
-// a load and a reset as an atomic operation.  Note that in practice, most
-// clients should not need to access a `balm::Collector` directly, but instead
-// use it through another type (see `balm_metric`).
+// a load and a reset (see {Performance} for its atomicity).  Note that in
+// practice, most clients should not need to access a `balm::Collector`
+// directly, but instead use it through another type (see `balm_metric`).
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -37,6 +37,35 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Performance
+///-----------
+// A `balm::Collector` is typically updated by many threads concurrently (for
+// example, through the `BALM_METRIC_*` macros), and loaded only once per
+// publication interval.  To prevent updates from contending for a single cache
+// line, the aggregates are kept in `k_NUM_STRIPES` stripes, each occupying its
+// own cache line, and `update` and `accumulateCountTotalMinMax` modify only
+// the stripe selected by the identifier of the calling thread (see
+// `bdlmt_stripeutil`).  These updates are lock-free: the count is incremented
+// atomically, and the total, minimum, and maximum (held as the bit patterns of
+// their `double` values) are updated using compare-and-swap loops (see
+// `balm_collectorutil`).  The operations that read or reset the collector
+// (`load`, `loadAndReset`, `reset`, and `setCountTotalMinMax`) visit every
+// stripe.
+//
+// The stripes start on a cache-line boundary wherever the collector itself is
+// allocated, so each collector reserves `k_NUM_STRIPES + 1` cache lines for
+// them, i.e., `sizeof(balm::Collector)` is a little over 1 KB on platforms
+// having 64-byte cache lines (and over 2 KB on those having 128-byte lines).
+//
+// Note that, because no lock is held, `load` and `loadAndReset` are not atomic
+// with respect to concurrent updates: each aggregate of each stripe is read
+// (and, by `loadAndReset`, reset) atomically, so every update is reported
+// exactly once, but the count of an update performed concurrently with
+// `loadAndReset` may be reported in one record and its value in the next.
+// Also note that the `total` loaded from a collector updated by several
+// threads is the sum of per-stripe subtotals, and may differ from a
+// sequential sum of the same values in the least significant bits.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -78,13 +107,16 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 
 #include <balscm_version.h>
 
+#include <balm_collectorutil.h>
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bdlmt_stripeutil.h>
 
-#include <bsl_algorithm.h>
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -97,24 +129,99 @@ namespace balm {
 
 /// This class provides a mechanism for collecting and aggregating the
 /// value of a metric over a period of time.  The collector contains a
-/// `MetricRecord` object that holds the identity of the metric being
-/// collected, the number of times an event occurred, and the total,
-/// minimum, and maximum aggregates of the associated measurement value.
-/// The default value for the count is 0, the default value for the total
-/// is 0.0, the default minimum value is `MetricRecord::k_DEFAULT_MIN`, and
-/// the default maximum value is `MetricRecord::k_DEFAULT_MAX`.
+/// `MetricId` object that identifies the metric being collected, and
+/// aggregates the number of times an event occurred, and the total,
+/// minimum, and maximum of the associated measurement value.  The default
+/// value for the count is 0, the default value for the total is 0.0, the
+/// default minimum value is `MetricRecord::k_DEFAULT_MIN`, and the default
+/// maximum value is `MetricRecord::k_DEFAULT_MAX`.  The aggregates are
+/// distributed over `k_NUM_STRIPES` stripes (see {Performance}).
 class Collector {
 
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_NUM_STRIPES = 16  // number of (cache-line sized) stripes over which
+                            // the aggregates are distributed
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// The aggregates updated by the threads whose identifiers map to the
+    /// same stripe.  The `double` aggregates are held as the bit patterns
+    /// of their values so that they can be modified atomically.
+    struct Stripe {
+
+        // DATA
+        bsls::AtomicInt64 d_total;  // total of values across events
+        bsls::AtomicInt64 d_min;    // minimum value across events
+        bsls::AtomicInt64 d_max;    // maximum value across events
+        bsls::AtomicInt   d_count;  // aggregated count of events
+
+        char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                - 3 * sizeof(bsls::AtomicInt64)
+                                - sizeof(bsls::AtomicInt)];
+                                    // padding to a full cache line
+
+        // CREATORS
+
+        /// Create a stripe having default aggregates.
+        Stripe();
+
+        // MANIPULATORS
+
+        /// Atomically increment the count of this stripe by the specified
+        /// `count` and its total by the specified `total`, and lower its
+        /// minimum to the specified `min`, and raise its maximum to the
+        /// specified `max`, as needed.  Note that each aggregate is
+        /// modified atomically, but not the aggregates as a whole.
+        void accumulate(int count, double total, double min, double max);
+
+        /// Atomically reset each aggregate of this stripe to its default
+        /// value, and add the values it held to the specified `record`.
+        void drain(MetricRecord *record);
+
+        /// Set the aggregates of this stripe to the specified `count`,
+        /// `total`, `min`, and `max`.
+        void set(int count, double total, double min, double max);
+
+        // ACCESSORS
+
+        /// Add the aggregates of this stripe to the specified `record`.
+        void combine(MetricRecord *record) const;
+    };
+
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId  d_metricId;  // metric identifier
+
+    char      d_stripeBuffer[(k_NUM_STRIPES + 1)
+                                        * bslmt::Platform::e_CACHE_LINE_SIZE];
+                           // storage for the stripes, having a spare cache
+                           // line so that they can start on a cache-line
+                           // boundary wherever the collector is allocated
+
+    Stripe   *d_stripes_p; // `k_NUM_STRIPES` stripes, aligned on a
+                           // cache-line boundary within `d_stripeBuffer`
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Return a reference providing modifiable access to the stripe
+    /// assigned to the calling thread.
+    Stripe& currentStripe();
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `record` the id of the metric being
+    /// collected, and the default count, total, minimum, and maximum.
+    void initRecord(MetricRecord *record) const;
+
   public:
-     // CREATORS
+    // CREATORS
 
     /// Create a collector for a metric having the specified `metricId`,
     /// and having an initial count of 0, total of 0.0, min of
@@ -140,9 +247,11 @@ class Collector {
     /// minimum, and maximum values to their default states.  After this
     /// operation, the count and total values will be 0, the minimum value
     /// will be `MetricRecord::k_DEFAULT_MIN`, and the maximum value will be
-    /// `MetricRecord::k_DEFAULT_MAX`.  Note that this operation is
-    /// logically equivalent to calling the `load` and then the `reset`
-    /// methods except that it is performed as a single atomic operation.
+    /// `MetricRecord::k_DEFAULT_MAX`.  Note that each aggregated value is
+    /// loaded and reset as a single atomic operation, so that every update
+    /// is reported exactly once, but that the effect of an update performed
+    /// concurrently with this operation may be split between `record` and
+    /// the next record loaded (see {Performance}).
     void loadAndReset(MetricRecord *record);
 
     /// Increment the event count by 1, add the specified `value` to the
@@ -182,53 +291,49 @@ class Collector {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
-                              // ---------------
-                              // class Collector
-                              // ---------------
+                          // ------------------------
+                          // struct Collector::Stripe
+                          // ------------------------
 
 // CREATORS
 inline
-Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
-{
-}
-
-inline
-Collector::~Collector()
+Collector::Stripe::Stripe()
+: d_total(CollectorUtil::toBits(0.0))
+, d_min(CollectorUtil::toBits(MetricRecord::k_DEFAULT_MIN))
+, d_max(CollectorUtil::toBits(MetricRecord::k_DEFAULT_MAX))
+, d_count(0)
 {
 }
 
 // MANIPULATORS
 inline
-void Collector::reset()
+void Collector::Stripe::accumulate(int    count,
+                                   double total,
+                                   double min,
+                                   double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    d_count.addRelaxed(count);
+    CollectorUtil::addDouble(&d_total, total);
+    CollectorUtil::minDouble(&d_min, min);
+    CollectorUtil::maxDouble(&d_max, max);
 }
 
+                              // ---------------
+                              // class Collector
+                              // ---------------
+
+// PRIVATE MANIPULATORS
 inline
-void Collector::loadAndReset(MetricRecord *record)
+Collector::Stripe& Collector::currentStripe()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    return d_stripes_p[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
 }
 
+// MANIPULATORS
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    currentStripe().accumulate(1, value, value, value);
 }
 
 inline
@@ -237,39 +342,16 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
-}
-
-inline
-void Collector::setCountTotalMinMax(int    count,
-                                    double total,
-                                    double min,
-                                    double max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    currentStripe().accumulate(count, total, min, max);
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
-inline
-void Collector::load(MetricRecord *record) const
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
-}
 }  // close package namespace
 
 }  // close enterprise namespace
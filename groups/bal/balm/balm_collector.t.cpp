@@ -13,6 +13,7 @@
 
 #include <bslmt_barrier.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstring.h>
@@ -60,7 +61,9 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] CONCURRENT UPDATES
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: update
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -212,6 +215,20 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+/// Wait on the specified `barrier`, then update the specified `collector`
+/// with each of the values in the range `[offset, offset + numUpdates)`,
+/// for the specified `offset` and `numUpdates`.
+void updateCollector(Obj            *collector,
+                     int             offset,
+                     int             numUpdates,
+                     bslmt::Barrier *barrier)
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(offset + i);
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -241,7 +258,7 @@ int main(int argc, char *argv[])
     Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -295,6 +312,68 @@ int main(int argc, char *argv[])
         ASSERT(3.0      == record.max());
 // ```
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        // 1. The values supplied to `update` by several threads, whose
+        //    updates are applied to different stripes, are all reflected in
+        //    the loaded aggregates.
+        //
+        // 2. `loadAndReset` resets every stripe.
+        //
+        // Plan:
+        // 1. Update a collector concurrently from several threads, each
+        //    supplying a distinct range of values, then verify the count,
+        //    total, minimum, and maximum loaded from the collector.  (C-1)
+        //
+        // 2. Call `loadAndReset`, and verify that a subsequent `load` yields
+        //    default aggregates.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT UPDATES" << endl
+                                  << "==================" << endl;
+
+        enum { k_NUM_THREADS = 12, k_NUM_UPDATES = 1000 };
+
+        bslma::TestAllocator ta;
+        Obj                  mX(METRIC_A);  const Obj& X = mX;
+
+        {
+            bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS, &ta);
+            bslmt::Barrier         barrier(k_NUM_THREADS);
+
+            pool.start();
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     i * k_NUM_UPDATES,
+                                                     k_NUM_UPDATES,
+                                                     &barrier));
+            }
+            pool.drain();
+        }
+
+        const int NUM_VALUES = k_NUM_THREADS * k_NUM_UPDATES;
+
+        Rec record;
+        X.load(&record);
+        ASSERTV(record.count(), NUM_VALUES == record.count());
+        ASSERTV(record.total(),
+                (NUM_VALUES - 1.0) * NUM_VALUES / 2 == record.total());
+        ASSERTV(record.min(), 0 == record.min());
+        ASSERTV(record.max(), NUM_VALUES - 1 == record.max());
+
+        mX.loadAndReset(&record);
+        ASSERTV(record.count(), NUM_VALUES == record.count());
+
+        X.load(&record);
+        ASSERT(Rec(METRIC_A) == record);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -775,6 +854,52 @@ int main(int argc, char *argv[])
         ASSERT(Rec::k_DEFAULT_MAX == r1.max());
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: update
+        //
+        // Concerns:
+        // 1. Concurrent calls to `update` scale with the number of threads.
+        //
+        // Plan:
+        // 1. For an increasing number of threads, update a single collector
+        //    concurrently from every thread, and report the average time per
+        //    call.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: update
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE: update" << endl
+                                  << "===================" << endl;
+
+        enum { k_NUM_UPDATES = 1000000 };
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            Obj mX(METRIC_A);
+
+            bdlmt::FixedThreadPool pool(numThreads, numThreads);
+            bslmt::Barrier         barrier(numThreads + 1);
+
+            pool.start();
+            for (int i = 0; i < numThreads; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     i,
+                                                     k_NUM_UPDATES,
+                                                     &barrier));
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            barrier.wait();
+            pool.drain();
+            timer.stop();
+
+            cout << "threads: " << numThreads << "\tns per update: "
+                 << timer.elapsedTime() * 1e9 / k_NUM_UPDATES << endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
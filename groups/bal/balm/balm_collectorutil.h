@@ -0,0 +1,185 @@
+// balm_collectorutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BALM_COLLECTORUTIL
+#define INCLUDED_BALM_COLLECTORUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lock-free operations on `double` aggregates for collectors.
+//
+//@CLASSES:
+//    balm::CollectorUtil: namespace for atomic `double` aggregate operations
+//
+//@SEE_ALSO: balm_collector, balm_histogramcollector, bdlmt_stripeutil
+//
+//@DESCRIPTION: This component provides a `struct`, `balm::CollectorUtil`,
+// that serves as a namespace for the functions used by the lock-free
+// collectors of the `balm` package (`balm::Collector` and
+// `balm::HistogramCollector`) to maintain the sum, minimum, and maximum of
+// `double` values in `bsls::AtomicInt64` objects.  A `double` is stored as its
+// bit pattern (see `toBits` and `fromBits`), and `addDouble`, `minDouble`, and
+// `maxDouble` update such a representation with a compare-and-swap loop.
+//
+// The collectors keep these aggregates in several cache-line sized stripes,
+// and select the stripe updated by the calling thread with
+// `bdlmt::StripeUtil::selfStripeIndex`.
+//
+///Thread Safety
+///-------------
+// The functions of `balm::CollectorUtil` may be invoked concurrently from
+// multiple threads, including on the same `bsls::AtomicInt64` object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracking the Maximum of a Value
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose several threads report latencies, and we want to track the largest
+// one reported without a lock.  We keep the maximum as the bits of a `double`
+// in an atomic integer, initialized to negative infinity:
+// ```
+// bsls::AtomicInt64 maximum(balm::CollectorUtil::toBits(
+//                                  -bsl::numeric_limits<double>::infinity()));
+// ```
+// Then, each thread reports its latencies by calling `maxDouble`:
+// ```
+// balm::CollectorUtil::maxDouble(&maximum, 2.5);
+// balm::CollectorUtil::maxDouble(&maximum, 7.0);
+// balm::CollectorUtil::maxDouble(&maximum, 3.5);
+// ```
+// Finally, we read the largest latency reported:
+// ```
+// assert(7.0 == balm::CollectorUtil::fromBits(maximum.loadAcquire()));
+// ```
+
+#include <balscm_version.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                            // ====================
+                            // struct CollectorUtil
+                            // ====================
+
+/// This `struct` provides a namespace for lock-free operations on `double`
+/// values represented by the bits held in `bsls::AtomicInt64` objects.
+struct CollectorUtil {
+
+    // CLASS METHODS
+
+    /// Return the `double` having the specified `bits`.
+    static double fromBits(bsls::Types::Int64 bits);
+
+    /// Return the bits of the specified `value`.
+    static bsls::Types::Int64 toBits(double value);
+
+    /// Add the specified `value` to the `double` represented by the
+    /// specified `target`.
+    static void addDouble(bsls::AtomicInt64 *target, double value);
+
+    /// Set the `double` represented by the specified `target` to the
+    /// specified `value` if `value` is less than it.
+    static void minDouble(bsls::AtomicInt64 *target, double value);
+
+    /// Set the `double` represented by the specified `target` to the
+    /// specified `value` if `value` is greater than it.
+    static void maxDouble(bsls::AtomicInt64 *target, double value);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // struct CollectorUtil
+                            // --------------------
+
+// CLASS METHODS
+inline
+double CollectorUtil::fromBits(bsls::Types::Int64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+inline
+bsls::Types::Int64 CollectorUtil::toBits(double value)
+{
+    bsls::Types::Int64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+void CollectorUtil::addDouble(bsls::AtomicInt64 *target, double value)
+{
+    bsls::Types::Int64 current = target->loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 previous = target->testAndSwapAcqRel(
+                                           current,
+                                           toBits(fromBits(current) + value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+inline
+void CollectorUtil::minDouble(bsls::AtomicInt64 *target, double value)
+{
+    // The minimum is rarely modified once a few values have been collected,
+    // in which case it is only read.
+
+    bsls::Types::Int64 current = target->loadRelaxed();
+    while (value < fromBits(current)) {
+        const bsls::Types::Int64 previous =
+                             target->testAndSwapAcqRel(current, toBits(value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+inline
+void CollectorUtil::maxDouble(bsls::AtomicInt64 *target, double value)
+{
+    bsls::Types::Int64 current = target->loadRelaxed();
+    while (value > fromBits(current)) {
+        const bsls::Types::Int64 previous =
+                             target->testAndSwapAcqRel(current, toBits(value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,368 @@
+// balm_collectorutil.t.cpp                                           -*-C++-*-
+#include <balm_collectorutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// This component is a utility providing stateless functions that operate on
+// `double` values represented by the bits held in `bsls::AtomicInt64`
+// objects.  The concerns are that the conversions between a `double` and its
+// bits are exact inverses, that each of `addDouble`, `minDouble`, and
+// `maxDouble` has the documented effect, and that none of the latter loses an
+// update made concurrently by another thread.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] double fromBits(bsls::Types::Int64 bits);
+// [ 1] bsls::Types::Int64 toBits(double value);
+// [ 2] void addDouble(bsls::AtomicInt64 *target, double value);
+// [ 2] void minDouble(bsls::AtomicInt64 *target, double value);
+// [ 2] void maxDouble(bsls::AtomicInt64 *target, double value);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT UPDATES
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef balm::CollectorUtil Util;
+
+namespace {
+bool     verbose = false;
+bool veryVerbose = false;
+}  // close unnamed namespace
+
+//=============================================================================
+//                           CASE 3 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+namespace balm_collectorutil_test_case_3 {
+
+enum {
+    k_NUM_THREADS = 8,
+    k_NUM_UPDATES = 10000
+};
+
+bsls::AtomicInt64 g_sum;
+bsls::AtomicInt64 g_min;
+bsls::AtomicInt64 g_max;
+
+/// Add to `g_sum` the values 1 to `k_NUM_UPDATES`, and apply each value,
+/// offset by `k_NUM_UPDATES` times the specified `threadIndex`, to `g_min`
+/// and `g_max`.
+extern "C" void *update(void *threadIndex)
+{
+    const int offset = static_cast<int>(
+                                   reinterpret_cast<bsls::Types::IntPtr>(
+                                                threadIndex)) * k_NUM_UPDATES;
+
+    for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+        Util::addDouble(&g_sum, i);
+        Util::minDouble(&g_min, offset + i);
+        Util::maxDouble(&g_max, offset + i);
+    }
+    return 0;
+}
+
+}  // close namespace balm_collectorutil_test_case_3
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int    test = argc > 1 ? atoi(argv[1]) : 0;
+        verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << '\n';
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   This will test the usage example provided in the component header
+        //   file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file must
+        //    compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        // 1. Copy the usage example from the component header, change `assert`
+        //    to `ASSERT`, and run it.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING USAGE EXAMPLE" "\n"
+                          << "=====================" "\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracking the Maximum of a Value
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose several threads report latencies, and we want to track the largest
+// one reported without a lock.  We keep the maximum as the bits of a `double`
+// in an atomic integer, initialized to negative infinity:
+// ```
+        bsls::AtomicInt64 maximum(balm::CollectorUtil::toBits(
+                                   -bsl::numeric_limits<double>::infinity()));
+// ```
+// Then, each thread reports its latencies by calling `maxDouble`:
+// ```
+        balm::CollectorUtil::maxDouble(&maximum, 2.5);
+        balm::CollectorUtil::maxDouble(&maximum, 7.0);
+        balm::CollectorUtil::maxDouble(&maximum, 3.5);
+// ```
+// Finally, we read the largest latency reported:
+// ```
+        ASSERT(7.0 == balm::CollectorUtil::fromBits(maximum.loadAcquire()));
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        // 1. No update made by `addDouble`, `minDouble`, or `maxDouble` is
+        //    lost when several threads update the same object concurrently.
+        //
+        // Plan:
+        // 1. In several threads, add the integers 1 to N to a shared sum
+        //    (each partial sum being exactly representable), and apply a
+        //    distinct range of integers per thread to a shared minimum and
+        //    maximum.  Verify the exact final sum, minimum, and maximum.
+        //    (C-1)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENT UPDATES" "\n"
+                          << "==================" "\n";
+
+        using namespace balm_collectorutil_test_case_3;
+
+        g_sum = Util::toBits(0.0);
+        g_min = Util::toBits(bsl::numeric_limits<double>::infinity());
+        g_max = Util::toBits(-bsl::numeric_limits<double>::infinity());
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handles[i],
+                                  update,
+                                  reinterpret_cast<void *>(
+                                      static_cast<bsls::Types::IntPtr>(i))));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        const double EXP_SUM = static_cast<double>(k_NUM_THREADS)
+                             * k_NUM_UPDATES * (k_NUM_UPDATES + 1) / 2;
+        const double EXP_MIN = 1;
+        const double EXP_MAX = static_cast<double>(k_NUM_THREADS)
+                             * k_NUM_UPDATES;
+
+        ASSERTV(Util::fromBits(g_sum), EXP_SUM == Util::fromBits(g_sum));
+        ASSERTV(Util::fromBits(g_min), EXP_MIN == Util::fromBits(g_min));
+        ASSERTV(Util::fromBits(g_max), EXP_MAX == Util::fromBits(g_max));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `addDouble`, `minDouble`, AND `maxDouble`
+        //
+        // Concerns:
+        // 1. `addDouble` adds its argument to the represented value.
+        //
+        // 2. `minDouble` (resp. `maxDouble`) replaces the represented value
+        //    by its argument if, and only if, the argument is smaller (resp.
+        //    larger).
+        //
+        // 3. Infinite initial values are replaced by the first finite value.
+        //
+        // Plan:
+        // 1. Apply a sequence of values, including negative values and zero,
+        //    to objects initialized to 0.0 and to infinities, and verify the
+        //    represented value after each operation.  (C-1..3)
+        //
+        // Testing:
+        //   void addDouble(bsls::AtomicInt64 *target, double value);
+        //   void minDouble(bsls::AtomicInt64 *target, double value);
+        //   void maxDouble(bsls::AtomicInt64 *target, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `addDouble`, `minDouble`, AND "
+                             "`maxDouble`\n"
+                          << "======================================"
+                             "===========\n";
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+
+        static const struct {
+            int    d_line;
+            double d_value;
+            double d_expSum;
+            double d_expMin;
+            double d_expMax;
+        } DATA[] = {
+            //LINE  VALUE   SUM     MIN     MAX
+            //----  -----   -----   -----   -----
+            { L_,    2.5,    2.5,    2.5,    2.5 },
+            { L_,   -1.0,    1.5,   -1.0,    2.5 },
+            { L_,    0.0,    1.5,   -1.0,    2.5 },
+            { L_,    4.0,    5.5,   -1.0,    4.0 },
+            { L_,   -3.5,    2.0,   -3.5,    4.0 },
+            { L_,    4.0,    6.0,   -3.5,    4.0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bsls::AtomicInt64 sum(Util::toBits(0.0));
+        bsls::AtomicInt64 min(Util::toBits(INF));
+        bsls::AtomicInt64 max(Util::toBits(-INF));
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE  = DATA[ti].d_line;
+            const double VALUE = DATA[ti].d_value;
+
+            if (veryVerbose) { T_ P_(LINE) P(VALUE) }
+
+            Util::addDouble(&sum, VALUE);
+            Util::minDouble(&min, VALUE);
+            Util::maxDouble(&max, VALUE);
+
+            ASSERTV(LINE, DATA[ti].d_expSum == Util::fromBits(sum));
+            ASSERTV(LINE, DATA[ti].d_expMin == Util::fromBits(min));
+            ASSERTV(LINE, DATA[ti].d_expMax == Util::fromBits(max));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. `fromBits` is the inverse of `toBits`, including for zeros of
+        //    either sign and infinities.
+        //
+        // 2. The bits of 0.0 are all zero.
+        //
+        // Plan:
+        // 1. Convert a set of values to bits and back, and verify that the
+        //    result is bitwise identical to the original value.  (C-1..2)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   double fromBits(bsls::Types::Int64 bits);
+        //   bsls::Types::Int64 toBits(double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST" "\n"
+                          << "==============" "\n";
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+
+        const double VALUES[] = { 0.0, -0.0, 1.0, -1.5, 1e300, -1e-300,
+                                  INF, -INF,
+                                  bsl::numeric_limits<double>::min(),
+                                  bsl::numeric_limits<double>::max() };
+        const int NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                / sizeof *VALUES);
+
+        ASSERT(0 == Util::toBits(0.0));
+        ASSERT(0 != Util::toBits(-0.0));
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double             VALUE = VALUES[i];
+            const bsls::Types::Int64 BITS  = Util::toBits(VALUE);
+
+            if (veryVerbose) { T_ P_(VALUE) P(BITS) }
+
+            ASSERTV(VALUE, BITS == Util::toBits(Util::fromBits(BITS)));
+            ASSERTV(VALUE, VALUE == Util::fromBits(BITS));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." "\n";
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,232 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <balm_collectorutil.h>
+
+#include <bdlmt_stripeutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace balm {
+namespace {
+
+typedef bsls::AtomicOperations                     AtomicOps;
+typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicInt64;
+
+/// Return the signed index, for the specified `logGamma`, of the bucket
+/// holding the specified positive `value`.  Note that this computation must
+/// match the one performed by `bdlm::Histogram`.
+inline
+double signedIndex(double value, double logGamma)
+{
+    return bsl::ceil(bsl::log(value) / logGamma);
+}
+
+/// Return the value of the specified `target` and, if the specified
+/// `resetFlag` is `true`, set `target` to the specified `resetValue`.
+inline
+bsls::Types::Int64 loadInt64(AtomicInt64        *target,
+                             bool                resetFlag,
+                             bsls::Types::Int64  resetValue)
+{
+    return resetFlag ? AtomicOps::swapInt64AcqRel(target, resetValue)
+                     : AtomicOps::getInt64Acquire(target);
+}
+
+/// Return the value of the specified `target` and, if the specified
+/// `resetFlag` is `true`, set `target` to the specified `resetValue`.
+inline
+bsls::Types::Int64 loadInt64(bsls::AtomicInt64  *target,
+                             bool                resetFlag,
+                             bsls::Types::Int64  resetValue)
+{
+    return resetFlag ? target->swapAcqRel(resetValue)
+                     : target->loadAcquire();
+}
+
+}  // close unnamed namespace
+
+                      // --------------------------------
+                      // struct HistogramCollector::Stripe
+                      // --------------------------------
+
+// MANIPULATORS
+void HistogramCollector::Stripe::reset()
+{
+    typedef CollectorUtil Util;
+
+    d_sum.storeRelease(Util::toBits(0.0));
+    d_min.storeRelease(Util::toBits(bsl::numeric_limits<double>::infinity()));
+    d_max.storeRelease(
+                      Util::toBits(-bsl::numeric_limits<double>::infinity()));
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void HistogramCollector::init()
+{
+    const double gamma = (1 + d_relativeAccuracy) / (1 - d_relativeAccuracy);
+
+    d_logGamma = bsl::log(gamma);
+    d_minIndex = static_cast<int>(signedIndex(d_minTrackedValue, d_logGamma));
+
+    const int maxIndex = static_cast<int>(signedIndex(d_maxTrackedValue,
+                                                      d_logGamma));
+
+    d_numBuckets = maxIndex - d_minIndex + 1;
+    d_buckets_p  = static_cast<AtomicInt64 *>(d_allocator_p->allocate(
+                                      d_numBuckets * sizeof(AtomicInt64)));
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        AtomicOps::initInt64(&d_buckets_p[i], 0);
+    }
+}
+
+// PRIVATE ACCESSORS
+void HistogramCollector::loadImp(bdlm::Histogram *result,
+                                 bool             resetFlag) const
+{
+    BSLS_ASSERT(result);
+
+    bdlm::Histogram histogram(d_relativeAccuracy,
+                              d_minTrackedValue,
+                              d_maxTrackedValue,
+                              result->allocator());
+
+    BSLS_ASSERT(d_numBuckets == histogram.numBuckets());
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        const bsls::Types::Int64 count = loadInt64(&d_buckets_p[i],
+                                                   resetFlag,
+                                                   0);
+        if (count) {
+            histogram.addToBucket(i, count);
+        }
+    }
+
+    typedef CollectorUtil Util;
+
+    const bsls::Types::Int64 zero   = Util::toBits(0.0);
+    const bsls::Types::Int64 maxMin = Util::toBits(
+                                    bsl::numeric_limits<double>::infinity());
+    const bsls::Types::Int64 minMax = Util::toBits(
+                                   -bsl::numeric_limits<double>::infinity());
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes[i];
+
+        histogram.accumulateSumMinMax(
+               Util::fromBits(loadInt64(&stripe.d_sum, resetFlag, zero)),
+               Util::fromBits(loadInt64(&stripe.d_min, resetFlag, maxMin)),
+               Util::fromBits(loadInt64(&stripe.d_max, resetFlag, minMax)));
+    }
+
+    result->swap(histogram);
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_relativeAccuracy(bdlm::Histogram::k_DEFAULT_RELATIVE_ACCURACY)
+, d_minTrackedValue(bdlm::Histogram::k_DEFAULT_MIN_TRACKED_VALUE)
+, d_maxTrackedValue(bdlm::Histogram::k_DEFAULT_MAX_TRACKED_VALUE)
+, d_buckets_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       double            relativeAccuracy,
+                                       double            minTrackedValue,
+                                       double            maxTrackedValue,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_relativeAccuracy(relativeAccuracy)
+, d_minTrackedValue(minTrackedValue)
+, d_maxTrackedValue(maxTrackedValue)
+, d_buckets_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(bdlm::Histogram::isValid(relativeAccuracy,
+                                         minTrackedValue,
+                                         maxTrackedValue));
+
+    init();
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    d_allocator_p->deallocate(d_buckets_p);
+}
+
+// MANIPULATORS
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < d_numBuckets; ++i) {
+        AtomicOps::setInt64Release(&d_buckets_p[i], 0);
+    }
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes[i].reset();
+    }
+}
+
+void HistogramCollector::update(double value)
+{
+    // Note that the negated comparison also maps a NaN to the first bucket,
+    // as does `bdlm::Histogram::bucketIndex`.
+
+    int index;
+    if (!(value > d_minTrackedValue)) {
+        index = 0;
+    }
+    else if (value >= d_maxTrackedValue) {
+        index = d_numBuckets - 1;
+    }
+    else {
+        index = static_cast<int>(signedIndex(value, d_logGamma)) - d_minIndex;
+        index = bsl::min(bsl::max(index, 0), d_numBuckets - 1);
+    }
+
+    AtomicOps::addInt64NvRelaxed(&d_buckets_p[index], 1);
+
+    Stripe& stripe =
+                 d_stripes[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
+
+    CollectorUtil::addDouble(&stripe.d_sum, value);
+    CollectorUtil::minDouble(&stripe.d_min, value);
+    CollectorUtil::maxDouble(&stripe.d_max, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,385 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free container for collecting value distributions.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free collector of a value distribution
+//
+//@SEE_ALSO: bdlm_histogram, balm_histogrammetric, balm_collector
+//
+//@DESCRIPTION: This component provides a class, `balm::HistogramCollector`,
+// for collecting the distribution of the values of a metric (e.g., the
+// latency of a request), so that quantiles of the distribution (e.g., the
+// 99th percentile) can be reported, rather than only the count, total,
+// minimum, and maximum collected by a `balm::Collector`.
+//
+// A `balm::HistogramCollector` counts values in logarithmically sized buckets
+// having exactly the layout of a `bdlm::Histogram` of the same configuration
+// (relative accuracy, and minimum and maximum tracked values), and provides
+// `load` and `loadAndReset` operations that populate a `bdlm::Histogram`
+// from which quantiles can be estimated, and which can be merged with other
+// histograms of the same configuration.  Note that in practice, most clients
+// should not need to access a `balm::HistogramCollector` directly, but
+// instead use it through a `balm::HistogramMetric`.
+//
+///Thread Safety
+///-------------
+// `balm::HistogramCollector` is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Performance
+///-----------
+// `update` does not acquire any lock: the bucket counts are atomic integers
+// incremented with relaxed memory ordering, and the sum, minimum, and maximum
+// are maintained using compare-and-swap loops (see `balm_collectorutil`) on
+// one of `k_NUM_STRIPES` cache-line sized stripes, selected by the identifier
+// of the calling thread (see `bdlmt_stripeutil`), so that threads updating the
+// same collector rarely contend on the same cache line.  The cost of an update
+// is dominated by the computation of a logarithm (to find the bucket of the
+// value).
+//
+// As a consequence, `load` and `loadAndReset` are *not* atomic with respect
+// to concurrent updates: a value recorded concurrently with `loadAndReset`
+// may be counted in the bucket counts loaded by one call, and in the sum,
+// minimum, or maximum loaded by the next.  No value is lost or counted twice
+// in the bucket counts (from which the count and the quantiles are derived).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example creates a `balm::HistogramCollector`, records a
+// series of latencies, and then loads the resulting distribution.
+//
+// We start by creating a `balm::MetricId` object by hand, but in practice, an
+// id should be obtained from a `balm::MetricRegistry` object (such as the one
+// owned by a `balm::MetricsManager`):
+// ```
+// balm::Category           myCategory("MyCategory");
+// balm::MetricDescription  description(&myCategory, "MyLatency");
+// balm::MetricId           myMetric(&description);
+// ```
+// Then, we create a `balm::HistogramCollector` object for `myMetric` that
+// tracks values between a microsecond and 100 seconds with a relative
+// accuracy of 1%, and record 100 latencies of 1ms to 100ms:
+// ```
+// balm::HistogramCollector collector(myMetric, 0.01, 1e-6, 100.0);
+//
+// for (int i = 1; i <= 100; ++i) {
+//     collector.update(i * 0.001);
+// }
+// ```
+// Finally, we load the distribution into a `bdlm::Histogram`, resetting the
+// collector, and estimate the median and the 99th percentile of the recorded
+// latencies:
+// ```
+// bdlm::Histogram histogram;
+// collector.loadAndReset(&histogram);
+//
+// assert(100 == histogram.count());
+// assert(0.001 == histogram.min());
+// assert(0.1   == histogram.max());
+//
+// const double p50 = histogram.quantile(0.5);
+// const double p99 = histogram.quantile(0.99);
+//
+// assert(0.0495 <= p50 && p50 <= 0.0515);
+// assert(0.0980 <= p99 && p99 <= 0.1000);
+// ```
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+
+#include <bdlm_histogram.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+/// This class provides a mechanism for collecting the distribution of the
+/// values of a metric over a period of time, without locking.  The
+/// collector contains a `MetricId` object that identifies the metric being
+/// collected, and counts values in buckets having the layout of a
+/// `bdlm::Histogram` configured with the relative accuracy, and the minimum
+/// and maximum tracked values, supplied at construction.
+class HistogramCollector {
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_NUM_STRIPES = 16  // number of (cache-line sized) stripes over which
+                            // the sum, minimum, and maximum are distributed
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations                    AtomicOps;
+    typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicInt64;
+
+    /// The sum, minimum, and maximum (each represented by the bits of a
+    /// `double`) of the values recorded by the threads whose identifiers
+    /// map to the same stripe.
+    struct Stripe {
+
+        // DATA
+        bsls::AtomicInt64 d_sum;  // sum of values
+        bsls::AtomicInt64 d_min;  // minimum value
+        bsls::AtomicInt64 d_max;  // maximum value
+
+        char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                - 3 * sizeof(bsls::AtomicInt64)];
+                                  // padding to a full cache line
+
+        // CREATORS
+
+        /// Create a stripe having a sum of 0.0, a minimum of positive
+        /// infinity, and a maximum of negative infinity.
+        Stripe();
+
+        // MANIPULATORS
+
+        /// Reset the sum of this stripe to 0.0, its minimum to positive
+        /// infinity, and its maximum to negative infinity.
+        void reset();
+    };
+
+    // DATA
+    MetricId          d_metricId;                // metric identifier
+
+    double            d_relativeAccuracy;        // configuration
+
+    double            d_minTrackedValue;         // configuration
+
+    double            d_maxTrackedValue;         // configuration
+
+    double            d_logGamma;                // logarithm of the ratio of
+                                                 // consecutive bucket
+                                                 // boundaries
+
+    int               d_minIndex;                // signed index of the first
+                                                 // bucket
+
+    int               d_numBuckets;              // number of buckets
+
+    AtomicInt64      *d_buckets_p;               // bucket counts (owned)
+
+    mutable Stripe    d_stripes[k_NUM_STRIPES];  // sum, minimum, and maximum
+
+    bslma::Allocator *d_allocator_p;             // memory allocator (held,
+                                                 // not owned)
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&) BSLS_KEYWORD_DELETED;
+    HistogramCollector& operator=(const HistogramCollector&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Allocate and zero the bucket counts of this collector for the
+    /// configuration held by this object.
+    void init();
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `result` the values recorded by this
+    /// collector and, if the specified `resetFlag` is `true`, reset this
+    /// collector to its empty state.
+    void loadImp(bdlm::Histogram *result, bool resetFlag) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramCollector,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty collector for a metric having the specified
+    /// `metricId`, that counts values in buckets having the layout of a
+    /// `bdlm::Histogram` with the default configuration (see
+    /// `bdlm_histogram`).  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty collector for a metric having the specified
+    /// `metricId`, that counts values in buckets having the layout of a
+    /// `bdlm::Histogram` with the specified `relativeAccuracy`,
+    /// `minTrackedValue`, and `maxTrackedValue`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `bdlm::Histogram::isValid(relativeAccuracy,
+    /// minTrackedValue, maxTrackedValue)`.
+    HistogramCollector(const MetricId&   metricId,
+                       double            relativeAccuracy,
+                       double            minTrackedValue,
+                       double            maxTrackedValue,
+                       bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~HistogramCollector();
+
+    // MANIPULATORS
+
+    /// Load into the specified `result` the distribution of the values
+    /// recorded by this collector, then reset this collector to its empty
+    /// state.  `result` is given the configuration of this collector, and
+    /// retains its allocator.  Note that this operation is not atomic with
+    /// respect to concurrent calls to `update` (see {Performance}).
+    void loadAndReset(bdlm::Histogram *result);
+
+    /// Remove all the values recorded by this collector.
+    void reset();
+
+    /// Record the specified `value` in the distribution collected by this
+    /// collector.
+    void update(double value);
+
+    // ACCESSORS
+
+    /// Load into the specified `result` the distribution of the values
+    /// recorded by this collector.  `result` is given the configuration of
+    /// this collector, and retains its allocator.
+    void load(bdlm::Histogram *result) const;
+
+    /// Return the maximum value tracked with the configured accuracy by
+    /// this collector.
+    double maxTrackedValue() const;
+
+    /// Return a reference to the non-modifiable `MetricId` object
+    /// identifying the metric for which this object collects values.
+    const MetricId& metricId() const;
+
+    /// Return the minimum value tracked with the configured accuracy by
+    /// this collector.
+    double minTrackedValue() const;
+
+    /// Return the number of buckets of the distribution collected by this
+    /// collector.
+    int numBuckets() const;
+
+    /// Return the relative accuracy of the quantiles estimated from the
+    /// distribution collected by this collector.
+    double relativeAccuracy() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // struct HistogramCollector::Stripe
+                      // --------------------------------
+
+// CREATORS
+inline
+HistogramCollector::Stripe::Stripe()
+{
+    reset();
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void HistogramCollector::loadAndReset(bdlm::Histogram *result)
+{
+    loadImp(result, true);
+}
+
+// ACCESSORS
+inline
+void HistogramCollector::load(bdlm::Histogram *result) const
+{
+    loadImp(result, false);
+}
+
+inline
+double HistogramCollector::maxTrackedValue() const
+{
+    return d_maxTrackedValue;
+}
+
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+double HistogramCollector::minTrackedValue() const
+{
+    return d_minTrackedValue;
+}
+
+inline
+int HistogramCollector::numBuckets() const
+{
+    return d_numBuckets;
+}
+
+inline
+double HistogramCollector::relativeAccuracy() const
+{
+    return d_relativeAccuracy;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *HistogramCollector::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
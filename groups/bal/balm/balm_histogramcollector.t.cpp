@@ -0,0 +1,624 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bdlf_bind.h>
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The `balm::HistogramCollector` is a mechanism for collecting the
+// distribution of metric values without locking.  Ensure that the values
+// recorded are counted in the buckets a `bdlm::Histogram` of the same
+// configuration would count them in, that they can be read out of the
+// collector, and that concurrent updates are not lost.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HistogramCollector(const MetricId&, bslma::Allocator *);
+// [ 2] HistogramCollector(const MetricId&, double, double, double, Alloc *);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 4] void loadAndReset(bdlm::Histogram *result);
+// [ 4] void reset();
+// [ 3] void update(double value);
+//
+// ACCESSORS
+// [ 3] void load(bdlm::Histogram *result) const;
+// [ 2] double maxTrackedValue() const;
+// [ 2] const MetricId& metricId() const;
+// [ 2] double minTrackedValue() const;
+// [ 2] int numBuckets() const;
+// [ 2] double relativeAccuracy() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENT UPDATES
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: update
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef bdlm::Histogram          Histogram;
+typedef balm::MetricId           Id;
+typedef balm::MetricDescription  Desc;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Wait on the specified `barrier`, then update the specified `collector`
+/// with each of the values in the range `[offset, offset + numUpdates)`,
+/// for the specified `offset` and `numUpdates`.
+void updateCollector(Obj            *collector,
+                     int             offset,
+                     int             numUpdates,
+                     bslmt::Barrier *barrier)
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(offset + i);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int    test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+        bslma::TestAllocator         da;
+        bslma::DefaultAllocatorGuard guard(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example creates a `balm::HistogramCollector`, records a
+// series of latencies, and then loads the resulting distribution.
+//
+// We start by creating a `balm::MetricId` object by hand, but in practice, an
+// id should be obtained from a `balm::MetricRegistry` object (such as the one
+// owned by a `balm::MetricsManager`):
+// ```
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "MyLatency");
+    balm::MetricId           myMetric(&description);
+// ```
+// Then, we create a `balm::HistogramCollector` object for `myMetric` that
+// tracks values between a microsecond and 100 seconds with a relative
+// accuracy of 1%, and record 100 latencies of 1ms to 100ms:
+// ```
+    balm::HistogramCollector collector(myMetric, 0.01, 1e-6, 100.0);
+
+    for (int i = 1; i <= 100; ++i) {
+        collector.update(i * 0.001);
+    }
+// ```
+// Finally, we load the distribution into a `bdlm::Histogram`, resetting the
+// collector, and estimate the median and the 99th percentile of the recorded
+// latencies:
+// ```
+    bdlm::Histogram histogram;
+    collector.loadAndReset(&histogram);
+
+    ASSERT(100 == histogram.count());
+    ASSERT(0.001 == histogram.min());
+    ASSERT(0.1   == histogram.max());
+
+    const double p50 = histogram.quantile(0.5);
+    const double p99 = histogram.quantile(0.99);
+
+    ASSERTV(p50, 0.0495 <= p50 && p50 <= 0.0515);
+    ASSERTV(p99, 0.0980 <= p99 && p99 <= 0.1000);
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        // 1. The values supplied to `update` by several threads, whose sums,
+        //    minima, and maxima are maintained in different stripes, are all
+        //    reflected in the loaded histogram.
+        //
+        // 2. The loaded bucket counts are the bucket counts of a histogram
+        //    to which the same values are added sequentially.
+        //
+        // Plan:
+        // 1. Update a collector concurrently from several threads, each
+        //    supplying a distinct range of values, then verify the count,
+        //    sum, minimum, maximum, and bucket counts of the loaded
+        //    histogram against a histogram populated sequentially.  (C-1,2)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT UPDATES" << endl
+                                  << "==================" << endl;
+
+        enum { k_NUM_THREADS = 12, k_NUM_UPDATES = 1000 };
+
+        bslma::TestAllocator ta;
+        Obj                  mX(METRIC_A, 0.01, 0.5, 1e6, &ta);
+        const Obj&           X = mX;
+
+        {
+            bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS, &ta);
+            bslmt::Barrier         barrier(k_NUM_THREADS);
+
+            pool.start();
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     i * k_NUM_UPDATES,
+                                                     k_NUM_UPDATES,
+                                                     &barrier));
+            }
+            pool.drain();
+        }
+
+        const int NUM_VALUES = k_NUM_THREADS * k_NUM_UPDATES;
+
+        Histogram expected(0.01, 0.5, 1e6, &ta);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            expected.add(i);
+        }
+
+        Histogram result(&ta);
+        X.load(&result);
+
+        ASSERTV(result.count(), NUM_VALUES == result.count());
+        ASSERTV(result.sum(), expected.sum() == result.sum());
+        ASSERTV(result.min(), 0 == result.min());
+        ASSERTV(result.max(), NUM_VALUES - 1 == result.max());
+
+        ASSERT(expected.numBuckets() == result.numBuckets());
+        for (int i = 0; i < expected.numBuckets(); ++i) {
+            ASSERTV(i, expected.bucketCount(i) == result.bucketCount(i));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING: reset, loadAndReset
+        //
+        // Concerns:
+        // 1. `reset` removes all recorded values.
+        //
+        // 2. `loadAndReset` loads the recorded values, then removes them.
+        //
+        // 3. A collector can be reused after being reset.
+        //
+        // Plan:
+        // 1. Update a collector, call `reset`, and verify that a subsequent
+        //    `load` yields an empty histogram.  (C-1)
+        //
+        // 2. Update a collector, call `loadAndReset` and verify the loaded
+        //    histogram, then verify that a subsequent `load` yields an empty
+        //    histogram.  (C-2)
+        //
+        // 3. Update the collector again and verify the loaded histogram.
+        //    (C-3)
+        //
+        // Testing:
+        //   void loadAndReset(bdlm::Histogram *result);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: reset, loadAndReset" << endl
+                                  << "============================" << endl;
+
+        bslma::TestAllocator ta;
+        Obj                  mX(METRIC_A, &ta);  const Obj& X = mX;
+
+        const Histogram EMPTY(&ta);
+
+        Histogram expected(&ta);
+        Histogram result(&ta);
+
+        mX.update(1.0);
+        mX.update(2.0);
+        mX.reset();
+
+        X.load(&result);
+        ASSERT(EMPTY == result);
+
+        for (int i = 0; i < 10; ++i) {
+            expected.add(i * 0.5);
+            mX.update(i * 0.5);
+        }
+
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+
+        X.load(&result);
+        ASSERT(EMPTY == result);
+
+        expected.reset();
+        expected.add(7.0);
+        mX.update(7.0);
+
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+        ASSERT(7.0 == result.min());
+        ASSERT(7.0 == result.max());
+        ASSERT(7.0 == result.sum());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING: update, load
+        //
+        // Concerns:
+        // 1. `update` counts a value in the bucket in which
+        //    `bdlm::Histogram::add` counts it, for the same configuration,
+        //    including values outside the tracked range.
+        //
+        // 2. `load` loads the count, sum, minimum, and maximum of the
+        //    recorded values.
+        //
+        // 3. `load` gives `result` the configuration of the collector, and
+        //    does not change the allocator of `result`.
+        //
+        // 4. `load` does not modify the collector.
+        //
+        // Plan:
+        // 1. For a set of configurations, update a collector and add to a
+        //    histogram a sequence of values, including values less than the
+        //    minimum, and greater than the maximum, tracked value, and verify
+        //    that the histogram loaded from the collector has the same value
+        //    as the histogram populated directly.  (C-1,2)
+        //
+        // 2. Load into a histogram having a different configuration and
+        //    allocator, and verify its configuration and allocator.  (C-3)
+        //
+        // 3. Load twice, and verify the results are the same.  (C-4)
+        //
+        // Testing:
+        //   void update(double value);
+        //   void load(bdlm::Histogram *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: update, load" << endl
+                                  << "=====================" << endl;
+
+        static const struct {
+            int    d_line;
+            double d_relativeAccuracy;
+            double d_minTrackedValue;
+            double d_maxTrackedValue;
+        } DATA[] = {
+            { L_, 0.01,  1e-9,  1e9  },
+            { L_, 0.001, 1e-6,  1e3  },
+            { L_, 0.05,  1.0,   10.0 },
+            { L_, 0.2,   0.001, 1e12 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const double VALUES[] = {
+            -1.0, 0.0, 1e-12, 1e-9, 2e-9, 1e-6, 0.001, 0.5, 0.999, 1.0, 1.001,
+            1.5, 2.0, 3.14159, 9.999, 10.0, 123.0, 1e6, 1e9, 1e12, 1e15
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        bslma::TestAllocator ta;
+        bslma::TestAllocator oa;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE = DATA[ti].d_line;
+            const double ACC  = DATA[ti].d_relativeAccuracy;
+            const double MIN  = DATA[ti].d_minTrackedValue;
+            const double MAX  = DATA[ti].d_maxTrackedValue;
+
+            Obj       mX(METRIC_A, ACC, MIN, MAX, &ta);  const Obj& X = mX;
+            Histogram expected(ACC, MIN, MAX, &ta);
+
+            for (int vi = 0; vi < NUM_VALUES; ++vi) {
+                const double VALUE = VALUES[vi];
+
+                expected.add(VALUE);
+                mX.update(VALUE);
+
+                Histogram result(&oa);
+                X.load(&result);
+
+                ASSERTV(LINE, VALUE, expected == result);
+                ASSERTV(LINE, VALUE, &oa == result.allocator());
+                ASSERTV(LINE, VALUE, ACC == result.relativeAccuracy());
+                ASSERTV(LINE, VALUE, MIN == result.minTrackedValue());
+                ASSERTV(LINE, VALUE, MAX == result.maxTrackedValue());
+            }
+
+            Histogram result1(&oa);
+            Histogram result2(&oa);
+
+            X.load(&result1);
+            X.load(&result2);
+            ASSERTV(LINE, result1 == result2);
+            ASSERTV(LINE, NUM_VALUES == result2.count());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING: CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The collector has the configuration supplied at construction,
+        //    or the default configuration of `bdlm::Histogram`.
+        //
+        // 2. The number of buckets is the number of buckets of a
+        //    `bdlm::Histogram` having the same configuration.
+        //
+        // 3. Memory is supplied by the specified allocator, or the default
+        //    allocator, and is released at destruction.
+        //
+        // Plan:
+        // 1. Create collectors using each constructor, and verify the
+        //    value of every accessor.  (C-1,2)
+        //
+        // 2. Use test allocators to verify the source of the allocated
+        //    memory.  (C-3)
+        //
+        // Testing:
+        //   HistogramCollector(const MetricId&, bslma::Allocator *);
+        //   HistogramCollector(const MetricId&, double, double, double, A*);
+        //   ~HistogramCollector();
+        //   double maxTrackedValue() const;
+        //   const MetricId& metricId() const;
+        //   double minTrackedValue() const;
+        //   int numBuckets() const;
+        //   double relativeAccuracy() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: CREATORS AND ACCESSORS" << endl
+                                  << "===============================" << endl;
+
+        bslma::TestAllocator         ta;
+        bslma::TestAllocator         da;
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        {
+            const Histogram H(&ta);
+
+            Obj mX(METRIC_A);  const Obj& X = mX;
+
+            ASSERT(METRIC_A                == X.metricId());
+            ASSERT(H.relativeAccuracy()    == X.relativeAccuracy());
+            ASSERT(H.minTrackedValue()     == X.minTrackedValue());
+            ASSERT(H.maxTrackedValue()     == X.maxTrackedValue());
+            ASSERT(H.numBuckets()          == X.numBuckets());
+            ASSERT(&da                     == X.allocator());
+            ASSERT(0                       <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            const Histogram H(0.001, 1e-6, 1e3, &ta);
+
+            Obj mX(METRIC_B, 0.001, 1e-6, 1e3, &ta);  const Obj& X = mX;
+
+            ASSERT(METRIC_B                == X.metricId());
+            ASSERT(0.001                   == X.relativeAccuracy());
+            ASSERT(1e-6                    == X.minTrackedValue());
+            ASSERT(1e3                     == X.maxTrackedValue());
+            ASSERT(H.numBuckets()          == X.numBuckets());
+            ASSERT(&ta                     == X.allocator());
+            ASSERT(2                       == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(1 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   The basic functionality of the component works.
+        //
+        // Plan:
+        //   Update a collector, and load the recorded distribution.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta;
+
+        Obj mX(METRIC_A, &ta);  const Obj& X = mX;
+
+        for (int i = 1; i <= 1000; ++i) {
+            mX.update(i);
+        }
+
+        Histogram result(&ta);
+        X.load(&result);
+
+        ASSERT(1000   == result.count());
+        ASSERT(500500 == result.sum());
+        ASSERT(1      == result.min());
+        ASSERT(1000   == result.max());
+
+        const double p90 = result.quantile(0.9);
+        ASSERTV(p90, 891 <= p90 && p90 <= 909);
+
+        mX.loadAndReset(&result);
+        ASSERT(1000 == result.count());
+
+        X.load(&result);
+        ASSERT(0 == result.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: update
+        //
+        // Concerns:
+        // 1. Concurrent calls to `update` scale with the number of threads.
+        //
+        // Plan:
+        // 1. For an increasing number of threads, update a single collector
+        //    concurrently from every thread, and report the average time per
+        //    call.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: update
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE: update" << endl
+                                  << "===================" << endl;
+
+        enum { k_NUM_UPDATES = 1000000 };
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            Obj mX(METRIC_A);
+
+            bdlmt::FixedThreadPool pool(numThreads, numThreads);
+            bslmt::Barrier         barrier(numThreads + 1);
+
+            pool.start();
+            for (int i = 0; i < numThreads; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     i + 1,
+                                                     k_NUM_UPDATES,
+                                                     &barrier));
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            barrier.wait();
+            pool.drain();
+            timer.stop();
+
+            cout << "threads: " << numThreads << "\tns per update: "
+                 << timer.elapsedTime() * 1e9 / k_NUM_UPDATES << endl;
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
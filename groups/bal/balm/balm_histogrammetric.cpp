@@ -0,0 +1,219 @@
+// balm_histogrammetric.cpp                                           -*-C++-*-
+#include <balm_histogrammetric.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogrammetric_cpp,"$Id$ $CSID$")
+
+#include <balm_category.h>
+#include <balm_defaultmetricsmanager.h>
+#include <balm_metricregistry.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdio.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                           // ---------------------
+                           // class HistogramMetric
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+MetricId HistogramMetric::lookupId(MetricsManager *manager,
+                                   const char     *category,
+                                   const char     *name)
+{
+    return manager ? manager->metricRegistry().getId(category, name)
+                   : MetricId();
+}
+
+// PRIVATE MANIPULATORS
+void HistogramMetric::collect(bsl::vector<MetricRecord> *records,
+                              bool                       resetFlag)
+{
+    bdlm::Histogram histogram(allocator());
+
+    if (resetFlag) {
+        d_collector.loadAndReset(&histogram);
+    }
+    else {
+        d_collector.load(&histogram);
+    }
+
+    appendRecords(records,
+                  d_collector.metricId(),
+                  histogram,
+                  d_quantiles,
+                  d_quantileIds);
+}
+
+void HistogramMetric::registerMetric(const char *category, const char *name)
+{
+    if (!d_metricsManager_p) {
+        return;                                                       // RETURN
+    }
+
+    bsl::string quantileMetric(allocator());
+    for (bsl::size_t i = 0; i < d_quantiles.size(); ++i) {
+        quantileName(&quantileMetric, name, d_quantiles[i]);
+        d_quantileIds.push_back(lookupId(d_metricsManager_p,
+                                         category,
+                                         quantileMetric.c_str()));
+    }
+
+    d_callbackHandle = d_metricsManager_p->registerCollectionCallback(
+                               category,
+                               bdlf::BindUtil::bindS(allocator(),
+                                                     &HistogramMetric::collect,
+                                                     this,
+                                                     bdlf::PlaceHolders::_1,
+                                                     bdlf::PlaceHolders::_2));
+
+    d_isEnabled_p = &d_collector.metricId().category()->isEnabledRaw();
+}
+
+// CLASS METHODS
+void HistogramMetric::appendRecords(
+                                   bsl::vector<MetricRecord>    *records,
+                                   const MetricId&               metricId,
+                                   const bdlm::Histogram&        histogram,
+                                   const bsl::vector<double>&    quantiles,
+                                   const bsl::vector<MetricId>&  quantileIds)
+{
+    BSLS_ASSERT(records);
+    BSLS_ASSERT(quantiles.size() == quantileIds.size());
+
+    if (0 == histogram.count()) {
+        records->push_back(MetricRecord(metricId));
+        return;                                                       // RETURN
+    }
+
+    records->push_back(MetricRecord(metricId,
+                                    static_cast<int>(histogram.count()),
+                                    histogram.sum(),
+                                    histogram.min(),
+                                    histogram.max()));
+
+    for (bsl::size_t i = 0; i < quantiles.size(); ++i) {
+        const double value = histogram.quantile(quantiles[i]);
+
+        records->push_back(
+                         MetricRecord(quantileIds[i], 1, value, value, value));
+    }
+}
+
+void HistogramMetric::defaultQuantiles(bsl::vector<double> *quantiles)
+{
+    BSLS_ASSERT(quantiles);
+
+    static const double k_DEFAULT_QUANTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+
+    quantiles->assign(k_DEFAULT_QUANTILES,
+                      k_DEFAULT_QUANTILES + sizeof k_DEFAULT_QUANTILES
+                                             / sizeof *k_DEFAULT_QUANTILES);
+}
+
+void HistogramMetric::quantileName(bsl::string             *result,
+                                   const bsl::string_view&  name,
+                                   double                   quantile)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= quantile);
+    BSLS_ASSERT(quantile <= 1);
+
+    // Format `quantile` as "0.dddddd" (or "1.000000"), then retain the
+    // significant digits following the decimal point.
+
+    char buffer[16];
+    bsl::snprintf(buffer, sizeof buffer, "%.6f", quantile);
+
+    result->assign(name.data(), name.size());
+    result->append(".p");
+
+    if ('1' == buffer[0]) {
+        result->append("100");
+        return;                                                       // RETURN
+    }
+
+    int numDigits = 6;
+    while (numDigits > 2 && '0' == buffer[1 + numDigits]) {
+        --numDigits;
+    }
+    result->append(buffer + 2, numDigits);
+}
+
+// CREATORS
+HistogramMetric::HistogramMetric(const char       *category,
+                                 const char       *name,
+                                 MetricsManager   *manager,
+                                 bslma::Allocator *basicAllocator)
+: d_metricsManager_p(DefaultMetricsManager::manager(manager))
+, d_collector(lookupId(d_metricsManager_p, category, name), basicAllocator)
+, d_quantiles(basicAllocator)
+, d_quantileIds(basicAllocator)
+, d_callbackHandle(MetricsManager::e_INVALID_HANDLE)
+, d_isEnabled_p(0)
+{
+    BSLS_ASSERT(category);
+    BSLS_ASSERT(name);
+
+    defaultQuantiles(&d_quantiles);
+    registerMetric(category, name);
+}
+
+HistogramMetric::HistogramMetric(const char                 *category,
+                                 const char                 *name,
+                                 double                      relativeAccuracy,
+                                 double                      minTrackedValue,
+                                 double                      maxTrackedValue,
+                                 const bsl::vector<double>&  quantiles,
+                                 MetricsManager             *manager,
+                                 bslma::Allocator           *basicAllocator)
+: d_metricsManager_p(DefaultMetricsManager::manager(manager))
+, d_collector(lookupId(d_metricsManager_p, category, name),
+              relativeAccuracy,
+              minTrackedValue,
+              maxTrackedValue,
+              basicAllocator)
+, d_quantiles(quantiles, basicAllocator)
+, d_quantileIds(basicAllocator)
+, d_callbackHandle(MetricsManager::e_INVALID_HANDLE)
+, d_isEnabled_p(0)
+{
+    BSLS_ASSERT(category);
+    BSLS_ASSERT(name);
+
+    registerMetric(category, name);
+}
+
+HistogramMetric::~HistogramMetric()
+{
+    if (MetricsManager::e_INVALID_HANDLE != d_callbackHandle) {
+        int rc = d_metricsManager_p->removeCollectionCallback(
+                                                             d_callbackHandle);
+        BSLS_ASSERT(0 == rc);  (void)rc;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
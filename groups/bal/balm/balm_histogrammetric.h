@@ -0,0 +1,390 @@
+// balm_histogrammetric.h                                             -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMMETRIC
+#define INCLUDED_BALM_HISTOGRAMMETRIC
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a metric that publishes quantiles of recorded values.
+//
+//@CLASSES:
+//   balm::HistogramMetric: metric publishing the quantiles of its values
+//
+//@SEE_ALSO: balm_histogramcollector, balm_metric, balm_stopwatchscopedguard,
+//           bdlm_histogram
+//
+//@DESCRIPTION: This component provides a class, `balm::HistogramMetric`, for
+// recording the distribution of the values of a metric (typically a latency)
+// and publishing, in addition to the count, total, minimum, and maximum of
+// the values, estimates of a set of quantiles of the values (e.g., the
+// median and the 99th percentile).
+//
+// A `balm::HistogramMetric` records values in a `balm::HistogramCollector`
+// (without locking), and registers, with a `balm::MetricsManager`, a
+// collection callback that is invoked each time the metric's category is
+// published.  Since a `balm::MetricRecord` holds only a count, total,
+// minimum, and maximum, the callback publishes one record for the metric
+// itself, holding the count, sum, minimum, and maximum of the values recorded
+// since the previous publication, and, if any value was recorded, one
+// additional record for each quantile.  The record for a quantile `q` of a
+// metric named `name` is identified by the metric named `name` followed by
+// `.p` and the decimal digits of `q` (at least two), e.g., `name.p50` for the
+// median, `name.p99` for the 99th percentile, and `name.p999` for the 99.9th
+// percentile (see `quantileName`); it has a count of 1, and a total, minimum,
+// and maximum equal to the estimated quantile.  The quantile records are
+// therefore published, unchanged, by any `balm::Publisher` (e.g., a
+// `balm::StreamPublisher`).
+//
+// The quantiles are estimated with the relative accuracy of the underlying
+// histogram (1% by default, see `bdlm_histogram`), and are always computed
+// from the values recorded since the previous publication (for which the
+// `resetFlag` is `true`), i.e., they are *not* affected by the publication
+// type preferred for the metric.
+//
+// If a metrics manager is not supplied at construction, the default metrics
+// manager instance (`balm::DefaultMetricsManager::instance()`) is used, if
+// initialized; otherwise, the metric is placed in the inactive state (i.e.,
+// `isActive()` is `false`) and `update` has no effect.  A
+// `balm::HistogramMetric` must be destroyed before the metrics manager it
+// registers its callback with.
+//
+///Thread Safety
+///-------------
+// `balm::HistogramMetric` is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we record the latency of requests in milliseconds, and
+// publish its median, 90th, 99th, and 99.9th percentiles.
+//
+// First, we create a metrics manager, and a `balm::HistogramMetric` for the
+// metric "latency" in the category "MyCategory", using the default
+// configuration:
+// ```
+// balm::MetricsManager  manager;
+// balm::HistogramMetric latency("MyCategory", "latency", &manager);
+// assert(latency.isActive());
+// ```
+// Then, we record the latencies of 1000 requests, 1% of which are slow:
+// ```
+// for (int i = 0; i < 1000; ++i) {
+//     latency.update(0 == i % 100 ? 250.0 : 2.0);
+// }
+// ```
+// Next, we collect (and reset) the records that would be published for
+// "MyCategory":
+// ```
+// balm::MetricSample              sample;
+// bsl::vector<balm::MetricRecord> records;
+// manager.collectSample(&sample, &records, true);
+// ```
+// Finally, we verify that, in addition to the record for "latency", there is
+// a record for each default quantile, and that the 99.9th percentile
+// reflects the slow requests, which the median does not:
+// ```
+// assert(5 == records.size());
+//
+// const balm::MetricId p50  = manager.metricRegistry().getId("MyCategory",
+//                                                            "latency.p50");
+// const balm::MetricId p999 = manager.metricRegistry().getId("MyCategory",
+//                                                            "latency.p999");
+//
+// for (bsl::size_t i = 0; i < records.size(); ++i) {
+//     const balm::MetricRecord& record = records[i];
+//
+//     if (latency.metricId() == record.metricId()) {
+//         assert(1000 == record.count());
+//     }
+//     else if (p50 == record.metricId()) {
+//         assert(1.98 <= record.total() && record.total() <= 2.02);
+//     }
+//     else if (p999 == record.metricId()) {
+//         assert(247.5 <= record.total() && record.total() <= 252.5);
+//     }
+// }
+// ```
+
+#include <balscm_version.h>
+
+#include <balm_histogramcollector.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsmanager.h>
+
+#include <bdlm_histogram.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                           // =====================
+                           // class HistogramMetric
+                           // =====================
+
+/// This class provides a mechanism for recording the values of a metric in
+/// a `HistogramCollector`, and publishing the count, total, minimum, and
+/// maximum of the values, as well as estimates of a configurable set of
+/// quantiles of the values, through a `MetricsManager`.  See the
+/// component-level documentation for details.
+class HistogramMetric {
+
+    // DATA
+    MetricsManager                 *d_metricsManager_p;  // metrics manager
+                                                         // (held, not owned);
+                                                         // 0 if inactive
+
+    HistogramCollector              d_collector;         // recorded values
+
+    bsl::vector<double>             d_quantiles;         // published
+                                                         // quantiles
+
+    bsl::vector<MetricId>           d_quantileIds;       // identifies the
+                                                         // metric of each
+                                                         // published quantile
+
+    MetricsManager::CallbackHandle  d_callbackHandle;    // identifies the
+                                                         // collection callback
+
+    const bsls::AtomicInt          *d_isEnabled_p;       // memo for
+                                                         // `isActive()`
+
+    // NOT IMPLEMENTED
+    HistogramMetric(const HistogramMetric&) BSLS_KEYWORD_DELETED;
+    HistogramMetric& operator=(const HistogramMetric&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the id of the metric identified by the specified `category`
+    /// and `name` from the registry of the specified `manager`, or an
+    /// invalid id if `manager` is 0.
+    static MetricId lookupId(MetricsManager *manager,
+                             const char     *category,
+                             const char     *name);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append to the specified `records` the records for the values
+    /// recorded by this metric and, if the specified `resetFlag` is `true`,
+    /// remove those values.  Note that this method is the collection
+    /// callback registered with the metrics manager.
+    void collect(bsl::vector<MetricRecord> *records, bool resetFlag);
+
+    /// Register the quantiles of this object, and its collection callback,
+    /// with the metrics manager of this object, using the specified
+    /// `category` and `name` of the metric.
+    void registerMetric(const char *category, const char *name);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramMetric,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Append to the specified `records` a record having the specified
+    /// `metricId` and the count, sum, minimum, and maximum of the specified
+    /// `histogram` and, if `0 < histogram.count()`, a record for each of
+    /// the specified `quantiles`, identified by the corresponding element
+    /// of the specified `quantileIds`, having a count of 1 and a total,
+    /// minimum, and maximum of the estimate of that quantile of
+    /// `histogram`.  The behavior is undefined unless
+    /// `quantiles.size() == quantileIds.size()`, and each element of
+    /// `quantiles` is in the range `[0, 1]`.
+    static void appendRecords(bsl::vector<MetricRecord>    *records,
+                              const MetricId&               metricId,
+                              const bdlm::Histogram&        histogram,
+                              const bsl::vector<double>&    quantiles,
+                              const bsl::vector<MetricId>&  quantileIds);
+
+    /// Load into the specified `quantiles` the quantiles published by
+    /// default: 0.5, 0.9, 0.99, and 0.999.
+    static void defaultQuantiles(bsl::vector<double> *quantiles);
+
+    /// Load into the specified `result` the name of the metric holding the
+    /// specified `quantile` of the metric having the specified `name`: the
+    /// concatenation of `name`, `.p`, and the decimal digits following the
+    /// decimal point in `quantile` (padded with a trailing zero to at least
+    /// two digits, and rounded to at most six digits), or `100` if
+    /// `1 == quantile`; for example `name.p50`, `name.p99`, and
+    /// `name.p999` for the quantiles 0.5, 0.99, and 0.999.  The behavior is
+    /// undefined unless `0 <= quantile <= 1`.
+    static void quantileName(bsl::string             *result,
+                             const bsl::string_view&  name,
+                             double                   quantile);
+
+    // CREATORS
+
+    /// Create a histogram metric to record values for the metric identified
+    /// by the specified null-terminated strings `category` and `name`,
+    /// using the default histogram configuration (see `bdlm_histogram`),
+    /// and publishing the default quantiles (see `defaultQuantiles`).
+    /// Optionally specify a metrics `manager` with which to register the
+    /// metric.  If `manager` is 0, use the default metrics manager, if
+    /// initialized; if `manager` is 0 and the default metrics manager has
+    /// not been initialized, place this object in the inactive state
+    /// (i.e., `isActive()` is `false`) in which case `update` has no
+    /// effect.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    HistogramMetric(const char       *category,
+                    const char       *name,
+                    MetricsManager   *manager = 0,
+                    bslma::Allocator *basicAllocator = 0);
+
+    /// Create a histogram metric to record values for the metric identified
+    /// by the specified null-terminated strings `category` and `name`,
+    /// using a histogram having the specified `relativeAccuracy`,
+    /// `minTrackedValue`, and `maxTrackedValue`, and publishing the
+    /// specified `quantiles`.  Optionally specify a metrics `manager` with
+    /// which to register the metric.  If `manager` is 0, use the default
+    /// metrics manager, if initialized; if `manager` is 0 and the default
+    /// metrics manager has not been initialized, place this object in the
+    /// inactive state (i.e., `isActive()` is `false`) in which case
+    /// `update` has no effect.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `bdlm::Histogram::isValid(relativeAccuracy, minTrackedValue,
+    /// maxTrackedValue)`, and each element of `quantiles` is in the range
+    /// `[0, 1]`.
+    HistogramMetric(const char                 *category,
+                    const char                 *name,
+                    double                      relativeAccuracy,
+                    double                      minTrackedValue,
+                    double                      maxTrackedValue,
+                    const bsl::vector<double>&  quantiles,
+                    MetricsManager             *manager = 0,
+                    bslma::Allocator           *basicAllocator = 0);
+
+    /// Remove the collection callback of this object from its metrics
+    /// manager, and destroy this object.
+    ~HistogramMetric();
+
+    // MANIPULATORS
+
+    /// Return the address of the modifiable collector for this metric.
+    HistogramCollector *collector();
+
+    /// Record the specified `value` in the distribution of the values of
+    /// this metric.  If, however, this metric is inactive (i.e.,
+    /// `isActive()` is `false`), then this method has no effect.
+    void update(double value);
+
+    // ACCESSORS
+
+    /// Return the address of the non-modifiable collector for this metric.
+    const HistogramCollector *collector() const;
+
+    /// Return `true` if this metric will actively record values, and
+    /// `false` otherwise.  A metric will be inactive if either (1) no
+    /// metrics manager was available at construction, or (2) the category
+    /// of the metric has been disabled (see the `MetricsManager` method
+    /// `setCategoryEnabled`).
+    bool isActive() const;
+
+    /// Return a `MetricId` object identifying this metric.  If this metric
+    /// is not registered with a metrics manager, the returned id will be
+    /// invalid (i.e., `metricId().isValid() == false`).
+    const MetricId& metricId() const;
+
+    /// Return a reference providing non-modifiable access to the quantiles
+    /// published for this metric.
+    const bsl::vector<double>& quantiles() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class HistogramMetric
+                           // ---------------------
+
+// MANIPULATORS
+inline
+HistogramCollector *HistogramMetric::collector()
+{
+    return &d_collector;
+}
+
+inline
+void HistogramMetric::update(double value)
+{
+    if (isActive()) {
+        d_collector.update(value);
+    }
+}
+
+// ACCESSORS
+inline
+const HistogramCollector *HistogramMetric::collector() const
+{
+    return &d_collector;
+}
+
+inline
+bool HistogramMetric::isActive() const
+{
+    return d_isEnabled_p && d_isEnabled_p->loadRelaxed();
+}
+
+inline
+const MetricId& HistogramMetric::metricId() const
+{
+    return d_collector.metricId();
+}
+
+inline
+const bsl::vector<double>& HistogramMetric::quantiles() const
+{
+    return d_quantiles;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *HistogramMetric::allocator() const
+{
+    return d_collector.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,655 @@
+// balm_histogrammetric.t.cpp                                         -*-C++-*-
+#include <balm_histogrammetric.h>
+
+#include <balm_category.h>
+#include <balm_defaultmetricsmanager.h>
+#include <balm_metricdescription.h>
+#include <balm_metricsample.h>
+#include <balm_streampublisher.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The `balm::HistogramMetric` is a mechanism that records values in a
+// `balm::HistogramCollector`, and publishes quantiles of the recorded values
+// through a collection callback registered with a `balm::MetricsManager`.
+// Ensure that the names of the quantile metrics are formed correctly, that
+// the records published for a histogram are correct, and that the callback
+// is registered at construction and removed at destruction.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void appendRecords(records, metricId, histogram, quantiles, ids);
+// [ 2] void defaultQuantiles(bsl::vector<double> *quantiles);
+// [ 2] void quantileName(bsl::string *, const string_view&, double);
+//
+// CREATORS
+// [ 4] HistogramMetric(const char *, const char *, MetricsManager *, A *);
+// [ 4] HistogramMetric(const char *, const char *, double, double, ...);
+// [ 4] ~HistogramMetric();
+//
+// MANIPULATORS
+// [ 4] HistogramCollector *collector();
+// [ 4] void update(double value);
+//
+// ACCESSORS
+// [ 4] const HistogramCollector *collector() const;
+// [ 4] bool isActive() const;
+// [ 4] const MetricId& metricId() const;
+// [ 4] const bsl::vector<double>& quantiles() const;
+// [ 4] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] PUBLICATION
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramMetric Obj;
+typedef bdlm::Histogram       Histogram;
+typedef balm::MetricRecord    Rec;
+typedef balm::MetricId        Id;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the address of the element of the specified `records` having the
+/// specified `id`, or 0 if there is no such element.
+const Rec *findRecord(const bsl::vector<Rec>& records, const Id& id)
+{
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        if (id == records[i].metricId()) {
+            return &records[i];                                       // RETURN
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int    test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    bslma::TestAllocator ta;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+        bslma::TestAllocator         da;
+        bslma::DefaultAllocatorGuard guard(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we record the latency of requests in milliseconds, and
+// publish its median, 90th, 99th, and 99.9th percentiles.
+//
+// First, we create a metrics manager, and a `balm::HistogramMetric` for the
+// metric "latency" in the category "MyCategory", using the default
+// configuration:
+// ```
+    balm::MetricsManager  manager;
+    balm::HistogramMetric latency("MyCategory", "latency", &manager);
+    ASSERT(latency.isActive());
+// ```
+// Then, we record the latencies of 1000 requests, 1% of which are slow:
+// ```
+    for (int i = 0; i < 1000; ++i) {
+        latency.update(0 == i % 100 ? 250.0 : 2.0);
+    }
+// ```
+// Next, we collect (and reset) the records that would be published for
+// "MyCategory":
+// ```
+    balm::MetricSample              sample;
+    bsl::vector<balm::MetricRecord> records;
+    manager.collectSample(&sample, &records, true);
+// ```
+// Finally, we verify that, in addition to the record for "latency", there is
+// a record for each default quantile, and that the 99.9th percentile
+// reflects the slow requests, which the median does not:
+// ```
+    ASSERT(5 == records.size());
+
+    const balm::MetricId p50  = manager.metricRegistry().getId("MyCategory",
+                                                               "latency.p50");
+    const balm::MetricId p999 = manager.metricRegistry().getId("MyCategory",
+                                                               "latency.p999");
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const balm::MetricRecord& record = records[i];
+
+        if (latency.metricId() == record.metricId()) {
+            ASSERT(1000 == record.count());
+        }
+        else if (p50 == record.metricId()) {
+            ASSERT(1.98 <= record.total() && record.total() <= 2.02);
+        }
+        else if (p999 == record.metricId()) {
+            ASSERT(247.5 <= record.total() && record.total() <= 252.5);
+        }
+    }
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PUBLICATION
+        //
+        // Concerns:
+        // 1. The quantile records are published by a `balm::StreamPublisher`
+        //    under the names of the quantile metrics.
+        //
+        // 2. Publication resets the recorded values.
+        //
+        // 3. A histogram metric registered with the default metrics manager
+        //    is published by it.
+        //
+        // Plan:
+        // 1. Register a `balm::StreamPublisher` with the default metrics
+        //    manager, record values, publish, and verify the published
+        //    text.  (C-1,3)
+        //
+        // 2. Publish again, and verify that no quantile is published.  (C-2)
+        //
+        // Testing:
+        //   PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PUBLICATION" << endl
+                                  << "===========" << endl;
+
+        bsl::ostringstream stream;
+        {
+            balm::DefaultMetricsManagerScopedGuard guard(&ta);
+
+            balm::MetricsManager *manager =
+                                       balm::DefaultMetricsManager::instance();
+
+            bsl::shared_ptr<balm::Publisher> publisher(
+                               new (ta) balm::StreamPublisher(stream),
+                               &ta);
+            manager->addGeneralPublisher(publisher);
+
+            Obj mX("Service", "latency", 0, &ta);
+
+            ASSERT(mX.isActive());
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.update(i);
+            }
+            manager->publishAll();
+
+            const bsl::string output = stream.str();
+            if (verbose) {
+                P(output);
+            }
+
+            ASSERT(bsl::string::npos != output.find("Service.latency"));
+            ASSERT(bsl::string::npos != output.find("Service.latency.p50"));
+            ASSERT(bsl::string::npos != output.find("Service.latency.p90"));
+            ASSERT(bsl::string::npos != output.find("Service.latency.p99"));
+            ASSERT(bsl::string::npos != output.find("Service.latency.p999"));
+
+            stream.str("");
+            manager->publishAll();
+
+            const bsl::string output2 = stream.str();
+            if (verbose) {
+                P(output2);
+            }
+
+            ASSERT(bsl::string::npos != output2.find("Service.latency"));
+            ASSERT(bsl::string::npos == output2.find("Service.latency.p"));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A histogram metric registers its metric, its quantile metrics,
+        //    and a collection callback with the supplied metrics manager.
+        //
+        // 2. The configuration and quantiles supplied at construction are
+        //    used, or else the default ones.
+        //
+        // 3. A histogram metric created without a metrics manager, when the
+        //    default metrics manager is not initialized, is inactive, and
+        //    `update` has no effect.
+        //
+        // 4. `update` has no effect if the category of the metric is
+        //    disabled.
+        //
+        // 5. The destructor removes the collection callback.
+        //
+        // 6. Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        // 1. Create histogram metrics using each constructor, and verify the
+        //    accessors, and the records collected by the metrics manager.
+        //    (C-1,2,4..6)
+        //
+        // 2. Create a histogram metric without a metrics manager, and verify
+        //    that it is inactive.  (C-3)
+        //
+        // Testing:
+        //   HistogramMetric(const char *, const char *, MetricsManager *, A*);
+        //   HistogramMetric(const char *, const char *, double, double, ...);
+        //   ~HistogramMetric();
+        //   HistogramCollector *collector();
+        //   void update(double value);
+        //   const HistogramCollector *collector() const;
+        //   bool isActive() const;
+        //   const MetricId& metricId() const;
+        //   const bsl::vector<double>& quantiles() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, MANIPULATORS, AND ACCESSORS" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator         da;
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        balm::MetricsManager   manager(&ta);
+        balm::MetricRegistry&  registry = manager.metricRegistry();
+        balm::MetricSample     sample(&ta);
+        bsl::vector<Rec>       records(&ta);
+
+        {
+            Obj mX("A", "x", &manager, &ta);  const Obj& X = mX;
+
+            bsl::vector<double> expected(&ta);
+            Obj::defaultQuantiles(&expected);
+
+            ASSERT(registry.getId("A", "x") == X.metricId());
+            ASSERT(expected                 == X.quantiles());
+            ASSERT(&ta                      == X.allocator());
+            ASSERT(&ta                      == X.collector()->allocator());
+            ASSERT(mX.collector()           == X.collector());
+            ASSERT(Histogram::k_DEFAULT_RELATIVE_ACCURACY ==
+                                          X.collector()->relativeAccuracy());
+            ASSERT(X.isActive());
+
+            mX.update(1.0);
+            mX.update(3.0);
+
+            manager.collectSample(&sample, &records, true);
+            ASSERTV(records.size(), 5 == records.size());
+
+            const Rec *rec = findRecord(records, X.metricId());
+            ASSERT(0 != rec);
+            ASSERT(Rec(X.metricId(), 2, 4.0, 1.0, 3.0) == *rec);
+
+            rec = findRecord(records, registry.getId("A", "x.p50"));
+            ASSERT(0 != rec && 1 == rec->count());
+            ASSERT(0 != rec && rec->min() == rec->max());
+            ASSERT(0 != rec && 0.99 <= rec->total() && rec->total() <= 1.01);
+
+            // The 0.999-quantile of two values is the lesser value (see
+            // `bdlm::Histogram::quantile`).
+
+            rec = findRecord(records, registry.getId("A", "x.p999"));
+            ASSERT(0 != rec && 1 == rec->count());
+            ASSERT(0 != rec && 0.99 <= rec->total() && rec->total() <= 1.01);
+
+            // The values were reset by the collection.
+
+            records.clear();
+            manager.collectSample(&sample, &records);
+            ASSERTV(records.size(), 1 == records.size());
+            ASSERT(Rec(X.metricId()) == records[0]);
+
+            // Disable the category.
+
+            manager.setCategoryEnabled("A", false);
+            ASSERT(!X.isActive());
+
+            mX.update(2.0);
+            manager.setCategoryEnabled("A", true);
+
+            records.clear();
+            manager.collectSample(&sample, &records);
+            ASSERTV(records.size(), 1 == records.size());
+        }
+
+        // The callback is removed.
+
+        records.clear();
+        manager.collectSample(&sample, &records);
+        ASSERTV(records.size(), 0 == records.size());
+
+        {
+            bsl::vector<double> quantiles(&ta);
+            quantiles.push_back(0.25);
+            quantiles.push_back(0.75);
+
+            Obj mX("B", "y", 0.05, 1.0, 1000.0, quantiles, &manager, &ta);
+            const Obj& X = mX;
+
+            ASSERT(registry.getId("B", "y") == X.metricId());
+            ASSERT(quantiles                == X.quantiles());
+            ASSERT(0.05   == X.collector()->relativeAccuracy());
+            ASSERT(1.0    == X.collector()->minTrackedValue());
+            ASSERT(1000.0 == X.collector()->maxTrackedValue());
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.update(i);
+            }
+
+            records.clear();
+            manager.collectSample(&sample, &records);
+            ASSERTV(records.size(), 3 == records.size());
+
+            const Rec *rec = findRecord(records, registry.getId("B", "y.p25"));
+            ASSERT(0 != rec);
+            ASSERT(0 != rec && 23 <= rec->total() && rec->total() <= 27);
+
+            rec = findRecord(records, registry.getId("B", "y.p75"));
+            ASSERT(0 != rec);
+            ASSERT(0 != rec && 71 <= rec->total() && rec->total() <= 80);
+        }
+        {
+            ASSERT(0 == balm::DefaultMetricsManager::instance());
+
+            Obj mX("C", "z", 0, &ta);  const Obj& X = mX;
+
+            ASSERT(!X.isActive());
+            ASSERT(!X.metricId().isValid());
+
+            mX.update(1.0);
+
+            Histogram histogram(&ta);
+            X.collector()->load(&histogram);
+            ASSERT(0 == histogram.count());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD: appendRecords
+        //
+        // Concerns:
+        // 1. A single record, having the count, sum, minimum, and maximum of
+        //    the histogram, is appended for a histogram having values.
+        //
+        // 2. A record is appended for each quantile, having a count of 1,
+        //    and a total, minimum, and maximum equal to the quantile.
+        //
+        // 3. Only a default record is appended for an empty histogram.
+        //
+        // 4. Existing records are retained.
+        //
+        // Plan:
+        // 1. Append the records for an empty, and a non-empty, histogram to a
+        //    non-empty vector, and verify the vector.  (C-1..4)
+        //
+        // Testing:
+        //   void appendRecords(records, metricId, histogram, quantiles, ids);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CLASS METHOD: appendRecords" << endl
+                                  << "===========================" << endl;
+
+        balm::Category          category("A");
+        balm::MetricDescription descX(&category, "x");
+        balm::MetricDescription descQ1(&category, "x.p50");
+        balm::MetricDescription descQ2(&category, "x.p100");
+
+        const Id ID_X(&descX);
+        const Id ID_Q1(&descQ1);
+        const Id ID_Q2(&descQ2);
+
+        bsl::vector<double> quantiles;
+        bsl::vector<Id>     ids;
+
+        quantiles.push_back(0.5);  ids.push_back(ID_Q1);
+        quantiles.push_back(1.0);  ids.push_back(ID_Q2);
+
+        Histogram        histogram(&ta);
+        bsl::vector<Rec> records(&ta);
+
+        records.push_back(Rec(ID_Q1));
+
+        Obj::appendRecords(&records, ID_X, histogram, quantiles, ids);
+        ASSERTV(records.size(), 2 == records.size());
+        ASSERT(Rec(ID_Q1) == records[0]);
+        ASSERT(Rec(ID_X)  == records[1]);
+
+        histogram.add(1.0);
+        histogram.add(2.0);
+        histogram.add(8.0);
+
+        const double MEDIAN = histogram.quantile(0.5);
+
+        Obj::appendRecords(&records, ID_X, histogram, quantiles, ids);
+        ASSERTV(records.size(), 5 == records.size());
+        ASSERT(Rec(ID_X,  3, 11.0,   1.0,    8.0)    == records[2]);
+        ASSERT(Rec(ID_Q1, 1, MEDIAN, MEDIAN, MEDIAN) == records[3]);
+        ASSERT(Rec(ID_Q2, 1, 8.0,    8.0,    8.0)    == records[4]);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: quantileName, defaultQuantiles
+        //
+        // Concerns:
+        // 1. `quantileName` appends `.p` followed by the significant digits
+        //    of the quantile (at least two) to the name.
+        //
+        // 2. `quantileName` names the quantile 1 `p100`, and rounds to six
+        //    digits.
+        //
+        // 3. `defaultQuantiles` loads the documented quantiles.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, verify `quantileName` for a
+        //    set of quantiles.  (C-1,2)
+        //
+        // 2. Verify the quantiles loaded by `defaultQuantiles`.  (C-3)
+        //
+        // Testing:
+        //   void quantileName(bsl::string *, const string_view&, double);
+        //   void defaultQuantiles(bsl::vector<double> *quantiles);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS: quantileName, defaultQuantiles"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        static const struct {
+            int         d_line;
+            double      d_quantile;
+            const char *d_expected;
+        } DATA[] = {
+            { L_, 0.0,        "m.p00"      },
+            { L_, 0.05,       "m.p05"      },
+            { L_, 0.1,        "m.p10"      },
+            { L_, 0.25,       "m.p25"      },
+            { L_, 0.5,        "m.p50"      },
+            { L_, 0.9,        "m.p90"      },
+            { L_, 0.95,       "m.p95"      },
+            { L_, 0.99,       "m.p99"      },
+            { L_, 0.999,      "m.p999"     },
+            { L_, 0.9999,     "m.p9999"    },
+            { L_, 0.123456,   "m.p123456"  },
+            { L_, 0.1234564,  "m.p123456"  },
+            { L_, 0.9999999,  "m.p100"     },
+            { L_, 1.0,        "m.p100"     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const double      QUANTILE = DATA[ti].d_quantile;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            bsl::string result("garbage");
+            Obj::quantileName(&result, "m", QUANTILE);
+
+            ASSERTV(LINE, result, EXPECTED, EXPECTED == result);
+        }
+
+        bsl::vector<double> quantiles;
+        quantiles.push_back(0.1);
+
+        Obj::defaultQuantiles(&quantiles);
+        ASSERTV(quantiles.size(), 4 == quantiles.size());
+        ASSERT(0.5   == quantiles[0]);
+        ASSERT(0.9   == quantiles[1]);
+        ASSERT(0.99  == quantiles[2]);
+        ASSERT(0.999 == quantiles[3]);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   The basic functionality of the component works.
+        //
+        // Plan:
+        //   Record values in a histogram metric, and collect its records.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        balm::MetricsManager manager(&ta);
+        {
+            Obj mX("A", "latency", &manager, &ta);
+
+            for (int i = 1; i <= 1000; ++i) {
+                mX.update(i * 0.001);
+            }
+
+            balm::MetricSample sample(&ta);
+            bsl::vector<Rec>   records(&ta);
+
+            manager.collectSample(&sample, &records, true);
+            ASSERTV(records.size(), 5 == records.size());
+
+            const Rec *rec = findRecord(
+                                records,
+                                manager.metricRegistry().getId("A",
+                                                               "latency.p99"));
+            ASSERT(0 != rec);
+            ASSERT(0 != rec && 0.980 <= rec->total() && rec->total() <= 1.0);
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,9 +4,14 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_new.h>
 
 namespace BloombergLP {
 
@@ -23,54 +28,54 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
+
+                      // -------------------------------
+                      // struct IntegerCollector::Stripe
+                      // -------------------------------
+
 // MANIPULATORS
-void IntegerCollector::loadAndReset(MetricRecord *records)
+void IntegerCollector::Stripe::drain(int                *count,
+                                     bsls::Types::Int64 *total,
+                                     int                *min,
+                                     int                *max)
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
-    }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
+    *count += d_count.swap(0);
+    *total += d_total.swap(0);
+    *min   =  bsl::min(*min, static_cast<int>(d_min.swap(k_DEFAULT_MIN)));
+    *max   =  bsl::max(*max, static_cast<int>(d_max.swap(k_DEFAULT_MAX)));
+}
+
+void IntegerCollector::Stripe::set(int count, int total, int min, int max)
+{
+    d_count = count;
+    d_total = total;
+    d_min   = min;
+    d_max   = max;
 }
 
 // ACCESSORS
-void IntegerCollector::load(MetricRecord *record) const
+void IntegerCollector::Stripe::combine(int                *count,
+                                       bsls::Types::Int64 *total,
+                                       int                *min,
+                                       int                *max) const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-    }
+    *count += d_count;
+    *total += d_total;
+    *min   =  bsl::min(*min, static_cast<int>(d_min));
+    *max   =  bsl::max(*max, static_cast<int>(d_max));
+}
+
+                           // ----------------------
+                           // class IntegerCollector
+                           // ----------------------
 
-    // Perform the conversion to double values outside of the lock.
+// PRIVATE ACCESSORS
+void IntegerCollector::loadRecord(MetricRecord       *record,
+                                  int                 count,
+                                  bsls::Types::Int64  total,
+                                  int                 min,
+                                  int                 max) const
+{
     record->metricId() = d_metricId;
     record->count()    = count;
     record->total()    = static_cast<double>(total);
@@ -82,6 +87,78 @@ void IntegerCollector::load(MetricRecord *record) const
                        : max;
 }
 
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    BSLMF_ASSERT(sizeof(Stripe) == bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                         d_stripeBuffer,
+                                         bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    d_stripes_p = reinterpret_cast<Stripe *>(d_stripeBuffer + offset);
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        new (d_stripes_p + i) Stripe();
+    }
+}
+
+IntegerCollector::~IntegerCollector()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].~Stripe();
+    }
+}
+
+// MANIPULATORS
+void IntegerCollector::reset()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].set(0, 0, k_DEFAULT_MIN, k_DEFAULT_MAX);
+    }
+}
+
+void IntegerCollector::loadAndReset(MetricRecord *records)
+{
+    // Note that a stripe having default aggregates does not alter the
+    // combined aggregates.
+
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].drain(&count, &total, &min, &max);
+    }
+    loadRecord(records, count, total, min, max);
+}
+
+void IntegerCollector::setCountTotalMinMax(int count,
+                                           int total,
+                                           int min,
+                                           int max)
+{
+    for (int i = 1; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].set(0, 0, k_DEFAULT_MIN, k_DEFAULT_MAX);
+    }
+    d_stripes_p[0].set(count, total, min, max);
+}
+
+// ACCESSORS
+void IntegerCollector::load(MetricRecord *record) const
+{
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].combine(&count, &total, &min, &max);
+    }
+    loadRecord(record, count, total, min, max);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -23,7 +23,7 @@ BSLS_IDENT("$Id: $")
 // to populate a `balm::MetricRecord` with the current state of the collector,
 // a `reset` operator to reset the current state of the integer collector, and
 // finally a combined `loadAndReset` method that performs both a load and a
-// reset in a single (atomic) operation.
+// reset (see {Performance} for its atomicity).
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -36,6 +36,26 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Performance
+///-----------
+// As with `balm::Collector`, the aggregates of a `balm::IntegerCollector` are
+// kept in `k_NUM_STRIPES` stripes, each occupying its own cache line, so that
+// concurrent updates from different threads do not contend for a single cache
+// line.  `update` and `accumulateCountTotalMinMax` are lock-free, and modify,
+// using atomic operations, only the stripe selected by the identifier of the
+// calling thread (see `bdlmt_stripeutil`), whereas `load`, `loadAndReset`,
+// `reset`, and `setCountTotalMinMax` visit every stripe.  The stripes start on
+// a cache-line boundary wherever the collector itself is allocated, so each
+// collector reserves `k_NUM_STRIPES + 1` cache lines for them, i.e.,
+// `sizeof(balm::IntegerCollector)` is a little over 1 KB on platforms having
+// 64-byte cache lines (and over 2 KB on those having 128-byte lines).
+//
+// Note that, because no lock is held, `load` and `loadAndReset` are not atomic
+// with respect to concurrent updates: each aggregate of each stripe is read
+// (and, by `loadAndReset`, reset) atomically, so every update is reported
+// exactly once, but the count of an update performed concurrently with
+// `loadAndReset` may be reported in one record and its value in the next.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -75,16 +95,16 @@ BSLS_IDENT("$Id: $")
 //     assert(3        == record.max());
 // ```
 
-#include <bsl_algorithm.h>
-
 #include <balscm_version.h>
 
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bdlmt_stripeutil.h>
+
+#include <bslmt_platform.h>
 
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -101,21 +121,105 @@ namespace balm {
 /// maximum aggregates of the associated measurement value.  The default
 /// value for the count is 0, the default value for the total is 0, the
 /// default value for the minimum is `k_DEFAULT_MIN`, and the default value
-/// for the maximum is `k_DEFAULT_MAX`.
+/// for the maximum is `k_DEFAULT_MAX`.  The aggregates are distributed
+/// over `k_NUM_STRIPES` stripes (see {Performance}).
 class IntegerCollector {
 
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_NUM_STRIPES = 16  // number of (cache-line sized) stripes over which
+                            // the aggregates are distributed
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// The aggregates updated by the threads whose identifiers map to the
+    /// same stripe.
+    struct Stripe {
+
+        // DATA
+        bsls::AtomicInt64 d_total;  // total of values across events
+        bsls::AtomicInt   d_count;  // aggregated count of events
+        bsls::AtomicInt   d_min;    // minimum value across events
+        bsls::AtomicInt   d_max;    // maximum value across events
+
+        char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                - sizeof(bsls::AtomicInt64)
+                                - 3 * sizeof(bsls::AtomicInt)];
+                                    // padding to a full cache line
+
+        // CREATORS
+
+        /// Create a stripe having default aggregates.
+        Stripe();
+
+        // MANIPULATORS
+
+        /// Atomically increment the count of this stripe by the specified
+        /// `count` and its total by the specified `total`, and lower its
+        /// minimum to the specified `min`, and raise its maximum to the
+        /// specified `max`, as needed.  Note that each aggregate is
+        /// modified atomically, but not the aggregates as a whole.
+        void accumulate(int count, int total, int min, int max);
+
+        /// Atomically reset each aggregate of this stripe to its default
+        /// value, and combine the values it held into the specified
+        /// `count`, `total`, `min`, and `max`.
+        void drain(int                *count,
+                   bsls::Types::Int64 *total,
+                   int                *min,
+                   int                *max);
+
+        /// Set the aggregates of this stripe to the specified `count`,
+        /// `total`, `min`, and `max`.
+        void set(int count, int total, int min, int max);
+
+        // ACCESSORS
+
+        /// Combine the aggregates of this stripe into the specified
+        /// `count`, `total`, `min`, and `max`.
+        void combine(int                *count,
+                     bsls::Types::Int64 *total,
+                     int                *min,
+                     int                *max) const;
+    };
+
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId  d_metricId;  // metric identifier
+
+    char      d_stripeBuffer[(k_NUM_STRIPES + 1)
+                                        * bslmt::Platform::e_CACHE_LINE_SIZE];
+                           // storage for the stripes, having a spare cache
+                           // line so that they can start on a cache-line
+                           // boundary wherever the collector is allocated
+
+    Stripe   *d_stripes_p; // `k_NUM_STRIPES` stripes, aligned on a
+                           // cache-line boundary within `d_stripeBuffer`
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Return a reference providing modifiable access to the stripe
+    /// assigned to the calling thread.
+    Stripe& currentStripe();
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `record` the id of the metric being
+    /// collected, and the specified `count`, `total`, `min`, and `max`,
+    /// converting the default minimum and maximum values as described for
+    /// `load`.
+    void loadRecord(MetricRecord       *record,
+                    int                 count,
+                    bsls::Types::Int64  total,
+                    int                 min,
+                    int                 max) const;
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -156,7 +260,11 @@ class IntegerCollector {
     /// maximum.  A minimum value of `k_DEFAULT_MIN` will populate a minimum
     /// value of `MetricRecord::k_DEFAULT_MIN` and a maximum value of
     /// `k_DEFAULT_MAX` will populate a maximum value of
-    /// `MetricRecord::k_DEFAULT_MAX`.
+    /// `MetricRecord::k_DEFAULT_MAX`.  Also note that each aggregated value
+    /// is loaded and reset as a single atomic operation, so that every
+    /// update is reported exactly once, but that the effect of an update
+    /// performed concurrently with this operation may be split between
+    /// `record` and the next record loaded (see {Performance}).
     void loadAndReset(MetricRecord *records);
 
     /// Increment the event count by 1, add the specified `value` to the
@@ -200,46 +308,68 @@ class IntegerCollector {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
-                           // ----------------------
-                           // class IntegerCollector
-                           // ----------------------
+                      // -------------------------------
+                      // struct IntegerCollector::Stripe
+                      // -------------------------------
 
 // CREATORS
 inline
-IntegerCollector::IntegerCollector(const MetricId& metricId)
-: d_metricId(metricId)
+IntegerCollector::Stripe::Stripe()
+: d_total(0)
 , d_count(0)
-, d_total(0)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
-, d_mutex()
 {
 }
 
+// MANIPULATORS
 inline
-IntegerCollector::~IntegerCollector()
+void IntegerCollector::Stripe::accumulate(int count,
+                                          int total,
+                                          int min,
+                                          int max)
 {
+    d_count.addRelaxed(count);
+    d_total.addRelaxed(total);
+
+    // The minimum and maximum are rarely modified once a few values have
+    // been collected, in which case they are only read.
+
+    int current = d_min.loadRelaxed();
+    while (min < current) {
+        const int previous = d_min.testAndSwapAcqRel(current, min);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+
+    current = d_max.loadRelaxed();
+    while (max > current) {
+        const int previous = d_max.testAndSwapAcqRel(current, max);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
 }
 
-// MANIPULATORS
+                           // ----------------------
+                           // class IntegerCollector
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
 inline
-void IntegerCollector::reset()
+IntegerCollector::Stripe& IntegerCollector::currentStripe()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
+    return d_stripes_p[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
 }
 
+// MANIPULATORS
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    currentStripe().accumulate(1, value, value, value);
 }
 
 inline
@@ -248,24 +378,7 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
-}
-
-inline
-void IntegerCollector::setCountTotalMinMax(int count,
-                                           int total,
-                                           int min,
-                                           int max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    currentStripe().accumulate(count, total, min, max);
 }
 
 // ACCESSORS
@@ -10,7 +10,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 // balm::StopwatchScopedGuard: guard for recording a metric for elapsed time
 //
-//@SEE_ALSO: balm_metricsmanager, balm_defaultmetricsmanager, balm_metric
+//@SEE_ALSO: balm_metricsmanager, balm_defaultmetricsmanager, balm_metric,
+//           balm_histogrammetric
 //
 //@DESCRIPTION: This component provides a scoped guard class intended to
 // simplify the task of recording (to a metric) the elapsed time of a block of
@@ -19,7 +20,10 @@ BSLS_IDENT("$Id: $")
 // units to report values in (by default, values are reported in seconds).  The
 // guard measures the elapsed time between its construction and destruction,
 // and on destruction records that elapsed time, in the indicated time units,
-// to the supplied metric.
+// to the supplied metric.  A guard may also be supplied a
+// `balm::HistogramMetric`, in which case the elapsed times are recorded in
+// the distribution of that metric, so that their quantiles (e.g., the 99th
+// percentile latency) are published (see `balm_histogrammetric`).
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -150,6 +154,8 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
+#include <balm_histogrammetric.h>
 #include <balm_metric.h>
 #include <balm_metricsmanager.h>
 
@@ -211,6 +217,11 @@ class StopwatchScopedGuard {
     Collector *d_collector_p;  // metric collector (held, not owned); may
                                     // be 0, but cannot be invalid
 
+    HistogramCollector
+                   *d_histogram_p;  // histogram collector (held, not owned);
+                                    // may be 0 (and is 0 if `d_collector_p`
+                                    // is not 0), but cannot be invalid
+
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
     StopwatchScopedGuard& operator=(const StopwatchScopedGuard&);
@@ -229,6 +240,18 @@ class StopwatchScopedGuard {
     explicit StopwatchScopedGuard(Metric *metric,
                                   Units   timeUnits = k_SECONDS);
 
+    /// Initialize this scoped guard to record elapsed time in the
+    /// distribution of the specified histogram `metric`.  Optionally
+    /// specify the `timeUnits` in which to report elapsed time.  If
+    /// `metric->isActive()` is `false`, this object will also be inactive
+    /// (i.e., will not record any values).  The behavior is undefined
+    /// unless `metric` is a valid address of a `HistogramMetric` object.
+    /// Note that `timeUnits` indicates the scale of the double value
+    /// reported by this guard, but does *not* affect the precision of the
+    /// elapsed time measurement.
+    explicit StopwatchScopedGuard(HistogramMetric *metric,
+                                  Units            timeUnits = k_SECONDS);
+
     /// Initialize this scoped guard to record elapsed time using the
     /// specified `collector`.  Optionally specify the `timeUnits` in which
     /// to report elapsed time.  If `collector` is 0 or
@@ -317,12 +340,26 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramMetric *metric,
+                                           Units            timeUnits)
+: d_stopwatch()
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogram_p(metric->isActive() ? metric->collector() : 0)
+{
+    if (d_histogram_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
                                            Units      timeUnits)
@@ -331,6 +368,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -343,6 +381,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -360,6 +399,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -377,6 +417,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -397,6 +438,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -410,7 +452,14 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * +d_timeUnits);
+        const double elapsedTime = d_stopwatch.elapsedTime() * +d_timeUnits;
+
+        if (d_collector_p) {
+            d_collector_p->update(elapsedTime);
+        }
+        else {
+            d_histogram_p->update(elapsedTime);
+        }
     }
 }
 
@@ -418,8 +467,11 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
-    return 0 != d_collector_p
-        && d_collector_p->metricId().category()->enabled();
+    if (d_collector_p) {
+        return d_collector_p->metricId().category()->enabled();       // RETURN
+    }
+    return 0 != d_histogram_p
+        && d_histogram_p->metricId().category()->enabled();
 }
 
 }  // close package namespace
@@ -52,6 +52,7 @@ using bsl::flush;
 // CREATORS
 // [ 4]  explicit balm::StopwatchScopedGuard(balm::Metric *metric);
 // [ 3]  explicit balm::StopwatchScopedGuard(balm::Collector *collector);
+// [ 8]  explicit balm::StopwatchScopedGuard(balm::HistogramMetric *, Units);
 // [ 4]  balm::StopwatchScopedGuard(const balm::MetricId&  ,
 //                                 balm::MetricsManager  * = 0);
 // [ 4]  balm::StopwatchScopedGuard(const char * ,
@@ -66,6 +67,7 @@ using bsl::flush;
 // [ 3] TESTING REPORTED TIME UNITS
 // [ 6] ELAPSED TIME VALUE
 // [ 7] USAGE
+// [ 8] HISTOGRAM METRIC
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -436,6 +438,89 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // HISTOGRAM METRIC
+        //
+        // Concerns:
+        // 1. A guard supplied a histogram metric records the elapsed time,
+        //    in the indicated time units, in the distribution of that
+        //    metric.
+        //
+        // 2. A guard supplied an inactive histogram metric is inactive, and
+        //    records no value.
+        //
+        // 3. A guard becomes inactive if the category of its histogram
+        //    metric is disabled.
+        //
+        // Plan:
+        // 1. Create guards for a histogram metric, with and without time
+        //    units, and verify the values loaded from the collector of the
+        //    metric.  (C-1)
+        //
+        // 2. Create a guard for a histogram metric having no metrics manager,
+        //    and verify `isActive`.  (C-2)
+        //
+        // 3. Disable the category of a histogram metric, and verify
+        //    `isActive` and that no value is recorded.  (C-3)
+        //
+        // Testing:
+        //   explicit balm::StopwatchScopedGuard(balm::HistogramMetric *, U);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HISTOGRAM METRIC\n"
+                          << "================\n";
+
+        MetricsManager         manager(Z);
+        balm::HistogramMetric  metric("A", "latency", &manager, Z);
+        bdlm::Histogram        histogram(Z);
+
+        ASSERT(metric.isActive());
+        {
+            Obj mX(&metric);  const Obj& X = mX;
+            ASSERT(X.isActive());
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.01));
+        }
+        {
+            Obj mX(&metric, Obj::k_MILLISECONDS);  const Obj& X = mX;
+            ASSERT(X.isActive());
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.01));
+        }
+
+        metric.collector()->loadAndReset(&histogram);
+        ASSERTV(histogram.count(), 2 == histogram.count());
+        ASSERTV(histogram.min(), 0.01 <= histogram.min());
+        ASSERTV(histogram.min(), histogram.min() < 1.0);
+        ASSERTV(histogram.max(), 10.0 <= histogram.max());
+        ASSERTV(histogram.max(), histogram.max() < 1000.0);
+
+        {
+            bslma::TestAllocator  da;
+            balm::HistogramMetric inactive("A", "inactive", 0, &da);
+
+            ASSERT(!inactive.isActive());
+
+            Obj mX(&inactive);  const Obj& X = mX;
+            ASSERT(!X.isActive());
+        }
+
+        {
+            Obj mX(&metric);  const Obj& X = mX;
+            ASSERT(X.isActive());
+
+            manager.setCategoryEnabled("A", false);
+            ASSERT(!X.isActive());
+        }
+        metric.collector()->load(&histogram);
+        ASSERTV(histogram.count(), 0 == histogram.count());
+        {
+            Obj mX(&metric);  const Obj& X = mX;
+            ASSERT(!X.isActive());
+        }
+        metric.collector()->load(&histogram);
+        ASSERTV(histogram.count(), 0 == histogram.count());
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
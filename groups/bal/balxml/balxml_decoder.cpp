@@ -5,7 +5,7 @@
 BSLS_IDENT_RCSID(balxml_decoder_cpp,"$Id$ $CSID$")
 
 #include <balxml_elementattribute.h>
-#include <balxml_minireader.h>      // for testing only
+#include <balxml_minireader.h>
 
 #include <bslalg_typetraits.h>
 
@@ -290,6 +290,30 @@ Decoder::open(const char *buffer, size_t length, const char *uri)
     return readTopElement();
 }
 
+int
+Decoder::openInPlace(char *buffer, bsl::size_t length, const char *uri)
+{
+    this->resetErrors();
+
+    uri = uri ? uri : "STREAM.xml";
+    d_sourceUri = uri;
+
+    // Only 'MiniReader' can parse its input in place.  Note that 'd_reader'
+    // is the UTF-8 validating wrapper if input validation was requested.
+
+    MiniReader *miniReader = dynamic_cast<MiniReader *>(d_reader);
+
+    const int rc = miniReader ? miniReader->openInPlace(buffer, length, uri)
+                              : d_reader->open(buffer, length, uri);
+    if (rc != 0) {
+        BALXML_DECODER_LOG_ERROR(this)
+                     << "Unable to open reader for input string."
+                     << BALXML_DECODER_LOG_END;
+        return -1;                                                    // RETURN
+    }
+    return readTopElement();
+}
+
 int
 Decoder::open(const char *filename)
 {
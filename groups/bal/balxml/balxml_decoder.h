@@ -25,7 +25,11 @@ BSLS_IDENT("$Id: $")
 // one of a set of `decode` method templates that decode a specified
 // value-semantic object from a specified stream or other input source.  The
 // caller may specify the input for `decode` as a file, an `bsl::istream`, an
-// `bsl::streambuf`, or a memory buffer.
+// `bsl::streambuf`, or a memory buffer.  A caller holding the input in a
+// modifiable, null-terminated memory buffer that it no longer needs may call
+// `decodeInPlace` instead, which, if the associated reader is a
+// `balxml::MiniReader`, parses that buffer without copying it (see
+// {`balxml_minireader`|In-Place Parsing}).
 //
 // A less common but more flexible usage model involves calling the `open` to
 // open the XML document from the specified input, then calling `decode` to
@@ -263,6 +267,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_formattingmode.h>
 #include <bdlat_nullablevaluefunctions.h>
 #include <bdlat_sequencefunctions.h>
+#include <bdlat_sequenceutil.h>
 #include <bdlat_typecategory.h>
 #include <bdlat_typename.h>
 #include <bdlat_valuetypefunctions.h>
@@ -513,6 +518,20 @@ class Decoder {
     /// non-zero otherwise.
     int open(const char *buffer, bsl::size_t length, const char *uri = 0);
 
+    /// Open the associated `Reader` object to read XML data, in place, from
+    /// the modifiable memory at the specified `buffer`, with the specified
+    /// `length`.  The (optionally) specified `uri` is used for identifying
+    /// the input document in error messages.  Return 0 on success and
+    /// non-zero otherwise.  If the associated reader is a `MiniReader` (and
+    /// `validateInputIsUtf8` is not set in the options of this decoder),
+    /// it is opened with `MiniReader::openInPlace`, which parses `buffer`
+    /// without copying it, modifying its contents; otherwise, it is opened
+    /// with `Reader::open` and `buffer` is not modified.  The behavior is
+    /// undefined unless `buffer[length]` is a null character, and `buffer`
+    /// remains valid, and is not otherwise modified, until `close` is
+    /// called.
+    int openInPlace(char *buffer, bsl::size_t length, const char *uri = 0);
+
     /// Open the associated `Reader` object (see `Reader::open`) to read XML
     /// data from the file with the specified `filename`.  Return 0 on
     /// success and non-zero otherwise.
@@ -555,6 +574,23 @@ class Decoder {
                TYPE        *object,
                const char  *uri = 0);
 
+    /// Decode the specified `object` of parameterized `TYPE` from the
+    /// modifiable memory at the specified `buffer` address, having the
+    /// specified `length`, parsing `buffer` in place if possible (see
+    /// `openInPlace`).  The (optionally) specified `uri` is used for
+    /// identifying the input document in error messages.  Return 0 on
+    /// success, and a non-zero value otherwise.  The contents of `buffer`
+    /// are unspecified after this call.  A compilation error will result
+    /// unless `TYPE` conforms to the requirements of a bdlat sequence or
+    /// choice, as described in `bdlat_sequencefunctions` and
+    /// `bdlat_choicefunctions`.  The behavior is undefined unless
+    /// `buffer[length]` is a null character.
+    template <class TYPE>
+    int decodeInPlace(char        *buffer,
+                      bsl::size_t  length,
+                      TYPE        *object,
+                      const char  *uri = 0);
+
     /// Decode the specified `object` of parameterized `TYPE` from the file
     /// with the specified `filename`.  Return 0 on success, and a non-zero
     /// value otherwise.  A compilation error will result unless `TYPE`
@@ -2105,6 +2141,26 @@ int Decoder::decode(const char  *buffer,
     return ret;
 }
 
+template <class TYPE>
+int Decoder::decodeInPlace(char        *buffer,
+                           bsl::size_t  length,
+                           TYPE        *object,
+                           const char  *uri)
+{
+    if (this->openInPlace(buffer, length, uri) != 0) {
+
+        return this->errorCount();                                    // RETURN
+    }
+
+    int ret = validateTopElement(object);
+    if (0 == ret) {
+        ret = this->decode(object);
+    }
+
+    this->close();
+    return ret;
+}
+
 template <class TYPE>
 int Decoder::decode(const char *filename, TYPE *object)
 {
@@ -2508,10 +2564,20 @@ int Decoder_SequenceContext<TYPE>::parseAttribute(const char  *name,
 
     Decoder_ParseAttribute visitor(decoder, name, value, lenValue);
 
-    if (0 != bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                          visitor,
-                                                          name,
-                                                          lenName)) {
+    int       attributeId;
+    const int rc = 0 == bdlat::SequenceUtil::lookupIndexedAttributeId(
+                                                                  &attributeId,
+                                                                  *d_object_p,
+                                                                  name,
+                                                                  lenName)
+                 ? bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
+                                                                visitor,
+                                                                attributeId)
+                 : bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
+                                                                visitor,
+                                                                name,
+                                                                lenName);
+    if (0 != rc) {
         if (visitor.failed()) {
             return k_FAILURE;                                         // RETURN
         }
@@ -2529,6 +2595,19 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
 
     const int lenName = static_cast<int>(bsl::strlen(elementName));
 
+    Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
+
+    int attributeId;
+    if (0 == bdlat::SequenceUtil::lookupIndexedAttributeId(&attributeId,
+                                                           *d_object_p,
+                                                           elementName,
+                                                           lenName)) {
+        return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
+                                                            visitor,
+                                                            attributeId);
+                                                                      // RETURN
+    }
+
     if (decoder->options()->skipUnknownElements()
      && false == bdlat_SequenceFunctions::hasAttribute(*d_object_p,
                                                        elementName,
@@ -2539,8 +2618,6 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
         return unknownElement.beginParse(decoder);                    // RETURN
     }
 
-    Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
-
     return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
                                                         visitor,
                                                         elementName,
@@ -3062,6 +3139,18 @@ int Decoder_ParseObject::executeImp(
     enum { k_FAILURE = -1 };
 
     if (formattingMode & bdlat_FormattingMode::e_UNTAGGED) {
+        int attributeId;
+        if (0 == bdlat::SequenceUtil::lookupIndexedAttributeId(
+                                               &attributeId,
+                                               *object,
+                                               d_elementName_p,
+                                               static_cast<int>(d_lenName))) {
+            return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                                *this,
+                                                                attributeId);
+                                                                      // RETURN
+        }
+
         if (d_decoder->options()->skipUnknownElements()
          && false == bdlat_SequenceFunctions::hasAttribute(
                                                 *object,
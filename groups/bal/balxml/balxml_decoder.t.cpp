@@ -186,6 +186,8 @@ namespace Test = s_baltst;
 // [11] int balxml::Decoder::decode(sbuf*, TYPE, ostrm&, ostrm&, b_A*);
 // [11] int balxml::Decoder::decode(istrm&, TYPE, b_A*);
 // [11] int balxml::Decoder::decode(istrm&, TYPE, ostrm&, ostrm&, b_A*);
+// [25] int openInPlace(char *buffer, size_t length, const char *uri);
+// [25] int decodeInPlace(char *buffer, size_t length, TYPE *object, uri);
 // [15] void setNumUnknownElementsSkipped(int value);
 // [15] int numUnknownElementsSkipped() const;
 // [ 3] balxml::Decoder_SelectContext
@@ -203,6 +205,7 @@ namespace Test = s_baltst;
 // [22] REPRODUCE SCENARIO FROM DRQS 169438741
 // [23] REPRODUCE SCENARIO FROM DRQS 171405619
 // [24] DECODING CUSTOMIZED HEX AND BASE64 BINARY DATA
+// [25] DECODING IN PLACE
 // [-1] TESTING VALID & INVALID UTF-8: e_STRING
 // [-1] TESTING VALID & INVALID UTF-8: e_STREAMBUF
 // [-1] TESTING VALID & INVALID UTF-8: e_ISTREAM
@@ -2735,9 +2738,10 @@ struct DefaultTag {
 };
 
 /// This tag type may be used as the `TAG_TYPE` of a `TestTaggedType` in
-/// order to overload the `sequenceManipulateAttribute` and
-/// `typeCategoryManipulateSequence` operations of its underlying
-/// `VALUE_TYPE` with implementations that return non-zero.
+/// order to overload the `sequenceManipulateAttribute` (by name and by id)
+/// and `typeCategoryManipulateSequence` operations of its underlying
+/// `VALUE_TYPE` with implementations that return non-zero.  Note that the
+/// decoder manipulates the attributes of basic sequences by id.
 struct FailToManipulateSequenceTag {
 };
 
@@ -2751,6 +2755,15 @@ int bdlat_sequenceManipulateAttribute(
     return -1;
 }
 
+template <class VALUE_TYPE, class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(
+          s_baltst::TestTaggedValue<FailToManipulateSequenceTag, VALUE_TYPE> *,
+          MANIPULATOR&,
+          int)
+{
+    return -1;
+}
+
 template <class VALUE_TYPE, class MANIPULATOR>
 int bdlat_typeCategoryManipulateSequence(
     s_baltst::TestTaggedValue<FailToManipulateSequenceTag,
@@ -4439,6 +4452,141 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 25: {
+        // --------------------------------------------------------------------
+        // DECODING IN PLACE
+        //
+        // Concerns:
+        // 1. `decodeInPlace` produces the same object as `decode` from a
+        //    non-modifiable buffer, and reports the same failures.
+        //
+        // 2. If the reader is a `balxml::MiniReader`, the buffer is parsed in
+        //    place (and therefore modified), and the reader does not allocate
+        //    its internal parse buffer.
+        //
+        // 3. If `validateInputIsUtf8` is set, the buffer is read through the
+        //    validating reader, and is not modified.
+        //
+        // Plan:
+        // 1. Decode valid and invalid documents with `decode` and with
+        //    `decodeInPlace`, using readers that supply memory from distinct
+        //    test allocators, and compare the results, the contents of the
+        //    buffers, and the memory allocated by the readers.  (C-1..2)
+        //
+        // 2. Repeat P-1 with `validateInputIsUtf8` set.  (C-3)
+        //
+        // Testing:
+        //   int openInPlace(char *buffer, size_t length, const char *uri);
+        //   int decodeInPlace(char *buffer, size_t length, TYPE *object, uri);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODING IN PLACE"
+                          << "\n================="
+                          << endl;
+
+        enum { k_READER_BUFFER_SIZE = 64 * 1024 };
+
+        const struct {
+            int         d_line;
+            const char *d_input_p;
+            bool        d_isValid;
+        } DATA[] = {
+            { L_, "<Employee>"
+                  "<name>Bob</name>"
+                  "<homeAddress>"
+                  "<street>Some Street</street>"
+                  "<city>Some City</city>"
+                  "<state>Some State</state>"
+                  "</homeAddress>"
+                  "<age>21</age>"
+                  "</Employee>",                                    true  },
+            { L_, "<?xml version='1.0' encoding='UTF-8'?>\n"
+                  "<Employee>\n"
+                  "  <name>A &amp; B</name>\n"
+                  "  <age>35</age>\n"
+                  "</Employee>\n",                                  true  },
+            { L_, "<Employee><name>Bob</name><age>21</age>",        false },
+            { L_, "<Employee><name>Bob</nam></Employee>",           false },
+            { L_, "<Employee><age>x</age></Employee>",              false },
+        };
+        const int NUM_DATA = sizeof(DATA) / sizeof(DATA[0]);
+
+        for (int ui = 0; ui < 2; ++ui) {
+            const bool VALIDATE_UTF8 = 1 == ui;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int         LINE     = DATA[i].d_line;
+                const bsl::string INPUT    = DATA[i].d_input_p;
+                const bool        IS_VALID = DATA[i].d_isValid;
+
+                if (veryVerbose) { T_ P_(VALIDATE_UTF8) P(LINE) }
+
+                balxml::DecoderOptions options;
+                options.setValidateInputIsUtf8(VALIDATE_UTF8);
+
+                bslma::TestAllocator copyAllocator("copy",
+                                                   veryVeryVeryVerbose);
+                bslma::TestAllocator inPlaceAllocator("inPlace",
+                                                      veryVeryVeryVerbose);
+
+                balxml::MiniReader copyReader(k_READER_BUFFER_SIZE,
+                                              &copyAllocator);
+                balxml::MiniReader inPlaceReader(k_READER_BUFFER_SIZE,
+                                                 &inPlaceAllocator);
+                balxml::ErrorInfo  errorInfo;
+
+                s_baltst::Employee fromCopy;
+                s_baltst::Employee fromInPlace;
+
+                int copyRc;
+                {
+                    balxml::Decoder decoder(&options,
+                                            &copyReader,
+                                            &errorInfo,
+                                            0,
+                                            0);
+                    copyRc = decoder.decode(INPUT.data(),
+                                            INPUT.size(),
+                                            &fromCopy);
+                }
+
+                bsl::vector<char> buffer(INPUT.begin(), INPUT.end());
+                buffer.push_back('\0');
+
+                int inPlaceRc;
+                {
+                    balxml::Decoder decoder(&options,
+                                            &inPlaceReader,
+                                            &errorInfo,
+                                            0,
+                                            0);
+                    inPlaceRc = decoder.decodeInPlace(buffer.data(),
+                                                      INPUT.size(),
+                                                      &fromInPlace);
+                }
+
+                ASSERTV(LINE, VALIDATE_UTF8, copyRc,
+                        IS_VALID == (0 == copyRc));
+                ASSERTV(LINE, VALIDATE_UTF8, inPlaceRc,
+                        IS_VALID == (0 == inPlaceRc));
+
+                if (IS_VALID) {
+                    ASSERTV(LINE, VALIDATE_UTF8, fromCopy == fromInPlace);
+                }
+
+                const bool MODIFIED =
+                          0 != bsl::memcmp(buffer.data(), INPUT.data(),
+                                           INPUT.size());
+                ASSERTV(LINE, VALIDATE_UTF8, MODIFIED == !VALIDATE_UTF8);
+
+                ASSERTV(LINE, VALIDATE_UTF8, copyAllocator.numBytesMax(),
+                        k_READER_BUFFER_SIZE <= copyAllocator.numBytesMax());
+                ASSERTV(LINE, VALIDATE_UTF8, inPlaceAllocator.numBytesMax(),
+                        VALIDATE_UTF8 == (k_READER_BUFFER_SIZE <=
+                                            inPlaceAllocator.numBytesMax()));
+            }
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // DECODING CUSTOMIZED HEX AND BASE64 BINARY DATA
@@ -407,7 +407,6 @@ MiniReader::MiniReader(bslma::Allocator *basicAllocator)
 , d_options         (0)
 {
     d_activeNodes.resize(k_DEFAULT_DEPTH);
-    d_parseBuf.resize(d_readSize);
 }
 
 MiniReader::MiniReader(int bufSize, bslma::Allocator *basicAllocator)
@@ -455,7 +454,6 @@ MiniReader::MiniReader(int bufSize, bslma::Allocator *basicAllocator)
     }
 
     d_activeNodes.resize(k_DEFAULT_DEPTH);
-    d_parseBuf.resize(d_readSize);
 }
 
 MiniReader::~MiniReader()
@@ -553,7 +551,7 @@ void MiniReader::close()
     d_state     = ST_CLOSED;
 }
 
-int MiniReader::doOpen(const char *url, const char *encoding)
+void MiniReader::doOpen(const char *url, const char *encoding)
 {
     // reset active nodes stack
     d_activeNodesCount = 0;
@@ -564,16 +562,8 @@ int MiniReader::doOpen(const char *url, const char *encoding)
     d_ownPrefixes.reset();
     d_ownNamespaces.reset();
 
-    // clear input source
-    d_parseBuf.resize(d_readSize);
-    d_parseBuf[0] = '\0';
     d_streamOffset = 0;
-    d_flags       = 0;
-
-    d_startPtr   = &d_parseBuf.front();
-    d_endPtr     = d_startPtr;
-    d_scanPtr    = d_startPtr;
-    d_markPtr    = d_startPtr;
+    d_flags        = 0;
 
     d_lineNum    = 0;
     d_lineOffset = 0;
@@ -583,8 +573,20 @@ int MiniReader::doOpen(const char *url, const char *encoding)
 
     d_baseURL  = nonNullStr(url);
     d_encoding = nonNullStr(encoding);
+}
 
-    return (readInput() > 0) ? 0 : -1;
+void MiniReader::resetParseBuffer()
+{
+    // The parse buffer is allocated only by the first 'open' that copies its
+    // input, so that a reader used only by 'openInPlace' never allocates it.
+
+    d_parseBuf.resize(d_readSize);
+    d_parseBuf[0] = '\0';
+
+    d_startPtr = &d_parseBuf.front();
+    d_endPtr   = d_startPtr;
+    d_scanPtr  = d_startPtr;
+    d_markPtr  = d_startPtr;
 }
 
 int MiniReader::open(const char *buffer,
@@ -603,7 +605,9 @@ int MiniReader::open(const char *buffer,
     d_memStream = buffer;
     d_memSize = size;
 
-    return doOpen(url, encoding);
+    doOpen(url, encoding);
+    resetParseBuffer();
+    return (readInput() > 0) ? 0 : -1;
 }
 
 int MiniReader::open(const char *filename, const char *encoding)
@@ -636,7 +640,40 @@ int MiniReader::open(bsl::streambuf *stream,
 
     d_streamBuf = stream;
 
-    return doOpen(url, encoding);
+    doOpen(url, encoding);
+    resetParseBuffer();
+    return (readInput() > 0) ? 0 : -1;
+}
+
+int MiniReader::openInPlace(char        *buffer,
+                            bsl::size_t  size,
+                            const char  *url,
+                            const char  *encoding)
+{
+    if (d_state != ST_CLOSED) {
+        return -1;                                                    // RETURN
+    }
+
+    if (buffer == 0 || size == 0) {
+        return -1;                                                    // RETURN
+    }
+
+    BSLS_ASSERT(0 == buffer[size]);
+
+    doOpen(url, encoding);
+
+    // The whole input is already present, and null-terminated, so scan it
+    // directly.  Setting 'FLG_READ_EOF' ensures that 'readInput' never
+    // copies into (or rebases pointers onto) 'd_parseBuf', which is therefore
+    // neither sized nor used.
+
+    d_startPtr = buffer;
+    d_endPtr   = buffer + size;
+    d_scanPtr  = d_startPtr;
+    d_markPtr  = d_startPtr;
+    d_flags   |= FLG_READ_EOF;
+
+    return 0;
 }
 
 // ACCESSORS
@@ -33,6 +33,21 @@ BSLS_IDENT("$Id: $")
 // To get stricter data validation, clients should use a concrete
 // implementation of a validating reader (such as `a_xercesc::Reader`) instead.
 //
+// In-Place Parsing
+// - - - - - - - -
+// `balxml::MiniReader` terminates the names and values that it returns by
+// writing null characters into its input, and returns pointers into that
+// input.  When it is opened on a stream or on a non-modifiable buffer, it
+// therefore copies its input, a block at a time, into an internal buffer,
+// moving the unprocessed part of each block to the front of the buffer
+// before reading the next one.  When the whole document is already held in
+// a modifiable buffer, the `openInPlace` method avoids this copying: the
+// reader parses the supplied buffer directly, without allocating its
+// internal buffer, and the strings returned by its accessors point into (and
+// remain valid for the lifetime of) the supplied buffer.  Note that the
+// contents of the buffer are modified by the parse.  `balxml::Decoder`
+// provides `openInPlace` and `decodeInPlace` methods that use this method.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -482,7 +497,15 @@ class MiniReader :  public Reader {
     void  rebasePointers(const char *newBase, size_t newLength);
 
     int   readInput();
-    int   doOpen(const char *url, const char *encoding);
+
+    /// Reset the state of this reader, other than its input source, for a
+    /// new parse, using the specified `url` and `encoding`.
+    void  doOpen(const char *url, const char *encoding);
+
+    /// Size the internal parse buffer for reading, and position this reader
+    /// at the start of that (empty) buffer, for a parse whose input is
+    /// copied into it by `readInput`.
+    void  resetParseBuffer();
 
     /// Return the character at the current position, and zero if the end of
     /// stream was reached.
@@ -636,6 +659,22 @@ class MiniReader :  public Reader {
              const char     *url = 0,
              const char     *encoding = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set up the reader for parsing, in place, the data contained in the
+    /// specified modifiable (XML) `buffer` of the specified `size`, set the
+    /// base URL to the optionally specified `url`, and set the encoding
+    /// value to the optionally specified `encoding`, as for the `open`
+    /// method taking a non-modifiable buffer.  Return 0 on success and
+    /// non-zero otherwise.  The reader does not copy `buffer`, but writes
+    /// into it as the parse progresses (see {In-Place Parsing}), and the
+    /// strings returned by its accessors point into it.  It is an error to
+    /// open a reader that is already open.  The behavior is undefined
+    /// unless `buffer[size]` is a null character, and `buffer` remains
+    /// valid, and is not otherwise modified, until `close` is called.
+    int openInPlace(char        *buffer,
+                    bsl::size_t  size,
+                    const char  *url = 0,
+                    const char  *encoding = 0);
+
     /// Close the reader.  Most, but not all state is reset.  Specifically,
     /// the XML resource resolver and the prefix stack remain.  The prefix
     /// stack shall be returned to the stack depth it had when
@@ -14,6 +14,7 @@
 #include <bsla_fallthrough.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstring.h>     // strlen()
@@ -23,6 +24,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using bsl::cout;
@@ -101,10 +103,12 @@ using bsl::flush;
 // [15] ErrorInfo::columnNumber();
 //-----------------------------------------------------------------------------
 // [-1] INTERACTIVE TEST
+// [-2] PERFORMANCE TEST
 // [ 1] BREATHING TEST
 // [15] UNEXPECTED EOF TEST
 // [16] FUZZ TEST
-// [17] USAGE EXAMPLE
+// [17] openInPlace(char *buffer, size_t size, url, encoding)
+// [18] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -862,6 +866,40 @@ bsl::ostream& operator<<(bsl::ostream& stream, Mode mode)
     return stream;
 }
 
+/// Advance the specified `reader` through the rest of its input, and append
+/// to the specified `description` a line describing each node visited
+/// (including its attributes and position), followed by a line holding the
+/// status returned by the final call to `advanceToNextNode` and the message
+/// of the reader's error information.
+void describeNodes(bsl::string *description, balxml::Reader *reader)
+{
+    bsl::ostringstream out;
+
+    int rc;
+    while (0 == (rc = reader->advanceToNextNode())) {
+        out << reader->nodeType()
+            << ' ' << CHK(reader->nodeName())
+            << ' ' << CHK(reader->nodeValue())
+            << ' ' << CHK(reader->nodeNamespaceUri())
+            << ' ' << reader->nodeDepth()
+            << ' ' << reader->isEmptyElement()
+            << ' ' << reader->getLineNumber()
+            << ':' << reader->getColumnNumber();
+
+        for (int i = 0; i < reader->numAttributes(); ++i) {
+            balxml::ElementAttribute attribute;
+            reader->lookupAttribute(&attribute, i);
+            out << ' ' << CHK(attribute.qualifiedName())
+                << '=' << CHK(attribute.value())
+                << ' ' << CHK(attribute.namespaceUri());
+        }
+        out << '\n';
+    }
+    out << rc << ' ' << reader->errorInfo().message() << '\n';
+
+    description->append(out.str());
+}
+
 int findLoc(int                *line,
             int                *column,
             const bsl::string&  pattern,
@@ -905,7 +943,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -949,6 +987,145 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 17: {
+        // --------------------------------------------------------------------
+        // OPEN IN PLACE
+        //
+        // Concerns:
+        // 1. A reader opened with `openInPlace` visits the same nodes, with
+        //    the same names, values, attributes, and positions, and reports
+        //    the same errors, as a reader opened on a copy of the same input
+        //    with `open`.
+        //
+        // 2. The names and values returned point into the supplied buffer.
+        //
+        // 3. `openInPlace` fails for a null or empty buffer, and for a reader
+        //    that is already open, and a reader can be reopened after
+        //    `close`.
+        //
+        // Plan:
+        // 1. For a set of well-formed and ill-formed documents, including
+        //    documents much larger than the reader's internal buffer, parse
+        //    each document with both `open` and `openInPlace`, and compare a
+        //    description of every node visited.  (C-1)
+        //
+        // 2. Check that the name of each element node is within the buffer.
+        //    (C-2)
+        //
+        // 3. Call `openInPlace` with invalid arguments, and twice in a row.
+        //    (C-3)
+        //
+        // Testing:
+        //   openInPlace(char *buffer, size_t size, url, encoding)
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nOPEN IN PLACE"
+                               << "\n=============" << bsl::endl;
+
+        bsl::vector<bsl::string> documents;
+        documents.push_back(
+           "<?xml version='1.0' encoding='UTF-8'?>\n"
+           "<directory-entry xmlns:dir='http://bloomberg.com/schemas/dir'>\n"
+           "    <name>John &amp; Jane Smith</name>\n"
+           "    <phone dir:phonetype='cell'>212-318-2000</phone>\n"
+           "    <!-- comment -->\n"
+           "    <![CDATA[&lt;123&#240;&gt;]]>\n"
+           "    <address/>\n"
+           "</directory-entry>\n");
+        documents.push_back("<a><b></a>");
+        documents.push_back("<a>text");
+        documents.push_back("text");
+        documents.push_back("<a x='1' x='2'/>");
+        documents.push_back("<a><b:c/></a>");
+
+        bsl::string document;
+        ggg(document, 3, 3);
+        documents.push_back(document);
+        ggg(document, 200, 6);
+        documents.push_back(document);
+
+        for (bsl::size_t i = 0; i < documents.size(); ++i) {
+            if (veryVerbose) { T_ P_(i) P(documents[i].size()) }
+
+            bsl::string expected;
+            {
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+                Obj                       reader;
+                reader.setPrefixStack(&prefixStack);
+
+                ASSERTV(i, 0 == reader.open(documents[i].data(),
+                                            documents[i].size()));
+                describeNodes(&expected, &reader);
+            }
+
+            bsl::string buffer(documents[i]);
+            bsl::string actual;
+            {
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+                Obj                       reader;
+                reader.setPrefixStack(&prefixStack);
+
+                ASSERTV(i, 0 == reader.openInPlace(&buffer[0],
+                                                   buffer.size()));
+                describeNodes(&actual, &reader);
+            }
+
+            ASSERTV(i, expected, actual, expected == actual);
+        }
+
+        if (verbose) bsl::cout << "\tNames point into the buffer." << endl;
+        {
+            bsl::string buffer;
+            ggg(buffer, 10, 3);
+
+            balxml::NamespaceRegistry namespaces;
+            balxml::PrefixStack       prefixStack(&namespaces);
+            Obj                       reader;
+            reader.setPrefixStack(&prefixStack);
+
+            ASSERT(0 == reader.openInPlace(&buffer[0], buffer.size()));
+
+            const char *begin = buffer.data();
+            const char *end   = begin + buffer.size();
+
+            int numElements = 0;
+            while (0 == reader.advanceToNextNode()) {
+                if (balxml::Reader::e_NODE_TYPE_ELEMENT == reader.nodeType()) {
+                    ASSERT(begin <= reader.nodeName());
+                    ASSERT(end   >  reader.nodeName());
+                    ++numElements;
+                }
+            }
+            ASSERT(0 < numElements);
+        }
+
+        if (verbose) bsl::cout << "\tInvalid arguments." << endl;
+        {
+            char buffer[] = "<a/>";
+
+            Obj reader;
+
+            ASSERT(0 != reader.openInPlace(0, 0));
+            ASSERT(0 != reader.openInPlace(buffer, 0));
+            ASSERT(!reader.isOpen());
+
+            ASSERT(0 == reader.openInPlace(buffer, sizeof buffer - 1));
+            ASSERT(reader.isOpen());
+            ASSERT(0 != reader.openInPlace(buffer, sizeof buffer - 1));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("a", reader.nodeName()));
+            reader.close();
+
+            char other[] = "<b/>";
+            ASSERT(0 == reader.openInPlace(other, sizeof other - 1));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("b", reader.nodeName()));
+            reader.close();
+        }
+      } break;
+
       case 16: {
         // --------------------------------------------------------------------
         // FUZZ TEST
@@ -4462,6 +4639,61 @@ int main(int argc, char *argv[])
         ASSERT(1 == reader.getColumnNumber());
 
       } break;
+
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Parsing a document in place is faster than parsing a copy of it
+        //    read a block at a time.
+        //
+        // Plan:
+        // 1. Parse a large generated document repeatedly with `open` and with
+        //    `openInPlace`, and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE TEST"
+                               << "\n================" << bsl::endl;
+
+        const int NUM_ITERATIONS = 20;
+
+        bsl::string document;
+        ggg(document, 2000, 6);
+
+        for (int inPlace = 0; inPlace < 2; ++inPlace) {
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bsl::string buffer(document);
+
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+                Obj                       reader;
+                reader.setPrefixStack(&prefixStack);
+
+                int rc = inPlace
+                       ? reader.openInPlace(&buffer[0], buffer.size())
+                       : reader.open(buffer.data(), buffer.size());
+                ASSERT(0 == rc);
+
+                while (0 == (rc = reader.advanceToNextNode())) {
+                }
+                ASSERT(1 == rc);
+            }
+
+            timer.stop();
+
+            bsl::cout << (inPlace ? "openInPlace: " : "open:        ")
+                      << static_cast<double>(document.size()) *
+                                     NUM_ITERATIONS / timer.elapsedTime() / 1e6
+                      << " MB/s" << bsl::endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
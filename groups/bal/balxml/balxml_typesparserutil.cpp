@@ -9,6 +9,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_numericparseutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -20,6 +22,7 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <bsl_cstring.h>
 #include <bsl_iterator.h>
 #include <bsl_limits.h>
+#include <bsl_string_view.h>
 #include <bsl_cerrno.h>
 #include <bsl_cfloat.h>
 #include <bsl_cmath.h>
@@ -168,6 +171,30 @@ int parseDouble(double     *result,
         return BAEXML_FAILURE;                                        // RETURN
     }
 
+    // Try the locale-independent parser first, which needs no null-terminated
+    // copy of 'input'.  Only if it does not consume all of 'input' (e.g., on
+    // leading whitespace or a hexadecimal number, which 'strtod' accepts) do
+    // we fall back on 'parseDoubleImpl'.
+
+    const bsl::string_view inputView(input, inputLength);
+    if (!formatDecimal
+     || bsl::string_view::npos == inputView.find_first_not_of(
+                                                          "+-.0123456789")) {
+        double           value;
+        bsl::string_view rest;
+        const int        rc = bdlb::NumericParseUtil::parseDouble(&value,
+                                                                  &rest,
+                                                                  inputView);
+        if ((0 == rc || ERANGE == rc) && rest.empty()) {
+            if (ERANGE == rc && (value < -1.0 || 1.0 < value)) {
+                // Overflow is an error, underflow is OK (zero).
+                return BAEXML_FAILURE;                                // RETURN
+            }
+            *result = value;
+            return BAEXML_SUCCESS;                                    // RETURN
+        }
+    }
+
     if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
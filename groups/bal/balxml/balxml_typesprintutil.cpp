@@ -150,6 +150,7 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 // do they seee '5e-324' in their printout when '<limits.h>' from C clearly has
 // 'DBL_TRUE_MIN' defined as '4.9406564584124654e-324'.
 
+#include <bdlb_numericformatutil.h>
 #include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
@@ -162,12 +163,14 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_iterator.h>
 #include <bsl_limits.h>
+#include <bsl_locale.h>
 
 namespace BloombergLP {
 
@@ -1015,6 +1018,59 @@ bsl::ostream& printDecimalImpl(bsl::ostream&            stream,
     return stream;
 }
 
+/// Return `true` if the specified `stream` formats integers exactly as
+/// `bslalg::NumericFormatterUtil::toChars` does, and `false` otherwise.
+bool hasDefaultIntegerFormat(const bsl::ostream& stream)
+{
+    const bsl::ios_base::fmtflags k_FLAGS = bsl::ios_base::basefield
+                                          | bsl::ios_base::showpos
+                                          | bsl::ios_base::showbase
+                                          | bsl::ios_base::uppercase;
+
+    return bsl::ios_base::dec == (stream.flags() & k_FLAGS)
+        && 0 == stream.width()
+        && stream.getloc() == bsl::locale::classic();
+}
+
+/// Write the values of the specified `object`, separated by single spaces,
+/// into the specified `stream`, formatting as many values at a time as fit
+/// into a local buffer, and return `stream`.
+template <class TYPE>
+bsl::ostream& printNumberList(bsl::ostream&            stream,
+                              const bsl::vector<TYPE>& object)
+{
+    typedef bslalg::NumericFormatterUtil NfUtil;
+    typedef bdlb::NumericFormatUtil      Util;
+
+    enum {
+        k_BUFFER_SIZE = 2048,
+        k_CHUNK_SIZE  = k_BUFFER_SIZE /
+                                  (NfUtil::ToCharsMaxLength<TYPE>::k_VALUE + 1)
+    };
+
+    char              buffer[k_BUFFER_SIZE];
+    const TYPE       *values    = object.data();
+    const bsl::size_t numValues = object.size();
+
+    for (bsl::size_t i = 0; i < numValues; i += k_CHUNK_SIZE) {
+        const bsl::size_t count = bsl::min<bsl::size_t>(k_CHUNK_SIZE,
+                                                        numValues - i);
+        const char *end = Util::formatArray(buffer,
+                                            buffer + sizeof buffer,
+                                            values + i,
+                                            count,
+                                            " ");
+        BSLS_ASSERT(0 != end);
+
+        if (0 != i) {
+            stream.put(' ');
+        }
+        stream.write(buffer, end - buffer);
+    }
+
+    return stream;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -1069,6 +1125,95 @@ TypesPrintUtil_Imp::printHex(bsl::ostream&              stream,
                                           object.end());
 }
 
+// LIST FUNCTIONS
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<int>&         object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array)
+{
+    if (u::hasDefaultIntegerFormat(stream)) {
+        return u::printNumberList(stream, object);                    // RETURN
+    }
+
+    return printList<bsl::vector<int> >(stream,
+                                        object,
+                                        encoderOptions,
+                                        bdlat_TypeCategory::Array());
+}
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<unsigned>&    object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array)
+{
+    if (u::hasDefaultIntegerFormat(stream)) {
+        return u::printNumberList(stream, object);                    // RETURN
+    }
+
+    return printList<bsl::vector<unsigned> >(stream,
+                                             object,
+                                             encoderOptions,
+                                             bdlat_TypeCategory::Array());
+}
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                        bsl::ostream&                           stream,
+                        const bsl::vector<bsls::Types::Int64>&  object,
+                        const EncoderOptions                   *encoderOptions,
+                        bdlat_TypeCategory::Array)
+{
+    if (u::hasDefaultIntegerFormat(stream)) {
+        return u::printNumberList(stream, object);                    // RETURN
+    }
+
+    return printList<bsl::vector<bsls::Types::Int64> >(
+                                                 stream,
+                                                 object,
+                                                 encoderOptions,
+                                                 bdlat_TypeCategory::Array());
+}
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                        bsl::ostream&                           stream,
+                        const bsl::vector<bsls::Types::Uint64>& object,
+                        const EncoderOptions                   *encoderOptions,
+                        bdlat_TypeCategory::Array)
+{
+    if (u::hasDefaultIntegerFormat(stream)) {
+        return u::printNumberList(stream, object);                    // RETURN
+    }
+
+    return printList<bsl::vector<bsls::Types::Uint64> >(
+                                                 stream,
+                                                 object,
+                                                 encoderOptions,
+                                                 bdlat_TypeCategory::Array());
+}
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<float>&       object,
+                                const EncoderOptions           *,
+                                bdlat_TypeCategory::Array)
+{
+    // `printDefault` writes `float` values with `toChars` regardless of the
+    // stream state, so they can always be formatted in bulk.
+
+    return u::printNumberList(stream, object);
+}
+
+bsl::ostream& TypesPrintUtil_Imp::printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<double>&      object,
+                                const EncoderOptions           *,
+                                bdlat_TypeCategory::Array)
+{
+    return u::printNumberList(stream, object);
+}
+
 // TEXT FUNCTIONS
 
 bsl::ostream&
@@ -723,6 +723,40 @@ struct TypesPrintUtil_Imp {
                                    const EncoderOptions *encoderOptions,
                                    ANY_CATEGORY);
 
+    /// Format the specified `object` as a space-separated list of decimal
+    /// values into the specified `stream`, formatting the values in bulk.
+    /// The output is identical to that of the `printList` function template.
+    static bsl::ostream& printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<int>&         object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array);
+    static bsl::ostream& printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<unsigned>&    object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array);
+    static bsl::ostream& printList(
+                        bsl::ostream&                           stream,
+                        const bsl::vector<bsls::Types::Int64>&  object,
+                        const EncoderOptions                   *encoderOptions,
+                        bdlat_TypeCategory::Array);
+    static bsl::ostream& printList(
+                        bsl::ostream&                           stream,
+                        const bsl::vector<bsls::Types::Uint64>& object,
+                        const EncoderOptions                   *encoderOptions,
+                        bdlat_TypeCategory::Array);
+    static bsl::ostream& printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<float>&       object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array);
+    static bsl::ostream& printList(
+                                bsl::ostream&                   stream,
+                                const bsl::vector<double>&      object,
+                                const EncoderOptions           *encoderOptions,
+                                bdlat_TypeCategory::Array);
+
                             // TEXT FUNCTIONS
 
     template <class TYPE>
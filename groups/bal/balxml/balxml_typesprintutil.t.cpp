@@ -591,6 +591,79 @@ bool verifyFloatingPointResult(const bsl::string_view& result,
     return matchFloatingPointResult(result, pattern);
 }
 
+/// Return a vector of the specified `numValues` values of the (template
+/// parameter) `TYPE`, including the extreme values of `TYPE`, generated
+/// deterministically from the specified `seed`.
+template <class TYPE>
+bsl::vector<TYPE> makeNumbers(bsl::size_t numValues, bsls::Types::Uint64 seed)
+{
+    typedef bsl::numeric_limits<TYPE> Limits;
+
+    bsl::vector<TYPE> result;
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        switch (i % 5) {
+          case 0: {
+            result.push_back(static_cast<TYPE>(seed >> (seed & 63)));
+          } break;
+          case 1: {
+            result.push_back(static_cast<TYPE>(
+                                  -static_cast<bsls::Types::Int64>(seed >> 33)
+                                  / static_cast<bsls::Types::Int64>(i + 1)));
+          } break;
+          case 2: {
+            result.push_back(Limits::max());
+          } break;
+          case 3: {
+            result.push_back(Limits::is_integer ? Limits::min()
+                                                : -Limits::max());
+          } break;
+          default: {
+            result.push_back(static_cast<TYPE>(static_cast<TYPE>(i) / 7));
+          } break;
+        }
+    }
+    return result;
+}
+
+/// Verify that printing the specified `values` using the `LIST` formatting
+/// mode produces the same output as printing the same values in an array of
+/// nullable values (which does not have a bulk implementation), both with
+/// the default stream state and with the specified `flags` set on the
+/// stream.  Use the specified `line` to report errors.
+template <class TYPE>
+void verifyNumberList(int                      line,
+                      const bsl::vector<TYPE>& values,
+                      bsl::ios_base::fmtflags  flags)
+{
+    bsl::vector<bdlb::NullableValue<TYPE> > nullableValues(values.begin(),
+                                                           values.end());
+
+    for (int withFlags = 0; withFlags < 2; ++withFlags) {
+        bsl::ostringstream expected;
+        bsl::ostringstream actual;
+        if (withFlags) {
+            expected.setf(flags);
+            actual.setf(flags);
+        }
+
+        Util::printList(expected, nullableValues);
+        Util::printList(actual, values);
+
+        ASSERTV(line, withFlags, actual.good());
+        ASSERTV(line, withFlags, expected.str(), actual.str(),
+                expected.str() == actual.str());
+
+        actual.str("");
+        Util::print(actual, values, bdlat_FormattingMode::e_LIST);
+
+        ASSERTV(line, withFlags, actual.good());
+        ASSERTV(line, withFlags, expected.str(), actual.str(),
+                expected.str() == actual.str());
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -675,7 +748,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -691,6 +764,64 @@ int main(int argc, char *argv[])
 
         usageExample2();
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING PRINTING LISTS OF NUMBERS
+        //   `bsl::vector`s of `int`, `unsigned int`, `bsls::Types::Int64`,
+        //   `bsls::Types::Uint64`, `float`, and `double` are printed in bulk
+        //   when using the `LIST` formatting mode.
+        //
+        // Concerns:
+        // 1. The output of printing a vector of numbers is identical to that
+        //    of printing the same numbers one at a time, for any number of
+        //    elements, including when the output does not fit into one
+        //    internal buffer.
+        //
+        // 2. Integers are printed honoring the format flags of the stream,
+        //    as when printed one at a time.
+        //
+        // Plan:
+        // 1. For each of the six types, and for a set of array lengths that
+        //    straddle the internal buffer sizes, compare the output of
+        //    printing a vector of numbers including the extreme values of the
+        //    type against that of printing a vector of nullable values holding
+        //    the same numbers.  Do so with default format flags and with
+        //    non-default format flags.  (C-1..2)
+        //
+        // Testing:
+        //   PRINTING LISTS OF NUMBERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PRINTING LISTS OF NUMBERS"
+                          << "\n=================================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        const bsl::ios_base::fmtflags HEX = bsl::ios_base::hex
+                                          | bsl::ios_base::showbase
+                                          | bsl::ios_base::uppercase;
+        const bsl::ios_base::fmtflags POS = bsl::ios_base::showpos;
+
+        const bsl::size_t LENGTHS[] = {
+            0, 1, 2, 3, 80, 81, 82, 83, 157, 158, 170, 171, 500, 2000
+        };
+        const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (verbose) { T_ P(LENGTH) }
+
+            verifyNumberList(L_, makeNumbers<int>(LENGTH, ti), HEX);
+            verifyNumberList(L_, makeNumbers<int>(LENGTH, ti), POS);
+            verifyNumberList(L_, makeNumbers<unsigned>(LENGTH, ti), HEX);
+            verifyNumberList(L_, makeNumbers<Int64>(LENGTH, ti), POS);
+            verifyNumberList(L_, makeNumbers<Uint64>(LENGTH, ti), HEX);
+            verifyNumberList(L_, makeNumbers<float>(LENGTH, ti), POS);
+            verifyNumberList(L_, makeNumbers<double>(LENGTH, ti), HEX);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING PRINTING LISTS OF NULLABLE SIMPLE TYPES
@@ -0,0 +1,172 @@
+// bdlat_sequenceutil.cpp                                             -*-C++-*-
+#include <bdlat_sequenceutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_sequenceutil_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// `SequenceUtil_AttributeIndex` is an open-addressing hash table with linear
+// probing, kept at most half full so that probe sequences are short.  The
+// hash of each name (32-bit FNV-1a) is stored in its slot, so that a lookup
+// compares names only when their hashes are equal.
+
+namespace BloombergLP {
+namespace bdlat {
+
+                      // ---------------------------------
+                      // class SequenceUtil_AttributeIndex
+                      // ---------------------------------
+
+// PRIVATE CLASS METHODS
+unsigned int SequenceUtil_AttributeIndex::hash(const char *name,
+                                               int         nameLength)
+{
+    unsigned int result = 2166136261u;
+    for (int i = 0; i < nameLength; ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 16777619u;
+    }
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+void SequenceUtil_AttributeIndex::insertEntry(const Entry& entry)
+{
+    const bsl::size_t mask = d_entries.size() - 1;
+
+    bsl::size_t slot = entry.d_hash & mask;
+    while (0 <= d_entries[slot].d_nameLength) {
+        slot = (slot + 1) & mask;
+    }
+    d_entries[slot] = entry;
+}
+
+// CLASS METHODS
+const SequenceUtil_AttributeIndex *SequenceUtil_AttributeIndex::install(
+                           bsls::AtomicOperations::AtomicTypes::Pointer *slot,
+                           SequenceUtil_AttributeIndex                  *index)
+{
+    BSLS_ASSERT(slot);
+    BSLS_ASSERT(index);
+
+    void *previous = bsls::AtomicOperations::testAndSwapPtrAcqRel(slot,
+                                                                  0,
+                                                                  index);
+    if (0 == previous) {
+        return index;                                                 // RETURN
+    }
+
+    // Another thread installed an index first.
+
+    bslma::DeleterHelper::deleteObject(index,
+                                       bslma::Default::globalAllocator());
+    return static_cast<const SequenceUtil_AttributeIndex *>(previous);
+}
+
+// CREATORS
+SequenceUtil_AttributeIndex::SequenceUtil_AttributeIndex(
+                                              bslma::Allocator *basicAllocator)
+: d_entries(basicAllocator)
+, d_names(basicAllocator)
+, d_numAttributes(0)
+{
+}
+
+// MANIPULATORS
+void SequenceUtil_AttributeIndex::addAttribute(const char *name,
+                                               int         nameLength,
+                                               int         id)
+{
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+
+    int existingId;
+    if (0 == lookup(&existingId, name, nameLength)) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t numAttributes = d_numAttributes + 1;
+    if (d_entries.size() < 2 * numAttributes) {
+        // Double the number of slots (to at least 8), and reinsert the
+        // entries.
+
+        bsl::vector<Entry> entries(d_entries.get_allocator());
+        const Entry        unused = { 0, 0, 0, -1 };
+        entries.resize(d_entries.empty() ? 8 : 2 * d_entries.size(), unused);
+        entries.swap(d_entries);
+
+        for (bsl::size_t i = 0; i < entries.size(); ++i) {
+            if (0 <= entries[i].d_nameLength) {
+                insertEntry(entries[i]);
+            }
+        }
+    }
+
+    const Entry entry = { hash(name, nameLength),
+                          id,
+                          static_cast<int>(d_names.length()),
+                          nameLength };
+    if (nameLength) {
+        d_names.append(name, nameLength);
+    }
+    insertEntry(entry);
+
+    ++d_numAttributes;
+}
+
+// ACCESSORS
+int SequenceUtil_AttributeIndex::lookup(int        *id,
+                                        const char *name,
+                                        int         nameLength) const
+{
+    BSLS_ASSERT(id);
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+
+    if (d_entries.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    const unsigned int hashValue = hash(name, nameLength);
+    const bsl::size_t  mask      = d_entries.size() - 1;
+
+    for (bsl::size_t slot = hashValue & mask;
+         0 <= d_entries[slot].d_nameLength;
+         slot = (slot + 1) & mask) {
+        const Entry& entry = d_entries[slot];
+
+        if (hashValue  == entry.d_hash
+         && nameLength == entry.d_nameLength
+         && (0 == nameLength
+          || 0 == bsl::memcmp(d_names.data() + entry.d_nameOffset,
+                              name,
+                              nameLength))) {
+            *id = entry.d_id;
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
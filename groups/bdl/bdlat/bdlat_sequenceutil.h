@@ -0,0 +1,599 @@
+// bdlat_sequenceutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLAT_SEQUENCEUTIL
+#define INCLUDED_BDLAT_SEQUENCEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities for operating on `bdlat` "sequence" types.
+//
+//@CLASSES:
+//  bdlat::SequenceUtil: namespace for utility functions on "sequence" types
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_attributeinfo
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdlat::SequenceUtil`, which serves as a namespace for a collection of
+// function templates providing derived operations for "sequence" types.  See
+// {`bdlat_sequencefunctions`} for the set of requirements of "sequence" types
+// in the `bdlat` framework.
+//
+///Looking Up Attributes by Name
+///-----------------------------
+// Decoders of formats that identify the attributes of a sequence by name
+// (e.g., JSON and XML) must map each name read to an attribute.  The
+// `bdlat_SequenceFunctions` functions taking an attribute name do so by
+// calling the `lookupAttributeInfo` function of a generated type, which
+// compares the name to that of each attribute in turn, so decoding a
+// sequence having `N` attributes takes time proportional to `N * N`.
+//
+// `SequenceUtil::lookupAttributeId` instead loads the id of the attribute
+// having a given name, which can then be supplied to the (constant-time)
+// `bdlat_SequenceFunctions` functions taking an attribute id.  For types
+// having the `bdlat_IsBasicSequence` trait (i.e., generated types), the id is
+// found in a hash table of the names of the attributes of the type, created
+// (once per type, using the global allocator) the first time
+// `lookupAttributeId` is called for that type, and shared thereafter by all
+// threads.  For other types, the attributes of the object are visited in
+// turn.
+//
+// Note that `lookupAttributeId` finds only an attribute whose name is exactly
+// the specified name, whereas the `lookupAttributeInfo` function of some
+// generated types also matches the names of the selections of anonymous
+// (untagged) choices, ignoring case.  Decoders should therefore fall back to
+// the name-based `bdlat_SequenceFunctions` functions when `lookupAttributeId`
+// fails.
+//
+// Decoders that must also support sequence types providing only the
+// name-based `bdlat_SequenceFunctions` functions (and not `accessAttributes`)
+// should instead call `SequenceUtil::lookupIndexedAttributeId`, which uses the
+// hash table for basic sequences, and otherwise fails without accessing the
+// object, so that the name-based functions are used for all other types.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Manipulating an Attribute Named in the Input
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a decoder that reads `name=value` pairs, and need to
+// set the value of the attribute of a sequence having each name.
+//
+// First, we define a manipulator that sets an `int` attribute:
+// ```
+// class SetIntAttribute {
+//     // DATA
+//     int d_value;
+//
+//   public:
+//     // CREATORS
+//     explicit SetIntAttribute(int value)
+//     : d_value(value)
+//     {
+//     }
+//
+//     // MANIPULATORS
+//     template <class INFO>
+//     int operator()(int *attribute, const INFO&)
+//     {
+//         *attribute = d_value;
+//         return 0;
+//     }
+//
+//     template <class ATTRIBUTE, class INFO>
+//     int operator()(ATTRIBUTE *, const INFO&)
+//     {
+//         return -1;
+//     }
+// };
+// ```
+// Then, we define a function that looks up the attribute once, and falls back
+// to the name-based function only if the attribute is not found:
+// ```
+// template <class TYPE>
+// int setAttribute(TYPE *object, const bsl::string_view& name, int value)
+// {
+//     SetIntAttribute manipulator(value);
+//
+//     const int nameLength = static_cast<int>(name.length());
+//     int       id;
+//     if (0 == bdlat::SequenceUtil::lookupAttributeId(&id,
+//                                                     *object,
+//                                                     name.data(),
+//                                                     nameLength)) {
+//         return bdlat_SequenceFunctions::manipulateAttribute(object,
+//                                                             manipulator,
+//                                                             id);
+//     }
+//     return bdlat_SequenceFunctions::manipulateAttribute(object,
+//                                                         manipulator,
+//                                                         name.data(),
+//                                                         nameLength);
+// }
+// ```
+// Finally, we use the function with a generated sequence type, `Point`,
+// having the `int` attributes `x` and `y`:
+// ```
+// Point point;
+//
+// assert(0 == setAttribute(&point, "x", 3));
+// assert(0 == setAttribute(&point, "y", 4));
+// assert(0 != setAttribute(&point, "z", 5));
+//
+// assert(3 == point.x());
+// assert(4 == point.y());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlat {
+
+                      // =================================
+                      // class SequenceUtil_AttributeIndex
+                      // =================================
+
+/// This component-private class provides a hash table mapping the names of
+/// the attributes of a sequence type to their ids.
+class SequenceUtil_AttributeIndex {
+
+    // PRIVATE TYPES
+    struct Entry {
+        unsigned int d_hash;        // hash of the name
+        int          d_id;          // attribute id
+        int          d_nameOffset;  // offset of the name in `d_names`
+        int          d_nameLength;  // length of the name, or -1 if unused
+    };
+
+    // DATA
+    bsl::vector<Entry> d_entries;        // slots (a power of 2 in number)
+    bsl::string        d_names;          // names of the attributes
+    int                d_numAttributes;  // number of attributes added
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the hash of the specified `name` having the specified
+    /// `nameLength`.
+    static unsigned int hash(const char *name, int nameLength);
+
+    // PRIVATE MANIPULATORS
+
+    /// Insert into `d_entries` the specified `entry`, which must not
+    /// already be present, and for which there must be an unused slot.
+    void insertEntry(const Entry& entry);
+
+  private:
+    // NOT IMPLEMENTED
+    SequenceUtil_AttributeIndex(const SequenceUtil_AttributeIndex&);
+    SequenceUtil_AttributeIndex& operator=(const SequenceUtil_AttributeIndex&);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the index installed in the specified `slot`, having first
+    /// installed the specified `index` if `slot` holds a null pointer.  If
+    /// `slot` already holds an index, destroy `index` (which must have been
+    /// created using the global allocator).
+    static const SequenceUtil_AttributeIndex *install(
+                          bsls::AtomicOperations::AtomicTypes::Pointer *slot,
+                          SequenceUtil_AttributeIndex                  *index);
+
+    // CREATORS
+
+    /// Create an empty index.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit SequenceUtil_AttributeIndex(bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add to this index the attribute having the specified `name` of the
+    /// specified `nameLength`, and the specified `id`, unless an attribute
+    /// having that name has already been added.
+    void addAttribute(const char *name, int nameLength, int id);
+
+    // ACCESSORS
+
+    /// Load into the specified `id` the id of the attribute having the
+    /// specified `name` of the specified `nameLength`, and return 0, if such
+    /// an attribute has been added to this index.  Otherwise, return a
+    /// non-zero value with no effect on `id`.
+    int lookup(int *id, const char *name, int nameLength) const;
+
+    /// Return the number of attributes in this index.
+    int numAttributes() const;
+};
+
+                     // ==================================
+                     // class SequenceUtil_AttributeFinder
+                     // ==================================
+
+/// This component-private class provides an accessor that, when applied to
+/// each attribute of a sequence, records the id of the attribute having a
+/// specified name.
+class SequenceUtil_AttributeFinder {
+
+    // DATA
+    const char *d_name_p;      // name sought
+    int         d_nameLength;  // length of `d_name_p`
+    int        *d_id_p;        // result (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create an accessor that loads into the specified `id` the id of the
+    /// attribute having the specified `name` of the specified `nameLength`.
+    SequenceUtil_AttributeFinder(int *id, const char *name, int nameLength);
+
+    // MANIPULATORS
+
+    /// Load the id in the specified `info` and return 1 if the name in
+    /// `info` is the name sought, and return 0 otherwise.
+    template <class ATTRIBUTE, class INFO>
+    int operator()(const ATTRIBUTE&, const INFO& info);
+};
+
+                     // ===================================
+                     // class SequenceUtil_AttributeIndexer
+                     // ===================================
+
+/// This component-private class provides an accessor that, when applied to
+/// each attribute of a sequence, adds the attribute to an index.
+class SequenceUtil_AttributeIndexer {
+
+    // DATA
+    SequenceUtil_AttributeIndex *d_index_p;  // index (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create an accessor adding attributes to the specified `index`.
+    explicit SequenceUtil_AttributeIndexer(SequenceUtil_AttributeIndex *index);
+
+    // MANIPULATORS
+
+    /// Add the attribute described by the specified `info` to the index,
+    /// and return 0.
+    template <class ATTRIBUTE, class INFO>
+    int operator()(const ATTRIBUTE&, const INFO& info);
+};
+
+                  // ========================================
+                  // struct SequenceUtil_AttributeIndexHolder
+                  // ========================================
+
+/// This component-private `struct` holds the index of the attributes of the
+/// (template parameter) `TYPE`.
+template <class TYPE>
+struct SequenceUtil_AttributeIndexHolder {
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Pointer s_index;
+                                                         // null until created
+};
+
+                            // ===================
+                            // struct SequenceUtil
+                            // ===================
+
+/// This `struct` provides a namespace for functions that provide derived
+/// operations on `bdlat` "sequence" types.
+struct SequenceUtil {
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Load into the specified `attributeId` the id of the attribute of the
+    /// specified `object` having the specified `name` of the specified
+    /// `nameLength`, using the index of the attributes of `TYPE`.  Return 0
+    /// on success, and a non-zero value if there is no such attribute.
+    template <class TYPE>
+    static int lookupAttributeIdImp(int               *attributeId,
+                                    const TYPE&        object,
+                                    const char        *name,
+                                    int                nameLength,
+                                    bsl::true_type     isBasicSequence);
+
+    /// Load into the specified `attributeId` the id of the attribute of the
+    /// specified `object` having the specified `name` of the specified
+    /// `nameLength`, visiting each attribute of `object`.  Return 0 on
+    /// success, and a non-zero value if there is no such attribute.
+    template <class TYPE>
+    static int lookupAttributeIdImp(int               *attributeId,
+                                    const TYPE&        object,
+                                    const char        *name,
+                                    int                nameLength,
+                                    bsl::false_type    isBasicSequence);
+
+    /// Load into the specified `attributeId` the id of the attribute of the
+    /// specified `object` having the specified `name` of the specified
+    /// `nameLength`, using the index of the attributes of `TYPE`.  Return 0
+    /// on success, and a non-zero value if there is no such attribute.
+    template <class TYPE>
+    static int lookupIndexedAttributeIdImp(int               *attributeId,
+                                           const TYPE&        object,
+                                           const char        *name,
+                                           int                nameLength,
+                                           bsl::true_type     isBasicSequence);
+
+    /// Return a non-zero value.
+    template <class TYPE>
+    static int lookupIndexedAttributeIdImp(int               *attributeId,
+                                           const TYPE&        object,
+                                           const char        *name,
+                                           int                nameLength,
+                                           bsl::false_type    isBasicSequence);
+
+  public:
+    // CLASS METHODS
+
+    /// Load into the specified `attributeId` the id of the attribute of the
+    /// specified `object` whose name is the specified `name` of the
+    /// specified `nameLength`, and return 0, if such an attribute exists.
+    /// Otherwise, return a non-zero value with no effect on `attributeId`.
+    /// The comparison of names is case-sensitive, and the names of the
+    /// selections of anonymous choices are not considered (see
+    /// [](#Looking Up Attributes by Name)).  The behavior is undefined
+    /// unless `TYPE` is a `bdlat` sequence type and `0 <= nameLength`.
+    template <class TYPE>
+    static int lookupAttributeId(int         *attributeId,
+                                 const TYPE&  object,
+                                 const char  *name,
+                                 int          nameLength);
+
+    /// Load into the specified `attributeId` the id of the attribute of the
+    /// specified `object` whose name is the specified `name` of the
+    /// specified `nameLength`, and return 0, if `TYPE` has the
+    /// `bdlat_IsBasicSequence` trait and such an attribute exists.
+    /// Otherwise, return a non-zero value with no effect on `attributeId`.
+    /// If `TYPE` does not have the `bdlat_IsBasicSequence` trait, `object`
+    /// is not accessed, and `TYPE` need not support
+    /// `bdlat_SequenceFunctions::accessAttributes`.  The behavior is
+    /// undefined unless `TYPE` is a `bdlat` sequence type and
+    /// `0 <= nameLength`.  Note that this function is intended for decoders
+    /// that fall back to the name-based `bdlat_SequenceFunctions` functions
+    /// on failure (see [](#Looking Up Attributes by Name)).
+    template <class TYPE>
+    static int lookupIndexedAttributeId(int         *attributeId,
+                                        const TYPE&  object,
+                                        const char  *name,
+                                        int          nameLength);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // ---------------------------------
+                      // class SequenceUtil_AttributeIndex
+                      // ---------------------------------
+
+// ACCESSORS
+inline
+int SequenceUtil_AttributeIndex::numAttributes() const
+{
+    return d_numAttributes;
+}
+
+                     // ----------------------------------
+                     // class SequenceUtil_AttributeFinder
+                     // ----------------------------------
+
+// CREATORS
+inline
+SequenceUtil_AttributeFinder::SequenceUtil_AttributeFinder(
+                                                        int        *id,
+                                                        const char *name,
+                                                        int         nameLength)
+: d_name_p(name)
+, d_nameLength(nameLength)
+, d_id_p(id)
+{
+}
+
+// MANIPULATORS
+template <class ATTRIBUTE, class INFO>
+inline
+int SequenceUtil_AttributeFinder::operator()(const ATTRIBUTE&,
+                                             const INFO&      info)
+{
+    if (d_nameLength == info.nameLength()
+     && (0 == d_nameLength
+      || 0 == bsl::memcmp(d_name_p, info.name(), d_nameLength))) {
+        *d_id_p = info.id();
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+                     // -----------------------------------
+                     // class SequenceUtil_AttributeIndexer
+                     // -----------------------------------
+
+// CREATORS
+inline
+SequenceUtil_AttributeIndexer::SequenceUtil_AttributeIndexer(
+                                            SequenceUtil_AttributeIndex *index)
+: d_index_p(index)
+{
+}
+
+// MANIPULATORS
+template <class ATTRIBUTE, class INFO>
+inline
+int SequenceUtil_AttributeIndexer::operator()(const ATTRIBUTE&,
+                                              const INFO&      info)
+{
+    d_index_p->addAttribute(info.name(), info.nameLength(), info.id());
+    return 0;
+}
+
+                  // ----------------------------------------
+                  // struct SequenceUtil_AttributeIndexHolder
+                  // ----------------------------------------
+
+// CLASS DATA
+template <class TYPE>
+bsls::AtomicOperations::AtomicTypes::Pointer
+                      SequenceUtil_AttributeIndexHolder<TYPE>::s_index = { 0 };
+
+                            // -------------------
+                            // struct SequenceUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+int SequenceUtil::lookupAttributeIdImp(int            *attributeId,
+                                       const TYPE&     object,
+                                       const char     *name,
+                                       int             nameLength,
+                                       bsl::true_type)
+{
+    typedef SequenceUtil_AttributeIndexHolder<TYPE> Holder;
+
+    const SequenceUtil_AttributeIndex *index =
+        static_cast<const SequenceUtil_AttributeIndex *>(
+                      bsls::AtomicOperations::getPtrAcquire(&Holder::s_index));
+
+    if (0 == index) {
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        SequenceUtil_AttributeIndex *newIndex = new (*allocator)
+                                       SequenceUtil_AttributeIndex(allocator);
+
+        SequenceUtil_AttributeIndexer indexer(newIndex);
+        bdlat_SequenceFunctions::accessAttributes(object, indexer);
+
+        index = SequenceUtil_AttributeIndex::install(&Holder::s_index,
+                                                     newIndex);
+    }
+
+    return index->lookup(attributeId, name, nameLength);
+}
+
+template <class TYPE>
+int SequenceUtil::lookupAttributeIdImp(int             *attributeId,
+                                       const TYPE&      object,
+                                       const char      *name,
+                                       int              nameLength,
+                                       bsl::false_type)
+{
+    SequenceUtil_AttributeFinder finder(attributeId, name, nameLength);
+
+    return 1 == bdlat_SequenceFunctions::accessAttributes(object, finder)
+           ? 0
+           : -1;
+}
+
+template <class TYPE>
+inline
+int SequenceUtil::lookupIndexedAttributeIdImp(int            *attributeId,
+                                              const TYPE&     object,
+                                              const char     *name,
+                                              int             nameLength,
+                                              bsl::true_type  isBasicSequence)
+{
+    return lookupAttributeIdImp(attributeId,
+                                object,
+                                name,
+                                nameLength,
+                                isBasicSequence);
+}
+
+template <class TYPE>
+inline
+int SequenceUtil::lookupIndexedAttributeIdImp(int *,
+                                              const TYPE&,
+                                              const char *,
+                                              int,
+                                              bsl::false_type)
+{
+    return -1;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+int SequenceUtil::lookupAttributeId(int         *attributeId,
+                                    const TYPE&  object,
+                                    const char  *name,
+                                    int          nameLength)
+{
+#if !defined(BSLS_PLATFORM_CMP_SUN)
+    BSLMF_ASSERT((bdlat_SequenceFunctions::IsSequence<TYPE>::value));
+#endif
+
+    BSLS_ASSERT(attributeId);
+    BSLS_ASSERT(0 <= nameLength);
+
+    return lookupAttributeIdImp(
+                           attributeId,
+                           object,
+                           name,
+                           nameLength,
+                           bsl::integral_constant<
+                               bool,
+                               bdlat_IsBasicSequence<TYPE>::value>());
+}
+
+template <class TYPE>
+inline
+int SequenceUtil::lookupIndexedAttributeId(int         *attributeId,
+                                           const TYPE&  object,
+                                           const char  *name,
+                                           int          nameLength)
+{
+#if !defined(BSLS_PLATFORM_CMP_SUN)
+    BSLMF_ASSERT((bdlat_SequenceFunctions::IsSequence<TYPE>::value));
+#endif
+
+    BSLS_ASSERT(attributeId);
+    BSLS_ASSERT(0 <= nameLength);
+
+    return lookupIndexedAttributeIdImp(
+                           attributeId,
+                           object,
+                           name,
+                           nameLength,
+                           bsl::integral_constant<
+                               bool,
+                               bdlat_IsBasicSequence<TYPE>::value>());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BDLAT_SEQUENCEUTIL
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1240 @@
+// bdlat_sequenceutil.t.cpp                                           -*-C++-*-
+#include <bdlat_sequenceutil.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bdlb_string.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This component provides a utility for looking up the id of an attribute of
+// a "sequence" type by name, using a component-private hash table of names
+// for generated ("basic") sequence types.  We first test the hash table, and
+// then verify that `lookupAttributeId` finds exactly the attributes found by
+// the `lookupAttributeInfo` function of generated types (other than the
+// selections of anonymous choices), both for basic sequences and for
+// sequences plugged into the `bdlat` framework by other means.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int lookupAttributeId(int *, const TYPE&, const char *, int);
+// [ 5] int lookupIndexedAttributeId(int *, const TYPE&, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] SequenceUtil_AttributeIndex
+// [ 4] CONCERN: SEQUENCES THAT ARE NOT BASIC SEQUENCES ARE SUPPORTED
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat::SequenceUtil                Util;
+typedef bdlat::SequenceUtil_AttributeIndex Index;
+
+// ============================================================================
+//                   NAMESPACE-SCOPE ENTITIES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace test {
+
+                                // ===========
+                                // class Point
+                                // ===========
+
+/// This class is a sequence, in the style of a generated type, having two
+/// `int` attributes, `x` and `y`, and an anonymous choice attribute (which,
+/// for simplicity, is an `int`) whose selections are named `polar` and
+/// `cartesian`.
+class Point {
+
+    // DATA
+    int d_x;
+    int d_y;
+    int d_system;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_X      = 10,
+        ATTRIBUTE_ID_Y      = 20,
+        ATTRIBUTE_ID_SYSTEM = 30
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    enum {
+        ATTRIBUTE_INDEX_X      = 0,
+        ATTRIBUTE_INDEX_Y      = 1,
+        ATTRIBUTE_INDEX_SYSTEM = 2
+    };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X:
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_X];
+          case ATTRIBUTE_ID_Y:
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_Y];
+          case ATTRIBUTE_ID_SYSTEM:
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM];
+          default:
+            return 0;
+        }
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+    {
+        if (bdlb::String::areEqualCaseless("polar", name, nameLength)) {
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM];
+        }
+
+        if (bdlb::String::areEqualCaseless("cartesian", name, nameLength)) {
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM];
+        }
+
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& attributeInfo =
+                                                       ATTRIBUTE_INFO_ARRAY[i];
+
+            if (nameLength == attributeInfo.d_nameLength
+             && 0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+                return &attributeInfo;                                // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Point()
+    : d_x()
+    , d_y()
+    , d_system()
+    {
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X:
+            return manipulator(&d_x, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_X]);
+          case ATTRIBUTE_ID_Y:
+            return manipulator(&d_y, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_Y]);
+          case ATTRIBUTE_ID_SYSTEM:
+            return manipulator(&d_system,
+                               ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM]);
+          default:
+            return -1;
+        }
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+    {
+        int rc = manipulator(&d_x, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_X]);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        rc = manipulator(&d_y, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_Y]);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        return manipulator(&d_system,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM]);
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X:
+            return accessor(d_x, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_X]);
+          case ATTRIBUTE_ID_Y:
+            return accessor(d_y, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_Y]);
+          case ATTRIBUTE_ID_SYSTEM:
+            return accessor(d_system,
+                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM]);
+          default:
+            return -1;
+        }
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessAttribute(accessor, info->d_id) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+    {
+        int rc = accessor(d_x, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_X]);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        rc = accessor(d_y, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_Y]);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        return accessor(d_system,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYSTEM]);
+    }
+
+    int x() const
+    {
+        return d_x;
+    }
+
+    int y() const
+    {
+        return d_y;
+    }
+};
+
+const bdlat_AttributeInfo Point::ATTRIBUTE_INFO_ARRAY[] = {
+    {
+        ATTRIBUTE_ID_X,
+        "x",
+        sizeof("x") - 1,
+        "",
+        bdlat_FormattingMode::e_DEC
+    },
+    {
+        ATTRIBUTE_ID_Y,
+        "y",
+        sizeof("y") - 1,
+        "",
+        bdlat_FormattingMode::e_DEC
+    },
+    {
+        ATTRIBUTE_ID_SYSTEM,
+        "System",
+        sizeof("System") - 1,
+        "",
+        bdlat_FormattingMode::e_UNTAGGED
+    }
+};
+
+                             // ==================
+                             // class WideSequence
+                             // ==================
+
+/// This class is a sequence, in the style of a generated type, having
+/// `k_NUM_ATTRIBUTES` `int` attributes, named `field0`, `field1`, etc., whose
+/// ids are 1000 more than their indices.
+class WideSequence {
+
+  public:
+    // TYPES
+    enum { k_NUM_ATTRIBUTES = 200, k_ID_OFFSET = 1000 };
+
+  private:
+    // DATA
+    int d_fields[k_NUM_ATTRIBUTES];
+
+    // CLASS DATA
+    static bdlat_AttributeInfo s_infos[k_NUM_ATTRIBUTES];
+    static char                s_names[k_NUM_ATTRIBUTES][16];
+
+  public:
+    // CLASS METHODS
+
+    /// Initialize the attribute information of this type.  This function
+    /// must be called before any other function of this type.
+    static void initialize()
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            bsl::sprintf(s_names[i], "field%d", i);
+
+            s_infos[i].d_id             = k_ID_OFFSET + i;
+            s_infos[i].d_name_p         = s_names[i];
+            s_infos[i].d_nameLength     = static_cast<int>(
+                                                  bsl::strlen(s_names[i]));
+            s_infos[i].d_annotation_p   = "";
+            s_infos[i].d_formattingMode = bdlat_FormattingMode::e_DEC;
+        }
+    }
+
+    /// Return the information of the attribute having the specified `name`
+    /// of the specified `nameLength`, found as by a generated type, or 0 if
+    /// there is no such attribute.
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& attributeInfo = s_infos[i];
+
+            if (nameLength == attributeInfo.d_nameLength
+             && 0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+                return &attributeInfo;                                // RETURN
+            }
+        }
+        return 0;
+    }
+
+    /// Return the information of the attribute having the specified `id`,
+    /// or 0 if there is no such attribute.
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+    {
+        const int index = id - k_ID_OFFSET;
+        return 0 <= index && index < k_NUM_ATTRIBUTES ? &s_infos[index] : 0;
+    }
+
+    // CREATORS
+    WideSequence()
+    {
+        bsl::memset(d_fields, 0, sizeof d_fields);
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        return info ? manipulator(&d_fields[id - k_ID_OFFSET], *info) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const int rc = manipulator(&d_fields[i], s_infos[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        return info ? accessor(d_fields[id - k_ID_OFFSET], *info) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessAttribute(accessor, info->d_id) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const int rc = accessor(d_fields[i], s_infos[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+bdlat_AttributeInfo WideSequence::s_infos[k_NUM_ATTRIBUTES];
+char                WideSequence::s_names[k_NUM_ATTRIBUTES][16];
+
+                            // ====================
+                            // class CustomSequence
+                            // ====================
+
+/// This class is a sequence that is plugged into the `bdlat` framework by
+/// overloading the `bdlat_sequence*` functions, rather than by having the
+/// `bdlat_IsBasicSequence` trait.  Its attributes, `alpha`, `beta`, and
+/// `gamma`, have the ids 1, 2, and 3, and their information is created anew
+/// on each visit.
+class CustomSequence {
+
+  public:
+    // DATA
+    int d_values[3];
+
+    // CREATORS
+    CustomSequence()
+    {
+        bsl::memset(d_values, 0, sizeof d_values);
+    }
+};
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttributes(const CustomSequence& object,
+                                   ACCESSOR&             accessor)
+{
+    static const char *const NAMES[] = { "alpha", "beta", "gamma" };
+
+    for (int i = 0; i < 3; ++i) {
+        const bsl::string name(NAMES[i]);
+
+        bdlat_AttributeInfo info;
+        info.d_id             = i + 1;
+        info.d_name_p         = name.c_str();
+        info.d_nameLength     = static_cast<int>(name.length());
+        info.d_annotation_p   = "";
+        info.d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+
+        const int rc = accessor(object.d_values[i], info);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+                            // ===================
+                            // class NamedSequence
+                            // ===================
+
+/// This class is a sequence that is plugged into the `bdlat` framework by
+/// overloading only the name-based `bdlat_sequence*` functions, which are
+/// never called by this test driver, and so does not support
+/// `bdlat_SequenceFunctions::accessAttributes`.
+class NamedSequence {
+};
+
+}  // close namespace test
+
+template <>
+struct bdlat_IsBasicSequence<test::Point> : bsl::true_type {
+};
+
+template <>
+struct bdlat_IsBasicSequence<test::WideSequence> : bsl::true_type {
+};
+
+namespace bdlat_SequenceFunctions {
+
+template <>
+struct IsSequence<test::CustomSequence> : bsl::true_type {
+};
+
+template <>
+struct IsSequence<test::NamedSequence> : bsl::true_type {
+};
+
+}  // close namespace bdlat_SequenceFunctions
+}  // close enterprise namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace usage {
+
+using test::Point;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Manipulating an Attribute Named in the Input
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a decoder that reads `name=value` pairs, and need to
+// set the value of the attribute of a sequence having each name.
+//
+// First, we define a manipulator that sets an `int` attribute:
+// ```
+class SetIntAttribute {
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit SetIntAttribute(int value)
+    : d_value(value)
+    {
+    }
+
+    // MANIPULATORS
+    template <class INFO>
+    int operator()(int *attribute, const INFO&)
+    {
+        *attribute = d_value;
+        return 0;
+    }
+
+    template <class ATTRIBUTE, class INFO>
+    int operator()(ATTRIBUTE *, const INFO&)
+    {
+        return -1;
+    }
+};
+// ```
+// Then, we define a function that looks up the attribute once, and falls back
+// to the name-based function only if the attribute is not found:
+// ```
+template <class TYPE>
+int setAttribute(TYPE *object, const bsl::string_view& name, int value)
+{
+    SetIntAttribute manipulator(value);
+
+    const int nameLength = static_cast<int>(name.length());
+    int       id;
+    if (0 == bdlat::SequenceUtil::lookupAttributeId(&id,
+                                                    *object,
+                                                    name.data(),
+                                                    nameLength)) {
+        return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                            manipulator,
+                                                            id);
+    }
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        name.data(),
+                                                        nameLength);
+}
+// ```
+
+}  // close namespace usage
+}  // close enterprise namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    BSLA_MAYBE_UNUSED const bool             verbose = argc > 2;
+    BSLA_MAYBE_UNUSED const bool         veryVerbose = argc > 3;
+    BSLA_MAYBE_UNUSED const bool     veryVeryVerbose = argc > 4;
+    BSLA_MAYBE_UNUSED const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // Note that the index of the attributes of each basic sequence type is
+    // created using the global allocator, and is never destroyed.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    globalAllocator.setNoAbort(true);
+    globalAllocator.setQuiet(true);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    test::WideSequence::initialize();
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Finally, we use the function with a generated sequence type, `Point`,
+// having the `int` attributes `x` and `y`:
+// ```
+        test::Point point;
+
+        ASSERT(0 == usage::setAttribute(&point, "x", 3));
+        ASSERT(0 == usage::setAttribute(&point, "y", 4));
+        ASSERT(0 != usage::setAttribute(&point, "z", 5));
+
+        ASSERT(3 == point.x());
+        ASSERT(4 == point.y());
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOOKUP OF INDEXED ATTRIBUTES
+        //
+        // Concerns:
+        // 1. For a basic sequence, `lookupIndexedAttributeId` loads the id
+        //    loaded by `lookupAttributeId`, and has the same result.
+        //
+        // 2. For a sequence that is not a basic sequence,
+        //    `lookupIndexedAttributeId` fails with no effect on the id, even
+        //    if the type has an attribute of the specified name.
+        //
+        // 3. `lookupIndexedAttributeId` does not require a sequence that is
+        //    not a basic sequence to support `accessAttributes`.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Using a table of names, look up each name with both functions
+        //    for a generated-style sequence type, and compare the results.
+        //    (C-1)
+        //
+        // 2. Look up the name of each attribute of a custom sequence, and
+        //    verify that the lookup fails without loading the id.  (C-2)
+        //
+        // 3. Look up a name for a sequence type that does not support
+        //    `accessAttributes`, and verify that the lookup compiles and
+        //    fails.  (C-3)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   lookupIndexedAttributeId(int *, const TYPE&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP OF INDEXED ATTRIBUTES" << endl
+                          << "============================" << endl;
+
+        static const char *const NAMES[] = {
+            "x", "y", "z", "", "X", "polar", "cartesian", "alpha", "beta"
+        };
+        const bsl::size_t NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+        const test::Point          point;
+        const test::CustomSequence custom;
+        const test::NamedSequence  named;
+
+        for (bsl::size_t ti = 0; ti < NUM_NAMES; ++ti) {
+            const char *const NAME = NAMES[ti];
+            const int         LEN  = static_cast<int>(bsl::strlen(NAME));
+
+            if (veryVerbose) { T_ P(NAME) }
+
+            int       expId = -7;
+            const int expRc = Util::lookupAttributeId(&expId,
+                                                      point,
+                                                      NAME,
+                                                      LEN);
+
+            int id = -7;
+            int rc = Util::lookupIndexedAttributeId(&id, point, NAME, LEN);
+
+            ASSERTV(NAME, expRc, rc, (0 == expRc) == (0 == rc));
+            ASSERTV(NAME, expId, id, expId == id);
+
+            id = -7;
+            rc = Util::lookupIndexedAttributeId(&id, custom, NAME, LEN);
+
+            ASSERTV(NAME, rc, 0 != rc);
+            ASSERTV(NAME, id, -7 == id);
+
+            id = -7;
+            rc = Util::lookupIndexedAttributeId(&id, named, NAME, LEN);
+
+            ASSERTV(NAME, rc, 0 != rc);
+            ASSERTV(NAME, id, -7 == id);
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int id;
+            ASSERT_PASS(Util::lookupIndexedAttributeId(&id, point,  "x", 1));
+            ASSERT_PASS(Util::lookupIndexedAttributeId(&id, custom, "x", 1));
+            ASSERT_FAIL(Util::lookupIndexedAttributeId(0,   point,  "x", 1));
+            ASSERT_FAIL(Util::lookupIndexedAttributeId(&id, custom, "x", -1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: SEQUENCES THAT ARE NOT BASIC SEQUENCES ARE SUPPORTED
+        //
+        // Concerns:
+        // 1. `lookupAttributeId` finds the attributes of a sequence that does
+        //    not have the `bdlat_IsBasicSequence` trait, including when the
+        //    attribute information supplied to accessors is temporary.
+        //
+        // 2. No index is created (and no memory is allocated) for such a
+        //    sequence.
+        //
+        // Plan:
+        // 1. Look up the name of each attribute of a custom sequence, and
+        //    names that are not the names of attributes, and verify the
+        //    results.  (C-1)
+        //
+        // 2. Verify that no memory is allocated from the global allocator.
+        //    (C-2)
+        //
+        // Testing:
+        //   CONCERN: SEQUENCES THAT ARE NOT BASIC SEQUENCES ARE SUPPORTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: SEQUENCES THAT ARE NOT BASIC SEQUENCES ARE "
+                 << "SUPPORTED" << endl
+                 << "===================================================="
+                 << "=========" << endl;
+
+        BSLMF_ASSERT(!bdlat_IsBasicSequence<test::CustomSequence>::value);
+
+        static const struct {
+            int         d_line;
+            const char *d_name_p;
+            int         d_id;  // -1 if not found
+        } DATA[] = {
+            //LINE  NAME       ID
+            //----  --------   --
+            { L_,   "alpha",    1 },
+            { L_,   "beta",     2 },
+            { L_,   "gamma",    3 },
+            { L_,   "",        -1 },
+            { L_,   "Alpha",   -1 },
+            { L_,   "alph",    -1 },
+            { L_,   "delta",   -1 },
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const test::CustomSequence object;
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const NAME = DATA[ti].d_name_p;
+            const int         ID   = DATA[ti].d_id;
+
+            int       id = -7;
+            const int rc = Util::lookupAttributeId(
+                                          &id,
+                                          object,
+                                          NAME,
+                                          static_cast<int>(bsl::strlen(NAME)));
+
+            ASSERTV(LINE, rc, (-1 == ID) == (0 != rc));
+            ASSERTV(LINE, ID, id, (-1 == ID ? -7 : ID) == id);
+        }
+        ASSERTV(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP OF BASIC SEQUENCE ATTRIBUTES
+        //
+        // Concerns:
+        // 1. `lookupAttributeId` loads the id of the attribute having exactly
+        //    the specified name, and fails (with no effect on the id) if
+        //    there is no such attribute.
+        //
+        // 2. The names of the selections of anonymous choices, which are
+        //    matched by the `lookupAttributeInfo` function of the type, are
+        //    not found.
+        //
+        // 3. The index of the attributes of a type is created once, using the
+        //    global allocator, and is not affected by the object supplied.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Using a table of names, look up each name for a generated-style
+        //    sequence type, and verify the result.  (C-1..2)
+        //
+        // 2. For a type having 200 attributes, verify that each attribute
+        //    name (and each name with a character appended or removed) is
+        //    found exactly when `lookupAttributeInfo` finds it, with the same
+        //    id.  (C-1)
+        //
+        // 3. Verify the use of the global allocator after the first and
+        //    subsequent lookups.  (C-3)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int lookupAttributeId(int *, const TYPE&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP OF BASIC SEQUENCE ATTRIBUTES" << endl
+                          << "===================================" << endl;
+
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+        if (veryVerbose) cout << "Generated-style type." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name_p;
+                int         d_id;  // -1 if not found
+            } DATA[] = {
+                //LINE  NAME          ID
+                //----  -----------   --
+                { L_,   "x",          10 },
+                { L_,   "y",          20 },
+                { L_,   "System",     30 },
+                { L_,   "",           -1 },
+                { L_,   "X",          -1 },
+                { L_,   "xy",         -1 },
+                { L_,   "system",     -1 },
+                { L_,   "polar",      -1 },
+                { L_,   "cartesian",  -1 },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const char *const NAME = DATA[ti].d_name_p;
+                const int         ID   = DATA[ti].d_id;
+
+                const test::Point object;
+
+                int       id = -7;
+                const int rc = Util::lookupAttributeId(
+                                          &id,
+                                          object,
+                                          NAME,
+                                          static_cast<int>(bsl::strlen(NAME)));
+
+                ASSERTV(LINE, rc, (-1 == ID) == (0 != rc));
+                ASSERTV(LINE, ID, id, (-1 == ID ? -7 : ID) == id);
+            }
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS = globalAllocator.numBlocksTotal();
+        ASSERTV(NUM_BLOCKS, 0 < NUM_BLOCKS);
+
+        if (veryVerbose) cout << "Type having 200 attributes." << endl;
+        {
+            typedef test::WideSequence Wide;
+
+            const Wide object;
+
+            for (int i = 0; i < Wide::k_NUM_ATTRIBUTES; ++i) {
+                char name[32];
+                bsl::sprintf(name, "field%d", i);
+
+                const bsl::string NAMES[] = { bsl::string(name),
+                                              bsl::string(name) + "0",
+                                              bsl::string(name) + "x",
+                                              bsl::string(name,
+                                                   bsl::strlen(name) - 1) };
+
+                for (int j = 0; j < 4; ++j) {
+                    const bsl::string& NAME   = NAMES[j];
+                    const int          LENGTH = static_cast<int>(
+                                                               NAME.length());
+
+                    const bdlat_AttributeInfo *info =
+                               Wide::lookupAttributeInfo(NAME.data(), LENGTH);
+
+                    int       id = -7;
+                    const int rc = Util::lookupAttributeId(&id,
+                                                           object,
+                                                           NAME.data(),
+                                                           LENGTH);
+
+                    ASSERTV(NAME, rc, (0 == info) == (0 != rc));
+                    ASSERTV(NAME, id, (info ? info->d_id : -7) == id);
+                }
+            }
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS_WIDE =
+                                              globalAllocator.numBlocksTotal();
+        ASSERTV(NUM_BLOCKS, NUM_BLOCKS_WIDE, NUM_BLOCKS < NUM_BLOCKS_WIDE);
+
+        if (veryVerbose) cout << "Subsequent lookups." << endl;
+        {
+            const test::Point        point;
+            const test::WideSequence wide;
+
+            int id;
+            ASSERT(0 == Util::lookupAttributeId(&id, point, "y", 1));
+            ASSERT(20 == id);
+            ASSERT(0 == Util::lookupAttributeId(&id, wide, "field7", 6));
+            ASSERT(1007 == id);
+
+            ASSERTV(globalAllocator.numBlocksTotal(),
+                    NUM_BLOCKS_WIDE == globalAllocator.numBlocksTotal());
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const test::Point point;
+
+            int id;
+            ASSERT_PASS(Util::lookupAttributeId(&id, point, "x", 1));
+            ASSERT_PASS(Util::lookupAttributeId(&id, point, 0,   0));
+            ASSERT_FAIL(Util::lookupAttributeId(0,   point, "x", 1));
+            ASSERT_FAIL(Util::lookupAttributeId(&id, point, "x", -1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SequenceUtil_AttributeIndex
+        //
+        // Concerns:
+        // 1. An index finds exactly the names added to it, with their ids.
+        //
+        // 2. An attribute having the same name as one already added is
+        //    ignored.
+        //
+        // 3. The index grows as required, and uses the supplied allocator.
+        //
+        // 4. `install` installs an index in an empty slot, and otherwise
+        //    destroys the supplied index and returns the installed one.
+        //
+        // Plan:
+        // 1. Add an increasing number of names to an index, verifying after
+        //    each addition that every name added is found, and that similar
+        //    names are not.  (C-1, 3)
+        //
+        // 2. Add a name twice with different ids, and verify the id found.
+        //    (C-2)
+        //
+        // 3. Install two indices in a slot, and verify the results and the
+        //    memory in use.  (C-4)
+        //
+        // Testing:
+        //   SequenceUtil_AttributeIndex
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SequenceUtil_AttributeIndex" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Index mX(&ta);  const Index& X = mX;
+
+            int id = -7;
+            ASSERT(0 == X.numAttributes());
+            ASSERT(0 != X.lookup(&id, "a", 1));
+            ASSERT(0 != X.lookup(&id, 0, 0));
+            ASSERT(-7 == id);
+
+            bsl::vector<bsl::string> names(&ta);
+            for (int i = 0; i < 100; ++i) {
+                char name[32];
+                bsl::sprintf(name, "n%d_", i * 7);
+                names.push_back(name);
+
+                mX.addAttribute(name,
+                                static_cast<int>(bsl::strlen(name)),
+                                i * 3);
+                ASSERTV(i, i + 1 == X.numAttributes());
+
+                for (int j = 0; j <= i; ++j) {
+                    const bsl::string& NAME = names[j];
+                    const int LENGTH = static_cast<int>(NAME.length());
+
+                    ASSERTV(i, j, 0 == X.lookup(&id, NAME.data(), LENGTH));
+                    ASSERTV(i, j, id, j * 3 == id);
+
+                    id = -7;
+                    ASSERTV(i, j, 0 != X.lookup(&id, NAME.data(),
+                                                LENGTH - 1));
+                    ASSERTV(i, j, 0 != X.lookup(&id,
+                                                (NAME + "_").data(),
+                                                LENGTH + 1));
+                    ASSERTV(i, j, -7 == id);
+                }
+            }
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.addAttribute("n0_", 3, 99);
+            ASSERT(100 == X.numAttributes());
+            ASSERT(0 == X.lookup(&id, "n0_", 3));
+            ASSERT(0 == id);
+
+            mX.addAttribute(0, 0, 42);
+            ASSERT(101 == X.numAttributes());
+            ASSERT(0 == X.lookup(&id, "", 0));
+            ASSERT(42 == id);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (veryVerbose) cout << "`install`." << endl;
+        {
+            bsls::AtomicOperations::AtomicTypes::Pointer slot = { 0 };
+
+            Index *first  = new (globalAllocator) Index(&globalAllocator);
+            Index *second = new (globalAllocator) Index(&globalAllocator);
+            second->addAttribute("a", 1, 1);
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                              globalAllocator.numBlocksInUse();
+
+            ASSERT(first == Index::install(&slot, first));
+            ASSERT(first == Index::install(&slot, second));
+
+            ASSERT(NUM_BLOCKS > globalAllocator.numBlocksInUse());
+
+            globalAllocator.deleteObject(first);
+        }
+        ASSERT(0 == globalAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Look up attributes of a basic sequence and a custom sequence,
+        //    and manipulate them by id.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        test::Point point;
+
+        int id;
+        ASSERT(0 == Util::lookupAttributeId(&id, point, "y", 1));
+        ASSERT(test::Point::ATTRIBUTE_ID_Y == id);
+
+        usage::SetIntAttribute manipulator(5);
+        ASSERT(0 == bdlat_SequenceFunctions::manipulateAttribute(&point,
+                                                                 manipulator,
+                                                                 id));
+        ASSERT(5 == point.y());
+
+        ASSERT(0 != Util::lookupAttributeId(&id, point, "z", 1));
+
+        const test::CustomSequence custom;
+        ASSERT(0 == Util::lookupAttributeId(&id, custom, "beta", 4));
+        ASSERT(2 == id);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Looking up the attributes of a type having many attributes with
+        //    `lookupAttributeId` is faster than with `lookupAttributeInfo`.
+        //
+        // Plan:
+        // 1. Time looking up each attribute of a type having 200 attributes
+        //    many times with each function, and report the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        typedef test::WideSequence Wide;
+
+        const int NUM_ITERATIONS = 10000;
+
+        bsl::vector<bsl::string> names;
+        for (int i = 0; i < Wide::k_NUM_ATTRIBUTES; ++i) {
+            char name[32];
+            bsl::sprintf(name, "field%d", i);
+            names.push_back(name);
+        }
+
+        const Wide object;
+
+        bsls::Stopwatch timer;
+        long long       sum = 0;
+
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            for (bsl::size_t i = 0; i < names.size(); ++i) {
+                sum += Wide::lookupAttributeInfo(
+                              names[i].data(),
+                              static_cast<int>(names[i].length()))->d_id;
+            }
+        }
+        timer.stop();
+        const double linearTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            for (bsl::size_t i = 0; i < names.size(); ++i) {
+                int id;
+                Util::lookupAttributeId(&id,
+                                        object,
+                                        names[i].data(),
+                                        static_cast<int>(names[i].length()));
+                sum -= id;
+            }
+        }
+        timer.stop();
+        const double indexTime = timer.elapsedTime();
+
+        ASSERT(0 == sum);
+
+        cout << "lookupAttributeInfo: " << linearTime << "s" << endl
+             << "lookupAttributeId:   " << indexTime  << "s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
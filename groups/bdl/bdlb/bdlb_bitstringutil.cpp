@@ -10,8 +10,9 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_alignmentfromtype.h>
-#include <bsls_annotation.h>
 #include <bsls_assert.h>
 #include <bsls_compilerfeatures.h>
 #include <bsls_keyword.h>
@@ -24,6 +25,18 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLB_BITSTRINGUTIL_AVX2_ENABLED 1
+#if (defined(BSLS_PLATFORM_CMP_GNU)   && BSLS_PLATFORM_CMP_VERSION >=  80000) \
+ || (defined(BSLS_PLATFORM_CMP_CLANG) && BSLS_PLATFORM_CMP_VERSION >= 100000)
+#define BDLB_BITSTRINGUTIL_AVX512_ENABLED 1
+#endif
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 using namespace BloombergLP;
 using bsl::size_t;
@@ -51,8 +64,6 @@ enum { k_ALIGNMENT       = 4 };
 enum { k_ALIGNMENT       = bsls::AlignmentFromType<uint64_t>::VALUE };
 #endif
 
-#define FALLTHROUGH BSLS_ANNOTATION_FALLTHROUGH
-
 BSLMF_ASSERT(sizeof(uint64_t) * CHAR_BIT == k_BITS_PER_UINT64);
 BSLMF_ASSERT(0 == (k_BITS_PER_UINT64 & (k_BITS_PER_UINT64 - 1))); // power of 2
 
@@ -129,6 +140,487 @@ unsigned int u32(uint64_t value)
     return static_cast<unsigned int>(value);
 }
 
+namespace {
+
+                            // ============
+                            // Word Kernels
+                            // ============
+
+// The functions in this section process whole, aligned `uint64_t` words of
+// bit strings, and are where the bulk of the time goes when operating on long
+// bit strings.  Each has a portable implementation and, on x86-64 with GCC or
+// Clang, implementations using AVX2 and AVX-512 instructions, compiled for
+// those instruction sets with `target` attributes regardless of the
+// instruction set the rest of the build targets.  `wordKernels` selects, once
+// per process, the fastest implementations the CPU supports.
+
+/// Alias for a function that applies a bitwise-logical operation between
+/// each of the specified `numWords` words starting at the specified `dst`
+/// and the corresponding word starting at the specified `src`, assigning the
+/// result to the word at `dst`.  The words are processed from low to high
+/// addresses, so the function is alias-safe provided `dst <= src`.
+typedef void (*RangeOpFn)(uint64_t       *dst,
+                          const uint64_t *src,
+                          size_t          numWords);
+
+/// Alias for a function that returns the number of 1 bits in the specified
+/// `numWords` words starting at the specified `words`.
+typedef size_t (*CountFn)(const uint64_t *words, size_t numWords);
+
+/// Alias for a function that returns the index of the first (or, depending
+/// on the function, the last) of the specified `numWords` words starting at
+/// the specified `words` that is not equal to the specified `pattern`, or
+/// `numWords` if there is no such word.
+typedef size_t (*ScanFn)(const uint64_t *words,
+                         size_t          numWords,
+                         uint64_t        pattern);
+
+/// This `struct` holds the implementations of the word kernels selected
+/// for the current CPU.
+struct WordKernels {
+
+    // DATA
+    RangeOpFn d_andEq;      // `dst &= src`
+    RangeOpFn d_minusEq;    // `dst &= ~src`
+    RangeOpFn d_orEq;       // `dst |= src`
+    RangeOpFn d_xorEq;      // `dst ^= src`
+    CountFn   d_num1;       // number of 1 bits
+    ScanFn    d_findFirst;  // first word not equal to `pattern`
+    ScanFn    d_findLast;   // last word not equal to `pattern`
+};
+
+/// Apply the bitwise-logical operation `OPER_DO_ALIGNED_WORD` between each
+/// of the specified `numWords` words starting at the specified `dst` and the
+/// corresponding word starting at the specified `src`.
+template <void OPER_DO_ALIGNED_WORD(uint64_t *, uint64_t)>
+void rangeOpScalar(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        OPER_DO_ALIGNED_WORD(&dst[ii], src[ii]);
+    }
+}
+
+/// Return the number of 1 bits in the specified `numWords` words starting at
+/// the specified `words`.
+size_t num1Scalar(const uint64_t *words, size_t numWords)
+{
+    size_t ret = 0;
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        ret += BitUtil::numBitsSet(words[ii]);
+    }
+    return ret;
+}
+
+/// Return the index of the first of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word.
+size_t findFirstScalar(const uint64_t *words,
+                       size_t          numWords,
+                       uint64_t        pattern)
+{
+    size_t ii = 0;
+    while (ii < numWords && pattern == words[ii]) {
+        ++ii;
+    }
+    return ii;
+}
+
+/// Return the index of the last of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word.
+size_t findLastScalar(const uint64_t *words,
+                      size_t          numWords,
+                      uint64_t        pattern)
+{
+    for (size_t ii = numWords; 0 < ii; --ii) {
+        if (pattern != words[ii - 1]) {
+            return ii - 1;                                            // RETURN
+        }
+    }
+    return numWords;
+}
+
+#ifdef BDLB_BITSTRINGUTIL_AVX2_ENABLED
+
+/// Bitwise-logical operations implemented by the SIMD kernels.
+enum Operation { e_AND, e_MINUS, e_OR, e_XOR };
+
+/// Apply the specified `OPERATION` between the specified `*dst` and `src`,
+/// assigning the result to `*dst`.
+template <Operation OPERATION>
+inline
+void applyToWord(uint64_t *dst, uint64_t src)
+{
+    switch (OPERATION) {
+      case e_AND:   *dst &=  src;                                      break;
+      case e_MINUS: *dst &= ~src;                                      break;
+      case e_OR:    *dst |=  src;                                      break;
+      case e_XOR:   *dst ^=  src;                                      break;
+    }
+}
+
+/// Return the 4 words starting at the specified `words`.
+__attribute__((target("avx2")))
+inline
+__m256i loadAvx2(const uint64_t *words)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words));
+}
+
+/// Apply the specified `OPERATION` between each of the specified `numWords`
+/// words starting at the specified `dst` and the corresponding word starting
+/// at the specified `src`, 4 words at a time.
+template <Operation OPERATION>
+__attribute__((target("avx2")))
+void rangeOpAvx2(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    size_t ii = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i dv = loadAvx2(dst + ii);
+        const __m256i sv = loadAvx2(src + ii);
+        __m256i       rv;
+        switch (OPERATION) {
+          case e_AND:   rv = _mm256_and_si256(dv, sv);                 break;
+          case e_MINUS: rv = _mm256_andnot_si256(sv, dv);              break;
+          case e_OR:    rv = _mm256_or_si256(dv, sv);                  break;
+          case e_XOR:   rv = _mm256_xor_si256(dv, sv);                 break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + ii), rv);
+    }
+    for (; ii < numWords; ++ii) {
+        applyToWord<OPERATION>(&dst[ii], src[ii]);
+    }
+}
+
+/// Return the number of 1 bits in the specified `numWords` words starting at
+/// the specified `words`.  Count the bits of each nibble with a table lookup
+/// (`vpshufb`), accumulating the per-byte counts for at most 31 vectors (at
+/// most 8 per byte per vector) before widening them to 64 bits.
+__attribute__((target("avx2")))
+size_t num1Avx2(const uint64_t *words, size_t numWords)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i zero   = _mm256_setzero_si256();
+
+    __m256i total = zero;
+    size_t  ii    = 0;
+    while (ii + 4 <= numWords) {
+        const size_t end = ii + 4 * bsl::min<size_t>(31, (numWords - ii) / 4);
+
+        __m256i bytes = zero;
+        for (; ii < end; ii += 4) {
+            const __m256i v  = loadAvx2(words + ii);
+            const __m256i lo = _mm256_and_si256(v, nibble);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4),
+                                                nibble);
+            bytes = _mm256_add_epi8(bytes,
+                                    _mm256_add_epi8(
+                                             _mm256_shuffle_epi8(lookup, lo),
+                                             _mm256_shuffle_epi8(lookup, hi)));
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, zero));
+    }
+
+    size_t ret = static_cast<size_t>(_mm256_extract_epi64(total, 0))
+               + static_cast<size_t>(_mm256_extract_epi64(total, 1))
+               + static_cast<size_t>(_mm256_extract_epi64(total, 2))
+               + static_cast<size_t>(_mm256_extract_epi64(total, 3));
+    for (; ii < numWords; ++ii) {
+        ret += BitUtil::numBitsSet(words[ii]);
+    }
+    return ret;
+}
+
+/// Return the index of the first of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word, comparing 4 words at a time.
+__attribute__((target("avx2")))
+size_t findFirstAvx2(const uint64_t *words,
+                     size_t          numWords,
+                     uint64_t        pattern)
+{
+    const __m256i p = _mm256_set1_epi64x(static_cast<long long>(pattern));
+
+    size_t ii = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i v    = loadAvx2(words + ii);
+        const int     same = _mm256_movemask_pd(
+                              _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, p)));
+        if (0xf != same) {
+            return ii + BitUtil::numTrailingUnsetBits(
+                                      static_cast<unsigned int>(~same));
+                                                                      // RETURN
+        }
+    }
+    return ii + findFirstScalar(words + ii, numWords - ii, pattern);
+}
+
+/// Return the index of the last of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word, comparing 4 words at a time.
+__attribute__((target("avx2")))
+size_t findLastAvx2(const uint64_t *words,
+                    size_t          numWords,
+                    uint64_t        pattern)
+{
+    const __m256i p = _mm256_set1_epi64x(static_cast<long long>(pattern));
+
+    size_t ii = numWords;
+    for (; ii >= 4; ii -= 4) {
+        const __m256i v    = loadAvx2(words + ii - 4);
+        const int     same = _mm256_movemask_pd(
+                              _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, p)));
+        if (0xf != same) {
+            return ii - 1 - (BitUtil::numLeadingUnsetBits(
+                                 static_cast<unsigned int>(~same & 0xf)) - 28);
+                                                                      // RETURN
+        }
+    }
+    const size_t ret = findLastScalar(words, ii, pattern);
+    return ret < ii ? ret : numWords;
+}
+
+#ifdef BDLB_BITSTRINGUTIL_AVX512_ENABLED
+
+/// Apply the specified `OPERATION` between each of the specified `numWords`
+/// words starting at the specified `dst` and the corresponding word starting
+/// at the specified `src`, 8 words at a time.
+template <Operation OPERATION>
+__attribute__((target("avx512f")))
+void rangeOpAvx512(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    // 'e_MINUS' complements 'src' explicitly, as '_mm512_andnot_si512'
+    // provokes spurious "uninitialized" warnings from GCC 12's headers.
+
+    const __m512i ones = _mm512_set1_epi64(-1);
+
+    size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m512i dv = _mm512_loadu_si512(dst + ii);
+        const __m512i sv = _mm512_loadu_si512(src + ii);
+        __m512i       rv;
+        switch (OPERATION) {
+          case e_AND:   rv = _mm512_and_si512(dv, sv);                 break;
+          case e_MINUS: rv = _mm512_and_si512(dv,
+                                              _mm512_xor_si512(sv, ones));
+                                                                       break;
+          case e_OR:    rv = _mm512_or_si512(dv, sv);                  break;
+          case e_XOR:   rv = _mm512_xor_si512(dv, sv);                 break;
+        }
+        _mm512_storeu_si512(dst + ii, rv);
+    }
+    for (; ii < numWords; ++ii) {
+        applyToWord<OPERATION>(&dst[ii], src[ii]);
+    }
+}
+
+/// Return the number of 1 bits in the specified `numWords` words starting at
+/// the specified `words`, using the `vpopcntq` instruction.
+__attribute__((target("avx512f,avx512vpopcntdq")))
+size_t num1Avx512(const uint64_t *words, size_t numWords)
+{
+    __m512i total = _mm512_setzero_si512();
+
+    size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        total = _mm512_add_epi64(total,
+                                 _mm512_popcnt_epi64(
+                                             _mm512_loadu_si512(words + ii)));
+    }
+
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, total);
+
+    size_t ret = 0;
+    for (int jj = 0; jj < 8; ++jj) {
+        ret += static_cast<size_t>(lanes[jj]);
+    }
+    for (; ii < numWords; ++ii) {
+        ret += BitUtil::numBitsSet(words[ii]);
+    }
+    return ret;
+}
+
+/// Return the index of the first of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word, comparing 8 words at a time.
+__attribute__((target("avx512f")))
+size_t findFirstAvx512(const uint64_t *words,
+                       size_t          numWords,
+                       uint64_t        pattern)
+{
+    const __m512i p = _mm512_set1_epi64(static_cast<long long>(pattern));
+
+    size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __mmask8 differ = _mm512_cmpneq_epi64_mask(
+                                        _mm512_loadu_si512(words + ii), p);
+        if (differ) {
+            return ii + BitUtil::numTrailingUnsetBits(
+                                         static_cast<unsigned int>(differ));
+                                                                      // RETURN
+        }
+    }
+    return ii + findFirstScalar(words + ii, numWords - ii, pattern);
+}
+
+/// Return the index of the last of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word, comparing 8 words at a time.
+__attribute__((target("avx512f")))
+size_t findLastAvx512(const uint64_t *words,
+                      size_t          numWords,
+                      uint64_t        pattern)
+{
+    const __m512i p = _mm512_set1_epi64(static_cast<long long>(pattern));
+
+    size_t ii = numWords;
+    for (; ii >= 8; ii -= 8) {
+        const __mmask8 differ = _mm512_cmpneq_epi64_mask(
+                                        _mm512_loadu_si512(words + ii - 8), p);
+        if (differ) {
+            return ii - 1 - (BitUtil::numLeadingUnsetBits(
+                                      static_cast<unsigned int>(differ)) - 24);
+                                                                      // RETURN
+        }
+    }
+    const size_t ret = findLastScalar(words, ii, pattern);
+    return ret < ii ? ret : numWords;
+}
+
+#endif  // BDLB_BITSTRINGUTIL_AVX512_ENABLED
+#endif  // BDLB_BITSTRINGUTIL_AVX2_ENABLED
+
+/// Return the word kernels best suited to the current CPU.
+WordKernels selectWordKernels()
+{
+    WordKernels ret = { &rangeOpScalar<Imp::andEqWord>,
+                        &rangeOpScalar<Imp::minusEqWord>,
+                        &rangeOpScalar<Imp::orEqWord>,
+                        &rangeOpScalar<Imp::xorEqWord>,
+                        &num1Scalar,
+                        &findFirstScalar,
+                        &findLastScalar };
+
+#ifdef BDLB_BITSTRINGUTIL_AVX2_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & bit_OSXSAVE)
+     || !(ecx & bit_AVX)) {
+        return ret;                                                   // RETURN
+    }
+
+    // Verify which register states the operating system saves: 'ymm' (bits
+    // 1-2) for AVX2, and, additionally, 'opmask' and 'zmm' (bits 5-7) for
+    // AVX-512.
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (0x6 != (xcr0Low & 0x6)
+     || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return ret;                                                   // RETURN
+    }
+
+    if (ebx & bit_AVX2) {
+        ret.d_andEq     = &rangeOpAvx2<e_AND>;
+        ret.d_minusEq   = &rangeOpAvx2<e_MINUS>;
+        ret.d_orEq      = &rangeOpAvx2<e_OR>;
+        ret.d_xorEq     = &rangeOpAvx2<e_XOR>;
+        ret.d_num1      = &num1Avx2;
+        ret.d_findFirst = &findFirstAvx2;
+        ret.d_findLast  = &findLastAvx2;
+    }
+
+#ifdef BDLB_BITSTRINGUTIL_AVX512_ENABLED
+    if ((ebx & bit_AVX512F) && 0xe6 == (xcr0Low & 0xe6)) {
+        ret.d_andEq     = &rangeOpAvx512<e_AND>;
+        ret.d_minusEq   = &rangeOpAvx512<e_MINUS>;
+        ret.d_orEq      = &rangeOpAvx512<e_OR>;
+        ret.d_xorEq     = &rangeOpAvx512<e_XOR>;
+        ret.d_findFirst = &findFirstAvx512;
+        ret.d_findLast  = &findLastAvx512;
+
+        if (ecx & bit_AVX512VPOPCNTDQ) {
+            ret.d_num1 = &num1Avx512;
+        }
+    }
+#endif
+#endif
+
+    return ret;
+}
+
+/// Return the word kernels, selected once per process, best suited to the
+/// current CPU.
+const WordKernels& wordKernels()
+{
+    static WordKernels s_kernels;
+    BSLMT_ONCE_DO {
+        s_kernels = selectWordKernels();
+    }
+    return s_kernels;
+}
+
+/// Apply the bitwise-logical operation named by the function between each of
+/// the specified `numWords` words starting at the specified `dst` and the
+/// corresponding word starting at the specified `src`, assigning the result
+/// to the word at `dst`.  The behavior is undefined unless `dst <= src` or
+/// the two ranges do not overlap.
+void andEqRange(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    wordKernels().d_andEq(dst, src, numWords);
+}
+
+void minusEqRange(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    wordKernels().d_minusEq(dst, src, numWords);
+}
+
+void orEqRange(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    wordKernels().d_orEq(dst, src, numWords);
+}
+
+void xorEqRange(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    wordKernels().d_xorEq(dst, src, numWords);
+}
+
+/// Assign each of the specified `numWords` words starting at the specified
+/// `src` to the corresponding word starting at the specified `dst`.
+void setEqRange(uint64_t *dst, const uint64_t *src, size_t numWords)
+{
+    bsl::memmove(dst, src, numWords * sizeof(uint64_t));
+}
+
+/// Return the index of the first of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word.
+inline
+size_t findFirstWordNotEqual(const uint64_t *words,
+                             size_t          numWords,
+                             uint64_t        pattern)
+{
+    return wordKernels().d_findFirst(words, numWords, pattern);
+}
+
+/// Return the index of the last of the specified `numWords` words starting
+/// at the specified `words` that is not equal to the specified `pattern`,
+/// or `numWords` if there is no such word.
+inline
+size_t findLastWordNotEqual(const uint64_t *words,
+                            size_t          numWords,
+                            uint64_t        pattern)
+{
+    return wordKernels().d_findLast(words, numWords, pattern);
+}
+
+}  // close unnamed namespace
+
 namespace {
 
                                 // ----------------
@@ -446,7 +938,7 @@ BitPtrDiff operator-(const BitPtr& lhs, const BitPtr& rhs)
 /// `move`, `left`, and `right` to apply bitwise-logical operations between
 /// bit strings.
 ///
-/// The two template arguments are functions:
+/// The three template arguments are functions:
 /// ```
 /// void OPER_DO_BITS(uint64_t *dstWord,
 ///                   int       dstIndex,
@@ -470,8 +962,20 @@ BitPtrDiff operator-(const BitPtr& lhs, const BitPtr& rhs)
 /// `OPER_DO_ALIGNED_WORD(dstWord, srcValue)` would have exactly the same
 /// effect as `OPER_DO_BITS(dstWord, 0, srcValue, k_BITS_PER_UINT64)`, but
 /// `OPER_DO_ALIGNED_WORD` is much more efficient in that case.
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t     )>
+///
+/// And:
+/// ```
+/// void OPER_DO_ALIGNED_RANGE(uint64_t       *dstWords,
+///                            const uint64_t *srcWords,
+///                            size_t          numWords);
+/// ```
+/// where `OPER_DO_ALIGNED_RANGE` applies `OPER_DO_ALIGNED_WORD` to each of
+/// `numWords` consecutive words of `dstWords` and `srcWords`, from low to
+/// high addresses.  `left` uses it when the source and the destination are
+/// both aligned, so that long ranges are handled by the word kernels.
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
 class Mover {
 
     // PRIVATE CLASS METHODS
@@ -563,10 +1067,13 @@ class Mover {
                      size_t          numBits);
 };
 
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
 inline
-void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::doPartialWord(
+void Mover<OPER_DO_BITS,
+           OPER_DO_ALIGNED_WORD,
+           OPER_DO_ALIGNED_RANGE>::doPartialWord(
                                                         uint64_t *dstBitString,
                                                         int       dstIndex,
                                                         uint64_t  srcValue,
@@ -597,10 +1104,13 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::doPartialWord(
     }
 }
 
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
 inline
-void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::doFullNonAlignedWord(
+void Mover<OPER_DO_BITS,
+           OPER_DO_ALIGNED_WORD,
+           OPER_DO_ALIGNED_RANGE>::doFullNonAlignedWord(
                                                         uint64_t *dstBitString,
                                                         int       dstIndex,
                                                         uint64_t  srcValue)
@@ -617,9 +1127,12 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::doFullNonAlignedWord(
     OPER_DO_BITS(dstBitString + 1,        0, srcValue >> dstLen, dstIndex);
 }
 
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
-void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::left(
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
+void Mover<OPER_DO_BITS,
+           OPER_DO_ALIGNED_WORD,
+           OPER_DO_ALIGNED_RANGE>::left(
                                                   uint64_t       *dstBitString,
                                                   size_t          dstIndex,
                                                   const uint64_t *srcBitString,
@@ -698,10 +1211,14 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::left(
     else {
         // The source and destination locations are both aligned.
 
-        for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-            OPER_DO_ALIGNED_WORD(&dstBitString[dstIndex++],
-                                 srcBitString[ srcIndex++]);
-        }
+        const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+        OPER_DO_ALIGNED_RANGE(&dstBitString[dstIndex],
+                              &srcBitString[ srcIndex],
+                              numWords);
+        dstIndex += numWords;
+        srcIndex += numWords;
+        numBits  -= numWords * k_BITS_PER_UINT64;
     }
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
@@ -717,9 +1234,12 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::left(
                   u32(numBits));
 }
 
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
-void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::right(
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
+void Mover<OPER_DO_BITS,
+           OPER_DO_ALIGNED_WORD,
+           OPER_DO_ALIGNED_RANGE>::right(
                                                   uint64_t       *dstBitString,
                                                   size_t          dstIndex,
                                                   const uint64_t *srcBitString,
@@ -843,10 +1363,13 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::right(
                   nb);
 }
 
-template <void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
-          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
+template <void OPER_DO_BITS(         uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD( uint64_t *,      uint64_t),
+          void OPER_DO_ALIGNED_RANGE(uint64_t *, const uint64_t *, size_t)>
 inline
-void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::move(
+void Mover<OPER_DO_BITS,
+           OPER_DO_ALIGNED_WORD,
+           OPER_DO_ALIGNED_RANGE>::move(
                                                   uint64_t       *dstBitString,
                                                   size_t          dstIndex,
                                                   const uint64_t *srcBitString,
@@ -1248,11 +1771,11 @@ void BitStringUtil::andEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::andEqBits, Imp::andEqWord>::move(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    Mover<Imp::andEqBits, Imp::andEqWord, andEqRange>::move(dstBitString,
+                                                            dstIndex,
+                                                            srcBitString,
+                                                            srcIndex,
+                                                            numBits);
 }
 
 void BitStringUtil::minusEqual(uint64_t       *dstBitString,
@@ -1264,11 +1787,11 @@ void BitStringUtil::minusEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::minusEqBits, Imp::minusEqWord>::move(dstBitString,
-                                                    dstIndex,
-                                                    srcBitString,
-                                                    srcIndex,
-                                                    numBits);
+    Mover<Imp::minusEqBits, Imp::minusEqWord, minusEqRange>::move(dstBitString,
+                                                                  dstIndex,
+                                                                  srcBitString,
+                                                                  srcIndex,
+                                                                  numBits);
 }
 
 void BitStringUtil::orEqual(uint64_t       *dstBitString,
@@ -1280,11 +1803,11 @@ void BitStringUtil::orEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::orEqBits, Imp::orEqWord>::move(dstBitString,
-                                              dstIndex,
-                                              srcBitString,
-                                              srcIndex,
-                                              numBits);
+    Mover<Imp::orEqBits, Imp::orEqWord, orEqRange>::move(dstBitString,
+                                                         dstIndex,
+                                                         srcBitString,
+                                                         srcIndex,
+                                                         numBits);
 }
 
 void BitStringUtil::xorEqual(uint64_t       *dstBitString,
@@ -1296,11 +1819,11 @@ void BitStringUtil::xorEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::xorEqBits, Imp::xorEqWord>::move(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    Mover<Imp::xorEqBits, Imp::xorEqWord, xorEqRange>::move(dstBitString,
+                                                            dstIndex,
+                                                            srcBitString,
+                                                            srcIndex,
+                                                            numBits);
 }
 
                             // Copy
@@ -1314,11 +1837,11 @@ void BitStringUtil::copy(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::setEqBits, Imp::setEqWord>::move(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    Mover<Imp::setEqBits, Imp::setEqWord, setEqRange>::move(dstBitString,
+                                                            dstIndex,
+                                                            srcBitString,
+                                                            srcIndex,
+                                                            numBits);
 }
 
 void BitStringUtil::copyRaw(uint64_t       *dstBitString,
@@ -1340,11 +1863,11 @@ void BitStringUtil::copyRaw(uint64_t       *dstBitString,
     }
 #endif
 
-    Mover<Imp::setEqBits, Imp::setEqWord>::left(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    Mover<Imp::setEqBits, Imp::setEqWord, setEqRange>::left(dstBitString,
+                                                            dstIndex,
+                                                            srcBitString,
+                                                            srcIndex,
+                                                            numBits);
 }
 
                             // Insert / Remove
@@ -1366,11 +1889,12 @@ void BitStringUtil::insertRaw(uint64_t *bitString,
         return;                                                       // RETURN
     }
 
-    Mover<Imp::setEqBits, Imp::setEqWord>::right(bitString,
-                                                 dstIndex + numBits,
-                                                 bitString,
-                                                 dstIndex,
-                                                 initialLength - dstIndex);
+    Mover<Imp::setEqBits, Imp::setEqWord, setEqRange>::right(
+                                                     bitString,
+                                                     dstIndex + numBits,
+                                                     bitString,
+                                                     dstIndex,
+                                                     initialLength - dstIndex);
 }
 
 void BitStringUtil::remove(uint64_t *bitString,
@@ -1392,11 +1916,11 @@ void BitStringUtil::remove(uint64_t *bitString,
 
     // Copy 'numBits' starting at 'index + numBits' to 'index'.
 
-    Mover<Imp::setEqBits, Imp::setEqWord>::left(bitString,
-                                                index,
-                                                bitString,
-                                                index + numBits,
-                                                remBits);
+    Mover<Imp::setEqBits, Imp::setEqWord, setEqRange>::left(bitString,
+                                                            index,
+                                                            bitString,
+                                                            index + numBits,
+                                                            remBits);
 }
 
                             // Other Manipulators
@@ -1796,18 +2320,16 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString, size_t length)
     const size_t lastWord =    (length - 1) / k_BITS_PER_UINT64;
     const int    endPos   = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    uint64_t     value    = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
-
-    for (size_t ii = lastWord; true; value = ~bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    const uint64_t value = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findLastWordNotEqual(bitString, lastWord, ~0ULL);
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(~bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
@@ -1821,20 +2343,33 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
         return k_INVALID_INDEX;                                       // RETURN
     }
 
-    const size_t beginWord =        begin / k_BITS_PER_UINT64;
+    const size_t beginWord =       begin  / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
     const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
     const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
 
     uint64_t     value     = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = ~bitString[--ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                            + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
         }
-    }
 
-    const int beginIdx = u32(begin) % k_BITS_PER_UINT64;
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findLastWordNotEqual(bitString + beginWord + 1,
+                                                     numWords,
+                                                     ~0ULL);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+            return word * k_BITS_PER_UINT64
+                               + Imp::find1AtMaxIndexRaw(~bitString[word]);
+                                                                      // RETURN
+        }
+
+        value = ~bitString[beginWord];
+    }
 
     value &= ge64Raw(beginIdx);
     return value
@@ -1851,19 +2386,17 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findFirstWordNotEqual(bitString, lastWord, ~0ULL);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = ~bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64
+                                 + Imp::find1AtMinIndexRaw(~bitString[ii]);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    value = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const uint64_t value = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -1887,11 +2420,24 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = ~bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                            + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t ii = beginWord + 1 + findFirstWordNotEqual(
+                                                 bitString + beginWord + 1,
+                                                 lastWord - beginWord - 1,
+                                                 ~0ULL);
+        if (ii < lastWord) {
+            return ii * k_BITS_PER_UINT64
+                                 + Imp::find1AtMinIndexRaw(~bitString[ii]);
+                                                                      // RETURN
+        }
+
+        value = ~bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -1911,18 +2457,16 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString, size_t length)
     const size_t lastWord =    (length - 1) / k_BITS_PER_UINT64;
     const int    endPos   = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    uint64_t     value    = bitString[lastWord] & BitMaskUtil::lt64(endPos);
-
-    for (size_t ii = lastWord; true; value = bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    const uint64_t value = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findLastWordNotEqual(bitString, lastWord, 0);
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
@@ -1936,18 +2480,32 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
         return k_INVALID_INDEX;                                       // RETURN
     }
 
-    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
-    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
     const size_t beginWord =       begin  / k_BITS_PER_UINT64;
     const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
 
-    uint64_t  value     = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    uint64_t     value     = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = bitString[--ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                            + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findLastWordNotEqual(bitString + beginWord + 1,
+                                                     numWords,
+                                                     0);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+            return word * k_BITS_PER_UINT64
+                               + Imp::find1AtMaxIndexRaw(bitString[word]);
+                                                                      // RETURN
+        }
+
+        value = bitString[beginWord];
     }
 
     value &= ge64Raw(beginIdx);
@@ -1965,19 +2523,17 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findFirstWordNotEqual(bitString, lastWord, 0);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64
+                                 + Imp::find1AtMinIndexRaw(bitString[ii]);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    value = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const uint64_t value = bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -2001,11 +2557,24 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                            + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t ii = beginWord + 1 + findFirstWordNotEqual(
+                                                 bitString + beginWord + 1,
+                                                 lastWord - beginWord - 1,
+                                                 0);
+        if (ii < lastWord) {
+            return ii * k_BITS_PER_UINT64
+                                 + Imp::find1AtMinIndexRaw(bitString[ii]);
+                                                                      // RETURN
+        }
+
+        value = bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -2034,11 +2603,13 @@ bool BitStringUtil::isAny0(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-        if (~bitString[++idx]) {
-            return true;                                              // RETURN
-        }
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+    if (findFirstWordNotEqual(bitString + idx + 1, numWords, ~0ULL) <
+                                                                   numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2068,12 +2639,12 @@ bool BitStringUtil::isAny1(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    while (numBits >= k_BITS_PER_UINT64) {
-        if (bitString[++idx]) {
-            return true;                                              // RETURN
-        }
-        numBits -= k_BITS_PER_UINT64;
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+    if (findFirstWordNotEqual(bitString + idx + 1, numWords, 0) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2110,57 +2681,17 @@ size_t BitStringUtil::num1(const uint64_t *bitString,
 
     // We have multiple words to traverse.  The first and last might be partial
     // words, so we have to mask them.  The words in between will all be full
-    // words.  Note that we are traversing from high-order to low-order words.
+    // words.
 
     const int endPos = u32(beginPos + numBits - 1) % k_BITS_PER_UINT64 + 1;
 
     size_t ret = BitUtil::numBitsSet(bitString[lastWord] &
                                                     BitMaskUtil::lt64(endPos));
 
-    // We now want to visit all the words not including the highest-order and
-    // lowest-order words in 'bitString'.  We set 'array' such that
-    // '&array[0] == &bitString[1]'.  The first word we will visit in this
-    // array (as we predecrement 'ii') will be
-    // 'array[lastWord - 2] == bitString[lastWord - 1]'.  The last element we
-    // will visit will be 'array[0] == bitString[1]'.  The initial value of
-    // 'ii' below will be the number of words between the first and last words
-    // that must be traversed, not including the first word or the last word.
+    // Now add the words between the highest-order and the lowest-order
+    // words.
 
-    BSLS_ASSERT(lastWord >= 1);    // therefore 'ii' below is >= 0 and can
-                                        // be represented as a 'size_t'
-
-    const uint64_t *array = bitString + 1;
-    size_t          ii    = lastWord
-                                     - 1  // word before last word
-                                     - 1  // adjust from 'bitString' to 'array'
-                                     + 1; // preparation for pre-decrement
-
-    while (ii >= 8) {
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-    }
-
-    BSLS_ASSERT(ii < 8);
-
-    switch (ii) {
-      case 7: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 6: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 5: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 4: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 3: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 2: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 1: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      default:                                                     break;
-    }
-
-    BSLS_ASSERT(0 == ii);
+    ret += wordKernels().d_num1(bitString + 1, lastWord - 1);
 
     // And we are now ready to look at the lowest-order word.
 
@@ -2268,6 +2799,9 @@ bsl::ostream& BitStringUtil::print(bsl::ostream&   stream,
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLB_BITSTRINGUTIL_AVX2_ENABLED
+#undef BDLB_BITSTRINGUTIL_AVX512_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2015 Bloomberg Finance L.P.
 //
@@ -218,6 +218,17 @@ BSLS_IDENT("$Id: $")
 //
 // ```
 //
+///Performance
+///-----------
+// On x86-64 platforms, the whole `uint64_t` words in the interior of a range
+// are processed by word kernels selected at run time according to the
+// instruction sets supported by the processor: AVX-512 (including
+// `VPOPCNTDQ` for counting), AVX2, or portable scalar code.  All kernels
+// produce identical results; the choice affects only the speed of operations
+// on long ranges.  Note that `assign`, `andEqual`, `minusEqual`, `orEqual`,
+// and `xorEqual` fall back to scalar code when the source and destination
+// overlap in a way that requires copying from the end of the range.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
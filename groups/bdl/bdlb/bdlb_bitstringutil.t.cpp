@@ -8,12 +8,14 @@
 #include <bsls_alignmentfromtype.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstddef.h>     // `bsl::size_t`
 #include <bsl_cstdlib.h>     // `bsl::rand`
@@ -81,7 +83,8 @@ using bsl::flush;
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
+// [23] CONCERN: long ranges give the same results as short ones.
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -961,7 +964,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1114,223 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 // ```
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING LONG BIT STRINGS
+        //   Long ranges of whole words are processed by word kernels that,
+        //   depending on the CPU, handle 1, 4, or 8 words at a time.
+        //
+        // Concerns:
+        // 1. The bitwise-logical operations, `num0`, `num1`, `isAny0`,
+        //    `isAny1`, and the find functions give the same results as the
+        //    oracles for ranges spanning any number of words, including
+        //    numbers of words that are not multiples of the kernel widths.
+        //
+        // 2. The bitwise-logical operations give the expected results when
+        //    the destination range overlaps the source range and starts at or
+        //    below it.
+        //
+        // 3. The find functions locate bits in any word of a long range,
+        //    including the first and last words and words in the middle of a
+        //    multi-word block.
+        //
+        // Plan:
+        // 1. For bit strings of 0 to 70 words, fill two bit strings with
+        //    pseudo-random values and apply each bitwise-logical operation,
+        //    with both aligned and unaligned indexes, comparing the result
+        //    with that of the oracle.  (C-1)
+        //
+        // 2. Repeat P-1 with the source range within the destination bit
+        //    string, at or above the destination range.  (C-2)
+        //
+        // 3. For bit strings of 0 to 70 words, filled with all 0 or all 1
+        //    bits except for a single bit of the opposite value at each of a
+        //    set of positions, verify the results of the accessors against
+        //    the oracles.  (C-1, 3)
+        //
+        // Testing:
+        //   CONCERN: long ranges give the same results as short ones.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LONG BIT STRINGS"
+                          << "\n========================" << endl;
+
+        enum { k_MAX_NUM_WORDS = 70 };
+
+        typedef void (*OperationFn)(uint64_t *, size_t,
+                                    const uint64_t *, size_t, size_t);
+
+        const OperationFn OPERATIONS[] = { &Util::andEqual,
+                                           &Util::minusEqual,
+                                           &Util::orEqual,
+                                           &Util::xorEqual };
+        const OperationFn ORACLES[]    = { &andOracle,
+                                           &minusOracle,
+                                           &orOracle,
+                                           &xorOracle };
+        enum { k_NUM_OPERATIONS = sizeof OPERATIONS / sizeof *OPERATIONS };
+
+        const size_t k_STRING_WORDS = k_MAX_NUM_WORDS + 2;
+
+        uint64_t control[k_STRING_WORDS];
+        uint64_t dst[k_STRING_WORDS];
+        uint64_t expected[k_STRING_WORDS];
+        uint64_t src[k_STRING_WORDS];
+
+        if (verbose) cout << "Bitwise-logical operations.\n";
+
+        for (size_t numWords = 0; numWords <= k_MAX_NUM_WORDS; ++numWords) {
+            const size_t INDEXES[] = { 0, 1, 63, 64 };
+            enum { k_NUM_INDEXES = sizeof INDEXES / sizeof *INDEXES };
+
+            for (int ti = 0; ti < k_NUM_INDEXES; ++ti) {
+            for (int tj = 0; tj < k_NUM_INDEXES; ++tj) {
+            for (int tk = 0; tk < k_NUM_OPERATIONS; ++tk) {
+                const size_t DST_IDX  = INDEXES[ti];
+                const size_t SRC_IDX  = INDEXES[tj];
+                const size_t NUM_BITS = numWords * k_BITS_PER_UINT64;
+
+                if (veryVerbose) { P_(numWords) P_(DST_IDX) P(SRC_IDX) }
+
+                fillWithGarbage(control, sizeof(control));
+                fillWithGarbage(src,     sizeof(src));
+
+                wordCpy(dst,      control, sizeof(dst));
+                wordCpy(expected, control, sizeof(expected));
+
+                OPERATIONS[tk](dst, DST_IDX, src, SRC_IDX, NUM_BITS);
+                ORACLES[tk](expected, DST_IDX, src, SRC_IDX, NUM_BITS);
+
+                ASSERTV(numWords, DST_IDX, SRC_IDX, tk,
+                        0 == wordCmp(dst, expected, sizeof(dst)));
+
+                // Overlapping ranges with the source at or above the
+                // destination.
+
+                if (SRC_IDX < DST_IDX) {
+                    continue;
+                }
+
+                const size_t OFFSET   = SRC_IDX - DST_IDX;
+                const size_t MAX_BITS = k_STRING_WORDS * k_BITS_PER_UINT64
+                                                            - DST_IDX - OFFSET;
+                const size_t NB       = bsl::min(NUM_BITS, MAX_BITS);
+
+                wordCpy(dst,      control, sizeof(dst));
+                wordCpy(expected, control, sizeof(expected));
+
+                OPERATIONS[tk](dst, DST_IDX, dst, SRC_IDX, NB);
+
+                // The oracles process one bit at a time from low to high
+                // indexes, so they are alias-safe for these ranges.
+
+                ORACLES[tk](expected, DST_IDX, expected, SRC_IDX, NB);
+
+                ASSERTV(numWords, DST_IDX, SRC_IDX, tk,
+                        0 == wordCmp(dst, expected, sizeof(dst)));
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "Accessors.\n";
+
+        for (size_t numWords = 1; numWords <= k_MAX_NUM_WORDS; ++numWords) {
+            const size_t NUM_BITS = numWords * k_BITS_PER_UINT64;
+
+            for (int fill = 0; fill < 2; ++fill) {
+                const uint64_t FILL  = fill ? ~0ULL : 0ULL;
+                const bool     VALUE = !fill;
+
+                // Positions of the single bit differing from `FILL`, the last
+                // of which (`NUM_BITS`) denotes no differing bit.
+
+                bsl::vector<size_t> positions;
+                for (size_t ii = 0; ii < numWords; ++ii) {
+                    positions.push_back(ii * k_BITS_PER_UINT64);
+                    positions.push_back(ii * k_BITS_PER_UINT64 + 37);
+                }
+                positions.push_back(NUM_BITS - 1);
+                positions.push_back(NUM_BITS);
+
+                for (size_t tp = 0; tp < positions.size(); ++tp) {
+                    const size_t POS = positions[tp];
+
+                    bsl::fill(dst, dst + k_STRING_WORDS, FILL);
+                    if (POS < NUM_BITS) {
+                        Util::assign(dst, POS, VALUE);
+                    }
+
+                    const size_t BEGINS[] = { 0, 1, 64, 100 };
+                    enum { k_NUM_BEGINS = sizeof BEGINS / sizeof *BEGINS };
+
+                    for (int tb = 0; tb < k_NUM_BEGINS; ++tb) {
+                        const size_t BEGIN = bsl::min(BEGINS[tb], NUM_BITS);
+                        const size_t ENDS[] = { NUM_BITS,
+                                                NUM_BITS - 1,
+                                                NUM_BITS - 64 };
+                        enum { k_NUM_ENDS = sizeof ENDS / sizeof *ENDS };
+
+                        for (int te = 0; te < k_NUM_ENDS; ++te) {
+                            if (ENDS[te] > NUM_BITS || ENDS[te] < BEGIN) {
+                                continue;
+                            }
+                            const size_t END = ENDS[te];
+                            const size_t NB  = END - BEGIN;
+
+                            if (veryVerbose) {
+                                P_(numWords) P_(FILL) P_(POS) P_(BEGIN) P(END)
+                            }
+
+                            const size_t EXP_NUM1 = countOnes(dst, BEGIN, NB);
+
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    EXP_NUM1 == Util::num1(dst, BEGIN, NB));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    NB - EXP_NUM1 ==
+                                                 Util::num0(dst, BEGIN, NB));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    (0 < EXP_NUM1) ==
+                                               Util::isAny1(dst, BEGIN, NB));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    (EXP_NUM1 < NB) ==
+                                               Util::isAny0(dst, BEGIN, NB));
+
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    findAtMinOracle(dst, BEGIN, END, true) ==
+                                       Util::find1AtMinIndex(dst, BEGIN, END));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    findAtMaxOracle(dst, BEGIN, END, true) ==
+                                       Util::find1AtMaxIndex(dst, BEGIN, END));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    findAtMinOracle(dst, BEGIN, END, false) ==
+                                       Util::find0AtMinIndex(dst, BEGIN, END));
+                            ASSERTV(numWords, POS, BEGIN, END,
+                                    findAtMaxOracle(dst, BEGIN, END, false) ==
+                                       Util::find0AtMaxIndex(dst, BEGIN, END));
+
+                            if (0 != BEGIN) {
+                                continue;
+                            }
+
+                            ASSERTV(numWords, POS, END,
+                                    findAtMinOracle(dst, 0, END, true) ==
+                                            Util::find1AtMinIndex(dst, END));
+                            ASSERTV(numWords, POS, END,
+                                    findAtMaxOracle(dst, 0, END, true) ==
+                                            Util::find1AtMaxIndex(dst, END));
+                            ASSERTV(numWords, POS, END,
+                                    findAtMinOracle(dst, 0, END, false) ==
+                                            Util::find0AtMinIndex(dst, END));
+                            ASSERTV(numWords, POS, END,
+                                    findAtMaxOracle(dst, 0, END, false) ==
+                                            Util::find0AtMaxIndex(dst, END));
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING `find1AtMinIndex` METHODS
@@ -6007,6 +6227,71 @@ int main(int argc, char *argv[])
 
         if (veryVerbose) P(k_ALIGNMENT);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: LONG BIT STRINGS
+        //
+        // Concerns:
+        // 1. Operations on long bit strings run at close to memory bandwidth.
+        //
+        // Plan:
+        // 1. Time the bitwise-logical operations, `num1`, and
+        //    `find1AtMinIndex` on bit strings of 100 million bits, and report
+        //    the throughput.  (C-1)
+        //
+        // Testing:
+        //   BENCHMARK: LONG BIT STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBENCHMARK: LONG BIT STRINGS"
+                          << "\n===========================" << endl;
+
+        const size_t k_NUM_BITS  = 100 * 1000 * 1000;
+        const size_t k_NUM_WORDS = (k_NUM_BITS + k_BITS_PER_UINT64 - 1) /
+                                                             k_BITS_PER_UINT64;
+        const int    k_NUM_ITERATIONS = 20;
+
+        bsl::vector<uint64_t> lhs(k_NUM_WORDS);
+        bsl::vector<uint64_t> rhs(k_NUM_WORDS);
+        fillWithGarbage(lhs.data(), k_NUM_WORDS * sizeof(uint64_t));
+        fillWithGarbage(rhs.data(), k_NUM_WORDS * sizeof(uint64_t));
+
+        const double k_BYTES = static_cast<double>(k_NUM_WORDS) *
+                                          sizeof(uint64_t) * k_NUM_ITERATIONS;
+
+        bsls::Stopwatch sw;
+
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+            Util::xorEqual(lhs.data(), 0, rhs.data(), 0, k_NUM_BITS);
+            Util::orEqual(lhs.data(), 0, rhs.data(), 0, k_NUM_BITS);
+        }
+        sw.stop();
+        cout << "xorEqual + orEqual: "
+             << 2 * k_BYTES / sw.accumulatedWallTime() / 1e9 << " GB/s\n";
+
+        size_t count = 0;
+        sw.reset();
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+            count += Util::num1(lhs.data(), 0, k_NUM_BITS);
+        }
+        sw.stop();
+        cout << "num1:               "
+             << k_BYTES / sw.accumulatedWallTime() / 1e9 << " GB/s\n";
+
+        bsl::fill(lhs.begin(), lhs.end(), 0ULL);
+        sw.reset();
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+            count += Util::find1AtMinIndex(lhs.data(), k_NUM_BITS);
+        }
+        sw.stop();
+        cout << "find1AtMinIndex:    "
+             << k_BYTES / sw.accumulatedWallTime() / 1e9 << " GB/s\n";
+
+        if (veryVerbose) { P(count) }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND.\n";
         testStatus = -1;
@@ -0,0 +1,407 @@
+// bdlb_numericformatutil.cpp                                         -*-C++-*-
+#include <bdlb_numericformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_numericformatutil_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#include <emmintrin.h>
+#define BDLB_NUMERICFORMATUTIL_SSE2 1
+#endif
+
+// IMPLEMENTATION NOTES: Integers are converted to decimal by 'writeDecimal',
+// which, where SSE2 is available, splits the value into (at most three)
+// groups of at most 8 digits and converts each 8 digit group into 8 16-bit
+// lanes of an SSE register (using the technique from Wojciech Mula's and Milo
+// Yip's SSE2 'itoa' implementations).  The lanes of the (at most two) groups
+// are then packed into bytes and offset by '0' in one step.  Leading zeros
+// of the most significant group are dropped by shifting the 64-bit word
+// holding its 8 characters, so no branch depends on the number of digits.
+// Every group is stored 8 (or 16) bytes at a time, which is why 'writeDecimal'
+// is used only when there are at least 'k_MAX_DECIMAL_STORE' bytes of room.
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef bsls::Types::Uint64   Uint64;
+typedef bslalg::NumericFormatterUtil NfUtil;
+
+enum {
+    k_MAX_DECIMAL_STORE = 21
+        // Maximum number of bytes, starting at the output position, that
+        // 'writeDecimal' may store into (a sign, up to 4 leading digits and
+        // a 16 byte store).
+};
+
+#ifdef BDLB_NUMERICFORMATUTIL_SSE2
+
+/// Return a vector holding, in its 8 16-bit lanes, the 8 decimal digits of
+/// the specified `value`, most significant first.  The behavior is
+/// undefined unless `value < 100000000`.
+inline
+__m128i convert8Digits(unsigned value)
+{
+    // 'abcd' and 'efgh' are 'value / 10000' and 'value % 10000'.
+
+    const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(value));
+    const __m128i abcd     = _mm_srli_epi64(
+                   _mm_mul_epu32(abcdefgh,
+                                 _mm_set1_epi32(static_cast<int>(0xd1b71759))),
+                   45);
+    const __m128i efgh     = _mm_sub_epi32(
+                           abcdefgh,
+                           _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+
+    // Broadcast 'abcd * 4' to the low 4 lanes, and 'efgh * 4' to the high 4
+    // lanes, then divide by 1000, 100, 10, and 1 to get 'a', 'ab', 'abc',
+    // 'abcd' (and likewise for 'efgh') using multiplications by reciprocals.
+
+    const __m128i v1  = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+    const __m128i v2a = _mm_unpacklo_epi16(v1, v1);
+    const __m128i v2  = _mm_unpacklo_epi32(v2a, v2a);
+
+    const __m128i v3  = _mm_mulhi_epu16(
+                              v2,
+                              _mm_setr_epi16(8389,
+                                             5243,
+                                             13108,
+                                             static_cast<short>(0x8000),
+                                             8389,
+                                             5243,
+                                             13108,
+                                             static_cast<short>(0x8000)));
+    const __m128i v4  = _mm_mulhi_epu16(
+                              v3,
+                              _mm_setr_epi16(1 << 7,
+                                             1 << 11,
+                                             1 << 13,
+                                             static_cast<short>(1 << 15),
+                                             1 << 7,
+                                             1 << 11,
+                                             1 << 13,
+                                             static_cast<short>(1 << 15)));
+
+    // Subtract 10 times the previous lane ('ab - a * 10 == b', etc.).
+
+    const __m128i v5  = _mm_mullo_epi16(v4, _mm_set1_epi16(10));
+    const __m128i v6  = _mm_slli_epi64(v5, 16);
+
+    return _mm_sub_epi16(v4, v6);
+}
+
+/// Return the ASCII digits of the 8 digit groups in the specified `high` and
+/// `low` vectors (as returned by `convert8Digits`), `high` in the low 8
+/// bytes of the result.
+inline
+__m128i toAscii(__m128i high, __m128i low)
+{
+    return _mm_add_epi8(_mm_packus_epi16(high, low), _mm_set1_epi8('0'));
+}
+
+/// Store the specified `digits`, the 8 ASCII digits of a group (the most
+/// significant digit in the least significant byte), at the specified `out`
+/// without the leading zeros of the group, and return the address one past
+/// the last digit.  If `digits` are all zeros, store one zero.  Note that 8
+/// bytes are stored regardless of the number of digits.
+inline
+char *storeLeadingGroup(char *out, Uint64 digits)
+{
+    // Bytes holding '0' become 0, and the highest byte is forced nonzero so
+    // that at least one digit remains.
+
+    const Uint64 nonZero = (digits ^ 0x3030303030303030ULL)
+                         | 0x0100000000000000ULL;
+    const int    numLeadingZeros =
+                              bdlb::BitUtil::numTrailingUnsetBits(nonZero) / 8;
+
+    digits >>= 8 * numLeadingZeros;
+    bsl::memcpy(out, &digits, 8);
+
+    return out + 8 - numLeadingZeros;
+}
+
+/// Write the decimal representation of the specified `value` to the
+/// specified `out`, and return the address one past the last digit.  Note
+/// that up to `k_MAX_DECIMAL_STORE - 1` bytes starting at `out` may be
+/// written to.
+inline
+char *writeDecimal(char *out, Uint64 value)
+{
+    const Uint64 k_1E8  = 100000000ULL;
+    const Uint64 k_1E16 = k_1E8 * k_1E8;
+
+    if (value < k_1E8) {
+        const __m128i digits = toAscii(
+                                 convert8Digits(static_cast<unsigned>(value)),
+                                 _mm_setzero_si128());
+        return storeLeadingGroup(out, _mm_cvtsi128_si64(digits));     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_1E16 <= value)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // At most 4 leading digits, then 16 digits.
+
+        const unsigned leading = static_cast<unsigned>(value / k_1E16);
+        value %= k_1E16;
+
+        const __m128i leadingDigits = toAscii(convert8Digits(leading),
+                                              _mm_setzero_si128());
+        out = storeLeadingGroup(out, _mm_cvtsi128_si64(leadingDigits));
+
+        const unsigned high = static_cast<unsigned>(value / k_1E8);
+        const unsigned low  = static_cast<unsigned>(value % k_1E8);
+
+        const __m128i digits = toAscii(convert8Digits(high),
+                                       convert8Digits(low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), digits);
+
+        return out + 16;                                              // RETURN
+    }
+
+    const unsigned high = static_cast<unsigned>(value / k_1E8);
+    const unsigned low  = static_cast<unsigned>(value % k_1E8);
+
+    const __m128i digits = toAscii(convert8Digits(high), convert8Digits(low));
+
+    out = storeLeadingGroup(out, _mm_cvtsi128_si64(digits));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out),
+                     _mm_srli_si128(digits, 8));
+
+    return out + 8;
+}
+
+#else
+
+inline
+char *writeDecimal(char *out, Uint64 value)
+{
+    return NfUtil::toChars(out, out + k_MAX_DECIMAL_STORE, value);
+}
+
+#endif
+
+/// Write the decimal representation of the specified `value` to the
+/// specified `out`, and return the address one past the last character.
+/// Note that up to `k_MAX_DECIMAL_STORE` bytes starting at `out` may be
+/// written to.
+template <class INTEGER>
+inline
+char *writeSigned(char *out, INTEGER value)
+{
+    Uint64 magnitude = static_cast<Uint64>(value);
+    if (value < 0) {
+        magnitude = ~magnitude + 1;
+        *out++    = '-';
+    }
+    return writeDecimal(out, magnitude);
+}
+
+/// Write the specified `separator` to the specified `*first`, advancing
+/// `*first` past it, and return `true`, if the specified `last` leaves
+/// enough room; return `false` otherwise.
+inline
+bool writeSeparator(char                    **first,
+                    char                     *last,
+                    const bsl::string_view&   separator)
+{
+    const bsl::size_t length = separator.length();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                         static_cast<bsl::size_t>(last - *first) < length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return false;                                                 // RETURN
+    }
+
+    if (1 == length) {
+        **first = separator[0];
+    }
+    else {
+        bsl::memcpy(*first, separator.data(), length);
+    }
+    *first += length;
+
+    return true;
+}
+
+/// Implement `formatArray` for the (template parameter) `INTEGER` type.
+template <class INTEGER>
+char *formatIntegers(char                    *first,
+                     char                    *last,
+                     const INTEGER           *values,
+                     bsl::size_t              numValues,
+                     const bsl::string_view&  separator)
+{
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (0 != i && !writeSeparator(&first, last, separator)) {
+            return 0;                                                 // RETURN
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                      last - first >= k_MAX_DECIMAL_STORE)) {
+            first = writeSigned(first, values[i]);
+        }
+        else {
+            // Near the end of the output area, format exactly.
+
+            first = NfUtil::toChars(first, last, values[i]);
+            if (0 == first) {
+                return 0;                                             // RETURN
+            }
+        }
+    }
+
+    return first;
+}
+
+/// Implement `formatArray` for the (template parameter) `FLOATING` type.
+template <class FLOATING>
+char *formatFloatingPoints(char                    *first,
+                           char                    *last,
+                           const FLOATING          *values,
+                           bsl::size_t              numValues,
+                           const bsl::string_view&  separator)
+{
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (0 != i && !writeSeparator(&first, last, separator)) {
+            return 0;                                                 // RETURN
+        }
+
+        first = NfUtil::toChars(first, last, values[i]);
+        if (0 == first) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return first;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlb {
+
+                          // ------------------------
+                          // struct NumericFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+char *NumericFormatUtil::formatArray(char                    *first,
+                                     char                    *last,
+                                     const int               *values,
+                                     bsl::size_t              numValues,
+                                     const bsl::string_view&  separator)
+{
+    return u::formatIntegers(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatArray(char                    *first,
+                                     char                    *last,
+                                     const unsigned int      *values,
+                                     bsl::size_t              numValues,
+                                     const bsl::string_view&  separator)
+{
+    return u::formatIntegers(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatArray(char                     *first,
+                                     char                     *last,
+                                     const bsls::Types::Int64 *values,
+                                     bsl::size_t               numValues,
+                                     const bsl::string_view&   separator)
+{
+    return u::formatIntegers(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatArray(char                      *first,
+                                     char                      *last,
+                                     const bsls::Types::Uint64 *values,
+                                     bsl::size_t                numValues,
+                                     const bsl::string_view&    separator)
+{
+    return u::formatIntegers(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatArray(char                    *first,
+                                     char                    *last,
+                                     const float             *values,
+                                     bsl::size_t              numValues,
+                                     const bsl::string_view&  separator)
+{
+    return u::formatFloatingPoints(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatArray(char                    *first,
+                                     char                    *last,
+                                     const double            *values,
+                                     bsl::size_t              numValues,
+                                     const bsl::string_view&  separator)
+{
+    return u::formatFloatingPoints(first, last, values, numValues, separator);
+}
+
+char *NumericFormatUtil::formatFixedArray(char                    *first,
+                                          char                    *last,
+                                          const double            *values,
+                                          bsl::size_t              numValues,
+                                          int                      precision,
+                                          const bsl::string_view&  separator)
+{
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(0 <= precision);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    typedef bslalg::NumericFormatterUtil NfUtil;
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (0 != i && !u::writeSeparator(&first, last, separator)) {
+            return 0;                                                 // RETURN
+        }
+
+        first = NfUtil::toChars(first,
+                                last,
+                                values[i],
+                                NfUtil::e_FIXED,
+                                precision);
+        if (0 == first) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return first;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BDLB_NUMERICFORMATUTIL_SSE2
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
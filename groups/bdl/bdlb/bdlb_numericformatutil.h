@@ -0,0 +1,256 @@
+// bdlb_numericformatutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICFORMATUTIL
+#define INCLUDED_BDLB_NUMERICFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functions to format arrays of numbers into one buffer.
+//
+//@CLASSES:
+//  bdlb::NumericFormatUtil: namespace for bulk number formatting functions
+//
+//@SEE_ALSO: bslalg_numericformatterutil, bdlb_numericparseutil
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlb::NumericFormatUtil`,
+// that serves as a namespace for functions that write the decimal textual
+// representations of a whole array of numbers, separated by a caller-supplied
+// separator, into a single character buffer.  Each value is rendered exactly
+// as `bslalg::NumericFormatterUtil::toChars` renders it: integers in base 10,
+// and floating point values in the shortest representation that round-trips
+// (see {`bslalg_numericformatterutil`|Default Floating Point Format}).
+// Additionally, `formatFixedArray` writes `double` values with a fixed number
+// of digits after the radix mark, as `printf` does for "%.*f", without going
+// through the shortest round-trip representation.
+//
+// Like `toChars`, the functions take the output area as a `[first, last)`
+// range, return the address one past the last character written, and return
+// 0 if the output area is too small.  The `maxArrayLength` and
+// `maxFixedArrayLength` functions return an output area size with which the
+// corresponding formatting function never fails.  None of the functions
+// null-terminate the result.
+//
+///Performance
+///-----------
+// Formatting a whole array at once avoids a function call, a bounds check,
+// and (typically) a stream insertion per value.  Where the target supports
+// SSE2, integers having 8 or more digits are converted 8 digits at a time
+// using SIMD instructions; note that these conversions may write scratch
+// characters (up to 21 bytes past the current position) into the part of
+// the output area following the result, so the contents of `[first, last)`
+// past the returned address are unspecified.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Row of Numbers as CSV
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to write a row of a comma-separated values (CSV) file from
+// an array of measurements.
+//
+// First, we describe the measurements:
+// ```
+// const double measurements[] = { 1.5, -0.25, 1e21, 3 };
+// const int    numMeasurements = sizeof measurements / sizeof *measurements;
+// ```
+// Then, we create a buffer large enough for any values of this type:
+// ```
+// typedef bdlb::NumericFormatUtil Util;
+//
+// bsl::vector<char> buffer(Util::maxArrayLength<double>(numMeasurements, 1));
+// ```
+// Next, we format the row:
+// ```
+// char *end = Util::formatArray(buffer.data(),
+//                               buffer.data() + buffer.size(),
+//                               measurements,
+//                               numMeasurements,
+//                               ",");
+// assert(0 != end);
+// assert(bsl::string_view(buffer.data(), end - buffer.data()) ==
+//                                                        "1.5,-0.25,1e+21,3");
+// ```
+// Finally, we write the same values with exactly two decimals:
+// ```
+// buffer.resize(Util::maxFixedArrayLength(numMeasurements, 2, 1));
+//
+// end = Util::formatFixedArray(buffer.data(),
+//                              buffer.data() + buffer.size(),
+//                              measurements,
+//                              numMeasurements,
+//                              2,
+//                              ",");
+// assert(0 != end);
+// assert(bsl::string_view(buffer.data(), end - buffer.data()) ==
+//                          "1.50,-0.25,1000000000000000000000.00,3.00");
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // ========================
+                          // struct NumericFormatUtil
+                          // ========================
+
+/// This `struct` provides a namespace for functions that format arrays of
+/// numbers into a single character buffer.
+struct NumericFormatUtil {
+
+    // CLASS METHODS
+
+    /// Return the number of characters sufficient for `formatArray` to
+    /// format any `numValues` values of the (template parameter) `TYPE`
+    /// separated by a separator of the specified `separatorLength`.  The
+    /// behavior is undefined unless `TYPE` is supported by `formatArray` and
+    /// the result does not overflow.
+    template <class TYPE>
+    static bsl::size_t maxArrayLength(bsl::size_t numValues,
+                                      bsl::size_t separatorLength);
+
+    /// Return the number of characters sufficient for `formatFixedArray` to
+    /// format any `numValues` values with the specified `precision`
+    /// separated by a separator of the specified `separatorLength`.  The
+    /// behavior is undefined unless `0 <= precision` and the result does not
+    /// overflow.
+    static bsl::size_t maxFixedArrayLength(bsl::size_t numValues,
+                                           int         precision,
+                                           bsl::size_t separatorLength);
+
+    /// Write the textual representation (in base 10, or the shortest
+    /// round-trip representation for floating point values) of each of the
+    /// specified `numValues` elements of the specified `values` array,
+    /// separated by the specified `separator`, into the character buffer
+    /// starting at the specified `first` and ending at the specified
+    /// `last`, `last` not included.  Return the address one past the last
+    /// character written on success, or 0 if the range `[first, last)` is
+    /// not large enough to contain the result (in which case the contents
+    /// of the range are unspecified).  Each value is rendered exactly as
+    /// `bslalg::NumericFormatterUtil::toChars` renders it.  The behavior is
+    /// undefined unless `first <= last` and `values` refers to an array of
+    /// at least `numValues` elements.  Note that the contents of the range
+    /// following the returned address are unspecified.
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const int                 *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const unsigned int        *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const bsls::Types::Int64  *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const bsls::Types::Uint64 *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const float               *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+    static char *formatArray(char                      *first,
+                             char                      *last,
+                             const double              *values,
+                             bsl::size_t                numValues,
+                             const bsl::string_view&    separator);
+
+    /// Write the textual representation of each of the specified
+    /// `numValues` elements of the specified `values` array with exactly the
+    /// specified `precision` digits after the radix mark (see
+    /// {`bslalg_numericformatterutil`|Fixed Precision Floating Point
+    /// Formats}), separated by the specified `separator`, into the
+    /// character buffer starting at the specified `first` and ending at the
+    /// specified `last`, `last` not included.  Return the address one past
+    /// the last character written on success, or 0 if the range
+    /// `[first, last)` is not large enough to contain the result (in which
+    /// case the contents of the range are unspecified).  The behavior is
+    /// undefined unless `first <= last`, `0 <= precision`, and `values`
+    /// refers to an array of at least `numValues` elements.
+    static char *formatFixedArray(char                    *first,
+                                  char                    *last,
+                                  const double            *values,
+                                  bsl::size_t              numValues,
+                                  int                      precision,
+                                  const bsl::string_view&  separator);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // struct NumericFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+bsl::size_t NumericFormatUtil::maxArrayLength(bsl::size_t numValues,
+                                              bsl::size_t separatorLength)
+{
+    typedef bslalg::NumericFormatterUtil NfUtil;
+
+    if (0 == numValues) {
+        return 0;                                                     // RETURN
+    }
+
+    return numValues * NfUtil::ToCharsMaxLength<TYPE>::k_VALUE +
+                                            (numValues - 1) * separatorLength;
+}
+
+inline
+bsl::size_t NumericFormatUtil::maxFixedArrayLength(
+                                                 bsl::size_t numValues,
+                                                 int         precision,
+                                                 bsl::size_t separatorLength)
+{
+    BSLS_ASSERT(0 <= precision);
+
+    if (0 == numValues) {
+        return 0;                                                     // RETURN
+    }
+
+    // See {`bslalg_numericformatterutil`|Fixed Precision Floating Point
+    // Formats} for the maximum length of one value.
+
+    return numValues * (static_cast<bsl::size_t>(precision) + 311) +
+                                            (numValues - 1) * separatorLength;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,913 @@
+// bdlb_numericformatutil.t.cpp                                       -*-C++-*-
+#include <bdlb_numericformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test formats arrays of numbers into a single buffer.
+// Every value must be rendered exactly as
+// `bslalg::NumericFormatterUtil::toChars` renders it, so the functions are
+// tested against an oracle that calls `toChars` once per value and joins the
+// results with the separator.  We use both tables of boundary values (in
+// particular values around every power of 10, where the SIMD integer
+// conversion changes the number of digit groups) and pseudo-random values,
+// and we verify that output areas one character too small are rejected.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_t maxArrayLength<TYPE>(numValues, separatorLength);
+// [ 2] size_t maxFixedArrayLength(numValues, precision, separatorLength);
+// [ 3] char *formatArray(first, last, const int *, size_t, string_view);
+// [ 3] char *formatArray(first, last, const unsigned *, size_t, sv);
+// [ 3] char *formatArray(first, last, const Int64 *, size_t, string_view);
+// [ 3] char *formatArray(first, last, const Uint64 *, size_t, sv);
+// [ 4] char *formatArray(first, last, const float *, size_t, string_view);
+// [ 4] char *formatArray(first, last, const double *, size_t, sv);
+// [ 5] char *formatFixedArray(first, last, const double *, n, prec, sv);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: INTEGER ARRAYS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        bsl::cout << "Error " __FILE__ "(" << line << "): " << message
+                  << "    (failed)" << bsl::endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericFormatUtil      Util;
+typedef bslalg::NumericFormatterUtil NfUtil;
+typedef bsls::Types::Int64           Int64;
+typedef bsls::Types::Uint64          Uint64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the next value of a 64-bit xorshift pseudo-random sequence whose
+/// state is held in the specified `state`.
+Uint64 nextRandom(Uint64 *state)
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/// Return a pseudo-random value of the (template parameter) `INTEGER` type
+/// drawn using the specified `state`, having a pseudo-random number of
+/// significant bits so that all digit counts are well represented.
+template <class INTEGER>
+INTEGER randomInteger(Uint64 *state)
+{
+    Uint64         bits     = nextRandom(state);
+    const unsigned numBits  = static_cast<unsigned>(nextRandom(state) % 65);
+
+    if (numBits < 64) {
+        bits &= (1ULL << numBits) - 1;
+    }
+    return static_cast<INTEGER>(bits);
+}
+
+/// Return a pseudo-random finite value of the (template parameter)
+/// `FLOATING` type drawn from all bit patterns using the specified `state`.
+template <class FLOATING>
+FLOATING randomFinite(Uint64 *state)
+{
+    FLOATING result;
+    do {
+        const Uint64 bits = nextRandom(state);
+        bsl::memcpy(&result, &bits, sizeof result);
+    } while (result != result || result - result != 0);
+
+    return result;
+}
+
+/// Return the concatenation of the `toChars` representations of the
+/// specified `numValues` elements of the specified `values`, separated by
+/// the specified `separator`.
+template <class TYPE>
+bsl::string oracle(const TYPE              *values,
+                   bsl::size_t              numValues,
+                   const bsl::string_view&  separator)
+{
+    bsl::string result;
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (i) {
+            result.append(separator.data(), separator.length());
+        }
+        char  buffer[NfUtil::ToCharsMaxLength<TYPE>::k_VALUE];
+        char *end = NfUtil::toChars(buffer, buffer + sizeof buffer, values[i]);
+        result.append(buffer, end);
+    }
+    return result;
+}
+
+/// Return the concatenation of the fixed `toChars` representations with the
+/// specified `precision` of the specified `numValues` elements of the
+/// specified `values`, separated by the specified `separator`.
+bsl::string fixedOracle(const double            *values,
+                        bsl::size_t              numValues,
+                        int                      precision,
+                        const bsl::string_view&  separator)
+{
+    bsl::string       result;
+    bsl::vector<char> buffer(precision + 311);
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        if (i) {
+            result.append(separator.data(), separator.length());
+        }
+        char *end = NfUtil::toChars(buffer.data(),
+                                    buffer.data() + buffer.size(),
+                                    values[i],
+                                    NfUtil::e_FIXED,
+                                    precision);
+        result.append(buffer.data(), end);
+    }
+    return result;
+}
+
+/// Verify that `formatArray` renders the specified `numValues` elements of
+/// the specified `values` separated by the specified `separator` as the
+/// oracle does, into an area of `maxArrayLength` characters and into an area
+/// of exactly the length of the result, and that it fails on an area one
+/// character shorter.  Use the specified `line` to report errors.
+template <class TYPE>
+void verifyFormatArray(int                      line,
+                       const TYPE              *values,
+                       bsl::size_t              numValues,
+                       const bsl::string_view&  separator)
+{
+    const bsl::string EXP = oracle(values, numValues, separator);
+
+    bsl::vector<char> buffer(
+                        Util::maxArrayLength<TYPE>(numValues,
+                                                   separator.length()) + 1);
+    char *end = Util::formatArray(buffer.data(),
+                                  buffer.data() + buffer.size() - 1,
+                                  values,
+                                  numValues,
+                                  separator);
+    ASSERTV(line, 0 != end);
+    if (end) {
+        ASSERTV(line, EXP, bsl::string(buffer.data(), end) == EXP);
+    }
+
+    // Exact fit.
+
+    buffer.assign(EXP.length() + 1, '#');
+    end = Util::formatArray(buffer.data(),
+                            buffer.data() + EXP.length(),
+                            values,
+                            numValues,
+                            separator);
+    ASSERTV(line, EXP, buffer.data() + EXP.length() == end);
+    if (end) {
+        ASSERTV(line, EXP, bsl::string(buffer.data(), end) == EXP);
+    }
+    ASSERTV(line, '#' == buffer.back());
+
+    // One character too short.
+
+    if (!EXP.empty()) {
+        end = Util::formatArray(buffer.data(),
+                                buffer.data() + EXP.length() - 1,
+                                values,
+                                numValues,
+                                separator);
+        ASSERTV(line, EXP, 0 == end);
+    }
+}
+
+/// Verify `formatArray` for the (template parameter) `INTEGER` type on
+/// values around every power of 10 and at the limits of the type, and on
+/// the specified `numArrays` pseudo-random arrays.
+template <class INTEGER>
+void testIntegers(int numArrays)
+{
+    typedef bsl::numeric_limits<INTEGER> Limits;
+
+    bsl::vector<INTEGER> values;
+    values.push_back(0);
+    values.push_back(Limits::min());
+    values.push_back(Limits::max());
+    values.push_back(static_cast<INTEGER>(Limits::min() + 1));
+    values.push_back(static_cast<INTEGER>(Limits::max() - 1));
+
+    for (INTEGER power = 1;; power = static_cast<INTEGER>(power * 10)) {
+        values.push_back(static_cast<INTEGER>(power - 1));
+        values.push_back(power);
+        values.push_back(static_cast<INTEGER>(power + 1));
+        if (Limits::is_signed) {
+            values.push_back(static_cast<INTEGER>(-power));
+            values.push_back(static_cast<INTEGER>(1 - power));
+        }
+        if (power > Limits::max() / 10) {
+            break;
+        }
+    }
+
+    static const char *const SEPARATORS[] = { "", ",", ", ", " | " };
+    const int NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS;
+
+    for (int si = 0; si < NUM_SEPARATORS; ++si) {
+        const bsl::string_view SEP(SEPARATORS[si]);
+
+        // All boundary values, in one array, then one by one.
+
+        verifyFormatArray(L_, values.data(), values.size(), SEP);
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            verifyFormatArray(L_, values.data() + i, 1, SEP);
+        }
+        verifyFormatArray(L_, values.data(), 0, SEP);
+    }
+
+    Uint64 state = 0x9e3779b97f4a7c15ULL;
+    for (int i = 0; i < numArrays; ++i) {
+        const bsl::size_t    numValues = nextRandom(&state) % 20;
+        bsl::vector<INTEGER> array(numValues);
+        for (bsl::size_t j = 0; j < numValues; ++j) {
+            array[j] = randomInteger<INTEGER>(&state);
+        }
+
+        const bsl::string_view SEP(
+                             SEPARATORS[nextRandom(&state) % NUM_SEPARATORS]);
+
+        if (veryVeryVerbose) {
+            P(oracle(array.data(), numValues, SEP));
+        }
+
+        verifyFormatArray(L_, array.data(), numValues, SEP);
+    }
+}
+
+/// Verify `formatArray` for the (template parameter) `FLOATING` type on a
+/// table of special values, and on the specified `numArrays` pseudo-random
+/// arrays.
+template <class FLOATING>
+void testFloatingPoints(int numArrays)
+{
+    typedef bsl::numeric_limits<FLOATING> Limits;
+
+    const FLOATING DATA[] = {
+        0,
+        -static_cast<FLOATING>(0),
+        1,
+        -1,
+        static_cast<FLOATING>(0.1),
+        static_cast<FLOATING>(1e21),
+        static_cast<FLOATING>(1.5e-7),
+        Limits::min(),
+        Limits::denorm_min(),
+        Limits::max(),
+        -Limits::max(),
+        Limits::infinity(),
+        -Limits::infinity(),
+        Limits::quiet_NaN()
+    };
+    const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    verifyFormatArray(L_, DATA, NUM_DATA, ",");
+    verifyFormatArray(L_, DATA, NUM_DATA, "");
+    for (bsl::size_t i = 0; i < NUM_DATA; ++i) {
+        verifyFormatArray(L_, DATA + i, 1, " ");
+    }
+
+    Uint64 state = 0x2545f4914f6cdd1dULL;
+    for (int i = 0; i < numArrays; ++i) {
+        const bsl::size_t     numValues = nextRandom(&state) % 10;
+        bsl::vector<FLOATING> array(numValues);
+        for (bsl::size_t j = 0; j < numValues; ++j) {
+            array[j] = randomFinite<FLOATING>(&state);
+        }
+
+        verifyFormatArray(L_, array.data(), numValues, ", ");
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nUSAGE EXAMPLE"
+                                  "\n=============\n";
+
+///Example 1: Writing a Row of Numbers as CSV
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to write a row of a comma-separated values (CSV) file from
+// an array of measurements.
+//
+// First, we describe the measurements:
+// ```
+    const double measurements[] = { 1.5, -0.25, 1e21, 3 };
+    const int    numMeasurements = sizeof measurements / sizeof *measurements;
+// ```
+// Then, we create a buffer large enough for any values of this type:
+// ```
+    typedef bdlb::NumericFormatUtil Util;
+
+    bsl::vector<char> buffer(Util::maxArrayLength<double>(numMeasurements, 1));
+// ```
+// Next, we format the row:
+// ```
+    char *end = Util::formatArray(buffer.data(),
+                                  buffer.data() + buffer.size(),
+                                  measurements,
+                                  numMeasurements,
+                                  ",");
+    ASSERT(0 != end);
+    ASSERT(bsl::string_view(buffer.data(), end - buffer.data()) ==
+                                                       "1.5,-0.25,1e+21,3");
+// ```
+// Finally, we write the same values with exactly two decimals:
+// ```
+    buffer.resize(Util::maxFixedArrayLength(numMeasurements, 2, 1));
+
+    end = Util::formatFixedArray(buffer.data(),
+                                 buffer.data() + buffer.size(),
+                                 measurements,
+                                 numMeasurements,
+                                 2,
+                                 ",");
+    ASSERT(0 != end);
+    ASSERT(bsl::string_view(buffer.data(), end - buffer.data()) ==
+                             "1.50,-0.25,1000000000000000000000.00,3.00");
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FORMAT FIXED ARRAY
+        //
+        // Concerns:
+        // 1. Each value is written as the fixed precision `toChars` overload
+        //    writes it, for every precision, with the separator between
+        //    values and no separator after the last one.
+        //
+        // 2. The function fails (returns 0) if and only if the output area is
+        //    shorter than the result.
+        //
+        // 3. Special values are written as `toChars` writes them.
+        //
+        // 4. `maxFixedArrayLength` characters are always sufficient.
+        //
+        // 5. QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For a table of values that includes special values, and for
+        //    pseudo-random arrays, compare the result for precisions 0 to 20
+        //    and a few larger ones against an oracle that calls `toChars` for
+        //    each value, using an output area of `maxFixedArrayLength`, one of
+        //    exactly the expected length, and one character shorter.
+        //    (C-1..4)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   char *formatFixedArray(first, last, const double *, n, prec, sv);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nFORMAT FIXED ARRAY"
+                                  "\n==================\n";
+
+        typedef bsl::numeric_limits<double> Limits;
+
+        const double DATA[] = {
+            0, -0.0, 1, -1, 0.5, 1.5, 2.5, -2.5, 0.125, 0.1, 1e21, 1e-7,
+            123456.789, 9.9999999, Limits::min(), Limits::denorm_min(),
+            Limits::max(), -Limits::max(), Limits::infinity(),
+            -Limits::infinity(), Limits::quiet_NaN()
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int PRECISIONS[] = { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10,
+                                  11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+                                  30, 50, 100, 400, 1074, 1100 };
+        const int NUM_PRECISIONS = sizeof PRECISIONS / sizeof *PRECISIONS;
+
+        Uint64 state = 0x5851f42d4c957f2dULL;
+
+        for (int pi = 0; pi < NUM_PRECISIONS; ++pi) {
+            const int PREC = PRECISIONS[pi];
+
+            if (veryVerbose) { T_ P(PREC) }
+
+            for (int ai = 0; ai < 20; ++ai) {
+                bsl::vector<double> array;
+                if (0 == ai) {
+                    array.assign(DATA, DATA + NUM_DATA);
+                }
+                else {
+                    const bsl::size_t numValues = u::nextRandom(&state) % 8;
+                    for (bsl::size_t j = 0; j < numValues; ++j) {
+                        array.push_back(u::randomFinite<double>(&state));
+                    }
+                }
+
+                const bsl::string_view SEP(ai % 2 ? ";" : ", ");
+                const bsl::string      EXP = u::fixedOracle(array.data(),
+                                                            array.size(),
+                                                            PREC,
+                                                            SEP);
+
+                const bsl::size_t MAX = Util::maxFixedArrayLength(
+                                                                 array.size(),
+                                                                 PREC,
+                                                                 SEP.length());
+
+                bsl::vector<char> buffer(MAX + 1);
+                char *end = Util::formatFixedArray(buffer.data(),
+                                                   buffer.data() + MAX,
+                                                   array.data(),
+                                                   array.size(),
+                                                   PREC,
+                                                   SEP);
+                ASSERTV(PREC, ai, 0 != end);
+                if (end) {
+                    ASSERTV(PREC, ai, bsl::string(buffer.data(), end) == EXP);
+                }
+
+                buffer.assign(EXP.length() + 1, '#');
+                end = Util::formatFixedArray(buffer.data(),
+                                             buffer.data() + EXP.length(),
+                                             array.data(),
+                                             array.size(),
+                                             PREC,
+                                             SEP);
+                ASSERTV(PREC, ai, buffer.data() + EXP.length() == end);
+                if (end) {
+                    ASSERTV(PREC, ai, bsl::string(buffer.data(), end) == EXP);
+                }
+
+                if (!EXP.empty()) {
+                    char *const LAST = buffer.data() + EXP.length() - 1;
+
+                    end = Util::formatFixedArray(buffer.data(),
+                                                 LAST,
+                                                 array.data(),
+                                                 array.size(),
+                                                 PREC,
+                                                 SEP);
+                    ASSERTV(PREC, ai, 0 == end);
+                }
+            }
+        }
+
+        if (verbose) bsl::cout << "\nNegative Testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char         buffer[32];
+            const double VALUE = 1;
+
+            ASSERT_PASS(Util::formatFixedArray(buffer,
+                                               buffer + 32,
+                                               &VALUE,
+                                               1,
+                                               0,
+                                               ","));
+            ASSERT_FAIL(Util::formatFixedArray(buffer,
+                                               buffer + 32,
+                                               &VALUE,
+                                               1,
+                                               -1,
+                                               ","));
+            ASSERT_FAIL(Util::formatFixedArray(buffer + 1,
+                                               buffer,
+                                               &VALUE,
+                                               1,
+                                               0,
+                                               ","));
+            ASSERT_PASS(Util::formatFixedArray(buffer, buffer, 0, 0, 0, ","));
+            ASSERT_FAIL(Util::formatFixedArray(buffer, buffer, 0, 1, 0, ","));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORMAT FLOATING POINT ARRAYS
+        //
+        // Concerns:
+        // 1. Each value is written in the shortest round-trip representation,
+        //    exactly as `toChars` writes it, with the separator between
+        //    values and no separator after the last one.
+        //
+        // 2. Special values (zeros, subnormals, limits, infinities and NaN)
+        //    are written as `toChars` writes them.
+        //
+        // 3. The function fails (returns 0) if and only if the output area is
+        //    shorter than the result.
+        //
+        // 4. `maxArrayLength` characters are always sufficient.
+        //
+        // Plan:
+        // 1. For tables of special values and for pseudo-random arrays of
+        //    finite values from all bit patterns, compare the result against
+        //    an oracle that calls `toChars` for each value, using an output
+        //    area of `maxArrayLength`, one of exactly the expected length, and
+        //    one character shorter.  (C-1..4)
+        //
+        // Testing:
+        //   char *formatArray(first, last, const float *, size_t, sv);
+        //   char *formatArray(first, last, const double *, size_t, sv);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nFORMAT FLOATING POINT ARRAYS"
+                                  "\n============================\n";
+
+        if (verbose) bsl::cout << "\n`float`\n";
+        u::testFloatingPoints<float>(20000);
+
+        if (verbose) bsl::cout << "\n`double`\n";
+        u::testFloatingPoints<double>(20000);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FORMAT INTEGER ARRAYS
+        //
+        // Concerns:
+        // 1. Each value is written in base 10, exactly as `toChars` writes it,
+        //    with the separator between values and no separator after the
+        //    last one.
+        //
+        // 2. Values of every number of digits, in particular values around
+        //    powers of 10 and the limits of each type, are written correctly.
+        //
+        // 3. Empty and multi-character separators are supported, as is an
+        //    empty array.
+        //
+        // 4. The function fails (returns 0) if and only if the output area is
+        //    shorter than the result, and in particular no character is
+        //    written past `last`.
+        //
+        // 5. `maxArrayLength` characters are always sufficient.
+        //
+        // Plan:
+        // 1. For each supported integer type, and for a set of separators,
+        //    compare the result for an array of boundary values (and for each
+        //    of its elements alone) against an oracle that calls `toChars` for
+        //    each value, using an output area of `maxArrayLength`, one of
+        //    exactly the expected length (followed by a sentinel that must be
+        //    left intact), and one character shorter.  (C-1..5)
+        //
+        // 2. Repeat P-1 for pseudo-random arrays of pseudo-random length
+        //    whose elements have a pseudo-random number of significant bits.
+        //    (C-1..5)
+        //
+        // Testing:
+        //   char *formatArray(first, last, const int *, size_t, string_view);
+        //   char *formatArray(first, last, const unsigned *, size_t, sv);
+        //   char *formatArray(first, last, const Int64 *, size_t, sv);
+        //   char *formatArray(first, last, const Uint64 *, size_t, sv);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nFORMAT INTEGER ARRAYS"
+                                  "\n=====================\n";
+
+        if (verbose) bsl::cout << "\n`int`\n";
+        u::testIntegers<int>(20000);
+
+        if (verbose) bsl::cout << "\n`unsigned int`\n";
+        u::testIntegers<unsigned int>(20000);
+
+        if (verbose) bsl::cout << "\n`Int64`\n";
+        u::testIntegers<Int64>(20000);
+
+        if (verbose) bsl::cout << "\n`Uint64`\n";
+        u::testIntegers<Uint64>(20000);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MAXIMUM LENGTHS
+        //
+        // Concerns:
+        // 1. `maxArrayLength` returns 0 for no values, and otherwise the
+        //    maximum length of one value times the number of values plus the
+        //    length of one separator fewer than the number of values.
+        //
+        // 2. `maxFixedArrayLength` does the same for the maximum length of a
+        //    fixed precision value.
+        //
+        // 3. QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Compare the results for a few values against hand-computed ones.
+        //    (C-1..2)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   size_t maxArrayLength<TYPE>(numValues, separatorLength);
+        //   size_t maxFixedArrayLength(numValues, precision, separatorLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nMAXIMUM LENGTHS"
+                                  "\n===============\n";
+
+        ASSERT(0  == Util::maxArrayLength<int>(0, 5));
+        ASSERT(11 == Util::maxArrayLength<int>(1, 5));
+        ASSERT(24 == Util::maxArrayLength<int>(2, 2));
+        ASSERT(20 == Util::maxArrayLength<Uint64>(1, 1));
+        ASSERT(60 == Util::maxArrayLength<Int64>(3, 0));
+
+        ASSERT(NfUtil::ToCharsMaxLength<double>::k_VALUE * 4 + 3 ==
+                                       Util::maxArrayLength<double>(4, 1));
+        ASSERT(NfUtil::ToCharsMaxLength<float>::k_VALUE ==
+                                       Util::maxArrayLength<float>(1, 7));
+
+        ASSERT(0         == Util::maxFixedArrayLength(0,  2, 1));
+        ASSERT(311       == Util::maxFixedArrayLength(1,  0, 1));
+        ASSERT(313 * 3 + 2 * 2
+                         == Util::maxFixedArrayLength(3,  2, 2));
+
+        if (verbose) bsl::cout << "\nNegative Testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::maxFixedArrayLength(1,  0, 1));
+            ASSERT_FAIL(Util::maxFixedArrayLength(1, -1, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Format a few small arrays of each kind and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nBREATHING TEST"
+                                  "\n==============\n";
+
+        char  buffer[256];
+        char *end;
+
+        const int INTS[] = {
+            0, -7, 123456789, bsl::numeric_limits<int>::min()
+        };
+        end = Util::formatArray(buffer, buffer + sizeof buffer, INTS, 4, ",");
+        ASSERT(end);
+        ASSERT(bsl::string(buffer, end) == "0,-7,123456789,-2147483648");
+
+        const Uint64 UINTS[] = {
+            18446744073709551615ULL, 10000000000000000ULL
+        };
+        end = Util::formatArray(buffer, buffer + sizeof buffer, UINTS, 2, " ");
+        ASSERT(end);
+        ASSERT(bsl::string(buffer, end) ==
+                                     "18446744073709551615 10000000000000000");
+
+        const double DOUBLES[] = { 0.1, -2, 1e100 };
+        end = Util::formatArray(buffer,
+                                buffer + sizeof buffer,
+                                DOUBLES,
+                                3,
+                                ", ");
+        ASSERT(end);
+        ASSERT(bsl::string(buffer, end) == "0.1, -2, 1e+100");
+
+        end = Util::formatFixedArray(buffer,
+                                     buffer + sizeof buffer,
+                                     DOUBLES,
+                                     2,
+                                     3,
+                                     "|");
+        ASSERT(end);
+        ASSERT(bsl::string(buffer, end) == "0.100|-2.000");
+
+        end = Util::formatArray(buffer, buffer + 5, INTS, 4, ",");
+        ASSERT(0 == end);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INTEGER ARRAYS
+        //
+        // Concerns:
+        // 1. Formatting an array with `formatArray` is faster than calling
+        //    `toChars` for each value and than inserting each value into a
+        //    stream.
+        //
+        // Plan:
+        // 1. Time formatting the same arrays of pseudo-random integers of
+        //    every length with `formatArray`, with a loop calling `toChars`,
+        //    and with a loop inserting into an `ostringstream`, and report the
+        //    number of values formatted per second.
+        //
+        // Testing:
+        //   PERFORMANCE: INTEGER ARRAYS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE: INTEGER ARRAYS"
+                                  "\n===========================\n";
+
+        const int NUM_VALUES = 1000;
+        const int NUM_LAPS   = 10000;
+
+        bsl::vector<Int64> values(NUM_VALUES);
+        Uint64             state = 0x9e3779b97f4a7c15ULL;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values[i] = u::randomInteger<Int64>(&state);
+        }
+
+        bsl::vector<char> buffer(
+                             Util::maxArrayLength<Int64>(NUM_VALUES, 1));
+        char             *first = buffer.data();
+        char             *last  = first + buffer.size();
+        bsl::size_t       total = 0;
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int lap = 0; lap < NUM_LAPS; ++lap) {
+            char *end = Util::formatArray(first,
+                                          last,
+                                          values.data(),
+                                          NUM_VALUES,
+                                          ",");
+            total += end - first;
+        }
+        timer.stop();
+        const double batchTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int lap = 0; lap < NUM_LAPS; ++lap) {
+            char *end = first;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                if (i) {
+                    *end++ = ',';
+                }
+                end = NfUtil::toChars(end, last, values[i]);
+            }
+            total += end - first;
+        }
+        timer.stop();
+        const double toCharsTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int lap = 0; lap < NUM_LAPS / 10; ++lap) {
+            bsl::ostringstream stream;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                if (i) {
+                    stream << ',';
+                }
+                stream << values[i];
+            }
+            total += stream.str().length();
+        }
+        timer.stop();
+        const double streamTime = timer.elapsedTime() * 10;
+
+        const double count = static_cast<double>(NUM_VALUES) * NUM_LAPS;
+
+        bsl::cout << "formatArray: " << count / batchTime   / 1e6
+                  << " M values/s\n"
+                  << "toChars:     " << count / toCharsTime / 1e6
+                  << " M values/s\n"
+                  << "ostream:     " << count / streamTime  / 1e6
+                  << " M values/s\n";
+
+        if (veryVerbose) {
+            P(total);
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE '" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
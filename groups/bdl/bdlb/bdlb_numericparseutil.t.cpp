@@ -108,9 +108,10 @@ using namespace BloombergLP;
 // [10] parseShort(result, input, base = 10)
 // [11] parseUshort(result, rest, input, base = 10)
 // [11] parseUshort(result, input, base = 10)
+// [12] parseDouble FAST PATH
 //-----------------------------------------------------------------------------
 // [ 4] PARSE DOUBLE TEST MACHINERY
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 // ============================================================================
 //                        STANDARD ASSERT TEST FUNCTION
@@ -4436,6 +4437,117 @@ void testBslsLogCounterGuard()
     ASSERT(originalLogHandler == Log::logMessageHandler());
 }
 
+/// Verify that `parseDouble` called on the specified `input` succeeds and
+/// produces exactly the same value, and consumes exactly the same
+/// characters, as `strtod` called on a null-terminated copy of `input`.  The
+/// specified `line` identifies the test row (or the random iteration).
+void verifyAgainstStrtod(int line, const bsl::string_view& input)
+{
+    const bsl::string copy(input);
+    char             *end      = 0;
+    const double      EXPECTED = bsl::strtod(copy.c_str(), &end);
+    const bsl::size_t EXP_REST = end - copy.c_str();
+
+    double           result = -1.0;
+    bsl::string_view rest;
+    const int rc = bdlb::NumericParseUtil::parseDouble(&result, &rest, input);
+
+    ASSERTV(line, input, rc, 0 == rc);
+    ASSERTV(line, input, EXP_REST, rest.size(),
+            input.size() - EXP_REST == rest.size());
+    ASSERTV(line, input, EXPECTED, result,
+            0 == bsl::memcmp(&EXPECTED, &result, sizeof result));
+}
+
+/// Verifies that the exact fast path used by `parseDouble` agrees with
+/// `strtod`.  See the calling test `case` description for concerns and plan.
+void testFastPathAgainstStrtod()
+{
+    static const struct {
+        int         d_line;
+        const char *d_input_p;
+    } DATA[] = {
+        //LINE  INPUT
+        //----  -----------------------------------------------------
+        { L_,   "0" },
+        { L_,   "-0" },
+        { L_,   "0.000" },
+        { L_,   "0e999999" },
+        { L_,   "1" },
+        { L_,   "1." },
+        { L_,   ".5" },
+        { L_,   "1.5e" },
+        { L_,   "1.5e+" },
+        { L_,   "1.5E-3x" },
+        { L_,   "00000000000000000000000000000012.5" },
+        { L_,   "0.00000000000000000000000000000000125" },
+        { L_,   "9007199254740992" },
+        { L_,   "9007199254740993" },
+        { L_,   "9007199254740995" },
+        { L_,   "9999999999999999999" },
+        { L_,   "18446744073709551615" },
+        { L_,   "123456789012345678901234567890" },
+        { L_,   "0.1" },
+        { L_,   "0.3" },
+        { L_,   "3.14159" },
+        { L_,   "1e22" },
+        { L_,   "1e23" },
+        { L_,   "8.589973e9" },
+        { L_,   "7.3177701707893310e+15" },
+        { L_,   "2.2250738585072014e-308" },
+        { L_,   "2.2250738585072011e-308" },
+        { L_,   "1.7976931348623157e308" },
+        { L_,   "1.7976931348623158e308" },
+        { L_,   "9007199254740993.0000000000000000000000001" },
+        { L_,   "1.00000000000000011102230246251565404236316680908203125" },
+        { L_,   "1.00000000000000011102230246251565404236316680908203124" },
+        { L_,   "1.00000000000000011102230246251565404236316680908203126" },
+    };
+    const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (bsl::size_t i = 0; i < NUM_DATA; ++i) {
+        const int              LINE  = DATA[i].d_line;
+        const bsl::string_view INPUT = DATA[i].d_input_p;
+
+        if (veryVerbose) {
+            P_(LINE) P(INPUT);
+        }
+
+        verifyAgainstStrtod(LINE, INPUT);
+    }
+
+    // Pseudo-random decimal numbers having up to 20 significant digits (so
+    // that both the fast path and the fallback are exercised), with
+    // exponents spanning the range of normal `double` values.
+
+    bsls::Types::Uint64 state = 0x2545F4914F6CDD1DULL;
+    for (int iteration = 0; iteration < 200000; ++iteration) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        char buffer[64];
+        int  length    = 0;
+        int  numDigits = 1 + static_cast<int>(state % 20);
+        int  pointPos  = static_cast<int>((state >> 8) % (numDigits + 1));
+        int  exponent  = static_cast<int>((state >> 16) % 561) - 280;
+
+        bsls::Types::Uint64 digits = state >> 24;
+        for (int d = 0; d < numDigits; ++d) {
+            if (d == pointPos) {
+                buffer[length++] = '.';
+            }
+            buffer[length++] = static_cast<char>('0' + digits % 10);
+            digits = digits / 10 ? digits / 10 : state ^ (state >> 32) * d;
+        }
+        if (0 != (state & 0x8000)) {
+            length += bsl::sprintf(buffer + length, "e%d", exponent);
+        }
+
+        verifyAgainstStrtod(iteration, bsl::string_view(buffer, length));
+    }
+}
+
 }  // close namespace testDouble
 
 //=============================================================================
@@ -4452,7 +4564,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4497,6 +4609,39 @@ int main(int argc, char *argv[])
     ASSERT(rest.empty());
 // ```
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // PARSE DOUBLE FAST PATH
+        //
+        // Concerns:
+        //  1. Decimal numbers converted without the help of the standard
+        //     library convert to the same value as with `strtod`, including
+        //     values that are halfway between two representable values, and
+        //     the largest and smallest normal values.
+        //
+        //  2. Numbers having too many significant digits for the fast path
+        //     are converted correctly by the fallback.
+        //
+        //  3. The number of characters consumed is the same as with `strtod`,
+        //     including when an exponent marker is not followed by digits.
+        //
+        // Plan:
+        // 1. Using the table-driven approach, compare the value and the
+        //    remainder produced by `parseDouble` to those produced by
+        //    `strtod` for a set of interesting decimal numbers.  (C-1..3)
+        //
+        // 2. Repeat for a large number of pseudo-random decimal numbers
+        //    having from 1 to 20 significant digits.  (C-1..3)
+        //
+        // Testing:
+        //   parseDouble FAST PATH
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPARSE DOUBLE FAST PATH"
+                                  "\n======================\n";
+
+        testDouble::testFastPathAgainstStrtod();
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE USHORT
@@ -0,0 +1,773 @@
+// bdlbb_blobinstream.cpp                                             -*-C++-*-
+#include <bdlbb_blobinstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobinstream_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_bloboutstream.h>                // for testing only
+#include <bdlbb_simpleblobbufferfactory.h>      // for testing only
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+// Note: on Windows -> WinDef.h:#define min(a,b) ...
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(min)
+#undef min
+#endif
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                             // ------------------
+                             // class BlobInStream
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+void BlobInStream::attach()
+{
+    d_bufferIndex  = 0;
+    d_bufferOffset = 0;
+
+    if (0 == length()) {
+        d_begin_p  = 0;
+        d_cursor_p = 0;
+        d_end_p    = 0;
+        return;                                                       // RETURN
+    }
+
+    const BlobBuffer& buffer = d_blob_p->buffer(0);
+
+    d_begin_p  = buffer.data();
+    d_cursor_p = d_begin_p;
+    d_end_p    = d_begin_p + (1 == d_blob_p->numDataBuffers()
+                              ? d_blob_p->lastDataBufferLength()
+                              : buffer.size());
+}
+
+void BlobInStream::nextBuffer()
+{
+    BSLS_ASSERT(d_cursor_p == d_end_p);
+    BSLS_ASSERT(cursor() < length());
+
+    d_bufferOffset += d_blob_p->buffer(d_bufferIndex).size();
+    ++d_bufferIndex;
+
+    const BlobBuffer& buffer = d_blob_p->buffer(d_bufferIndex);
+
+    d_begin_p  = buffer.data();
+    d_cursor_p = d_begin_p;
+    d_end_p    = d_begin_p + (d_bufferIndex == d_blob_p->numDataBuffers() - 1
+                              ? d_blob_p->lastDataBufferLength()
+                              : buffer.size());
+}
+
+int BlobInStream::readRaw(char *data, int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    if (length() - cursor() < numBytes) {
+        invalidate();
+        return -1;                                                    // RETURN
+    }
+
+    while (true) {
+        const int available = static_cast<int>(d_end_p - d_cursor_p);
+
+        if (numBytes <= available) {
+            if (numBytes) {
+                bsl::memcpy(data, d_cursor_p, numBytes);
+                d_cursor_p += numBytes;
+            }
+            return 0;                                                 // RETURN
+        }
+
+        if (available) {
+            bsl::memcpy(data, d_cursor_p, available);
+            data       += available;
+            numBytes   -= available;
+            d_cursor_p  = d_end_p;
+        }
+
+        nextBuffer();
+    }
+}
+
+// MANIPULATORS
+
+                      // *** arrays of integer values ***
+
+BlobInStream& BlobInStream::getArrayInt64(bsls::Types::Int64 *variables,
+                                          int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt64(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt64(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint64(bsls::Types::Uint64 *variables,
+                                           int                  numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint64(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint64(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt56(bsls::Types::Int64 *variables,
+                                          int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt56(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt56(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint56(bsls::Types::Uint64 *variables,
+                                           int                  numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint56(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint56(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt48(bsls::Types::Int64 *variables,
+                                          int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt48(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt48(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint48(bsls::Types::Uint64 *variables,
+                                           int                  numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint48(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint48(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt40(bsls::Types::Int64 *variables,
+                                          int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt40(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt40(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint40(bsls::Types::Uint64 *variables,
+                                           int                  numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint40(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint40(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt32(int *variables, int numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt32(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt32(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint32(unsigned int *variables,
+                                           int           numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint32(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint32(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt24(int *variables, int numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt24(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt24(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint24(unsigned int *variables,
+                                           int           numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint24(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint24(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayInt16(short *variables, int numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayInt16(variables, d_cursor_p, count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getInt16(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayUint16(unsigned short *variables,
+                                           int             numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayUint16(variables,
+                                                  d_cursor_p,
+                                                  count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getUint16(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+                      // *** arrays of floating-point values ***
+
+BlobInStream& BlobInStream::getArrayFloat64(double *variables,
+                                            int     numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT64;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayFloat64(variables,
+                                                   d_cursor_p,
+                                                   count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getFloat64(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+
+BlobInStream& BlobInStream::getArrayFloat32(float *variables, int numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(0 <= numVariables);
+
+    if (!isValid()) {
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT32;
+
+    if (static_cast<bsls::Types::Int64>(size) * numVariables >
+                                                       length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numVariables) {
+        const int count = bsl::min(
+                           numVariables,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::getArrayFloat32(variables,
+                                                   d_cursor_p,
+                                                   count);
+            d_cursor_p   += count * size;
+            variables    += count;
+            numVariables -= count;
+        }
+        else {
+            // The next value straddles two buffers (or the current buffer is
+            // exhausted).
+
+            getFloat32(*variables);
+            ++variables;
+            --numVariables;
+        }
+    }
+    return *this;
+}
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
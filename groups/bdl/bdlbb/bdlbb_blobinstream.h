@@ -0,0 +1,1377 @@
+// bdlbb_blobinstream.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBINSTREAM
+#define INCLUDED_BDLBB_BLOBINSTREAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a BDEX input stream reading directly from a `bdlbb::Blob`.
+//
+//@CLASSES:
+//  bdlbb::BlobInStream: blob-based input stream for fundamental types
+//
+//@SEE_ALSO: bdlbb_bloboutstream, bslx_byteinstream
+//
+//@DESCRIPTION: This component implements a blob-based input stream class,
+// `bdlbb::BlobInStream`, that provides platform-independent input methods
+// ("unexternalization") on values, and arrays of values, of fundamental
+// types, and on `bsl::string`.  `bdlbb::BlobInStream` models the BDEX
+// `InStream` protocol (see the `bslx` package-level documentation), and reads
+// data in the format written by `bslx::ByteOutStream` and
+// `bdlbb::BlobOutStream`.
+//
+// The `bdlbb::BlobInStream` type reads the data of a user-supplied
+// `bdlbb::Blob` directly, with no data copying or assumption of ownership;
+// in particular, the blob need not be flattened into a contiguous buffer
+// before being read.  Each `get` method is an inline bounds check against the
+// current buffer of the blob followed by a direct read, and only a value that
+// straddles two buffers is assembled by an out-of-line path.  The user must
+// make sure that the lifetime of the blob is sufficient to satisfy the needs
+// of the input stream, and the behavior is undefined if the blob is modified
+// while it is held by the stream.
+//
+// Note that input streams can be *invalidated* explicitly and queried for
+// *validity* and *emptiness*.  Reading from an initially invalid stream has no
+// effect.  Attempting to read beyond the end of a stream will automatically
+// invalidate the stream.  Whenever an inconsistent value is detected, the
+// stream should be invalidated explicitly.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Unexternalizing From a Blob
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a `bdlbb::Blob` containing values externalized by a
+// `bdlbb::BlobOutStream` (or by a `bslx::ByteOutStream`), and wish to read
+// them back without first copying the blob into a contiguous buffer.
+//
+// First, we externalize a few values into a blob having small buffers, so
+// that some of the values straddle two buffers:
+// ```
+// bdlbb::SimpleBlobBufferFactory factory(8);
+// bdlbb::Blob                    blob(&factory);
+// {
+//     bdlbb::BlobOutStream outStream(&blob, 20260101);
+//     outStream.putInt32(1);
+//     outStream.putInt32(2);
+//     outStream.putInt8('c');
+//     outStream.putString(bsl::string("hello"));
+// }
+// assert(15 == blob.length());
+// ```
+// Then, we create a `bdlbb::BlobInStream` reading from the blob, and
+// unexternalize the values:
+// ```
+// bdlbb::BlobInStream inStream(&blob);
+//
+// int         a;
+// int         b;
+// char        c;
+// bsl::string s;
+//
+// inStream.getInt32(a);
+// inStream.getInt32(b);
+// inStream.getInt8(c);
+// inStream.getString(s);
+// ```
+// Finally, we verify that the values were read correctly and that the stream
+// was consumed in its entirety:
+// ```
+// assert(inStream);
+// assert(inStream.isEmpty());
+// assert(1       == a);
+// assert(2       == b);
+// assert('c'     == c);
+// assert("hello" == s);
+// ```
+// Note that reading beyond the end of the blob invalidates the stream:
+// ```
+// inStream.getInt8(c);
+// assert(!inStream);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslx_instreamfunctions.h>
+#include <bslx_marshallingutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                             // ==================
+                             // class BlobInStream
+                             // ==================
+
+/// This class provides input methods to unexternalize values, and C-style
+/// arrays of values, of the fundamental integral and floating-point types,
+/// as well as `bsl::string` values, directly from the data of a held
+/// `bdlbb::Blob`.  In particular, each `get` method of this class reads the
+/// data written by the corresponding `put` method of `bslx::ByteOutStream`
+/// or `bdlbb::BlobOutStream`.  See the `bslx` package-level documentation
+/// for the definition of the BDEX `InStream` protocol.
+class BlobInStream {
+
+    // DATA
+    const Blob *d_blob_p;        // held blob (not owned), or 0
+
+    const char *d_begin_p;       // beginning of the current buffer
+
+    const char *d_cursor_p;      // next byte to read in the current buffer
+
+    const char *d_end_p;         // end of the data in the current buffer
+
+    int         d_bufferIndex;   // index of the current buffer in the held
+                                 // blob
+
+    int         d_bufferOffset;  // offset, in the held blob, of the first
+                                 // byte of the current buffer
+
+    bool        d_validFlag;     // stream validity flag; 'true' if stream is
+                                 // in valid state, 'false' otherwise
+
+    // NOT IMPLEMENTED
+    BlobInStream(const BlobInStream&);
+    BlobInStream& operator=(const BlobInStream&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Make the first buffer of the held blob the current buffer, and
+    /// position the cursor at its beginning.
+    void attach();
+
+    /// Make the next buffer of the held blob the current buffer, and
+    /// position the cursor at its beginning.  The behavior is undefined
+    /// unless the cursor is at the end of the data in the current buffer
+    /// and `cursor() < length()`.
+    void nextBuffer();
+
+    /// Read into the specified `data` the specified `numBytes` from this
+    /// stream, moving to subsequent buffers of the held blob as needed.
+    /// Return 0 on success, and a non-zero value (invalidating this stream
+    /// and leaving the cursor unchanged) if fewer than `numBytes` remain in
+    /// this stream.  The behavior is undefined unless `0 <= numBytes`.
+    int readRaw(char *data, int numBytes);
+
+  public:
+    // CREATORS
+
+    /// Create an empty input stream.  Note that the constructed object is
+    /// useless until a blob is set with the `reset` method.
+    BlobInStream();
+
+    /// Create an input stream containing the data of the specified `blob`.
+    explicit BlobInStream(const Blob *blob);
+
+    /// Destroy this object.
+    ~BlobInStream();
+
+    // MANIPULATORS
+
+    /// If the most-significant bit of the one byte of this stream at the
+    /// current cursor location is set, assign to the specified `length` the
+    /// four-byte, two's complement integer (in host byte order) comprised
+    /// of the four bytes of this stream at the current cursor location (in
+    /// network byte order) with the most-significant bit unset; otherwise,
+    /// assign to `length` the one-byte, two's complement integer comprised
+    /// of the one byte of this stream at the current cursor location.
+    /// Update the cursor location and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `length` is undefined.
+    /// Note that the value will be zero-extended.
+    BlobInStream& getLength(int& length);
+
+    /// Assign to the specified `version` the one-byte, two's complement
+    /// unsigned integer comprised of the one byte of this stream at the
+    /// current cursor location, update the cursor location, and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.  If this function otherwise fails to
+    /// extract a valid value, this stream is marked invalid and the value
+    /// of `version` is undefined.  Note that the value will be
+    /// zero-extended.
+    BlobInStream& getVersion(int& version);
+
+    /// Put this input stream in an invalid state.  This function has no
+    /// effect if this stream is already invalid.  Note that this function
+    /// should be called whenever a value extracted from this stream is
+    /// determined to be invalid, inconsistent, or otherwise incorrect.
+    void invalidate();
+
+    /// Set the index of the next byte to be extracted from this stream to 0
+    /// (i.e., the beginning of the stream) and validate this stream if it
+    /// is currently invalid.
+    void reset();
+
+    /// Reset this stream to extract from the data of the specified `blob`,
+    /// set the index of the next byte to be extracted to 0 (i.e., the
+    /// beginning of the stream), and validate this stream if it is
+    /// currently invalid.
+    void reset(const Blob *blob);
+
+
+                      // *** scalar integer values ***
+
+    /// Assign to the specified `variable` the eight-byte, two's complement
+    /// integer (in host byte order) comprised of the eight bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt64(bsls::Types::Int64& variable);
+
+    /// Assign to the specified `variable` the eight-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the eight bytes
+    /// of this stream at the current cursor location (in network byte
+    /// order), update the cursor location, and return a reference to this
+    /// stream.  If this stream is initially invalid, this operation has no
+    /// effect.  If this function otherwise fails to extract a valid value,
+    /// this stream is marked invalid and the value of `variable` is
+    /// undefined.  Note that the value will be zero-extended.
+    BlobInStream& getUint64(bsls::Types::Uint64& variable);
+
+    /// Assign to the specified `variable` the seven-byte, two's complement
+    /// integer (in host byte order) comprised of the seven bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt56(bsls::Types::Int64& variable);
+
+    /// Assign to the specified `variable` the seven-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the seven bytes
+    /// of this stream at the current cursor location (in network byte
+    /// order), update the cursor location, and return a reference to this
+    /// stream.  If this stream is initially invalid, this operation has no
+    /// effect.  If this function otherwise fails to extract a valid value,
+    /// this stream is marked invalid and the value of `variable` is
+    /// undefined.  Note that the value will be zero-extended.
+    BlobInStream& getUint56(bsls::Types::Uint64& variable);
+
+    /// Assign to the specified `variable` the six-byte, two's complement
+    /// integer (in host byte order) comprised of the six bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt48(bsls::Types::Int64& variable);
+
+    /// Assign to the specified `variable` the six-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the six bytes of
+    /// this stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be zero-extended.
+    BlobInStream& getUint48(bsls::Types::Uint64& variable);
+
+    /// Assign to the specified `variable` the five-byte, two's complement
+    /// integer (in host byte order) comprised of the five bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt40(bsls::Types::Int64& variable);
+
+    /// Assign to the specified `variable` the five-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the five bytes of
+    /// this stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be zero-extended.
+    BlobInStream& getUint40(bsls::Types::Uint64& variable);
+
+    /// Assign to the specified `variable` the four-byte, two's complement
+    /// integer (in host byte order) comprised of the four bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt32(int& variable);
+
+    /// Assign to the specified `variable` the four-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the four bytes of
+    /// this stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be zero-extended.
+    BlobInStream& getUint32(unsigned int& variable);
+
+    /// Assign to the specified `variable` the three-byte, two's complement
+    /// integer (in host byte order) comprised of the three bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt24(int& variable);
+
+    /// Assign to the specified `variable` the three-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the three bytes
+    /// of this stream at the current cursor location (in network byte
+    /// order), update the cursor location, and return a reference to this
+    /// stream.  If this stream is initially invalid, this operation has no
+    /// effect.  If this function otherwise fails to extract a valid value,
+    /// this stream is marked invalid and the value of `variable` is
+    /// undefined.  Note that the value will be zero-extended.
+    BlobInStream& getUint24(unsigned int& variable);
+
+    /// Assign to the specified `variable` the two-byte, two's complement
+    /// integer (in host byte order) comprised of the two bytes of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be sign-extended.
+    BlobInStream& getInt16(short& variable);
+
+    /// Assign to the specified `variable` the two-byte, two's complement
+    /// unsigned integer (in host byte order) comprised of the two bytes of
+    /// this stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variable` is undefined.
+    /// Note that the value will be zero-extended.
+    BlobInStream& getUint16(unsigned short& variable);
+
+    /// Assign to the specified `variable` the one-byte, two's complement
+    /// integer comprised of the one byte of this stream at the current
+    /// cursor location, update the cursor location, and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variable` is
+    /// undefined.  Note that the value will be sign-extended.
+    BlobInStream& getInt8(char&        variable);
+    BlobInStream& getInt8(signed char& variable);
+
+    /// Assign to the specified `variable` the one-byte, two's complement
+    /// unsigned integer comprised of the one byte of this stream at the
+    /// current cursor location, update the cursor location, and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.  If this function otherwise fails to
+    /// extract a valid value, this stream is marked invalid and the value
+    /// of `variable` is undefined.  Note that the value will be
+    /// zero-extended.
+    BlobInStream& getUint8(char&          variable);
+    BlobInStream& getUint8(unsigned char& variable);
+
+                      // *** scalar floating-point values ***
+
+    /// Assign to the specified `variable` the eight-byte IEEE
+    /// double-precision floating-point number (in host byte order)
+    /// comprised of the eight bytes of this stream at the current cursor
+    /// location (in network byte order), update the cursor location, and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  If this function otherwise
+    /// fails to extract a valid value, this stream is marked invalid and
+    /// the value of `variable` is undefined.
+    BlobInStream& getFloat64(double& variable);
+
+    /// Assign to the specified `variable` the four-byte IEEE
+    /// single-precision floating-point number (in host byte order)
+    /// comprised of the four bytes of this stream at the current cursor
+    /// location (in network byte order), update the cursor location, and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  If this function otherwise
+    /// fails to extract a valid value, this stream is marked invalid and
+    /// the value of `variable` is undefined.
+    BlobInStream& getFloat32(float& variable);
+
+                      // *** string values ***
+
+    /// Assign to the specified `variable` the string comprised of the
+    /// length of the string (see `getLength`) and the string data (see
+    /// `getUint8`), update the cursor location, and return a reference to
+    /// this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variable` is
+    /// undefined.
+    BlobInStream& getString(bsl::string& variable);
+
+                      // *** arrays of integer values ***
+
+    /// Assign to the specified `variables` the consecutive eight-byte,
+    /// two's complement integers (in host byte order) comprised of each of
+    /// the specified `numVariables` eight-byte sequences of this stream at
+    /// the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// sign-extended.
+    BlobInStream& getArrayInt64(bsls::Types::Int64 *variables,
+                                int                 numVariables);
+
+    /// Assign to the specified `variables` the consecutive eight-byte,
+    /// two's complement unsigned integers (in host byte order) comprised of
+    /// each of the specified `numVariables` eight-byte sequences of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variables` is undefined.
+    /// The behavior is undefined unless `0 <= numVariables` and `variables`
+    /// has sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint64(bsls::Types::Uint64 *variables,
+                                 int                  numVariables);
+
+    /// Assign to the specified `variables` the consecutive seven-byte,
+    /// two's complement integers (in host byte order) comprised of each of
+    /// the specified `numVariables` seven-byte sequences of this stream at
+    /// the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// sign-extended.
+    BlobInStream& getArrayInt56(bsls::Types::Int64 *variables,
+                                int                 numVariables);
+
+    /// Assign to the specified `variables` the consecutive seven-byte,
+    /// two's complement unsigned integers (in host byte order) comprised of
+    /// each of the specified `numVariables` seven-byte sequences of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variables` is undefined.
+    /// The behavior is undefined unless `0 <= numVariables` and `variables`
+    /// has sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint56(bsls::Types::Uint64 *variables,
+                                 int                  numVariables);
+
+    /// Assign to the specified `variables` the consecutive six-byte, two's
+    /// complement integers (in host byte order) comprised of each of the
+    /// specified `numVariables` six-byte sequences of this stream at the
+    /// current cursor location (in network byte order), update the cursor
+    /// location, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  If this function
+    /// otherwise fails to extract a valid value, this stream is marked
+    /// invalid and the value of `variables` is undefined.  The behavior is
+    /// undefined unless `0 <= numVariables` and `variables` has sufficient
+    /// capacity.  Note that each of the values will be sign-extended.
+    BlobInStream& getArrayInt48(bsls::Types::Int64 *variables,
+                                int                 numVariables);
+
+    /// Assign to the specified `variables` the consecutive six-byte, two's
+    /// complement unsigned integers (in host byte order) comprised of each
+    /// of the specified `numVariables` six-byte sequences of this stream at
+    /// the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint48(bsls::Types::Uint64 *variables,
+                                 int                  numVariables);
+
+    /// Assign to the specified `variables` the consecutive five-byte, two's
+    /// complement integers (in host byte order) comprised of each of the
+    /// specified `numVariables` five-byte sequences of this stream at the
+    /// current cursor location (in network byte order), update the cursor
+    /// location, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  If this function
+    /// otherwise fails to extract a valid value, this stream is marked
+    /// invalid and the value of `variables` is undefined.  The behavior is
+    /// undefined unless `0 <= numVariables` and `variables` has sufficient
+    /// capacity.  Note that each of the values will be sign-extended.
+    BlobInStream& getArrayInt40(bsls::Types::Int64 *variables,
+                                int                 numVariables);
+
+    /// Assign to the specified `variables` the consecutive five-byte, two's
+    /// complement unsigned integers (in host byte order) comprised of each
+    /// of the specified `numVariables` five-byte sequences of this stream
+    /// at the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint40(bsls::Types::Uint64 *variables,
+                                 int                  numVariables);
+
+    /// Assign to the specified `variables` the consecutive four-byte, two's
+    /// complement integers (in host byte order) comprised of each of the
+    /// specified `numVariables` four-byte sequences of this stream at the
+    /// current cursor location (in network byte order), update the cursor
+    /// location, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  If this function
+    /// otherwise fails to extract a valid value, this stream is marked
+    /// invalid and the value of `variables` is undefined.  The behavior is
+    /// undefined unless `0 <= numVariables` and `variables` has sufficient
+    /// capacity.  Note that each of the values will be sign-extended.
+    BlobInStream& getArrayInt32(int *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive four-byte, two's
+    /// complement unsigned integers (in host byte order) comprised of each
+    /// of the specified `numVariables` four-byte sequences of this stream
+    /// at the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint32(unsigned int *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive three-byte,
+    /// two's complement integers (in host byte order) comprised of each of
+    /// the specified `numVariables` three-byte sequences of this stream at
+    /// the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numValues` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// sign-extended.
+    BlobInStream& getArrayInt24(int *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive three-byte,
+    /// two's complement unsigned integers (in host byte order) comprised of
+    /// each of the specified `numVariables` three-byte sequences of this
+    /// stream at the current cursor location (in network byte order),
+    /// update the cursor location, and return a reference to this stream.
+    /// If this stream is initially invalid, this operation has no effect.
+    /// If this function otherwise fails to extract a valid value, this
+    /// stream is marked invalid and the value of `variables` is undefined.
+    /// The behavior is undefined unless `0 <= numVariables` and `variables`
+    /// has sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint24(unsigned int *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive two-byte, two's
+    /// complement integers (in host byte order) comprised of each of the
+    /// specified `numVariables` two-byte sequences of this stream at the
+    /// current cursor location (in network byte order), update the cursor
+    /// location, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  If this function
+    /// otherwise fails to extract a valid value, this stream is marked
+    /// invalid and the value of `variables` is undefined.  The behavior is
+    /// undefined unless `0 <= numVariables` and `variables` has sufficient
+    /// capacity.  Note that each of the values will be sign-extended.
+    BlobInStream& getArrayInt16(short *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive two-byte, two's
+    /// complement unsigned integers (in host byte order) comprised of each
+    /// of the specified `numVariables` two-byte sequences of this stream at
+    /// the current cursor location (in network byte order), update the
+    /// cursor location, and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  If this
+    /// function otherwise fails to extract a valid value, this stream is
+    /// marked invalid and the value of `variables` is undefined.  The
+    /// behavior is undefined unless `0 <= numVariables` and `variables` has
+    /// sufficient capacity.  Note that each of the values will be
+    /// zero-extended.
+    BlobInStream& getArrayUint16(unsigned short *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive one-byte, two's
+    /// complement integers comprised of each of the specified
+    /// `numVariables` one-byte sequences of this stream at the current
+    /// cursor location, update the cursor location, and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variables` is
+    /// undefined.  The behavior is undefined unless `0 <= numVariables` and
+    /// `variables` has sufficient capacity.  Note that each of the values
+    /// will be sign-extended.
+    BlobInStream& getArrayInt8(char *variables,        int numVariables);
+    BlobInStream& getArrayInt8(signed char *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive one-byte, two's
+    /// complement unsigned integers comprised of each of the specified
+    /// `numVariables` one-byte sequences of this stream at the current
+    /// cursor location, update the cursor location, and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variables` is
+    /// undefined.  The behavior is undefined unless `0 <= numVariables` and
+    /// `variables` has sufficient capacity.  Note that each of the values
+    /// will be zero-extended.
+    BlobInStream& getArrayUint8(char *variables,          int numVariables);
+    BlobInStream& getArrayUint8(unsigned char *variables, int numVariables);
+
+                      // *** arrays of floating-point values ***
+
+    /// Assign to the specified `variables` the consecutive eight-byte IEEE
+    /// double-precision floating-point numbers (in host byte order)
+    /// comprised of each of the specified `numVariables` eight-byte
+    /// sequences of this stream at the current cursor location (in network
+    /// byte order), update the cursor location, and return a reference to
+    /// this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variables` is
+    /// undefined.  The behavior is undefined unless `0 <= numVariables` and
+    /// `variables` has sufficient capacity.
+    BlobInStream& getArrayFloat64(double *variables, int numVariables);
+
+    /// Assign to the specified `variables` the consecutive four-byte IEEE
+    /// single-precision floating-point numbers (in host byte order)
+    /// comprised of each of the specified `numVariables` four-byte
+    /// sequences of this stream at the current cursor location (in network
+    /// byte order), update the cursor location, and return a reference to
+    /// this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  If this function otherwise fails to extract a valid
+    /// value, this stream is marked invalid and the value of `variables` is
+    /// undefined.  The behavior is undefined unless `0 <= numVariables` and
+    /// `variables` has sufficient capacity.
+    BlobInStream& getArrayFloat32(float *variables, int numVariables);
+
+
+    // ACCESSORS
+
+    /// Return a non-zero value if this stream is valid, and 0 otherwise.
+    /// An invalid stream is a stream for which an input operation was
+    /// detected to have failed.
+    operator const void *() const;
+
+    /// Return the address of the blob held by this stream, or 0 if this
+    /// stream holds no blob.
+    const Blob *blob() const;
+
+    /// Return the index of the next byte to be extracted from this stream.
+    int cursor() const;
+
+    /// Return `true` if this stream is empty, and `false` otherwise.  Note
+    /// that this function enables higher-level types to verify that, after
+    /// successfully reading all expected data, no data remains.
+    bool isEmpty() const;
+
+    /// Return `true` if this stream is valid, and `false` otherwise.  An
+    /// invalid stream is a stream in which insufficient or invalid data was
+    /// detected during an extraction operation.  Note that an empty stream
+    /// will be valid unless an extraction attempt or explicit invalidation
+    /// causes it to be otherwise.
+    bool isValid() const;
+
+    /// Return the total number of bytes in this stream (i.e., the length of
+    /// the held blob).
+    int length() const;
+};
+
+// FREE OPERATORS
+
+/// Read the specified `value` from the specified input `stream` following
+/// the requirements of the BDEX protocol (see the `bslx` package-level
+/// documentation), and return a reference to `stream`.  The behavior is
+/// undefined unless `TYPE` is BDEX-compliant.
+template <class TYPE>
+BlobInStream& operator>>(BlobInStream& stream, TYPE& value);
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class BlobInStream
+                             // ------------------
+
+// CREATORS
+inline
+BlobInStream::BlobInStream()
+: d_blob_p(0)
+, d_begin_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_bufferIndex(0)
+, d_bufferOffset(0)
+, d_validFlag(true)
+{
+}
+
+inline
+BlobInStream::BlobInStream(const Blob *blob)
+: d_blob_p(blob)
+, d_begin_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_bufferIndex(0)
+, d_bufferOffset(0)
+, d_validFlag(true)
+{
+    BSLS_ASSERT(blob);
+
+    attach();
+}
+
+inline
+BlobInStream::~BlobInStream()
+{
+}
+
+// MANIPULATORS
+inline
+BlobInStream& BlobInStream::getLength(int& length)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    unsigned char first = 0;
+    getUint8(first);
+
+    if (127 < first) {
+        // If 'length > 127', 'length' is stored as 4 bytes with top bit set.
+
+        unsigned int rest = 0;
+        getUint24(rest);
+        length = static_cast<int>(((first & 0x7fu) << 24) | rest);
+    }
+    else {
+        // If 'length <= 127', 'length' is stored as one byte.
+
+        length = first;
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getVersion(int& version)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    unsigned char tmp = 0;
+    getUint8(tmp);
+    version = tmp;
+
+    return *this;
+}
+
+inline
+void BlobInStream::invalidate()
+{
+    d_validFlag = false;
+}
+
+inline
+void BlobInStream::reset()
+{
+    d_validFlag = true;
+    attach();
+}
+
+inline
+void BlobInStream::reset(const Blob *blob)
+{
+    BSLS_ASSERT(blob);
+
+    d_blob_p    = blob;
+    d_validFlag = true;
+    attach();
+}
+
+                      // *** scalar integer values ***
+
+inline
+BlobInStream& BlobInStream::getInt64(bsls::Types::Int64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt64(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt64(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint64(bsls::Types::Uint64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint64(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint64(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt56(bsls::Types::Int64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt56(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt56(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint56(bsls::Types::Uint64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint56(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint56(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt48(bsls::Types::Int64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt48(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt48(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint48(bsls::Types::Uint64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint48(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint48(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt40(bsls::Types::Int64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt40(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt40(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint40(bsls::Types::Uint64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint40(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint40(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt32(int& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt32(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt32(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint32(unsigned int& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint32(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint32(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt24(int& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt24(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt24(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint24(unsigned int& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint24(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint24(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt16(short& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getInt16(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getInt16(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getUint16(unsigned short& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getUint16(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getUint16(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt8(char& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_cursor_p != d_end_p)) {
+        variable = *d_cursor_p;
+        ++d_cursor_p;
+    }
+    else {
+        readRaw(&variable, 1);
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getInt8(signed char& variable)
+{
+    return getInt8(reinterpret_cast<char&>(variable));
+}
+
+inline
+BlobInStream& BlobInStream::getUint8(char& variable)
+{
+    return getInt8(variable);
+}
+
+inline
+BlobInStream& BlobInStream::getUint8(unsigned char& variable)
+{
+    return getInt8(reinterpret_cast<char&>(variable));
+}
+
+                      // *** scalar floating-point values ***
+
+inline
+BlobInStream& BlobInStream::getFloat64(double& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT64;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getFloat64(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getFloat64(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getFloat32(float& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT32;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::getFloat32(&variable, d_cursor_p);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        if (0 == readRaw(scratch, size)) {
+            bslx::MarshallingUtil::getFloat32(&variable, scratch);
+        }
+    }
+
+    return *this;
+}
+
+                      // *** string values ***
+
+inline
+BlobInStream& BlobInStream::getString(bsl::string& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    int length;
+    getLength(length);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Unlike 'bslx::ByteInStream', the number of bytes remaining in the blob
+    // is known, so a corrupt 'length' is detected before any allocation.
+
+    if (length > BlobInStream::length() - cursor()) {
+        invalidate();
+        return *this;                                                 // RETURN
+    }
+
+    variable.resize(length);
+
+    if (0 == length) {
+        return *this;                                                 // RETURN
+    }
+
+    return getArrayUint8(&variable.front(), length);
+}
+
+                      // *** arrays of integer values ***
+
+inline
+BlobInStream& BlobInStream::getArrayInt8(char *variables, int numVariables)
+{
+    BSLS_ASSERT_SAFE(variables || 0 == numVariables);
+    BSLS_ASSERT_SAFE(0 <= numVariables);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >=
+                                                              numVariables)) {
+        if (numVariables) {
+            bsl::memcpy(variables, d_cursor_p, numVariables);
+            d_cursor_p += numVariables;
+        }
+    }
+    else {
+        readRaw(variables, numVariables);
+    }
+
+    return *this;
+}
+
+inline
+BlobInStream& BlobInStream::getArrayInt8(signed char *variables,
+                                         int          numVariables)
+{
+    return getArrayInt8(reinterpret_cast<char *>(variables), numVariables);
+}
+
+inline
+BlobInStream& BlobInStream::getArrayUint8(char *variables, int numVariables)
+{
+    return getArrayInt8(variables, numVariables);
+}
+
+inline
+BlobInStream& BlobInStream::getArrayUint8(unsigned char *variables,
+                                          int            numVariables)
+{
+    return getArrayInt8(reinterpret_cast<char *>(variables), numVariables);
+}
+
+// ACCESSORS
+inline
+BlobInStream::operator const void *() const
+{
+    return isValid() ? this : 0;
+}
+
+inline
+const Blob *BlobInStream::blob() const
+{
+    return d_blob_p;
+}
+
+inline
+int BlobInStream::cursor() const
+{
+    return d_bufferOffset + static_cast<int>(d_cursor_p - d_begin_p);
+}
+
+inline
+bool BlobInStream::isEmpty() const
+{
+    return cursor() == length();
+}
+
+inline
+bool BlobInStream::isValid() const
+{
+    return d_validFlag;
+}
+
+inline
+int BlobInStream::length() const
+{
+    return d_blob_p ? d_blob_p->length() : 0;
+}
+
+template <class TYPE>
+inline
+BlobInStream& operator>>(BlobInStream& stream, TYPE& value)
+{
+    return bslx::InStreamFunctions::bdexStreamIn(stream, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
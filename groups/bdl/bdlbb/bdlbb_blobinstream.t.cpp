@@ -0,0 +1,1131 @@
+// bdlbb_blobinstream.t.cpp                                           -*-C++-*-
+#include <bdlbb_blobinstream.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_bloboutstream.h>                // for testing only
+#include <bdlbb_simpleblobbufferfactory.h>      // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a BDEX input stream reading the data of a
+// `bdlbb::Blob`.  The reference for every value read is `bslx::ByteInStream`:
+// each test writes a sequence of values with `bslx::ByteOutStream`, copies the
+// bytes into blobs having a variety of buffer sizes (including sizes smaller
+// than the values read, so that values straddle buffers, and blobs having
+// buffers of differing sizes), and reads the sequence back with both a
+// `bdlbb::BlobInStream` and a `bslx::ByteInStream`, comparing the results.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 5] BlobInStream();
+// [ 1] BlobInStream(const Blob *blob);
+// [ 1] ~BlobInStream();
+//
+// MANIPULATORS
+// [ 4] BlobInStream& getLength(int& length);
+// [ 4] BlobInStream& getVersion(int& version);
+// [ 5] void invalidate();
+// [ 5] void reset();
+// [ 5] void reset(const Blob *blob);
+// [ 2] BlobInStream& getInt64(bsls::Types::Int64& variable);
+// [ 2] BlobInStream& getUint64(bsls::Types::Uint64& variable);
+// [ 2] BlobInStream& getInt56(bsls::Types::Int64& variable);
+// [ 2] BlobInStream& getUint56(bsls::Types::Uint64& variable);
+// [ 2] BlobInStream& getInt48(bsls::Types::Int64& variable);
+// [ 2] BlobInStream& getUint48(bsls::Types::Uint64& variable);
+// [ 2] BlobInStream& getInt40(bsls::Types::Int64& variable);
+// [ 2] BlobInStream& getUint40(bsls::Types::Uint64& variable);
+// [ 2] BlobInStream& getInt32(int& variable);
+// [ 2] BlobInStream& getUint32(unsigned int& variable);
+// [ 2] BlobInStream& getInt24(int& variable);
+// [ 2] BlobInStream& getUint24(unsigned int& variable);
+// [ 2] BlobInStream& getInt16(short& variable);
+// [ 2] BlobInStream& getUint16(unsigned short& variable);
+// [ 2] BlobInStream& getInt8(char& variable);
+// [ 2] BlobInStream& getInt8(signed char& variable);
+// [ 2] BlobInStream& getUint8(char& variable);
+// [ 2] BlobInStream& getUint8(unsigned char& variable);
+// [ 2] BlobInStream& getFloat64(double& variable);
+// [ 2] BlobInStream& getFloat32(float& variable);
+// [ 3] BlobInStream& getString(bsl::string& variable);
+// [ 3] BlobInStream& getArrayInt64(bsls::Types::Int64 *, int);
+// [ 3] BlobInStream& getArrayUint64(bsls::Types::Uint64 *, int);
+// [ 3] BlobInStream& getArrayInt56(bsls::Types::Int64 *, int);
+// [ 3] BlobInStream& getArrayUint56(bsls::Types::Uint64 *, int);
+// [ 3] BlobInStream& getArrayInt48(bsls::Types::Int64 *, int);
+// [ 3] BlobInStream& getArrayUint48(bsls::Types::Uint64 *, int);
+// [ 3] BlobInStream& getArrayInt40(bsls::Types::Int64 *, int);
+// [ 3] BlobInStream& getArrayUint40(bsls::Types::Uint64 *, int);
+// [ 3] BlobInStream& getArrayInt32(int *variables, int numVariables);
+// [ 3] BlobInStream& getArrayUint32(unsigned int *variables, int);
+// [ 3] BlobInStream& getArrayInt24(int *variables, int numVariables);
+// [ 3] BlobInStream& getArrayUint24(unsigned int *variables, int);
+// [ 3] BlobInStream& getArrayInt16(short *variables, int numVariables);
+// [ 3] BlobInStream& getArrayUint16(unsigned short *variables, int);
+// [ 3] BlobInStream& getArrayInt8(char *variables, int numVariables);
+// [ 3] BlobInStream& getArrayInt8(signed char *variables, int);
+// [ 3] BlobInStream& getArrayUint8(char *variables, int numVariables);
+// [ 3] BlobInStream& getArrayUint8(unsigned char *variables, int);
+// [ 3] BlobInStream& getArrayFloat64(double *variables, int);
+// [ 3] BlobInStream& getArrayFloat32(float *variables, int);
+//
+// ACCESSORS
+// [ 4] operator const void *() const;
+// [ 5] const Blob *blob() const;
+// [ 4] int cursor() const;
+// [ 4] bool isEmpty() const;
+// [ 4] bool isValid() const;
+// [ 5] int length() const;
+//
+// FREE OPERATORS
+// [ 5] BlobInStream& operator>>(BlobInStream&, TYPE& value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobInStream Obj;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+const int VERSION_SELECTOR = 20260101;
+
+/// Buffer sizes with which blobs are created by the table-driven tests; a
+/// negative value denotes buffers of cycling sizes (see `CyclingFactory`).
+const int BUFFER_SIZES[]   = { -1, 1, 2, 3, 5, 7, 8, 13, 64, 1024 };
+const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES;
+
+                           // ====================
+                           // class CyclingFactory
+                           // ====================
+
+/// This class implements the `bdlbb::BlobBufferFactory` protocol, supplying
+/// buffers of a fixed size or, if the size supplied at construction is
+/// negative, buffers whose sizes cycle through 1, 6, 2, 11, and 4 bytes.
+class CyclingFactory : public bdlbb::BlobBufferFactory {
+
+    // DATA
+    bdlbb::SimpleBlobBufferFactory d_factory;
+    bool                           d_cycleFlag;
+    int                            d_next;
+
+  public:
+    // CREATORS
+    explicit CyclingFactory(int               bufferSize,
+                            bslma::Allocator *basicAllocator = 0)
+    : d_factory(bufferSize < 0 ? 16 : bufferSize, basicAllocator)
+    , d_cycleFlag(bufferSize < 0)
+    , d_next(0)
+    {
+    }
+
+    // MANIPULATORS
+    void allocate(bdlbb::BlobBuffer *buffer) BSLS_KEYWORD_OVERRIDE
+    {
+        static const int SIZES[] = { 1, 6, 2, 11, 4 };
+
+        if (d_cycleFlag) {
+            d_factory.setBufferSize(SIZES[d_next++ % 5]);
+        }
+        d_factory.allocate(buffer);
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Load into the specified `blob` the specified `numBytes` from the
+/// specified `data`, replacing its contents.
+void loadBlob(bdlbb::Blob *blob, const char *data, int numBytes)
+{
+    blob->removeAll();
+    blob->setLength(numBytes);
+
+    for (int i = 0, offset = 0; offset < numBytes; ++i) {
+        const bdlbb::BlobBuffer& buffer = blob->buffer(i);
+        const int                n      = numBytes - offset < buffer.size()
+                                          ? numBytes - offset
+                                          : buffer.size();
+
+        bsl::memcpy(buffer.data(), data + offset, n);
+        offset += n;
+    }
+}
+
+/// Write to the specified `stream` one value of each scalar type, derived
+/// from the specified `seed`.
+void putScalars(bslx::ByteOutStream& stream, int seed)
+{
+    const Int64 v = 0x0123456789abcdefLL * (seed + 1);
+
+    stream.putInt64(v);
+    stream.putUint64(static_cast<Uint64>(~v));
+    stream.putInt56(v >> 3);
+    stream.putUint56(static_cast<Uint64>(v) >> 5);
+    stream.putInt48(-v);
+    stream.putUint48(static_cast<Uint64>(v) >> 7);
+    stream.putInt40(v >> 11);
+    stream.putUint40(static_cast<Uint64>(v) >> 13);
+    stream.putInt32(static_cast<int>(v));
+    stream.putUint32(static_cast<unsigned int>(v >> 17));
+    stream.putInt24(static_cast<int>(v >> 19));
+    stream.putUint24(static_cast<unsigned int>(v >> 23));
+    stream.putInt16(static_cast<int>(v >> 29));
+    stream.putUint16(static_cast<unsigned int>(v >> 31));
+    stream.putInt8(static_cast<int>(v >> 37));
+    stream.putInt8(static_cast<int>(v >> 39));
+    stream.putUint8(static_cast<unsigned int>(v >> 41));
+    stream.putUint8(static_cast<unsigned int>(v >> 43));
+    stream.putFloat64(static_cast<double>(v) / 3.0);
+    stream.putFloat32(static_cast<float>(seed) * 1.5f);
+    stream.putLength(seed);
+    stream.putLength(seed + 1000);
+    stream.putVersion(seed);
+}
+
+/// Read from the specified `stream` one value of each scalar type, in the
+/// order written by `putScalars`, appending the bits of each value to the
+/// specified `results`.
+template <class STREAM>
+void getScalars(STREAM& stream, bsl::vector<Uint64> *results)
+{
+    Int64          i64 = 0;
+    Uint64         u64 = 0;
+    int            i32 = 0;
+    unsigned int   u32 = 0;
+    short          i16 = 0;
+    unsigned short u16 = 0;
+    char           c8  = 0;
+    signed char    i8  = 0;
+    unsigned char  u8  = 0;
+    double         f64 = 0;
+    float          f32 = 0;
+
+    stream.getInt64(i64);    results->push_back(i64);
+    stream.getUint64(u64);   results->push_back(u64);
+    stream.getInt56(i64);    results->push_back(i64);
+    stream.getUint56(u64);   results->push_back(u64);
+    stream.getInt48(i64);    results->push_back(i64);
+    stream.getUint48(u64);   results->push_back(u64);
+    stream.getInt40(i64);    results->push_back(i64);
+    stream.getUint40(u64);   results->push_back(u64);
+    stream.getInt32(i32);    results->push_back(i32);
+    stream.getUint32(u32);   results->push_back(u32);
+    stream.getInt24(i32);    results->push_back(i32);
+    stream.getUint24(u32);   results->push_back(u32);
+    stream.getInt16(i16);    results->push_back(i16);
+    stream.getUint16(u16);   results->push_back(u16);
+    stream.getInt8(c8);      results->push_back(c8);
+    stream.getInt8(i8);      results->push_back(i8);
+    stream.getUint8(c8);     results->push_back(c8);
+    stream.getUint8(u8);     results->push_back(u8);
+    stream.getFloat64(f64);
+    bsl::memcpy(&u64, &f64, sizeof u64);
+    results->push_back(u64);
+    stream.getFloat32(f32);
+    bsl::memcpy(&u32, &f32, sizeof u32);
+    results->push_back(u32);
+    stream.getLength(i32);   results->push_back(i32);
+    stream.getLength(i32);   results->push_back(i32);
+    stream.getVersion(i32);  results->push_back(i32);
+}
+
+/// Write to the specified `stream` one array of each type, each having the
+/// specified `numValues` elements, and strings of `numValues` and
+/// `numValues + 200` characters.
+void putArrays(bslx::ByteOutStream& stream, int numValues)
+{
+    for (int k = 0; k < 20; ++k) {
+        for (int i = 0; i < numValues; ++i) {
+            const Int64 v = 0x1122334455667788LL * (i + 3) - i * k;
+
+            switch (k) {
+              case 0:  stream.putInt64(v);                             break;
+              case 1:  stream.putUint64(~v);                           break;
+              case 2:  stream.putInt56(v >> 1);                        break;
+              case 3:  stream.putUint56(v >> 2);                       break;
+              case 4:  stream.putInt48(v >> 3);                        break;
+              case 5:  stream.putUint48(v >> 4);                       break;
+              case 6:  stream.putInt40(v >> 5);                        break;
+              case 7:  stream.putUint40(v >> 6);                       break;
+              case 8:  stream.putInt32(static_cast<int>(v >> 7));      break;
+              case 9:  stream.putUint32(static_cast<unsigned>(v));     break;
+              case 10: stream.putInt24(static_cast<int>(v >> 9));      break;
+              case 11: stream.putUint24(static_cast<unsigned>(v));     break;
+              case 12: stream.putInt16(static_cast<int>(v >> 11));     break;
+              case 13: stream.putUint16(static_cast<unsigned>(v));     break;
+              case 14: stream.putInt8(static_cast<int>(v >> 13));      break;
+              case 15: stream.putInt8(static_cast<int>(v >> 14));      break;
+              case 16: stream.putUint8(static_cast<unsigned>(v));      break;
+              case 17: stream.putUint8(static_cast<unsigned>(v >> 1)); break;
+              case 18: stream.putFloat64(static_cast<double>(v) / 7);  break;
+              case 19: stream.putFloat32(static_cast<float>(i) / 4);   break;
+            }
+        }
+    }
+
+    stream.putString(bsl::string(numValues, 'a'));
+    stream.putString(bsl::string(numValues + 200, 'b'));
+}
+
+/// Append the elements of the specified `values` array of the specified
+/// `numValues` elements to the specified `results`, as bits.
+template <class TYPE>
+void record(bsl::vector<Uint64> *results, const TYPE *values, int numValues)
+{
+    for (int i = 0; i < numValues; ++i) {
+        Uint64 bits = 0;
+        bsl::memcpy(&bits, values + i, sizeof *values);
+        results->push_back(bits);
+    }
+}
+
+/// Read from the specified `stream` the arrays and strings, each array
+/// having the specified `numValues` elements, in the order written by
+/// `putArrays`, appending the bits of each value to the specified
+/// `results`.
+template <class STREAM>
+void getArrays(STREAM&              stream,
+               int                  numValues,
+               bsl::vector<Uint64> *results)
+{
+    bsl::vector<Int64>          i64(numValues + 1);
+    bsl::vector<Uint64>         u64(numValues + 1);
+    bsl::vector<int>            i32(numValues + 1);
+    bsl::vector<unsigned int>   u32(numValues + 1);
+    bsl::vector<short>          i16(numValues + 1);
+    bsl::vector<unsigned short> u16(numValues + 1);
+    bsl::vector<char>           c8(numValues + 1);
+    bsl::vector<signed char>    i8(numValues + 1);
+    bsl::vector<unsigned char>  u8(numValues + 1);
+    bsl::vector<double>         f64(numValues + 1);
+    bsl::vector<float>          f32(numValues + 1);
+
+    const int N = numValues;
+
+    stream.getArrayInt64(i64.data(), N);    record(results, i64.data(), N);
+    stream.getArrayUint64(u64.data(), N);   record(results, u64.data(), N);
+    stream.getArrayInt56(i64.data(), N);    record(results, i64.data(), N);
+    stream.getArrayUint56(u64.data(), N);   record(results, u64.data(), N);
+    stream.getArrayInt48(i64.data(), N);    record(results, i64.data(), N);
+    stream.getArrayUint48(u64.data(), N);   record(results, u64.data(), N);
+    stream.getArrayInt40(i64.data(), N);    record(results, i64.data(), N);
+    stream.getArrayUint40(u64.data(), N);   record(results, u64.data(), N);
+    stream.getArrayInt32(i32.data(), N);    record(results, i32.data(), N);
+    stream.getArrayUint32(u32.data(), N);   record(results, u32.data(), N);
+    stream.getArrayInt24(i32.data(), N);    record(results, i32.data(), N);
+    stream.getArrayUint24(u32.data(), N);   record(results, u32.data(), N);
+    stream.getArrayInt16(i16.data(), N);    record(results, i16.data(), N);
+    stream.getArrayUint16(u16.data(), N);   record(results, u16.data(), N);
+    stream.getArrayInt8(c8.data(), N);      record(results, c8.data(), N);
+    stream.getArrayInt8(i8.data(), N);      record(results, i8.data(), N);
+    stream.getArrayUint8(c8.data(), N);     record(results, c8.data(), N);
+    stream.getArrayUint8(u8.data(), N);     record(results, u8.data(), N);
+    stream.getArrayFloat64(f64.data(), N);  record(results, f64.data(), N);
+    stream.getArrayFloat32(f32.data(), N);  record(results, f32.data(), N);
+
+    bsl::string s;
+    stream.getString(s);
+    record(results, s.data(), static_cast<int>(s.size()));
+    stream.getString(s);
+    record(results, s.data(), static_cast<int>(s.size()));
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Unexternalizing From a Blob
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a `bdlbb::Blob` containing values externalized by a
+// `bdlbb::BlobOutStream` (or by a `bslx::ByteOutStream`), and wish to read
+// them back without first copying the blob into a contiguous buffer.
+//
+// First, we externalize a few values into a blob having small buffers, so
+// that some of the values straddle two buffers:
+// ```
+    bdlbb::SimpleBlobBufferFactory factory(8);
+    bdlbb::Blob                    blob(&factory);
+    {
+        bdlbb::BlobOutStream outStream(&blob, 20260101);
+        outStream.putInt32(1);
+        outStream.putInt32(2);
+        outStream.putInt8('c');
+        outStream.putString(bsl::string("hello"));
+    }
+    ASSERT(15 == blob.length());
+// ```
+// Then, we create a `bdlbb::BlobInStream` reading from the blob, and
+// unexternalize the values:
+// ```
+    bdlbb::BlobInStream inStream(&blob);
+
+    int         a;
+    int         b;
+    char        c;
+    bsl::string s;
+
+    inStream.getInt32(a);
+    inStream.getInt32(b);
+    inStream.getInt8(c);
+    inStream.getString(s);
+// ```
+// Finally, we verify that the values were read correctly and that the stream
+// was consumed in its entirety:
+// ```
+    ASSERT(inStream);
+    ASSERT(inStream.isEmpty());
+    ASSERT(1       == a);
+    ASSERT(2       == b);
+    ASSERT('c'     == c);
+    ASSERT("hello" == s);
+// ```
+// Note that reading beyond the end of the blob invalidates the stream:
+// ```
+    inStream.getInt8(c);
+    ASSERT(!inStream);
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RESET, ACCESSORS, BDEX STREAMING, AND NEGATIVE TESTS
+        //
+        // Concerns:
+        // 1. A default-constructed stream is empty, and reading from it
+        //    invalidates it.
+        //
+        // 2. `reset()` rewinds the stream to the beginning of the blob and
+        //    validates it; `reset(blob)` reads another blob.
+        //
+        // 3. `invalidate` invalidates the stream, and reads from an invalid
+        //    stream have no effect.
+        //
+        // 4. `operator>>` unexternalizes BDEX-compliant types.
+        //
+        // 5. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Exercise the default constructor, `reset`, `invalidate`, `blob`,
+        //    and `length` directly.  (C-1..3)
+        //
+        // 2. Stream a `bsl::vector<int>` and a `bsl::string` in with
+        //    `operator>>` from blobs of various buffer sizes.  (C-4)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   BlobInStream();
+        //   void invalidate();
+        //   void reset();
+        //   void reset(const Blob *blob);
+        //   const Blob *blob() const;
+        //   int length() const;
+        //   BlobInStream& operator>>(BlobInStream&, TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "RESET, ACCESSORS, BDEX STREAMING, AND NEGATIVE TESTS"
+                      << endl
+                      << "===================================================="
+                      << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\tDefault construction and reset." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.blob());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.cursor());
+            ASSERT(X.isEmpty());
+            ASSERT(X.isValid());
+
+            char c;
+            mX.getInt8(c);
+            ASSERT(!X.isValid());
+
+            bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+            bdlbb::Blob                    blob1(&factory, &ta);
+            bdlbb::Blob                    blob2(&factory, &ta);
+
+            loadBlob(&blob1, "abcdefg", 7);
+            loadBlob(&blob2, "xyz",     3);
+
+            mX.reset(&blob1);
+            ASSERT(&blob1 == X.blob());
+            ASSERT(X.isValid());
+            ASSERT(7 == X.length());
+            ASSERT(0 == X.cursor());
+
+            char buffer[8] = {};
+            mX.getArrayInt8(buffer, 5);
+            ASSERT(0 == bsl::memcmp(buffer, "abcde", 5));
+            ASSERT(5 == X.cursor());
+
+            mX.invalidate();
+            ASSERT(!X.isValid());
+            mX.getInt8(c);
+            ASSERT(5 == X.cursor());
+
+            mX.reset();
+            ASSERT(X.isValid());
+            ASSERT(0 == X.cursor());
+            mX.getArrayInt8(buffer, 7);
+            ASSERT(0 == bsl::memcmp(buffer, "abcdefg", 7));
+            ASSERT(X.isEmpty());
+
+            mX.reset(&blob2);
+            ASSERT(3 == X.length());
+            mX.getArrayInt8(buffer, 3);
+            ASSERT(0 == bsl::memcmp(buffer, "xyz", 3));
+            ASSERT(X.isValid());
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tBDEX streaming." << endl;
+        {
+            bsl::vector<int> vector(&ta);
+            for (int i = 0; i < 100; ++i) {
+                vector.push_back(i * 1000 - 7);
+            }
+            const bsl::string string(300, 'x', &ta);
+
+            bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+            out << vector << string;
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int SIZE = BUFFER_SIZES[ti];
+
+                CyclingFactory factory(SIZE, &ta);
+                bdlbb::Blob    blob(&factory, &ta);
+
+                loadBlob(&blob, out.data(), static_cast<int>(out.length()));
+
+                Obj mX(&blob);
+
+                bsl::vector<int> v(&ta);
+                bsl::string      s(&ta);
+
+                mX >> v >> s;
+                ASSERTV(SIZE, mX.isValid());
+                ASSERTV(SIZE, mX.isEmpty());
+                ASSERTV(SIZE, vector == v);
+                ASSERTV(SIZE, string == s);
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            loadBlob(&blob, "abcdefgh", 8);
+
+            Obj mX(&blob);
+
+            int values[2];
+
+            ASSERT_PASS(mX.getArrayInt32(values,  1));
+            ASSERT_PASS(mX.getArrayInt32(0,       0));
+            ASSERT_FAIL(mX.getArrayInt32(0,       1));
+            ASSERT_FAIL(mX.getArrayInt32(values, -1));
+
+            char chars[2];
+
+            ASSERT_SAFE_PASS(mX.getArrayInt8(chars,  1));
+            ASSERT_SAFE_FAIL(mX.getArrayInt8(static_cast<char *>(0), 1));
+            ASSERT_SAFE_FAIL(mX.getArrayInt8(chars, -1));
+
+            ASSERT_FAIL(mX.reset(0));
+            ASSERT_FAIL(Obj(0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TRUNCATED AND CORRUPT DATA
+        //
+        // Concerns:
+        // 1. Reading past the end of the blob invalidates the stream, at the
+        //    same point as `bslx::ByteInStream` reading the same bytes,
+        //    whether or not the value that is truncated straddles buffers.
+        //
+        // 2. `cursor` and `isEmpty` reflect the bytes consumed.
+        //
+        // 3. A string whose length exceeds the data remaining invalidates the
+        //    stream without allocating memory for the string.
+        //
+        // Plan:
+        // 1. For each buffer size, and for each prefix of a sequence of
+        //    scalars and arrays, read the sequence from the prefix with both
+        //    a `bdlbb::BlobInStream` and a `bslx::ByteInStream`, and compare
+        //    the validity of the streams and the values read while valid.
+        //    (C-1..2)
+        //
+        // 2. Read a string whose encoded length is very large, and verify no
+        //    memory is allocated by the string.  (C-3)
+        //
+        // Testing:
+        //   BlobInStream& getLength(int& length);
+        //   BlobInStream& getVersion(int& version);
+        //   operator const void *() const;
+        //   int cursor() const;
+        //   bool isEmpty() const;
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TRUNCATED AND CORRUPT DATA" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+        putScalars(out, 5);
+        putArrays(out, 3);
+
+        const int LENGTH = static_cast<int>(out.length());
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int SIZE = BUFFER_SIZES[ti];
+
+            for (int len = 0; len <= LENGTH; ++len) {
+                CyclingFactory factory(SIZE, &ta);
+                bdlbb::Blob    blob(&factory, &ta);
+
+                loadBlob(&blob, out.data(), len);
+
+                Obj                mX(&blob);  const Obj& X = mX;
+                bslx::ByteInStream expected(out.data(), len);
+
+                bsl::vector<Uint64> results(&ta);
+                bsl::vector<Uint64> expectedResults(&ta);
+
+                getScalars(mX, &results);
+                getScalars(expected, &expectedResults);
+
+                ASSERTV(SIZE, len, expected.isValid() == X.isValid());
+                ASSERTV(SIZE, len, !expected == !X);
+                if (X.isValid()) {
+                    ASSERTV(SIZE, len, expectedResults == results);
+                    ASSERTV(SIZE, len,
+                            static_cast<int>(expected.cursor()) ==
+                                                                  X.cursor());
+                    ASSERTV(SIZE, len, expected.isEmpty() == X.isEmpty());
+                }
+
+                getArrays(mX, 3, &results);
+                getArrays(expected, 3, &expectedResults);
+
+                ASSERTV(SIZE, len, expected.isValid() == X.isValid());
+                if (X.isValid()) {
+                    ASSERTV(SIZE, len, LENGTH == len);
+                    ASSERTV(SIZE, len, expectedResults == results);
+                    ASSERTV(SIZE, len, X.isEmpty());
+                }
+                ASSERTV(SIZE, len, X.cursor() <= X.length());
+            }
+        }
+
+        if (verbose) cout << "\tCorrupt string length." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            loadBlob(&blob, "\x7f\xff\xff\xff" "abc", 7);
+
+            Obj mX(&blob);
+
+            bslma::TestAllocator sa("string", veryVeryVerbose);
+            bsl::string          s(&sa);
+
+            mX.getString(s);
+            ASSERT(!mX.isValid());
+            ASSERT(0 == sa.numAllocations());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ARRAY AND STRING GET METHODS
+        //
+        // Concerns:
+        // 1. Each array method reads the values read by the corresponding
+        //    method of `bslx::ByteInStream`, for arrays within one buffer,
+        //    arrays straddling buffers, and arrays spanning many buffers.
+        //
+        // 2. `getString` reads strings of short and long encoded length.
+        //
+        // Plan:
+        // 1. For each buffer size and a set of array lengths, read arrays of
+        //    each type and strings from a blob and from a
+        //    `bslx::ByteInStream`, and compare.  (C-1..2)
+        //
+        // Testing:
+        //   BlobInStream& getString(bsl::string& variable);
+        //   BlobInStream& getArrayInt64(bsls::Types::Int64 *, int);
+        //   BlobInStream& getArrayUint64(bsls::Types::Uint64 *, int);
+        //   BlobInStream& getArrayInt56(bsls::Types::Int64 *, int);
+        //   BlobInStream& getArrayUint56(bsls::Types::Uint64 *, int);
+        //   BlobInStream& getArrayInt48(bsls::Types::Int64 *, int);
+        //   BlobInStream& getArrayUint48(bsls::Types::Uint64 *, int);
+        //   BlobInStream& getArrayInt40(bsls::Types::Int64 *, int);
+        //   BlobInStream& getArrayUint40(bsls::Types::Uint64 *, int);
+        //   BlobInStream& getArrayInt32(int *variables, int numVariables);
+        //   BlobInStream& getArrayUint32(unsigned int *variables, int);
+        //   BlobInStream& getArrayInt24(int *variables, int numVariables);
+        //   BlobInStream& getArrayUint24(unsigned int *variables, int);
+        //   BlobInStream& getArrayInt16(short *variables, int numVariables);
+        //   BlobInStream& getArrayUint16(unsigned short *variables, int);
+        //   BlobInStream& getArrayInt8(char *variables, int numVariables);
+        //   BlobInStream& getArrayInt8(signed char *variables, int);
+        //   BlobInStream& getArrayUint8(char *variables, int numVariables);
+        //   BlobInStream& getArrayUint8(unsigned char *variables, int);
+        //   BlobInStream& getArrayFloat64(double *variables, int);
+        //   BlobInStream& getArrayFloat32(float *variables, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY AND STRING GET METHODS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int LENGTHS[]   = { 0, 1, 2, 3, 7, 16, 100 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int N = LENGTHS[li];
+
+            bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+            putArrays(out, N);
+
+            bslx::ByteInStream  expected(out.data(), out.length());
+            bsl::vector<Uint64> expectedResults(&ta);
+
+            getArrays(expected, N, &expectedResults);
+            ASSERTV(N, expected.isValid());
+            ASSERTV(N, expected.isEmpty());
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int SIZE = BUFFER_SIZES[ti];
+
+                if (veryVerbose) { T_ P_(N) P(SIZE) }
+
+                CyclingFactory factory(SIZE, &ta);
+                bdlbb::Blob    blob(&factory, &ta);
+
+                loadBlob(&blob, out.data(), static_cast<int>(out.length()));
+
+                Obj mX(&blob);  const Obj& X = mX;
+
+                bsl::vector<Uint64> results(&ta);
+                getArrays(mX, N, &results);
+
+                ASSERTV(N, SIZE, X.isValid());
+                ASSERTV(N, SIZE, X.isEmpty());
+                ASSERTV(N, SIZE, expectedResults == results);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SCALAR GET METHODS
+        //
+        // Concerns:
+        // 1. Each scalar method reads the value read by the corresponding
+        //    method of `bslx::ByteInStream`, whether the value lies within the
+        //    current buffer or straddles two (or more) buffers.
+        //
+        // Plan:
+        // 1. For each buffer size, read a sequence of every scalar type
+        //    several times (varying the alignment of each value relative to
+        //    buffer boundaries) from a blob and from a `bslx::ByteInStream`,
+        //    and compare.  (C-1)
+        //
+        // Testing:
+        //   BlobInStream& getInt64(bsls::Types::Int64& variable);
+        //   BlobInStream& getUint64(bsls::Types::Uint64& variable);
+        //   BlobInStream& getInt56(bsls::Types::Int64& variable);
+        //   BlobInStream& getUint56(bsls::Types::Uint64& variable);
+        //   BlobInStream& getInt48(bsls::Types::Int64& variable);
+        //   BlobInStream& getUint48(bsls::Types::Uint64& variable);
+        //   BlobInStream& getInt40(bsls::Types::Int64& variable);
+        //   BlobInStream& getUint40(bsls::Types::Uint64& variable);
+        //   BlobInStream& getInt32(int& variable);
+        //   BlobInStream& getUint32(unsigned int& variable);
+        //   BlobInStream& getInt24(int& variable);
+        //   BlobInStream& getUint24(unsigned int& variable);
+        //   BlobInStream& getInt16(short& variable);
+        //   BlobInStream& getUint16(unsigned short& variable);
+        //   BlobInStream& getInt8(char& variable);
+        //   BlobInStream& getInt8(signed char& variable);
+        //   BlobInStream& getUint8(char& variable);
+        //   BlobInStream& getUint8(unsigned char& variable);
+        //   BlobInStream& getFloat64(double& variable);
+        //   BlobInStream& getFloat32(float& variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR GET METHODS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int NUM_SEQUENCES = 20;
+
+        bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+        for (int seed = 0; seed < NUM_SEQUENCES; ++seed) {
+            putScalars(out, seed);
+
+            // Shift the alignment of the next sequence.
+
+            out.putInt8(seed);
+        }
+
+        bslx::ByteInStream  expected(out.data(), out.length());
+        bsl::vector<Uint64> expectedResults(&ta);
+
+        for (int seed = 0; seed < NUM_SEQUENCES; ++seed) {
+            char c;
+            getScalars(expected, &expectedResults);
+            expected.getInt8(c);
+        }
+        ASSERT(expected.isValid());
+        ASSERT(expected.isEmpty());
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int SIZE = BUFFER_SIZES[ti];
+
+            CyclingFactory factory(SIZE, &ta);
+            bdlbb::Blob    blob(&factory, &ta);
+
+            loadBlob(&blob, out.data(), static_cast<int>(out.length()));
+
+            Obj mX(&blob);  const Obj& X = mX;
+
+            bsl::vector<Uint64> results(&ta);
+
+            for (int seed = 0; seed < NUM_SEQUENCES; ++seed) {
+                char c;
+                getScalars(mX, &results);
+                mX.getInt8(c);
+                ASSERTV(SIZE, seed, seed == c);
+            }
+
+            ASSERTV(SIZE, X.isValid());
+            ASSERTV(SIZE, X.isEmpty());
+            ASSERTV(SIZE, expectedResults == results);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Read a few values from a blob having small buffers, and verify
+        //    the values and the state of the stream.  (C-1)
+        //
+        // Testing:
+        //   BlobInStream(const Blob *blob);
+        //   ~BlobInStream();
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+
+        loadBlob(&blob, "\x01\x02\x03\x04\x05\x06\x07\x03""abc", 11);
+        ASSERT(4 == blob.numDataBuffers());
+
+        Obj mX(&blob);  const Obj& X = mX;
+
+        ASSERT(X.isValid());
+        ASSERT(11 == X.length());
+        ASSERT( 0 == X.cursor());
+
+        char        a;
+        int         b;
+        short       c;
+        bsl::string d(&ta);
+
+        mX.getInt8(a);
+        mX.getInt32(b);
+        mX.getInt16(c);
+        ASSERT(X.isValid());
+        ASSERT(7 == X.cursor());
+        ASSERT(1          == a);
+        ASSERT(0x02030405 == b);
+        ASSERT(0x0607     == c);
+
+        mX.getString(d);
+        ASSERT(X.isValid());
+        ASSERT(X.isEmpty());
+        ASSERT("abc" == d);
+
+        mX.getInt8(a);
+        ASSERT(!X.isValid());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Unexternalizing from a blob with `bdlbb::BlobInStream` is faster
+        //    than copying the blob into a contiguous buffer and reading it
+        //    with a `bslx::ByteInStream`.
+        //
+        // Plan:
+        // 1. Unexternalize a payload of a mix of scalars of a given size,
+        //    repeatedly, by both methods, and report the time taken.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int BUFFER_SIZE = 4096;
+        const int PAYLOADS[]  = { 1024, 64 * 1024, 1024 * 1024 };
+
+        for (int pi = 0; pi < 3; ++pi) {
+            const int NUM_VALUES = PAYLOADS[pi] / 16;
+            const int NUM_ITER   = 64 * 1024 * 1024 / PAYLOADS[pi];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            bdlbb::Blob                    blob(&factory);
+            {
+                bdlbb::BlobOutStream out(&blob, VERSION_SELECTOR);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    out.putInt64(i);
+                    out.putInt32(i);
+                    out.putInt16(i);
+                    out.putInt8(i);
+                    out.putUint8(i);
+                }
+            }
+
+            Int64           sum = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                bsl::vector<char> flat(blob.length());
+
+                int offset = 0;
+                for (int b = 0; offset < blob.length(); ++b) {
+                    const int n = bsl::min(blob.length() - offset,
+                                           blob.buffer(b).size());
+                    bsl::memcpy(flat.data() + offset,
+                                blob.buffer(b).data(),
+                                n);
+                    offset += n;
+                }
+
+                bslx::ByteInStream in(flat.data(), flat.size());
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    Int64 a;  int b;  short c;  char d;  unsigned char e;
+                    in.getInt64(a).getInt32(b).getInt16(c);
+                    in.getInt8(d).getUint8(e);
+                    sum += a + b + c + d + e;
+                }
+            }
+            timer.stop();
+            const double byteStreamTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                bdlbb::BlobInStream in(&blob);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    Int64 a;  int b;  short c;  char d;  unsigned char e;
+                    in.getInt64(a).getInt32(b).getInt16(c);
+                    in.getInt8(d).getUint8(e);
+                    sum -= a + b + c + d + e;
+                }
+            }
+            timer.stop();
+            const double blobStreamTime = timer.accumulatedWallTime();
+
+            ASSERT(0 == sum);
+
+            cout << "payload " << PAYLOADS[pi] << " bytes, "
+                 << NUM_ITER << " iterations:\n"
+                 << "\tcopy + ByteInStream: "
+                 << byteStreamTime * 1e6 / NUM_ITER << " us\n"
+                 << "\tBlobInStream:        "
+                 << blobStreamTime * 1e6 / NUM_ITER << " us" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
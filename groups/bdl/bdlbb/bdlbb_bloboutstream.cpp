@@ -0,0 +1,674 @@
+// bdlbb_bloboutstream.cpp                                            -*-C++-*-
+#include <bdlbb_bloboutstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_bloboutstream_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_simpleblobbufferfactory.h>      // for testing only
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+// Note: on Windows -> WinDef.h:#define min(a,b) ...
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(min)
+#undef min
+#endif
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                            // -------------------
+                            // class BlobOutStream
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void BlobOutStream::attach()
+{
+    const int length = d_blob_p->length();
+
+    if (0 == length) {
+        d_bufferIndex  = 0;
+        d_bufferOffset = 0;
+    }
+    else {
+        d_bufferIndex  = d_blob_p->numDataBuffers() - 1;
+        d_bufferOffset = length - d_blob_p->lastDataBufferLength();
+    }
+
+    if (d_bufferIndex < d_blob_p->numBuffers()) {
+        const BlobBuffer& buffer = d_blob_p->buffer(d_bufferIndex);
+
+        d_begin_p  = buffer.data();
+        d_cursor_p = d_begin_p + (length - d_bufferOffset);
+        d_end_p    = d_begin_p + buffer.size();
+    }
+    else {
+        // The blob has no capacity beyond its data.  Note that, in this
+        // case, 'd_bufferIndex' is the number of buffers in the blob and
+        // 'd_bufferOffset' is the total size of the blob.
+
+        d_begin_p  = 0;
+        d_cursor_p = 0;
+        d_end_p    = 0;
+    }
+}
+
+int BlobOutStream::nextBuffer()
+{
+    int index  = d_bufferIndex;
+    int offset = d_bufferOffset;
+
+    if (index < d_blob_p->numBuffers()) {
+        offset += d_blob_p->buffer(index).size();
+        ++index;
+    }
+
+    while (index < d_blob_p->numBuffers()
+        && 0 == d_blob_p->buffer(index).size()) {
+        ++index;
+    }
+
+    if (index == d_blob_p->numBuffers()) {
+        BlobBufferFactory *factory = d_blob_p->factory();
+        if (0 == factory) {
+            return -1;                                                // RETURN
+        }
+
+        BlobBuffer buffer;
+        factory->allocate(&buffer);
+        if (0 == buffer.size()) {
+            return -1;                                                // RETURN
+        }
+        d_blob_p->appendBuffer(bslmf::MovableRefUtil::move(buffer));
+    }
+
+    const BlobBuffer& buffer = d_blob_p->buffer(index);
+
+    d_bufferIndex  = index;
+    d_bufferOffset = offset;
+    d_begin_p      = buffer.data();
+    d_cursor_p     = d_begin_p;
+    d_end_p        = d_begin_p + buffer.size();
+
+    return 0;
+}
+
+void BlobOutStream::writeRaw(const char *data, int numBytes)
+{
+    BSLS_ASSERT(isValid());
+    BSLS_ASSERT(0 <= numBytes);
+
+    // Obtain the capacity for all of 'data' before writing any of it, so that
+    // a value is either written in full or not at all.  Note that this stream
+    // remains invalid if an exception is thrown while obtaining a buffer.
+
+    invalidate();
+    if (0 != reserveCapacity(numBytes)) {
+        return;                                                       // RETURN
+    }
+    validate();
+
+    while (true) {
+        const int available = static_cast<int>(d_end_p - d_cursor_p);
+
+        if (numBytes <= available) {
+            if (numBytes) {
+                bsl::memcpy(d_cursor_p, data, numBytes);
+                d_cursor_p += numBytes;
+            }
+            return;                                                   // RETURN
+        }
+
+        if (available) {
+            bsl::memcpy(d_cursor_p, data, available);
+            data       += available;
+            numBytes   -= available;
+            d_cursor_p  = d_end_p;
+        }
+
+        const int rc = nextBuffer();
+        BSLS_ASSERT(0 == rc);  (void)rc;
+    }
+}
+
+// MANIPULATORS
+int BlobOutStream::reserveCapacity(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    const bool hasBuffer = d_bufferIndex < d_blob_p->numBuffers();
+    const int  required  = length() + numBytes;
+
+    while (d_blob_p->totalSize() < required) {
+        BlobBufferFactory *factory = d_blob_p->factory();
+        if (0 == factory) {
+            return -1;                                                // RETURN
+        }
+
+        BlobBuffer buffer;
+        factory->allocate(&buffer);
+        if (0 == buffer.size()) {
+            return -1;                                                // RETURN
+        }
+        d_blob_p->appendBuffer(bslmf::MovableRefUtil::move(buffer));
+    }
+
+    if (!hasBuffer && d_bufferIndex < d_blob_p->numBuffers()) {
+        // The stream was positioned past the end of the blob; make the first
+        // appended buffer the current buffer.
+
+        const BlobBuffer& buffer = d_blob_p->buffer(d_bufferIndex);
+
+        d_begin_p  = buffer.data();
+        d_cursor_p = d_begin_p;
+        d_end_p    = d_begin_p + buffer.size();
+    }
+
+    return 0;
+}
+
+void BlobOutStream::reset(Blob *blob)
+{
+    BSLS_ASSERT(blob);
+
+    sync();
+
+    d_blob_p = blob;
+    attach();
+    validate();
+}
+
+                      // *** arrays of integer values ***
+
+BlobOutStream& BlobOutStream::putArrayInt64(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt64(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt64(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint64(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt64(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint64(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt56(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt56(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt56(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint56(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt56(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint56(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt48(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt48(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt48(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint48(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt48(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint48(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt40(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt40(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt40(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint40(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt40(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint40(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt32(const int *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt32(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt32(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint32(const unsigned int *values,
+                                             int                 numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt32(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint32(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt24(const int *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt24(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt24(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint24(const unsigned int *values,
+                                             int                 numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt24(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint24(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayInt16(const short *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt16(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putInt16(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayUint16(const unsigned short *values,
+                                             int                   numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayInt16(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putUint16(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+                      // *** arrays of floating-point values ***
+
+BlobOutStream& BlobOutStream::putArrayFloat64(const double *values,
+                                              int           numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT64;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayFloat64(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putFloat64(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+BlobOutStream& BlobOutStream::putArrayFloat32(const float *values,
+                                              int          numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT32;
+
+    while (isValid() && 0 < numValues) {
+        const int count = bsl::min(
+                           numValues,
+                           static_cast<int>(d_end_p - d_cursor_p) / size);
+        if (0 < count) {
+            bslx::MarshallingUtil::putArrayFloat32(d_cursor_p, values, count);
+            d_cursor_p += count * size;
+            values     += count;
+            numValues  -= count;
+        }
+        else {
+            // The next value straddles two buffers.
+
+            putFloat32(*values);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1071 @@
+// bdlbb_bloboutstream.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBOUTSTREAM
+#define INCLUDED_BDLBB_BLOBOUTSTREAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a BDEX output stream writing directly into a `bdlbb::Blob`.
+//
+//@CLASSES:
+//  bdlbb::BlobOutStream: blob-based output stream for fundamental types
+//
+//@SEE_ALSO: bdlbb_blobinstream, bslx_byteoutstream
+//
+//@DESCRIPTION: This component implements a blob-based output stream class,
+// `bdlbb::BlobOutStream`, that provides platform-independent output methods
+// ("externalization") on values, and arrays of values, of fundamental types,
+// and on `bsl::string`.  `bdlbb::BlobOutStream` models the BDEX `OutStream`
+// protocol (see the `bslx` package-level documentation), and the values it
+// writes have exactly the format written by `bslx::ByteOutStream`, so that
+// they may be read by `bslx::ByteInStream` once flattened, or directly from
+// the blob by `bdlbb::BlobInStream`.
+//
+// Unlike `bslx::ByteOutStream`, which accumulates its output in a single
+// contiguous buffer that must grow (and be reallocated) as data is written,
+// and that must then be copied into a blob to be handed to a blob-based
+// transport, `bdlbb::BlobOutStream` writes each value in place into the
+// buffers of a client-supplied `bdlbb::Blob`.  When the capacity of the blob
+// is exhausted, an additional buffer is obtained from the blob's
+// `bdlbb::BlobBufferFactory` and appended to the blob; previously written
+// bytes are never moved.  Unlike `bslx::StreamBufOutStream` layered on a
+// `bdlbb::OutBlobStreamBuf`, no virtual function is called per value: every
+// `put` method is an inline bounds check followed by a direct write into the
+// current buffer, and only a value that straddles two buffers takes an
+// out-of-line path.
+//
+// A `bdlbb::BlobOutStream` appends to the data of the held blob, starting at
+// the length of the blob when the stream is constructed (or reset).  For
+// efficiency, the length of the held blob is not updated by each `put`
+// method; the length is brought up to date by `sync`, by `reset`, and when
+// the stream is destroyed.  The behavior is undefined if the held blob is
+// modified other than through the stream (or by `reserveCapacity`) while it
+// is held by the stream, and the length of the blob is unspecified until the
+// stream is synchronized.
+//
+// Note that output streams can be *invalidated* explicitly and queried for
+// *validity*.  Writing to an initially invalid stream has no effect.  A
+// stream is invalidated if it needs additional capacity but the held blob has
+// no factory.  As for the `bslx` output streams, no part of a value is written
+// by an operation that fails, although an operation writing an array (or a
+// string) may have written some of the preceding elements.
+//
+// The destructor (and `reset`) update the length of the held blob, so the
+// held blob must outlive the stream, or be replaced (by `reset`) before it is
+// destroyed.  In particular, a blob local to the same scope as the stream
+// must be declared *before* the stream.
+//
+///Versioning
+///----------
+// See the `bslx_byteoutstream` component and the `bslx` package-level
+// documentation for a description of the `versionSelector` supplied at
+// construction.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Externalizing Into a Blob
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we need to externalize a sequence of values to a `bdlbb::Blob` that
+// will be handed to a blob-based transport.  Rather than writing the values
+// to a `bslx::ByteOutStream` and copying its contents into the blob, we write
+// them directly into the blob's buffers.
+//
+// First, we create a blob supplied by a factory of deliberately small buffers,
+// so that the values written below span several buffers:
+// ```
+// bdlbb::SimpleBlobBufferFactory factory(8);
+// bdlbb::Blob                    blob(&factory);
+// ```
+// Then, we create a `bdlbb::BlobOutStream` with an arbitrary value for its
+// `versionSelector` and externalize some values:
+// ```
+// {
+//     bdlbb::BlobOutStream outStream(&blob, 20260101);
+//     outStream.putInt32(1);
+//     outStream.putInt32(2);
+//     outStream.putInt8('c');
+//     outStream.putString(bsl::string("hello"));
+//     assert(outStream);
+//     assert(15 == outStream.length());
+// }
+// ```
+// Now, the stream having been destroyed, the length of the blob reflects the
+// bytes that were written, and those bytes span two buffers:
+// ```
+// assert(15 == blob.length());
+// assert( 2 == blob.numDataBuffers());
+// ```
+// Finally, we verify the contents of the blob against the format produced by
+// `bslx::ByteOutStream`:
+// ```
+// const char EXP[] = "\x00\x00\x00\x01\x00\x00\x00\x02""c\x05""hello";
+//
+// assert(0 == bsl::memcmp(blob.buffer(0).data(), EXP,     8));
+// assert(0 == bsl::memcmp(blob.buffer(1).data(), EXP + 8, 7));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslx_marshallingutil.h>
+#include <bslx_outstreamfunctions.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                            // ===================
+                            // class BlobOutStream
+                            // ===================
+
+/// This class provides output methods to externalize values, and C-style
+/// arrays of values, of the fundamental integral and floating-point types,
+/// as well as `bsl::string` values, directly into the buffers of a held
+/// `bdlbb::Blob`.  In particular, each `put` method of this class writes
+/// the same bytes as the corresponding method of `bslx::ByteOutStream`.
+/// See the `bslx` package-level documentation for the definition of the
+/// BDEX `OutStream` protocol.
+class BlobOutStream {
+
+    // DATA
+    Blob *d_blob_p;           // held blob (not owned)
+
+    char *d_begin_p;          // beginning of the current buffer, or 0 if
+                              // there is no current buffer
+
+    char *d_cursor_p;         // next byte to write in the current buffer
+
+    char *d_end_p;            // end of the current buffer
+
+    int   d_bufferIndex;      // index of the current buffer in the held
+                              // blob, or the number of buffers in the blob
+                              // if there is no current buffer
+
+    int   d_bufferOffset;     // offset, in the held blob, of the first byte
+                              // of the current buffer
+
+    int   d_versionSelector;  // 'versionSelector' to use with 'operator<<'
+                              // as per the 'bslx' package-level
+                              // documentation
+
+    int   d_validFlag;        // stream validity flag; 'true' if stream is
+                              // in valid state, 'false' otherwise
+
+    // NOT IMPLEMENTED
+    BlobOutStream(const BlobOutStream&);
+    BlobOutStream& operator=(const BlobOutStream&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Make the buffer of the held blob containing the byte at the current
+    /// length of the blob the current buffer, and position the cursor at
+    /// that byte.
+    void attach();
+
+    /// Make the next non-empty buffer of the held blob the current buffer,
+    /// appending a buffer obtained from the blob's factory if there is no
+    /// such buffer, and position the cursor at its beginning.  Return 0 on
+    /// success, and a non-zero value (with no effect) if a buffer is needed
+    /// but the held blob has no factory.
+    int nextBuffer();
+
+    /// Put this output stream into a valid state.  This function has no
+    /// effect if this stream is already valid.
+    void validate();
+
+    /// Write to this stream the specified `numBytes` from the specified
+    /// `data`, moving to subsequent buffers of the held blob as needed.  If
+    /// additional capacity is needed but cannot be obtained, invalidate
+    /// this stream without writing any of `data`.  The behavior is
+    /// undefined unless this stream is valid and `0 <= numBytes`.
+    void writeRaw(const char *data, int numBytes);
+
+  public:
+    // CREATORS
+
+    /// Create an output stream that appends to the data of the specified
+    /// `blob` and that will use the specified (*compile*-time-defined)
+    /// `versionSelector` as needed (see {Versioning}).  The behavior is
+    /// undefined unless `blob` remains valid until this stream is destroyed
+    /// or reset to hold another blob.  Note that the `versionSelector` is
+    /// expected to be formatted as "YYYYMMDD", a date representation.
+    BlobOutStream(Blob *blob, int versionSelector);
+
+    /// Update the length of the held blob to reflect the bytes written to
+    /// this stream (see `sync`), and destroy this object.  The behavior is
+    /// undefined unless the held blob has not been destroyed.
+    ~BlobOutStream();
+
+    // MANIPULATORS
+
+    /// Put this output stream in an invalid state.  This function has no
+    /// effect if this stream is already invalid.
+    void invalidate();
+
+    /// If the specified `length` is less than 128, write to this stream the
+    /// one-byte integer comprised of the least-significant one byte of the
+    /// `length`; otherwise, write to this stream the four-byte, two's
+    /// complement integer (in network byte order) comprised of the
+    /// least-significant four bytes of the `length` (in host byte order)
+    /// with the most-significant bit set.  Return a reference to this
+    /// stream.  If this stream is initially invalid, this operation has no
+    /// effect.  The behavior is undefined unless `0 <= length`.
+    BlobOutStream& putLength(int length);
+
+    /// Write to this stream the one-byte, two's complement unsigned integer
+    /// comprised of the least-significant one byte of the specified
+    /// `version`, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.
+    BlobOutStream& putVersion(int version);
+
+    /// Ensure that the held blob has capacity for at least the specified
+    /// `numBytes` beyond the bytes already written to this stream,
+    /// appending buffers obtained from the blob's factory as needed.
+    /// Return 0 on success, and a non-zero value if additional capacity is
+    /// needed but the held blob has no factory.  The behavior is undefined
+    /// unless `0 <= numBytes`.  Note that this method does not affect the
+    /// validity of this stream.
+    int reserveCapacity(int numBytes);
+
+    /// Update the length of the held blob to reflect the bytes written to
+    /// this stream, and make this stream append to the data of the
+    /// specified `blob`.  Validate this stream if it is currently invalid.
+    /// The behavior is undefined unless the held blob has not been
+    /// destroyed, and `blob` remains valid until this stream is destroyed or
+    /// reset to hold another blob.
+    void reset(Blob *blob);
+
+    /// Set the length of the held blob to reflect the bytes written to this
+    /// stream.  Note that the elements written by an array operation that
+    /// failed (see `invalidate`) are included.
+    void sync();
+
+                      // *** scalar integer values ***
+
+    /// Write to this stream the eight-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant eight bytes
+    /// of the specified `value` (in host byte order), and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.
+    BlobOutStream& putInt64(bsls::Types::Int64 value);
+
+    /// Write to this stream the eight-byte, two's complement unsigned
+    /// integer (in network byte order) comprised of the least-significant
+    /// eight bytes of the specified `value` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.
+    BlobOutStream& putUint64(bsls::Types::Uint64 value);
+
+    /// Write to this stream the seven-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant seven bytes
+    /// of the specified `value` (in host byte order), and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.
+    BlobOutStream& putInt56(bsls::Types::Int64 value);
+
+    /// Write to this stream the seven-byte, two's complement unsigned
+    /// integer (in network byte order) comprised of the least-significant
+    /// seven bytes of the specified `value` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.
+    BlobOutStream& putUint56(bsls::Types::Uint64 value);
+
+    /// Write to this stream the six-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant six bytes of
+    /// the specified `value` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.
+    BlobOutStream& putInt48(bsls::Types::Int64 value);
+
+    /// Write to this stream the six-byte, two's complement unsigned integer
+    /// (in network byte order) comprised of the least-significant six bytes
+    /// of the specified `value` (in host byte order), and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.
+    BlobOutStream& putUint48(bsls::Types::Uint64 value);
+
+    /// Write to this stream the five-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant five bytes of
+    /// the specified `value` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.
+    BlobOutStream& putInt40(bsls::Types::Int64 value);
+
+    /// Write to this stream the five-byte, two's complement unsigned
+    /// integer (in network byte order) comprised of the least-significant
+    /// five bytes of the specified `value` (in host byte order), and return
+    /// a reference to this stream.  If this stream is initially invalid,
+    /// this operation has no effect.
+    BlobOutStream& putUint40(bsls::Types::Uint64 value);
+
+    /// Write to this stream the four-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant four bytes of
+    /// the specified `value` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.
+    BlobOutStream& putInt32(int value);
+
+    /// Write to this stream the four-byte, two's complement unsigned
+    /// integer (in network byte order) comprised of the least-significant
+    /// four bytes of the specified `value` (in host byte order), and return
+    /// a reference to this stream.  If this stream is initially invalid,
+    /// this operation has no effect.
+    BlobOutStream& putUint32(unsigned int value);
+
+    /// Write to this stream the three-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant three bytes
+    /// of the specified `value` (in host byte order), and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.
+    BlobOutStream& putInt24(int value);
+
+    /// Write to this stream the three-byte, two's complement unsigned
+    /// integer (in network byte order) comprised of the least-significant
+    /// three bytes of the specified `value` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.
+    BlobOutStream& putUint24(unsigned int value);
+
+    /// Write to this stream the two-byte, two's complement integer (in
+    /// network byte order) comprised of the least-significant two bytes of
+    /// the specified `value` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.
+    BlobOutStream& putInt16(int value);
+
+    /// Write to this stream the two-byte, two's complement unsigned integer
+    /// (in network byte order) comprised of the least-significant two bytes
+    /// of the specified `value` (in host byte order), and return a
+    /// reference to this stream.  If this stream is initially invalid, this
+    /// operation has no effect.
+    BlobOutStream& putUint16(unsigned int value);
+
+    /// Write to this stream the one-byte, two's complement integer
+    /// comprised of the least-significant one byte of the specified
+    /// `value`, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.
+    BlobOutStream& putInt8(int value);
+
+    /// Write to this stream the one-byte, two's complement unsigned integer
+    /// comprised of the least-significant one byte of the specified
+    /// `value`, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.
+    BlobOutStream& putUint8(unsigned int value);
+
+                      // *** scalar floating-point values ***
+
+    /// Write to this stream the eight-byte IEEE double-precision
+    /// floating-point number (in network byte order) comprised of the
+    /// most-significant eight bytes of the specified `value` (in host byte
+    /// order), and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  Note that for
+    /// non-conforming platforms, this operation may be lossy.
+    BlobOutStream& putFloat64(double value);
+
+    /// Write to this stream the four-byte IEEE single-precision
+    /// floating-point number (in network byte order) comprised of the
+    /// most-significant four bytes of the specified `value` (in host byte
+    /// order), and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  Note that for
+    /// non-conforming platforms, this operation may be lossy.
+    BlobOutStream& putFloat32(float value);
+
+                      // *** string values ***
+
+    /// Write to this stream the length of the specified `value` (see
+    /// `putLength`) and an array of one-byte, two's complement unsigned
+    /// integers comprised of the least-significant one byte of each
+    /// character in the `value`, and return a reference to this stream.  If
+    /// this stream is initially invalid, this operation has no effect.
+    BlobOutStream& putString(const bsl::string& value);
+
+                      // *** arrays of integer values ***
+
+    /// Write to this stream the consecutive eight-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// eight bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt64(const bsls::Types::Int64 *values,
+                                 int                       numValues);
+
+    /// Write to this stream the consecutive eight-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant eight bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint64(const bsls::Types::Uint64 *values,
+                                  int                        numValues);
+
+    /// Write to this stream the consecutive seven-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// seven bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt56(const bsls::Types::Int64 *values,
+                                 int                       numValues);
+
+    /// Write to this stream the consecutive seven-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant seven bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint56(const bsls::Types::Uint64 *values,
+                                  int                        numValues);
+
+    /// Write to this stream the consecutive six-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// six bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt48(const bsls::Types::Int64 *values,
+                                 int                       numValues);
+
+    /// Write to this stream the consecutive six-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant six bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint48(const bsls::Types::Uint64 *values,
+                                  int                        numValues);
+
+    /// Write to this stream the consecutive five-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// five bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt40(const bsls::Types::Int64 *values,
+                                 int                       numValues);
+
+    /// Write to this stream the consecutive five-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant five bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint40(const bsls::Types::Uint64 *values,
+                                  int                        numValues);
+
+    /// Write to this stream the consecutive four-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// four bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt32(const int *values, int numValues);
+
+    /// Write to this stream the consecutive four-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant four bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint32(const unsigned int *values, int numValues);
+
+    /// Write to this stream the consecutive three-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// three bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt24(const int *values, int numValues);
+
+    /// Write to this stream the consecutive three-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant three bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint24(const unsigned int *values, int numValues);
+
+    /// Write to this stream the consecutive two-byte, two's complement
+    /// integers (in network byte order) comprised of the least-significant
+    /// two bytes of each of the specified `numValues` leading entries in
+    /// the specified `values` (in host byte order), and return a reference
+    /// to this stream.  If this stream is initially invalid, this operation
+    /// has no effect.  The behavior is undefined unless `0 <= numValues`
+    /// and `values` has sufficient contents.
+    BlobOutStream& putArrayInt16(const short *values, int numValues);
+
+    /// Write to this stream the consecutive two-byte, two's complement
+    /// unsigned integers (in network byte order) comprised of the
+    /// least-significant two bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayUint16(const unsigned short *values, int numValues);
+
+    /// Write to this stream the consecutive one-byte, two's complement
+    /// integers comprised of the least-significant one byte of each of the
+    /// specified `numValues` leading entries in the specified `values`, and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.
+    BlobOutStream& putArrayInt8(const char        *values, int numValues);
+    BlobOutStream& putArrayInt8(const signed char *values, int numValues);
+
+    /// Write to this stream the consecutive one-byte, two's complement
+    /// unsigned integers comprised of the least-significant one byte of
+    /// each of the specified `numValues` leading entries in the specified
+    /// `values`, and return a reference to this stream.  If this stream is
+    /// initially invalid, this operation has no effect.  The behavior is
+    /// undefined unless `0 <= numValues` and `values` has sufficient
+    /// contents.
+    BlobOutStream& putArrayUint8(const char          *values, int numValues);
+    BlobOutStream& putArrayUint8(const unsigned char *values, int numValues);
+
+                      // *** arrays of floating-point values ***
+
+    /// Write to this stream the consecutive eight-byte IEEE
+    /// double-precision floating-point numbers (in network byte order)
+    /// comprised of the most-significant eight bytes of each of the
+    /// specified `numValues` leading entries in the specified `values` (in
+    /// host byte order), and return a reference to this stream.  If this
+    /// stream is initially invalid, this operation has no effect.  The
+    /// behavior is undefined unless `0 <= numValues` and `values` has
+    /// sufficient contents.  Note that for non-conforming platforms, this
+    /// operation may be lossy.
+    BlobOutStream& putArrayFloat64(const double *values, int numValues);
+
+    /// Write to this stream the consecutive four-byte IEEE single-precision
+    /// floating-point numbers (in network byte order) comprised of the
+    /// most-significant four bytes of each of the specified `numValues`
+    /// leading entries in the specified `values` (in host byte order), and
+    /// return a reference to this stream.  If this stream is initially
+    /// invalid, this operation has no effect.  The behavior is undefined
+    /// unless `0 <= numValues` and `values` has sufficient contents.  Note
+    /// that for non-conforming platforms, this operation may be lossy.
+    BlobOutStream& putArrayFloat32(const float *values, int numValues);
+
+    // ACCESSORS
+
+    /// Return a non-zero value if this stream is valid, and 0 otherwise.
+    /// An invalid stream is a stream for which an output operation was
+    /// detected to have failed or `invalidate` was called.
+    operator const void *() const;
+
+    /// Return the `versionSelector` to be used with `operator<<` for BDEX
+    /// streaming as per the `bslx` package-level documentation.
+    int bdexVersionSelector() const;
+
+    /// Return the address of the blob held by this stream.  Note that the
+    /// length of the blob is not up to date unless this stream has been
+    /// synchronized (see `sync`) since it was last written to.
+    Blob *blob() const;
+
+    /// Return `true` if this stream is valid, and `false` otherwise.  An
+    /// invalid stream is a stream for which an output operation was
+    /// detected to have failed or `invalidate` was called.
+    bool isValid() const;
+
+    /// Return the length of the data of the held blob, including the bytes
+    /// written to this stream that are not yet reflected by the length of
+    /// the blob (see `sync`).
+    int length() const;
+};
+
+// FREE OPERATORS
+
+/// Write the specified `value` to the specified output `stream` following
+/// the requirements of the BDEX protocol (see the `bslx` package-level
+/// documentation), and return a reference to `stream`.  The behavior is
+/// undefined unless `TYPE` is BDEX-compliant.
+template <class TYPE>
+BlobOutStream& operator<<(BlobOutStream& stream, const TYPE& value);
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class BlobOutStream
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+inline
+void BlobOutStream::validate()
+{
+    d_validFlag = true;
+}
+
+// CREATORS
+inline
+BlobOutStream::BlobOutStream(Blob *blob, int versionSelector)
+: d_blob_p(blob)
+, d_begin_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_bufferIndex(0)
+, d_bufferOffset(0)
+, d_versionSelector(versionSelector)
+, d_validFlag(true)
+{
+    BSLS_ASSERT(blob);
+
+    attach();
+}
+
+inline
+BlobOutStream::~BlobOutStream()
+{
+    sync();
+}
+
+// MANIPULATORS
+inline
+void BlobOutStream::invalidate()
+{
+    d_validFlag = false;
+}
+
+inline
+BlobOutStream& BlobOutStream::putLength(int length)
+{
+    BSLS_ASSERT_SAFE(0 <= length);
+
+    if (length > 127) {
+        putInt32(length | (1 << 31));
+    } else {
+        putInt8(length);
+    }
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putVersion(int version)
+{
+    return putUint8(version);
+}
+
+inline
+void BlobOutStream::sync()
+{
+    d_blob_p->setLength(length());
+}
+
+                      // *** scalar integer values ***
+
+inline
+BlobOutStream& BlobOutStream::putInt64(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT64;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt64(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt64(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint64(bsls::Types::Uint64 value)
+{
+    return putInt64(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt56(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT56;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt56(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt56(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint56(bsls::Types::Uint64 value)
+{
+    return putInt56(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt48(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT48;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt48(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt48(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint48(bsls::Types::Uint64 value)
+{
+    return putInt48(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt40(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT40;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt40(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt40(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint40(bsls::Types::Uint64 value)
+{
+    return putInt40(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt32(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT32;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt32(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt32(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint32(unsigned int value)
+{
+    return putInt32(static_cast<int>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt24(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT24;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt24(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt24(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint24(unsigned int value)
+{
+    return putInt24(static_cast<int>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt16(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_INT16;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putInt16(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putInt16(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint16(unsigned int value)
+{
+    return putInt16(static_cast<int>(value));
+}
+
+inline
+BlobOutStream& BlobOutStream::putInt8(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_cursor_p != d_end_p)) {
+        bslx::MarshallingUtil::putInt8(d_cursor_p, value);
+        ++d_cursor_p;
+    }
+    else {
+        char scratch;
+        bslx::MarshallingUtil::putInt8(&scratch, value);
+        writeRaw(&scratch, 1);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putUint8(unsigned int value)
+{
+    return putInt8(static_cast<int>(value));
+}
+
+                      // *** scalar floating-point values ***
+
+inline
+BlobOutStream& BlobOutStream::putFloat64(double value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT64;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putFloat64(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putFloat64(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putFloat32(float value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int size = bslx::MarshallingUtil::k_SIZEOF_FLOAT32;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= size)) {
+        bslx::MarshallingUtil::putFloat32(d_cursor_p, value);
+        d_cursor_p += size;
+    }
+    else {
+        char scratch[size];
+        bslx::MarshallingUtil::putFloat32(scratch, value);
+        writeRaw(scratch, size);
+    }
+
+    return *this;
+}
+
+                      // *** string values ***
+
+inline
+BlobOutStream& BlobOutStream::putString(const bsl::string& value)
+{
+    const int length = static_cast<int>(value.length());
+    putLength(length);
+    return putArrayUint8(value.data(), length);
+}
+
+                      // *** arrays of integer values ***
+
+inline
+BlobOutStream& BlobOutStream::putArrayInt8(const char *values, int numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >=
+                                                                 numValues)) {
+        if (numValues) {
+            bsl::memcpy(d_cursor_p, values, numValues);
+            d_cursor_p += numValues;
+        }
+    }
+    else {
+        writeRaw(values, numValues);
+    }
+
+    return *this;
+}
+
+inline
+BlobOutStream& BlobOutStream::putArrayInt8(const signed char *values,
+                                           int                numValues)
+{
+    return putArrayInt8(reinterpret_cast<const char *>(values), numValues);
+}
+
+inline
+BlobOutStream& BlobOutStream::putArrayUint8(const char *values, int numValues)
+{
+    return putArrayInt8(values, numValues);
+}
+
+inline
+BlobOutStream& BlobOutStream::putArrayUint8(const unsigned char *values,
+                                            int                  numValues)
+{
+    return putArrayInt8(reinterpret_cast<const char *>(values), numValues);
+}
+
+// ACCESSORS
+inline
+BlobOutStream::operator const void *() const
+{
+    return isValid() ? this : 0;
+}
+
+inline
+int BlobOutStream::bdexVersionSelector() const
+{
+    return d_versionSelector;
+}
+
+inline
+Blob *BlobOutStream::blob() const
+{
+    return d_blob_p;
+}
+
+inline
+bool BlobOutStream::isValid() const
+{
+    return d_validFlag;
+}
+
+inline
+int BlobOutStream::length() const
+{
+    return d_bufferOffset + static_cast<int>(d_cursor_p - d_begin_p);
+}
+
+template <class TYPE>
+inline
+BlobOutStream& operator<<(BlobOutStream& stream, const TYPE& value)
+{
+    return bslx::OutStreamFunctions::bdexStreamOut(stream, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
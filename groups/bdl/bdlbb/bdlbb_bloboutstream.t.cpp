@@ -0,0 +1,1082 @@
+// bdlbb_bloboutstream.t.cpp                                          -*-C++-*-
+#include <bdlbb_bloboutstream.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>      // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslx_byteoutstream.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a BDEX output stream writing into the buffers
+// of a `bdlbb::Blob`.  The reference for every byte written is
+// `bslx::ByteOutStream`: each test writes the same sequence of values to a
+// `bdlbb::BlobOutStream` and to a `bslx::ByteOutStream`, and compares the data
+// of the blob with the contents of the byte stream.  The sequences are
+// written for a variety of buffer sizes (including sizes smaller than the
+// values written, so that values straddle buffers) and initial blob contents.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 4] BlobOutStream(Blob *blob, int versionSelector);
+// [ 4] ~BlobOutStream();
+//
+// MANIPULATORS
+// [ 5] void invalidate();
+// [ 3] BlobOutStream& putLength(int length);
+// [ 3] BlobOutStream& putVersion(int version);
+// [ 4] int reserveCapacity(int numBytes);
+// [ 4] void reset(Blob *blob);
+// [ 4] void sync();
+// [ 2] BlobOutStream& putInt64(bsls::Types::Int64 value);
+// [ 2] BlobOutStream& putUint64(bsls::Types::Uint64 value);
+// [ 2] BlobOutStream& putInt56(bsls::Types::Int64 value);
+// [ 2] BlobOutStream& putUint56(bsls::Types::Uint64 value);
+// [ 2] BlobOutStream& putInt48(bsls::Types::Int64 value);
+// [ 2] BlobOutStream& putUint48(bsls::Types::Uint64 value);
+// [ 2] BlobOutStream& putInt40(bsls::Types::Int64 value);
+// [ 2] BlobOutStream& putUint40(bsls::Types::Uint64 value);
+// [ 2] BlobOutStream& putInt32(int value);
+// [ 2] BlobOutStream& putUint32(unsigned int value);
+// [ 2] BlobOutStream& putInt24(int value);
+// [ 2] BlobOutStream& putUint24(unsigned int value);
+// [ 2] BlobOutStream& putInt16(int value);
+// [ 2] BlobOutStream& putUint16(unsigned int value);
+// [ 2] BlobOutStream& putInt8(int value);
+// [ 2] BlobOutStream& putUint8(unsigned int value);
+// [ 2] BlobOutStream& putFloat64(double value);
+// [ 2] BlobOutStream& putFloat32(float value);
+// [ 3] BlobOutStream& putString(const bsl::string& value);
+// [ 3] BlobOutStream& putArrayInt64(const bsls::Types::Int64 *, int);
+// [ 3] BlobOutStream& putArrayUint64(const bsls::Types::Uint64 *, int);
+// [ 3] BlobOutStream& putArrayInt56(const bsls::Types::Int64 *, int);
+// [ 3] BlobOutStream& putArrayUint56(const bsls::Types::Uint64 *, int);
+// [ 3] BlobOutStream& putArrayInt48(const bsls::Types::Int64 *, int);
+// [ 3] BlobOutStream& putArrayUint48(const bsls::Types::Uint64 *, int);
+// [ 3] BlobOutStream& putArrayInt40(const bsls::Types::Int64 *, int);
+// [ 3] BlobOutStream& putArrayUint40(const bsls::Types::Uint64 *, int);
+// [ 3] BlobOutStream& putArrayInt32(const int *values, int numValues);
+// [ 3] BlobOutStream& putArrayUint32(const unsigned int *, int);
+// [ 3] BlobOutStream& putArrayInt24(const int *values, int numValues);
+// [ 3] BlobOutStream& putArrayUint24(const unsigned int *, int);
+// [ 3] BlobOutStream& putArrayInt16(const short *values, int numValues);
+// [ 3] BlobOutStream& putArrayUint16(const unsigned short *, int);
+// [ 3] BlobOutStream& putArrayInt8(const char *values, int numValues);
+// [ 3] BlobOutStream& putArrayInt8(const signed char *, int);
+// [ 3] BlobOutStream& putArrayUint8(const char *values, int numValues);
+// [ 3] BlobOutStream& putArrayUint8(const unsigned char *, int);
+// [ 3] BlobOutStream& putArrayFloat64(const double *values, int);
+// [ 3] BlobOutStream& putArrayFloat32(const float *values, int);
+//
+// ACCESSORS
+// [ 5] operator const void *() const;
+// [ 5] int bdexVersionSelector() const;
+// [ 4] Blob *blob() const;
+// [ 5] bool isValid() const;
+// [ 4] int length() const;
+//
+// FREE OPERATORS
+// [ 5] BlobOutStream& operator<<(BlobOutStream&, const TYPE& value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobOutStream Obj;
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+
+const int VERSION_SELECTOR = 20260101;
+
+/// Buffer sizes with which blobs are created by the table-driven tests;
+/// every value written by the tests straddles two buffers for some of
+/// these sizes.
+const int BUFFER_SIZES[]  = { 1, 2, 3, 5, 7, 8, 13, 64, 1024 };
+const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the data of the specified `blob` as a string.
+bsl::string toString(const bdlbb::Blob& blob)
+{
+    bsl::string result;
+    int         remaining = blob.length();
+
+    for (int i = 0; 0 < remaining; ++i) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(i);
+        const int                n      = remaining < buffer.size()
+                                          ? remaining
+                                          : buffer.size();
+
+        result.append(buffer.data(), n);
+        remaining -= n;
+    }
+    return result;
+}
+
+/// Return the contents of the specified `stream` as a string.
+bsl::string toString(const bslx::ByteOutStream& stream)
+{
+    return bsl::string(stream.data(), stream.length());
+}
+
+/// Write to the specified `stream` one value of each scalar type, derived
+/// from the specified `seed`.
+template <class STREAM>
+void putScalars(STREAM& stream, int seed)
+{
+    const Int64 v = 0x0123456789abcdefLL * (seed + 1);
+
+    stream.putInt64(v);
+    stream.putUint64(static_cast<Uint64>(~v));
+    stream.putInt56(v >> 3);
+    stream.putUint56(static_cast<Uint64>(v) >> 5);
+    stream.putInt48(-v);
+    stream.putUint48(static_cast<Uint64>(v) >> 7);
+    stream.putInt40(v >> 11);
+    stream.putUint40(static_cast<Uint64>(v) >> 13);
+    stream.putInt32(static_cast<int>(v));
+    stream.putUint32(static_cast<unsigned int>(v >> 17));
+    stream.putInt24(static_cast<int>(v >> 19));
+    stream.putUint24(static_cast<unsigned int>(v >> 23));
+    stream.putInt16(static_cast<int>(v >> 29));
+    stream.putUint16(static_cast<unsigned int>(v >> 31));
+    stream.putInt8(static_cast<int>(v >> 37));
+    stream.putUint8(static_cast<unsigned int>(v >> 41));
+    stream.putFloat64(static_cast<double>(v) / 3.0);
+    stream.putFloat32(static_cast<float>(seed) * 1.5f);
+    stream.putLength(seed);
+    stream.putLength(seed + 1000);
+    stream.putVersion(seed);
+}
+
+/// Write to the specified `stream` one array of each type, each having the
+/// specified `numValues` elements, and strings of `numValues` and
+/// `numValues + 200` characters.
+template <class STREAM>
+void putArrays(STREAM& stream, int numValues)
+{
+    bsl::vector<Int64>          i64(numValues + 1);
+    bsl::vector<Uint64>         u64(numValues + 1);
+    bsl::vector<int>            i32(numValues + 1);
+    bsl::vector<unsigned int>   u32(numValues + 1);
+    bsl::vector<short>          i16(numValues + 1);
+    bsl::vector<unsigned short> u16(numValues + 1);
+    bsl::vector<char>           c8(numValues + 1);
+    bsl::vector<signed char>    i8(numValues + 1);
+    bsl::vector<unsigned char>  u8(numValues + 1);
+    bsl::vector<double>         f64(numValues + 1);
+    bsl::vector<float>          f32(numValues + 1);
+
+    for (int i = 0; i < numValues; ++i) {
+        const Int64 v = 0x1122334455667788LL * (i + 3) - i;
+
+        i64[i] = v;
+        u64[i] = static_cast<Uint64>(~v);
+        i32[i] = static_cast<int>(v >> 9);
+        u32[i] = static_cast<unsigned int>(v);
+        i16[i] = static_cast<short>(v >> 21);
+        u16[i] = static_cast<unsigned short>(v);
+        c8[i]  = static_cast<char>(v >> 3);
+        i8[i]  = static_cast<signed char>(v >> 5);
+        u8[i]  = static_cast<unsigned char>(v);
+        f64[i] = static_cast<double>(v) / 7.0;
+        f32[i] = static_cast<float>(i) / 4.0f;
+    }
+
+    stream.putArrayInt64(i64.data(), numValues);
+    stream.putArrayUint64(u64.data(), numValues);
+    stream.putArrayInt56(i64.data(), numValues);
+    stream.putArrayUint56(u64.data(), numValues);
+    stream.putArrayInt48(i64.data(), numValues);
+    stream.putArrayUint48(u64.data(), numValues);
+    stream.putArrayInt40(i64.data(), numValues);
+    stream.putArrayUint40(u64.data(), numValues);
+    stream.putArrayInt32(i32.data(), numValues);
+    stream.putArrayUint32(u32.data(), numValues);
+    stream.putArrayInt24(i32.data(), numValues);
+    stream.putArrayUint24(u32.data(), numValues);
+    stream.putArrayInt16(i16.data(), numValues);
+    stream.putArrayUint16(u16.data(), numValues);
+    stream.putArrayInt8(c8.data(), numValues);
+    stream.putArrayInt8(i8.data(), numValues);
+    stream.putArrayUint8(c8.data(), numValues);
+    stream.putArrayUint8(u8.data(), numValues);
+    stream.putArrayFloat64(f64.data(), numValues);
+    stream.putArrayFloat32(f32.data(), numValues);
+
+    stream.putString(bsl::string(numValues, 'a'));
+    stream.putString(bsl::string(numValues + 200, 'b'));
+}
+
+                           // =====================
+                           // class CountingFactory
+                           // =====================
+
+/// This class implements the `bdlbb::BlobBufferFactory` protocol, supplying
+/// buffers of a fixed size and counting the buffers it supplies.
+class CountingFactory : public bdlbb::BlobBufferFactory {
+
+    // DATA
+    bdlbb::SimpleBlobBufferFactory d_factory;
+    int                            d_numAllocations;
+
+  public:
+    // CREATORS
+    explicit CountingFactory(int               bufferSize,
+                             bslma::Allocator *basicAllocator = 0)
+    : d_factory(bufferSize, basicAllocator)
+    , d_numAllocations(0)
+    {
+    }
+
+    // MANIPULATORS
+    void allocate(bdlbb::BlobBuffer *buffer) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numAllocations;
+        d_factory.allocate(buffer);
+    }
+
+    // ACCESSORS
+    int numAllocations() const
+    {
+        return d_numAllocations;
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Externalizing Into a Blob
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we need to externalize a sequence of values to a `bdlbb::Blob` that
+// will be handed to a blob-based transport.  Rather than writing the values
+// to a `bslx::ByteOutStream` and copying its contents into the blob, we write
+// them directly into the blob's buffers.
+//
+// First, we create a blob supplied by a factory of deliberately small buffers,
+// so that the values written below span several buffers:
+// ```
+    bdlbb::SimpleBlobBufferFactory factory(8);
+    bdlbb::Blob                    blob(&factory);
+// ```
+// Then, we create a `bdlbb::BlobOutStream` with an arbitrary value for its
+// `versionSelector` and externalize some values:
+// ```
+    {
+        bdlbb::BlobOutStream outStream(&blob, 20260101);
+        outStream.putInt32(1);
+        outStream.putInt32(2);
+        outStream.putInt8('c');
+        outStream.putString(bsl::string("hello"));
+        ASSERT(outStream);
+        ASSERT(15 == outStream.length());
+    }
+// ```
+// Now, the stream having been destroyed, the length of the blob reflects the
+// bytes that were written, and those bytes span two buffers:
+// ```
+    ASSERT(15 == blob.length());
+    ASSERT( 2 == blob.numDataBuffers());
+// ```
+// Finally, we verify the contents of the blob against the format produced by
+// `bslx::ByteOutStream`:
+// ```
+    const char EXP[] = "\x00\x00\x00\x01\x00\x00\x00\x02""c\x05""hello";
+
+    ASSERT(0 == bsl::memcmp(blob.buffer(0).data(), EXP,     8));
+    ASSERT(0 == bsl::memcmp(blob.buffer(1).data(), EXP + 8, 7));
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALIDITY, BDEX STREAMING, AND NEGATIVE TESTS
+        //
+        // Concerns:
+        // 1. A stream whose blob has no factory is invalidated when it runs
+        //    out of capacity, and writes to an invalid stream have no effect.
+        //
+        // 2. `invalidate` invalidates the stream, and `reset` validates it.
+        //
+        // 3. `operator<<` externalizes BDEX-compliant types using the
+        //    `versionSelector` supplied at construction, producing the bytes
+        //    produced by `bslx::ByteOutStream`.
+        //
+        // 4. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create a blob having a single buffer and no factory, and write
+        //    past its capacity; verify the stream is invalidated, that no
+        //    part of the value that did not fit is written, that the stream
+        //    length no longer advances, and that the blob is not grown.
+        //    (C-1)
+        //
+        // 2. Invalidate a stream explicitly; verify writes are ignored, and
+        //    that `reset` validates the stream.  (C-2)
+        //
+        // 3. Stream a `bsl::vector<int>` and a `bsl::string` with
+        //    `operator<<`, and compare with `bslx::ByteOutStream`.  (C-3)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void invalidate();
+        //   operator const void *() const;
+        //   int bdexVersionSelector() const;
+        //   bool isValid() const;
+        //   BlobOutStream& operator<<(BlobOutStream&, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALIDITY, BDEX STREAMING, AND NEGATIVE TESTS"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\tBlob without a factory." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(6, &ta);
+
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+
+            bdlbb::Blob blob(&buffer, 1, 0, &ta);
+            ASSERT(0 == blob.length());
+            ASSERT(6 == blob.totalSize());
+
+            Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+            mX.putInt32(1);
+            ASSERT(X.isValid());
+            ASSERT(4 == X.length());
+
+            ASSERT(0 != mX.reserveCapacity(3));
+            ASSERT(X.isValid());
+
+            bsl::memset(blob.buffer(0).data() + 4, 'z', 2);
+
+            mX.putInt32(2);
+            ASSERT(!X.isValid());
+            ASSERT(!X);
+            ASSERT(4 == X.length());
+            ASSERT('z' == blob.buffer(0).data()[4]);
+            ASSERT('z' == blob.buffer(0).data()[5]);
+
+            mX.putInt8(3);
+            mX.putString("abc");
+            ASSERT(!X.isValid());
+            ASSERT(4 == X.length());
+
+            mX.sync();
+            ASSERT(4 == blob.length());
+            ASSERT(6 == blob.totalSize());
+            ASSERT(1 == blob.numBuffers());
+        }
+
+        if (verbose) cout << "\tExplicit invalidation." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            bdlbb::Blob                    other(&factory, &ta);
+                // Note that `other` must outlive `mX`, which syncs it on
+                // destruction.
+
+            Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+            ASSERT(X);
+            ASSERT(VERSION_SELECTOR == X.bdexVersionSelector());
+
+            mX.invalidate();
+            ASSERT(!X.isValid());
+            ASSERT(!X);
+
+            mX.putInt64(1);
+            mX.putArrayInt8("abcdefgh", 8);
+            ASSERT(0 == X.length());
+
+            mX.reset(&other);
+            ASSERT(X.isValid());
+            ASSERT(&other == X.blob());
+
+            mX.putInt8(7);
+            ASSERT(1 == X.length());
+        }
+
+        if (verbose) cout << "\tBDEX streaming." << endl;
+        {
+            bsl::vector<int> vector(&ta);
+            for (int i = 0; i < 100; ++i) {
+                vector.push_back(i * 1000);
+            }
+            const bsl::string string(300, 'x', &ta);
+
+            bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+            expected << vector << string;
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int SIZE = BUFFER_SIZES[ti];
+
+                bdlbb::SimpleBlobBufferFactory factory(SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                {
+                    Obj mX(&blob, VERSION_SELECTOR);
+
+                    mX << vector << string;
+                    ASSERTV(SIZE, mX.isValid());
+                }
+                ASSERTV(SIZE, toString(expected) == toString(blob));
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            Obj mX(&blob, VERSION_SELECTOR);
+
+            ASSERT_SAFE_PASS(mX.putLength( 0));
+            ASSERT_SAFE_FAIL(mX.putLength(-1));
+
+            const int values[] = { 1, 2 };
+
+            ASSERT_PASS(mX.putArrayInt32(values,  2));
+            ASSERT_PASS(mX.putArrayInt32(0,       0));
+            ASSERT_FAIL(mX.putArrayInt32(0,       1));
+            ASSERT_FAIL(mX.putArrayInt32(values, -1));
+
+            ASSERT_SAFE_PASS(mX.putArrayInt8("a",  1));
+            ASSERT_SAFE_FAIL(mX.putArrayInt8(static_cast<char *>(0), 1));
+            ASSERT_SAFE_FAIL(mX.putArrayInt8("a", -1));
+
+            ASSERT_PASS(mX.reserveCapacity( 0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+
+            ASSERT_FAIL(mX.reset(0));
+            ASSERT_FAIL(Obj(0, VERSION_SELECTOR));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // APPENDING, SYNC, RESERVE, AND RESET
+        //
+        // Concerns:
+        // 1. A stream appends to the existing data of the blob, whether the
+        //    data ends within a buffer, at the end of a buffer, or is
+        //    followed by capacity buffers.
+        //
+        // 2. The length of the blob is updated by `sync`, `reset`, and the
+        //    destructor, and not by the `put` methods; `length` always
+        //    reports the length including the bytes written.
+        //
+        // 3. After a successful `reserveCapacity(n)`, writing `n` bytes
+        //    allocates no buffer, including when the stream was positioned
+        //    past the end of the blob.
+        //
+        // 4. No memory is leaked.
+        //
+        // Plan:
+        // 1. For each buffer size, and for a set of initial blob lengths and
+        //    numbers of capacity buffers, write a sequence of values and
+        //    verify the resulting data against the initial data followed by
+        //    the bytes written to a `bslx::ByteOutStream`.  (C-1..2)
+        //
+        // 2. Reserve capacity and write exactly that many bytes, counting the
+        //    buffers supplied by the factory.  (C-3)
+        //
+        // 3. Use a test allocator throughout.  (C-4)
+        //
+        // Testing:
+        //   BlobOutStream(Blob *blob, int versionSelector);
+        //   ~BlobOutStream();
+        //   int reserveCapacity(int numBytes);
+        //   void reset(Blob *blob);
+        //   void sync();
+        //   Blob *blob() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "APPENDING, SYNC, RESERVE, AND RESET" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bslx::ByteOutStream expected(VERSION_SELECTOR);
+        putScalars(expected, 3);
+        const bsl::string EXPECTED = toString(expected);
+
+        if (verbose) cout << "\tAppending to existing data." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int SIZE = BUFFER_SIZES[ti];
+
+            for (int initial = 0; initial <= 2 * SIZE + 1; ++initial) {
+                for (int capacity = 0; capacity <= 2; ++capacity) {
+                    CountingFactory factory(SIZE, &ta);
+                    bdlbb::Blob     blob(&factory, &ta);
+
+                    // Create the initial data, followed by the capacity
+                    // buffers, of the blob.
+
+                    blob.setLength(initial + capacity * SIZE);
+                    blob.setLength(initial);
+
+                    bsl::string prefix;
+                    for (int i = 0, index = 0; i < initial; ++index) {
+                        const bdlbb::BlobBuffer& buffer = blob.buffer(index);
+
+                        for (int j = 0; j < buffer.size() && i < initial;
+                                                                  ++j, ++i) {
+                            buffer.data()[j] = static_cast<char>('A' + i % 26);
+                            prefix.push_back(buffer.data()[j]);
+                        }
+                    }
+
+                    const int numBuffers = blob.numBuffers();
+
+                    Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+                    ASSERT(&blob   == X.blob());
+                    ASSERT(initial == X.length());
+
+                    putScalars(mX, 3);
+
+                    ASSERTV(SIZE, initial, capacity, X.isValid());
+                    ASSERTV(SIZE, initial, capacity,
+                            initial == blob.length());
+                    ASSERTV(SIZE, initial, capacity,
+                            initial + static_cast<int>(EXPECTED.size()) ==
+                                                                  X.length());
+
+                    mX.sync();
+
+                    ASSERTV(SIZE, initial, capacity,
+                            X.length() == blob.length());
+                    ASSERTV(SIZE, initial, capacity,
+                            prefix + EXPECTED == toString(blob));
+
+                    // Capacity buffers were used before allocating.
+
+                    const int used = (X.length() + SIZE - 1) / SIZE;
+                    ASSERTV(SIZE, initial, capacity,
+                            bsl::max(used, numBuffers) == blob.numBuffers());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tSync by destructor and reset." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(5, &ta);
+            bdlbb::Blob                    blob1(&factory, &ta);
+            bdlbb::Blob                    blob2(&factory, &ta);
+
+            {
+                Obj mX(&blob1, VERSION_SELECTOR);
+                mX.putInt64(1);
+                mX.putInt32(2);
+                ASSERT( 0 == blob1.length());
+
+                mX.reset(&blob2);
+                ASSERT(12 == blob1.length());
+                ASSERT( 0 == mX.length());
+
+                mX.putInt16(3);
+                ASSERT( 0 == blob2.length());
+            }
+            ASSERT(2 == blob2.length());
+
+            bslx::ByteOutStream exp(VERSION_SELECTOR, &ta);
+            exp.putInt64(1);
+            exp.putInt32(2);
+            ASSERT(toString(exp) == toString(blob1));
+        }
+
+        if (verbose) cout << "\tReserving capacity." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int SIZE = BUFFER_SIZES[ti];
+
+            for (int initial = 0; initial <= 2 * SIZE; ++initial) {
+                CountingFactory factory(SIZE, &ta);
+                bdlbb::Blob     blob(&factory, &ta);
+
+                blob.setLength(initial);
+
+                Obj mX(&blob, VERSION_SELECTOR);
+
+                ASSERTV(SIZE, initial, 0 == mX.reserveCapacity(100));
+
+                const int numAllocations = factory.numAllocations();
+
+                for (int i = 0; i < 25; ++i) {
+                    mX.putInt32(i);
+                }
+                ASSERTV(SIZE, initial, mX.isValid());
+                ASSERTV(SIZE, initial,
+                        numAllocations == factory.numAllocations());
+
+                mX.putInt8(0);
+                ASSERTV(SIZE, initial, mX.isValid());
+
+                mX.sync();
+                ASSERTV(SIZE, initial, initial + 101 == blob.length());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ARRAY, STRING, LENGTH, AND VERSION PUT METHODS
+        //
+        // Concerns:
+        // 1. Each array method writes the bytes written by the corresponding
+        //    method of `bslx::ByteOutStream`, for arrays that fit in the
+        //    current buffer, that straddle buffers, and that span many
+        //    buffers.
+        //
+        // 2. `putString`, `putLength`, and `putVersion` write the bytes
+        //    written by `bslx::ByteOutStream`, including lengths that need the
+        //    four-byte representation.
+        //
+        // Plan:
+        // 1. For each buffer size and a set of array lengths, write arrays of
+        //    each type and strings to a `bdlbb::BlobOutStream` and to a
+        //    `bslx::ByteOutStream`, and compare.  (C-1..2)
+        //
+        // Testing:
+        //   BlobOutStream& putLength(int length);
+        //   BlobOutStream& putVersion(int version);
+        //   BlobOutStream& putString(const bsl::string& value);
+        //   BlobOutStream& putArrayInt64(const bsls::Types::Int64 *, int);
+        //   BlobOutStream& putArrayUint64(const bsls::Types::Uint64 *, int);
+        //   BlobOutStream& putArrayInt56(const bsls::Types::Int64 *, int);
+        //   BlobOutStream& putArrayUint56(const bsls::Types::Uint64 *, int);
+        //   BlobOutStream& putArrayInt48(const bsls::Types::Int64 *, int);
+        //   BlobOutStream& putArrayUint48(const bsls::Types::Uint64 *, int);
+        //   BlobOutStream& putArrayInt40(const bsls::Types::Int64 *, int);
+        //   BlobOutStream& putArrayUint40(const bsls::Types::Uint64 *, int);
+        //   BlobOutStream& putArrayInt32(const int *values, int numValues);
+        //   BlobOutStream& putArrayUint32(const unsigned int *, int);
+        //   BlobOutStream& putArrayInt24(const int *values, int numValues);
+        //   BlobOutStream& putArrayUint24(const unsigned int *, int);
+        //   BlobOutStream& putArrayInt16(const short *values, int numValues);
+        //   BlobOutStream& putArrayUint16(const unsigned short *, int);
+        //   BlobOutStream& putArrayInt8(const char *values, int numValues);
+        //   BlobOutStream& putArrayInt8(const signed char *, int);
+        //   BlobOutStream& putArrayUint8(const char *values, int numValues);
+        //   BlobOutStream& putArrayUint8(const unsigned char *, int);
+        //   BlobOutStream& putArrayFloat64(const double *values, int);
+        //   BlobOutStream& putArrayFloat32(const float *values, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "ARRAY, STRING, LENGTH, AND VERSION PUT METHODS"
+                      << endl
+                      << "=============================================="
+                      << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int LENGTHS[]   = { 0, 1, 2, 3, 7, 16, 100 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int N = LENGTHS[li];
+
+            bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+            putArrays(expected, N);
+            const bsl::string EXPECTED = toString(expected);
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int SIZE = BUFFER_SIZES[ti];
+
+                if (veryVerbose) { T_ P_(N) P(SIZE) }
+
+                bdlbb::SimpleBlobBufferFactory factory(SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+
+                Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+                putArrays(mX, N);
+                mX.sync();
+
+                ASSERTV(N, SIZE, X.isValid());
+                ASSERTV(N, SIZE,
+                        static_cast<int>(EXPECTED.size()) == X.length());
+                ASSERTV(N, SIZE, EXPECTED == toString(blob));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SCALAR PUT METHODS
+        //
+        // Concerns:
+        // 1. Each scalar method writes the bytes written by the corresponding
+        //    method of `bslx::ByteOutStream`, whether the value fits in the
+        //    current buffer or straddles two (or more) buffers.
+        //
+        // 2. Buffers are obtained from the blob's factory only as needed.
+        //
+        // Plan:
+        // 1. For each buffer size, write a sequence of every scalar type
+        //    several times (varying the alignment of each value relative to
+        //    buffer boundaries) to a `bdlbb::BlobOutStream` and to a
+        //    `bslx::ByteOutStream`, and compare.  (C-1)
+        //
+        // 2. Verify the number of buffers in the blob is the minimum needed.
+        //    (C-2)
+        //
+        // Testing:
+        //   BlobOutStream& putInt64(bsls::Types::Int64 value);
+        //   BlobOutStream& putUint64(bsls::Types::Uint64 value);
+        //   BlobOutStream& putInt56(bsls::Types::Int64 value);
+        //   BlobOutStream& putUint56(bsls::Types::Uint64 value);
+        //   BlobOutStream& putInt48(bsls::Types::Int64 value);
+        //   BlobOutStream& putUint48(bsls::Types::Uint64 value);
+        //   BlobOutStream& putInt40(bsls::Types::Int64 value);
+        //   BlobOutStream& putUint40(bsls::Types::Uint64 value);
+        //   BlobOutStream& putInt32(int value);
+        //   BlobOutStream& putUint32(unsigned int value);
+        //   BlobOutStream& putInt24(int value);
+        //   BlobOutStream& putUint24(unsigned int value);
+        //   BlobOutStream& putInt16(int value);
+        //   BlobOutStream& putUint16(unsigned int value);
+        //   BlobOutStream& putInt8(int value);
+        //   BlobOutStream& putUint8(unsigned int value);
+        //   BlobOutStream& putFloat64(double value);
+        //   BlobOutStream& putFloat32(float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR PUT METHODS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int SIZE = BUFFER_SIZES[ti];
+
+            bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+            CountingFactory factory(SIZE, &ta);
+            bdlbb::Blob     blob(&factory, &ta);
+
+            Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+            for (int seed = 0; seed < 20; ++seed) {
+                putScalars(expected, seed);
+                putScalars(mX, seed);
+
+                // Shift the alignment of the next sequence.
+
+                expected.putInt8(seed);
+                mX.putInt8(seed);
+            }
+            mX.sync();
+
+            const bsl::string EXPECTED = toString(expected);
+
+            ASSERTV(SIZE, X.isValid());
+            ASSERTV(SIZE, static_cast<int>(EXPECTED.size()) == X.length());
+            ASSERTV(SIZE, EXPECTED == toString(blob));
+
+            const int numBuffers = (X.length() + SIZE - 1) / SIZE;
+            ASSERTV(SIZE, numBuffers == blob.numBuffers());
+            ASSERTV(SIZE, numBuffers == factory.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Write a few values to a blob having small buffers, and verify
+        //    the data of the blob.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+
+        Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+        ASSERT(X.isValid());
+        ASSERT(0 == X.length());
+
+        mX.putInt8(1);
+        mX.putInt32(0x02030405);
+        mX.putInt16(0x0607);
+        ASSERT(X.isValid());
+        ASSERT(7 == X.length());
+        ASSERT(0 == blob.length());
+
+        mX.sync();
+        ASSERT(7 == blob.length());
+        ASSERT(3 == blob.numDataBuffers());
+        ASSERT(bsl::string("\x01\x02\x03\x04\x05\x06\x07") == toString(blob));
+
+        mX.putString("abc");
+        mX.sync();
+        ASSERT(11 == blob.length());
+        ASSERT(bsl::string("\x01\x02\x03\x04\x05\x06\x07\x03""abc") ==
+                                                              toString(blob));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Externalizing into a blob with `bdlbb::BlobOutStream` is faster
+        //    than externalizing into a `bslx::ByteOutStream` and copying the
+        //    result into a blob.
+        //
+        // Plan:
+        // 1. Externalize a payload of a mix of scalars and arrays of a given
+        //    size, repeatedly, by both methods, and report the time taken.
+        //    (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int BUFFER_SIZE = 4096;
+        const int PAYLOADS[]  = { 1024, 64 * 1024, 1024 * 1024 };
+
+        for (int pi = 0; pi < 3; ++pi) {
+            const int NUM_VALUES = PAYLOADS[pi] / 16;
+            const int NUM_ITER   = 64 * 1024 * 1024 / PAYLOADS[pi];
+
+            bsl::vector<int> ints(NUM_VALUES, 12345);
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                bslx::ByteOutStream out(VERSION_SELECTOR);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    out.putInt64(i);
+                    out.putInt32(i);
+                    out.putInt16(i);
+                    out.putInt8(i);
+                    out.putUint8(i);
+                }
+                bdlbb::Blob blob(&factory);
+                blob.setLength(static_cast<int>(out.length()));
+
+                int offset = 0;
+                for (int b = 0; offset < blob.length(); ++b) {
+                    const int n = bsl::min(blob.length() - offset,
+                                           blob.buffer(b).size());
+                    bsl::memcpy(blob.buffer(b).data(), out.data() + offset, n);
+                    offset += n;
+                }
+            }
+            timer.stop();
+            const double byteStreamTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                bdlbb::Blob          blob(&factory);
+                bdlbb::BlobOutStream out(&blob, VERSION_SELECTOR);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    out.putInt64(i);
+                    out.putInt32(i);
+                    out.putInt16(i);
+                    out.putInt8(i);
+                    out.putUint8(i);
+                }
+            }
+            timer.stop();
+            const double blobStreamTime = timer.accumulatedWallTime();
+
+            cout << "payload " << PAYLOADS[pi] << " bytes, "
+                 << NUM_ITER << " iterations:\n"
+                 << "\tByteOutStream + copy: "
+                 << byteStreamTime * 1e6 / NUM_ITER << " us\n"
+                 << "\tBlobOutStream:        "
+                 << blobStreamTime * 1e6 / NUM_ITER << " us" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
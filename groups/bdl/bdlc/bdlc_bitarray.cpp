@@ -5,9 +5,11 @@
 BSLS_IDENT_RCSID(bdlc_bitarray_cpp,"$Id$ $CSID$")
 
 #include <bdlb_bitstringutil.h>
+#include <bdlb_bitutil.h>
 
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_ostream.h>
@@ -15,6 +17,11 @@ BSLS_IDENT_RCSID(bdlc_bitarray_cpp,"$Id$ $CSID$")
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__BMI2__)
+#include <immintrin.h>
+#define BDLC_BITARRAY_USE_PDEP 1
+#endif
+
 using bsl::size_t;
 using bsl::uint64_t;
 
@@ -239,6 +246,244 @@ bsl::ostream& BitArray::print(bsl::ostream& stream,
                   : stream;
 }
 
+                       // -----------------------------
+                       // class BitArrayRankSelectIndex
+                       // -----------------------------
+
+// PRIVATE CLASS METHODS
+int BitArrayRankSelectIndex::selectInWord(uint64_t word, size_t rank)
+{
+    BSLS_ASSERT(rank < static_cast<size_t>(bdlb::BitUtil::numBitsSet(word)));
+
+#if defined(BDLC_BITARRAY_USE_PDEP)
+    return bdlb::BitUtil::numTrailingUnsetBits(
+                 _pdep_u64(static_cast<unsigned long long>(1) << rank, word));
+#else
+    // Compute the number of 1 bits in each byte of 'word', then multiply to
+    // obtain, in each byte, the number of 1 bits in that byte and all lower
+    // bytes.  Skip the bytes having no more than 'rank' 1 bits at or below
+    // them, and finish by clearing the lowest 1 bits of the remaining byte.
+
+    const uint64_t k_ONES = 0x0101010101010101ULL;
+
+    uint64_t counts = word - ((word >> 1) & (k_ONES * 0x55));
+    counts = (counts & (k_ONES * 0x33)) + ((counts >> 2) & (k_ONES * 0x33));
+    counts = (counts + (counts >> 4)) & (k_ONES * 0x0f);
+    counts *= k_ONES;
+
+    int shift = 0;
+    while (((counts >> shift) & 0xff) <= rank) {
+        shift += CHAR_BIT;
+    }
+    if (shift) {
+        rank -= static_cast<size_t>((counts >> (shift - CHAR_BIT)) & 0xff);
+    }
+
+    unsigned int byte = static_cast<unsigned int>(word >> shift) & 0xff;
+    for (; rank; --rank) {
+        byte &= byte - 1;
+    }
+
+    return shift + bdlb::BitUtil::numTrailingUnsetBits(byte);
+#endif
+}
+
+// PRIVATE MANIPULATORS
+void BitArrayRankSelectIndex::updateFrom(const BitArray& bitArray,
+                                         size_t          index)
+{
+    const size_t length    = bitArray.d_length;
+    const size_t numBlocks = (length + k_BITS_PER_BLOCK - 1) /
+                                                              k_BITS_PER_BLOCK;
+    const size_t numSpans  = (numBlocks + (1 << k_LOG2_BLOCKS_PER_SPAN) - 1) >>
+                                                        k_LOG2_BLOCKS_PER_SPAN;
+
+    // Reserve up front so that nothing below can throw.  There are no more 1
+    // bits than there are bits, hence no more samples than the number of
+    // sample intervals spanned by 'length'.
+
+    d_blocks.reserve(numBlocks);
+    d_superBlocks.reserve(numSpans);
+    d_samples.reserve((length + k_SELECT_SAMPLE_RATE - 1) /
+                                                         k_SELECT_SAMPLE_RATE);
+
+    // The blocks below the one holding the lowest bit that may have changed
+    // keep their counts, and so do the samples of the 1 bits below it.
+
+    size_t block = bsl::min(index, bsl::min(length, d_length)) /
+                                                              k_BITS_PER_BLOCK;
+    size_t num1  = block < d_blocks.size() ? blockRank(block) : d_num1;
+
+    d_blocks.resize(numBlocks);
+    d_superBlocks.resize(numSpans);
+    d_samples.resize((num1 + k_SELECT_SAMPLE_RATE - 1) /
+                                                         k_SELECT_SAMPLE_RATE);
+
+    const uint64_t *words = bitArray.data();
+
+    for (; block < numBlocks; ++block) {
+        const size_t span = block >> k_LOG2_BLOCKS_PER_SPAN;
+        if (0 == (block & ((1 << k_LOG2_BLOCKS_PER_SPAN) - 1))) {
+            d_superBlocks[span] = num1;
+        }
+
+        uint64_t counts = static_cast<uint64_t>(num1 - d_superBlocks[span])
+                                                         << k_BLOCK_RANK_SHIFT;
+        size_t   blockNum1 = 0;
+
+        for (int i = 0; i < k_SUB_BLOCKS_PER_BLOCK; ++i) {
+            const size_t begin = block * k_BITS_PER_BLOCK +
+                                                    i * k_BITS_PER_SUB_BLOCK;
+            if (begin >= length) {
+                break;
+            }
+
+            const size_t count = bdlb::BitStringUtil::num1(
+                       words,
+                       begin,
+                       bsl::min<size_t>(k_BITS_PER_SUB_BLOCK, length - begin));
+
+            if (i < k_SUB_BLOCKS_PER_BLOCK - 1) {
+                counts |= static_cast<uint64_t>(count)
+                                             << (i * k_SUB_BLOCK_COUNT_BITS);
+            }
+            blockNum1 += count;
+        }
+        d_blocks[block] = counts;
+
+        // A block holds fewer 1 bits than the sampling rate, so it holds at
+        // most one sampled 1 bit.
+
+        BSLMF_ASSERT(k_BITS_PER_BLOCK < k_SELECT_SAMPLE_RATE);
+
+        if (d_samples.size() * k_SELECT_SAMPLE_RATE < num1 + blockNum1) {
+            d_samples.push_back(block);
+        }
+        num1 += blockNum1;
+    }
+
+    d_length = length;
+    d_num1   = num1;
+}
+
+// CREATORS
+BitArrayRankSelectIndex::BitArrayRankSelectIndex(
+                                              bslma::Allocator *basicAllocator)
+: d_bitArray_p(0)
+, d_length(0)
+, d_num1(0)
+, d_superBlocks(basicAllocator)
+, d_blocks(basicAllocator)
+, d_samples(basicAllocator)
+{
+}
+
+BitArrayRankSelectIndex::BitArrayRankSelectIndex(
+                                            const BitArray&   bitArray,
+                                            bslma::Allocator *basicAllocator)
+: d_bitArray_p(0)
+, d_length(0)
+, d_num1(0)
+, d_superBlocks(basicAllocator)
+, d_blocks(basicAllocator)
+, d_samples(basicAllocator)
+{
+    updateFrom(bitArray, 0);
+    d_bitArray_p = &bitArray;
+}
+
+BitArrayRankSelectIndex::~BitArrayRankSelectIndex()
+{
+    BSLS_ASSERT(d_blocks.size() ==
+               (d_length + k_BITS_PER_BLOCK - 1) / k_BITS_PER_BLOCK);
+    BSLS_ASSERT(d_num1 <= d_length);
+}
+
+// MANIPULATORS
+void BitArrayRankSelectIndex::reset()
+{
+    d_bitArray_p = 0;
+    d_length     = 0;
+    d_num1       = 0;
+    d_superBlocks.clear();
+    d_blocks.clear();
+    d_samples.clear();
+}
+
+void BitArrayRankSelectIndex::reset(const BitArray& bitArray)
+{
+    reset();
+    updateFrom(bitArray, 0);
+    d_bitArray_p = &bitArray;
+}
+
+void BitArrayRankSelectIndex::update(size_t index)
+{
+    BSLS_ASSERT(d_bitArray_p);
+
+    updateFrom(*d_bitArray_p, index);
+}
+
+// ACCESSORS
+size_t BitArrayRankSelectIndex::select1(size_t rank) const
+{
+    BSLS_ASSERT(d_bitArray_p);
+    BSLS_ASSERT(rank < d_num1);
+    BSLS_ASSERT_SAFE(d_bitArray_p->d_length == d_length);
+
+    // The block holding the 1 bit of the specified 'rank' lies between the
+    // blocks holding the sampled 1 bits on either side of it.  Find the last
+    // block in that range having no more than 'rank' 1 bits below it.
+
+    const size_t sample = rank / k_SELECT_SAMPLE_RATE;
+
+    size_t low  = d_samples[sample];
+    size_t high = sample + 1 < d_samples.size()
+                ? d_samples[sample + 1] + 1
+                : d_blocks.size();
+
+    while (high - low > 1) {
+        const size_t middle = low + (high - low) / 2;
+        if (blockRank(middle) <= rank) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    // Then, skip whole sub-blocks using the counts of the block, and whole
+    // words by counting their bits.
+
+    const uint64_t counts = d_blocks[low];
+    size_t         word   = low * k_WORDS_PER_BLOCK;
+
+    rank -= blockRank(low);
+    for (int i = 0; i < k_SUB_BLOCKS_PER_BLOCK - 1; ++i) {
+        const size_t count = static_cast<size_t>(
+                    (counts >> (i * k_SUB_BLOCK_COUNT_BITS)) &
+                                                       k_SUB_BLOCK_COUNT_MASK);
+        if (rank < count) {
+            break;
+        }
+        rank -= count;
+        word += k_WORDS_PER_SUB_BLOCK;
+    }
+
+    const uint64_t *words = d_bitArray_p->data();
+    for (;; ++word) {
+        BSLS_ASSERT(word * k_BITS_PER_WORD < d_length);
+
+        const size_t count = bdlb::BitUtil::numBitsSet(words[word]);
+        if (rank < count) {
+            break;
+        }
+        rank -= count;
+    }
+
+    return word * k_BITS_PER_WORD + selectInWord(words[word], rank);
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlc::BitArray: vector-like, sequential container of boolean values
+//  bdlc::BitArrayRankSelectIndex: rank/select index over a `bdlc::BitArray`
 //
 //@DESCRIPTION: This component implements `bdlc::BitArray`, an efficient
 // value-semantic, sequential container of boolean values (i.e., 0 or 1) of
@@ -99,6 +100,34 @@ BSLS_IDENT("$Id: $")
 // Note that *all* of the non-creator methods of `BitArray` provide the
 // *No-Throw* guarantee whenever sufficient capacity is already available.
 //
+///Rank and Select
+///---------------
+// A `bdlc::BitArrayRankSelectIndex` is an optional, auxiliary index over the
+// bits of a `BitArray` that answers the following queries in (nearly)
+// constant time, where they would otherwise take time linear in the length of
+// the array:
+//
+// * `rank1(index)`: the number of 1 bits at positions below `index`
+// * `select1(rank)`: the position of the 1 bit having `rank` 1 bits below it
+//
+// These two queries are the building blocks of succinct data structures and
+// compressed bitmap indexes.  The index is laid out in the manner of the
+// "poppy" structure: each block of 2048 bits has one 64-bit word recording the
+// number of 1 bits below the block and in each of its first three 512-bit
+// sub-blocks, and one additional word per 2^32 bits records the number of 1
+// bits below that span.  In addition, the position of every 8192nd 1 bit is
+// sampled to narrow the search performed by `select1`.  The index therefore
+// occupies a little over 3% of the space occupied by the array itself, plus at
+// most one word per 8192 1 bits.
+//
+// A `BitArrayRankSelectIndex` refers to, but does not own, the array it
+// indexes, and its queries reflect the value the array had when the index was
+// last built.  The index is *not* updated automatically: after the array is
+// modified, `update` must be called before the next query.  If all modified
+// bits are at or above a known position (e.g., the array was only appended
+// to), `update` can be passed that position, in which case only the part of
+// the index covering the modified bits is recomputed.
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of this component.
@@ -426,11 +455,62 @@ BSLS_IDENT("$Id: $")
 // assert(false   == ARRAY.isAnyElementNonNull());
 // assert(false   == ARRAY.isAnyElementNull());
 // ```
+//
+///Example 2: Locating the Values of a Sparse Array
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we store a sparse array of `double` values compactly: a
+// `bdlc::BitArray` records which positions hold a value, and a
+// `bsl::vector<double>` holds just those values, in order of position.  A
+// `bdlc::BitArrayRankSelectIndex` maps between positions in the sparse array
+// and offsets in the dense vector in constant time.
+//
+// First, we store values at a few positions of a sparse array of length
+// 10000:
+// ```
+// bdlc::BitArray      present(10000);
+// bsl::vector<double> values;
+//
+// const bsl::size_t POSITIONS[] = { 3, 700, 701, 4096, 9999 };
+// const int         NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+//
+// for (int i = 0; i < NUM_POSITIONS; ++i) {
+//     present.assign1(POSITIONS[i]);
+//     values.push_back(static_cast<double>(POSITIONS[i]) / 2);
+// }
+// ```
+// Then, we build a rank/select index over the flags:
+// ```
+// bdlc::BitArrayRankSelectIndex index(present);
+// assert(5 == index.num1());
+// ```
+// Next, we look up the value stored at position 4096, whose offset in
+// `values` is the number of values stored at lower positions:
+// ```
+// assert(true   == present[4096]);
+// assert(3      == index.rank1(4096));
+// assert(2048.0 == values[index.rank1(4096)]);
+// ```
+// Then, we find the position holding the third value:
+// ```
+// assert(701 == index.select1(2));
+// ```
+// Finally, we append a value at the end of the sparse array.  As no bit below
+// the old length was modified, we update only the tail of the index:
+// ```
+// present.append(true);
+// values.push_back(5000.0);
+// index.update(10000);
+//
+// assert(6      == index.num1());
+// assert(10000  == index.select1(5));
+// assert(5000.0 == values[index.rank1(10000)]);
+// ```
 
 #include <bdlscm_version.h>
 
 #include <bdlb_bitmaskutil.h>
 #include <bdlb_bitstringutil.h>
+#include <bdlb_bitutil.h>
 
 #include <bslalg_swaputil.h>
 
@@ -494,6 +574,7 @@ class BitArray {
 
     // FRIENDS
     friend bool operator==(const BitArray&, const BitArray&);
+    friend class BitArrayRankSelectIndex;
 
   private:
     // PRIVATE CLASS METHODS
@@ -1088,6 +1169,173 @@ bsl::ostream& operator<<(bsl::ostream& stream, const BitArray& rhs);
 /// created with the same allocator and the basic guarantee otherwise.
 void swap(BitArray& a, BitArray& b);
 
+                       // =============================
+                       // class BitArrayRankSelectIndex
+                       // =============================
+
+/// This mechanism class provides an auxiliary index over the bits of a
+/// `BitArray` that answers rank and select queries in (nearly) constant
+/// time (see {Rank and Select}).  The index refers to, but does not own,
+/// the array it indexes, and reflects the value that array had when the
+/// index was last built or updated.
+class BitArrayRankSelectIndex {
+
+    // PRIVATE TYPES
+    enum {
+        k_BITS_PER_WORD         = BitArray::k_BITS_PER_UINT64,
+        k_BITS_PER_SUB_BLOCK    = 512,
+        k_BITS_PER_BLOCK        = 2048,
+        k_SUB_BLOCKS_PER_BLOCK  = k_BITS_PER_BLOCK / k_BITS_PER_SUB_BLOCK,
+        k_WORDS_PER_SUB_BLOCK   = k_BITS_PER_SUB_BLOCK / k_BITS_PER_WORD,
+        k_WORDS_PER_BLOCK       = k_BITS_PER_BLOCK / k_BITS_PER_WORD,
+        k_SUB_BLOCK_COUNT_BITS  = 10,
+        k_SUB_BLOCK_COUNT_MASK  = (1 << k_SUB_BLOCK_COUNT_BITS) - 1,
+        k_BLOCK_RANK_SHIFT      = 32,
+        k_LOG2_BLOCKS_PER_SPAN  = 21,  // 2^32 bits per span
+        k_SELECT_SAMPLE_RATE    = 8192
+    };
+
+    // DATA
+    const BitArray             *d_bitArray_p;   // indexed array (held, not
+                                                // owned), or 0 if none
+
+    bsl::size_t                 d_length;       // length of the indexed
+                                                // array when last updated
+
+    bsl::size_t                 d_num1;         // number of 1 bits in the
+                                                // indexed array when last
+                                                // updated
+
+    bsl::vector<bsl::uint64_t>  d_superBlocks;  // number of 1 bits below
+                                                // each span of 2^32 bits
+
+    bsl::vector<bsl::uint64_t>  d_blocks;       // for each 2048-bit block,
+                                                // the number of 1 bits below
+                                                // the block within its span
+                                                // (high 32 bits), and in
+                                                // each of its first three
+                                                // 512-bit sub-blocks (three
+                                                // 10-bit fields)
+
+    bsl::vector<bsl::size_t>    d_samples;      // index of the block holding
+                                                // every 8192nd 1 bit
+
+  private:
+    // NOT IMPLEMENTED
+    BitArrayRankSelectIndex(const BitArrayRankSelectIndex&);
+    BitArrayRankSelectIndex& operator=(const BitArrayRankSelectIndex&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the position, within the specified `word`, of the 1 bit
+    /// having the specified `rank` 1 bits of `word` below it.  The behavior
+    /// is undefined unless `rank < bdlb::BitUtil::numBitsSet(word)`.
+    static int selectInWord(bsl::uint64_t word, bsl::size_t rank);
+
+    // PRIVATE MANIPULATORS
+
+    /// Recompute the part of this index covering the blocks at and above
+    /// the one containing the specified `index` bit from the value of the
+    /// specified `bitArray`, retaining the counts of the blocks below it.
+    /// If an exception is thrown, this index is unchanged.
+    void updateFrom(const BitArray& bitArray, bsl::size_t index);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the number of 1 bits below the block at the specified
+    /// `blockIndex`.  The behavior is undefined unless
+    /// `blockIndex < d_blocks.size()`.
+    bsl::size_t blockRank(bsl::size_t blockIndex) const;
+
+  public:
+    // CREATORS
+
+    /// Create an index that does not refer to any array.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit BitArrayRankSelectIndex(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an index over the current value of the specified `bitArray`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `bitArray` outlives this
+    /// index or `reset` is called before it is destroyed.
+    explicit BitArrayRankSelectIndex(const BitArray&   bitArray,
+                                     bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~BitArrayRankSelectIndex();
+
+    // MANIPULATORS
+
+    /// Reset this index to not refer to any array.  Note that memory
+    /// already allocated by this index is retained.
+    void reset();
+
+    /// Rebuild this index over the current value of the specified
+    /// `bitArray`.  If an exception is thrown, this index is left not
+    /// referring to any array.  The behavior is undefined unless `bitArray`
+    /// outlives this index or `reset` is called before it is destroyed.
+    void reset(const BitArray& bitArray);
+
+    /// Update this index to reflect the current value of the array to
+    /// which it refers.  Optionally specify `index`, the position of the
+    /// lowest bit that might have been modified since this index was last
+    /// built or updated, in which case only the part of this index
+    /// covering the bits at and above `index` is recomputed.  If an
+    /// exception is thrown, this index is unchanged.  The behavior is
+    /// undefined unless this index refers to an array and, if `index` is
+    /// specified, no bit below `index` has been modified (including by
+    /// insertion or removal of bits) since this index was last built or
+    /// updated.  Note that `index` may exceed the length of the array.
+    void update(bsl::size_t index = 0);
+
+    // ACCESSORS
+
+    /// Return the address of the array indexed by this object, or 0 if
+    /// this index does not refer to any array.
+    const BitArray *bitArray() const;
+
+    /// Return the length of the indexed array when this index was last
+    /// built or updated, or 0 if this index does not refer to any array.
+    bsl::size_t length() const;
+
+    /// Return the number of 0 bits in the indexed array.
+    bsl::size_t num0() const;
+
+    /// Return the number of 1 bits in the indexed array.
+    bsl::size_t num1() const;
+
+    /// Return the number of 0 bits at positions below the specified `index`
+    /// in the indexed array.  The behavior is undefined unless
+    /// `index <= length()` and the indexed array has not been modified
+    /// since this index was last built or updated.
+    bsl::size_t rank0(bsl::size_t index) const;
+
+    /// Return the number of 1 bits at positions below the specified `index`
+    /// in the indexed array.  The behavior is undefined unless
+    /// `index <= length()` and the indexed array has not been modified
+    /// since this index was last built or updated.  Note that this method
+    /// runs in constant time.
+    bsl::size_t rank1(bsl::size_t index) const;
+
+    /// Return the position of the 1 bit in the indexed array having the
+    /// specified `rank` 1 bits at positions below it (i.e., the position
+    /// `p` such that the bit at `p` is 1 and `rank1(p) == rank`).  The
+    /// behavior is undefined unless `rank < num1()` and the indexed array
+    /// has not been modified since this index was last built or updated.
+    /// Note that this method runs in constant time, except for a binary
+    /// search over the blocks of 2048 bits lying between two consecutive
+    /// sampled 1 bits, which is short unless 1 bits are sparse.
+    bsl::size_t select1(bsl::size_t rank) const;
+
+                                // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
@@ -1923,6 +2171,108 @@ bsl::ostream& bdlc::operator<<(bsl::ostream& stream, const BitArray& rhs)
     return rhs.print(stream, 0, -1);
 }
 
+namespace bdlc {
+
+                       // -----------------------------
+                       // class BitArrayRankSelectIndex
+                       // -----------------------------
+
+// PRIVATE ACCESSORS
+inline
+bsl::size_t BitArrayRankSelectIndex::blockRank(bsl::size_t blockIndex) const
+{
+    BSLS_ASSERT(blockIndex < d_blocks.size());
+
+    return static_cast<bsl::size_t>(
+                          d_superBlocks[blockIndex >> k_LOG2_BLOCKS_PER_SPAN] +
+                          (d_blocks[blockIndex] >> k_BLOCK_RANK_SHIFT));
+}
+
+// ACCESSORS
+inline
+const BitArray *BitArrayRankSelectIndex::bitArray() const
+{
+    return d_bitArray_p;
+}
+
+inline
+bsl::size_t BitArrayRankSelectIndex::length() const
+{
+    return d_length;
+}
+
+inline
+bsl::size_t BitArrayRankSelectIndex::num0() const
+{
+    return d_length - d_num1;
+}
+
+inline
+bsl::size_t BitArrayRankSelectIndex::num1() const
+{
+    return d_num1;
+}
+
+inline
+bsl::size_t BitArrayRankSelectIndex::rank0(bsl::size_t index) const
+{
+    return index - rank1(index);
+}
+
+inline
+bsl::size_t BitArrayRankSelectIndex::rank1(bsl::size_t index) const
+{
+    BSLS_ASSERT(d_bitArray_p);
+    BSLS_ASSERT(index <= d_length);
+    BSLS_ASSERT_SAFE(d_bitArray_p->d_length == d_length);
+
+    if (index == d_length) {
+        return d_num1;                                                // RETURN
+    }
+
+    // Add the counts of the whole sub-blocks preceding 'index' in its block,
+    // and then count the bits of the words preceding 'index' in its
+    // sub-block.
+
+    const bsl::size_t   blockIndex = index / k_BITS_PER_BLOCK;
+    const bsl::uint64_t counts     = d_blocks[blockIndex];
+    const int           subBlock   = static_cast<int>(
+                              index % k_BITS_PER_BLOCK / k_BITS_PER_SUB_BLOCK);
+
+    bsl::size_t ret = blockRank(blockIndex);
+    for (int i = 0; i < subBlock; ++i) {
+        ret += static_cast<bsl::size_t>(
+                    (counts >> (i * k_SUB_BLOCK_COUNT_BITS)) &
+                                                       k_SUB_BLOCK_COUNT_MASK);
+    }
+
+    const bsl::uint64_t *words     = d_bitArray_p->data();
+    const bsl::size_t    wordIndex = index / k_BITS_PER_WORD;
+    for (bsl::size_t i = index / k_BITS_PER_SUB_BLOCK * k_WORDS_PER_SUB_BLOCK;
+         i < wordIndex;
+         ++i) {
+        ret += bdlb::BitUtil::numBitsSet(words[i]);
+    }
+
+    const int pos = static_cast<int>(index % k_BITS_PER_WORD);
+    if (pos) {
+        ret += bdlb::BitUtil::numBitsSet(words[wordIndex] &
+                                         bdlb::BitMaskUtil::lt64(pos));
+    }
+
+    return ret;
+}
+
+                                // Aspects
+
+inline
+bslma::Allocator *BitArrayRankSelectIndex::allocator() const
+{
+    return d_blocks.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
 namespace bslmf {
 
 /// This template specialization for `IsBitwiseMoveable` indicates that
@@ -1943,6 +2293,12 @@ template <>
 struct UsesBslmaAllocator<bdlc::BitArray> : bsl::true_type {
 };
 
+/// This template specialization for `UsesBslmaAllocator` indicates that
+/// `BitArrayRankSelectIndex` uses `bslma::Allocator`.
+template <>
+struct UsesBslmaAllocator<bdlc::BitArrayRankSelectIndex> : bsl::true_type {
+};
+
 }  // close namespace bslma
 
 }  // close enterprise namespace
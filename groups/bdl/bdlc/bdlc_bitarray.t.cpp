@@ -36,6 +36,7 @@
 #include <bsl_string.h>
 #include <bsl_sstream.h>
 #include <bsl_new.h>         // placement new syntax
+#include <bsl_vector.h>
 
 #include <bsl_cctype.h>      // isspace, tolower
 #include <bsl_climits.h>     // CHAR_BIT
@@ -160,8 +161,24 @@ using bsl::uint64_t;
 // [20] BitArray operator>>(const BitArray& bitArray, size_t numBits);
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
+//
+// CLASS 'BitArrayRankSelectIndex'
+// [31] BitArrayRankSelectIndex(bslma::Allocator *ba = 0);
+// [31] BitArrayRankSelectIndex(const BitArray& bitArray, *ba = 0);
+// [31] ~BitArrayRankSelectIndex();
+// [31] void reset();
+// [31] void reset(const BitArray& bitArray);
+// [31] void update(size_t index = 0);
+// [31] const BitArray *bitArray() const;
+// [31] size_t length() const;
+// [31] size_t num0() const;
+// [31] size_t num1() const;
+// [31] size_t rank0(size_t index) const;
+// [31] size_t rank1(size_t index) const;
+// [31] size_t select1(size_t rank) const;
+// [31] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -866,7 +883,214 @@ bsl::string randSpec(size_t length)
     return ret;
 }
 
-/// Test the usage example (see call in main `switch`, test case 31).  This
+/// Verify that the specified `index`, built over the specified `array`,
+/// agrees with the results of scanning `array` for every position and every
+/// rank, reporting failures against the specified `line`.
+static
+void verifyRankSelect(const bdlc::BitArrayRankSelectIndex& index,
+                      const Obj&                           array,
+                      int                                  line)
+{
+    ASSERTV(line, &array         == index.bitArray());
+    ASSERTV(line, array.length() == index.length());
+    ASSERTV(line, array.num1()   == index.num1());
+    ASSERTV(line, array.num0()   == index.num0());
+
+    size_t rank = 0;
+    for (size_t ii = 0; ii <= array.length(); ++ii) {
+        ASSERTV(line, ii, rank,      rank      == index.rank1(ii));
+        ASSERTV(line, ii, ii - rank, ii - rank == index.rank0(ii));
+
+        if (ii < array.length() && array[ii]) {
+            ASSERTV(line, ii, rank, ii == index.select1(rank));
+            ++rank;
+        }
+    }
+}
+
+/// Test `bdlc::BitArrayRankSelectIndex`.  See documentation in main
+/// `switch`, test case 31.
+static
+void testRankSelectIndex()
+{
+    typedef bdlc::BitArrayRankSelectIndex Index;
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::TestAllocator         oa("object",  veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) cout << "\tIndex not referring to an array.\n";
+    {
+        Index mX(&oa);    const Index& X = mX;
+
+        ASSERT(0   == X.bitArray());
+        ASSERT(0   == X.length());
+        ASSERT(0   == X.num0());
+        ASSERT(0   == X.num1());
+        ASSERT(&oa == X.allocator());
+    }
+
+    if (verbose) cout << "\tPatterns of various lengths.\n";
+    {
+        static const size_t LENGTHS[] = {
+            0, 1, 63, 64, 65, 511, 512, 513, 2047, 2048, 2049, 4000,
+            8191, 8192, 8193, 20000, 70001
+        };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        enum {
+            e_ALL_0,      // no 1 bits
+            e_ALL_1,      // no 0 bits
+            e_RANDOM,     // each bit 1 with probability 1/2
+            e_SPARSE,     // every 4999th bit is 1, so samples are far apart
+            e_RUNS,       // runs of 3000 1 bits separated by 6000 0 bits
+            e_NUM_PATTERNS
+        };
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const size_t LENGTH = LENGTHS[ti];
+
+            for (int pattern = 0; pattern < e_NUM_PATTERNS; ++pattern) {
+                Obj mA(LENGTH, &oa);    const Obj& A = mA;
+
+                for (size_t ii = 0; ii < LENGTH; ++ii) {
+                    bool value = false;
+                    switch (pattern) {
+                      case e_ALL_0:  value = false;                     break;
+                      case e_ALL_1:  value = true;                      break;
+                      case e_RANDOM: value = bsl::rand() & 1;           break;
+                      case e_SPARSE: value = 0 == ii % 4999;            break;
+                      case e_RUNS:   value = 0 == ii / 3000 % 3;        break;
+                    }
+                    mA.assign(ii, value);
+                }
+
+                Index mX(A, &oa);    const Index& X = mX;
+
+                if (veryVerbose) {
+                    P_(LENGTH) P_(pattern) P(X.num1());
+                }
+
+                verifyRankSelect(X, A, L_);
+                ASSERTV(LENGTH, pattern, 0 == da.numBlocksTotal());
+            }
+        }
+    }
+
+    if (verbose) cout << "\tIncremental updates.\n";
+    {
+        Obj   mA(&oa);       const Obj&   A = mA;
+        Index mX(A, &oa);    const Index& X = mX;
+
+        verifyRankSelect(X, A, L_);
+
+        for (int round = 0; round < 40; ++round) {
+            // Append bits having a density varying with 'round', and update
+            // from the old length.
+
+            const size_t oldLength = A.length();
+            const int    numBits   = bsl::rand() % 3000;
+            const int    density   = round % 4 + 1;
+
+            for (int ii = 0; ii < numBits; ++ii) {
+                mA.append(0 == bsl::rand() % density);
+            }
+            mX.update(oldLength);
+            verifyRankSelect(X, A, L_);
+
+            // Toggle one bit, and update from it.
+
+            if (!A.isEmpty()) {
+                const size_t pos = bsl::rand() % A.length();
+
+                mA.toggle(pos);
+                mX.update(pos);
+                verifyRankSelect(X, A, L_);
+            }
+
+            // Occasionally shrink the array, and update from its new length.
+
+            if (3 == round % 4) {
+                const size_t newLength = A.length() - A.length() / 4;
+
+                mA.setLength(newLength);
+                mX.update(newLength);
+                verifyRankSelect(X, A, L_);
+            }
+        }
+
+        mA.toggleAll();
+        mX.update();
+        verifyRankSelect(X, A, L_);
+
+        mX.update(A.length() + 100);
+        verifyRankSelect(X, A, L_);
+
+        ASSERT(0 == da.numBlocksTotal());
+    }
+
+    if (verbose) cout << "\tReset.\n";
+    {
+        Obj mA(5000, true,  &oa);    const Obj& A = mA;
+        Obj mB(100,  false, &oa);    const Obj& B = mB;
+
+        Index mX(&oa);    const Index& X = mX;
+
+        mX.reset(A);
+        verifyRankSelect(X, A, L_);
+
+        mX.reset(B);
+        verifyRankSelect(X, B, L_);
+
+        mX.reset();
+        ASSERT(0 == X.bitArray());
+        ASSERT(0 == X.length());
+        ASSERT(0 == X.num1());
+    }
+
+    if (verbose) cout << "\tException neutrality.\n";
+    {
+        Obj mA(30000, &oa);    const Obj& A = mA;
+        for (size_t ii = 0; ii < A.length(); ii += 3) {
+            mA.assign1(ii);
+        }
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            Index mX(A, &oa);    const Index& X = mX;
+
+            ASSERT(10000 == X.num1());
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERT(0 == da.numBlocksTotal());
+    }
+
+    if (verbose) cout << "\tNegative testing.\n";
+    {
+        Obj   mA(100, true);    const Obj&   A = mA;
+        Index mX(A);            const Index& X = mX;
+        Index mY;               const Index& Y = mY;
+
+        bsls::AssertTestHandlerGuard guard;
+
+        ASSERT_PASS(X.rank1(0));
+        ASSERT_PASS(X.rank1(100));
+        ASSERT_FAIL(X.rank1(101));
+        ASSERT_PASS(X.select1(99));
+        ASSERT_FAIL(X.select1(100));
+
+        ASSERT_FAIL(mY.update());
+        ASSERT_FAIL(Y.rank1(0));
+        ASSERT_FAIL(Y.select1(0));
+
+        mA.append(true);
+        ASSERT_SAFE_FAIL(X.rank1(0));
+        ASSERT_SAFE_FAIL(X.select1(0));
+        mX.update(100);
+        ASSERT_PASS(X.rank1(101));
+    }
+}
+
+/// Test the usage example (see call in main `switch`, test case 32).  This
 /// code had to be moved out of the main `switch`, which had grown too
 /// large, causing the AIX optimizing compiler to crash.
 static
@@ -982,6 +1206,56 @@ void testUsage()
     ASSERT(false   == ARRAY.isAnyElementNonNull());
     ASSERT(false   == ARRAY.isAnyElementNull());
 //..
+//
+///Example 2: Locating the Values of a Sparse Array
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we store a sparse array of 'double' values compactly: a
+// 'bdlc::BitArray' records which positions hold a value, and a
+// 'bsl::vector<double>' holds just those values, in order of position.  A
+// 'bdlc::BitArrayRankSelectIndex' maps between positions in the sparse array
+// and offsets in the dense vector in constant time.
+//
+// First, we store values at a few positions of a sparse array of length
+// 10000:
+//..
+    bdlc::BitArray      present(10000);
+    bsl::vector<double> values;
+
+    const bsl::size_t POSITIONS[] = { 3, 700, 701, 4096, 9999 };
+    const int         NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+    for (int i = 0; i < NUM_POSITIONS; ++i) {
+        present.assign1(POSITIONS[i]);
+        values.push_back(static_cast<double>(POSITIONS[i]) / 2);
+    }
+//..
+// Then, we build a rank/select index over the flags:
+//..
+    bdlc::BitArrayRankSelectIndex index(present);
+    ASSERT(5 == index.num1());
+//..
+// Next, we look up the value stored at position 4096, whose offset in
+// 'values' is the number of values stored at lower positions:
+//..
+    ASSERT(true   == present[4096]);
+    ASSERT(3      == index.rank1(4096));
+    ASSERT(2048.0 == values[index.rank1(4096)]);
+//..
+// Then, we find the position holding the third value:
+//..
+    ASSERT(701 == index.select1(2));
+//..
+// Finally, we append a value at the end of the sparse array.  As no bit below
+// the old length was modified, we update only the tail of the index:
+//..
+    present.append(true);
+    values.push_back(5000.0);
+    index.update(10000);
+
+    ASSERT(6      == index.num1());
+    ASSERT(10000  == index.select1(5));
+    ASSERT(5000.0 == values[index.rank1(10000)]);
+//..
 }
 
 /// Test the `num0` and `num1` methods when applied to subranges.  The
@@ -1424,7 +1698,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1445,6 +1719,70 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'BitArrayRankSelectIndex'
+        //
+        // Concerns:
+        //: 1 'rank1', 'rank0', and 'select1' agree with the results of
+        //:   scanning the indexed array, for every position and rank, at and
+        //:   around the word, sub-block, block, and sample boundaries of the
+        //:   index.
+        //:
+        //: 2 The results are correct for bit patterns that are empty, full,
+        //:   random, sparse (many blocks between samples), and clustered.
+        //:
+        //: 3 'update', passed the lowest modified position, yields the same
+        //:   results as rebuilding the index, after the array is appended
+        //:   to, modified, or shortened.
+        //:
+        //: 4 'reset' rebinds the index to another array, or to none.
+        //:
+        //: 5 All memory comes from the object allocator, and construction is
+        //:   exception neutral.
+        //:
+        //: 6 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a sequence of lengths spanning the boundaries of the index,
+        //:   and for each of several bit patterns, build an index and verify
+        //:   every rank and every select against a scan of the array.
+        //:   (C-1..2, 5)
+        //:
+        //: 2 Repeatedly append to, toggle a bit of, and shorten an array,
+        //:   calling 'update' with the lowest modified position, and verify
+        //:   the index after each step.  (C-3)
+        //:
+        //: 3 Reset an index to several arrays and to none, verifying it each
+        //:   time.  (C-4)
+        //:
+        //: 4 Build an index within the 'bslma' exception-test loop.  (C-5)
+        //:
+        //: 5 Verify that defensive checks are triggered for invalid values
+        //:   and stale indexes.  (C-6)
+        //
+        // Testing:
+        //   BitArrayRankSelectIndex(bslma::Allocator *ba = 0);
+        //   BitArrayRankSelectIndex(const BitArray& bitArray, *ba = 0);
+        //   ~BitArrayRankSelectIndex();
+        //   void reset();
+        //   void reset(const BitArray& bitArray);
+        //   void update(size_t index = 0);
+        //   const BitArray *bitArray() const;
+        //   size_t length() const;
+        //   size_t num0() const;
+        //   size_t num1() const;
+        //   size_t rank0(size_t index) const;
+        //   size_t rank1(size_t index) const;
+        //   size_t select1(size_t rank) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'BitArrayRankSelectIndex'\n"
+                               "=================================\n";
+
+        testRankSelectIndex();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
@@ -0,0 +1,126 @@
+// bdlc_bitpackedintarray.cpp                                         -*-C++-*-
+#include <bdlc_bitpackedintarray.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_bitpackedintarray_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // -----------------------------
+                       // struct BitPackedIntArray_Util
+                       // -----------------------------
+
+// CLASS METHODS
+void BitPackedIntArray_Util::load(bsl::uint64_t       *result,
+                                  const bsl::uint64_t *words,
+                                  bsl::size_t          index,
+                                  bsl::size_t          numElements,
+                                  int                  bitsPerElement)
+{
+    BSLS_ASSERT(result || 0 == numElements);
+    BSLS_ASSERT(0 <= bitsPerElement);
+    BSLS_ASSERT(     bitsPerElement <= k_BITS_PER_WORD);
+
+    if (0 == bitsPerElement) {
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            result[i] = 0;
+        }
+        return;                                                       // RETURN
+    }
+
+    const bsl::uint64_t mask = k_BITS_PER_WORD == bitsPerElement
+                             ? ~static_cast<bsl::uint64_t>(0)
+                             : (static_cast<bsl::uint64_t>(1)
+                                                        << bitsPerElement) - 1;
+
+    // Walk the words, rather than computing the position of each value from
+    // its index, so that each value costs a few shifts.
+
+    const bsl::uint64_t  bitIndex = static_cast<bsl::uint64_t>(index)
+                                                              * bitsPerElement;
+    const bsl::uint64_t *word     = words
+                                  + static_cast<bsl::size_t>(
+                                                   bitIndex / k_BITS_PER_WORD);
+    int                  offset   = static_cast<int>(
+                                                   bitIndex % k_BITS_PER_WORD);
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        bsl::uint64_t value = *word >> offset;
+
+        offset += bitsPerElement;
+        if (offset >= k_BITS_PER_WORD) {
+            offset -= k_BITS_PER_WORD;
+            ++word;
+
+            // The value continues in the next word only if its last
+            // `offset` bits did not fit in the previous word.
+
+            if (offset) {
+                value |= *word << (bitsPerElement - offset);
+            }
+        }
+        result[i] = value & mask;
+    }
+}
+
+void BitPackedIntArray_Util::store(bsl::uint64_t       *words,
+                                   bsl::size_t          index,
+                                   const bsl::uint64_t *values,
+                                   bsl::size_t          numValues,
+                                   int                  bitsPerElement)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= bitsPerElement);
+    BSLS_ASSERT(     bitsPerElement <= k_BITS_PER_WORD);
+
+    if (0 == bitsPerElement) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::uint64_t  bitIndex = static_cast<bsl::uint64_t>(index)
+                                                              * bitsPerElement;
+    bsl::uint64_t       *word     = words
+                                  + static_cast<bsl::size_t>(
+                                                   bitIndex / k_BITS_PER_WORD);
+    int                  offset   = static_cast<int>(
+                                                   bitIndex % k_BITS_PER_WORD);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        BSLS_ASSERT_SAFE(k_BITS_PER_WORD == bitsPerElement
+                      || 0 == (values[i] >> bitsPerElement));
+
+        *word |= values[i] << offset;
+
+        offset += bitsPerElement;
+        if (offset >= k_BITS_PER_WORD) {
+            offset -= k_BITS_PER_WORD;
+            ++word;
+
+            if (offset) {
+                *word |= values[i] >> (bitsPerElement - offset);
+            }
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
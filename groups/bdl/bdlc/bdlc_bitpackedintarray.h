@@ -0,0 +1,849 @@
+// bdlc_bitpackedintarray.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLC_BITPACKEDINTARRAY
+#define INCLUDED_BDLC_BITPACKEDINTARRAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an array of integral values packed to the bit.
+//
+//@CLASSES:
+//  bdlc::BitPackedIntArray: array of integral values in a minimal bit width
+//
+//@SEE_ALSO: bdlc_packedintarray
+//
+//@DESCRIPTION: This component provides a space-efficient value-semantic
+// array, `bdlc::BitPackedIntArray`, of integral values.  Whereas
+// `bdlc::PackedIntArray` stores each element in 1, 2, 4, or 8 bytes, a
+// `bdlc::BitPackedIntArray` stores each element as its difference from the
+// least element of the array (the *frame of reference*) in the fewest bits,
+// from 0 to 64, that can represent the greatest such difference.  An array
+// holding values that are large but lie within a narrow range (e.g., time
+// stamps within one day, or prices in a trading session) therefore occupies
+// little more than `length() * bitsPerElement()` bits.
+//
+// Because the bit width of the elements depends on all of the values, a
+// `bdlc::BitPackedIntArray` is populated as a whole, either from a
+// `bdlc::PackedIntArray` or from an ordinary array of values, and does not
+// provide operations that modify individual elements.  Elements can be read
+// individually using `operator[]`, in ranges using `loadElements`, or all at
+// once into a `bdlc::PackedIntArray` using `unpack`.  The values are packed
+// and unpacked a word at a time, and the bulk operations of
+// `bdlc::PackedIntArray` are used to move values to and from a
+// `bdlc::PackedIntArray`.
+//
+// The template parameter `TYPE` must be one of the types supported by
+// `bdlc::PackedIntArray`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing Prices Quoted in Ticks
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the prices of a security, in ticks, during a trading
+// session.  The prices are large numbers, but stay within a narrow band.
+//
+// First, we record the prices in a `bdlc::PackedIntArray`:
+// ```
+// bdlc::PackedIntArray<int> prices;
+// for (int i = 0; i < 1000; ++i) {
+//     prices.append(1200000 + (i * 7919) % 1000);
+// }
+// assert(4 == prices.bytesPerElement());
+// ```
+// Notice that each price requires 4 bytes in the `bdlc::PackedIntArray`.
+//
+// Then, we create a `bdlc::BitPackedIntArray` holding the same values:
+// ```
+// bdlc::BitPackedIntArray<int> packed(prices);
+//
+// assert(   1000 == packed.length());
+// assert(1200000 == packed.frameOfReference());
+// assert(     10 == packed.bitsPerElement());
+// assert(prices[17] == packed[17]);
+// ```
+// Notice that each price now occupies 10 bits.
+//
+// Finally, we restore the prices into a `bdlc::PackedIntArray`:
+// ```
+// bdlc::PackedIntArray<int> restored;
+// packed.unpack(&restored);
+//
+// assert(prices == restored);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlc_packedintarray.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // =============================
+                       // struct BitPackedIntArray_Util
+                       // =============================
+
+/// This component-private `struct` provides a namespace for functions that
+/// store and load unsigned values of a fixed bit width, from 0 to 64, in a
+/// contiguous sequence of 64-bit words.  The value having index `i` occupies
+/// the bits `[i * bitsPerElement, (i + 1) * bitsPerElement)` of the
+/// sequence, where bit `b` of the sequence is bit `b % 64` of word `b / 64`.
+struct BitPackedIntArray_Util {
+
+    // PUBLIC CONSTANTS
+    enum { k_BITS_PER_WORD = 64 };  // number of bits in a word
+
+    // CLASS METHODS
+
+    /// Return the value having the specified `index` in the sequence of
+    /// values having the specified `bitsPerElement` stored in the specified
+    /// `words`.  The behavior is undefined unless
+    /// `0 <= bitsPerElement <= 64` and `words` holds the value.
+    static bsl::uint64_t get(const bsl::uint64_t *words,
+                             bsl::size_t          index,
+                             int                  bitsPerElement);
+
+    /// Load into the specified `result` array the specified `numElements`
+    /// values starting at the specified `index` in the sequence of values
+    /// having the specified `bitsPerElement` stored in the specified
+    /// `words`.  The behavior is undefined unless
+    /// `0 <= bitsPerElement <= 64`, `words` holds the values, and `result`
+    /// refers to an array of at least `numElements` elements.
+    static void load(bsl::uint64_t       *result,
+                     const bsl::uint64_t *words,
+                     bsl::size_t          index,
+                     bsl::size_t          numElements,
+                     int                  bitsPerElement);
+
+    /// Return the number of bits required to represent the specified
+    /// `value`, or 0 if `0 == value`.
+    static int numBitsRequired(bsl::uint64_t value);
+
+    /// Return the number of words required to store the specified
+    /// `numElements` values having the specified `bitsPerElement`.  The
+    /// behavior is undefined unless `0 <= bitsPerElement <= 64`.
+    static bsl::size_t numWords(bsl::size_t numElements, int bitsPerElement);
+
+    /// Store the specified `numValues` values of the specified `values`
+    /// array, starting at the specified `index`, into the sequence of
+    /// values having the specified `bitsPerElement` held in the specified
+    /// `words`.  The behavior is undefined unless
+    /// `0 <= bitsPerElement <= 64`, each of the values is representable in
+    /// `bitsPerElement` bits, `words` is large enough to hold the values,
+    /// and the bits of `words` to be occupied by the values are 0.
+    static void store(bsl::uint64_t       *words,
+                      bsl::size_t          index,
+                      const bsl::uint64_t *values,
+                      bsl::size_t          numValues,
+                      int                  bitsPerElement);
+};
+
+                         // =======================
+                         // class BitPackedIntArray
+                         // =======================
+
+/// This space-efficient value-semantic array class represents a sequence of
+/// `TYPE` elements, each stored as its difference from the least element in
+/// the fewest bits that can represent the greatest such difference.
+///
+/// This class:
+/// * supports a complete set of *value-semantic* operations
+///   - except for `bdex` serialization
+/// * is *exception-neutral*
+/// * is *alias-safe*
+/// * is `const` *thread-safe*
+/// For terminology see `bsldoc_glossary`.
+template <class TYPE>
+class BitPackedIntArray {
+
+    // PRIVATE TYPES
+    typedef typename PackedIntArray<TYPE>::sum_type ElementType;
+    typedef BitPackedIntArray_Util                  Util;
+
+    enum { k_CHUNK_SIZE = 256 };  // number of elements packed or unpacked
+                                  // at a time
+
+    // DATA
+    bsl::vector<bsl::uint64_t> d_words;             // packed differences
+                                                    // from the frame of
+                                                    // reference
+
+    bsl::size_t                d_length;            // number of elements
+
+    int                        d_bitsPerElement;    // bits per element, in
+                                                    // the range '[0 .. 64]'
+
+    TYPE                       d_frameOfReference;  // least element, or 0 if
+                                                    // the array is empty
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the value of the specified `value` converted to
+    /// `ElementType`, as a `bsl::uint64_t`.
+    static bsl::uint64_t toBits(TYPE value);
+
+    /// Store, starting at the specified `index`, the differences between
+    /// the specified `numValues` values of the specified `values` array and
+    /// the specified `frameOfReference`, each in the specified
+    /// `bitsPerElement` bits, in the specified `words`.  The behavior is
+    /// undefined unless each difference is representable in
+    /// `bitsPerElement` bits and `words` is large enough to hold the
+    /// differences.
+    static void packImp(bsl::uint64_t *words,
+                        bsl::size_t    index,
+                        const TYPE    *values,
+                        bsl::size_t    numValues,
+                        TYPE           frameOfReference,
+                        int            bitsPerElement);
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for all returns of element values.
+
+    // CREATORS
+
+    /// Create an empty `BitPackedIntArray`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+
+    /// Create a `BitPackedIntArray` having the same sequence of values as
+    /// the specified `values` array.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit BitPackedIntArray(
+                             const PackedIntArray<TYPE>&  values,
+                             bslma::Allocator            *basicAllocator = 0);
+
+    /// Create a `BitPackedIntArray` having the sequence of the specified
+    /// `numValues` values of the specified `values` array.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `values` refers to an array
+    /// of at least `numValues` elements.
+    BitPackedIntArray(const TYPE       *values,
+                      bsl::size_t       numValues,
+                      bslma::Allocator *basicAllocator = 0);
+
+    /// Create a `BitPackedIntArray` having the same value as the specified
+    /// `original` object.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    BitPackedIntArray(const BitPackedIntArray&  original,
+                      bslma::Allocator         *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~BitPackedIntArray();
+
+    // MANIPULATORS
+
+    /// Assign to this array the value of the specified `rhs` array, and
+    /// return a reference providing modifiable access to this array.
+    BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+
+    /// Assign to this array the sequence of values of the specified
+    /// `values` array.  If an exception is thrown, this array is left
+    /// unchanged.
+    void assign(const PackedIntArray<TYPE>& values);
+
+    /// Assign to this array the sequence of the specified `numValues`
+    /// values of the specified `values` array.  If an exception is thrown,
+    /// this array is left unchanged.  The behavior is undefined unless
+    /// `values` refers to an array of at least `numValues` elements.
+    void assign(const TYPE *values, bsl::size_t numValues);
+
+    /// Remove all the elements from this array.
+    void removeAll();
+
+    /// Efficiently exchange the value of this array with the value of the
+    /// specified `other` array.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// array was created with the same allocator as `other`.
+    void swap(BitPackedIntArray& other);
+
+    // ACCESSORS
+
+    /// Return the value of the element at the specified `index`.  The
+    /// behavior is undefined unless `index < length()`.
+    TYPE operator[](bsl::size_t index) const;
+
+    /// Return the allocator used by this array to supply memory.
+    bslma::Allocator *allocator() const;
+
+    /// Return the number of bits used to store each element of this array,
+    /// in the range `[0 .. 64]`.  Note that this is the number of bits
+    /// required to represent the difference between the greatest and the
+    /// least element.
+    int bitsPerElement() const;
+
+    /// Return the least element of this array, or 0 if this array is
+    /// empty.  Note that each element is stored as its difference from
+    /// this value.
+    TYPE frameOfReference() const;
+
+    /// Return `true` if there are no elements in this array, and `false`
+    /// otherwise.
+    bool isEmpty() const;
+
+    /// Return `true` if this and the specified `other` array have the same
+    /// value, and `false` otherwise.  Two `BitPackedIntArray` arrays have
+    /// the same value if they have the same length, and all the
+    /// corresponding elements have the same value.
+    bool isEqual(const BitPackedIntArray& other) const;
+
+    /// Return the number of elements in this array.
+    bsl::size_t length() const;
+
+    /// Load into the specified `result` array the values of the specified
+    /// `numElements` elements of this array starting at the specified
+    /// `index`.  The behavior is undefined unless
+    /// `index + numElements <= length()` and `result` refers to an array of
+    /// at least `numElements` elements.
+    void loadElements(TYPE        *result,
+                      bsl::size_t  index,
+                      bsl::size_t  numElements) const;
+
+    /// Write the value of this array to the specified output `stream` in a
+    /// human-readable format, and return a reference to `stream`.
+    /// Optionally specify an initial indentation `level`, whose absolute
+    /// value is incremented recursively for nested arrays.  If `level` is
+    /// specified, optionally specify `spacesPerLevel`, whose absolute value
+    /// indicates the number of spaces per indentation level for this and
+    /// all of its nested arrays.  If `level` is negative, format the entire
+    /// output on one line, suppressing all but the initial indentation (as
+    /// governed by `level`).  If `stream` is not valid on entry, this
+    /// operation has no effect.  Note that the format is not fully
+    /// specified, and can change without notice.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+
+    /// Assign to the specified `result` the sequence of values of this
+    /// array.
+    void unpack(PackedIntArray<TYPE> *result) const;
+};
+
+// FREE OPERATORS
+
+/// Write the value of the specified `array` to the specified output
+/// `stream` in a single-line format, and return a reference providing
+/// modifiable access to `stream`.  If `stream` is not valid on entry, this
+/// operation has no effect.  Note that this human-readable format is not
+/// fully specified and can change without notice.
+template <class TYPE>
+bsl::ostream& operator<<(bsl::ostream&                  stream,
+                         const BitPackedIntArray<TYPE>& array);
+
+/// Return `true` if the specified `lhs` and `rhs` arrays have the same
+/// value, and `false` otherwise.  Two `BitPackedIntArray` arrays have the
+/// same value if they have the same length, and all the corresponding
+/// elements have the same value.
+template <class TYPE>
+bool operator==(const BitPackedIntArray<TYPE>& lhs,
+                const BitPackedIntArray<TYPE>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` arrays do not have the
+/// same value, and `false` otherwise.  Two `BitPackedIntArray` arrays do
+/// not have the same value if they do not have the same length, or if any
+/// of the corresponding elements do not have the same value.
+template <class TYPE>
+bool operator!=(const BitPackedIntArray<TYPE>& lhs,
+                const BitPackedIntArray<TYPE>& rhs);
+
+// FREE FUNCTIONS
+
+/// Exchange the values of the specified `a` and `b` objects.  This function
+/// provides the no-throw exception-safety guarantee if the two objects were
+/// created with the same allocator and the basic guarantee otherwise.
+template <class TYPE>
+void swap(BitPackedIntArray<TYPE>& a, BitPackedIntArray<TYPE>& b);
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // struct BitPackedIntArray_Util
+                       // -----------------------------
+
+// CLASS METHODS
+inline
+bsl::uint64_t BitPackedIntArray_Util::get(const bsl::uint64_t *words,
+                                          bsl::size_t          index,
+                                          int                  bitsPerElement)
+{
+    BSLS_ASSERT(0 <= bitsPerElement);
+    BSLS_ASSERT(     bitsPerElement <= k_BITS_PER_WORD);
+
+    if (0 == bitsPerElement) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint64_t bitIndex  = static_cast<bsl::uint64_t>(index)
+                                                              * bitsPerElement;
+    const bsl::size_t   wordIndex = static_cast<bsl::size_t>(
+                                                   bitIndex / k_BITS_PER_WORD);
+    const int           offset    = static_cast<int>(
+                                                   bitIndex % k_BITS_PER_WORD);
+
+    bsl::uint64_t value = words[wordIndex] >> offset;
+    if (offset + bitsPerElement > k_BITS_PER_WORD) {
+        value |= words[wordIndex + 1] << (k_BITS_PER_WORD - offset);
+    }
+
+    return k_BITS_PER_WORD == bitsPerElement
+           ? value
+           : value & ((static_cast<bsl::uint64_t>(1) << bitsPerElement) - 1);
+}
+
+inline
+int BitPackedIntArray_Util::numBitsRequired(bsl::uint64_t value)
+{
+    return k_BITS_PER_WORD - bdlb::BitUtil::numLeadingUnsetBits(value);
+}
+
+inline
+bsl::size_t BitPackedIntArray_Util::numWords(bsl::size_t numElements,
+                                             int         bitsPerElement)
+{
+    BSLS_ASSERT(0 <= bitsPerElement);
+    BSLS_ASSERT(     bitsPerElement <= k_BITS_PER_WORD);
+
+    const bsl::uint64_t numBits = static_cast<bsl::uint64_t>(numElements)
+                                                              * bitsPerElement;
+
+    return static_cast<bsl::size_t>((numBits + k_BITS_PER_WORD - 1)
+                                                            / k_BITS_PER_WORD);
+}
+
+                         // -----------------------
+                         // class BitPackedIntArray
+                         // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+bsl::uint64_t BitPackedIntArray<TYPE>::toBits(TYPE value)
+{
+    return static_cast<bsl::uint64_t>(static_cast<ElementType>(value));
+}
+
+template <class TYPE>
+void BitPackedIntArray<TYPE>::packImp(bsl::uint64_t *words,
+                                      bsl::size_t    index,
+                                      const TYPE    *values,
+                                      bsl::size_t    numValues,
+                                      TYPE           frameOfReference,
+                                      int            bitsPerElement)
+{
+    const bsl::uint64_t base = toBits(frameOfReference);
+
+    bsl::uint64_t differences[k_CHUNK_SIZE];
+
+    while (0 < numValues) {
+        const bsl::size_t n = numValues < k_CHUNK_SIZE
+                            ? numValues
+                            : static_cast<bsl::size_t>(k_CHUNK_SIZE);
+
+        for (bsl::size_t i = 0; i < n; ++i) {
+            differences[i] = toBits(values[i]) - base;
+        }
+        Util::store(words, index, differences, n, bitsPerElement);
+
+        index     += n;
+        values    += n;
+        numValues -= n;
+    }
+}
+
+// CREATORS
+template <class TYPE>
+inline
+BitPackedIntArray<TYPE>::BitPackedIntArray(bslma::Allocator *basicAllocator)
+: d_words(basicAllocator)
+, d_length(0)
+, d_bitsPerElement(0)
+, d_frameOfReference(0)
+{
+}
+
+template <class TYPE>
+inline
+BitPackedIntArray<TYPE>::BitPackedIntArray(
+                                   const PackedIntArray<TYPE>&  values,
+                                   bslma::Allocator            *basicAllocator)
+: d_words(basicAllocator)
+, d_length(0)
+, d_bitsPerElement(0)
+, d_frameOfReference(0)
+{
+    assign(values);
+}
+
+template <class TYPE>
+inline
+BitPackedIntArray<TYPE>::BitPackedIntArray(const TYPE       *values,
+                                           bsl::size_t       numValues,
+                                           bslma::Allocator *basicAllocator)
+: d_words(basicAllocator)
+, d_length(0)
+, d_bitsPerElement(0)
+, d_frameOfReference(0)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    assign(values, numValues);
+}
+
+template <class TYPE>
+inline
+BitPackedIntArray<TYPE>::BitPackedIntArray(
+                                      const BitPackedIntArray&  original,
+                                      bslma::Allocator         *basicAllocator)
+: d_words(original.d_words, basicAllocator)
+, d_length(original.d_length)
+, d_bitsPerElement(original.d_bitsPerElement)
+, d_frameOfReference(original.d_frameOfReference)
+{
+}
+
+template <class TYPE>
+inline
+BitPackedIntArray<TYPE>::~BitPackedIntArray()
+{
+    BSLS_ASSERT(0 <= d_bitsPerElement);
+    BSLS_ASSERT(     d_bitsPerElement <= Util::k_BITS_PER_WORD);
+    BSLS_ASSERT(Util::numWords(d_length, d_bitsPerElement)
+                                                            == d_words.size());
+}
+
+// MANIPULATORS
+template <class TYPE>
+BitPackedIntArray<TYPE>&
+BitPackedIntArray<TYPE>::operator=(const BitPackedIntArray& rhs)
+{
+    if (this != &rhs) {
+        d_words            = rhs.d_words;
+        d_length           = rhs.d_length;
+        d_bitsPerElement   = rhs.d_bitsPerElement;
+        d_frameOfReference = rhs.d_frameOfReference;
+    }
+    return *this;
+}
+
+template <class TYPE>
+void BitPackedIntArray<TYPE>::assign(const PackedIntArray<TYPE>& values)
+{
+    const bsl::size_t length = values.length();
+
+    if (0 == length) {
+        removeAll();
+        return;                                                       // RETURN
+    }
+
+    const TYPE minValue = values.minElement();
+    const TYPE maxValue = values.maxElement();
+    const int  bitsPerElement = Util::numBitsRequired(toBits(maxValue)
+                                                          - toBits(minValue));
+
+    bsl::vector<bsl::uint64_t> words(Util::numWords(length, bitsPerElement),
+                                     0,
+                                     allocator());
+
+    TYPE buffer[k_CHUNK_SIZE];
+
+    for (bsl::size_t index = 0; index < length; index += k_CHUNK_SIZE) {
+        const bsl::size_t n = length - index < k_CHUNK_SIZE
+                            ? length - index
+                            : static_cast<bsl::size_t>(k_CHUNK_SIZE);
+
+        values.loadElements(buffer, index, n);
+        packImp(words.data(), index, buffer, n, minValue, bitsPerElement);
+    }
+
+    d_words.swap(words);
+    d_length           = length;
+    d_bitsPerElement   = bitsPerElement;
+    d_frameOfReference = minValue;
+}
+
+template <class TYPE>
+void BitPackedIntArray<TYPE>::assign(const TYPE  *values,
+                                     bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (0 == numValues) {
+        removeAll();
+        return;                                                       // RETURN
+    }
+
+    TYPE minValue = values[0];
+    TYPE maxValue = values[0];
+    for (bsl::size_t i = 1; i < numValues; ++i) {
+        minValue = values[i] < minValue ? values[i] : minValue;
+        maxValue = values[i] > maxValue ? values[i] : maxValue;
+    }
+
+    const int bitsPerElement = Util::numBitsRequired(toBits(maxValue)
+                                                          - toBits(minValue));
+
+    bsl::vector<bsl::uint64_t> words(Util::numWords(numValues,
+                                                    bitsPerElement),
+                                     0,
+                                     allocator());
+
+    packImp(words.data(), 0, values, numValues, minValue, bitsPerElement);
+
+    d_words.swap(words);
+    d_length           = numValues;
+    d_bitsPerElement   = bitsPerElement;
+    d_frameOfReference = minValue;
+}
+
+template <class TYPE>
+inline
+void BitPackedIntArray<TYPE>::removeAll()
+{
+    d_words.clear();
+    d_length           = 0;
+    d_bitsPerElement   = 0;
+    d_frameOfReference = 0;
+}
+
+template <class TYPE>
+inline
+void BitPackedIntArray<TYPE>::swap(BitPackedIntArray& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_words.swap(other.d_words);
+    bslalg::SwapUtil::swap(&d_length,           &other.d_length);
+    bslalg::SwapUtil::swap(&d_bitsPerElement,   &other.d_bitsPerElement);
+    bslalg::SwapUtil::swap(&d_frameOfReference, &other.d_frameOfReference);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+TYPE BitPackedIntArray<TYPE>::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_length);
+
+    const bsl::uint64_t difference = Util::get(d_words.data(),
+                                               index,
+                                               d_bitsPerElement);
+
+    return static_cast<TYPE>(static_cast<ElementType>(
+                                     toBits(d_frameOfReference) + difference));
+}
+
+template <class TYPE>
+inline
+bslma::Allocator *BitPackedIntArray<TYPE>::allocator() const
+{
+    return d_words.get_allocator().mechanism();
+}
+
+template <class TYPE>
+inline
+int BitPackedIntArray<TYPE>::bitsPerElement() const
+{
+    return d_bitsPerElement;
+}
+
+template <class TYPE>
+inline
+TYPE BitPackedIntArray<TYPE>::frameOfReference() const
+{
+    return d_frameOfReference;
+}
+
+template <class TYPE>
+inline
+bool BitPackedIntArray<TYPE>::isEmpty() const
+{
+    return 0 == d_length;
+}
+
+template <class TYPE>
+inline
+bool BitPackedIntArray<TYPE>::isEqual(const BitPackedIntArray& other) const
+{
+    // The frame of reference and the bit width are determined by the
+    // values, and unused bits are always 0, so equal arrays have identical
+    // representations.
+
+    return d_length           == other.d_length
+        && d_frameOfReference == other.d_frameOfReference
+        && d_bitsPerElement   == other.d_bitsPerElement
+        && d_words            == other.d_words;
+}
+
+template <class TYPE>
+inline
+bsl::size_t BitPackedIntArray<TYPE>::length() const
+{
+    return d_length;
+}
+
+template <class TYPE>
+void BitPackedIntArray<TYPE>::loadElements(TYPE        *result,
+                                           bsl::size_t  index,
+                                           bsl::size_t  numElements) const
+{
+    BSLS_ASSERT(result || 0 == numElements);
+
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT(numElements <= d_length);
+    BSLS_ASSERT(index       <= d_length - numElements);
+
+    const bsl::uint64_t base = toBits(d_frameOfReference);
+
+    bsl::uint64_t differences[k_CHUNK_SIZE];
+
+    while (0 < numElements) {
+        const bsl::size_t n = numElements < k_CHUNK_SIZE
+                            ? numElements
+                            : static_cast<bsl::size_t>(k_CHUNK_SIZE);
+
+        Util::load(differences, d_words.data(), index, n, d_bitsPerElement);
+        for (bsl::size_t i = 0; i < n; ++i) {
+            result[i] = static_cast<TYPE>(
+                              static_cast<ElementType>(base + differences[i]));
+        }
+
+        index       += n;
+        result      += n;
+        numElements -= n;
+    }
+}
+
+template <class TYPE>
+bsl::ostream& BitPackedIntArray<TYPE>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    for (bsl::size_t i = 0; i < d_length; ++i) {
+        printer.printValue(static_cast<ElementType>((*this)[i]));
+    }
+    printer.end();
+
+    return stream;
+}
+
+template <class TYPE>
+void BitPackedIntArray<TYPE>::unpack(PackedIntArray<TYPE> *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->removeAll();
+
+    TYPE buffer[k_CHUNK_SIZE];
+
+    for (bsl::size_t index = 0; index < d_length; index += k_CHUNK_SIZE) {
+        const bsl::size_t n = d_length - index < k_CHUNK_SIZE
+                            ? d_length - index
+                            : static_cast<bsl::size_t>(k_CHUNK_SIZE);
+
+        loadElements(buffer, index, n);
+        result->append(buffer, n);
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                  stream,
+                               const BitPackedIntArray<TYPE>& array)
+{
+    return array.print(stream, 0, -1);
+}
+
+template <class TYPE>
+inline
+bool bdlc::operator==(const BitPackedIntArray<TYPE>& lhs,
+                      const BitPackedIntArray<TYPE>& rhs)
+{
+    return lhs.isEqual(rhs);
+}
+
+template <class TYPE>
+inline
+bool bdlc::operator!=(const BitPackedIntArray<TYPE>& lhs,
+                      const BitPackedIntArray<TYPE>& rhs)
+{
+    return !lhs.isEqual(rhs);
+}
+
+// FREE FUNCTIONS
+template <class TYPE>
+void bdlc::swap(BitPackedIntArray<TYPE>& a, BitPackedIntArray<TYPE>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    BitPackedIntArray<TYPE> futureA(b, a.allocator());
+    BitPackedIntArray<TYPE> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// TRAITS
+
+namespace bslma {
+
+template <class TYPE>
+struct UsesBslmaAllocator<bdlc::BitPackedIntArray<TYPE> > : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1135 @@
+// bdlc_bitpackedintarray.t.cpp                                       -*-C++-*-
+#include <bdlc_bitpackedintarray.h>
+
+#include <bdlc_packedintarray.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a (value-semantic) array class whose
+// elements are stored at a bit width determined by the values, and a
+// component-private utility that stores and loads fixed-width values in a
+// sequence of words.  The utility is tested first, against a reference
+// implementation that sets one bit at a time.  The array is then tested
+// using arrays of values of every bit width, for signed and unsigned element
+// types of several sizes, with the element-at-a-time accessors serving as an
+// oracle for the bulk accessors.
+// ----------------------------------------------------------------------------
+// CLASS METHODS (BitPackedIntArray_Util)
+// [ 2] bsl::uint64_t get(const bsl::uint64_t *words, index, bits);
+// [ 2] void load(bsl::uint64_t *result, words, index, numElements, bits);
+// [ 2] int numBitsRequired(bsl::uint64_t value);
+// [ 2] bsl::size_t numWords(bsl::size_t numElements, int bitsPerElement);
+// [ 2] void store(bsl::uint64_t *words, index, values, numValues, bits);
+//
+// CREATORS
+// [ 3] BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+// [ 4] BitPackedIntArray(const PackedIntArray<TYPE>& values, *bA = 0);
+// [ 3] BitPackedIntArray(const TYPE *values, numValues, *bA = 0);
+// [ 5] BitPackedIntArray(const BitPackedIntArray& original, *bA = 0);
+// [ 3] ~BitPackedIntArray();
+//
+// MANIPULATORS
+// [ 5] BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+// [ 4] void assign(const PackedIntArray<TYPE>& values);
+// [ 3] void assign(const TYPE *values, bsl::size_t numValues);
+// [ 5] void removeAll();
+// [ 5] void swap(BitPackedIntArray& other);
+//
+// ACCESSORS
+// [ 3] TYPE operator[](bsl::size_t index) const;
+// [ 3] bslma::Allocator *allocator() const;
+// [ 3] int bitsPerElement() const;
+// [ 3] TYPE frameOfReference() const;
+// [ 3] bool isEmpty() const;
+// [ 5] bool isEqual(const BitPackedIntArray& other) const;
+// [ 3] bsl::size_t length() const;
+// [ 3] void loadElements(TYPE *result, index, numElements) const;
+// [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+// [ 4] void unpack(PackedIntArray<TYPE> *result) const;
+//
+// FREE OPERATORS
+// [ 5] ostream& operator<<(ostream& stream, const BitPackedIntArray& array);
+// [ 5] bool operator==(lhs, rhs);
+// [ 5] bool operator!=(lhs, rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(BitPackedIntArray& a, BitPackedIntArray& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BitPackedIntArray<bsl::int64_t>  Obj;
+typedef bsl::int64_t                           Element;
+typedef bdlc::PackedIntArray<bsl::int64_t>     PackedObj;
+
+typedef bdlc::BitPackedIntArray<bsl::uint64_t> UnsignedObj;
+typedef bsl::uint64_t                          UnsignedElement;
+
+typedef bdlc::BitPackedIntArray_Util           Util;
+
+const static bsl::int64_t k_INT64_MIN
+                                    = bsl::numeric_limits<bsl::int64_t>::min();
+const static bsl::int64_t k_INT64_MAX
+                                    = bsl::numeric_limits<bsl::int64_t>::max();
+
+const static bsl::uint64_t k_UINT64_MAX
+                                   = bsl::numeric_limits<bsl::uint64_t>::max();
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return the next value of the pseudo-random sequence having the specified
+/// `seed`, and update `seed`.
+static bsl::uint64_t nextRandom(bsl::uint64_t *seed)
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed ^ (*seed >> 29);
+}
+
+/// Return a value having the specified `bitsPerElement` low-order bits of
+/// the specified `value`, and the other bits 0.
+static bsl::uint64_t lowBits(bsl::uint64_t value, int bitsPerElement)
+{
+    return 64 == bitsPerElement
+           ? value
+           : value & ((static_cast<bsl::uint64_t>(1) << bitsPerElement) - 1);
+}
+
+/// Store the specified `value` in the specified `bitsPerElement` bits
+/// starting at bit `index * bitsPerElement` of the specified `words`, one
+/// bit at a time.
+static void oracleStore(bsl::vector<bsl::uint64_t> *words,
+                        bsl::size_t                 index,
+                        bsl::uint64_t               value,
+                        int                         bitsPerElement)
+{
+    for (int b = 0; b < bitsPerElement; ++b) {
+        const bsl::uint64_t bit = static_cast<bsl::uint64_t>(index)
+                                                            * bitsPerElement
+                                                                          + b;
+        if ((value >> b) & 1) {
+            (*words)[static_cast<bsl::size_t>(bit / 64)] |=
+                                   static_cast<bsl::uint64_t>(1) << (bit % 64);
+        }
+    }
+}
+
+/// Verify that an array created from the specified `numValues` values of
+/// the specified `values` array has those values, and attributes computed
+/// from them, and that `loadElements` agrees with `operator[]`.  Use the
+/// specified `line` to report failures.
+template <class TYPE>
+void verifyArray(int line, const TYPE *values, bsl::size_t numValues)
+{
+    typedef bdlc::BitPackedIntArray<TYPE> Array;
+
+    bslma::TestAllocator oa("object");
+
+    Array mX(values, numValues, &oa);  const Array& X = mX;
+
+    ASSERTV(line, numValues == X.length());
+    ASSERTV(line, (0 == numValues) == X.isEmpty());
+    ASSERTV(line, &oa == X.allocator());
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        ASSERTV(line, i, values[i] == X[i]);
+    }
+
+    if (0 == numValues) {
+        ASSERTV(line, 0 == X.bitsPerElement());
+        ASSERTV(line, 0 == X.frameOfReference());
+    }
+    else {
+        TYPE minValue = values[0];
+        TYPE maxValue = values[0];
+        for (bsl::size_t i = 1; i < numValues; ++i) {
+            minValue = values[i] < minValue ? values[i] : minValue;
+            maxValue = values[i] > maxValue ? values[i] : maxValue;
+        }
+
+        typedef typename bdlc::PackedIntArray<TYPE>::sum_type ElementType;
+
+        const bsl::uint64_t MAX = static_cast<bsl::uint64_t>(
+                                           static_cast<ElementType>(maxValue));
+        const bsl::uint64_t MIN = static_cast<bsl::uint64_t>(
+                                           static_cast<ElementType>(minValue));
+        const bsl::uint64_t RANGE = MAX - MIN;
+
+        int bits = 0;
+        while (bits < 64 && (RANGE >> bits)) {
+            ++bits;
+        }
+
+        ASSERTV(line, minValue == X.frameOfReference());
+        ASSERTV(line, bits, X.bitsPerElement(), bits == X.bitsPerElement());
+    }
+
+    // Verify `loadElements` over ranges straddling chunk and word
+    // boundaries, and that it writes no elements past the range.
+
+    bsl::vector<TYPE> result(numValues + 1);
+    for (bsl::size_t index = 0; index <= numValues; index += 1 + index * 3) {
+        for (bsl::size_t n = 0; n <= numValues - index; n += 1 + n * 3) {
+            result[n] = TYPE(7);
+            mX.loadElements(result.data(), index, n);
+            for (bsl::size_t i = 0; i < n; ++i) {
+                ASSERTV(line, index, i, X[index + i] == result[i]);
+            }
+            ASSERTV(line, index, n, TYPE(7) == result[n]);
+        }
+    }
+
+    // Verify `assign` produces the same value.
+
+    Array mY(&oa);  const Array& Y = mY;
+    mY.assign(values, numValues);
+    ASSERTV(line, X == Y);
+}
+
+/// Verify `BitPackedIntArray<TYPE>` using arrays of pseudo-random values
+/// spanning every bit width, based at the least, zero, and greatest values
+/// of `TYPE`.
+template <class TYPE>
+void testArrays()
+{
+    typedef typename bdlc::PackedIntArray<TYPE>::sum_type ElementType;
+
+    const bsl::size_t LENGTHS[] = { 0, 1, 2, 63, 64, 65, 255, 256, 257, 700 };
+    const int         NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                        / sizeof *LENGTHS);
+
+    const int BITS = static_cast<int>(sizeof(TYPE)) * 8;
+
+    bsl::uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+    for (int li = 0; li < NUM_LENGTHS; ++li) {
+        const bsl::size_t LENGTH = LENGTHS[li];
+
+        for (int bits = 0; bits <= BITS; ++bits) {
+            for (int bi = 0; bi < 3; ++bi) {
+                // Generate differences of at most `bits` bits from a base
+                // value, adding to the base, or subtracting from it, so that
+                // the values stay within `TYPE`.
+
+                const TYPE BASE = 0 == bi
+                                  ? bsl::numeric_limits<TYPE>::min()
+                                  : 1 == bi
+                                  ? TYPE(0)
+                                  : bsl::numeric_limits<TYPE>::max();
+
+                const bool SUBTRACT = 2 == bi;
+
+                const bsl::uint64_t LIMIT = 1 == bi && BITS == bits
+                          ? static_cast<bsl::uint64_t>(
+                                             bsl::numeric_limits<TYPE>::max())
+                          : 64 == bits
+                          ? k_UINT64_MAX
+                          : (static_cast<bsl::uint64_t>(1) << bits) - 1;
+
+                bsl::vector<TYPE> values;
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    bsl::uint64_t delta = nextRandom(&seed);
+                    if (LIMIT != k_UINT64_MAX) {
+                        delta %= LIMIT + 1;
+                    }
+
+                    const bsl::uint64_t base = static_cast<bsl::uint64_t>(
+                                               static_cast<ElementType>(BASE));
+
+                    const bsl::uint64_t value = SUBTRACT ? base - delta
+                                                         : base + delta;
+
+                    values.push_back(static_cast<TYPE>(
+                                            static_cast<ElementType>(value)));
+                }
+
+                verifyArray(L_, values.data(), LENGTH);
+            }
+        }
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing Prices Quoted in Ticks
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the prices of a security, in ticks, during a trading
+// session.  The prices are large numbers, but stay within a narrow band.
+//
+// First, we record the prices in a `bdlc::PackedIntArray`:
+// ```
+    bdlc::PackedIntArray<int> prices;
+    for (int i = 0; i < 1000; ++i) {
+        prices.append(1200000 + (i * 7919) % 1000);
+    }
+    ASSERT(4 == prices.bytesPerElement());
+// ```
+// Notice that each price requires 4 bytes in the `bdlc::PackedIntArray`.
+//
+// Then, we create a `bdlc::BitPackedIntArray` holding the same values:
+// ```
+    bdlc::BitPackedIntArray<int> packed(prices);
+
+    ASSERT(   1000 == packed.length());
+    ASSERT(1200000 == packed.frameOfReference());
+    ASSERT(     10 == packed.bitsPerElement());
+    ASSERT(prices[17] == packed[17]);
+// ```
+// Notice that each price now occupies 10 bits.
+//
+// Finally, we restore the prices into a `bdlc::PackedIntArray`:
+// ```
+    bdlc::PackedIntArray<int> restored;
+    packed.unpack(&restored);
+
+    ASSERT(prices == restored);
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALUE-SEMANTIC OPERATIONS
+        //   Ensure that equality, copying, assignment, swap, and printing
+        //   operate as expected.
+        //
+        // Concerns:
+        // 1. Two arrays compare equal if and only if they have the same
+        //    sequence of values, regardless of how they were populated.
+        //
+        // 2. A copy has the value of the original, and uses the supplied
+        //    allocator (or the default allocator).
+        //
+        // 3. Assignment, including self-assignment, gives the target the
+        //    value of the source.
+        //
+        // 4. `removeAll` makes an array equal to a default-constructed one.
+        //
+        // 5. The member `swap` exchanges values, and the free `swap` works
+        //    for arrays using different allocators.
+        //
+        // 6. `print` and `operator<<` format the values of the elements.
+        //
+        // 7. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Create arrays from a set of value sequences, and verify that
+        //    the arrays compare equal only to arrays created from the same
+        //    sequence.  (C-1)
+        //
+        // 2. For each array, create copies using a test allocator and the
+        //    default allocator, assign copies, and verify their values and
+        //    allocators.  (C-2..3)
+        //
+        // 3. Remove all the elements of a copy and compare it with an empty
+        //    array.  (C-4)
+        //
+        // 4. Swap pairs of arrays using the member and free `swap`
+        //    functions, and verify the results.  (C-5)
+        //
+        // 5. Print an array on one line and on multiple lines, and compare
+        //    with the expected output.  (C-6)
+        //
+        // 6. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments (using the `BSLS_ASSERTTEST_*`
+        //    macros).  (C-7)
+        //
+        // Testing:
+        //   BitPackedIntArray(const BitPackedIntArray& original, *bA = 0);
+        //   BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+        //   void removeAll();
+        //   void swap(BitPackedIntArray& other);
+        //   bool isEqual(const BitPackedIntArray& other) const;
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream& stream, const BitPackedIntArray& a);
+        //   bool operator==(lhs, rhs);
+        //   bool operator!=(lhs, rhs);
+        //   void swap(BitPackedIntArray& a, BitPackedIntArray& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE-SEMANTIC OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        static const Element V0[] = { 0 };
+        static const Element V1[] = { 0, 0, 0 };
+        static const Element V2[] = { 5, 6, 7 };
+        static const Element V3[] = { 5, 6, 8 };
+        static const Element V4[] = { 5, 6, 7, 8 };
+        static const Element V5[] = { k_INT64_MIN, 0, k_INT64_MAX };
+        static const Element V6[] = { k_INT64_MIN, 1, k_INT64_MAX };
+
+        static const struct {
+            int            d_line;
+            const Element *d_values_p;
+            bsl::size_t    d_numValues;
+        } DATA[] = {
+            { L_, V0, 0 },
+            { L_, V0, 1 },
+            { L_, V1, 3 },
+            { L_, V2, 3 },
+            { L_, V3, 3 },
+            { L_, V4, 4 },
+            { L_, V5, 3 },
+            { L_, V6, 3 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE1 = DATA[ti].d_line;
+
+            Obj mX(DATA[ti].d_values_p, DATA[ti].d_numValues, &oa);
+            const Obj& X = mX;
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int LINE2 = DATA[tj].d_line;
+
+                Obj mY(DATA[tj].d_values_p, DATA[tj].d_numValues, &za);
+                const Obj& Y = mY;
+
+                ASSERTV(LINE1, LINE2, (ti == tj) == (X == Y));
+                ASSERTV(LINE1, LINE2, (ti != tj) == (X != Y));
+                ASSERTV(LINE1, LINE2, (ti == tj) == X.isEqual(Y));
+
+                // Assignment.
+
+                Obj mZ(DATA[tj].d_values_p, DATA[tj].d_numValues, &za);
+                const Obj& Z = mZ;
+
+                Obj *mR = &(mZ = X);
+                ASSERTV(LINE1, LINE2, mR == &mZ);
+                ASSERTV(LINE1, LINE2, X == Z);
+                ASSERTV(LINE1, LINE2, &za == Z.allocator());
+
+                // Member `swap`.
+
+                Obj mW(DATA[tj].d_values_p, DATA[tj].d_numValues, &za);
+                const Obj& W = mW;
+
+                mZ.swap(mW);
+                ASSERTV(LINE1, LINE2, Y == Z);
+                ASSERTV(LINE1, LINE2, X == W);
+
+                // Free `swap` with different allocators.
+
+                Obj mV(X, &oa);  const Obj& V = mV;
+
+                swap(mV, mZ);
+                ASSERTV(LINE1, LINE2, Y == V);
+                ASSERTV(LINE1, LINE2, X == Z);
+                ASSERTV(LINE1, LINE2, &oa == V.allocator());
+                ASSERTV(LINE1, LINE2, &za == Z.allocator());
+            }
+
+            // Copy construction.
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+                ASSERTV(LINE1, X == Y);
+                ASSERTV(LINE1, &za == Y.allocator());
+            }
+            {
+                bslma::DefaultAllocatorGuard dag(&za);
+
+                Obj mY(X);  const Obj& Y = mY;
+                ASSERTV(LINE1, X == Y);
+                ASSERTV(LINE1, &za == Y.allocator());
+            }
+
+            // Self-assignment.
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                const Obj& Z = Y;
+
+                mY = Z;
+                ASSERTV(LINE1, X == Y);
+            }
+
+            // `removeAll`.
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+
+                mY.removeAll();
+                ASSERTV(LINE1, Obj() == Y);
+                ASSERTV(LINE1, 0 == Y.length());
+                ASSERTV(LINE1, 0 == Y.bitsPerElement());
+                ASSERTV(LINE1, 0 == Y.frameOfReference());
+            }
+        }
+
+        if (verbose) cout << "\nTesting `print` and `operator<<`." << endl;
+        {
+            const Element VALUES[] = { -1, 2, 3 };
+
+            Obj mX(VALUES, 3, &oa);  const Obj& X = mX;
+
+            bsl::ostringstream one;
+            one << X;
+            ASSERTV(one.str(), "[ -1 2 3 ]" == one.str());
+
+            bsl::ostringstream many;
+            X.print(many, 1, 2);
+            ASSERTV(many.str(), "  [\n    -1\n    2\n    3\n  ]\n"
+                                                                == many.str());
+
+            bsl::ostringstream bad;
+            bad.setstate(bsl::ios::badbit);
+            X.print(bad);
+            ASSERT("" == bad.str());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONVERSION TO AND FROM `PackedIntArray`
+        //   Ensure that arrays can be populated from, and unpacked into,
+        //   `bdlc::PackedIntArray` objects.
+        //
+        // Concerns:
+        // 1. An array created from, or assigned from, a `PackedIntArray` has
+        //    the values of the `PackedIntArray`, independent of its storage
+        //    size.
+        //
+        // 2. `unpack` replaces the contents of the target with the values of
+        //    the array.
+        //
+        // 3. Creating, assigning, and unpacking uses only the supplied
+        //    allocators.
+        //
+        // Plan:
+        // 1. For a set of lengths spanning several chunks, and a set of
+        //    value ranges, create a `PackedIntArray`, create and assign
+        //    `BitPackedIntArray` objects from it, and compare them with an
+        //    array created from the same values held in an ordinary array.
+        //    (C-1)
+        //
+        // 2. Unpack each array into a non-empty `PackedIntArray`, and verify
+        //    the result is equal to the original `PackedIntArray`.  (C-2)
+        //
+        // 3. Verify the default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   BitPackedIntArray(const PackedIntArray<TYPE>& values, *bA = 0);
+        //   void assign(const PackedIntArray<TYPE>& values);
+        //   void unpack(PackedIntArray<TYPE> *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONVERSION TO AND FROM `PackedIntArray`" << endl
+                          << "=======================================" << endl;
+
+        const bsl::size_t LENGTHS[]   = { 0, 1, 255, 256, 257, 1000 };
+        const int         NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                            / sizeof *LENGTHS);
+
+        const Element BASES[]  = { 0, -100, 1000000, k_INT64_MIN };
+        const Element RANGES[] = { 1, 100, 70000, k_INT64_MAX };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::uint64_t seed = 17;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li];
+
+            for (int bi = 0; bi < 4; ++bi) {
+                for (int ri = 0; ri < 4; ++ri) {
+                    bsl::vector<Element> values(&oa);
+                    PackedObj            mP(&oa);  const PackedObj& P = mP;
+
+                    for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                        const Element VALUE = static_cast<Element>(
+                                     static_cast<bsl::uint64_t>(BASES[bi])
+                                     + nextRandom(&seed)
+                                       % static_cast<bsl::uint64_t>(
+                                                                 RANGES[ri]));
+                        values.push_back(VALUE);
+                        mP.append(VALUE);
+                    }
+
+                    const Obj EXP(values.data(), LENGTH, &oa);
+
+                    Obj mX(P, &oa);  const Obj& X = mX;
+                    ASSERTV(LENGTH, bi, ri, EXP == X);
+
+                    Obj mY(EXP, &oa);  const Obj& Y = mY;
+                    mY.removeAll();
+                    mY.assign(P);
+                    ASSERTV(LENGTH, bi, ri, EXP == Y);
+
+                    PackedObj mQ(5, 1, &oa);  const PackedObj& Q = mQ;
+                    X.unpack(&mQ);
+                    ASSERTV(LENGTH, bi, ri, P == Q);
+                }
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTION FROM VALUES AND BASIC ACCESSORS
+        //   Ensure that an array created from a sequence of values holds
+        //   those values at the minimal bit width.
+        //
+        // Concerns:
+        // 1. An array created from an ordinary array of values holds the
+        //    values, in order, for every bit width from 0 to the size of
+        //    `TYPE`, and for values at either extreme of `TYPE`.
+        //
+        // 2. `frameOfReference` is the least value, and `bitsPerElement` is
+        //    the number of bits required by the difference between the
+        //    greatest and the least value.
+        //
+        // 3. `loadElements` agrees with `operator[]` for every range, and
+        //    writes no elements past the range.
+        //
+        // 4. `assign` produces the same value as construction.
+        //
+        // 5. The array supports signed and unsigned `TYPE` of every size.
+        //
+        // 6. The array uses the supplied allocator.
+        //
+        // 7. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For `bsl::int64_t`, `bsl::uint64_t`, `int`, `unsigned short`,
+        //    and `signed char`, for a set of lengths, for every bit width,
+        //    generate pseudo-random values differing by at most that many
+        //    bits from the least, zero, and greatest value of `TYPE`, and
+        //    verify the resulting array against the values.  (C-1..6)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments (using the `BSLS_ASSERTTEST_*`
+        //    macros).  (C-7)
+        //
+        // Testing:
+        //   BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+        //   BitPackedIntArray(const TYPE *values, numValues, *bA = 0);
+        //   ~BitPackedIntArray();
+        //   void assign(const TYPE *values, bsl::size_t numValues);
+        //   TYPE operator[](bsl::size_t index) const;
+        //   bslma::Allocator *allocator() const;
+        //   int bitsPerElement() const;
+        //   TYPE frameOfReference() const;
+        //   bool isEmpty() const;
+        //   bsl::size_t length() const;
+        //   void loadElements(TYPE *result, index, numElements) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTION FROM VALUES AND BASIC ACCESSORS"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        if (verbose) cout << "\nTesting `bsl::int64_t`." << endl;
+        testArrays<bsl::int64_t>();
+
+        if (verbose) cout << "\nTesting `bsl::uint64_t`." << endl;
+        testArrays<bsl::uint64_t>();
+
+        if (verbose) cout << "\nTesting `int`." << endl;
+        testArrays<int>();
+
+        if (verbose) cout << "\nTesting `unsigned short`." << endl;
+        testArrays<unsigned short>();
+
+        if (verbose) cout << "\nTesting `signed char`." << endl;
+        testArrays<signed char>();
+
+        if (verbose) cout << "\nTesting the default allocator." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            const UnsignedElement VALUES[] = { 0, k_UINT64_MAX };
+
+            const UnsignedObj X(VALUES, 2);
+            ASSERT(&da == X.allocator());
+            ASSERT(  64 == X.bitsPerElement());
+            ASSERT(   0 == X[0]);
+            ASSERT(k_UINT64_MAX == X[1]);
+            ASSERT(0 < da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Element VALUES[] = { 1, 2, 3 };
+
+            Obj mX(VALUES, 3);  const Obj& X = mX;
+
+            ASSERT_PASS(X[2]);
+            ASSERT_FAIL(X[3]);
+
+            Element result[3];
+
+            ASSERT_PASS(X.loadElements(result, 0, 3));
+            ASSERT_PASS(X.loadElements(result, 3, 0));
+            ASSERT_FAIL(X.loadElements(result, 1, 3));
+            ASSERT_FAIL(X.loadElements(result, 4, 0));
+            ASSERT_FAIL(X.loadElements(0, 0, 1));
+
+            ASSERT_PASS(mX.assign(VALUES, 0));
+            ASSERT_PASS(mX.assign(0, 0));
+            ASSERT_FAIL(mX.assign(0, 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `BitPackedIntArray_Util`
+        //   Ensure that the utility stores and loads values of every bit
+        //   width at every position.
+        //
+        // Concerns:
+        // 1. `numBitsRequired` returns the position of the highest set bit
+        //    plus one, and 0 for 0.
+        //
+        // 2. `numWords` returns the number of words needed for the bits of
+        //    all the elements, without overflow for large lengths.
+        //
+        // 3. `store` sets exactly the bits of the stored values, for every
+        //    bit width from 0 to 64, starting at any index, including values
+        //    spanning two words.
+        //
+        // 4. `get` and `load` return the stored values, and `load` works
+        //    from any starting index.
+        //
+        // 5. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Verify `numBitsRequired` for 0 and for each power of 2 and its
+        //    predecessor.  (C-1)
+        //
+        // 2. Verify `numWords` for a table of lengths and widths.  (C-2)
+        //
+        // 3. For every bit width, store pseudo-random values in groups
+        //    starting at a variety of indices, and compare the words with
+        //    those produced by setting one bit at a time.  (C-3)
+        //
+        // 4. Load the values using `get` for each index, and using `load`
+        //    for a variety of ranges.  (C-4)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments (using the `BSLS_ASSERTTEST_*`
+        //    macros).  (C-5)
+        //
+        // Testing:
+        //   bsl::uint64_t get(const bsl::uint64_t *words, index, bits);
+        //   void load(bsl::uint64_t *result, words, index, numElements, bits);
+        //   int numBitsRequired(bsl::uint64_t value);
+        //   bsl::size_t numWords(bsl::size_t numElements, int bitsPerElement);
+        //   void store(bsl::uint64_t *words, index, values, numValues, bits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `BitPackedIntArray_Util`" << endl
+                          << "================================" << endl;
+
+        if (verbose) cout << "\nTesting `numBitsRequired`." << endl;
+        {
+            ASSERT(0 == Util::numBitsRequired(0));
+            ASSERT(64 == Util::numBitsRequired(k_UINT64_MAX));
+
+            for (int b = 0; b < 64; ++b) {
+                const bsl::uint64_t VALUE = static_cast<bsl::uint64_t>(1) << b;
+
+                ASSERTV(b, b + 1 == Util::numBitsRequired(VALUE));
+                ASSERTV(b, b     == Util::numBitsRequired(VALUE - 1));
+            }
+        }
+
+        if (verbose) cout << "\nTesting `numWords`." << endl;
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_numElements;
+                int         d_bitsPerElement;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                //LINE  NUM ELEMENTS  BITS  EXP
+                //----  ------------  ----  ---
+                { L_,              0,    0,   0 },
+                { L_,              0,   64,   0 },
+                { L_,           1000,    0,   0 },
+                { L_,              1,    1,   1 },
+                { L_,             64,    1,   1 },
+                { L_,             65,    1,   2 },
+                { L_,              3,   21,   1 },
+                { L_,              4,   21,   2 },
+                { L_,             64,    7,   7 },
+                { L_,             10,   64,  10 },
+                { L_,             11,   63,  11 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const bsl::size_t N    = DATA[ti].d_numElements;
+                const int         BITS = DATA[ti].d_bitsPerElement;
+                const bsl::size_t EXP  = DATA[ti].d_expected;
+
+                ASSERTV(LINE, EXP == Util::numWords(N, BITS));
+            }
+        }
+
+        if (verbose) cout << "\nTesting `store`, `get`, and `load`." << endl;
+        {
+            const bsl::size_t NUM_VALUES = 200;
+
+            bsl::uint64_t seed = 1;
+
+            for (int bits = 0; bits <= 64; ++bits) {
+                bsl::vector<bsl::uint64_t> values;
+                for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                    values.push_back(lowBits(nextRandom(&seed), bits));
+                }
+
+                const bsl::size_t NUM_WORDS = Util::numWords(NUM_VALUES,
+                                                             bits);
+
+                bsl::vector<bsl::uint64_t> expected(NUM_WORDS, 0);
+                for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                    oracleStore(&expected, i, values[i], bits);
+                }
+
+                // Store the values in groups of varying sizes.
+
+                bsl::vector<bsl::uint64_t> words(NUM_WORDS, 0);
+                for (bsl::size_t index = 0, n = 0;
+                     index < NUM_VALUES;
+                     index += n) {
+                    n = 1 + (index * 7) % 13;
+                    if (n > NUM_VALUES - index) {
+                        n = NUM_VALUES - index;
+                    }
+                    Util::store(words.data(),
+                                index,
+                                values.data() + index,
+                                n,
+                                bits);
+                }
+                ASSERTV(bits, expected == words);
+
+                for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                    ASSERTV(bits,
+                            i,
+                            values[i] == Util::get(words.data(), i, bits));
+                }
+
+                bsl::vector<bsl::uint64_t> result(NUM_VALUES + 1);
+                for (bsl::size_t index = 0;
+                     index <= NUM_VALUES;
+                     index += 1 + index / 2) {
+                    const bsl::size_t N = NUM_VALUES - index;
+
+                    result[N] = 7;
+                    Util::load(result.data(), words.data(), index, N, bits);
+                    for (bsl::size_t i = 0; i < N; ++i) {
+                        ASSERTV(bits,
+                                index,
+                                i,
+                                values[index + i] == result[i]);
+                    }
+                    ASSERTV(bits, index, 7 == result[N]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::uint64_t       words[2]  = { 0, 0 };
+            bsl::uint64_t       result[2];
+            const bsl::uint64_t values[2] = { 1, 2 };
+
+            ASSERT_PASS(Util::get(words, 0, 0));
+            ASSERT_PASS(Util::get(words, 0, 64));
+            ASSERT_FAIL(Util::get(words, 0, -1));
+            ASSERT_FAIL(Util::get(words, 0, 65));
+
+            ASSERT_PASS(Util::numWords(1, 64));
+            ASSERT_FAIL(Util::numWords(1, 65));
+
+            ASSERT_PASS(Util::load(result, words, 0, 2, 2));
+            ASSERT_FAIL(Util::load(result, words, 0, 2, 65));
+            ASSERT_FAIL(Util::load(0,      words, 0, 2, 2));
+
+            ASSERT_PASS(Util::store(words, 0, values, 2, 2));
+            ASSERT_FAIL(Util::store(words, 0, values, 2, 65));
+            ASSERT_FAIL(Util::store(words, 0, 0,      2, 2));
+            ASSERT_SAFE_FAIL(Util::store(words, 0, values, 2, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create an object `w` (default ctor).       { w:D             }
+        // 2. Create an object `x` (copy from `w`).      { w:D x:D         }
+        // 3. Set `x` to `A` (value distinct from `D`).  { w:D x:A         }
+        // 4. Create an object `y` (init. to `A`).       { w:D x:A y:A     }
+        // 5. Create an object `z` (copy from `y`).      { w:D x:A y:A z:A }
+        // 6. Set `z` to `D` (the default value).        { w:D x:A y:A z:D }
+        // 7. Assign `w` from `x`.                       { w:A x:A y:A z:D }
+        // 8. Assign `w` from `z`.                       { w:D x:A y:A z:D }
+        // 9. Assign `x` from `x` (aliasing).            { w:D x:A y:A z:D }
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator testAllocator("test", veryVeryVeryVerbose);
+
+        const Element VA[] = { 100, 103, 101, 100, 107 };
+
+        if (verbose) cout << "\n 1) Create an object w (default ctor)."
+                          << endl;
+        Obj mW(&testAllocator);  const Obj& W = mW;
+        ASSERT(0 == W.length());
+        ASSERT(W.isEmpty());
+
+        if (verbose) cout << "\n 2) Create an object x (copy from w)." << endl;
+        Obj mX(W, &testAllocator);  const Obj& X = mX;
+        ASSERT(0 == X.length());
+        ASSERT(W == X);
+
+        if (verbose) cout << "\n 3) Set x to A." << endl;
+        mX.assign(VA, 5);
+        ASSERT(5 == X.length());
+        ASSERT(100 == X.frameOfReference());
+        ASSERT(3 == X.bitsPerElement());
+        ASSERT(100 == X[0]);  ASSERT(103 == X[1]);  ASSERT(101 == X[2]);
+        ASSERT(100 == X[3]);  ASSERT(107 == X[4]);
+        ASSERT(W != X);
+
+        if (verbose) cout << "\n 4) Create an object y (init. to A)." << endl;
+        Obj mY(VA, 5, &testAllocator);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        if (verbose) cout << "\n 5) Create an object z (copy from y)." << endl;
+        Obj mZ(Y, &testAllocator);  const Obj& Z = mZ;
+        ASSERT(Y == Z);
+
+        if (verbose) cout << "\n 6) Set z to D." << endl;
+        mZ.removeAll();
+        ASSERT(W == Z);
+
+        if (verbose) cout << "\n 7) Assign w from x." << endl;
+        mW = X;
+        ASSERT(X == W);
+
+        if (verbose) cout << "\n 8) Assign w from z." << endl;
+        mW = Z;
+        ASSERT(Z == W);
+
+        if (verbose) cout << "\n 9) Assign x from x (aliasing)." << endl;
+        mX = X;
+        ASSERT(Y == X);
+
+        if (verbose) cout << "\n10) Unpack x." << endl;
+        PackedObj mP(&testAllocator);  const PackedObj& P = mP;
+        X.unpack(&mP);
+        ASSERT(5 == P.length());
+        ASSERT(X == Obj(P, &testAllocator));
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      } break;
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus
+                  << "." << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
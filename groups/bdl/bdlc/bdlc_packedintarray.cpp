@@ -18,6 +18,55 @@ BSLS_IDENT_RCSID(bdlc_packedintarray,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bdlc {
 
+/// Return the number of bytes per element required by the (template
+/// parameter) `STORAGE` type to store the specified `numElements` elements
+/// of the specified `values` array, or the specified `maxBytesPerElement`
+/// if any element requires that many.  Note that the scan stops as soon as
+/// `maxBytesPerElement` is known to be required.
+template <class STORAGE, class TYPE>
+static
+int requiredBytesPerElementImp(const TYPE  *values,
+                               bsl::size_t  numElements,
+                               int          maxBytesPerElement)
+{
+    typedef typename STORAGE::EightByteStorageType ElementType;
+
+    // Scan the elements a few blocks at a time so that the scan can stop
+    // early without testing each element individually.
+
+    enum { k_SCAN_SIZE = 32 * PackedIntArrayImp_Util::k_BLOCK_SIZE };
+
+    int requiredBytesPerElement = 1;
+    while (0 < numElements) {
+        const bsl::size_t n = numElements < k_SCAN_SIZE
+                            ? numElements
+                            : static_cast<bsl::size_t>(k_SCAN_SIZE);
+
+        TYPE minValue;
+        TYPE maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue, &maxValue, values, n);
+
+        const int minRbpe = STORAGE::requiredBytesPerElement(
+                                           static_cast<ElementType>(minValue));
+        const int maxRbpe = STORAGE::requiredBytesPerElement(
+                                           static_cast<ElementType>(maxValue));
+
+        if (requiredBytesPerElement < minRbpe) {
+            requiredBytesPerElement = minRbpe;
+        }
+        if (requiredBytesPerElement < maxRbpe) {
+            requiredBytesPerElement = maxRbpe;
+        }
+        if (requiredBytesPerElement >= maxBytesPerElement) {
+            return maxBytesPerElement;                                // RETURN
+        }
+
+        values      += n;
+        numElements -= n;
+    }
+    return requiredBytesPerElement;
+}
+
                       // -------------------------------
                       // struct PackedIntArrayImp_Signed
                       // -------------------------------
@@ -114,6 +163,46 @@ void PackedIntArrayImp<STORAGE>::expandImp(int         requiredBytesPerElement,
     d_allocator_p->deallocate(src);
 }
 
+template <class STORAGE>
+void PackedIntArrayImp<STORAGE>::prepareImp(
+                                           int         requiredBytesPerElement,
+                                           bsl::size_t newLength)
+{
+    BSLS_ASSERT(newLength >= d_length);
+
+    if (d_bytesPerElement >= requiredBytesPerElement) {
+        // Test for potential overflow.
+        BSLS_ASSERT(k_MAX_CAPACITY / d_bytesPerElement >= newLength);
+
+        bsl::size_t requiredCapacityInBytes = d_bytesPerElement * newLength;
+        if (requiredCapacityInBytes > d_capacityInBytes) {
+            reserveCapacityImp(requiredCapacityInBytes);
+        }
+    }
+    else {
+        // Test for potential overflow.
+        BSLS_ASSERT(k_MAX_CAPACITY / requiredBytesPerElement >= newLength);
+
+        bsl::size_t requiredCapacityInBytes =
+                                           requiredBytesPerElement * newLength;
+
+        if (requiredCapacityInBytes > d_capacityInBytes) {
+            expandImp(requiredBytesPerElement, requiredCapacityInBytes);
+        }
+        else {
+            int srcBytesPerElement = d_bytesPerElement;
+            d_bytesPerElement = requiredBytesPerElement;
+            replaceImp(d_storage_p,
+                       0,
+                       d_bytesPerElement,
+                       d_storage_p,
+                       0,
+                       srcBytesPerElement,
+                       d_length);
+        }
+    }
+}
+
 template <class STORAGE>
 void PackedIntArrayImp<STORAGE>::replaceImp(bsl::size_t dstIndex,
                                             ElementType value)
@@ -194,31 +283,19 @@ void PackedIntArrayImp<STORAGE>::replaceImp(void        *dst,
             typename STORAGE::TwoByteStorageType *s =
                       static_cast<typename STORAGE::TwoByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::OneByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 4: {
             typename STORAGE::FourByteStorageType *s =
                      static_cast<typename STORAGE::FourByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::OneByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 8: {
             typename STORAGE::EightByteStorageType *s =
                     static_cast<typename STORAGE::EightByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::OneByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -237,31 +314,19 @@ void PackedIntArrayImp<STORAGE>::replaceImp(void        *dst,
             typename STORAGE::OneByteStorageType *s =
                       static_cast<typename STORAGE::OneByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::TwoByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 4: {
             typename STORAGE::FourByteStorageType *s =
                      static_cast<typename STORAGE::FourByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::TwoByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 8: {
             typename STORAGE::EightByteStorageType *s =
                     static_cast<typename STORAGE::EightByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d = static_cast<typename STORAGE::TwoByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -280,34 +345,19 @@ void PackedIntArrayImp<STORAGE>::replaceImp(void        *dst,
             typename STORAGE::OneByteStorageType *s =
                       static_cast<typename STORAGE::OneByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                      static_cast<typename STORAGE::FourByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 2: {
             typename STORAGE::TwoByteStorageType *s =
                       static_cast<typename STORAGE::TwoByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                      static_cast<typename STORAGE::FourByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 8: {
             typename STORAGE::EightByteStorageType *s =
                     static_cast<typename STORAGE::EightByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                      static_cast<typename STORAGE::FourByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -326,34 +376,19 @@ void PackedIntArrayImp<STORAGE>::replaceImp(void        *dst,
             typename STORAGE::OneByteStorageType *s =
                       static_cast<typename STORAGE::OneByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                     static_cast<typename STORAGE::EightByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 2: {
             typename STORAGE::TwoByteStorageType *s =
                       static_cast<typename STORAGE::TwoByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                     static_cast<typename STORAGE::EightByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           case 4: {
             typename STORAGE::FourByteStorageType *s =
                      static_cast<typename STORAGE::FourByteStorageType *>(src);
             s += srcIndex;
-            s += numElements;
-            d += numElements;
-            for (bsl::size_t i = 0; i < numElements; ++i) {
-                *--d =
-                     static_cast<typename STORAGE::EightByteStorageType>(*--s);
-            }
+            PackedIntArrayImp_Util::convert(d, s, numElements);
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -379,51 +414,37 @@ int PackedIntArrayImp<STORAGE>::
     BSLS_ASSERT(numElements <= d_length);
     BSLS_ASSERT(index       <= d_length - numElements);
 
-    bsl::size_t endIndex = index + numElements;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
 
-    unsigned int requiredBytesPerElement = 1;
+    int requiredBytesPerElement = 1;
     switch (d_bytesPerElement) {
       case 1: {
       } break;
       case 2: {
-        typename STORAGE::TwoByteStorageType *s =
-              static_cast<typename STORAGE::TwoByteStorageType *>(d_storage_p);
-        for (bsl::size_t i = index; i < endIndex; ++i) {
-            unsigned int rbpe = STORAGE::requiredBytesPerElement(
-                                               static_cast<ElementType>(s[i]));
-            if (requiredBytesPerElement < rbpe) {
-                requiredBytesPerElement = rbpe;
-                break;
-            }
-        }
+        const TwoByteType *s =
+                                 static_cast<const TwoByteType *>(d_storage_p);
+        requiredBytesPerElement = requiredBytesPerElementImp<STORAGE>(
+                                                                s + index,
+                                                                numElements,
+                                                                2);
       } break;
       case 4: {
-        typename STORAGE::FourByteStorageType *s =
-             static_cast<typename STORAGE::FourByteStorageType *>(d_storage_p);
-        for (bsl::size_t i = index; i < endIndex; ++i) {
-            unsigned int rbpe = STORAGE::requiredBytesPerElement(
-                                               static_cast<ElementType>(s[i]));
-            if (requiredBytesPerElement < rbpe) {
-                requiredBytesPerElement = rbpe;
-                if (4 == requiredBytesPerElement) {
-                    break;
-                }
-            }
-        }
+        const FourByteType *s =
+                                static_cast<const FourByteType *>(d_storage_p);
+        requiredBytesPerElement = requiredBytesPerElementImp<STORAGE>(
+                                                                s + index,
+                                                                numElements,
+                                                                4);
       } break;
       case 8: {
-        typename STORAGE::EightByteStorageType *s =
-            static_cast<typename STORAGE::EightByteStorageType *>(d_storage_p);
-        for (bsl::size_t i = index; i < endIndex; ++i) {
-            unsigned int rbpe = STORAGE::requiredBytesPerElement(
-                                               static_cast<ElementType>(s[i]));
-            if (requiredBytesPerElement < rbpe) {
-                requiredBytesPerElement = rbpe;
-                if (8 == requiredBytesPerElement) {
-                    break;
-                }
-            }
-        }
+        const EightByteType *s =
+                               static_cast<const EightByteType *>(d_storage_p);
+        requiredBytesPerElement = requiredBytesPerElementImp<STORAGE>(
+                                                                s + index,
+                                                                numElements,
+                                                                8);
       } break;
       default: {
         // Only the above values are valid so this case should never happen.
@@ -442,43 +463,43 @@ bool PackedIntArrayImp<STORAGE>::isEqualImp(
     BSLS_ASSERT(d_length == other.d_length);
     BSLS_ASSERT(d_bytesPerElement != other.d_bytesPerElement);
 
-    switch (d_bytesPerElement) {
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    // Equality is symmetric, so compare the array having the narrower
+    // storage against the array having the wider storage.
+
+    const bool  isNarrower = d_bytesPerElement < other.d_bytesPerElement;
+    const void *narrow     = isNarrower ? d_storage_p : other.d_storage_p;
+    const void *wide       = isNarrower ? other.d_storage_p : d_storage_p;
+    const int   narrowBpe  = isNarrower ? d_bytesPerElement
+                                        : other.d_bytesPerElement;
+    const int   wideBpe    = isNarrower ? other.d_bytesPerElement
+                                        : d_bytesPerElement;
+
+    switch (narrowBpe) {
       case 1: {
-        typename STORAGE::OneByteStorageType *t =
-              static_cast<typename STORAGE::OneByteStorageType *>(d_storage_p);
-        switch (other.d_bytesPerElement) {
+        const OneByteType *n = static_cast<const OneByteType *>(narrow);
+        switch (wideBpe) {
           case 2: {
-            typename STORAGE::TwoByteStorageType *o =
-                           static_cast<typename STORAGE::TwoByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                        n,
+                                        static_cast<const TwoByteType *>(wide),
+                                        d_length);                    // RETURN
           } break;
           case 4: {
-            typename STORAGE::FourByteStorageType *o =
-                          static_cast<typename STORAGE::FourByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                       n,
+                                       static_cast<const FourByteType *>(wide),
+                                       d_length);                     // RETURN
           } break;
           case 8: {
-            typename STORAGE::EightByteStorageType *o =
-                         static_cast<typename STORAGE::EightByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                      n,
+                                      static_cast<const EightByteType *>(wide),
+                                      d_length);                      // RETURN
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -489,41 +510,19 @@ bool PackedIntArrayImp<STORAGE>::isEqualImp(
         }
       } break;
       case 2: {
-        typename STORAGE::TwoByteStorageType *t =
-              static_cast<typename STORAGE::TwoByteStorageType *>(d_storage_p);
-        switch (other.d_bytesPerElement) {
-          case 1: {
-            typename STORAGE::OneByteStorageType *o =
-                           static_cast<typename STORAGE::OneByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
+        const TwoByteType *n = static_cast<const TwoByteType *>(narrow);
+        switch (wideBpe) {
           case 4: {
-            typename STORAGE::FourByteStorageType *o =
-                          static_cast<typename STORAGE::FourByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                       n,
+                                       static_cast<const FourByteType *>(wide),
+                                       d_length);                     // RETURN
           } break;
           case 8: {
-            typename STORAGE::EightByteStorageType *o =
-                         static_cast<typename STORAGE::EightByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                      n,
+                                      static_cast<const EightByteType *>(wide),
+                                      d_length);                      // RETURN
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -534,86 +533,13 @@ bool PackedIntArrayImp<STORAGE>::isEqualImp(
         }
       } break;
       case 4: {
-        typename STORAGE::FourByteStorageType *t =
-             static_cast<typename STORAGE::FourByteStorageType *>(d_storage_p);
-        switch (other.d_bytesPerElement) {
-          case 1: {
-            typename STORAGE::OneByteStorageType *o =
-                           static_cast<typename STORAGE::OneByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
-          case 2: {
-            typename STORAGE::TwoByteStorageType *o =
-                           static_cast<typename STORAGE::TwoByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
+        const FourByteType *n = static_cast<const FourByteType *>(narrow);
+        switch (wideBpe) {
           case 8: {
-            typename STORAGE::EightByteStorageType *o =
-                         static_cast<typename STORAGE::EightByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
-          default: {
-            // Only the above values are valid so this case should never
-            // happen.
-
-            BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
-          } break;
-        }
-      } break;
-      case 8: {
-        typename STORAGE::EightByteStorageType *t =
-            static_cast<typename STORAGE::EightByteStorageType *>(d_storage_p);
-        switch (other.d_bytesPerElement) {
-          case 1: {
-            typename STORAGE::OneByteStorageType *o =
-                           static_cast<typename STORAGE::OneByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
-          case 2: {
-            typename STORAGE::TwoByteStorageType *o =
-                           static_cast<typename STORAGE::TwoByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
-          } break;
-          case 4: {
-            typename STORAGE::FourByteStorageType *o =
-                          static_cast<typename STORAGE::FourByteStorageType *>(
-                                                            other.d_storage_p);
-            for (bsl::size_t i = 0; i < d_length; ++i) {
-                if (static_cast<ElementType>(t[i]) !=
-                                              static_cast<ElementType>(o[i])) {
-                    return false;                                     // RETURN
-                }
-            }
+            return PackedIntArrayImp_Util::areEqual(
+                                      n,
+                                      static_cast<const EightByteType *>(wide),
+                                      d_length);                      // RETURN
           } break;
           default: {
             // Only the above values are valid so this case should never
@@ -626,7 +552,7 @@ bool PackedIntArrayImp<STORAGE>::isEqualImp(
       default: {
         // Only the above values are valid so this case should never happen.
 
-        BSLS_ASSERT_OPT("Invalid value for 'd_BytesPerElement'." && 0);
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
       } break;
     }
     return true;
@@ -771,37 +697,7 @@ void PackedIntArrayImp<STORAGE>::append(ElementType value)
 
     // Prepare storage for the operation.
 
-    int rbpe = STORAGE::requiredBytesPerElement(value);
-    if (d_bytesPerElement >= rbpe) {
-        // Test for potential overflow.
-        BSLS_ASSERT(k_MAX_CAPACITY / d_bytesPerElement >= newLength);
-
-        bsl::size_t requiredCapacityInBytes = d_bytesPerElement * newLength;
-        if (requiredCapacityInBytes > d_capacityInBytes) {
-            reserveCapacityImp(requiredCapacityInBytes);
-        }
-    }
-    else {
-        // Test for potential overflow.
-        BSLS_ASSERT(k_MAX_CAPACITY / rbpe >= newLength);
-
-        bsl::size_t requiredCapacityInBytes = rbpe * newLength;
-
-        if (requiredCapacityInBytes > d_capacityInBytes) {
-            expandImp(rbpe, requiredCapacityInBytes);
-        }
-        else {
-            int srcBytesPerElement = d_bytesPerElement;
-            d_bytesPerElement = rbpe;
-            replaceImp(d_storage_p,
-                       0,
-                       d_bytesPerElement,
-                       d_storage_p,
-                       0,
-                       srcBytesPerElement,
-                       d_length);
-        }
-    }
+    prepareImp(STORAGE::requiredBytesPerElement(value), newLength);
 
     // Append the 'value'.
 
@@ -1473,6 +1369,146 @@ typename PackedIntArrayImp<STORAGE>::ElementType
     return 0;  // Note that this RETURN is never reached.
 }
 
+template <class STORAGE>
+typename PackedIntArrayImp<STORAGE>::ElementType
+                         PackedIntArrayImp<STORAGE>::maxElement(
+                                          bsl::size_t index,
+                                          bsl::size_t numElements) const
+{
+    BSLS_ASSERT(0 < numElements);
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT(numElements <= d_length);
+    BSLS_ASSERT(index       <= d_length - numElements);
+
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        const OneByteType *s =
+                                 static_cast<const OneByteType *>(d_storage_p);
+        OneByteType minValue;
+        OneByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(maxValue);                    // RETURN
+      } break;
+      case 2: {
+        const TwoByteType *s =
+                                 static_cast<const TwoByteType *>(d_storage_p);
+        TwoByteType minValue;
+        TwoByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(maxValue);                    // RETURN
+      } break;
+      case 4: {
+        const FourByteType *s =
+                                static_cast<const FourByteType *>(d_storage_p);
+        FourByteType minValue;
+        FourByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(maxValue);                    // RETURN
+      } break;
+      case 8: {
+        const EightByteType *s =
+                               static_cast<const EightByteType *>(d_storage_p);
+        EightByteType minValue;
+        EightByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(maxValue);                    // RETURN
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+    return 0;  // Note that this RETURN is never reached.
+}
+
+template <class STORAGE>
+typename PackedIntArrayImp<STORAGE>::ElementType
+                         PackedIntArrayImp<STORAGE>::minElement(
+                                          bsl::size_t index,
+                                          bsl::size_t numElements) const
+{
+    BSLS_ASSERT(0 < numElements);
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT(numElements <= d_length);
+    BSLS_ASSERT(index       <= d_length - numElements);
+
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        const OneByteType *s =
+                                 static_cast<const OneByteType *>(d_storage_p);
+        OneByteType minValue;
+        OneByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(minValue);                    // RETURN
+      } break;
+      case 2: {
+        const TwoByteType *s =
+                                 static_cast<const TwoByteType *>(d_storage_p);
+        TwoByteType minValue;
+        TwoByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(minValue);                    // RETURN
+      } break;
+      case 4: {
+        const FourByteType *s =
+                                static_cast<const FourByteType *>(d_storage_p);
+        FourByteType minValue;
+        FourByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(minValue);                    // RETURN
+      } break;
+      case 8: {
+        const EightByteType *s =
+                               static_cast<const EightByteType *>(d_storage_p);
+        EightByteType minValue;
+        EightByteType maxValue;
+        PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                           &maxValue,
+                                           s + index,
+                                           numElements);
+        return static_cast<ElementType>(minValue);                    // RETURN
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+    return 0;  // Note that this RETURN is never reached.
+}
+
 template <class STORAGE>
 bsl::ostream& PackedIntArrayImp<STORAGE>::print(
                                             bsl::ostream& stream,
@@ -1528,6 +1564,53 @@ bsl::ostream& PackedIntArrayImp<STORAGE>::print(
     return stream;
 }
 
+template <class STORAGE>
+typename PackedIntArrayImp<STORAGE>::ElementType
+                                PackedIntArrayImp<STORAGE>::sum(
+                                          bsl::size_t index,
+                                          bsl::size_t numElements) const
+{
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT(numElements <= d_length);
+    BSLS_ASSERT(index       <= d_length - numElements);
+
+    bsl::uint64_t result = 0;
+
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        const OneByteType *s =
+                                 static_cast<const OneByteType *>(d_storage_p);
+        result = PackedIntArrayImp_Util::sum(s + index, numElements);
+      } break;
+      case 2: {
+        const TwoByteType *s =
+                                 static_cast<const TwoByteType *>(d_storage_p);
+        result = PackedIntArrayImp_Util::sum(s + index, numElements);
+      } break;
+      case 4: {
+        const FourByteType *s =
+                                static_cast<const FourByteType *>(d_storage_p);
+        result = PackedIntArrayImp_Util::sum(s + index, numElements);
+      } break;
+      case 8: {
+        const EightByteType *s =
+                               static_cast<const EightByteType *>(d_storage_p);
+        result = PackedIntArrayImp_Util::sum(s + index, numElements);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+    return static_cast<ElementType>(result);
+}
+
 template class PackedIntArrayImp<PackedIntArrayImp_Signed>;
 template class PackedIntArrayImp<PackedIntArrayImp_Unsigned>;
 
@@ -25,6 +25,17 @@ BSLS_IDENT("$Id: $")
 // individual elements by calling the indexing operator or via iterators.  Note
 // that iterators are *not* invalidated if an array object reallocates memory.
 //
+///Bulk Operations
+///---------------
+// In addition to element-at-a-time access, `bdlc::PackedIntArray` provides
+// operations on whole ranges of elements: `append` and `loadElements` copy
+// values from and to an ordinary array of `TYPE`, and `minElement`,
+// `maxElement`, and `sum` summarize a range.  These operations, and the
+// conversions performed when the storage of an array is widened or values are
+// copied between arrays of different storage sizes, process the elements a
+// fixed-size block at a time in loops that compilers can vectorize, and
+// typically run much faster than the equivalent loops over `operator[]`.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -348,6 +359,63 @@ struct PackedIntArrayImp_Unsigned {
     static int requiredBytesPerElement(EightByteStorageType value);
 };
 
+                        // =============================
+                        // struct PackedIntArrayImp_Util
+                        // =============================
+
+/// This component-private `struct` provides a namespace for functions that
+/// operate on ranges of elements stored as one of the storage types of a
+/// `PackedIntArrayImp`.  Each function processes a fixed number of elements
+/// at a time, in loops having neither branches nor dependencies between
+/// iterations, so that compilers can vectorize them.
+struct PackedIntArrayImp_Util {
+
+    // PUBLIC CONSTANTS
+    enum { k_BLOCK_SIZE = 32 };  // number of elements processed at a time
+
+    // CLASS METHODS
+
+    /// Return `true` if each of the specified `numElements` values starting
+    /// at the specified `narrow` has the same value as the corresponding
+    /// value starting at the specified `wide`, and `false` otherwise.  The
+    /// behavior is undefined unless every value of `NARROW_TYPE` is
+    /// representable by `WIDE_TYPE`.
+    template <class NARROW_TYPE, class WIDE_TYPE>
+    static bool areEqual(const NARROW_TYPE *narrow,
+                         const WIDE_TYPE   *wide,
+                         bsl::size_t        numElements);
+
+    /// Assign to each of the specified `numElements` elements starting at
+    /// the specified `dst` the corresponding value starting at the
+    /// specified `src`, converted to `DST_TYPE`.  The elements are copied
+    /// from last to first, and each block of source elements is read before
+    /// any corresponding destination element is written, so the ranges may
+    /// overlap provided that `dst` does not precede `src` and
+    /// `sizeof(DST_TYPE) >= sizeof(SRC_TYPE)` (i.e., the elements of an
+    /// array may be widened in place).  The behavior is undefined unless
+    /// the ranges do not overlap or satisfy that condition.
+    template <class DST_TYPE, class SRC_TYPE>
+    static void convert(DST_TYPE       *dst,
+                        const SRC_TYPE *src,
+                        bsl::size_t     numElements);
+
+    /// Load into the specified `minValue` and `maxValue` the least and the
+    /// greatest, respectively, of the specified `numElements` values
+    /// starting at the specified `values`.  The behavior is undefined
+    /// unless `0 < numElements`.
+    template <class TYPE>
+    static void loadMinMax(TYPE        *minValue,
+                           TYPE        *maxValue,
+                           const TYPE  *values,
+                           bsl::size_t  numElements);
+
+    /// Return the sum, modulo 2^64, of the specified `numElements` values
+    /// starting at the specified `values`, each converted to
+    /// `bsl::uint64_t`.
+    template <class TYPE>
+    static bsl::uint64_t sum(const TYPE *values, bsl::size_t numElements);
+};
+
                           // =======================
                           // class PackedIntArrayImp
                           // =======================
@@ -398,6 +466,13 @@ class PackedIntArrayImp {
     void expandImp(int         requiredBytesPerElement,
                    bsl::size_t requiredCapacityInBytes);
 
+    /// Make the capacity of this array sufficient to hold the specified
+    /// `newLength` elements, each stored in at least the specified
+    /// `requiredBytesPerElement` bytes, widening the storage of the
+    /// existing elements if necessary.  The behavior is undefined unless
+    /// `length() <= newLength`.
+    void prepareImp(int requiredBytesPerElement, bsl::size_t newLength);
+
     /// Change the value of the element at the specified `dstIndex` in this
     /// array to the specified `value`.  The behavior is undefined unless
     /// `dstIndex < length()` and the required bytes to store the `value` is
@@ -502,6 +577,13 @@ class PackedIntArrayImp {
                 bsl::size_t              srcIndex,
                 bsl::size_t              numElements);
 
+    /// Append the specified `numValues` values starting at the specified
+    /// `values` to the end of this array.  The behavior is undefined unless
+    /// `values` refers to an array of at least `numValues` elements, each
+    /// of which is representable by `ElementType`.
+    template <class TYPE>
+    void append(const TYPE *values, bsl::size_t numValues);
+
     /// Assign to this object the value read from the specified input
     /// `stream` using the specified `version` format, and return a
     /// reference to `stream`.  If `stream` is initially invalid, this
@@ -667,6 +749,34 @@ class PackedIntArrayImp {
     /// Return number of elements in this array.
     bsl::size_t length() const;
 
+    /// Load into the specified `result` array the values of the specified
+    /// `numElements` elements of this array starting at the specified
+    /// `index`, each converted to `TYPE`.  The behavior is undefined unless
+    /// `index + numElements <= length()` and `result` refers to an array of
+    /// at least `numElements` elements.
+    template <class TYPE>
+    void loadElements(TYPE        *result,
+                      bsl::size_t  index,
+                      bsl::size_t  numElements) const;
+
+    /// Return the greatest value of the specified `numElements` elements of
+    /// this array starting at the specified `index`.  The behavior is
+    /// undefined unless `0 < numElements` and
+    /// `index + numElements <= length()`.
+    ElementType maxElement(bsl::size_t index, bsl::size_t numElements) const;
+
+    /// Return the least value of the specified `numElements` elements of
+    /// this array starting at the specified `index`.  The behavior is
+    /// undefined unless `0 < numElements` and
+    /// `index + numElements <= length()`.
+    ElementType minElement(bsl::size_t index, bsl::size_t numElements) const;
+
+    /// Return the sum of the values of the specified `numElements` elements
+    /// of this array starting at the specified `index`.  The behavior is
+    /// undefined unless `index + numElements <= length()` and the sum is
+    /// representable by `ElementType`.
+    ElementType sum(bsl::size_t index, bsl::size_t numElements) const;
+
     /// Write the value of this array to the specified output `stream` in a
     /// human-readable format, and return a reference to `stream`.
     /// Optionally specify an initial indentation `level`, whose absolute
@@ -1017,6 +1127,10 @@ class PackedIntArray {
 
     typedef PackedIntArrayConstIterator<TYPE> const_iterator;
 
+    /// The 64-bit integral type, having the signedness of `TYPE`, of the
+    /// value returned by `sum`.
+    typedef typename ImpType::ElementType sum_type;
+
     // CLASS METHODS
 
     /// Return the `version` to be used with the `bdexStreamOut` method
@@ -1077,6 +1191,13 @@ class PackedIntArray {
                 bsl::size_t           srcIndex,
                 bsl::size_t           numElements);
 
+    /// Append the specified `numValues` values starting at the specified
+    /// `values` to the end of this array.  The behavior is undefined unless
+    /// `values` refers to an array of at least `numValues` elements.  Note
+    /// that this method is much faster than appending the values one at a
+    /// time (see {Bulk Operations}).
+    void append(const TYPE *values, bsl::size_t numValues);
+
     /// Assign to this object the value read from the specified input
     /// `stream` using the specified `version` format, and return a
     /// reference to `stream`.  If `stream` is initially invalid, this
@@ -1276,6 +1397,35 @@ class PackedIntArray {
     /// Return number of elements in this array.
     bsl::size_t length() const;
 
+    /// Load into the specified `result` array the values of the specified
+    /// `numElements` elements of this array starting at the specified
+    /// `index`.  The behavior is undefined unless
+    /// `index + numElements <= length()` and `result` refers to an array of
+    /// at least `numElements` elements.
+    void loadElements(TYPE        *result,
+                      bsl::size_t  index,
+                      bsl::size_t  numElements) const;
+
+    /// Return the greatest value in this array.  The behavior is undefined
+    /// unless `0 < length()`.
+    TYPE maxElement() const;
+
+    /// Return the greatest value of the specified `numElements` elements of
+    /// this array starting at the specified `index`.  The behavior is
+    /// undefined unless `0 < numElements` and
+    /// `index + numElements <= length()`.
+    TYPE maxElement(bsl::size_t index, bsl::size_t numElements) const;
+
+    /// Return the least value in this array.  The behavior is undefined
+    /// unless `0 < length()`.
+    TYPE minElement() const;
+
+    /// Return the least value of the specified `numElements` elements of
+    /// this array starting at the specified `index`.  The behavior is
+    /// undefined unless `0 < numElements` and
+    /// `index + numElements <= length()`.
+    TYPE minElement(bsl::size_t index, bsl::size_t numElements) const;
+
     /// Write the value of this array to the specified output `stream` in a
     /// human-readable format, and return a reference to `stream`.
     /// Optionally specify an initial indentation `level`, whose absolute
@@ -1290,6 +1440,17 @@ class PackedIntArray {
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
                         int           spacesPerLevel = 4) const;
+
+    /// Return the sum of the values in this array, or 0 if this array is
+    /// empty.  The behavior is undefined unless the sum is representable by
+    /// `sum_type`.
+    sum_type sum() const;
+
+    /// Return the sum of the values of the specified `numElements` elements
+    /// of this array starting at the specified `index`.  The behavior is
+    /// undefined unless `index + numElements <= length()` and the sum is
+    /// representable by `sum_type`.
+    sum_type sum(bsl::size_t index, bsl::size_t numElements) const;
 };
 
 // FREE OPERATORS
@@ -1465,6 +1626,136 @@ void PackedIntArrayImp_Unsigned::bdexPut64(STREAM& stream, bsl::uint64_t value)
     stream.putUint64(static_cast<bsls::Types::Uint64>(value));
 }
 
+                        // -----------------------------
+                        // struct PackedIntArrayImp_Util
+                        // -----------------------------
+
+// CLASS METHODS
+template <class NARROW_TYPE, class WIDE_TYPE>
+bool PackedIntArrayImp_Util::areEqual(const NARROW_TYPE *narrow,
+                                      const WIDE_TYPE   *wide,
+                                      bsl::size_t        numElements)
+{
+    for (; numElements >= k_BLOCK_SIZE; numElements -= k_BLOCK_SIZE) {
+        int differences = 0;
+        for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+            differences |= static_cast<WIDE_TYPE>(narrow[i]) != wide[i];
+        }
+        if (differences) {
+            return false;                                             // RETURN
+        }
+        narrow += k_BLOCK_SIZE;
+        wide   += k_BLOCK_SIZE;
+    }
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        if (static_cast<WIDE_TYPE>(narrow[i]) != wide[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class DST_TYPE, class SRC_TYPE>
+void PackedIntArrayImp_Util::convert(DST_TYPE       *dst,
+                                     const SRC_TYPE *src,
+                                     bsl::size_t     numElements)
+{
+    // Copying each block of source elements into a local buffer ensures
+    // that the block is read before any of it is overwritten, and lets the
+    // compiler vectorize the conversion loop without concern for aliasing.
+
+    while (numElements >= k_BLOCK_SIZE) {
+        numElements -= k_BLOCK_SIZE;
+
+        SRC_TYPE block[k_BLOCK_SIZE];
+        bsl::memcpy(block, src + numElements, sizeof block);
+
+        DST_TYPE *d = dst + numElements;
+        for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+            d[i] = static_cast<DST_TYPE>(block[i]);
+        }
+    }
+
+    while (numElements) {
+        --numElements;
+        dst[numElements] = static_cast<DST_TYPE>(src[numElements]);
+    }
+}
+
+template <class TYPE>
+void PackedIntArrayImp_Util::loadMinMax(TYPE        *minValue,
+                                        TYPE        *maxValue,
+                                        const TYPE  *values,
+                                        bsl::size_t  numElements)
+{
+    BSLS_ASSERT(minValue);
+    BSLS_ASSERT(maxValue);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < numElements);
+
+    TYPE lo = values[0];
+    TYPE hi = values[0];
+
+    if (numElements >= k_BLOCK_SIZE) {
+        // Keep a running minimum and maximum for each position in a block,
+        // and combine them at the end.
+
+        TYPE los[k_BLOCK_SIZE];
+        TYPE his[k_BLOCK_SIZE];
+        bsl::memcpy(los, values, sizeof los);
+        bsl::memcpy(his, values, sizeof his);
+        values      += k_BLOCK_SIZE;
+        numElements -= k_BLOCK_SIZE;
+
+        for (; numElements >= k_BLOCK_SIZE; numElements -= k_BLOCK_SIZE) {
+            for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+                los[i] = values[i] < los[i] ? values[i] : los[i];
+                his[i] = values[i] > his[i] ? values[i] : his[i];
+            }
+            values += k_BLOCK_SIZE;
+        }
+
+        for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+            lo = los[i] < lo ? los[i] : lo;
+            hi = his[i] > hi ? his[i] : hi;
+        }
+    }
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        lo = values[i] < lo ? values[i] : lo;
+        hi = values[i] > hi ? values[i] : hi;
+    }
+
+    *minValue = lo;
+    *maxValue = hi;
+}
+
+template <class TYPE>
+bsl::uint64_t PackedIntArrayImp_Util::sum(const TYPE  *values,
+                                          bsl::size_t  numElements)
+{
+    BSLS_ASSERT(values || 0 == numElements);
+
+    bsl::uint64_t sums[k_BLOCK_SIZE] = { 0 };
+
+    for (; numElements >= k_BLOCK_SIZE; numElements -= k_BLOCK_SIZE) {
+        for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+            sums[i] += static_cast<bsl::uint64_t>(values[i]);
+        }
+        values += k_BLOCK_SIZE;
+    }
+
+    bsl::uint64_t ret = 0;
+    for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+        ret += sums[i];
+    }
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        ret += static_cast<bsl::uint64_t>(values[i]);
+    }
+    return ret;
+}
+
                           // ------------------------
                           // struct PackedIntArrayImp
                           // ------------------------
@@ -1516,6 +1807,74 @@ void PackedIntArrayImp<STORAGE>::
     append(srcArray, 0, srcArray.d_length);
 }
 
+template <class STORAGE>
+template <class TYPE>
+void PackedIntArrayImp<STORAGE>::append(const TYPE  *values,
+                                        bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (0 == numValues) {
+        return;                                                       // RETURN
+    }
+
+    // Find the storage size required by the extreme values, and make room
+    // for the new elements before converting them all at once.
+
+    TYPE minValue;
+    TYPE maxValue;
+    PackedIntArrayImp_Util::loadMinMax(&minValue,
+                                       &maxValue,
+                                       values,
+                                       numValues);
+
+    const int minRbpe = STORAGE::requiredBytesPerElement(
+                                           static_cast<ElementType>(minValue));
+    const int maxRbpe = STORAGE::requiredBytesPerElement(
+                                           static_cast<ElementType>(maxValue));
+
+    prepareImp(minRbpe > maxRbpe ? minRbpe : maxRbpe, d_length + numValues);
+
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        PackedIntArrayImp_Util::convert(
+                static_cast<OneByteType *>(d_storage_p) + d_length,
+                values,
+                numValues);
+      } break;
+      case 2: {
+        PackedIntArrayImp_Util::convert(
+                static_cast<TwoByteType *>(d_storage_p) + d_length,
+                values,
+                numValues);
+      } break;
+      case 4: {
+        PackedIntArrayImp_Util::convert(
+                static_cast<FourByteType *>(d_storage_p) + d_length,
+                values,
+                numValues);
+      } break;
+      case 8: {
+        PackedIntArrayImp_Util::convert(
+                static_cast<EightByteType *>(d_storage_p) + d_length,
+                values,
+                numValues);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+
+    d_length += numValues;
+}
+
 template <class STORAGE>
 template <class STREAM>
 inline
@@ -1895,6 +2254,56 @@ bool PackedIntArrayImp<STORAGE>::isEqual(
     return false;
 }
 
+template <class STORAGE>
+template <class TYPE>
+void PackedIntArrayImp<STORAGE>::loadElements(TYPE        *result,
+                                              bsl::size_t  index,
+                                              bsl::size_t  numElements) const
+{
+    BSLS_ASSERT(result || 0 == numElements);
+
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT(numElements <= d_length);
+    BSLS_ASSERT(index       <= d_length - numElements);
+
+    typedef typename STORAGE::OneByteStorageType   OneByteType;
+    typedef typename STORAGE::TwoByteStorageType   TwoByteType;
+    typedef typename STORAGE::FourByteStorageType  FourByteType;
+    typedef typename STORAGE::EightByteStorageType EightByteType;
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        PackedIntArrayImp_Util::convert(
+            result,
+            static_cast<const OneByteType *>(d_storage_p) + index,
+            numElements);
+      } break;
+      case 2: {
+        PackedIntArrayImp_Util::convert(
+            result,
+            static_cast<const TwoByteType *>(d_storage_p) + index,
+            numElements);
+      } break;
+      case 4: {
+        PackedIntArrayImp_Util::convert(
+            result,
+            static_cast<const FourByteType *>(d_storage_p) + index,
+            numElements);
+      } break;
+      case 8: {
+        PackedIntArrayImp_Util::convert(
+            result,
+            static_cast<const EightByteType *>(d_storage_p) + index,
+            numElements);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+}
+
 template <class STORAGE>
 inline
 bsl::size_t PackedIntArrayImp<STORAGE>::length() const
@@ -2264,6 +2673,15 @@ void PackedIntArray<TYPE>::append(const PackedIntArray<TYPE>& srcArray,
     d_imp.append(srcArray.d_imp, srcIndex, numElements);
 }
 
+template <class TYPE>
+inline
+void PackedIntArray<TYPE>::append(const TYPE *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    d_imp.append(values, numValues);
+}
+
 template <class TYPE>
 template <class STREAM>
 inline
@@ -2542,6 +2960,63 @@ bsl::size_t PackedIntArray<TYPE>::length() const
     return d_imp.length();
 }
 
+template <class TYPE>
+inline
+void PackedIntArray<TYPE>::loadElements(TYPE        *result,
+                                        bsl::size_t  index,
+                                        bsl::size_t  numElements) const
+{
+    // Assert 'index + numElements <= length()' without risk of overflow.
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(index       <= length() - numElements);
+
+    d_imp.loadElements(result, index, numElements);
+}
+
+template <class TYPE>
+inline
+TYPE PackedIntArray<TYPE>::maxElement() const
+{
+    BSLS_ASSERT(0 < length());
+
+    return static_cast<TYPE>(d_imp.maxElement(0, length()));
+}
+
+template <class TYPE>
+inline
+TYPE PackedIntArray<TYPE>::maxElement(bsl::size_t index,
+                                      bsl::size_t numElements) const
+{
+    // Assert 'index + numElements <= length()' without risk of overflow.
+    BSLS_ASSERT(0           <  numElements);
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(index       <= length() - numElements);
+
+    return static_cast<TYPE>(d_imp.maxElement(index, numElements));
+}
+
+template <class TYPE>
+inline
+TYPE PackedIntArray<TYPE>::minElement() const
+{
+    BSLS_ASSERT(0 < length());
+
+    return static_cast<TYPE>(d_imp.minElement(0, length()));
+}
+
+template <class TYPE>
+inline
+TYPE PackedIntArray<TYPE>::minElement(bsl::size_t index,
+                                      bsl::size_t numElements) const
+{
+    // Assert 'index + numElements <= length()' without risk of overflow.
+    BSLS_ASSERT(0           <  numElements);
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(index       <= length() - numElements);
+
+    return static_cast<TYPE>(d_imp.minElement(index, numElements));
+}
+
 template <class TYPE>
 bsl::ostream& PackedIntArray<TYPE>::print(bsl::ostream& stream,
                                           int           level,
@@ -2550,6 +3025,25 @@ bsl::ostream& PackedIntArray<TYPE>::print(bsl::ostream& stream,
     return d_imp.print(stream, level, spacesPerLevel);
 }
 
+template <class TYPE>
+inline
+typename PackedIntArray<TYPE>::sum_type PackedIntArray<TYPE>::sum() const
+{
+    return d_imp.sum(0, length());
+}
+
+template <class TYPE>
+inline
+typename PackedIntArray<TYPE>::sum_type
+PackedIntArray<TYPE>::sum(bsl::size_t index, bsl::size_t numElements) const
+{
+    // Assert 'index + numElements <= length()' without risk of overflow.
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(index       <= length() - numElements);
+
+    return d_imp.sum(index, numElements);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
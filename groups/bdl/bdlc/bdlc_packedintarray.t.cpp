@@ -14,6 +14,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bslx_byteinstream.h>
@@ -31,6 +32,7 @@
 #include <bsl_map.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstdint.h>
 #include <bsl_utility.h>
@@ -139,6 +141,7 @@ using namespace bsl;
 // [16] void reserveCapacity(numElements, minValue, maxValue);
 // [17] void resize(bsl::size_t numElements);
 // [11] void swap(PackedIntArray& other);
+// [27] void append(const TYPE *values, bsl::size_t numValues);
 // [ 4] TYPE operator[](bsl::size_t index) const;
 // [ 4] bslma::Allocator *allocator() const;
 // [19] TYPE back() const;
@@ -151,7 +154,14 @@ using namespace bsl;
 // [ 4] bool isEmpty() const;
 // [ 6] bool isEqual(const PackedIntArray& other) const;
 // [ 4] bsl::size_t length() const;
+// [27] void loadElements(TYPE *result, index, numElements) const;
+// [27] TYPE maxElement() const;
+// [27] TYPE maxElement(bsl::size_t index, bsl::size_t numElements) const;
+// [27] TYPE minElement() const;
+// [27] TYPE minElement(bsl::size_t index, bsl::size_t numElements) const;
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+// [27] sum_type sum() const;
+// [27] sum_type sum(bsl::size_t index, bsl::size_t numElements) const;
 // [ 5] ostream& operator<<(ostream& stream, const PackedIntArray& array);
 // [ 6] bool operator==(lhs, rhs);
 // [ 6] bool operator!=(lhs, rhs);
@@ -159,7 +169,7 @@ using namespace bsl;
 // [26] void hashAppend(HASHALG&, const PackedIntArray&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [27] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] UnsignedObj& gg(UnsignedObj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
@@ -582,6 +592,202 @@ OBJ& gg(OBJ *object, const char *spec)
     return *object;
 }
 
+// ============================================================================
+//                 HELPER FUNCTIONS FOR TESTING BULK OPERATIONS
+// ----------------------------------------------------------------------------
+
+/// Verify that the bulk operations of `bdlc::PackedIntArray<TYPE>` applied
+/// to the specified `numElements` elements of the specified `array` starting
+/// at the specified `index` agree with `operator[]`, and use the specified
+/// `line` to report failures.
+template <class TYPE>
+void verifyBulkAccessors(int                               line,
+                         const bdlc::PackedIntArray<TYPE>& array,
+                         bsl::size_t                       index,
+                         bsl::size_t                       numElements)
+{
+    typedef typename bdlc::PackedIntArray<TYPE>::sum_type SumType;
+
+    bsl::vector<TYPE> result(numElements + 1, TYPE(7));
+    array.loadElements(result.data(), index, numElements);
+
+    bsl::uint64_t sum = 0;
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        ASSERTV(line, index, i, array[index + i] == result[i]);
+
+        sum += static_cast<bsl::uint64_t>(array[index + i]);
+    }
+    ASSERTV(line, index, numElements, TYPE(7) == result[numElements]);
+
+    ASSERTV(line,
+            index,
+            numElements,
+            static_cast<SumType>(sum) == array.sum(index, numElements));
+
+    if (0 == numElements) {
+        return;                                                       // RETURN
+    }
+
+    TYPE minValue = array[index];
+    TYPE maxValue = array[index];
+    for (bsl::size_t i = 1; i < numElements; ++i) {
+        minValue = array[index + i] < minValue ? array[index + i] : minValue;
+        maxValue = array[index + i] > maxValue ? array[index + i] : maxValue;
+    }
+    ASSERTV(line,
+            index,
+            numElements,
+            minValue == array.minElement(index, numElements));
+    ASSERTV(line,
+            index,
+            numElements,
+            maxValue == array.maxElement(index, numElements));
+}
+
+/// Verify the bulk operations of `bdlc::PackedIntArray<TYPE>` against the
+/// corresponding element-at-a-time operations by appending the specified
+/// `numValues` values of the specified `values` array to an array holding
+/// the specified `numInitial` copies of the specified `initialValue`.  If
+/// the specified `reserve` is `true`, first reserve enough capacity for the
+/// existing elements to be widened in place.  Use the specified `line` to
+/// report failures.
+template <class TYPE>
+void testBulkOperations(int          line,
+                        TYPE         initialValue,
+                        bsl::size_t  numInitial,
+                        const TYPE  *values,
+                        bsl::size_t  numValues,
+                        bool         reserve)
+{
+    typedef bdlc::PackedIntArray<TYPE> Array;
+
+    bslma::TestAllocator oa("object");
+
+    Array mX(&oa);  const Array& X = mX;
+    Array mY(&oa);  const Array& Y = mY;
+
+    for (bsl::size_t i = 0; i < numInitial; ++i) {
+        mX.append(initialValue);
+        mY.append(initialValue);
+    }
+
+    if (reserve) {
+        mX.reserveCapacity(numInitial + numValues,
+                           bsl::numeric_limits<TYPE>::min(),
+                           bsl::numeric_limits<TYPE>::max());
+    }
+
+    mX.append(values, numValues);
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        mY.append(values[i]);
+    }
+
+    ASSERTV(line, numInitial, numValues, X == Y);
+    ASSERTV(line,
+            numInitial,
+            numValues,
+            X.bytesPerElement() == Y.bytesPerElement());
+
+    const bsl::size_t LENGTH = X.length();
+
+    // Verify the accessors over ranges straddling the block boundaries.
+
+    for (bsl::size_t index = 0; index <= LENGTH; index += 1 + index * 2) {
+        for (bsl::size_t n = 0; n <= LENGTH - index; n += 1 + n * 2) {
+            verifyBulkAccessors(line, X, index, n);
+        }
+        verifyBulkAccessors(line, X, index, LENGTH - index);
+    }
+
+    ASSERTV(line, X.sum(0, LENGTH) == X.sum());
+    if (0 < LENGTH) {
+        ASSERTV(line, X.minElement(0, LENGTH) == X.minElement());
+        ASSERTV(line, X.maxElement(0, LENGTH) == X.maxElement());
+    }
+
+    // Verify comparison against an array having the widest storage for
+    // `TYPE`.
+
+    Array mW(&oa);  const Array& W = mW;
+
+    mW.append(bsl::numeric_limits<TYPE>::max());
+    mW.append(X);
+    mW.remove(0);
+
+    ASSERTV(line, static_cast<int>(sizeof(TYPE)) == W.bytesPerElement());
+    ASSERTV(line, W == X);
+    ASSERTV(line, X == W);
+
+    const bsl::size_t POSITIONS[] = { 0, LENGTH / 2, LENGTH - 1 };
+    for (int i = 0; 0 < LENGTH && i < 3; ++i) {
+        const bsl::size_t POS   = POSITIONS[i];
+        const TYPE        VALUE = W[POS];
+
+        mW.replace(POS, TYPE(0) == VALUE ? TYPE(1) : TYPE(0));
+
+        ASSERTV(line, POS, W != X);
+        ASSERTV(line, POS, X != W);
+
+        mW.replace(POS, VALUE);
+    }
+}
+
+/// Test the bulk operations of `bdlc::PackedIntArray<TYPE>` using arrays of
+/// pseudo-random values of various lengths and magnitudes.
+template <class TYPE>
+void testBulkOperationsForType()
+{
+    const bsl::size_t   LENGTHS[]    = { 0, 1, 31, 32, 33, 100, 1000 };
+    const bsl::uint64_t MAGNITUDES[] = { 100, 30000, 2000000000, 0 };
+
+    const TYPE          INITIAL[]    = { 0,
+                                         bsl::numeric_limits<TYPE>::min(),
+                                         bsl::numeric_limits<TYPE>::max() };
+    const bsl::size_t   NUM_INITIAL[] = { 0, 5, 40 };
+
+    bsl::uint64_t seed = 0x123456789abcdefULL;
+
+    for (int li = 0; li < 7; ++li) {
+        const bsl::size_t LENGTH = LENGTHS[li];
+
+        for (int mi = 0; mi < 4; ++mi) {
+            const bsl::uint64_t MAGNITUDE = MAGNITUDES[mi];
+
+            bsl::vector<TYPE> values;
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+                bsl::uint64_t r = seed >> 1;
+                if (MAGNITUDE) {
+                    r %= MAGNITUDE;
+                }
+                TYPE value = static_cast<TYPE>(r);
+                if (bsl::numeric_limits<TYPE>::is_signed && (seed >> 63)) {
+                    value = static_cast<TYPE>(~value);
+                }
+                values.push_back(value);
+            }
+
+            for (int ii = 0; ii < 3; ++ii) {
+                for (int ni = 0; ni < 3; ++ni) {
+                    testBulkOperations(L_,
+                                       INITIAL[ii],
+                                       NUM_INITIAL[ni],
+                                       values.data(),
+                                       LENGTH,
+                                       false);
+                    testBulkOperations(L_,
+                                       INITIAL[ii],
+                                       NUM_INITIAL[ni],
+                                       values.data(),
+                                       LENGTH,
+                                       true);
+                }
+            }
+        }
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -608,7 +814,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -686,6 +892,139 @@ int main(int argc, char *argv[])
     ASSERT(                                   24 == nyc.length());
 // ```
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING BULK OPERATIONS
+        //   The methods operating on ranges of elements agree with the
+        //   corresponding element-at-a-time methods.
+        //
+        // Concerns:
+        // 1. `append(const TYPE *, numValues)` produces the same value and
+        //    storage size as appending the values one at a time, for every
+        //    combination of initial and appended storage size, whether or not
+        //    the existing elements are widened in place.
+        //
+        // 2. `loadElements`, `minElement`, `maxElement`, and `sum` agree with
+        //    `operator[]` for ranges of every length and alignment relative
+        //    to the block size of the implementation, and `loadElements`
+        //    writes no elements past the requested range.
+        //
+        // 3. The sum of a range wraps as does the sum of its elements
+        //    computed in `sum_type`.
+        //
+        // 4. Arrays having different storage sizes compare correctly in
+        //    either order, whichever element differs.
+        //
+        // 5. The methods are supported for signed and unsigned `TYPE` of
+        //    every size.
+        //
+        // 6. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For arrays of pseudo-random values of a variety of lengths and
+        //    magnitudes, for a variety of initial array values, with and
+        //    without reserving capacity for every element at the widest
+        //    storage size, append the values with the bulk `append` and one
+        //    at a time, and verify the results are equal and have the same
+        //    storage size.  (C-1)
+        //
+        // 2. For a set of ranges of the resulting array, verify the bulk
+        //    accessors against values computed using `operator[]`.
+        //    (C-2..3)
+        //
+        // 3. Copy the resulting array into an array having 8-byte storage,
+        //    and verify the arrays compare equal; then change one of a set of
+        //    elements and verify the arrays compare unequal.  (C-4)
+        //
+        // 4. Perform the above steps for `bsl::int64_t`, `bsl::uint64_t`,
+        //    `int`, `short`, and `unsigned char`.  (C-5)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments (using the `BSLS_ASSERTTEST_*`
+        //    macros).  (C-6)
+        //
+        // Testing:
+        //   void append(const TYPE *values, bsl::size_t numValues);
+        //   void loadElements(TYPE *result, index, numElements) const;
+        //   TYPE maxElement() const;
+        //   TYPE maxElement(bsl::size_t index, bsl::size_t numElements) const;
+        //   TYPE minElement() const;
+        //   TYPE minElement(bsl::size_t index, bsl::size_t numElements) const;
+        //   sum_type sum() const;
+        //   sum_type sum(bsl::size_t index, bsl::size_t numElements) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK OPERATIONS" << endl
+                          << "=======================" << endl;
+
+        if (verbose) cout << "\nTesting `bsl::int64_t`." << endl;
+        testBulkOperationsForType<bsl::int64_t>();
+
+        if (verbose) cout << "\nTesting `bsl::uint64_t`." << endl;
+        testBulkOperationsForType<bsl::uint64_t>();
+
+        if (verbose) cout << "\nTesting `int`." << endl;
+        testBulkOperationsForType<int>();
+
+        if (verbose) cout << "\nTesting `short`." << endl;
+        testBulkOperationsForType<short>();
+
+        if (verbose) cout << "\nTesting `unsigned char`." << endl;
+        testBulkOperationsForType<unsigned char>();
+
+        if (verbose) cout << "\nTesting wrap-around of `sum`." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.append(k_INT64_MAX);
+            mX.append(2);
+            ASSERT(k_INT64_MIN + 1 == X.sum());
+
+            UnsignedObj mY;  const UnsignedObj& Y = mY;
+
+            mY.append(k_UINT64_MAX);
+            mY.append(3);
+            ASSERT(2 == Y.sum());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Element values[] = { 1, 2, 3 };
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_PASS(mX.append(0, 0));
+            ASSERT_FAIL(mX.append(0, 1));
+            ASSERT_PASS(mX.append(values, 3));
+
+            Element result[3];
+
+            ASSERT_PASS(X.loadElements(result, 0, 3));
+            ASSERT_PASS(X.loadElements(result, 3, 0));
+            ASSERT_FAIL(X.loadElements(result, 1, 3));
+            ASSERT_FAIL(X.loadElements(result, 4, 0));
+
+            ASSERT_PASS(X.minElement(2, 1));
+            ASSERT_FAIL(X.minElement(1, 0));
+            ASSERT_FAIL(X.minElement(2, 2));
+            ASSERT_PASS(X.maxElement(2, 1));
+            ASSERT_FAIL(X.maxElement(1, 0));
+            ASSERT_FAIL(X.maxElement(2, 2));
+
+            ASSERT_PASS(X.sum(3, 0));
+            ASSERT_FAIL(X.sum(2, 2));
+
+            Obj mY;  const Obj& Y = mY;
+
+            ASSERT_PASS(Y.sum());
+            ASSERT_FAIL(Y.minElement());
+            ASSERT_FAIL(Y.maxElement());
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING `hashAppend`
@@ -8406,6 +8745,70 @@ int main(int argc, char *argv[])
             ASSERT(false == X6[5]);         ASSERT(false == X6[7]);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the bulk operations with element-at-a-time loops.
+        //
+        // Concerns:
+        // 1. The bulk operations are faster than the equivalent loops using
+        //    `append(TYPE)` and `operator[]`.
+        //
+        // Plan:
+        // 1. Time appending, loading, and summing a large array using the
+        //    bulk operations and the equivalent element-at-a-time loops, and
+        //    report the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const bsl::size_t NUM_VALUES     = 1 << 20;
+        const int         NUM_ITERATIONS = 20;
+
+        bsl::vector<int> values(NUM_VALUES);
+        for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+            values[i] = static_cast<int>(i % 60000) - 30000;
+        }
+        bsl::vector<int> result(NUM_VALUES);
+
+        bdlc::PackedIntArray<int> mX;  const bdlc::PackedIntArray<int>& X = mX;
+
+        bsls::Types::Int64 total = 0;
+        bsls::Stopwatch    loopTimer;
+        bsls::Stopwatch    bulkTimer;
+
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            loopTimer.start();
+            mX.removeAll();
+            for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                mX.append(values[i]);
+            }
+            for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                result[i] = X[i];
+                total    += X[i];
+            }
+            loopTimer.stop();
+
+            bulkTimer.start();
+            mX.removeAll();
+            mX.append(values.data(), NUM_VALUES);
+            X.loadElements(result.data(), 0, NUM_VALUES);
+            total += X.sum();
+            bulkTimer.stop();
+        }
+
+        ASSERT(0 != total || 0 == total);
+
+        cout << "element-at-a-time: " << loopTimer.accumulatedWallTime()
+             << "s\n"
+             << "bulk:              " << bulkTimer.accumulatedWallTime()
+             << "s" << endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
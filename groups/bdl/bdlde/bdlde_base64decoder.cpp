@@ -6,7 +6,20 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_BASE64DECODER_SSSE3_ENABLED 1
+#include <cpuid.h>
+#include <tmmintrin.h>
+#endif
 
 namespace {
 namespace u {
@@ -166,6 +179,216 @@ static const char urlAlphabet[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+                        // ===================
+                        // FILE-SCOPE FUNCTIONS
+                        // ===================
+
+// The functions decoding whole 4-character groups ("quads") are where the bulk
+// of the time goes when decoding long input.  There is a portable
+// implementation and, on x86-64 with GCC or Clang, an SSSE3 implementation
+// compiled for that instruction set with a `target` attribute regardless of
+// the instruction set the rest of the build targets.  `decodeKernel` selects,
+// once per process, the fastest implementation the CPU supports.
+
+/// Alias for a function that decodes into the specified `output` the
+/// specified `numQuads` 4-character groups starting at the specified
+/// `input`, using the specified `alphabet` decoding table, stopping at the
+/// first group containing a character whose entry in `alphabet` is not a
+/// 6-bit value, and returns the number of groups decoded.
+typedef bsl::size_t (*DecodeFn)(char        *output,
+                                const char  *input,
+                                bsl::size_t  numQuads,
+                                const char  *alphabet);
+
+/// Decode into the specified `output` the specified `numQuads` 4-character
+/// groups starting at the specified `input`, using the specified `alphabet`
+/// decoding table, stopping at the first group containing a character whose
+/// entry in `alphabet` is not a 6-bit value.  Return the number of groups
+/// decoded.
+bsl::size_t decodeQuadsScalar(char        *output,
+                              const char  *input,
+                              bsl::size_t  numQuads,
+                              const char  *alphabet)
+{
+    const char *const originalInput = input;
+
+    for (; 0 < numQuads; --numQuads) {
+        const unsigned char *in = reinterpret_cast<const unsigned char *>(
+                                                                        input);
+        const unsigned x0 = static_cast<unsigned char>(alphabet[in[0]]);
+        const unsigned x1 = static_cast<unsigned char>(alphabet[in[1]]);
+        const unsigned x2 = static_cast<unsigned char>(alphabet[in[2]]);
+        const unsigned x3 = static_cast<unsigned char>(alphabet[in[3]]);
+
+        if ((x0 | x1 | x2 | x3) & 0x80) {
+            // Unknown character; could be an error or a character to ignore,
+            // either way leave it to character-by-character decoding.
+
+            break;
+        }
+
+        output[0] = static_cast<char>((x0 << 2) | (x1 >> 4));
+        output[1] = static_cast<char>((x1 << 4) | (x2 >> 2));
+        output[2] = static_cast<char>((x2 << 6) |  x3);
+
+        input  += 4;
+        output += 3;
+    }
+
+    return (input - originalInput) / 4;
+}
+
+#ifdef BDLDE_BASE64DECODER_SSSE3_ENABLED
+
+/// Decode into the specified `output` the specified `numQuads` 4-character
+/// groups starting at the specified `input`, using the specified `alphabet`
+/// decoding table, stopping at the first group containing a character whose
+/// entry in `alphabet` is not a 6-bit value, 4 groups at a time.  Return the
+/// number of groups decoded.
+__attribute__((target("ssse3")))
+bsl::size_t decodeQuadsSsse3(char        *output,
+                             const char  *input,
+                             bsl::size_t  numQuads,
+                             const char  *alphabet)
+{
+    const char *const originalInput = input;
+
+    // Load 16-byte slices of LUT.  Note that the entire 256-byte LUT is *not*
+    // loaded, but only the middle slices that are non-ff.
+
+    const __m128i *alphabetSlices =
+                                   reinterpret_cast<const __m128i *>(alphabet);
+    __m128i lut5 = _mm_loadu_si128(alphabetSlices + 7);
+    __m128i lut4 = _mm_loadu_si128(alphabetSlices + 6);
+    __m128i lut3 = _mm_loadu_si128(alphabetSlices + 5);
+    __m128i lut2 = _mm_loadu_si128(alphabetSlices + 4);
+    __m128i lut1 = _mm_loadu_si128(alphabetSlices + 3);
+    __m128i lut0 = _mm_loadu_si128(alphabetSlices + 2);
+
+    // Heavily inspired by techniques outlined in
+    // http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+
+    // xor LUT fragments together for pshufb-xor chaining below.
+
+    lut5 = _mm_xor_si128(lut5, lut4);
+    lut4 = _mm_xor_si128(lut4, lut3);
+    lut3 = _mm_xor_si128(lut3, lut2);
+    lut2 = _mm_xor_si128(lut2, lut1);
+    lut1 = _mm_xor_si128(lut1, lut0);
+
+    const __m128i slice     = _mm_set1_epi8(0x10);
+    const __m128i highBits  = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i selection = _mm_setr_epi8( 2,  1,  0,  6,  5,  4,
+                                            10,  9,  8, 14, 13, 12,
+                                            -1, -1, -1, -1);
+
+    for (; 4 <= numQuads; numQuads -= 4) {
+        // Load 16 base64 characters (will eventually be transformed into
+        // 12 bytes).
+
+        __m128i x = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+
+        // Offset indexes to match first LUT slice at offset 0x20.  If
+        // indexes were < 0x20, 'x' will contain negative values which we
+        // will check for later (minimum bounds check).
+
+        x = _mm_subs_epi8(x, _mm_set1_epi8(0x20));
+        const __m128i tooSmall = x;
+
+        // Using the characters as indexes, look up the corresponding
+        // values from the LUT.  If an index is non-negative, only its low
+        // 4 bits are considered.  If an index is negative, 0 is returned
+        // for its lookup value.
+
+        __m128i decoded = _mm_shuffle_epi8(lut0, x);
+
+        // Advance to each subsequent LUT slice in turn.  Note that if the
+        // previous slice was the correct one for a given index, the index
+        // will become negative after this, resulting in subsequent
+        // lookups simply xor-ing 0 (harmless no-ops), while for
+        // non-negative indices, the xor with the previous LUT slice value
+        // cancels out the xor-ing done to the LUT slices above the loop,
+        // leaving the original value from this LUT slice.
+
+        x = _mm_subs_epi8(x, slice);
+        decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut1, x));
+        x = _mm_subs_epi8(x, slice);
+        decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut2, x));
+        x = _mm_subs_epi8(x, slice);
+        decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut3, x));
+        x = _mm_subs_epi8(x, slice);
+        decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut4, x));
+        x = _mm_subs_epi8(x, slice);
+        decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut5, x));
+        x = _mm_subs_epi8(x, slice);
+
+        // At this point, the indexes in 'x' should be negative, as we've
+        // exhausted all populated LUT slices.  If any are not, that
+        // indicates the maximum bounds check failed.  Check the minimum
+        // and maximum bounds were respected, as well as for any 'ff'
+        // values loaded from LUT slices themselves.
+
+        const __m128i invalid = _mm_or_si128(
+                                     _mm_or_si128(tooSmall, decoded),
+                                     _mm_andnot_si128(x, highBits));
+        if (_mm_movemask_epi8(invalid)) {
+            // Unknown character; finish with the quads preceding it.
+
+            break;
+        }
+
+        // 'decoded' currently contains dwords laid out like
+        // |00aaaaaa|00bbbbbb|00cccccc|00dddddd|.  Convert to
+        // |0000aaaa aabbbbbb|0000cccc ccdddddd| with a multiply-add, and
+        // then to |00000000 aaaaaabb bbbbcccc ccdddddd| with another, so
+        // that each triplet of values is aligned to a byte boundary.
+
+        decoded = _mm_maddubs_epi16(decoded, _mm_set1_epi16(0x0140));
+        decoded = _mm_madd_epi16(decoded, _mm_set1_epi32(0x00011000));
+
+        // Take care of endianness and the last four one-byte gaps by
+        // explicitly selecting each byte we want in order.
+
+        decoded = _mm_shuffle_epi8(decoded, selection);
+
+        bsl::memcpy(output, &decoded, 12);
+
+        input  += 16;
+        output += 12;
+    }
+
+    return (input - originalInput) / 4
+         + decodeQuadsScalar(output, input, numQuads, alphabet);
+}
+
+#endif  // BDLDE_BASE64DECODER_SSSE3_ENABLED
+
+/// Return the implementation of the decoding of quads best suited to the
+/// current CPU.
+DecodeFn selectDecodeKernel()
+{
+#ifdef BDLDE_BASE64DECODER_SSSE3_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3)) {
+        return &decodeQuadsSsse3;                                     // RETURN
+    }
+#endif
+
+    return &decodeQuadsScalar;
+}
+
+/// Return the implementation of the decoding of quads, selected once per
+/// process, best suited to the current CPU.
+DecodeFn decodeKernel()
+{
+    static DecodeFn s_kernel;
+    BSLMT_ONCE_DO {
+        s_kernel = selectDecodeKernel();
+    }
+    return s_kernel;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -176,6 +399,27 @@ namespace bdlde {
                          // class Base64Decoder
                          // -------------------
 
+// PRIVATE CLASS METHODS
+int Base64Decoder::decodeQuads(char       *out,
+                               const char *begin,
+                               const char *end,
+                               int         maxNumOut,
+                               const char *alphabet)
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(alphabet);
+
+    bsl::size_t maxNumQuads = (end - begin) / 4;
+    if (0 <= maxNumOut) {
+        maxNumQuads = bsl::min<bsl::size_t>(maxNumQuads, maxNumOut / 3);
+    }
+
+    return static_cast<int>(u::decodeKernel()(out,
+                                               begin,
+                                               maxNumQuads,
+                                               alphabet));
+}
+
 // CREATORS
 Base64Decoder::Base64Decoder(const Base64DecoderOptions& options)
 : d_outputLength(0)
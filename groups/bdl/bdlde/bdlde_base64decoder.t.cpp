@@ -240,6 +240,7 @@ using bsl::ptrdiff_t;
 // [11] STRESS TEST: The decoder properly decodes all encoded output.
 // [13] TABLE PLUS RANDOM TESTING, UNPADDED MODE, INJECTED GARBAGE
 // [14] 0 == U_ENABLE_DEPRECATIONS
+// [15] CONCERN: 'char *'/'const char *' conversion matches generic path
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -2387,6 +2388,179 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(15)
+{
+    // ------------------------------------------------------------------------
+    // TESTING BLOCK CONVERSION
+    //
+    // Concerns:
+    //: 1 'convert' called with 'char *' output and 'const char *' input
+    //:   (which decodes a block of quads at a time) produces exactly the same
+    //:   output, return values, 'numOut', 'numIn', and subsequent object
+    //:   state as 'convert' called with any other iterator types.
+    //:
+    //: 2 This holds for every alphabet, padding, and ignore mode, for input
+    //:   with and without line breaks, injected whitespace, and injected
+    //:   garbage (in particular, ignored characters within a block, after
+    //:   which block decoding must resume), and for chunks and 'maxNumOut'
+    //:   limits that end anywhere within a quad.
+    //
+    // Plan:
+    //: 1 Using 'u::RandGen', generate random data, encode it with a
+    //:   'bdlde::Base64Encoder' with a variety of line lengths, and
+    //:   optionally inject whitespace or garbage.  For every combination of
+    //:   decoder options, and a variety of chunk sizes and 'maxNumOut'
+    //:   limits, drive two decoders through identical call sequences, one
+    //:   with 'const char *' input and one with 'char *' input (which takes
+    //:   the generic path), and verify that all results and accessors agree
+    //:   after every call.  (C-1..2)
+    //
+    // Testing:
+    //   CONCERN: 'char *'/'const char *' conversion matches generic path
+    // ------------------------------------------------------------------------
+
+    (void)veryVeryVeryVerbose;
+    (void)veryVeryVerbose;
+
+    if (verbose) cout << "TESTING BLOCK CONVERSION\n"
+                         "========================\n";
+
+    static const int LINE_LENGTHS[] = { 0, 7, 76 };
+    static const int CHUNKS[]       = { 1, 3, 16, 17, 64, 1000 };
+    static const int LIMITS[]       = { -1, 0, 1, 12, 13 };
+
+    const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS / sizeof *LINE_LENGTHS;
+    const int NUM_CHUNKS       = sizeof CHUNKS / sizeof *CHUNKS;
+    const int NUM_LIMITS       = sizeof LIMITS / sizeof *LIMITS;
+
+    u::RandGen  rand;
+    bsl::string data;
+    bsl::string encoded;
+
+    for (int ti = 0; ti < 2 * 2 * NUM_LINE_LENGTHS * 3; ++ti) {
+        const int         LI          = ti / 4 % NUM_LINE_LENGTHS;
+        const Alpha::Enum ALPHA       = ti % 2 ? Alpha::e_URL : Alpha::e_BASIC;
+        const bool        PADDED      = ti / 2 % 2;
+        const int         LINE_LENGTH = LINE_LENGTHS[LI];
+        const int         INJECT      = ti / (4 * NUM_LINE_LENGTHS);
+
+        if (veryVerbose) {
+            P_(ALPHA) P_(PADDED) P_(LINE_LENGTH) P(INJECT);
+        }
+
+        for (int len = 0; len <= 120; len += len < 40 ? 1 : 7) {
+            rand.randString(&data, len);
+
+            encoded.clear();
+            bdlde::Base64Encoder encoder(EncoderOptions::custom(LINE_LENGTH,
+                                                                ALPHA,
+                                                                PADDED));
+            bsl::back_insert_iterator<bsl::string> inserter(encoded);
+            ASSERT(0 == encoder.convert(inserter, data.begin(), data.end()));
+            ASSERT(0 == encoder.endConvert(inserter));
+
+            if (1 == INJECT) {
+                rand.injectWhitespace(&encoded);
+            }
+            else if (2 == INJECT) {
+                rand.injectGarbage(&encoded, !PADDED, Alpha::e_URL == ALPHA);
+            }
+
+            const int IN_LEN = static_cast<int>(encoded.size());
+
+            for (int mi = 0; mi < 3; ++mi) {
+                const Options OPTIONS = Options::custom(
+                                                 static_cast<Ignore::Enum>(mi),
+                                                 ALPHA,
+                                                 PADDED);
+
+                for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+                for (int li = 0; li < NUM_LIMITS; ++li) {
+                    const int CHUNK = CHUNKS[ci];
+                    const int LIMIT = LIMITS[li];
+
+                    Obj mX(OPTIONS);  const Obj& X = mX;  // block path
+                    Obj mY(OPTIONS);  const Obj& Y = mY;  // generic path
+
+                    bsl::vector<char> outX(len + 1, '#');
+                    bsl::vector<char> outY(len + 1, '#');
+
+                    const char *inX = encoded.data();
+                    char       *inY = &encoded[0];
+                    const char *end = inX + IN_LEN;
+                    char       *oX  = outX.data();
+                    char       *oY  = outY.data();
+
+                    for (int iter = 0; iter < 4 * IN_LEN + 4; ++iter) {
+                        const int avail = static_cast<int>(end - inX);
+                        const int n     = avail < CHUNK ? avail : CHUNK;
+                        const int max   = 0 == LIMIT && iter % 2 ? 1 : LIMIT;
+
+                        int numOutX = -1, numInX = -1;
+                        int numOutY = -1, numInY = -1;
+
+                        const int rcX = mX.convert(oX,
+                                                   &numOutX,
+                                                   &numInX,
+                                                   inX,
+                                                   inX + n,
+                                                   max);
+                        const int rcY = mY.convert(oY,
+                                                   &numOutY,
+                                                   &numInY,
+                                                   inY,
+                                                   inY + n,
+                                                   max);
+
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter, rcX, rcY,
+                                rcX == rcY);
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                numOutX, numOutY, numOutX == numOutY);
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                numInX, numInY, numInX == numInY);
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                X.outputLength() == Y.outputLength());
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                X.isAcceptable() == Y.isAcceptable());
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                X.isMaximal() == Y.isMaximal());
+                        ASSERTV(ti, len, mi, CHUNK, LIMIT, iter,
+                                X.isError() == Y.isError());
+
+                        if (numInX != numInY || numOutX != numOutY ||
+                                                                     rcX < 0) {
+                            break;
+                        }
+
+                        oX  += numOutX;
+                        oY  += numOutY;
+                        inX += numInX;
+                        inY += numInY;
+
+                        if (inX == end && 0 == rcX) {
+                            break;
+                        }
+                    }
+
+                    int numOutX = -1;
+                    int numOutY = -1;
+
+                    const int rcX = mX.endConvert(oX, &numOutX);
+                    const int rcY = mY.endConvert(oY, &numOutY);
+
+                    ASSERTV(ti, len, mi, CHUNK, LIMIT, rcX, rcY, rcX == rcY);
+                    ASSERTV(ti, len, mi, CHUNK, LIMIT, numOutX == numOutY);
+                    ASSERTV(ti, len, mi, CHUNK, LIMIT,
+                            X.isDone() == Y.isDone());
+                    ASSERTV(ti, len, mi, CHUNK, LIMIT, outX == outY);
+                    ASSERTV(ti, len, mi, CHUNK, LIMIT, '#' == outX.back());
+                }
+                }
+            }
+        }
+    }
+}
+
 DEFINE_TEST_CASE(14)
 {
     // ------------------------------------------------------------------------
@@ -8037,6 +8211,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(15);
         CASE(14);
         CASE(13);
         CASE(12);
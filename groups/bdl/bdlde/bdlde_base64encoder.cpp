@@ -4,7 +4,23 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_BASE64ENCODER_SSSE3_ENABLED 1
+#include <cpuid.h>
+#include <tmmintrin.h>
+#endif
 
 namespace {
 namespace u {
@@ -43,6 +59,234 @@ const char base64url[] = {
     '4', '5', '6', '7', '8', '9', '-', '_',  // 070
 };
 
+                        // ===================
+                        // FILE-SCOPE FUNCTIONS
+                        // ===================
+
+// The functions encoding whole 3-byte groups ("triplets") are where the bulk
+// of the time goes when encoding long input.  There is a portable
+// implementation, an SSE2 implementation used on every x86 target, and, on
+// x86-64 with GCC or Clang, an SSSE3 implementation compiled for that
+// instruction set with a `target` attribute regardless of the instruction set
+// the rest of the build targets.  `encodeKernel` selects, once per process,
+// the fastest implementation the CPU supports.
+
+/// Alias for a function that writes to the specified `output` the
+/// `4 * numTriplets` characters of the specified `alphabet` that encode the
+/// specified `numTriplets` 3-byte groups starting at the specified `input`.
+typedef void (*EncodeFn)(char                *output,
+                         const unsigned char *input,
+                         bsl::size_t          numTriplets,
+                         const char          *alphabet);
+
+/// Write to the specified `output` the `4 * numTriplets` characters of the
+/// specified `alphabet` that encode the specified `numTriplets` 3-byte groups
+/// starting at the specified `input`.
+void encodeTripletsScalar(char                *output,
+                          const unsigned char *input,
+                          bsl::size_t          numTriplets,
+                          const char          *alphabet)
+{
+    for (; 0 < numTriplets; --numTriplets) {
+        const unsigned value = (static_cast<unsigned>(input[0]) << 16) |
+                               (static_cast<unsigned>(input[1]) <<  8) |
+                                static_cast<unsigned>(input[2]);
+
+        output[0] = alphabet[ value >> 18        ];
+        output[1] = alphabet[(value >> 12) & 0x3f];
+        output[2] = alphabet[(value >>  6) & 0x3f];
+        output[3] = alphabet[ value        & 0x3f];
+
+        input  += 3;
+        output += 4;
+    }
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+
+/// Return the 4 characters of the specified `alphabet` encoding each of the
+/// 6-bit values in the 16 bytes of the specified `spread`, in which each
+/// 32-bit lane holds a 3-byte group laid out as
+/// `|bbbbcccc|aaaaaabb|ccdddddd|bbbbcccc|`.  Shift each 6-bit value into its
+/// own byte with a pair of multiplies, after
+/// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html, and map the
+/// values to characters by range using comparisons.
+inline
+__m128i encodeSpreadSse2(__m128i spread, const char *alphabet)
+{
+    const __m128i ac = _mm_mulhi_epu16(
+                            _mm_and_si128(spread, _mm_set1_epi32(0x0fc0fc00)),
+                            _mm_set1_epi32(0x04000040));
+    const __m128i bd = _mm_mullo_epi16(
+                            _mm_and_si128(spread, _mm_set1_epi32(0x003f03f0)),
+                            _mm_set1_epi32(0x01000010));
+    const __m128i values = _mm_or_si128(ac, bd);
+
+    // Accumulate the offset to add to each value: 'A' for '[A-Z]', adjusted
+    // in turn for values beyond the end of each range.
+
+    const char a = static_cast<char>('a' - 26 - 'A');
+    const char d = static_cast<char>('0' - 52 - ('a' - 26));
+    const char p = static_cast<char>(alphabet[62] - 62 - ('0' - 52));
+    const char q = static_cast<char>(alphabet[63] - alphabet[62] - 1);
+
+    __m128i offsets = _mm_set1_epi8('A');
+    offsets = _mm_add_epi8(offsets,
+                           _mm_and_si128(_mm_cmpgt_epi8(values,
+                                                        _mm_set1_epi8(25)),
+                                         _mm_set1_epi8(a)));
+    offsets = _mm_add_epi8(offsets,
+                           _mm_and_si128(_mm_cmpgt_epi8(values,
+                                                        _mm_set1_epi8(51)),
+                                         _mm_set1_epi8(d)));
+    offsets = _mm_add_epi8(offsets,
+                           _mm_and_si128(_mm_cmpgt_epi8(values,
+                                                        _mm_set1_epi8(61)),
+                                         _mm_set1_epi8(p)));
+    offsets = _mm_add_epi8(offsets,
+                           _mm_and_si128(_mm_cmpgt_epi8(values,
+                                                        _mm_set1_epi8(62)),
+                                         _mm_set1_epi8(q)));
+
+    return _mm_add_epi8(values, offsets);
+}
+
+/// Return the 32-bit lane holding the 3 bytes starting at the specified
+/// `input` laid out as `|bbbbcccc|aaaaaabb|ccdddddd|bbbbcccc|`.
+inline
+int spreadTriplet(const unsigned char *input)
+{
+    return static_cast<int>(  static_cast<unsigned>(input[1])
+                            | static_cast<unsigned>(input[0]) <<  8
+                            | static_cast<unsigned>(input[2]) << 16
+                            | static_cast<unsigned>(input[1]) << 24);
+}
+
+/// Write to the specified `output` the `4 * numTriplets` characters of the
+/// specified `alphabet` that encode the specified `numTriplets` 3-byte groups
+/// starting at the specified `input`, 4 groups at a time.  Note that, lacking
+/// a byte shuffle, SSE2 assembles the lanes with scalar loads.
+void encodeTripletsSse2(char                *output,
+                        const unsigned char *input,
+                        bsl::size_t          numTriplets,
+                        const char          *alphabet)
+{
+    for (; 4 <= numTriplets; numTriplets -= 4) {
+        const __m128i spread = _mm_setr_epi32(spreadTriplet(input),
+                                              spreadTriplet(input + 3),
+                                              spreadTriplet(input + 6),
+                                              spreadTriplet(input + 9));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                         encodeSpreadSse2(spread, alphabet));
+
+        input  += 12;
+        output += 16;
+    }
+    encodeTripletsScalar(output, input, numTriplets, alphabet);
+}
+
+#endif  // BSLS_PLATFORM_CPU_SSE2
+
+#ifdef BDLDE_BASE64ENCODER_SSSE3_ENABLED
+
+/// Write to the specified `output` the `4 * numTriplets` characters of the
+/// specified `alphabet` that encode the specified `numTriplets` 3-byte groups
+/// starting at the specified `input`, 4 groups at a time, after
+/// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html.
+__attribute__((target("ssse3")))
+void encodeTripletsSsse3(char                *output,
+                         const unsigned char *input,
+                         bsl::size_t          numTriplets,
+                         const char          *alphabet)
+{
+    // Each iteration loads 16 bytes, so at least 6 groups must remain.
+
+    const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                         7, 6, 8, 7, 10, 9, 11, 10);
+
+    // The offset to add to each 6-bit value, selected by range: 0 for
+    // '[a-z]', 1-10 for '[0-9]', 11 and 12 for the last two characters of
+    // the alphabet, and 13 for '[A-Z]'.
+
+    const __m128i offsets = _mm_setr_epi8(
+                                   'a' - 26,
+                                   '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                   '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                   '0' - 52, '0' - 52,
+                                   static_cast<char>(alphabet[62] - 62),
+                                   static_cast<char>(alphabet[63] - 63),
+                                   'A',
+                                   0,
+                                   0);
+
+    for (; 6 <= numTriplets; numTriplets -= 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+
+        // Place each group of 3 bytes in a 32-bit lane as
+        // '|bbbbcccc|aaaaaabb|ccdddddd|bbbbcccc|' and then shift each 6-bit
+        // value into its own byte with a pair of multiplies.
+
+        x = _mm_shuffle_epi8(x, spread);
+
+        const __m128i ac = _mm_mulhi_epu16(
+                                 _mm_and_si128(x, _mm_set1_epi32(0x0fc0fc00)),
+                                 _mm_set1_epi32(0x04000040));
+        const __m128i bd = _mm_mullo_epi16(
+                                 _mm_and_si128(x, _mm_set1_epi32(0x003f03f0)),
+                                 _mm_set1_epi32(0x01000010));
+        const __m128i values = _mm_or_si128(ac, bd);
+
+        // Reduce each value to the index of its range in 'offsets'.
+
+        __m128i range = _mm_subs_epu8(values, _mm_set1_epi8(51));
+        range = _mm_or_si128(range,
+                             _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                          values),
+                                           _mm_set1_epi8(13)));
+
+        const __m128i chars = _mm_add_epi8(values,
+                                           _mm_shuffle_epi8(offsets, range));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), chars);
+
+        input  += 12;
+        output += 16;
+    }
+    encodeTripletsScalar(output, input, numTriplets, alphabet);
+}
+
+#endif  // BDLDE_BASE64ENCODER_SSSE3_ENABLED
+
+/// Return the implementation of the encoding of triplets best suited to the
+/// current CPU.
+EncodeFn selectEncodeKernel()
+{
+#ifdef BDLDE_BASE64ENCODER_SSSE3_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3)) {
+        return &encodeTripletsSsse3;                                  // RETURN
+    }
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    return &encodeTripletsSse2;
+#else
+    return &encodeTripletsScalar;
+#endif
+}
+
+/// Return the implementation of the encoding of triplets, selected once per
+/// process, best suited to the current CPU.
+EncodeFn encodeKernel()
+{
+    static EncodeFn s_kernel;
+    BSLMT_ONCE_DO {
+        s_kernel = selectEncodeKernel();
+    }
+    return s_kernel;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -105,6 +349,79 @@ Base64Encoder::~Base64Encoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// PRIVATE MANIPULATORS
+void Base64Encoder::encodeTriplets(char       **out,
+                                   const char **begin,
+                                   const char  *end,
+                                   int          maxLength)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+    BSLS_ASSERT(*begin <= end);
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    if (0 < d_maxLineLength && d_maxLineLength < 4) {
+        return;                                                       // RETURN
+    }
+
+    // Note that 'maxLength' is less than 'd_outputLength' exactly when no
+    // limit on the output was specified.
+
+    const bool isLimited = d_outputLength <= maxLength;
+
+    while (true) {
+        bsl::size_t numTriplets = (end - *begin) / 3;
+        bsl::size_t avail       = isLimited
+                                ? static_cast<bsl::size_t>(maxLength -
+                                                           d_outputLength)
+                                : bsl::numeric_limits<bsl::size_t>::max();
+
+        if (d_maxLineLength) {
+            if (d_lineLength == d_maxLineLength) {
+                if (0 == numTriplets || avail < 6) {
+                    return;                                           // RETURN
+                }
+                (*out)[0] = '\r';
+                (*out)[1] = '\n';
+                *out           += 2;
+                d_outputLength += 2;
+                d_lineLength    = 0;
+                avail          -= 2;
+            }
+            else if (d_lineLength > d_maxLineLength) {
+                // Only the '\r' of a soft line break has been emitted.
+
+                return;                                               // RETURN
+            }
+
+            numTriplets = bsl::min<bsl::size_t>(
+                                         numTriplets,
+                                         (d_maxLineLength - d_lineLength) / 4);
+        }
+
+        numTriplets = bsl::min(numTriplets, avail / 4);
+        if (0 == numTriplets) {
+            return;                                                   // RETURN
+        }
+
+        u::encodeKernel()(*out,
+                          reinterpret_cast<const unsigned char *>(*begin),
+                          numTriplets,
+                          d_alphabet_p);
+
+        const int numEmitted = static_cast<int>(4 * numTriplets);
+
+        *begin         += 3 * numTriplets;
+        *out           += numEmitted;
+        d_outputLength += numEmitted;
+        d_lineLength   += numEmitted;
+
+        if (0 == d_maxLineLength) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -513,6 +513,23 @@ class Base64Encoder {
     template <class OUTPUT_ITERATOR>
     void encode(OUTPUT_ITERATOR *out, int maxLength);
 
+    /// Encode as many complete 3-byte groups of the input starting at the
+    /// specified `*begin` position up to, but not including, the specified
+    /// `end` position as fit on the current output line (and on subsequent
+    /// lines, inserting soft line breaks between them), writing the
+    /// resulting characters to the specified `*out` without the total
+    /// number of emitted characters exceeding the specified `maxLength`
+    /// (if `maxLength` is less than the number of characters emitted so
+    /// far, no limit is imposed).  Advance `*begin` and `*out` past the
+    /// consumed input and the produced output, respectively.  The behavior
+    /// is undefined unless this encoder retains no input bits.  Note that
+    /// this method encodes a block of input at a time, and is used by the
+    /// `char *` specialization of `convert`.
+    void encodeTriplets(char       **out,
+                        const char **begin,
+                        const char  *end,
+                        int          maxLength);
+
     /// Set the state to the specified `newState`.
     void setState(State newState);
 
@@ -672,7 +689,9 @@ class Base64Encoder {
     /// also that it is recommended that after all calls to `convert` are
     /// finished, the `endConvert` method be called to complete the encoding
     /// of any unprocessed input characters that do not complete a 3-byte
-    /// sequence.
+    /// sequence.  Also note that when `OUTPUT_ITERATOR` is `char *` and
+    /// `INPUT_ITERATOR` is `const char *`, the input is encoded a block at
+    /// a time, which is considerably faster for large inputs.
     template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
     int convert(OUTPUT_ITERATOR out,
                 INPUT_ITERATOR  begin,
@@ -1027,6 +1046,74 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
     return 0;
 }
 
+template <>
+inline
+int Base64Encoder::convert<char *, const char *>(char       *out,
+                                                 int        *numOut,
+                                                 int        *numIn,
+                                                 const char *begin,
+                                                 const char *end,
+                                                 int         maxNumOut)
+{
+    int dummyNumOut;
+    if (!numOut) {
+        numOut = &dummyNumOut;
+    }
+    int dummyNumIn;
+    if (!numIn) {
+        numIn  = &dummyNumIn;
+    }
+
+    if (e_ERROR_STATE == state() || e_DONE_STATE == state()) {
+        setState(e_ERROR_STATE);
+        *numOut = 0;
+        *numIn  = 0;
+        return -1;                                                    // RETURN
+    }
+
+    const int initialLength = d_outputLength;
+    const int maxLength     = d_outputLength + maxNumOut;
+
+    // Emit as many output bytes as possible.
+
+    while (6 <= d_bitsInStack && d_outputLength != maxLength) {
+        encode(&out, maxLength);
+    }
+
+    // Consume as many input bytes as possible, encoding whole 3-byte groups
+    // a block at a time whenever no input bits are retained.
+
+    const char *const originalBegin = begin;
+
+    while (4 >= d_bitsInStack && begin != end) {
+        if (0 == d_bitsInStack && 3 <= end - begin) {
+            encodeTriplets(&out, &begin, end, maxLength);
+            if (begin == end) {
+                break;
+            }
+        }
+
+        const unsigned char byte = static_cast<unsigned char>(*begin);
+
+        ++begin;
+
+        d_stack        = (d_stack << 8) | byte;
+        d_bitsInStack += 8;
+
+        if (d_outputLength != maxLength) {
+            encode(&out, maxLength);
+            if (6 <= d_bitsInStack && d_outputLength != maxLength) {
+                encode(&out, maxLength);
+            }
+        }
+    }
+
+    *numIn  = static_cast<int>(begin - originalBegin);
+    *numOut = d_outputLength - initialLength;
+
+    return 0;
+}
+
 template <class OUTPUT_ITERATOR>
 int Base64Encoder::endConvert(OUTPUT_ITERATOR out)
 {
@@ -133,7 +133,8 @@ using bsl::ptrdiff_t;
 // [ 3] int outputLength() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
+// [15] CONCERN: 'char *'/'const char *' conversion matches generic path
 // [14] 0 == U_ENABLE_DEPRECATIONS
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
@@ -1918,7 +1919,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Demonstrate that the example compiles, links, and runs.
@@ -1972,6 +1973,159 @@ int main(int argc, char *argv[])
 
         ASSERT(inStr == backInStream.str());
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK CONVERSION
+        //
+        // Concerns:
+        //: 1 'convert' called with 'char *' output and 'const char *' input
+        //:   (which encodes a block of triplets at a time) produces exactly
+        //:   the same output, return values, 'numOut', 'numIn', and
+        //:   subsequent object state as 'convert' called with any other
+        //:   iterator types.
+        //:
+        //: 2 This holds for every alphabet, padding, and maximum line length
+        //:   (including line lengths shorter than one quad and lengths that
+        //:   are not a multiple of four), for every input length, and for
+        //:   chunks and 'maxNumOut' limits that end anywhere within a quad
+        //:   or a line break.
+        //
+        // Plan:
+        //: 1 Using pseudo-random data, for every combination of options from
+        //:   a representative set, a variety of lengths, chunk sizes, and
+        //:   'maxNumOut' limits, drive two encoders through identical call
+        //:   sequences, one with 'const char *' input and one with 'char *'
+        //:   input (which takes the generic path), and verify that all
+        //:   results and accessors agree after every call.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'char *'/'const char *' conversion matches generic path
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BLOCK CONVERSION" << endl
+                          << "========================" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 16, 76 };
+        static const int CHUNKS[]       = { 1, 2, 3, 11, 12, 13, 47, 1000 };
+        static const int LIMITS[]       = { -1, 0, 1, 5, 6, 22, 77 };
+
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS /
+                                                         sizeof *LINE_LENGTHS;
+        const int NUM_CHUNKS       = sizeof CHUNKS / sizeof *CHUNKS;
+        const int NUM_LIMITS       = sizeof LIMITS / sizeof *LIMITS;
+
+        bsl::vector<char> input;
+        unsigned int      seed = 1;
+
+        for (int ti = 0; ti < 2 * 2 * NUM_LINE_LENGTHS; ++ti) {
+            const Alphabet::Enum ALPHABET    = ti % 2 ? Alphabet::e_URL
+                                                      : Alphabet::e_BASIC;
+            const bool           PADDED      = ti / 2 % 2;
+            const int            LINE_LENGTH = LINE_LENGTHS[ti / 4];
+
+            const EncoderOptions OPTIONS = EncoderOptions::custom(LINE_LENGTH,
+                                                                  ALPHABET,
+                                                                  PADDED);
+
+            if (veryVerbose) {
+                T_ P_(ALPHABET) P_(PADDED) P(LINE_LENGTH)
+            }
+
+            for (int len = 0; len <= 130; len += len < 40 ? 1 : 9) {
+                input.resize(len + 1);
+                for (int i = 0; i < len; ++i) {
+                    seed     = seed * 1103515245u + 12345u;
+                    input[i] = static_cast<char>(seed >> 16);
+                }
+
+                const int OUT_LEN = static_cast<int>(
+                                          Obj::encodedLength(OPTIONS, len));
+
+                for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+                for (int li = 0; li < NUM_LIMITS; ++li) {
+                    const int CHUNK = CHUNKS[ci];
+                    const int LIMIT = LIMITS[li];
+
+                    Obj mX(OPTIONS);  const Obj& X = mX;  // block path
+                    Obj mY(OPTIONS);  const Obj& Y = mY;  // generic path
+
+                    bsl::vector<char> outX(OUT_LEN + 1, '#');
+                    bsl::vector<char> outY(OUT_LEN + 1, '#');
+
+                    const char *inX  = input.data();
+                    char       *inY  = input.data();
+                    const char *end  = inX + len;
+                    char       *oX   = outX.data();
+                    char       *oY   = outY.data();
+
+                    for (int iter = 0; iter < 4 * OUT_LEN + 4; ++iter) {
+                        const int avail = static_cast<int>(end - inX);
+                        const int n     = avail < CHUNK ? avail : CHUNK;
+                        const int max   = 0 == LIMIT && iter % 2
+                                        ? 1
+                                        : LIMIT;
+
+                        int numOutX = -1, numInX = -1;
+                        int numOutY = -1, numInY = -1;
+
+                        const int rcX = mX.convert(oX,
+                                                   &numOutX,
+                                                   &numInX,
+                                                   inX,
+                                                   inX + n,
+                                                   max);
+                        const int rcY = mY.convert(oY,
+                                                   &numOutY,
+                                                   &numInY,
+                                                   inY,
+                                                   inY + n,
+                                                   max);
+
+                        LOOP5_ASSERT(ti, len, CHUNK, LIMIT, iter,
+                                     rcX == rcY);
+                        LOOP5_ASSERT(ti, len, CHUNK, LIMIT, iter,
+                                     numOutX == numOutY);
+                        LOOP5_ASSERT(ti, len, CHUNK, LIMIT, iter,
+                                     numInX == numInY);
+                        LOOP5_ASSERT(ti, len, CHUNK, LIMIT, iter,
+                                     X.outputLength() == Y.outputLength());
+                        LOOP5_ASSERT(ti, len, CHUNK, LIMIT, iter,
+                                     X.isAcceptable() == Y.isAcceptable());
+
+                        if (numInX != numInY || numOutX != numOutY) {
+                            break;
+                        }
+
+                        oX  += numOutX;
+                        oY  += numOutY;
+                        inX += numInX;
+                        inY += numInY;
+
+                        if (inX == end && 0 == rcX) {
+                            break;
+                        }
+                    }
+
+                    int numOutX = -1;
+                    int numOutY = -1;
+
+                    const int rcX = mX.endConvert(oX, &numOutX);
+                    const int rcY = mY.endConvert(oY, &numOutY);
+
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT, rcX == rcY);
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT, numOutX == numOutY);
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT,
+                                 X.isDone() && Y.isDone());
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT,
+                                 OUT_LEN == X.outputLength());
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT, outX == outY);
+                    LOOP4_ASSERT(ti, len, CHUNK, LIMIT, '#' == outX.back());
+                }
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // ENSURE U_ENABLE_DEPRECATIONS IS DISABLED
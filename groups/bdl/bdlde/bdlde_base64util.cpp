@@ -0,0 +1,113 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64encoder.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+bsl::size_t Base64Util::encodedLength(const Base64EncoderOptions& options,
+                                      bsl::size_t                 inputLength)
+{
+    return Base64Encoder::encodedLength(options, inputLength);
+}
+
+bsl::size_t Base64Util::maxDecodedLength(bsl::size_t inputLength)
+{
+    return (inputLength + 3) / 4 * 3;
+}
+
+bsl::span<char> Base64Util::encode(bsl::span<char>             output,
+                                   bsl::span<const char>       input,
+                                   const Base64EncoderOptions& options)
+{
+    BSLS_ASSERT(encodedLength(options, input.size()) <= output.size());
+    BSLS_ASSERT(encodedLength(options, input.size()) <=
+                   static_cast<bsl::size_t>(bsl::numeric_limits<int>::max()));
+
+    Base64Encoder encoder(options);
+
+    char       *out = output.data();
+    const char *in  = input.data();
+    int         numOut;
+    int         numIn;
+
+    int rc = encoder.convert(out, &numOut, &numIn, in, in + input.size());
+    BSLS_ASSERT(0 == rc);
+
+    out += numOut;
+
+    rc = encoder.endConvert(out, &numOut);
+    BSLS_ASSERT(0 == rc);
+    (void)rc;
+
+    out += numOut;
+
+    return output.first(out - output.data());
+}
+
+int Base64Util::decode(bsl::span<char>             *result,
+                       bsl::span<char>              output,
+                       bsl::span<const char>        input,
+                       const Base64DecoderOptions&  options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(maxDecodedLength(input.size()) <= output.size());
+    BSLS_ASSERT(input.size() <=
+                   static_cast<bsl::size_t>(bsl::numeric_limits<int>::max()));
+
+    Base64Decoder decoder(options);
+
+    char       *out = output.data();
+    const char *in  = input.data();
+    int         numOut;
+    int         numIn;
+
+    if (0 > decoder.convert(out, &numOut, &numIn, in, in + input.size())) {
+        return -1;                                                    // RETURN
+    }
+
+    out += numOut;
+
+    if (0 > decoder.endConvert(out, &numOut)) {
+        return -1;                                                    // RETURN
+    }
+
+    out += numOut;
+
+    *result = output.first(out - output.data());
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
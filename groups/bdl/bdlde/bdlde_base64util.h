@@ -0,0 +1,172 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functions to encode and decode Base64 in a single call.
+//
+//@CLASSES:
+//  bdlde::Base64Util: namespace for one-shot Base64 encoding and decoding
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder, bdlde_hexutil
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlde::Base64Util`, that
+// serves as a namespace for functions that encode a complete sequence of
+// bytes into its Base64 representation, and decode a complete Base64
+// representation back into bytes, in a single call.  The encoding produced
+// and the input accepted are exactly those of `bdlde::Base64Encoder` and
+// `bdlde::Base64Decoder` configured with the same options (see
+// `bdlde_base64encoderoptions` and `bdlde_base64decoderoptions`), so every
+// `bdlde::Base64Alphabet` and every `bdlde::Base64IgnoreMode` is supported.
+//
+// Input and output are described by `bsl::span` objects: the caller supplies
+// an output buffer of at least `encodedLength` (respectively,
+// `maxDecodedLength`) bytes, and the functions return (respectively, load)
+// the leading part of that buffer that was written.
+//
+///Performance
+///-----------
+// Whereas the encoder and decoder mechanisms accept arbitrary iterators and
+// retain state between calls, the functions in this component operate on
+// contiguous buffers, which lets them translate the input a block at a time
+// (using SIMD instructions where the CPU supports them) rather than a
+// byte at a time.  The same block translation is used by
+// `bdlde::Base64Encoder::convert` and `bdlde::Base64Decoder::convert` when
+// they are passed `char *` output and `const char *` input, so large chunks
+// supplied to the incremental interface are translated just as quickly.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer of binary data that we need to embed in a text
+// document, and later recover.
+//
+// First, we describe the data:
+// ```
+// const char                  data[] = "\x00\x01\x02 binary \xfd\xfe\xff";
+// const bsl::span<const char> input(data, sizeof(data) - 1);
+// ```
+// Then, we size an output buffer for the encoding, using the options we
+// intend to encode with:
+// ```
+// const bdlde::Base64EncoderOptions encOptions =
+//                                    bdlde::Base64EncoderOptions::standard();
+//
+// bsl::vector<char> encodedBuffer(
+//              bdlde::Base64Util::encodedLength(encOptions, input.size()));
+// ```
+// Next, we encode the data:
+// ```
+// const bsl::span<char> encoded = bdlde::Base64Util::encode(encodedBuffer,
+//                                                          input,
+//                                                          encOptions);
+// assert(bsl::string(encoded.data(), encoded.size()) ==
+//                                                   "AAECIGJpbmFyeSD9/v8=");
+// ```
+// Then, we size a buffer for the decoded data:
+// ```
+// bsl::vector<char> decodedBuffer(
+//                     bdlde::Base64Util::maxDecodedLength(encoded.size()));
+// ```
+// Finally, we decode the data and observe that we recover the original:
+// ```
+// bsl::span<char> decoded;
+// int             rc = bdlde::Base64Util::decode(
+//                                 &decoded,
+//                                 decodedBuffer,
+//                                 encoded,
+//                                 bdlde::Base64DecoderOptions::standard());
+// assert(0 == rc);
+// assert(input.size() == decoded.size());
+// assert(0 == bsl::memcmp(input.data(), decoded.data(), decoded.size()));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlde_base64decoderoptions.h>
+#include <bdlde_base64encoderoptions.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_span.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                             // =================
+                             // struct Base64Util
+                             // =================
+
+/// This `struct` provides a namespace for functions that encode and decode
+/// complete Base64 sequences in a single call.
+struct Base64Util {
+
+    // CLASS METHODS
+
+    /// Return the exact number of bytes that `encode` writes for an input
+    /// of the specified `inputLength` bytes encoded with the specified
+    /// `options`.  The behavior is undefined if the result would overflow.
+    static bsl::size_t encodedLength(const Base64EncoderOptions& options,
+                                     bsl::size_t                 inputLength);
+
+    /// Return the maximum number of bytes that `decode` can write for an
+    /// input of the specified `inputLength` bytes, regardless of the
+    /// decoder options.
+    static bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+
+    /// Encode the specified `input` into its Base64 representation as
+    /// configured by the optionally specified `options`, writing the result
+    /// to the leading part of the specified `output`, and return that
+    /// leading part.  If `options` is not specified, the MIME options (see
+    /// `Base64EncoderOptions::mime`) are used.  The behavior is undefined
+    /// unless `encodedLength(options, input.size()) <= output.size()` and
+    /// `encodedLength(options, input.size())` does not exceed the maximum
+    /// value of `int`.
+    static bsl::span<char> encode(
+                        bsl::span<char>             output,
+                        bsl::span<const char>       input,
+                        const Base64EncoderOptions& options =
+                                               Base64EncoderOptions::mime());
+
+    /// Decode the specified `input` from its Base64 representation as
+    /// configured by the optionally specified `options`, writing the result
+    /// to the leading part of the specified `output`, and load that leading
+    /// part into the specified `result`.  If `options` is not specified,
+    /// the MIME options (see `Base64DecoderOptions::mime`) are used.
+    /// Return 0 on success, and a non-zero value (with no effect on
+    /// `result`) if `input` is not a complete, valid Base64 sequence for
+    /// `options`.  The behavior is undefined unless
+    /// `maxDecodedLength(input.size()) <= output.size()` and `input.size()`
+    /// does not exceed the maximum value of `int`.  Note that the contents
+    /// of `output` are unspecified if a non-zero value is returned.
+    static int decode(bsl::span<char>             *result,
+                      bsl::span<char>              output,
+                      bsl::span<const char>        input,
+                      const Base64DecoderOptions&  options =
+                                               Base64DecoderOptions::mime());
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,645 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bdlde_base64alphabet.h>
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64decoderoptions.h>
+#include <bdlde_base64encoder.h>
+#include <bdlde_base64encoderoptions.h>
+#include <bdlde_base64ignoremode.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>       // `atoi`
+#include <bsl_cstring.h>       // `memcmp`
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_span.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides one-shot encode and decode functions
+// that are defined to produce exactly the results of `bdlde::Base64Encoder`
+// and `bdlde::Base64Decoder` configured with the same options.  We therefore
+// test them differentially, against the mechanisms driven through their
+// generic (iterator) interface, for every combination of alphabet, padding,
+// line length, and ignore mode, over inputs of every length up to several
+// SIMD blocks, with injected whitespace and unrecognized characters.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(const EncoderOptions&, bsl::size_t);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+// [ 2] span<char> encode(span<char>, span<const char>, const EO&);
+// [ 2] int decode(span<char> *, span<char>, span<const char>, const DO&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util           Util;
+typedef bdlde::Base64EncoderOptions EncoderOptions;
+typedef bdlde::Base64DecoderOptions DecoderOptions;
+typedef bdlde::Base64Alphabet       Alphabet;
+typedef bdlde::Base64IgnoreMode     IgnoreMode;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the next value of the pseudo-random sequence whose state is held
+/// in the specified `seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+/// Load into the specified `result` the specified `length` pseudo-random
+/// bytes drawn using the specified `seed`.
+void randomBytes(bsl::string *result, int length, unsigned int *seed)
+{
+    result->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*result)[i] = static_cast<char>(nextRandom(seed));
+    }
+}
+
+/// Return the result of encoding the specified `input` with a
+/// `bdlde::Base64Encoder` configured with the specified `options`, driven
+/// through its generic iterator interface.
+bsl::string streamEncode(const bsl::string&    input,
+                         const EncoderOptions& options)
+{
+    bdlde::Base64Encoder encoder(options);
+    bsl::string          result;
+
+    bsl::back_insert_iterator<bsl::string> out(result);
+
+    int rc = encoder.convert(out, input.begin(), input.end());
+    ASSERT(0 == rc);
+    rc = encoder.endConvert(out);
+    ASSERT(0 == rc);
+
+    return result;
+}
+
+/// Decode the specified `input` with a `bdlde::Base64Decoder` configured
+/// with the specified `options`, driven through its generic iterator
+/// interface, loading the result into the specified `result`.  Return 0 on
+/// success, and a non-zero value otherwise.
+int streamDecode(bsl::string           *result,
+                 const bsl::string&     input,
+                 const DecoderOptions&  options)
+{
+    bdlde::Base64Decoder decoder(options);
+
+    bsl::back_insert_iterator<bsl::string> out(*result);
+
+    if (0 > decoder.convert(out, input.begin(), input.end())) {
+        return -1;                                                    // RETURN
+    }
+    return 0 > decoder.endConvert(out) ? -1 : 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator(veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace `assert` with
+        //:   `ASSERT`, and insert `if (veryVerbose)` before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer of binary data that we need to embed in a text
+// document, and later recover.
+//
+// First, we describe the data:
+// ```
+    const char                  data[] = "\x00\x01\x02 binary \xfd\xfe\xff";
+    const bsl::span<const char> input(data, sizeof(data) - 1);
+// ```
+// Then, we size an output buffer for the encoding, using the options we
+// intend to encode with:
+// ```
+    const bdlde::Base64EncoderOptions encOptions =
+                                       bdlde::Base64EncoderOptions::standard();
+
+    bsl::vector<char> encodedBuffer(
+                 bdlde::Base64Util::encodedLength(encOptions, input.size()));
+// ```
+// Next, we encode the data:
+// ```
+    const bsl::span<char> encoded = bdlde::Base64Util::encode(encodedBuffer,
+                                                             input,
+                                                             encOptions);
+    ASSERT(bsl::string(encoded.data(), encoded.size()) ==
+                                                      "AAECIGJpbmFyeSD9/v8=");
+// ```
+// Then, we size a buffer for the decoded data:
+// ```
+    bsl::vector<char> decodedBuffer(
+                        bdlde::Base64Util::maxDecodedLength(encoded.size()));
+// ```
+// Finally, we decode the data and observe that we recover the original:
+// ```
+    bsl::span<char> decoded;
+    int             rc = bdlde::Base64Util::decode(
+                                    &decoded,
+                                    decodedBuffer,
+                                    encoded,
+                                    bdlde::Base64DecoderOptions::standard());
+    ASSERT(0 == rc);
+    ASSERT(input.size() == decoded.size());
+    ASSERT(0 == bsl::memcmp(input.data(), decoded.data(), decoded.size()));
+// ```
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENCODE AND DECODE
+        //
+        // Concerns:
+        //: 1 `encode` writes exactly `encodedLength(options, input.size())`
+        //:   bytes, and those bytes are exactly what `bdlde::Base64Encoder`
+        //:   produces with the same options, for every alphabet, padding,
+        //:   and line length, and for every input length (in particular,
+        //:   lengths on either side of each SIMD block boundary and of each
+        //:   line boundary).
+        //:
+        //: 2 `decode` succeeds on exactly the inputs accepted by
+        //:   `bdlde::Base64Decoder` with the same options, produces the same
+        //:   bytes, and leaves `result` unchanged on failure.
+        //:
+        //: 3 Characters ignored by the decoder, wherever they appear
+        //:   (including within a block), do not disturb the decoding of the
+        //:   characters that follow them.
+        //:
+        //: 4 `maxDecodedLength` is sufficient for every input.
+        //:
+        //: 5 Neither function allocates memory.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For every combination of alphabet, padding, and a set of line
+        //:   lengths, and for every input length from 0 to 160, encode
+        //:   pseudo-random bytes with `encode` and with a
+        //:   `bdlde::Base64Encoder` through `bsl::back_inserter`, and
+        //:   compare.  (C-1, 5)
+        //:
+        //: 2 For each ignore mode, decode each encoding with `decode` and
+        //:   with a `bdlde::Base64Decoder` through `bsl::back_inserter`, and
+        //:   compare the status and, on success, the output.  Repeat after
+        //:   inserting whitespace and unrecognized characters at
+        //:   pseudo-random positions.  (C-2..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an undersized output buffer (using the
+        //:   `BSLS_ASSERTTEST_*` macros).  (C-6)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(const EncoderOptions&, bsl::size_t);
+        //   bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        //   span<char> encode(span<char>, span<const char>, const EO&);
+        //   int decode(span<char> *, span<char>, span<const char>, const DO&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ENCODE AND DECODE" << endl
+                                  << "=================" << endl;
+
+        static const int  LINE_LENGTHS[] = { 0, 1, 4, 7, 16, 76 };
+        const int         NUM_LINE_LENGTHS = sizeof LINE_LENGTHS /
+                                                      sizeof *LINE_LENGTHS;
+
+        static const char INSERTIONS[] = " \t\n\r\v\f!*.=-_+/@";
+        const int         NUM_INSERTIONS = sizeof INSERTIONS - 1;
+
+        unsigned int seed = 12345;
+
+        bsl::string input(&defaultAllocator);
+        bsl::string expected(&defaultAllocator);
+        bsl::string modified(&defaultAllocator);
+        bsl::string streamed(&defaultAllocator);
+
+        bsl::vector<char> encodeBuffer(&defaultAllocator);
+        bsl::vector<char> decodeBuffer(&defaultAllocator);
+
+        for (int ti = 0; ti < 2 * 2 * NUM_LINE_LENGTHS; ++ti) {
+            const Alphabet::Enum ALPHABET    = ti % 2 ? Alphabet::e_URL
+                                                      : Alphabet::e_BASIC;
+            const bool           PADDED      = ti / 2 % 2;
+            const int            LINE_LENGTH = LINE_LENGTHS[ti / 4];
+
+            const EncoderOptions ENC_OPTIONS = EncoderOptions::custom(
+                                                                  LINE_LENGTH,
+                                                                  ALPHABET,
+                                                                  PADDED);
+
+            if (veryVerbose) {
+                P_(ALPHABET) P_(PADDED) P(LINE_LENGTH);
+            }
+
+            for (int len = 0; len <= 160; ++len) {
+                u::randomBytes(&input, len, &seed);
+                expected = u::streamEncode(input, ENC_OPTIONS);
+
+                const bsl::size_t ENC_LEN = Util::encodedLength(ENC_OPTIONS,
+                                                                len);
+                ASSERTV(ti, len, expected.size() == ENC_LEN);
+
+                encodeBuffer.assign(ENC_LEN + 1, '#');
+
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                const bsl::span<char> encoded = Util::encode(
+                                        bsl::span<char>(encodeBuffer.data(),
+                                                        encodeBuffer.size()),
+                                        bsl::span<const char>(input.data(),
+                                                              input.size()),
+                                        ENC_OPTIONS);
+
+                ASSERTV(ti, len, dam.isTotalSame());
+                ASSERTV(ti, len, encodeBuffer.data() == encoded.data());
+                ASSERTV(ti, len,
+                        expected == bsl::string_view(encoded.data(),
+                                                     encoded.size()));
+                ASSERTV(ti, len, '#' == encodeBuffer.back());
+
+                for (int mi = 0; mi < 3; ++mi) {
+                    const IgnoreMode::Enum IGNORE_MODE =
+                                           static_cast<IgnoreMode::Enum>(mi);
+
+                    const DecoderOptions DEC_OPTIONS = DecoderOptions::custom(
+                                                                  IGNORE_MODE,
+                                                                  ALPHABET,
+                                                                  PADDED);
+
+                    for (int trial = 0; trial < 4; ++trial) {
+                        modified = expected;
+
+                        const int numInserted = trial
+                                             ? 1 + u::nextRandom(&seed) % 3
+                                             : 0;
+                        for (int i = 0; i < numInserted; ++i) {
+                            const bsl::size_t pos = u::nextRandom(&seed) %
+                                                         (modified.size() + 1);
+                            const char        ch  = INSERTIONS[
+                                       u::nextRandom(&seed) % NUM_INSERTIONS];
+                            modified.insert(pos, 1, ch);
+                        }
+
+                        streamed.clear();
+                        const int EXP_RC = u::streamDecode(&streamed,
+                                                           modified,
+                                                           DEC_OPTIONS);
+
+                        decodeBuffer.assign(
+                                    Util::maxDecodedLength(modified.size()),
+                                    '#');
+
+                        bsl::span<char> decoded = decodeBuffer;
+                        decoded = decoded.first(0);
+
+                        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                        const int rc = Util::decode(
+                                      &decoded,
+                                      decodeBuffer,
+                                      bsl::span<const char>(modified.data(),
+                                                            modified.size()),
+                                      DEC_OPTIONS);
+
+                        ASSERTV(ti, len, mi, trial, dam.isTotalSame());
+                        ASSERTV(ti, len, mi, trial, modified, EXP_RC, rc,
+                                (0 == EXP_RC) == (0 == rc));
+                        if (0 == rc) {
+                            ASSERTV(ti, len, mi, trial, modified,
+                                    streamed == bsl::string_view(
+                                                             decoded.data(),
+                                                             decoded.size()));
+                        }
+                        else {
+                            ASSERTV(ti, len, mi, trial, 0 == decoded.size());
+                        }
+                        if (0 == trial && 0 == LINE_LENGTH) {
+                            ASSERTV(ti, len, mi, 0 == rc);
+                            ASSERTV(ti, len, mi,
+                                    input == bsl::string_view(
+                                                             decoded.data(),
+                                                             decoded.size()));
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const EncoderOptions OPTIONS = EncoderOptions::standard();
+
+            char        buffer[8];
+            const char  in[4] = { 'a', 'b', 'c', 'd' };
+
+            bsl::span<char> result;
+
+            ASSERT_PASS(Util::encode(bsl::span<char>(buffer, 8),
+                                     bsl::span<const char>(in, 4),
+                                     OPTIONS));
+            ASSERT_FAIL(Util::encode(bsl::span<char>(buffer, 7),
+                                     bsl::span<const char>(in, 4),
+                                     OPTIONS));
+
+            ASSERT_PASS(Util::decode(&result,
+                                     bsl::span<char>(buffer, 3),
+                                     bsl::span<const char>(in, 4)));
+            ASSERT_FAIL(Util::decode(&result,
+                                     bsl::span<char>(buffer, 2),
+                                     bsl::span<const char>(in, 4)));
+            ASSERT_FAIL(Util::decode(0,
+                                     bsl::span<char>(buffer, 3),
+                                     bsl::span<const char>(in, 4)));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode a few short strings and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        ASSERT(0 == Util::maxDecodedLength(0));
+        ASSERT(3 == Util::maxDecodedLength(1));
+        ASSERT(3 == Util::maxDecodedLength(4));
+        ASSERT(6 == Util::maxDecodedLength(5));
+
+        ASSERT(4 == Util::encodedLength(EncoderOptions::standard(), 1));
+        ASSERT(2 == Util::encodedLength(
+                     EncoderOptions::custom(0, Alphabet::e_URL, false), 1));
+
+        char buffer[32];
+
+        bsl::span<char> result = Util::encode(
+                                       buffer,
+                                       bsl::span<const char>("Man\xfb", 4),
+                                       EncoderOptions::standard());
+        ASSERT("TWFu+w==" == bsl::string(result.data(), result.size()));
+
+        result = Util::encode(
+                            buffer,
+                            bsl::span<const char>("Man\xfb", 4),
+                            EncoderOptions::custom(0, Alphabet::e_URL, false));
+        ASSERT("TWFu-w" == bsl::string(result.data(), result.size()));
+
+        ASSERT(0 == Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>("TWFu\r\n+w==", 10)));
+        ASSERT("Man\xfb" == bsl::string(result.data(), result.size()));
+
+        ASSERT(0 != Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>("TWFu+w=", 7)));
+        ASSERT(0 != Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>("TWFu-w==", 8)));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The one-shot functions are substantially faster than driving the
+        //:   mechanisms through their generic iterator interface.
+        //
+        // Plan:
+        //: 1 Time the encoding and decoding of a 1MB buffer with both
+        //:   interfaces, with and without line breaks, and report the
+        //:   throughput in MB/s.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE TEST" << endl
+                                  << "================" << endl;
+
+        const int SIZE = 1 << 20;
+        const int REPS = argc > 2 ? atoi(argv[2]) : 20;
+
+        unsigned int seed = 1;
+        bsl::string  input(&defaultAllocator);
+        u::randomBytes(&input, SIZE, &seed);
+
+        const bsl::span<const char> INPUT(input.data(), input.size());
+        const double                MB = REPS * static_cast<double>(SIZE) /
+                                                                    (1 << 20);
+
+        for (int mime = 0; mime < 2; ++mime) {
+            const EncoderOptions ENC_OPTIONS = mime
+                                             ? EncoderOptions::mime()
+                                             : EncoderOptions::standard();
+            const DecoderOptions DEC_OPTIONS = mime
+                                             ? DecoderOptions::mime()
+                                             : DecoderOptions::standard();
+
+            printf("%s\n", mime ? "MIME" : "STANDARD");
+
+            bsl::vector<char> encoded(Util::encodedLength(ENC_OPTIONS, SIZE),
+                                      &defaultAllocator);
+            bsl::vector<char> decoded(Util::maxDecodedLength(encoded.size()),
+                                      &defaultAllocator);
+            bsl::string       streamed(&defaultAllocator);
+            bsl::span<char>   result;
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                Util::encode(encoded, INPUT, ENC_OPTIONS);
+            }
+            timer.stop();
+            printf("    Base64Util::encode:        %8.1f MB/s\n",
+                   MB / timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                streamed = u::streamEncode(input, ENC_OPTIONS);
+            }
+            timer.stop();
+            printf("    Base64Encoder (iterator):  %8.1f MB/s\n",
+                   MB / timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                ASSERT(0 == Util::decode(&result,
+                                         decoded,
+                                         encoded,
+                                         DEC_OPTIONS));
+            }
+            timer.stop();
+            printf("    Base64Util::decode:        %8.1f MB/s\n",
+                   MB / timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                bsl::string output(&defaultAllocator);
+                ASSERT(0 == u::streamDecode(&output, streamed, DEC_OPTIONS));
+            }
+            timer.stop();
+            printf("    Base64Decoder (iterator):  %8.1f MB/s\n",
+                   MB / timer.elapsedTime());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
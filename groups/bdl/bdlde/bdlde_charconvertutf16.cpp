@@ -9,13 +9,26 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
+#include <bslmt_once.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_CHARCONVERTUTF16_SSE41_ENABLED 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -447,6 +460,16 @@ struct Utf8 {
             return octets;
         }
 
+        bsl::size_t numAvailable(const OctetType *position) const
+            // Return the number of octets of input beginning at the specified
+            // 'position'.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= position);
+
+            return d_end - position;
+        }
+
         bool verifyContinuations(const OctetType *octets, int n) const
             // Return 'true' if there are at least the specified 'n'
             // continuation bytes beginning at the specified 'octets' and prior
@@ -505,6 +528,14 @@ struct Utf8 {
             return octets;
         }
 
+        bsl::size_t numAvailable(const OctetType *) const
+            // Return 0.  Note that the extent of null-terminated input is not
+            // known in advance, so no octet past the one being examined may
+            // be read before it is known that the input has not ended.
+        {
+            return 0;
+        }
+
         bool verifyContinuations(const OctetType *octets, int n) const
             // Return 'true' if there are at least the specified 'n'
             // continuation bytes beginning at the specified 'octets', and
@@ -762,6 +793,16 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        bsl::size_t numAvailable(const UTF16_WORD *utf16Buf) const
+            // Return the number of words of input beginning at the specified
+            // 'utf16Buf'.  The behavior is undefined unless
+            // 'utf16Buf <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= utf16Buf);
+
+            return d_end - utf16Buf;
+        }
     };
 
     template <class UTF16_WORD>
@@ -782,6 +823,14 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        bsl::size_t numAvailable(const UTF16_WORD *) const
+            // Return 0.  Note that the extent of null-terminated input is not
+            // known in advance, so no word past the one being examined may be
+            // read before it is known that the input has not ended.
+        {
+            return 0;
+        }
     };
 
     // CLASS METHODS
@@ -1022,6 +1071,539 @@ struct NoOpSwapper {
 BSLMF_ASSERT(sizeof(wchar_t)                  >= sizeof(unsigned short));
 BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+// The length-delimited translation and size-computation routines below pass
+// over runs of input in which every code point has the same encoded width a
+// block at a time, rather than one code point at a time.  Blocks of
+// 'k_BLOCK_SIZE' code points that are all ASCII are widened or narrowed with a
+// few SSE2 instructions, as are blocks of 'k_BMP_BLOCK_SIZE' code points that
+// are all encoded in two octets of UTF-8 (e.g., Cyrillic or Greek text) and,
+// on x86-64 with GCC or Clang where the CPU supports SSE4.1 (and hence the
+// SSSE3 byte shuffle), blocks of 'k_BMP_BLOCK_SIZE' code points that are all
+// encoded in three octets of UTF-8 (e.g., CJK text).  The three-octet kernels
+// are compiled for SSE4.1 with a 'target' attribute regardless of the
+// instruction set the rest of the build targets, and are used only if
+// 'hasThreeOctetKernels', which checks the CPU once per process, returns
+// 'true'.  A block is translated this way only if every code point
+// in it is valid, so error sequences are always handled one code point at a
+// time by the loops below, and the output is identical either way.  Blocks are
+// only read when entirely within the input, which rules out null-terminated
+// input, and only written when entirely within the output capacity.  Text in
+// which multi-octet code points are interspersed with ASCII spaces and
+// punctuation seldom contains a uniform block, so after an attempt to
+// translate one fails, the loops translate the next 'k_BLOCK_BACKOFF' units of
+// input one code point at a time before attempting another, and a block of
+// ASCII is attempted only where at least two ASCII code points follow.
+
+enum {
+    k_BLOCK_SIZE     = 16,  // number of octets (or ASCII code points) in a
+                            // block
+
+    k_BMP_BLOCK_SIZE =  8,  // number of 16-bit words (or BMP code points) in
+                            // a block
+
+    k_BLOCK_BACKOFF  = 64   // number of octets or words of input to translate
+                            // one code point at a time after failing to
+                            // translate a block of BMP code points
+};
+
+inline
+int numTrailingUnsetBits(unsigned int mask)
+    // Return the number of consecutive unset bits at the low-order end of the
+    // specified 'mask'.  The behavior is undefined unless '0 != mask'.
+{
+    BSLS_ASSERT_SAFE(mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int ret = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++ret;
+    }
+    return ret;
+#endif
+}
+
+inline
+int numBitsSet(unsigned int mask)
+    // Return the number of bits set in the specified 16-bit 'mask'.
+{
+    mask = mask - ((mask >> 1) & 0x5555);
+    mask = (mask & 0x3333) + ((mask >> 2) & 0x3333);
+    mask = (mask + (mask >> 4)) & 0x0f0f;
+    return (mask + (mask >> 8)) & 0x1f;
+}
+
+inline
+__m128i loadBlock(const void *position)
+    // Return the 16 bytes beginning at the specified 'position'.
+{
+    return _mm_loadu_si128(static_cast<const __m128i *>(position));
+}
+
+inline
+void storeBlock(void *position, __m128i block)
+    // Write the specified 'block' to the 16 bytes beginning at the specified
+    // 'position'.
+{
+    _mm_storeu_si128(static_cast<__m128i *>(position), block);
+}
+
+inline
+__m128i swapWordBytes(__m128i words)
+    // Return the specified 'words' with the two bytes of each of its 16-bit
+    // lanes exchanged.
+{
+    return _mm_or_si128(_mm_slli_epi16(words, 8), _mm_srli_epi16(words, 8));
+}
+
+template <class SWAPPER, class UTF16_WORD>
+bool loadWords(__m128i *result, const UTF16_WORD *words)
+    // Load into the 16-bit lanes of the specified '*result' the values, in
+    // host byte order, of the 'k_BMP_BLOCK_SIZE' words beginning at the
+    // specified 'words', as 'SWAPPER::decodeSingleWord' would decode them.
+    // Return 'true' on success, and 'false', with no effect on '*result', if
+    // any of those values does not fit in 16 bits (which can only happen if
+    // 'UTF16_WORD' is a 32-bit type and 'SWAPPER' is 'NoOpSwapper').
+{
+    enum { k_SWAPPED = !bsl::is_same<SWAPPER,
+                                     NoOpSwapper<UTF16_WORD> >::value };
+
+    if (2 == sizeof(UTF16_WORD)) {
+        const __m128i values = loadBlock(words);
+        *result = k_SWAPPED ? swapWordBytes(values) : values;
+        return true;                                                  // RETURN
+    }
+
+    __m128i lo = loadBlock(words);
+    __m128i hi = loadBlock(words + k_BMP_BLOCK_SIZE / 2);
+    if (k_SWAPPED) {
+        // 'swappedToHost' ignores the low-order half of a 32-bit word.
+
+        lo = _mm_srli_epi32(lo, 16);
+        hi = _mm_srli_epi32(hi, 16);
+    }
+    else {
+        const __m128i highHalves = _mm_or_si128(_mm_srli_epi32(lo, 16),
+                                                _mm_srli_epi32(hi, 16));
+        if (0xffff != _mm_movemask_epi8(
+                      _mm_cmpeq_epi8(highHalves, _mm_setzero_si128()))) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // Sign-extend each 16-bit value so that the signed saturation of
+    // '_mm_packs_epi32' leaves it unchanged.
+
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+
+    const __m128i values = _mm_packs_epi32(lo, hi);
+    *result = k_SWAPPED ? swapWordBytes(values) : values;
+    return true;
+}
+
+template <class SWAPPER, class UTF16_WORD>
+void storeWords(UTF16_WORD *words, __m128i values)
+    // Write the 'k_BMP_BLOCK_SIZE' 16-bit lanes of the specified 'values',
+    // which are in host byte order, to the words beginning at the specified
+    // 'words', as 'SWAPPER::encodeSingleWord' would encode them.
+{
+    enum { k_SWAPPED = !bsl::is_same<SWAPPER,
+                                     NoOpSwapper<UTF16_WORD> >::value };
+
+    if (k_SWAPPED) {
+        values = swapWordBytes(values);
+    }
+
+    if (2 == sizeof(UTF16_WORD)) {
+        storeBlock(words, values);
+        return;                                                       // RETURN
+    }
+
+    // 'hostToSwapped' places a swapped 16-bit value in the high-order half of
+    // a 32-bit word.
+
+    const __m128i zero = _mm_setzero_si128();
+    if (k_SWAPPED) {
+        storeBlock(words,                        _mm_unpacklo_epi16(zero,
+                                                                    values));
+        storeBlock(words + k_BMP_BLOCK_SIZE / 2, _mm_unpackhi_epi16(zero,
+                                                                    values));
+    }
+    else {
+        storeBlock(words,                        _mm_unpacklo_epi16(values,
+                                                                    zero));
+        storeBlock(words + k_BMP_BLOCK_SIZE / 2, _mm_unpackhi_epi16(values,
+                                                                    zero));
+    }
+}
+
+inline
+int numLeadingAsciiOctets(const Utf8::OctetType *octets)
+    // Return the number of consecutive ASCII octets at the start of the
+    // 'k_BLOCK_SIZE' octets beginning at the specified 'octets'.
+{
+    const int nonAscii = _mm_movemask_epi8(loadBlock(octets));
+
+    return nonAscii ? numTrailingUnsetBits(nonAscii) : k_BLOCK_SIZE;
+}
+
+template <class SWAPPER, class UTF16_WORD>
+int numLeadingAsciiWords(const UTF16_WORD *words)
+    // Return the number of consecutive words, at the start of the
+    // 'k_BLOCK_SIZE' words beginning at the specified 'words', that
+    // 'SWAPPER::decodeSingleWord' decodes to ASCII.
+{
+    const __m128i nonAsciiBits = _mm_set1_epi16(
+                                              static_cast<short>(0xff80));
+    const __m128i zero         = _mm_setzero_si128();
+
+    for (int i = 0; i < k_BLOCK_SIZE; i += k_BMP_BLOCK_SIZE) {
+        __m128i values;
+        if (!loadWords<SWAPPER>(&values, words + i)) {
+            while (i < k_BLOCK_SIZE
+                && Utf16::isSingleUtf8(SWAPPER::decodeSingleWord(words + i))) {
+                ++i;
+            }
+            return i;                                                 // RETURN
+        }
+
+        const int ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(
+                                         _mm_and_si128(values, nonAsciiBits),
+                                         zero));
+        if (0xffff != ascii) {
+            return i + numTrailingUnsetBits(~ascii) / 2;              // RETURN
+        }
+    }
+
+    return k_BLOCK_SIZE;
+}
+
+template <class SWAPPER, class UTF16_WORD>
+int widenAsciiOctets(UTF16_WORD *dstBuffer, const Utf8::OctetType *octets)
+    // Translate the consecutive ASCII octets at the start of the
+    // 'k_BLOCK_SIZE' octets beginning at the specified 'octets' to the
+    // specified 'dstBuffer', encoding words as 'SWAPPER' does, and return the
+    // number of octets translated.  The behavior is undefined unless
+    // 'dstBuffer' has room for 'k_BLOCK_SIZE' words.
+{
+    const int numAscii = numLeadingAsciiOctets(octets);
+
+    if (k_BLOCK_SIZE == numAscii) {
+        const __m128i block = loadBlock(octets);
+        const __m128i zero  = _mm_setzero_si128();
+
+        storeWords<SWAPPER>(dstBuffer, _mm_unpacklo_epi8(block, zero));
+        storeWords<SWAPPER>(dstBuffer + k_BMP_BLOCK_SIZE,
+                            _mm_unpackhi_epi8(block, zero));
+    }
+    else {
+        for (int i = 0; i < numAscii; ++i) {
+            dstBuffer[i] = SWAPPER::encodeSingleWord(octets[i]);
+        }
+    }
+
+    return numAscii;
+}
+
+template <class SWAPPER, class UTF16_WORD>
+int narrowAsciiWords(char *dstBuffer, const UTF16_WORD *words)
+    // Translate the consecutive words that decode to ASCII at the start of
+    // the 'k_BLOCK_SIZE' words beginning at the specified 'words', decoding
+    // them as 'SWAPPER' does, to the specified 'dstBuffer', and return the
+    // number of words translated.  The behavior is undefined unless
+    // 'dstBuffer' has room for 'k_BLOCK_SIZE' octets.
+{
+    const int numAscii = numLeadingAsciiWords<SWAPPER>(words);
+
+    if (k_BLOCK_SIZE == numAscii) {
+        __m128i lo, hi;
+        loadWords<SWAPPER>(&lo, words);
+        loadWords<SWAPPER>(&hi, words + k_BMP_BLOCK_SIZE);
+
+        storeBlock(dstBuffer, _mm_packus_epi16(lo, hi));
+    }
+    else {
+        for (int i = 0; i < numAscii; ++i) {
+            dstBuffer[i] = Utf16::getUtf8Value(
+                                       SWAPPER::decodeSingleWord(words + i));
+        }
+    }
+
+    return numAscii;
+}
+
+inline
+bool decodeTwoOctetBlock(__m128i *result, const Utf8::OctetType *octets)
+    // Load into the 16-bit lanes of the specified '*result' the code points
+    // encoded by the 'k_BLOCK_SIZE' octets beginning at the specified
+    // 'octets' and return 'true' if those octets are 'k_BMP_BLOCK_SIZE'
+    // valid two-octet sequences, and return 'false' with no effect on
+    // '*result' otherwise.
+{
+    const __m128i block = loadBlock(octets);
+    const __m128i zero  = _mm_setzero_si128();
+
+    // Each 16-bit lane must hold a header octet '110xxxxx' in its low-order
+    // byte and a continuation octet '10xxxxxx' in its high-order byte, and the
+    // header must not be '0xc0' or '0xc1', which begin over-long encodings of
+    // ASCII.
+
+    const __m128i tagged = _mm_cmpeq_epi16(
+                    _mm_and_si128(block,
+                                  _mm_set1_epi16(static_cast<short>(0xc0e0))),
+                    _mm_set1_epi16(static_cast<short>(0x80c0)));
+    const __m128i overLong = _mm_cmpeq_epi16(
+                               _mm_and_si128(block, _mm_set1_epi16(0x001e)),
+                               zero);
+    if (0xffff != _mm_movemask_epi8(_mm_andnot_si128(overLong, tagged))) {
+        return false;                                                 // RETURN
+    }
+
+    const __m128i header = _mm_and_si128(block, _mm_set1_epi16(0x1f));
+    const __m128i cont   = _mm_and_si128(_mm_srli_epi16(block, 8),
+                                         _mm_set1_epi16(0x3f));
+
+    *result = _mm_or_si128(_mm_slli_epi16(header, 6), cont);
+    return true;
+}
+
+inline
+bool hasThreeOctetKernels()
+    // Return 'true' if the current CPU supports the SSE4.1 instructions used
+    // by 'decodeThreeOctetBlock' and 'encodeThreeOctetBlock', and 'false'
+    // otherwise.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_SSE41_ENABLED)
+    static bool s_isSupported = false;
+    BSLMT_ONCE_DO {
+        unsigned int eax, ebx, ecx, edx;
+        s_isSupported = __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+                     && (ecx & bit_SSE4_1);
+    }
+    return s_isSupported;
+#else
+    return false;
+#endif
+}
+
+#if defined(BDLDE_CHARCONVERTUTF16_SSE41_ENABLED)
+inline
+__m128i decodeThreeOctetLanes(__m128i sequences)
+    // Return the code points encoded by the specified 'sequences', each of
+    // whose 32-bit lanes holds a three-octet sequence, header first, in its
+    // low-order 24 bits, in the corresponding 32-bit lanes.
+{
+    return _mm_or_si128(
+         _mm_or_si128(
+             _mm_and_si128(_mm_srli_epi32(sequences, 4),
+                           _mm_set1_epi32(0xf000)),
+             _mm_and_si128(_mm_srli_epi32(sequences, 2),
+                           _mm_set1_epi32(0x0fc0))),
+         _mm_and_si128(sequences, _mm_set1_epi32(0x003f)));
+}
+
+__attribute__((target("sse4.1")))
+bool decodeThreeOctetBlock(__m128i *result, const Utf8::OctetType *octets)
+    // Load into the 16-bit lanes of the specified '*result' the code points
+    // encoded by the '3 * k_BMP_BLOCK_SIZE' octets beginning at the specified
+    // 'octets' and return 'true' if those octets are 'k_BMP_BLOCK_SIZE' valid
+    // three-octet sequences, and return 'false' with no effect on '*result'
+    // otherwise.  The behavior is undefined unless 'hasThreeOctetKernels()'.
+{
+    // Gather each sequence into the low-order 24 bits of a 32-bit lane, header
+    // octet most significant; sequences 0-3 come from the first 12 octets of
+    // 'lo', and sequences 4-7 from the last 12 octets of 'hi'.
+
+    const __m128i lo = loadBlock(octets);
+    const __m128i hi = loadBlock(octets + 3 * k_BMP_BLOCK_SIZE - k_BLOCK_SIZE);
+
+    const __m128i seqLo = _mm_shuffle_epi8(lo, _mm_setr_epi8( 2,  1,  0, -1,
+                                                              5,  4,  3, -1,
+                                                              8,  7,  6, -1,
+                                                             11, 10,  9, -1));
+    const __m128i seqHi = _mm_shuffle_epi8(hi, _mm_setr_epi8( 6,  5,  4, -1,
+                                                              9,  8,  7, -1,
+                                                             12, 11, 10, -1,
+                                                             15, 14, 13, -1));
+
+    const __m128i tagMask = _mm_set1_epi32(0x00f0c0c0);
+    const __m128i tags    = _mm_set1_epi32(0x00e08080);
+    const __m128i tagged  = _mm_and_si128(
+                      _mm_cmpeq_epi32(_mm_and_si128(seqLo, tagMask), tags),
+                      _mm_cmpeq_epi32(_mm_and_si128(seqHi, tagMask), tags));
+    if (0xffff != _mm_movemask_epi8(tagged)) {
+        return false;                                                 // RETURN
+    }
+
+    const __m128i values = _mm_packus_epi32(decodeThreeOctetLanes(seqLo),
+                                            decodeThreeOctetLanes(seqHi));
+
+    // Values below 0x800 are over-long encodings, and values in
+    // '[ 0xd800 .. 0xe000 )' are reserved for UTF-16 surrogates.
+
+    const __m128i top = _mm_and_si128(
+                                 values,
+                                 _mm_set1_epi16(static_cast<short>(0xf800)));
+    const __m128i bad = _mm_or_si128(
+                       _mm_cmpeq_epi16(top, _mm_setzero_si128()),
+                       _mm_cmpeq_epi16(top,
+                                       _mm_set1_epi16(
+                                          static_cast<short>(0xd800))));
+    if (0 != _mm_movemask_epi8(bad)) {
+        return false;                                                 // RETURN
+    }
+
+    *result = values;
+    return true;
+}
+
+__attribute__((target("sse4.1")))
+void encodeThreeOctetBlock(char *dstBuffer, __m128i values)
+    // Write to the specified 'dstBuffer' the '3 * k_BMP_BLOCK_SIZE' octets of
+    // UTF-8 encoding the code points in the 16-bit lanes of the specified
+    // 'values'.  The behavior is undefined unless 'hasThreeOctetKernels()',
+    // each of 'values' is in '[ 0x800 .. 0xd800 )' or '[ 0xe000 .. 0xffff ]',
+    // and 'dstBuffer' has room for '3 * k_BMP_BLOCK_SIZE' octets.
+{
+    // Lay out the header and middle octets of each sequence in the low- and
+    // high-order bytes of each lane of 'headMid', and shuffle those and the
+    // low-order bytes of 'last' into 24 octets of output.
+
+    const __m128i header  = _mm_or_si128(_mm_srli_epi16(values, 12),
+                                         _mm_set1_epi16(0xe0));
+    const __m128i middle  = _mm_or_si128(
+                                  _mm_and_si128(_mm_srli_epi16(values, 6),
+                                                _mm_set1_epi16(0x3f)),
+                                  _mm_set1_epi16(0x80));
+    const __m128i last    = _mm_or_si128(
+                                  _mm_and_si128(values, _mm_set1_epi16(0x3f)),
+                                  _mm_set1_epi16(0x80));
+    const __m128i headMid = _mm_or_si128(header, _mm_slli_epi16(middle, 8));
+
+    const __m128i out0 = _mm_or_si128(
+                 _mm_shuffle_epi8(headMid, _mm_setr_epi8( 0,  1, -1,  2,
+                                                          3, -1,  4,  5,
+                                                         -1,  6,  7, -1,
+                                                          8,  9, -1, 10)),
+                 _mm_shuffle_epi8(last,    _mm_setr_epi8(-1, -1,  0, -1,
+                                                         -1,  2, -1, -1,
+                                                          4, -1, -1,  6,
+                                                         -1, -1,  8, -1)));
+    const __m128i out1 = _mm_or_si128(
+                 _mm_shuffle_epi8(headMid, _mm_setr_epi8(11, -1, 12, 13,
+                                                         -1, 14, 15, -1,
+                                                         -1, -1, -1, -1,
+                                                         -1, -1, -1, -1)),
+                 _mm_shuffle_epi8(last,    _mm_setr_epi8(-1, 10, -1, -1,
+                                                         12, -1, -1, 14,
+                                                         -1, -1, -1, -1,
+                                                         -1, -1, -1, -1)));
+
+    storeBlock(dstBuffer, out0);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dstBuffer + k_BLOCK_SIZE),
+                     out1);
+}
+#endif
+
+template <class SWAPPER, class UTF16_WORD>
+int encodeBmpBlock(char *dstBuffer, const UTF16_WORD *words)
+    // Translate the 'k_BMP_BLOCK_SIZE' words beginning at the specified
+    // 'words', decoding them as 'SWAPPER' does, to the specified 'dstBuffer'
+    // if they all encode to two octets of UTF-8 or, if
+    // 'hasThreeOctetKernels()', all encode to three octets of UTF-8, and
+    // return the number of octets
+    // written; otherwise, return 0 with no effect on 'dstBuffer'.  The
+    // behavior is undefined unless 'dstBuffer' has room for
+    // '3 * k_BMP_BLOCK_SIZE' octets.
+{
+    __m128i values;
+    if (!loadWords<SWAPPER>(&values, words)) {
+        return 0;                                                     // RETURN
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i top  = _mm_and_si128(
+                                  values,
+                                  _mm_set1_epi16(static_cast<short>(0xf800)));
+
+    const int narrow = _mm_movemask_epi8(_mm_cmpeq_epi16(top, zero));
+    if (0xffff == narrow) {
+        const int ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(
+                                  _mm_and_si128(values,
+                                                _mm_set1_epi16(
+                                                  static_cast<short>(0xff80))),
+                                  zero));
+        if (0 != ascii) {
+            return 0;                                                 // RETURN
+        }
+
+        // '110xxxxx' in the low-order byte of each lane, and '10xxxxxx' in
+        // the high-order byte.
+
+        const __m128i header = _mm_or_si128(_mm_srli_epi16(values, 6),
+                                            _mm_set1_epi16(0xc0));
+        const __m128i last   = _mm_or_si128(
+                                  _mm_and_si128(values, _mm_set1_epi16(0x3f)),
+                                  _mm_set1_epi16(0x80));
+        storeBlock(dstBuffer, _mm_or_si128(header, _mm_slli_epi16(last, 8)));
+        return 2 * k_BMP_BLOCK_SIZE;                                  // RETURN
+    }
+
+#if defined(BDLDE_CHARCONVERTUTF16_SSE41_ENABLED)
+    const __m128i surrogate = _mm_cmpeq_epi16(
+                       top,
+                       _mm_set1_epi16(static_cast<short>(0xd800)));
+    if (0 == narrow && 0 == _mm_movemask_epi8(surrogate)
+                    && hasThreeOctetKernels()) {
+        encodeThreeOctetBlock(dstBuffer, values);
+        return 3 * k_BMP_BLOCK_SIZE;                                  // RETURN
+    }
+#endif
+
+    return 0;
+}
+
+template <class SWAPPER, class UTF16_WORD>
+int numBmpBlockOctets(const UTF16_WORD *words)
+    // Return the number of octets of UTF-8 needed to encode the
+    // 'k_BMP_BLOCK_SIZE' words beginning at the specified 'words', decoding
+    // them as 'SWAPPER' does, if none of them is a surrogate, and 0
+    // otherwise.
+{
+    __m128i values;
+    if (!loadWords<SWAPPER>(&values, words)) {
+        return 0;                                                     // RETURN
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i top  = _mm_and_si128(
+                                  values,
+                                  _mm_set1_epi16(static_cast<short>(0xf800)));
+    if (0 != _mm_movemask_epi8(_mm_cmpeq_epi16(
+                                   top,
+                                   _mm_set1_epi16(
+                                         static_cast<short>(0xd800))))) {
+        return 0;                                                     // RETURN
+    }
+
+    // Every word needs three octets, less one if it is below 0x800, and less
+    // another if it is ASCII.  Each word is two bits of a 'movemask'.
+
+    const int narrow = _mm_movemask_epi8(_mm_cmpeq_epi16(top, zero));
+    const int ascii  = _mm_movemask_epi8(_mm_cmpeq_epi16(
+                                  _mm_and_si128(values,
+                                                _mm_set1_epi16(
+                                                  static_cast<short>(0xff80))),
+                                  zero));
+
+    return 3 * k_BMP_BLOCK_SIZE - (numBitsSet(narrow) + numBitsSet(ascii)) / 2;
+}
+#endif
+
 // These template functions should be in the unnamed namespace, because if they
 // are declared static, you have to fully specialize them every time you call
 // them.
@@ -1049,7 +1631,43 @@ bsl::size_t computeRequiredUtf16WordsImp(const char  *srcBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const Utf8::OctetType *nextBlock = octets;
+#endif
     while (!endFunctor.isFinished(octets)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(endFunctor.numAvailable(octets) < 3 * k_BMP_BLOCK_SIZE)) {
+            __m128i values;
+
+            if (Utf8::isSingleOctet(*octets)) {
+                const int numAscii = numLeadingAsciiOctets(octets);
+                octets      += numAscii;
+                wordsNeeded += numAscii;
+                continue;
+            }
+            if (!(octets < nextBlock)) {
+                if (Utf8::isTwoOctetHeader(*octets)
+                                     && decodeTwoOctetBlock(&values, octets)) {
+                    octets      += 2 * k_BMP_BLOCK_SIZE;
+                    wordsNeeded += k_BMP_BLOCK_SIZE;
+                    continue;
+                }
+#if defined(BDLDE_CHARCONVERTUTF16_SSE41_ENABLED)
+                if (Utf8::isThreeOctetHeader(*octets)
+                                   && hasThreeOctetKernels()
+                                   && decodeThreeOctetBlock(&values, octets)) {
+                    octets      += 3 * k_BMP_BLOCK_SIZE;
+                    wordsNeeded += k_BMP_BLOCK_SIZE;
+                    continue;
+                }
+#endif
+                nextBlock = octets + bsl::min<bsl::size_t>(
+                                              k_BLOCK_BACKOFF,
+                                              endFunctor.numAvailable(octets));
+            }
+        }
+#endif
+
         if      (Utf8::isSingleOctet(     *octets)) {
             ++octets;
             ++wordsNeeded;
@@ -1175,6 +1793,9 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const Utf8::OctetType *nextBlock = octets;
+#endif
     while (!endFunctor.isFinished(octets)) {
         // Checking for output space is tricky.  If we have an error case and
         // no replacement word, we may consume input octets without using any
@@ -1191,6 +1812,20 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
         // Single-octet case is simple and quick.
 
         if (Utf8::isSingleOctet(*octets)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+            if (!(endFunctor.numAvailable(octets) < k_BLOCK_SIZE)
+                                    && !(dstCapacity < k_BLOCK_SIZE + 1)
+                                    && Utf8::isSingleOctet(octets[1])) {
+                const int numAscii = widenAsciiOctets<SWAPPER>(dstBuffer,
+                                                               octets);
+                octets      += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+#endif
+
             if (dstCapacity < 2) {
                 // Are we out of output room, with only space for the null?
 
@@ -1213,6 +1848,35 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
 
         UnicodeCodePoint convBuf;
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(octets < nextBlock)
+                 && !(endFunctor.numAvailable(octets) < 3 * k_BMP_BLOCK_SIZE)
+                 && !(dstCapacity < k_BMP_BLOCK_SIZE + 1)) {
+            __m128i values;
+
+            if ((Utf8::isTwoOctetHeader(*octets)
+                                  && decodeTwoOctetBlock(&values, octets))
+#if defined(BDLDE_CHARCONVERTUTF16_SSE41_ENABLED)
+             || (Utf8::isThreeOctetHeader(*octets)
+                                  && hasThreeOctetKernels()
+                                  && decodeThreeOctetBlock(&values, octets))
+#endif
+               ) {
+                storeWords<SWAPPER>(dstBuffer, values);
+                octets      += Utf8::isTwoOctetHeader(*octets)
+                               ? 2 * k_BMP_BLOCK_SIZE
+                               : 3 * k_BMP_BLOCK_SIZE;
+                dstBuffer   += k_BMP_BLOCK_SIZE;
+                dstCapacity -= k_BMP_BLOCK_SIZE;
+                nCodePoints += k_BMP_BLOCK_SIZE;
+                continue;
+            }
+            nextBlock = octets + bsl::min<bsl::size_t>(
+                                              k_BLOCK_BACKOFF,
+                                              endFunctor.numAvailable(octets));
+        }
+#endif
+
         if (Utf8::isTwoOctetHeader(*octets)) {
             if (!endFunctor.verifyContinuations(octets + 1, 1)) {
                 returnStatus |= INVALID_INPUT_BIT;
@@ -1408,7 +2072,25 @@ bsl::size_t requiredUtf8BytesImp(const UTF16_WORD *srcBuffer,
                        // 'SWAPPER', but not the variable 'swapper'.
 
     bsl::size_t bytesNeeded = 0;
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const UTF16_WORD *nextBlock = srcBuffer;
+#endif
     while (!endFunctor.isFinished(srcBuffer)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(srcBuffer < nextBlock)
+               && !(endFunctor.numAvailable(srcBuffer) < k_BMP_BLOCK_SIZE)) {
+            const int numOctets = numBmpBlockOctets<SWAPPER>(srcBuffer);
+            if (numOctets) {
+                srcBuffer   += k_BMP_BLOCK_SIZE;
+                bytesNeeded += numOctets;
+                continue;
+            }
+            nextBlock = srcBuffer + bsl::min<bsl::size_t>(
+                                           k_BLOCK_BACKOFF,
+                                           endFunctor.numAvailable(srcBuffer));
+        }
+#endif
+
         UnicodeCodePoint word0, word1;
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
@@ -1487,6 +2169,9 @@ int localUtf16ToUtf8(char             *dstBuffer,
     bsl::size_t nCodePoints = 0;
 
     int returnStatus = 0;
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const UTF16_WORD *nextBlock = srcBuffer;
+#endif
     while (!endFunctor.isFinished(srcBuffer)) {
         // We don't do the out-of-room tests until we know that we can
         // generate valid Unicode code points from the UTF-16 string.
@@ -1497,6 +2182,21 @@ int localUtf16ToUtf8(char             *dstBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if (Utf16::isSingleUtf8(word0)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+            if (!(endFunctor.numAvailable(srcBuffer) < k_BLOCK_SIZE)
+                 && !(dstCapacity < k_BLOCK_SIZE + 1)
+                 && Utf16::isSingleUtf8(
+                                 SWAPPER::decodeSingleWord(srcBuffer + 1))) {
+                const int numAscii = narrowAsciiWords<SWAPPER>(dstBuffer,
+                                                               srcBuffer);
+                srcBuffer   += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+#endif
+
             if (dstCapacity < 2) {
                 // One for the code point, one for the null.
 
@@ -1516,6 +2216,25 @@ int localUtf16ToUtf8(char             *dstBuffer,
         // Is it a single-word code point?
 
         if (Utf16::isSingleWord(word0)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+            if (!(srcBuffer < nextBlock)
+                  && !(endFunctor.numAvailable(srcBuffer) < k_BMP_BLOCK_SIZE)
+                  && !(dstCapacity < 3 * k_BMP_BLOCK_SIZE + 1)) {
+                const int numOctets = encodeBmpBlock<SWAPPER>(dstBuffer,
+                                                              srcBuffer);
+                if (numOctets) {
+                    srcBuffer   += k_BMP_BLOCK_SIZE;
+                    dstBuffer   += numOctets;
+                    dstCapacity -= numOctets;
+                    nCodePoints += k_BMP_BLOCK_SIZE;
+                    continue;
+                }
+                nextBlock = srcBuffer + bsl::min<bsl::size_t>(
+                                           k_BLOCK_BACKOFF,
+                                           endFunctor.numAvailable(srcBuffer));
+            }
+#endif
+
             convBuf = word0;
             ++srcBuffer;
 
@@ -129,8 +129,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [18] USAGE EXAMPLE 2
-// [17] USAGE EXAMPLE 1
+// [19] USAGE EXAMPLE 2
+// [18] USAGE EXAMPLE 1
+// [17] BLOCK-WISE TRANSLATION TEST
 // [16] UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
 // [15] UTF-16 LENGTH CALCULATION TEST -- INCORRECT UNICODE
 // [14] UTF-16 & UTF-8 LENGTH CALCULATION TEST -- CORRECT UNICODE
@@ -148,6 +149,7 @@ using namespace bsl;
 // [ 2] SINGLE-VALUE, LEGAL VALUE TEST
 // [ 1] BREATHING/USAGE TEST
 //-----------------------------------------------------------------------------
+// [17] CONCERN: block-wise translation matches code point translation
 // [16] computeRequiredUtf8Bytes(w_char_t *, w_char_t *, byteOrder);
 // [16] computeRequiredUtf8Bytes(ushort *, ushort *, byteOrder);
 // [15] computeRequiredUtf16Words(char *, char *);
@@ -4874,6 +4876,12 @@ class TestDriver {
 
   public:
     // PUBLIC CLASS METHODS
+    static void testCase17(bdlde::ByteOrder::Enum byteOrder);
+        // Test that translating length-delimited input, parts of which are
+        // translated a block at a time, matches translating the same input
+        // null-terminated, where the UTF-16 is to be of the specified
+        // 'byteOrder'.
+
     static void testCase16(bdlde::ByteOrder::Enum byteOrder);
         // Test the calculations of length estimates for UTF-16 containing
         // errors translated into UTF-8.  The UTF-16 is to be of the specified
@@ -5656,6 +5664,290 @@ void TestDriver::randomInvalidUtf16Vector(
                             // -----------------
 
 // PUBLIC CLASS METHODS
+void TestDriver::testCase17(bdlde::ByteOrder::Enum byteOrder)
+    // ------------------------------------------------------------------------
+    // BLOCK-WISE TRANSLATION TEST
+    //
+    // Concerns:
+    //: 1 That translating length-delimited input, which passes over runs of
+    //:   ASCII, two-octet, and three-octet code points a block at a time where
+    //:   possible, produces exactly the same output, code point and word or
+    //:   byte counts, and status as translating the same input
+    //:   null-terminated, which is always done one code point at a time.
+    //:
+    //: 2 That this holds for runs of any length around the block sizes, for
+    //:   runs interrupted by errors, four-octet code points, or surrogates,
+    //:   with or without an error word or byte, and whenever the output
+    //:   capacity runs out.
+    //:
+    //: 3 That 'computeRequiredUtf16Words' and 'computeRequiredUtf8Bytes'
+    //:   return the same values for length-delimited and null-terminated
+    //:   input.
+    //
+    // Plan:
+    //: 1 Build random UTF-8 strings of runs of random length, each run
+    //:   consisting of a single kind of sequence: ASCII, two-octet,
+    //:   three-octet, four-octet, or invalid.
+    //:
+    //: 2 Translate each UTF-8 string to 'unsigned short' and 'wchar_t' UTF-16
+    //:   buffers of ample and of random capacities, filled beforehand with a
+    //:   marker value, passing the input both as a 'bsl::string_view' and as
+    //:   a null-terminated string, with both '?' and 0 as error words, and
+    //:   observe that the return values, the counts returned, and the entire
+    //:   buffers are the same.  (C-1..2)
+    //:
+    //: 3 Build random UTF-16 sequences of 'byteOrder' in the same way from
+    //:   runs of ASCII, two-octet, and three-octet (in UTF-8) words, surrogate
+    //:   pairs, and lone surrogates, translate them to UTF-8 from
+    //:   'unsigned short' and 'wchar_t' input both ways, and observe that the
+    //:   results are the same.  (C-1..2)
+    //:
+    //: 4 Compute the required lengths of output from each input both ways,
+    //:   and observe that they are the same, and match the lengths written
+    //:   when capacity was ample.  (C-3)
+    //
+    // Testing:
+    //   CONCERN: block-wise translation matches code point translation
+    // ------------------------------------------------------------------------
+{
+    bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+    enum { k_ITERATIONS = 5 * 1000,
+           k_MARGIN     = 32,
+           k_MARKER     = 0x5a5a };
+
+    enum RunKind { e_ASCII,
+                   e_TWO_OCTETS,
+                   e_THREE_OCTETS,
+                   e_FOUR_OCTETS,
+                   e_INVALID,
+
+                   k_NUM_RUN_KINDS };
+
+    const unsigned short ERROR_WORDS[] = { '?', 0 };
+    const char           ERROR_BYTES[] = { '?', 0 };
+
+    for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+        // Runs of the most common kinds of input are made most likely, and of
+        // lengths on both sides of the block sizes.
+
+        const unsigned numRuns = 1 + s_randGen.bits(3);
+
+        bsl::string                 utf8(alloc);
+        bsl::vector<unsigned short> utf16(alloc);
+        for (unsigned jj = 0; jj < numRuns; ++jj) {
+            const RunKind  kind = static_cast<RunKind>(
+                                         s_randGen.bits(4) % k_NUM_RUN_KINDS);
+            const unsigned len  = s_randGen.bits(5) + s_randGen.bits(4);
+
+            for (unsigned kk = 0; kk < len; ++kk) {
+                unsigned short w;
+
+                switch (kind) {
+                  case e_ASCII: {
+                    appendRandomValidSingleOctet(&utf8);
+                    w = static_cast<unsigned short>(1 + s_randGen.bits(7) %
+                                                                        0x7f);
+                    utf16.push_back(w);
+                  } break;
+                  case e_TWO_OCTETS: {
+                    appendRandomValidTwoOctets(&utf8);
+                    w = static_cast<unsigned short>(0x80 + s_randGen.bits(11) %
+                                                                      0x780);
+                    utf16.push_back(w);
+                  } break;
+                  case e_THREE_OCTETS: {
+                    appendRandomValidThreeOctets(&utf8);
+                    do {
+                        w = randomUtf16NonSurrogate();
+                    } while (w < 0x800);
+                    utf16.push_back(w);
+                  } break;
+                  case e_FOUR_OCTETS: {
+                    appendRandomValidFourOctets(&utf8);
+                    utf16.push_back(randomUtf16SurrogateLo());
+                    utf16.push_back(randomUtf16SurrogateHi());
+                  } break;
+                  default: {
+                    appendRandomInvalidUtf8CodePoint(&utf8);
+                    utf16.push_back(s_randGen.bits(1)
+                                    ? randomUtf16SurrogateLo()
+                                    : randomUtf16SurrogateHi());
+                  } break;
+                }
+            }
+        }
+        if (bdlde::ByteOrder::e_HOST != byteOrder) {
+            for (bsl::size_t kk = 0; kk < utf16.size(); ++kk) {
+                utf16[kk] = bsls::ByteOrderUtil::swapBytes(utf16[kk]);
+            }
+        }
+        utf16.push_back(0);
+
+        bsl::wstring wide(alloc);
+        copyUtf16ToWstring(&wide, utf16, byteOrder);
+
+        if (veryVerbose) {
+            P_(ii) P_(utf8.length()) P(utf16.size());
+        }
+
+        // UTF-8 -> UTF-16
+
+        const char        *UTF8     = utf8.c_str();
+        const bsl::size_t  UTF8_LEN = utf8.length();
+
+        const bsl::size_t NUM_WORDS = Util::computeRequiredUtf16Words(
+                                                           UTF8,
+                                                           UTF8 + UTF8_LEN);
+        ASSERTV(ii, NUM_WORDS == Util::computeRequiredUtf16Words(UTF8));
+
+        for (int ei = 0; ei < 2; ++ei) {
+            const unsigned short ERROR_WORD = ERROR_WORDS[ei];
+
+            for (int ci = 0; ci < 4; ++ci) {
+                const bsl::size_t CAPACITY = 0 == ci
+                                           ? NUM_WORDS + k_MARGIN
+                                           : s_randGen() % (NUM_WORDS + 1);
+
+                bsl::vector<unsigned short> blockOut( CAPACITY + k_MARGIN,
+                                                      k_MARKER,
+                                                      alloc);
+                bsl::vector<unsigned short> scalarOut(blockOut, alloc);
+                bsl::size_t numCP = 0, numWords = 0;
+                bsl::size_t numCPB = 0, numWordsB = 0;
+
+                int rc  = Util::utf8ToUtf16(blockOut.data(),
+                                            CAPACITY,
+                                            bsl::string_view(utf8),
+                                            &numCP,
+                                            &numWords,
+                                            ERROR_WORD,
+                                            byteOrder);
+                int rcB = Util::utf8ToUtf16(scalarOut.data(),
+                                            CAPACITY,
+                                            UTF8,
+                                            &numCPB,
+                                            &numWordsB,
+                                            ERROR_WORD,
+                                            byteOrder);
+                ASSERTV(ii, ei, ci, rc, rcB, rc == rcB);
+                ASSERTV(ii, ei, ci, numCP, numCPB, numCP == numCPB);
+                ASSERTV(ii, ei, ci, numWords, numWordsB,
+                                                       numWords == numWordsB);
+                ASSERTV(ii, ei, ci, blockOut == scalarOut);
+                ASSERTV(ii, ei, ci, numWords, NUM_WORDS,
+                                     0 != ci || 0 == ERROR_WORD ||
+                                                      numWords == NUM_WORDS);
+
+                bsl::vector<wchar_t> blockWide( CAPACITY + k_MARGIN,
+                                                k_MARKER,
+                                                alloc);
+                bsl::vector<wchar_t> scalarWide(blockWide, alloc);
+
+                rc  = Util::utf8ToUtf16(blockWide.data(),
+                                        CAPACITY,
+                                        bsl::string_view(utf8),
+                                        &numCP,
+                                        &numWords,
+                                        ERROR_WORD,
+                                        byteOrder);
+                rcB = Util::utf8ToUtf16(scalarWide.data(),
+                                        CAPACITY,
+                                        UTF8,
+                                        &numCPB,
+                                        &numWordsB,
+                                        ERROR_WORD,
+                                        byteOrder);
+                ASSERTV(ii, ei, ci, rc, rcB, rc == rcB);
+                ASSERTV(ii, ei, ci, numCP, numCPB, numCP == numCPB);
+                ASSERTV(ii, ei, ci, numWords, numWordsB,
+                                                       numWords == numWordsB);
+                ASSERTV(ii, ei, ci, blockWide == scalarWide);
+            }
+        }
+
+        // UTF-16 -> UTF-8
+
+        const unsigned short *UTF16     = utf16.data();
+        const bsl::size_t     UTF16_LEN = utf16.size() - 1;
+
+        const bsl::size_t NUM_BYTES = Util::computeRequiredUtf8Bytes(
+                                                          UTF16,
+                                                          UTF16 + UTF16_LEN,
+                                                          byteOrder);
+        ASSERTV(ii, NUM_BYTES == Util::computeRequiredUtf8Bytes(
+                                             UTF16,
+                                             static_cast<unsigned short *>(0),
+                                             byteOrder));
+        ASSERTV(ii, NUM_BYTES == Util::computeRequiredUtf8Bytes(
+                                              wide.c_str(),
+                                              wide.c_str() + wide.length(),
+                                              byteOrder));
+
+        for (int ei = 0; ei < 2; ++ei) {
+            const char ERROR_BYTE = ERROR_BYTES[ei];
+
+            for (int ci = 0; ci < 4; ++ci) {
+                const bsl::size_t CAPACITY = 0 == ci
+                                           ? NUM_BYTES + k_MARGIN
+                                           : s_randGen() % (NUM_BYTES + 1);
+
+                bsl::string blockOut(CAPACITY + k_MARGIN, 'Z', alloc);
+                bsl::string scalarOut(blockOut, alloc);
+                bsl::size_t numCP = 0, numBytes = 0;
+                bsl::size_t numCPB = 0, numBytesB = 0;
+
+                int rc  = Util::utf16ToUtf8(blockOut.data(),
+                                            CAPACITY,
+                                            UTF16,
+                                            UTF16_LEN,
+                                            &numCP,
+                                            &numBytes,
+                                            ERROR_BYTE,
+                                            byteOrder);
+                int rcB = Util::utf16ToUtf8(scalarOut.data(),
+                                            CAPACITY,
+                                            UTF16,
+                                            &numCPB,
+                                            &numBytesB,
+                                            ERROR_BYTE,
+                                            byteOrder);
+                ASSERTV(ii, ei, ci, rc, rcB, rc == rcB);
+                ASSERTV(ii, ei, ci, numCP, numCPB, numCP == numCPB);
+                ASSERTV(ii, ei, ci, numBytes, numBytesB,
+                                                       numBytes == numBytesB);
+                ASSERTV(ii, ei, ci, blockOut == scalarOut);
+                ASSERTV(ii, ei, ci, numBytes, NUM_BYTES,
+                                     0 != ci || 0 == ERROR_BYTE ||
+                                                      numBytes == NUM_BYTES);
+
+                blockOut.assign(CAPACITY + k_MARGIN, 'Z');
+                scalarOut = blockOut;
+
+                rc  = Util::utf16ToUtf8(blockOut.data(),
+                                        CAPACITY,
+                                        bsl::wstring_view(wide),
+                                        &numCP,
+                                        &numBytes,
+                                        ERROR_BYTE,
+                                        byteOrder);
+                rcB = Util::utf16ToUtf8(scalarOut.data(),
+                                        CAPACITY,
+                                        wide.c_str(),
+                                        &numCPB,
+                                        &numBytesB,
+                                        ERROR_BYTE,
+                                        byteOrder);
+                ASSERTV(ii, ei, ci, rc, rcB, rc == rcB);
+                ASSERTV(ii, ei, ci, numCP, numCPB, numCP == numCPB);
+                ASSERTV(ii, ei, ci, numBytes, numBytesB,
+                                                       numBytes == numBytesB);
+                ASSERTV(ii, ei, ci, blockOut == scalarOut);
+            }
+        }
+    }
+}
+
 void TestDriver::testCase16(bdlde::ByteOrder::Enum byteOrder)
     // ------------------------------------------------------------------------
     // UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
@@ -7749,7 +8041,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -7875,7 +8167,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -7968,6 +8260,19 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE TRANSLATION TEST
+        //
+        // Documentation at start of 'void testCase17'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BLOCK-WISE TRANSLATION TEST\n"
+                             "===========================\n";
+
+        TestDriver::testCase17(bdlde::ByteOrder::e_LITTLE_ENDIAN);
+        TestDriver::testCase17(bdlde::ByteOrder::e_BIG_ENDIAN);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
@@ -12039,6 +12344,148 @@ int main(int argc, char**argv)
       case -1: {
           runPlainTextPerformanceTest();
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE TRANSLATION BENCHMARK
+        //
+        // Concerns:
+        //: 1 That translating length-delimited input, which passes over runs
+        //:   of ASCII and BMP code points a block at a time where the
+        //:   platform supports it, is faster than translating null-terminated
+        //:   input, which is always done one code point at a time.
+        //
+        // Plan:
+        //: 1 Build UTF-8 text of ASCII, two-octet (Cyrillic), three-octet
+        //:   (CJK), and mixed code points, and time translating it to UTF-16
+        //:   and back, passing it both length-delimited and null-terminated.
+        //:   Report the throughput of each in megabytes of UTF-8 per second.
+        //
+        // Testing:
+        //   BLOCK-WISE TRANSLATION BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BLOCK-WISE TRANSLATION BENCHMARK\n"
+                             "================================\n";
+
+        enum { k_NUM_CODE_POINTS = 64 * 1024 };
+
+        bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+        const int iterLimit = argc > 2 ? atoi(argv[2]) : 1000;
+
+        // Each kind of text is made by cycling through a range of code points
+        // of its script, interspersed with ASCII spaces and newlines where
+        // that script would have them.
+
+        static const struct {
+            const char *d_name;           // name of the text
+            unsigned    d_base;           // first code point of the script
+            unsigned    d_range;          // number of code points to cycle
+            int         d_spaceInterval;  // code points between spaces
+        } TEXTS[] = {
+            { "ASCII",             'a',   26, 6 },
+            { "two-octet",      0x0430,   32, 8 },
+            { "three-octet",    0x4e00, 4096, 0 },
+            { "mixed",          0x0000,    0, 4 },
+        };
+        enum { k_NUM_TEXTS = sizeof TEXTS / sizeof *TEXTS };
+
+        for (int ti = 0; ti < k_NUM_TEXTS; ++ti) {
+            bsl::string utf8(alloc);
+            for (int ii = 0; ii < k_NUM_CODE_POINTS; ++ii) {
+                unsigned uc;
+                if (0 == TEXTS[ti].d_range) {
+                    // Alternate short words of ASCII, Cyrillic, and CJK.
+
+                    static const unsigned BASES[] = { 'a', 0x0430, 0x4e00 };
+                    uc = BASES[ii / 5 % 3] + ii % 17;
+                }
+                else {
+                    uc = TEXTS[ti].d_base + ii % TEXTS[ti].d_range;
+                }
+                if (0 != TEXTS[ti].d_spaceInterval &&
+                              0 == (ii + 1) % TEXTS[ti].d_spaceInterval) {
+                    uc = 0 == (ii + 1) % 64 ? '\n' : ' ';
+                }
+
+                if (uc < 0x80) {
+                    utf8 += static_cast<char>(uc);
+                }
+                else if (uc < 0x800) {
+                    utf8 += static_cast<char>(0xc0 | (uc >> 6));
+                    utf8 += static_cast<char>(0x80 | (uc & 0x3f));
+                }
+                else {
+                    utf8 += static_cast<char>(0xe0 | (uc >> 12));
+                    utf8 += static_cast<char>(0x80 | ((uc >> 6) & 0x3f));
+                    utf8 += static_cast<char>(0x80 | (uc & 0x3f));
+                }
+            }
+
+            const bsl::size_t LEN = utf8.length();
+
+            bsl::vector<unsigned short> utf16(k_NUM_CODE_POINTS + 1, 0, alloc);
+            bsl::string                 back(LEN + 1, 0, alloc);
+
+            double times[4];
+            for (int mi = 0; mi < 4; ++mi) {
+                bsls::Stopwatch sw;
+                sw.start();
+                for (int ii = 0; ii < iterLimit; ++ii) {
+                    int         rc;
+                    bsl::size_t numCodePoints, numUnits;
+
+                    switch (mi) {
+                      case 0: {
+                        rc = Util::utf8ToUtf16(utf16.data(),
+                                               utf16.size(),
+                                               bsl::string_view(utf8),
+                                               &numCodePoints,
+                                               &numUnits);
+                      } break;
+                      case 1: {
+                        rc = Util::utf8ToUtf16(utf16.data(),
+                                               utf16.size(),
+                                               utf8.c_str(),
+                                               &numCodePoints,
+                                               &numUnits);
+                      } break;
+                      case 2: {
+                        rc = Util::utf16ToUtf8(back.data(),
+                                               back.length(),
+                                               utf16.data(),
+                                               utf16.size() - 1,
+                                               &numCodePoints,
+                                               &numUnits);
+                      } break;
+                      default: {
+                        rc = Util::utf16ToUtf8(back.data(),
+                                               back.length(),
+                                               utf16.data(),
+                                               &numCodePoints,
+                                               &numUnits);
+                      } break;
+                    }
+                    ASSERTV(ti, mi, rc, 0 == rc);
+                    ASSERTV(ti, mi, numCodePoints,
+                                    k_NUM_CODE_POINTS + 1 == numCodePoints);
+                }
+                sw.stop();
+                times[mi] = sw.accumulatedWallTime();
+            }
+            ASSERTV(ti, 0 == bsl::strcmp(back.c_str(), utf8.c_str()));
+
+            const double MB = static_cast<double>(LEN) * iterLimit / 1e6;
+
+            cout << TEXTS[ti].d_name << " (" << LEN << " octets):\n"
+                 << "    UTF-8 -> UTF-16: length-delimited "
+                 << MB / times[0] << " MB/s, null-terminated "
+                 << MB / times[1] << " MB/s\n"
+                 << "    UTF-16 -> UTF-8: length-delimited "
+                 << MB / times[2] << " MB/s, null-terminated "
+                 << MB / times[3] << " MB/s\n";
+        }
+      } break;
 
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
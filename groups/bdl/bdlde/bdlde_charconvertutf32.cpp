@@ -9,8 +9,11 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>     // 'BSLMF_ASSERT'
 #include <bslmf_issame.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
@@ -18,6 +21,17 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>      // 'CHAR_BIT'
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_CHARCONVERTUTF32_SSE41_ENABLED 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -379,6 +393,11 @@ class Utf8PtrBasedEnd {
     /// `position <= d_end`.
     bool isFinished(const OctetType *position) const;
 
+    /// Return the number of octets of input from the specified `position`
+    /// to the end of input.  The behavior is undefined unless
+    /// `position <= d_end`.
+    bsl::size_t numAvailable(const OctetType *position) const;
+
     /// Return a pointer to after the specified `skipBy` consecutive
     /// continuation bytes following the specified `octets` that are prior
     /// to `d_end`.  The behavior is undefined unless `octets <= d_end`.
@@ -415,6 +434,14 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numAvailable(const OctetType *position) const
+{
+    BSLS_ASSERT(d_end >= position);
+
+    return d_end - position;
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -473,6 +500,11 @@ struct Utf8ZeroBasedEnd {
     /// and `false` otherwise.
     bool isFinished(const OctetType *position) const;
 
+    /// Return 0.  Note that the extent of null-terminated input is not known
+    /// in advance, so no octet past the one being examined may be read
+    /// before it is known that the input has not ended.
+    bsl::size_t numAvailable(const OctetType *) const;
+
     /// Return a pointer to after up to the specified `skipBy` consecutive
     /// continuation bytes following the specified `octets`.  The function
     /// will skip over less than `skipBy` octets if it encounters end of
@@ -504,6 +536,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numAvailable(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -567,6 +605,11 @@ class Utf32PtrBasedEnd {
     /// `false` otherwise.  The behavior is undefined unless
     /// `position <= d_end`.
     bool isFinished(const unsigned int *position) const;
+
+    /// Return the number of words of input from the specified `position`
+    /// to the end of input.  The behavior is undefined unless
+    /// `position <= d_end`.
+    bsl::size_t numAvailable(const unsigned int *position) const;
 };
 
                         // ---------------------------
@@ -592,6 +635,14 @@ bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
     }
 }
 
+inline
+bsl::size_t Utf32PtrBasedEnd::numAvailable(const unsigned int *position) const
+{
+    BSLS_ASSERT(d_end_p >= position);
+
+    return d_end_p - position;
+}
+
                        // ==============================
                        // local struct Utf32ZeroBasedEnd
                        // ==============================
@@ -607,6 +658,11 @@ struct Utf32ZeroBasedEnd {
     /// Return `true` if the specified `position` is at the end of input,
     /// and `false` otherwise.
     bool isFinished(const unsigned int *position) const;
+
+    /// Return 0.  Note that the extent of null-terminated input is not known
+    /// in advance, so no word past the one being examined may be read
+    /// before it is known that the input has not ended.
+    bsl::size_t numAvailable(const unsigned int *) const;
 };
 
                        // ------------------------------
@@ -626,6 +682,12 @@ bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf32ZeroBasedEnd::numAvailable(const unsigned int *) const
+{
+    return 0;
+}
+
 }  // close unnamed namespace
 
 /// Return the specified `ptr` cast to a `const OctetType *`.  Note that
@@ -856,6 +918,375 @@ const OctetType *skipUtf8CodePoint(const OctetType *input)
     return input + lookaheadContinuations(input, expected);
 }
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+// The length-delimited translation and size-computation routines below pass
+// over runs of ASCII input a block of `k_BLOCK_SIZE` code points at a time,
+// rather than one code point at a time, widening or narrowing each block with
+// a few SSE2 instructions.  On x86-64 with GCC or Clang where the CPU supports
+// SSE4.1 (and hence the SSSE3 byte shuffle), the translation routines also
+// pass over blocks of `k_BMP_BLOCK_SIZE` code points that are all encoded in
+// three octets of UTF-8 (e.g., CJK text).  The three-octet kernels are
+// compiled for SSE4.1 with a `target` attribute regardless of the instruction
+// set the rest of the build targets, and are used only if
+// `hasThreeOctetKernels`, which checks the CPU once per process, returns
+// `true`.  A block is translated this way only if every code point in it is
+// valid, so the output is identical either way.  Blocks are only read when
+// entirely within the input, which rules out null-terminated input, and only
+// written when entirely within the output capacity.  After an attempt to
+// translate a block of three-octet code points fails, the next
+// `k_BLOCK_BACKOFF` units of input are translated one code point at a time
+// before another is attempted.
+
+enum {
+    k_BLOCK_SIZE     = 16,  // number of octets or words in a block
+
+    k_BMP_BLOCK_SIZE =  8,  // number of code points in a block of three-octet
+                            // code points
+
+    k_BLOCK_BACKOFF  = 64   // number of octets or words of input to translate
+                            // one code point at a time after failing to
+                            // translate a block of three-octet code points
+};
+
+/// Return the number of consecutive unset bits at the low-order end of the
+/// specified `mask`.  The behavior is undefined unless `0 != mask`.
+static inline
+int numTrailingUnsetBits(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int ret = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++ret;
+    }
+    return ret;
+#endif
+}
+
+/// Return the 16 bytes beginning at the specified `position`.
+static inline
+__m128i loadBlock(const void *position)
+{
+    return _mm_loadu_si128(static_cast<const __m128i *>(position));
+}
+
+/// Write the specified `block` to the 16 bytes beginning at the specified
+/// `position`.
+static inline
+void storeBlock(void *position, __m128i block)
+{
+    _mm_storeu_si128(static_cast<__m128i *>(position), block);
+}
+
+/// Return the number of consecutive ASCII octets at the start of the
+/// `k_BLOCK_SIZE` octets beginning at the specified `octets`.
+static inline
+int numLeadingAsciiOctets(const OctetType *octets)
+{
+    const int nonAscii = _mm_movemask_epi8(loadBlock(octets));
+
+    return nonAscii ? numTrailingUnsetBits(nonAscii) : k_BLOCK_SIZE;
+}
+
+/// Return the number of consecutive words, at the start of the
+/// `k_BLOCK_SIZE` words beginning at the specified `words`, that
+/// `SWAPPER::swapBytes` translates to ASCII.
+template <class SWAPPER>
+static inline
+int numLeadingAsciiWords(const unsigned int *words)
+{
+    // A word is ASCII if all but the low-order 7 bits of its value are unset,
+    // and those bits are in the highest-addressed byte of a swapped word.
+
+    const int     nonAsciiBits = bsl::is_same<SWAPPER, Swapper>::value
+                               ? static_cast<int>(0x80ffffff)
+                               : static_cast<int>(0xffffff80);
+    const __m128i mask         = _mm_set1_epi32(nonAsciiBits);
+    const __m128i zero         = _mm_setzero_si128();
+
+    unsigned int ascii = 0;
+    for (int i = 0; i < k_BLOCK_SIZE; i += 4) {
+        const __m128i isAscii = _mm_cmpeq_epi32(
+                             _mm_and_si128(loadBlock(words + i), mask), zero);
+
+        ascii |= _mm_movemask_ps(_mm_castsi128_ps(isAscii)) << i;
+    }
+
+    return 0xffff == ascii ? k_BLOCK_SIZE
+                           : numTrailingUnsetBits(~ascii);
+}
+
+/// Translate the consecutive ASCII octets at the start of the
+/// `k_BLOCK_SIZE` octets beginning at the specified `octets` to words,
+/// encoded by `SWAPPER::swapBytes`, written to the specified `output`, and
+/// return the number of code points translated.  The behavior is undefined
+/// unless `output` has room for `k_BLOCK_SIZE` words.
+template <class SWAPPER>
+static inline
+int widenAsciiOctets(unsigned int *output, const OctetType *octets)
+{
+    const int numAscii = numLeadingAsciiOctets(octets);
+
+    if (k_BLOCK_SIZE == numAscii) {
+        // Interleaving zero bytes before the octets instead of after them puts
+        // each octet in the highest-addressed byte of its word.
+
+        const __m128i block = loadBlock(octets);
+        const __m128i zero  = _mm_setzero_si128();
+
+        if (bsl::is_same<SWAPPER, Swapper>::value) {
+            const __m128i lo = _mm_unpacklo_epi8(zero, block);
+            const __m128i hi = _mm_unpackhi_epi8(zero, block);
+
+            storeBlock(output,      _mm_unpacklo_epi16(zero, lo));
+            storeBlock(output +  4, _mm_unpackhi_epi16(zero, lo));
+            storeBlock(output +  8, _mm_unpacklo_epi16(zero, hi));
+            storeBlock(output + 12, _mm_unpackhi_epi16(zero, hi));
+        }
+        else {
+            const __m128i lo = _mm_unpacklo_epi8(block, zero);
+            const __m128i hi = _mm_unpackhi_epi8(block, zero);
+
+            storeBlock(output,      _mm_unpacklo_epi16(lo, zero));
+            storeBlock(output +  4, _mm_unpackhi_epi16(lo, zero));
+            storeBlock(output +  8, _mm_unpacklo_epi16(hi, zero));
+            storeBlock(output + 12, _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+    else {
+        for (int i = 0; i < numAscii; ++i) {
+            output[i] = SWAPPER::swapBytes(octets[i]);
+        }
+    }
+
+    return numAscii;
+}
+
+/// Translate the consecutive words that `SWAPPER::swapBytes` translates to
+/// ASCII at the start of the `k_BLOCK_SIZE` words beginning at the specified
+/// `words` to octets written to the specified `output`, and return the
+/// number of code points translated.  The behavior is undefined unless
+/// `output` has room for `k_BLOCK_SIZE` octets.
+template <class SWAPPER>
+static inline
+int narrowAsciiWords(OctetType *output, const unsigned int *words)
+{
+    const int numAscii = numLeadingAsciiWords<SWAPPER>(words);
+
+    if (k_BLOCK_SIZE == numAscii) {
+        __m128i block[4];
+        for (int i = 0; i < 4; ++i) {
+            block[i] = loadBlock(words + 4 * i);
+            if (bsl::is_same<SWAPPER, Swapper>::value) {
+                block[i] = _mm_srli_epi32(block[i], 24);
+            }
+        }
+
+        storeBlock(output,
+                   _mm_packus_epi16(_mm_packs_epi32(block[0], block[1]),
+                                    _mm_packs_epi32(block[2], block[3])));
+    }
+    else {
+        for (int i = 0; i < numAscii; ++i) {
+            output[i] = static_cast<OctetType>(SWAPPER::swapBytes(words[i]));
+        }
+    }
+
+    return numAscii;
+}
+
+/// Return `true` if the current CPU supports the SSE4.1 instructions used by
+/// `decodeThreeOctetBlock` and `encodeThreeOctetBlock`, and `false`
+/// otherwise.
+static inline
+bool hasThreeOctetKernels()
+{
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+    static bool s_isSupported = false;
+    BSLMT_ONCE_DO {
+        unsigned int eax, ebx, ecx, edx;
+        s_isSupported = __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+                     && (ecx & bit_SSE4_1);
+    }
+    return s_isSupported;
+#else
+    return false;
+#endif
+}
+
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+/// Return the specified `words` with the order of the bytes of each of its
+/// 32-bit lanes reversed.
+__attribute__((target("sse4.1")))
+static inline
+__m128i swapWordBytes(__m128i words)
+{
+    return _mm_shuffle_epi8(words, _mm_setr_epi8( 3,  2,  1,  0,
+                                                  7,  6,  5,  4,
+                                                 11, 10,  9,  8,
+                                                 15, 14, 13, 12));
+}
+
+/// Return the code points encoded by the specified `sequences`, each of
+/// whose 32-bit lanes holds a three-octet sequence, header first, in its
+/// low-order 24 bits, in the corresponding 32-bit lanes.
+static inline
+__m128i decodeThreeOctetLanes(__m128i sequences)
+{
+    return _mm_or_si128(
+         _mm_or_si128(
+             _mm_and_si128(_mm_srli_epi32(sequences, 4),
+                           _mm_set1_epi32(0xf000)),
+             _mm_and_si128(_mm_srli_epi32(sequences, 2),
+                           _mm_set1_epi32(0x0fc0))),
+         _mm_and_si128(sequences, _mm_set1_epi32(0x003f)));
+}
+
+/// Return a value having all bits of each 32-bit lane set if the value in
+/// the corresponding lane of the specified `values` is below 0x800 (i.e.,
+/// has an over-long three-octet encoding) or is reserved for UTF-16
+/// surrogates, and having all bits of it unset otherwise.  The behavior is
+/// undefined unless each of `values` is below 0x10000.
+static inline
+__m128i notThreeOctetLanes(__m128i values)
+{
+    const __m128i top = _mm_and_si128(values, _mm_set1_epi32(0xf800));
+
+    return _mm_or_si128(_mm_cmpeq_epi32(top, _mm_setzero_si128()),
+                        _mm_cmpeq_epi32(top, _mm_set1_epi32(0xd800)));
+}
+
+/// Write to the specified `output` the `k_BMP_BLOCK_SIZE` code points
+/// encoded by the `3 * k_BMP_BLOCK_SIZE` octets beginning at the specified
+/// `octets`, with the bytes of each word reversed if the specified
+/// `swapBytes` is `true`, and return `true` if those octets are
+/// `k_BMP_BLOCK_SIZE` valid three-octet sequences; otherwise, return `false`
+/// with no effect on `output`.  The behavior is undefined unless
+/// `hasThreeOctetKernels()` and `output` has room for `k_BMP_BLOCK_SIZE`
+/// words.
+__attribute__((target("sse4.1")))
+static
+bool decodeThreeOctetBlock(unsigned int    *output,
+                           const OctetType *octets,
+                           bool             swapBytes)
+{
+    // Gather each sequence into the low-order 24 bits of a 32-bit lane, header
+    // octet most significant; sequences 0-3 come from the first 12 octets of
+    // 'lo', and sequences 4-7 from the last 12 octets of 'hi'.
+
+    const __m128i lo = loadBlock(octets);
+    const __m128i hi = loadBlock(octets + 3 * k_BMP_BLOCK_SIZE - k_BLOCK_SIZE);
+
+    const __m128i seqLo = _mm_shuffle_epi8(lo, _mm_setr_epi8( 2,  1,  0, -1,
+                                                              5,  4,  3, -1,
+                                                              8,  7,  6, -1,
+                                                             11, 10,  9, -1));
+    const __m128i seqHi = _mm_shuffle_epi8(hi, _mm_setr_epi8( 6,  5,  4, -1,
+                                                              9,  8,  7, -1,
+                                                             12, 11, 10, -1,
+                                                             15, 14, 13, -1));
+
+    const __m128i tagMask = _mm_set1_epi32(0x00f0c0c0);
+    const __m128i tags    = _mm_set1_epi32(0x00e08080);
+    const __m128i tagged  = _mm_and_si128(
+                      _mm_cmpeq_epi32(_mm_and_si128(seqLo, tagMask), tags),
+                      _mm_cmpeq_epi32(_mm_and_si128(seqHi, tagMask), tags));
+    if (0xffff != _mm_movemask_epi8(tagged)) {
+        return false;                                                 // RETURN
+    }
+
+    __m128i valuesLo = decodeThreeOctetLanes(seqLo);
+    __m128i valuesHi = decodeThreeOctetLanes(seqHi);
+
+    if (0 != _mm_movemask_epi8(_mm_or_si128(notThreeOctetLanes(valuesLo),
+                                            notThreeOctetLanes(valuesHi)))) {
+        return false;                                                 // RETURN
+    }
+
+    if (swapBytes) {
+        valuesLo = swapWordBytes(valuesLo);
+        valuesHi = swapWordBytes(valuesHi);
+    }
+
+    storeBlock(output,                        valuesLo);
+    storeBlock(output + k_BMP_BLOCK_SIZE / 2, valuesHi);
+    return true;
+}
+
+/// Write to the specified `output` the `3 * k_BMP_BLOCK_SIZE` octets of
+/// UTF-8 encoding the `k_BMP_BLOCK_SIZE` words beginning at the specified
+/// `words`, the bytes of each of which are first reversed if the specified
+/// `swapBytes` is `true`, and return `true` if those words all encode to
+/// three octets of UTF-8; otherwise, return `false` with no effect on
+/// `output`.  The behavior is undefined unless `hasThreeOctetKernels()` and
+/// `output` has room for `3 * k_BMP_BLOCK_SIZE` octets.
+__attribute__((target("sse4.1")))
+static
+bool encodeThreeOctetBlock(OctetType          *output,
+                           const unsigned int *words,
+                           bool                swapBytes)
+{
+    __m128i lo = loadBlock(words);
+    __m128i hi = loadBlock(words + k_BMP_BLOCK_SIZE / 2);
+    if (swapBytes) {
+        lo = swapWordBytes(lo);
+        hi = swapWordBytes(hi);
+    }
+
+    if (!_mm_testz_si128(_mm_or_si128(lo, hi),
+                         _mm_set1_epi32(static_cast<int>(0xffff0000)))
+     || 0 != _mm_movemask_epi8(_mm_or_si128(notThreeOctetLanes(lo),
+                                            notThreeOctetLanes(hi)))) {
+        return false;                                                 // RETURN
+    }
+
+    // Lay out the header and middle octets of each sequence in the low- and
+    // high-order bytes of each 16-bit lane of 'headMid', and shuffle those
+    // and the low-order bytes of 'last' into 24 octets of output.
+
+    const __m128i values  = _mm_packus_epi32(lo, hi);
+    const __m128i header  = _mm_or_si128(_mm_srli_epi16(values, 12),
+                                         _mm_set1_epi16(0xe0));
+    const __m128i middle  = _mm_or_si128(
+                                  _mm_and_si128(_mm_srli_epi16(values, 6),
+                                                _mm_set1_epi16(0x3f)),
+                                  _mm_set1_epi16(0x80));
+    const __m128i last    = _mm_or_si128(
+                                  _mm_and_si128(values, _mm_set1_epi16(0x3f)),
+                                  _mm_set1_epi16(0x80));
+    const __m128i headMid = _mm_or_si128(header, _mm_slli_epi16(middle, 8));
+
+    const __m128i out0 = _mm_or_si128(
+                 _mm_shuffle_epi8(headMid, _mm_setr_epi8( 0,  1, -1,  2,
+                                                          3, -1,  4,  5,
+                                                         -1,  6,  7, -1,
+                                                          8,  9, -1, 10)),
+                 _mm_shuffle_epi8(last,    _mm_setr_epi8(-1, -1,  0, -1,
+                                                         -1,  2, -1, -1,
+                                                          4, -1, -1,  6,
+                                                         -1, -1,  8, -1)));
+    const __m128i out1 = _mm_or_si128(
+                 _mm_shuffle_epi8(headMid, _mm_setr_epi8(11, -1, 12, 13,
+                                                         -1, 14, 15, -1,
+                                                         -1, -1, -1, -1,
+                                                         -1, -1, -1, -1)),
+                 _mm_shuffle_epi8(last,    _mm_setr_epi8(-1, 10, -1, -1,
+                                                         12, -1, -1, 14,
+                                                         -1, -1, -1, -1,
+                                                         -1, -1, -1, -1)));
+
+    storeBlock(output, out0);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output + k_BLOCK_SIZE),
+                     out1);
+    return true;
+}
+#endif
+#endif
+
 /// Return the number of `unsigned int`s sufficient to store the UTF-8
 /// sequence beginning at the specified `input`, including the terminating 0
 /// word of the output.  Use the specified `endFunctor` to determine end of
@@ -882,8 +1313,20 @@ bsl::size_t utf32BufferLengthNeeded(const char  *input,
     const OctetType *octets = constOctetCast(input);
 
     bsl::size_t ret = 0;
-    for (; ! endFunctor.isFinished(octets); ++ret) {
+    while (! endFunctor.isFinished(octets)) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(endFunctor.numAvailable(octets) < k_BLOCK_SIZE)) {
+            const int numAscii = numLeadingAsciiOctets(octets);
+            if (numAscii) {
+                octets += numAscii;
+                ret    += numAscii;
+                continue;
+            }
+        }
+#endif
+
         octets = skipUtf8CodePoint(octets);
+        ++ret;
     }
 
     return ret + 1;
@@ -914,6 +1357,17 @@ bsl::size_t utf8BufferLengthNeeded(const unsigned int *input,
     unsigned int uc;
     bsl::size_t ret = 0;
     for (; !endFunctor.isFinished(input); ++input) {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(endFunctor.numAvailable(input) < k_BLOCK_SIZE)) {
+            const int numAscii = numLeadingAsciiWords<SWAPPER>(input);
+            if (numAscii) {
+                input += numAscii - 1;
+                ret   += numAscii;
+                continue;
+            }
+        }
+#endif
+
         uc = SWAPPER::swapBytes(*input);
         ret += fitsInSingleOctet(uc)
                ? 1
@@ -1176,7 +1630,45 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     BSLS_ASSERT(translator.d_capacity >= 1);
 
     int ret = 0;
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+    const OctetType *nextBlock = translator.d_input;
+#endif
     while (!endFunctor.isFinished(translator.d_input)) {
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+        if (isThreeOctetHeader(translator.d_input[0])
+               && !(translator.d_input < nextBlock)
+               && !(endFunctor.numAvailable(translator.d_input) <
+                                                        3 * k_BMP_BLOCK_SIZE)
+               && translator.d_capacity >= k_BMP_BLOCK_SIZE + 1
+               && hasThreeOctetKernels()) {
+            if (decodeThreeOctetBlock(translator.d_output,
+                                      translator.d_input,
+                                      bsl::is_same<SWAPPER, Swapper>::value)) {
+                translator.d_input    += 3 * k_BMP_BLOCK_SIZE;
+                translator.d_output   += k_BMP_BLOCK_SIZE;
+                translator.d_capacity -= k_BMP_BLOCK_SIZE;
+                continue;
+            }
+            nextBlock = translator.d_input + bsl::min<bsl::size_t>(
+                                  k_BLOCK_BACKOFF,
+                                  endFunctor.numAvailable(translator.d_input));
+        }
+#endif
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (isSingleOctet(translator.d_input[0])
+               && !(endFunctor.numAvailable(translator.d_input) < k_BLOCK_SIZE)
+               && translator.d_capacity >= k_BLOCK_SIZE + 1
+               && isSingleOctet(translator.d_input[1])) {
+            const int numAscii = widenAsciiOctets<SWAPPER>(
+                                                          translator.d_output,
+                                                          translator.d_input);
+            translator.d_input    += numAscii;
+            translator.d_output   += numAscii;
+            translator.d_capacity -= numAscii;
+            continue;
+        }
+#endif
+
         if (0 != translator.decodeCodePoint()) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret = k_OUT_OF_SPACE_BIT;
@@ -1452,7 +1944,49 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
 
     int          ret = 0;
     unsigned int uc;
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+    const unsigned int *nextBlock = translator.d_input;
+#endif
     while (!endFunctor.isFinished(translator.d_input)) {
+#if defined(BDLDE_CHARCONVERTUTF32_SSE41_ENABLED)
+        if (!(translator.d_input < nextBlock)
+               && !(endFunctor.numAvailable(translator.d_input) <
+                                                            k_BMP_BLOCK_SIZE)
+               && translator.d_capacity >= 3 * k_BMP_BLOCK_SIZE + 1
+               && !fitsInTwoOctets(SWAPPER::swapBytes(translator.d_input[0]))
+               && fitsInThreeOctets(SWAPPER::swapBytes(translator.d_input[0]))
+               && hasThreeOctetKernels()) {
+            if (encodeThreeOctetBlock(translator.d_output,
+                                      translator.d_input,
+                                      bsl::is_same<SWAPPER, Swapper>::value)) {
+                translator.d_input                += k_BMP_BLOCK_SIZE;
+                translator.d_output               += 3 * k_BMP_BLOCK_SIZE;
+                translator.d_capacity             -= 3 * k_BMP_BLOCK_SIZE;
+                translator.d_numCodePointsWritten += k_BMP_BLOCK_SIZE;
+                continue;
+            }
+            nextBlock = translator.d_input + bsl::min<bsl::size_t>(
+                                  k_BLOCK_BACKOFF,
+                                  endFunctor.numAvailable(translator.d_input));
+        }
+#endif
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        if (!(endFunctor.numAvailable(translator.d_input) < k_BLOCK_SIZE)
+               && translator.d_capacity >= k_BLOCK_SIZE + 1
+               && fitsInSingleOctet(SWAPPER::swapBytes(translator.d_input[0]))
+               && fitsInSingleOctet(
+                                  SWAPPER::swapBytes(translator.d_input[1]))) {
+            const int numAscii = narrowAsciiWords<SWAPPER>(
+                                                          translator.d_output,
+                                                          translator.d_input);
+            translator.d_input                += numAscii;
+            translator.d_output               += numAscii;
+            translator.d_capacity             -= numAscii;
+            translator.d_numCodePointsWritten += numAscii;
+            continue;
+        }
+#endif
+
         uc = SWAPPER::swapBytes(*translator.d_input++);
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
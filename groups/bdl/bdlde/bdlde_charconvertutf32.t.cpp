@@ -63,7 +63,9 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
+// [18] Block-wise translation matches code point translation
+// [17] UTF-32 <- UTF-8 Table generated random sequences, embedded nulls
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
 // [14] UTF-8 <- UTF-32 Random garbage input, random error byte
@@ -2763,6 +2765,11 @@ struct TestDriver
 {
     // TEST CASES
 
+    /// Test that translating length-delimited input, runs of which are
+    /// translated a block at a time, matches translating the same input
+    /// null-terminated.
+    static void testCase18();
+
     /// Test `utf-8 -> utf32` translation with embedded nulls using the
     /// table-driven technique.
     template <class VECTOR_C, class VECTOR_UI, class STRING>
@@ -2830,6 +2837,186 @@ struct TestDriver
                                 // TEST CASES
                                 // ----------
 
+void TestDriver::testCase18()
+{
+    enum { k_ITERATIONS = 4 * 1000,
+           k_MARGIN     = 32,
+           k_MARKER     = 0x5a5a5a5a };
+
+    const bdlde::ByteOrder::Enum ORDERS[] = { bdlde::ByteOrder::e_HOST,
+                                              oppositeEndian };
+
+    for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+        // Build a host-order UTF-32 sequence of runs of ASCII, of runs of
+        // code points encoded in three octets of UTF-8, occasionally
+        // interrupted by a surrogate, and of runs of random words of any
+        // kind, including invalid ones, with lengths on both sides of the
+        // block sizes.
+
+        bsl::vector<unsigned int> utf32;
+        const int numRuns = 1 + myRand15() % 8;
+        for (int jj = 0; jj < numRuns; ++jj) {
+            const int kind = myRand15() % 4;
+            const int len  = myRand15() % 48;
+            for (int kk = 0; kk < len; ++kk) {
+                unsigned int uc;
+                switch (kind) {
+                  case 0: {
+                    uc = myRandUtf32Word();
+                  } break;
+                  case 1: {
+                    uc = 0 == myRand15() % 32
+                       ? 0xd800 + myRand15() % 0x800
+                       : 0x800 + myRand32() % (0x10000 - 0x800);
+                    if (0 != myRand15() % 32
+                                         && 0xd800 <= uc && uc < 0xe000) {
+                        uc += 0x800;
+                    }
+                  } break;
+                  default: {
+                    uc = 1 + myRand15() % 0x7f;
+                  } break;
+                }
+                utf32.push_back(uc);
+            }
+        }
+        utf32.push_back(0);
+
+        // Build the UTF-8 from the UTF-32, which replaces the invalid words
+        // with '?', then splice stray continuation octets into some of it to
+        // make it invalid.
+
+        bsl::string utf8;
+        Util::utf32ToUtf8(&utf8, utf32.data());
+        if (!utf8.empty() && 0 == myRand15() % 2) {
+            const int numStray = 1 + myRand15() % 4;
+            for (int kk = 0; kk < numStray; ++kk) {
+                utf8.insert(myRand15() % utf8.length(),
+                            1,
+                            static_cast<char>(0x80 | myRand15()));
+            }
+        }
+
+        const bsl::size_t UTF8_LEN  = utf8.length();
+        const bsl::size_t UTF32_LEN = utf32.size() - 1;
+
+        if (veryVerbose) {
+            P_(ii);    P_(UTF8_LEN);    P(UTF32_LEN);
+        }
+
+        for (int bi = 0; bi < 2; ++bi) {
+            const bdlde::ByteOrder::Enum ORDER = ORDERS[bi];
+
+            bsl::vector<unsigned int> utf32In(utf32);
+            if (bdlde::ByteOrder::e_HOST != ORDER) {
+                for (bsl::size_t kk = 0; kk < UTF32_LEN; ++kk) {
+                    utf32In[kk] = sb(utf32In[kk]);
+                }
+            }
+
+            for (int ei = 0; ei < 2; ++ei) {
+                const unsigned int  ERROR_WORD = ei ? 0 : '?';
+                const char          ERROR_BYTE = ei ? 0 : '?';
+
+                // UTF-8 -> UTF-32, to a vector, to test the size
+                // computations.
+
+                bsl::vector<unsigned int> blockVec, scalarVec;
+                int rc  = Util::utf8ToUtf32(&blockVec,
+                                            bsl::string_view(utf8),
+                                            ERROR_WORD,
+                                            ORDER);
+                int rcB = Util::utf8ToUtf32(&scalarVec,
+                                            utf8.c_str(),
+                                            ERROR_WORD,
+                                            ORDER);
+                LOOP4_ASSERT(ii, bi, rc, rcB, rc == rcB);
+                LOOP2_ASSERT(ii, bi, blockVec == scalarVec);
+
+                // UTF-32 -> UTF-8, to a string, to test the size
+                // computations.
+
+                bsl::string blockStr, scalarStr;
+                bsl::size_t numCP, numCPB;
+                rc  = Util::utf32ToUtf8(&blockStr,
+                                        utf32In.data(),
+                                        UTF32_LEN,
+                                        &numCP,
+                                        ERROR_BYTE,
+                                        ORDER);
+                rcB = Util::utf32ToUtf8(&scalarStr,
+                                        utf32In.data(),
+                                        &numCPB,
+                                        ERROR_BYTE,
+                                        ORDER);
+                LOOP4_ASSERT(ii, bi, rc, rcB, rc == rcB);
+                LOOP4_ASSERT(ii, bi, numCP, numCPB, numCP == numCPB);
+                LOOP2_ASSERT(ii, bi, blockStr == scalarStr);
+
+                // Both ways, to fixed-length buffers of ample and of random
+                // capacity.
+
+                for (int ci = 0; ci < 4; ++ci) {
+                    const bsl::size_t CAPACITY32 = 0 == ci
+                                           ? scalarVec.size() + k_MARGIN
+                                           : myRand32() % (UTF32_LEN + 2);
+
+                    bsl::vector<unsigned int> blockBuf(CAPACITY32 + k_MARGIN,
+                                                       k_MARKER);
+                    bsl::vector<unsigned int> scalarBuf(blockBuf);
+                    bsl::size_t               numWords, numWordsB;
+
+                    rc  = Util::utf8ToUtf32(blockBuf.data(),
+                                            CAPACITY32,
+                                            bsl::string_view(utf8),
+                                            &numWords,
+                                            ERROR_WORD,
+                                            ORDER);
+                    rcB = Util::utf8ToUtf32(scalarBuf.data(),
+                                            CAPACITY32,
+                                            utf8.c_str(),
+                                            &numWordsB,
+                                            ERROR_WORD,
+                                            ORDER);
+                    LOOP5_ASSERT(ii, bi, ci, rc, rcB, rc == rcB);
+                    LOOP5_ASSERT(ii, bi, ci, numWords, numWordsB,
+                                                      numWords == numWordsB);
+                    LOOP3_ASSERT(ii, bi, ci, blockBuf == scalarBuf);
+
+                    const bsl::size_t CAPACITY8 = 0 == ci
+                                           ? scalarStr.length() + k_MARGIN
+                                           : myRand32() % (UTF8_LEN + 2);
+
+                    bsl::string blockOut(CAPACITY8 + k_MARGIN, 'Z');
+                    bsl::string scalarOut(blockOut);
+                    bsl::size_t numBytes, numBytesB;
+
+                    rc  = Util::utf32ToUtf8(blockOut.data(),
+                                            CAPACITY8,
+                                            utf32In.data(),
+                                            UTF32_LEN,
+                                            &numCP,
+                                            &numBytes,
+                                            ERROR_BYTE,
+                                            ORDER);
+                    rcB = Util::utf32ToUtf8(scalarOut.data(),
+                                            CAPACITY8,
+                                            utf32In.data(),
+                                            &numCPB,
+                                            &numBytesB,
+                                            ERROR_BYTE,
+                                            ORDER);
+                    LOOP5_ASSERT(ii, bi, ci, rc, rcB, rc == rcB);
+                    LOOP5_ASSERT(ii, bi, ci, numCP, numCPB, numCP == numCPB);
+                    LOOP5_ASSERT(ii, bi, ci, numBytes, numBytesB,
+                                                      numBytes == numBytesB);
+                    LOOP3_ASSERT(ii, bi, ci, blockOut == scalarOut);
+                }
+            }
+        }
+    }
+}
+
 template <class VECTOR_C, class VECTOR_UI, class STRING>
 void TestDriver::testCase17()
 {
@@ -5771,7 +5958,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Simple example illustrating how one might use the 'utf8ToUtf32'
@@ -5901,6 +6088,44 @@ int main(int argc, char **argv)
     ASSERT(v32.size()                   == codePointsWritten);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE TRANSLATION TEST
+        //
+        // Concerns:
+        //: 1 That translating length-delimited input, which passes over runs
+        //:   of ASCII, and of code points encoded in three octets of UTF-8, a
+        //:   block at a time where the platform supports it, produces exactly
+        //:   the same output, counts, and status as translating the same input
+        //:   null-terminated, which is always done one code point at a time.
+        //:
+        //: 2 That this holds for runs of any length around the block sizes,
+        //:   for runs interrupted by other or invalid input, in either byte
+        //:   order, with or without an error word or byte, and whenever the
+        //:   output capacity runs out.
+        //:
+        //: 3 That the sizes computed for container output are the same for
+        //:   length-delimited and null-terminated input.
+        //
+        // Plan:
+        //: 1 Build random UTF-32 sequences of runs of ASCII words, of runs of
+        //:   words encoded in three octets of UTF-8, and of runs of random
+        //:   words, and the corresponding UTF-8, into which stray continuation
+        //:   octets are sometimes spliced.
+        //:
+        //: 2 Translate each in both directions, in both byte orders, with
+        //:   both '?' and 0 as the error word or byte, into containers and
+        //:   into buffers of ample and of random capacity filled beforehand
+        //:   with a marker value, passing the input both length-delimited and
+        //:   null-terminated, and observe that the return values, the counts
+        //:   returned, and the entire outputs are the same.  (C-1..3)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBLOCK-WISE TRANSLATION TEST\n"
+                               "===========================\n";
+
+        TestDriver::testCase18();
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // RANDOM TABLE DRIVEN UTF-8 -> UTF-32 TEST PLUS EMBEDDED NULLS
@@ -7541,6 +7766,129 @@ int main(int argc, char **argv)
             "valid: " << seq8 << '\n';
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE TRANSLATION BENCHMARK
+        //
+        // Concerns:
+        //: 1 That translating length-delimited input, which passes over runs
+        //:   of ASCII, and of code points encoded in three octets of UTF-8, a
+        //:   block at a time where the platform supports it, is faster than
+        //:   translating null-terminated input, which is always done one code
+        //:   point at a time.
+        //
+        // Plan:
+        //: 1 Build UTF-8 text of ASCII, two-octet (Cyrillic), three-octet
+        //:   (CJK), and mixed code points, and time translating it to UTF-32
+        //:   and back, passing it both length-delimited and null-terminated.
+        //:   Report the throughput of each in megabytes of UTF-8 per second.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BLOCK-WISE TRANSLATION BENCHMARK\n"
+                             "================================\n";
+
+        enum { k_NUM_CODE_POINTS = 64 * 1024 };
+
+        const int iterLimit = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        static const struct {
+            const char *d_name;           // name of the text
+            unsigned    d_base;           // first code point of the script
+            unsigned    d_range;          // number of code points to cycle
+            bool        d_hasSpaces;      // whether words are separated
+        } TEXTS[] = {
+            { "ASCII",          'a',   26, true  },
+            { "two-octet",   0x0430,   32, true  },
+            { "three-octet", 0x4e00, 4096, false },
+            { "mixed",       0x0000,    0, true  },
+        };
+        enum { k_NUM_TEXTS = sizeof TEXTS / sizeof *TEXTS };
+
+        for (int ti = 0; ti < k_NUM_TEXTS; ++ti) {
+            // Words of each text but the CJK one are separated by ASCII
+            // spaces and newlines; the words of the mixed text alternate
+            // between ASCII, Cyrillic, and CJK.
+
+            bsl::vector<unsigned int> utf32;
+            for (int ii = 0; ii < k_NUM_CODE_POINTS; ++ii) {
+                static const unsigned BASES[] = { 'a', 0x0430, 0x4e00 };
+
+                unsigned uc = 0 == TEXTS[ti].d_range
+                            ? BASES[ii / 6 % 3] + ii % 17
+                            : TEXTS[ti].d_base + ii % TEXTS[ti].d_range;
+                if (TEXTS[ti].d_hasSpaces && 0 == (ii + 1) % 6) {
+                    uc = 0 == (ii + 1) % 60 ? '\n' : ' ';
+                }
+                utf32.push_back(uc);
+            }
+            utf32.push_back(0);
+
+            bsl::string utf8;
+            ASSERT(0 == Util::utf32ToUtf8(&utf8, utf32.data()));
+
+            const bsl::size_t LEN = utf8.length();
+
+            bsl::vector<unsigned int> out32(utf32.size());
+            bsl::string               out8(LEN + 1, 0);
+
+            double times[4];
+            for (int mi = 0; mi < 4; ++mi) {
+                bsls::Stopwatch sw;
+                sw.start();
+                for (int ii = 0; ii < iterLimit; ++ii) {
+                    int         rc;
+                    bsl::size_t numCodePoints, numBytes;
+
+                    switch (mi) {
+                      case 0: {
+                        rc = Util::utf8ToUtf32(out32.data(),
+                                               out32.size(),
+                                               bsl::string_view(utf8),
+                                               &numCodePoints);
+                      } break;
+                      case 1: {
+                        rc = Util::utf8ToUtf32(out32.data(),
+                                               out32.size(),
+                                               utf8.c_str(),
+                                               &numCodePoints);
+                      } break;
+                      case 2: {
+                        rc = Util::utf32ToUtf8(out8.data(),
+                                               out8.length(),
+                                               utf32.data(),
+                                               utf32.size() - 1,
+                                               &numCodePoints,
+                                               &numBytes);
+                      } break;
+                      default: {
+                        rc = Util::utf32ToUtf8(out8.data(),
+                                               out8.length(),
+                                               utf32.data(),
+                                               &numCodePoints,
+                                               &numBytes);
+                      } break;
+                    }
+                    LOOP3_ASSERT(ti, mi, rc, 0 == rc);
+                    LOOP3_ASSERT(ti, mi, numCodePoints,
+                                        utf32.size() == numCodePoints);
+                }
+                sw.stop();
+                times[mi] = sw.accumulatedWallTime();
+            }
+            LOOP_ASSERT(ti, out32 == utf32);
+            LOOP_ASSERT(ti, 0 == bsl::strcmp(out8.c_str(), utf8.c_str()));
+
+            const double MB = static_cast<double>(LEN) * iterLimit / 1e6;
+
+            cout << TEXTS[ti].d_name << " (" << LEN << " octets):\n"
+                 << "    UTF-8 -> UTF-32: length-delimited "
+                 << MB / times[0] << " MB/s, null-terminated "
+                 << MB / times[1] << " MB/s\n"
+                 << "    UTF-32 -> UTF-8: length-delimited "
+                 << MB / times[2] << " MB/s, null-terminated "
+                 << MB / times[3] << " MB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -6,7 +6,10 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -85,10 +88,40 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// Where the 'PCLMULQDQ' (carry-less multiplication) instruction is available
+// (determined by 'cpuid' once per process, on x86-64 with GCC or Clang, whose
+// folding functions are compiled for that instruction with 'target' attributes
+// regardless of the instruction set the rest of the build targets), buffers of
+// at least 64 bytes are instead reduced 64 bytes at a time by "folding", as
+// described in Gopal, V., et al., "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction", Intel, 2009.  Four 128-bit
+// accumulators are each multiplied by 'x^512 mod P' (split into two 64-bit
+// halves, as 'PCLMULQDQ' multiplies 64-bit operands) and added to the next 64
+// bytes of input; the accumulators are then folded into one, and, rather than
+// performing a Barrett reduction, the final 16 bytes of the accumulator (and
+// any remaining input) are passed through the table-driven loop above.  In the
+// bit-reflected representation used throughout, the carry-less product of two
+// 64-bit operands is implicitly multiplied by 'x', so each constant is
+// 'x^(D-1) mod P' (or 'x^(D+63) mod P' for the high-order half), reflected,
+// for a folding distance of 'D' bits.
+//
+// 'combine' multiplies the checksum of the first dataset by 'x^(8 * n) mod P'
+// (for a second dataset of 'n' bytes), computed by repeated squaring of 'x^8',
+// and adds the checksum of the second dataset; the pre- and
+// post-conditioning of the two checksums cancel.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <emmintrin.h>
+# include <wmmintrin.h>
+# define BDLDE_CRC32_PCLMUL_ENABLED
+#endif
+
 namespace BloombergLP {
 
 BSLMF_ASSERT(4 == sizeof(unsigned int));
@@ -150,21 +183,33 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
+namespace u {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
-{
-    BSLS_ASSERT(data || !length);
+/// The bit-reflected CRC-32 polynomial.
+const unsigned int k_POLYNOMIAL = 0xedb88320;
+
+/// The minimum number of bytes for which `updateFolding` is used.
+const bsl::size_t k_FOLDING_THRESHOLD = 64;
 
+/// Return the CRC-32 register resulting from updating the specified `crc`
+/// register with the specified `length` bytes at the specified `data`.
+typedef unsigned int (*UpdateFn)(unsigned int         crc,
+                                 const unsigned char *data,
+                                 bsl::size_t          length);
+
+/// Return the CRC-32 register resulting from updating the specified `crc`
+/// register with the specified `length` bytes at the specified `data`, one
+/// byte at a time.
+unsigned int updateTable(unsigned int         crc,
+                         const unsigned char *data,
+                         bsl::size_t          length)
+{
     // The following is a Duff's Device-based implementation of a common
     // algorithm (see end of RFC 1952).
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
+    const unsigned char *d   = data;
+    unsigned int         tmp = crc;
 
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
@@ -185,7 +230,165 @@ void Crc32::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+#ifdef BDLDE_CRC32_PCLMUL_ENABLED
+/// Return the sum of the carry-less products of the low and high halves of
+/// the specified `x` with the low and high halves, respectively, of the
+/// specified `k`.
+__attribute__((target("pclmul")))
+inline
+__m128i fold(__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                         _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/// Return the CRC-32 register resulting from updating the specified `crc`
+/// register with the specified `length` bytes at the specified `data`,
+/// folding 64 bytes at a time using carry-less multiplication.  The
+/// behavior is undefined unless `k_FOLDING_THRESHOLD <= length` and the
+/// `PCLMULQDQ` instruction is supported by the current CPU.
+__attribute__((target("pclmul")))
+unsigned int updateFolding(unsigned int         crc,
+                           const unsigned char *data,
+                           bsl::size_t          length)
+{
+    BSLS_ASSERT(k_FOLDING_THRESHOLD <= length);
+
+    // 'x^(512 + 63) mod P' and 'x^(512 - 1) mod P', reflected.
+
+    const __m128i k512 = _mm_set_epi64x(
+                              static_cast<long long>(0xcad38e8f00000000ULL),
+                              static_cast<long long>(0x653d982200000000ULL));
+
+    // 'x^(128 + 63) mod P' and 'x^(128 - 1) mod P', reflected.
+
+    const __m128i k128 = _mm_set_epi64x(
+                              static_cast<long long>(0x9ba54c6f00000000ULL),
+                              static_cast<long long>(0x65673b4600000000ULL));
+
+    const __m128i *in = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(in + 0),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(in + 1);
+    __m128i x2 = _mm_loadu_si128(in + 2);
+    __m128i x3 = _mm_loadu_si128(in + 3);
+
+    in     += 4;
+    length -= 64;
+
+    while (64 <= length) {
+        x0 = _mm_xor_si128(fold(x0, k512), _mm_loadu_si128(in + 0));
+        x1 = _mm_xor_si128(fold(x1, k512), _mm_loadu_si128(in + 1));
+        x2 = _mm_xor_si128(fold(x2, k512), _mm_loadu_si128(in + 2));
+        x3 = _mm_xor_si128(fold(x3, k512), _mm_loadu_si128(in + 3));
+
+        in     += 4;
+        length -= 64;
+    }
+
+    x0 = _mm_xor_si128(fold(x0, k128), x1);
+    x0 = _mm_xor_si128(fold(x0, k128), x2);
+    x0 = _mm_xor_si128(fold(x0, k128), x3);
+
+    while (16 <= length) {
+        x0 = _mm_xor_si128(fold(x0, k128), _mm_loadu_si128(in));
+
+        ++in;
+        length -= 16;
+    }
+
+    unsigned char remainder[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), x0);
+
+    crc = updateTable(0, remainder, sizeof remainder);
+
+    return updateTable(crc,
+                       reinterpret_cast<const unsigned char *>(in),
+                       length);
+}
+#endif
+
+/// Return the function best suited to updating a CRC-32 register with at
+/// least `k_FOLDING_THRESHOLD` bytes on the current CPU.
+UpdateFn selectUpdateFn()
+{
+#ifdef BDLDE_CRC32_PCLMUL_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid(1, eax, ebx, ecx, edx);
+
+    if (ecx & bit_PCLMUL) {
+        return updateFolding;                                         // RETURN
+    }
+#endif
+    return updateTable;
+}
+
+/// Return the function, selected once per process, best suited to updating
+/// a CRC-32 register with at least `k_FOLDING_THRESHOLD` bytes.
+UpdateFn bulkUpdateFn()
+{
+    static UpdateFn s_updateFn = 0;
+    BSLMT_ONCE_DO {
+        s_updateFn = selectUpdateFn();
+    }
+    return s_updateFn;
+}
+
+/// Return the product, modulo the CRC-32 polynomial, of the specified `a`
+/// and `b` polynomials, each in bit-reflected form.
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+{
+    unsigned int product = 0;
+
+    for (unsigned int m = 0x80000000; m; m >>= 1) {
+        if (a & m) {
+            product ^= b;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int first,
+                            unsigned int second,
+                            bsl::size_t  secondLength)
+{
+    unsigned int power = 0x00800000;  // 'x^8', reflected
+    unsigned int shift = 0x80000000;  // 'x^0', reflected
+
+    for (; secondLength; secondLength >>= 1) {
+        if (secondLength & 1) {
+            shift = u::multiplyModP(power, shift);
+        }
+        power = u::multiplyModP(power, power);
+    }
+
+    return u::multiplyModP(shift, first) ^ second;
+}
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    d_crc = length < u::k_FOLDING_THRESHOLD
+          ? u::updateTable(d_crc, d, length)
+          : u::bulkUpdateFn()(d_crc, d, length);
 }
 
 // ACCESSORS
@@ -218,6 +421,8 @@ bsl::ostream& Crc32::print(bsl::ostream& stream) const
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_CRC32_PCLMUL_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
@@ -63,6 +63,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static unsigned int combine(unsigned int, unsigned int, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -89,9 +90,10 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] BULK 'update'
 // [-1] PERFORMANCE TEST
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
@@ -513,7 +515,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -525,7 +527,8 @@ int main(int argc, char *argv[])
         //
         // Plan:
         //   Run the usage example functions 'senderExample' and
-        //   'receiverExample'.
+        //   'receiverExample', then incorporate usage example 2 from the
+        //   header into the test driver.
         //
         // Testing:
         //   Usage example.
@@ -543,6 +546,219 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+///Example 2: Checksumming a Large Buffer in Pieces
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the CRC-32 checksum of a large buffer, and that we
+// would like to divide the work among several threads.  Each thread can
+// compute the checksum of a contiguous piece of the buffer, and the checksums
+// of the pieces can then be combined.
+//
+// First, we create a buffer (here, a small one for illustration) and divide
+// it into two pieces:
+//..
+    const char        data[] = "The quick brown fox jumps over the lazy dog";
+    const bsl::size_t length = sizeof(data) - 1;
+    const bsl::size_t split  = 16;
+//..
+// Then, we compute the checksum of each piece independently (as separate
+// threads would):
+//..
+    const bdlde::Crc32 first(data, split);
+    const bdlde::Crc32 second(data + split, length - split);
+//..
+// Now, we combine the two checksums, supplying the length of the second piece:
+//..
+    const unsigned int combined = bdlde::Crc32::combine(first.checksum(),
+                                                        second.checksum(),
+                                                        length - split);
+//..
+// Finally, we verify that the result is the checksum of the whole buffer:
+//..
+    ASSERT(bdlde::Crc32(data, length).checksum() == combined);
+    ASSERT(0x414fa339                            == combined);
+//..
+
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //   We need to verify that 'combine' yields the checksum of the
+        //   concatenation of two datasets.
+        //
+        // Concerns:
+        //   Firstly, 'combine(crc(A), crc(B), len(B))' must be the checksum of
+        //   the concatenation of 'A' and 'B' for all lengths of 'A' and 'B',
+        //   including 0.
+        //
+        //   Secondly, 'combine' must be correct for lengths of the second
+        //   dataset that are too large to checksum directly (i.e., such that
+        //   all bits of the length are used).
+        //
+        // Plan:
+        //   For the first part of the test, fill a buffer with pseudo-random
+        //   data and, for every split point of every prefix of up to 200
+        //   bytes, verify that combining the checksums of the two pieces
+        //   (computed with the oracle 'crc') yields the checksum of the whole
+        //   prefix.
+        //
+        //   For the second part of the test, verify for every pair of a set of
+        //   lengths 'n' and 'm', including the largest values of 'size_t',
+        //   that combining is associative, i.e., that
+        //   'combine(combine(a, b, n), c, m)' equals
+        //   'combine(a, combine(b, c, m), n + m)'.
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'combine'"
+                          << "\n=================" << endl;
+
+        enum { k_MAX_LENGTH = 200 };
+
+        char         buffer[k_MAX_LENGTH];
+        unsigned int seed = 12345;
+        for (int i = 0; i < k_MAX_LENGTH; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tCombining every split of every prefix."
+                          << endl;
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            const unsigned int EXP = crc(buffer, length);
+
+            for (int split = 0; split <= length; ++split) {
+                const unsigned int FIRST  = crc(buffer, split);
+                const unsigned int SECOND = crc(buffer + split,
+                                                length - split);
+
+                LOOP2_ASSERT(length, split,
+                             EXP == Obj::combine(FIRST,
+                                                 SECOND,
+                                                 length - split));
+            }
+        }
+
+        if (verbose) cout << "\tCombining large lengths." << endl;
+
+        const bsl::size_t LENGTHS[] = {
+            0,
+            1,
+            64,
+            1000,
+            65536,
+            0x7fffffff,
+            0x80000000,
+            ~static_cast<bsl::size_t>(0) / 2,
+            ~static_cast<bsl::size_t>(0)
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const unsigned int A = crc(buffer,       7);
+        const unsigned int B = crc(buffer + 7,  50);
+        const unsigned int C = crc(buffer + 57, 99);
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const bsl::size_t N = LENGTHS[i];
+
+            for (int j = 0; j < NUM_LENGTHS; ++j) {
+                const bsl::size_t M = LENGTHS[j];
+
+                if (N + M < N) {
+                    continue;  // overflow
+                }
+
+                if (veryVerbose) { T_ P_(N) P(M) }
+
+                LOOP2_ASSERT(N, M,
+                             Obj::combine(Obj::combine(A, B, N), C, M) ==
+                             Obj::combine(A, Obj::combine(B, C, M), N + M));
+            }
+        }
+
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING BULK 'update'
+        //   We need to verify 'update' for data long enough to be processed
+        //   by the folding implementation used on platforms supporting
+        //   carry-less multiplication.
+        //
+        // Concerns:
+        //   Firstly, 'update' must produce the correct checksum for data of
+        //   every length in and around the range where the implementation
+        //   switches from byte-at-a-time processing to folding (64 bytes),
+        //   for every length modulo 64 and 16, and for data at every
+        //   alignment.
+        //
+        //   Secondly, 'update' must correctly continue from a non-initial
+        //   checksum when folding.
+        //
+        // Plan:
+        //   For the first part of the test, fill a buffer with pseudo-random
+        //   data and, for every offset from 0 to 15 and every length from 0
+        //   to 300 (and a number of larger lengths), verify that the checksum
+        //   computed by 'update' matches the oracle 'crc'.
+        //
+        //   For the second part of the test, for every length up to 300 and
+        //   a number of split points, verify that two calls to 'update'
+        //   yield the checksum of the whole.
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Bulk 'update'"
+                          << "\n=====================" << endl;
+
+        enum { k_BUFFER_SIZE = 16 + 4099 };
+
+        bsl::vector<char> buffer(k_BUFFER_SIZE);
+        unsigned int      seed = 54321;
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tChecksumming every offset and length."
+                          << endl;
+
+        for (int offset = 0; offset < 16; ++offset) {
+            const char *DATA = buffer.data() + offset;
+
+            for (int length = 0; length <= 4099; ++length) {
+                if (300 < length && length % 64 != 0
+                                 && length % 64 != 1
+                                 && length % 64 != 63) {
+                    continue;
+                }
+
+                const unsigned int EXP = crc(DATA, length);
+
+                Obj mX(DATA, length);  const Obj& X = mX;
+
+                LOOP2_ASSERT(offset, length, EXP == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\tChecksumming in two pieces." << endl;
+
+        for (int length = 0; length <= 300; ++length) {
+            const char         *DATA = buffer.data();
+            const unsigned int  EXP  = crc(DATA, length);
+
+            for (int split = 0; split <= length; split += 1 + split / 8) {
+                Obj mX;  const Obj& X = mX;
+
+                mX.update(DATA, split);
+                mX.update(DATA + split, length - split);
+
+                LOOP2_ASSERT(length, split, EXP == X.checksum());
+            }
+        }
+
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2676,6 +2892,28 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+        {
+            bsl::cout << "BDE crc32 bulk run" << bsl::endl;
+
+            enum { k_BULK_SIZE = 64 * 1024 * 1024, k_BULK_ITERATIONS = 16 };
+
+            bsl::vector<char> buffer(k_BULK_SIZE, 'x');
+
+            Obj mX;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_BULK_ITERATIONS; ++i) {
+                mX.update(buffer.data(), buffer.size());
+            }
+            timer.stop();
+
+            bsl::cout << "BDE CRC32: "
+                      << static_cast<double>(k_BULK_SIZE) *
+                                 k_BULK_ITERATIONS / timer.elapsedTime() / 1e6
+                      << " MB/sec." << bsl::endl;
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -63,6 +63,7 @@ using namespace bsl;  // automatically added by script
 //
 // ----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static Uint64 combine(Uint64, Uint64, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -89,9 +90,10 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] BULK 'update'
 // [-1] PERFORMANCE TEST
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
@@ -486,7 +488,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -498,7 +500,8 @@ int main(int argc, char *argv[])
         //
         // Plan:
         //: 1 Run the usage example functions 'senderExample' and
-        //:   'receiverExample'.  (C-1)
+        //:   'receiverExample', then incorporate usage example 2 from the
+        //:   header into the test driver.  (C-1)
         //
         // Testing:
         //   USAGE EXAMPLE
@@ -516,6 +519,211 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+///Example 2: Checksumming a Large Buffer in Pieces
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the CRC-64 checksum of a large buffer, and that we
+// would like to divide the work among several threads.  Each thread can
+// compute the checksum of a contiguous piece of the buffer, and the checksums
+// of the pieces can then be combined.
+//
+// First, we create a buffer (here, a small one for illustration) and divide
+// it into two pieces:
+//..
+    const char        data[] = "The quick brown fox jumps over the lazy dog";
+    const bsl::size_t length = sizeof(data) - 1;
+    const bsl::size_t split  = 16;
+//..
+// Then, we compute the checksum of each piece independently (as separate
+// threads would):
+//..
+    const bdlde::Crc64 first(data, split);
+    const bdlde::Crc64 second(data + split, length - split);
+//..
+// Now, we combine the two checksums, supplying the length of the second piece:
+//..
+    const bsls::Types::Uint64 combined = bdlde::Crc64::combine(
+                                                           first.checksum(),
+                                                           second.checksum(),
+                                                           length - split);
+//..
+// Finally, we verify that the result is the checksum of the whole buffer:
+//..
+    ASSERT(bdlde::Crc64(data, length).checksum() == combined);
+    ASSERT(0x5b5eb8c2e54aa1c4ULL                 == combined);
+//..
+
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine(crc(A), crc(B), len(B))' is the checksum of the
+        //:   concatenation of 'A' and 'B' for all lengths of 'A' and 'B',
+        //:   including 0.
+        //:
+        //: 2 'combine' is correct for lengths of the second dataset that are
+        //:   too large to checksum directly (i.e., such that all bits of the
+        //:   length are used).
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random data and, for every split point
+        //:   of every prefix of up to 200 bytes, verify that combining the
+        //:   checksums of the two pieces (computed with the oracle 'crc')
+        //:   yields the checksum of the whole prefix.  (C-1)
+        //:
+        //: 2 For every pair of a set of lengths 'n' and 'm', including the
+        //:   largest values of 'size_t', verify that combining is
+        //:   associative, i.e., that 'combine(combine(a, b, n), c, m)' equals
+        //:   'combine(a, combine(b, c, m), n + m)'.  (C-2)
+        //
+        // Testing:
+        //   static Uint64 combine(Uint64, Uint64, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING 'combine'"
+                             "\n" "=================" "\n";
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        enum { k_MAX_LENGTH = 200 };
+
+        char         buffer[k_MAX_LENGTH];
+        unsigned int seed = 12345;
+        for (int i = 0; i < k_MAX_LENGTH; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tCombining every split of every prefix.\n";
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            const Uint64 EXP = crc(buffer, length);
+
+            for (int split = 0; split <= length; ++split) {
+                const Uint64 FIRST  = crc(buffer, split);
+                const Uint64 SECOND = crc(buffer + split, length - split);
+
+                ASSERTV(length, split,
+                        EXP == Obj::combine(FIRST, SECOND, length - split));
+            }
+        }
+
+        if (verbose) cout << "\tCombining large lengths.\n";
+
+        const bsl::size_t LENGTHS[] = {
+            0,
+            1,
+            64,
+            1000,
+            65536,
+            0x7fffffff,
+            0x80000000,
+            ~static_cast<bsl::size_t>(0) / 2,
+            ~static_cast<bsl::size_t>(0)
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const Uint64 A = crc(buffer,       7);
+        const Uint64 B = crc(buffer + 7,  50);
+        const Uint64 C = crc(buffer + 57, 99);
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const bsl::size_t N = LENGTHS[i];
+
+            for (int j = 0; j < NUM_LENGTHS; ++j) {
+                const bsl::size_t M = LENGTHS[j];
+
+                if (N + M < N) {
+                    continue;  // overflow
+                }
+
+                if (veryVerbose) { T_ P_(N) P(M) }
+
+                ASSERTV(N, M,
+                        Obj::combine(Obj::combine(A, B, N), C, M) ==
+                        Obj::combine(A, Obj::combine(B, C, M), N + M));
+            }
+        }
+
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING BULK 'update'
+        //
+        // Concerns:
+        //: 1 'update' produces the correct checksum for data of every length
+        //:   in and around the range where the implementation switches from
+        //:   byte-at-a-time processing to folding (64 bytes), for every
+        //:   length modulo 64 and 16, and for data at every alignment.
+        //:
+        //: 2 'update' correctly continues from a non-initial checksum when
+        //:   folding.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random data and, for every offset from
+        //:   0 to 15 and every length from 0 to 300 (and a number of larger
+        //:   lengths), verify that the checksum computed by 'update' matches
+        //:   the oracle 'crc'.  (C-1)
+        //:
+        //: 2 For every length up to 300 and a number of split points, verify
+        //:   that two calls to 'update' yield the checksum of the whole.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING BULK 'update'"
+                             "\n" "=====================" "\n";
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        enum { k_BUFFER_SIZE = 16 + 4099 };
+
+        bsl::vector<char> buffer(k_BUFFER_SIZE);
+        unsigned int      seed = 54321;
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tChecksumming every offset and length.\n";
+
+        for (int offset = 0; offset < 16; ++offset) {
+            const char *DATA = buffer.data() + offset;
+
+            for (int length = 0; length <= 4099; ++length) {
+                if (300 < length && length % 64 != 0
+                                 && length % 64 != 1
+                                 && length % 64 != 63) {
+                    continue;
+                }
+
+                const Uint64 EXP = crc(DATA, length);
+
+                Obj mX(DATA, length);  const Obj& X = mX;
+
+                ASSERTV(offset, length, EXP == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\tChecksumming in two pieces.\n";
+
+        for (int length = 0; length <= 300; ++length) {
+            const char   *DATA = buffer.data();
+            const Uint64  EXP  = crc(DATA, length);
+
+            for (int split = 0; split <= length; split += 1 + split / 8) {
+                Obj mX;  const Obj& X = mX;
+
+                mX.update(DATA, split);
+                mX.update(DATA + split, length - split);
+
+                ASSERTV(length, split, EXP == X.checksum());
+            }
+        }
+
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2660,6 +2868,28 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+        {
+            bsl::cout << "BDE crc64 bulk run" << bsl::endl;
+
+            enum { k_BULK_SIZE = 64 * 1024 * 1024, k_BULK_ITERATIONS = 16 };
+
+            bsl::vector<char> buffer(k_BULK_SIZE, 'x');
+
+            Obj mX;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_BULK_ITERATIONS; ++i) {
+                mX.update(buffer.data(), buffer.size());
+            }
+            timer.stop();
+
+            bsl::cout << "BDE CRC64: "
+                      << static_cast<double>(k_BULK_SIZE) *
+                                 k_BULK_ITERATIONS / timer.elapsedTime() / 1e6
+                      << " MB/sec." << bsl::endl;
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
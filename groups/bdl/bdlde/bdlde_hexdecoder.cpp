@@ -5,6 +5,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexdecoder_cpp,"$Id$ $CSID$")
 
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace {
 namespace u {
 
@@ -144,6 +150,53 @@ static const char hexValueTable[128] =
     0    // 127  7f - DEL
 };
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+                        // ===================
+                        // FILE-SCOPE FUNCTIONS
+                        // ===================
+
+/// Return the values of the hex digits in the specified `chars`, and load
+/// into the specified `isValid` a mask having all bits set in each byte
+/// whose character is a hex digit, and no bits set in every other byte.
+inline
+__m128i hexValues(__m128i *isValid, __m128i chars)
+{
+    const __m128i none = _mm_set1_epi8(-1);
+
+    const __m128i digit   = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i isDigit = _mm_and_si128(
+                                  _mm_cmpgt_epi8(digit, none),
+                                  _mm_cmplt_epi8(digit, _mm_set1_epi8(10)));
+
+    // Setting bit 5 maps 'A'-'F' onto 'a'-'f' (and no other character onto
+    // them).
+
+    const __m128i letter   = _mm_sub_epi8(
+                                   _mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+    const __m128i isLetter = _mm_and_si128(
+                                   _mm_cmpgt_epi8(letter, none),
+                                   _mm_cmplt_epi8(letter, _mm_set1_epi8(6)));
+
+    *isValid = _mm_or_si128(isDigit, isLetter);
+
+    return _mm_or_si128(_mm_and_si128(isDigit, digit),
+                        _mm_and_si128(isLetter,
+                                      _mm_add_epi8(letter,
+                                                   _mm_set1_epi8(10))));
+}
+
+/// Return the bytes encoded by the pairs of 4-bit values in the specified
+/// `values`, in the low-order half of each 16-bit lane.
+inline
+__m128i combinePairs(__m128i values)
+{
+    return _mm_and_si128(_mm_or_si128(_mm_slli_epi16(values, 4),
+                                      _mm_srli_epi16(values, 8)),
+                         _mm_set1_epi16(0x00ff));
+}
+#endif
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -154,6 +207,59 @@ namespace bdlde {
                            // HexDecoder
                            // ----------
 
+// PRIVATE CLASS METHODS
+int HexDecoder::decodePairs(char *out, const char *begin, int numPairs)
+{
+    BSLS_ASSERT(0 <= numPairs);
+
+    const char *const originalBegin = begin;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Decode 32 hex digits into 16 bytes per iteration.
+
+    for (; 16 <= numPairs; numPairs -= 16) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(begin);
+
+        __m128i isValidLow;
+        __m128i isValidHigh;
+
+        const __m128i low  = u::hexValues(&isValidLow,
+                                          _mm_loadu_si128(in));
+        const __m128i high = u::hexValues(&isValidHigh,
+                                          _mm_loadu_si128(in + 1));
+
+        if (0xffff != _mm_movemask_epi8(_mm_and_si128(isValidLow,
+                                                      isValidHigh))) {
+            // Not a hex digit; finish with the pairs preceding it.
+
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_packus_epi16(u::combinePairs(low),
+                                          u::combinePairs(high)));
+
+        begin += 32;
+        out   += 16;
+    }
+#endif
+
+    for (; 0 < numPairs; --numPairs) {
+        if (!isXdigit(begin[0]) || !isXdigit(begin[1])) {
+            break;
+        }
+
+        *out = static_cast<char>(
+                            (u::hexValueTable[static_cast<int>(begin[0])] << 4)
+                          | (u::hexValueTable[static_cast<int>(begin[1])]));
+
+        begin += 2;
+        ++out;
+    }
+
+    return static_cast<int>((begin - originalBegin) / 2);
+}
+
 // CREATORS
 HexDecoder::HexDecoder()
 : d_state(e_INPUT_STATE)
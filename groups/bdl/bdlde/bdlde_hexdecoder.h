@@ -265,6 +265,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iterator.h>
 
 namespace BloombergLP {
@@ -299,6 +300,15 @@ class HexDecoder {
     /// `false` otherwise.
     static bool isXdigit(char character);
 
+    /// Decode into the specified `out` buffer the leading pairs of hex
+    /// digits, up to the specified `numPairs` of them, of the input
+    /// starting at the specified `begin` position, stopping at the first
+    /// pair containing a character that is not a hex digit.  Return the
+    /// number of pairs decoded, each of which produces 1 byte of output.
+    /// Note that input is decoded a block at a time, using SIMD
+    /// instructions where available.
+    static int decodePairs(char *out, const char *begin, int numPairs);
+
     // NOT IMPLEMENTED
     HexDecoder(const HexDecoder&);
     HexDecoder& operator=(const HexDecoder&);
@@ -328,7 +338,10 @@ class HexDecoder {
     /// success and a negative value otherwise.  Note that calling this
     /// method after `endConvert` has been invoked without an intervening
     /// `reset` call will place this instance in an error state, and return
-    /// an error status.
+    /// an error status.  Also note that when `OUTPUT_ITERATOR` is `char *`
+    /// and `INPUT_ITERATOR` is `const char *`, runs of hex digits are
+    /// decoded a block at a time, which is considerably faster for large
+    /// inputs.
     template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
     int convert(OUTPUT_ITERATOR out,
                 INPUT_ITERATOR  begin,
@@ -503,6 +516,87 @@ int HexDecoder::convert(OUTPUT_ITERATOR  out,
     return 0;
 }
 
+template <>
+inline
+int HexDecoder::convert<char *, const char *>(char       *out,
+                                              int        *numOut,
+                                              int        *numIn,
+                                              const char *begin,
+                                              const char *end,
+                                              int         maxNumOut)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+
+    if (e_ERROR_STATE == d_state || e_DONE_STATE == d_state) {
+        int rv  = e_DONE_STATE == d_state ? -2 : -1;
+        d_state = e_ERROR_STATE;
+        *numOut = 0;
+        *numIn  = 0;
+        return rv;                                                    // RETURN
+    }
+
+    if (0 == maxNumOut) {
+        *numOut = 0;
+        *numIn = 0;
+        return 0;                                                     // RETURN
+    }
+
+    const char *const originalBegin = begin;
+    int               numEmitted = 0;
+
+    while (begin != end && numEmitted != maxNumOut) {
+        if (0 == d_firstDigit && 2 <= end - begin) {
+            // Decode a run of whole pairs a block at a time.
+
+            int numPairs = static_cast<int>((end - begin) / 2);
+            if (0 <= maxNumOut && maxNumOut - numEmitted < numPairs) {
+                numPairs = maxNumOut - numEmitted;
+            }
+
+            numPairs = decodePairs(out, begin, numPairs);
+
+            begin      += 2 * numPairs;
+            out        += numPairs;
+            numEmitted += numPairs;
+
+            if (begin == end || numEmitted == maxNumOut) {
+                break;
+            }
+        }
+
+        const char digit = *begin;
+        ++begin;
+
+        if (!isSpace(digit)) {
+            if (!isXdigit(digit)) {
+                *numOut = numEmitted;
+                d_outputLength += numEmitted;
+                *numIn = static_cast<int>(begin - originalBegin);
+                d_state = e_ERROR_STATE;
+                return -1;                                            // RETURN
+            }
+
+            if (0 == d_firstDigit) {
+                d_firstDigit = digit;
+            }
+            else {
+                *out = static_cast<char>(
+                       (d_decodeTable_p[static_cast<int>(d_firstDigit)] << 4) |
+                       (d_decodeTable_p[static_cast<int>(digit       )]));
+                ++out;
+                ++numEmitted;
+                d_firstDigit = 0;
+            }
+        }
+    }
+
+    *numOut = numEmitted;
+    d_outputLength += numEmitted;
+    *numIn = static_cast<int>(begin - originalBegin);
+    return 0;
+}
+
 inline
 void HexDecoder::reset()
 {
@@ -46,7 +46,8 @@ using namespace bsl;
 // [ 4] bool isMaximal() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: `char *`/`const char *` conversion matches generic path
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -481,7 +482,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -523,6 +524,143 @@ int main(int argc, char *argv[])
     ASSERT(0 == strcmp(BLOOMBERG_NEWS, backInStream.str().c_str()));
 // ```
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK CONVERSION
+        //
+        // Concerns:
+        // 1. `convert` called with `char *` output and `const char *` input
+        //    (which decodes a block at a time) produces exactly the same
+        //    output, return values, `numOut`, `numIn`, and subsequent object
+        //    state as `convert` called with any other iterator types, for
+        //    every input length (in particular, lengths on either side of
+        //    each SIMD block boundary).
+        //
+        // 2. Whitespace and invalid characters anywhere in a block, in
+        //    either letter case, are handled exactly as on the generic path.
+        //
+        // 3. The block conversion respects `maxNumOut`, and resumes
+        //    correctly after a chunk ending between the two digits of a
+        //    byte.
+        //
+        // Plan:
+        // 1. Using pseudo-random input drawn mostly from hex digits of both
+        //    cases, with occasional whitespace and (in half of the trials)
+        //    occasional invalid characters, for a variety of lengths, chunk
+        //    sizes, and `maxNumOut` limits, drive two decoders through
+        //    identical call sequences, one with `const char *` input and one
+        //    with `char *` input (which takes the generic path), and verify
+        //    that all results and accessors agree after every call.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: `char *`/`const char *` conversion matches generic path
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BLOCK CONVERSION" << endl
+                          << "========================" << endl;
+
+        static const char DIGITS[]   = "0123456789abcdefABCDEF";
+        static const char OTHERS[]   = " \t\n\r\v\f \n" "gG:/@`x\x80";
+
+        static const int  CHUNKS[]   = { 1, 2, 15, 16, 31, 32, 33, 1000 };
+        static const int  LIMITS[]   = { -1, 0, 1, 16, 17 };
+        const int         NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+        const int         NUM_LIMITS = sizeof LIMITS / sizeof *LIMITS;
+
+        bsl::vector<char> input;
+        unsigned int      seed = 1;
+
+        for (int len = 0; len <= 200; len += len < 70 ? 1 : 13) {
+        for (int invalid = 0; invalid < 2; ++invalid) {
+            input.resize(len + 1);
+            for (int i = 0; i < len; ++i) {
+                seed = seed * 1103515245u + 12345u;
+
+                const unsigned int r = seed >> 16;
+
+                input[i] = r % 64
+                         ? DIGITS[r % (sizeof DIGITS - 1)]
+                         : OTHERS[(r >> 6) % (invalid ? 16 : 8)];
+            }
+
+            for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+            for (int li = 0; li < NUM_LIMITS; ++li) {
+                const int CHUNK = CHUNKS[ci];
+                const int LIMIT = LIMITS[li];
+
+                Obj        mX;  const Obj& X = mX;  // block path
+                Obj        mY;  const Obj& Y = mY;  // generic path
+
+                bsl::vector<char> outX(len / 2 + 1, '#');
+                bsl::vector<char> outY(len / 2 + 1, '#');
+
+                const char *inX  = input.data();
+                char       *inY  = input.data();
+                const char *end  = inX + len;
+                char       *oX   = outX.data();
+                char       *oY   = outY.data();
+
+                for (int iter = 0; iter < 4 * len + 4; ++iter) {
+                    const int avail = static_cast<int>(end - inX);
+                    const int n     = avail < CHUNK ? avail : CHUNK;
+                    const int max   = 0 == LIMIT && 0 == iter % 2 ? 1 : LIMIT;
+
+                    int numOutX = -1, numInX = -1;
+                    int numOutY = -1, numInY = -1;
+
+                    const int rcX = mX.convert(oX,
+                                               &numOutX,
+                                               &numInX,
+                                               inX,
+                                               inX + n,
+                                               max);
+                    const int rcY = mY.convert(oY,
+                                               &numOutY,
+                                               &numInY,
+                                               inY,
+                                               inY + n,
+                                               max);
+
+                    ASSERTV(len, CHUNK, LIMIT, iter, rcX, rcY, rcX == rcY);
+                    ASSERTV(len, CHUNK, LIMIT, iter, numOutX, numOutY,
+                            numOutX == numOutY);
+                    ASSERTV(len, CHUNK, LIMIT, iter, numInX, numInY,
+                            numInX == numInY);
+                    ASSERTV(len, CHUNK, LIMIT, iter,
+                            X.outputLength() == Y.outputLength());
+                    ASSERTV(len, CHUNK, LIMIT, iter,
+                            X.isAcceptable() == Y.isAcceptable());
+                    ASSERTV(len, CHUNK, LIMIT, iter,
+                            X.isError() == Y.isError());
+
+                    if (numInX != numInY || numOutX != numOutY || rcX) {
+                        break;
+                    }
+
+                    oX  += numOutX;
+                    oY  += numOutY;
+                    inX += numInX;
+                    inY += numInY;
+
+                    if (inX == end) {
+                        break;
+                    }
+                }
+
+                const int rcX = mX.endConvert();
+                const int rcY = mY.endConvert();
+
+                ASSERTV(len, CHUNK, LIMIT, rcX, rcY, rcX == rcY);
+                ASSERTV(len, CHUNK, LIMIT, X.isDone() == Y.isDone());
+                ASSERTV(len, CHUNK, LIMIT, outX == outY);
+                ASSERTV(len, CHUNK, LIMIT, '#' == outX.back());
+            }
+            }
+        }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING `reset`
@@ -4,6 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexencoder_cpp,"$Id$ $CSID$")
 
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace {
 namespace u {
                 // ======================
@@ -60,6 +66,60 @@ namespace bdlde {
                            // HexEncoder
                            // ----------
 
+// PRIVATE CLASS METHODS
+void HexEncoder::encodeBytes(char        *out,
+                             const char  *begin,
+                             bsl::size_t  numIn,
+                             const char  *encodeTable)
+{
+    BSLS_ASSERT(encodeTable);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Translate each 4-bit value 'v' to the character '0' + v, adding the
+    // distance from the character after '9' to the first letter of the
+    // alphabet if 9 < v, for 16 bytes of input per iteration.
+
+    const __m128i nibble    = _mm_set1_epi8(0x0f);
+    const __m128i nine      = _mm_set1_epi8(9);
+    const __m128i zero      = _mm_set1_epi8('0');
+    const __m128i letterGap = _mm_set1_epi8(
+                                static_cast<char>(encodeTable[10] - '9' - 1));
+
+    for (; 16 <= numIn; numIn -= 16) {
+        const __m128i x = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+
+        __m128i high = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+        __m128i low  = _mm_and_si128(x, nibble);
+
+        high = _mm_add_epi8(_mm_add_epi8(high, zero),
+                            _mm_and_si128(_mm_cmpgt_epi8(high, nine),
+                                          letterGap));
+        low  = _mm_add_epi8(_mm_add_epi8(low, zero),
+                            _mm_and_si128(_mm_cmpgt_epi8(low, nine),
+                                          letterGap));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                         _mm_unpackhi_epi8(high, low));
+
+        begin += 16;
+        out   += 32;
+    }
+#endif
+
+    for (; 0 < numIn; --numIn) {
+        const unsigned char byte = static_cast<unsigned char>(*begin);
+
+        out[0] = encodeTable[byte >> 4];
+        out[1] = encodeTable[byte & 0x0f];
+
+        ++begin;
+        out += 2;
+    }
+}
+
 // CREATORS
 HexEncoder::HexEncoder(bool upperCaseLetters)
 : d_state(e_INPUT_STATE)
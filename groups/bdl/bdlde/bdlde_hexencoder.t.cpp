@@ -47,7 +47,8 @@ using namespace bsl;
 // [ 4] bool isAcceptable() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: `char *`/`const char *` conversion matches generic path
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -360,7 +361,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -408,6 +409,131 @@ int main(int argc, char *argv[])
 // This example does *not* decode the resulting hexidecimal text, for a
 // more complete example, see `bdlde_hexdecoder`.
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK CONVERSION
+        //
+        // Concerns:
+        // 1. `convert` called with `char *` output and `const char *` input
+        //    (which encodes a block at a time) produces exactly the same
+        //    output, return values, `numOut`, `numIn`, and subsequent object
+        //    state as `convert` called with any other iterator types, for
+        //    every input length (in particular, lengths on either side of
+        //    each SIMD block boundary).
+        //
+        // 2. The block conversion respects `maxNumOut`, including an odd
+        //    limit that leaves a character pending, and resumes correctly
+        //    from a pending character.
+        //
+        // Plan:
+        // 1. Using pseudo-random data, for a variety of lengths, chunk sizes,
+        //    and `maxNumOut` limits, drive two encoders through identical
+        //    call sequences, one with `const char *` input and one with
+        //    `char *` input (which takes the generic path), and verify that
+        //    all results and accessors agree after every call.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: `char *`/`const char *` conversion matches generic path
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BLOCK CONVERSION" << endl
+                          << "========================" << endl;
+
+        static const int CHUNKS[]   = { 1, 2, 15, 16, 17, 31, 32, 33, 1000 };
+        static const int LIMITS[]   = { -1, 0, 1, 5, 32, 33, 64 };
+        const int        NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+        const int        NUM_LIMITS = sizeof LIMITS / sizeof *LIMITS;
+
+        bsl::vector<char> input;
+        unsigned int      seed = 1;
+
+        for (int len = 0; len <= 200; len += len < 70 ? 1 : 13) {
+            input.resize(len + 1);
+            for (int i = 0; i < len; ++i) {
+                seed     = seed * 1103515245u + 12345u;
+                input[i] = static_cast<char>(seed >> 16);
+            }
+
+            for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+            for (int li = 0; li < NUM_LIMITS; ++li) {
+            for (int upper = 0; upper < 2; ++upper) {
+                const int CHUNK = CHUNKS[ci];
+                const int LIMIT = LIMITS[li];
+
+                Obj        mX(upper);  const Obj& X = mX;  // block path
+                Obj        mY(upper);  const Obj& Y = mY;  // generic path
+
+                bsl::vector<char> outX(2 * len + 1, '#');
+                bsl::vector<char> outY(2 * len + 1, '#');
+
+                const char *inX  = input.data();
+                char       *inY  = input.data();
+                const char *end  = inX + len;
+                char       *oX   = outX.data();
+                char       *oY   = outY.data();
+
+                for (int iter = 0; iter < 4 * len + 4; ++iter) {
+                    const int avail = static_cast<int>(end - inX);
+                    const int n     = avail < CHUNK ? avail : CHUNK;
+                    const int max   = 0 == LIMIT && 0 == iter % 2 ? 1 : LIMIT;
+
+                    int numOutX = -1, numInX = -1;
+                    int numOutY = -1, numInY = -1;
+
+                    const int rcX = mX.convert(oX,
+                                               &numOutX,
+                                               &numInX,
+                                               inX,
+                                               inX + n,
+                                               max);
+                    const int rcY = mY.convert(oY,
+                                               &numOutY,
+                                               &numInY,
+                                               inY,
+                                               inY + n,
+                                               max);
+
+                    ASSERTV(len, CHUNK, LIMIT, iter, rcX, rcY, rcX == rcY);
+                    ASSERTV(len, CHUNK, LIMIT, iter, numOutX, numOutY,
+                            numOutX == numOutY);
+                    ASSERTV(len, CHUNK, LIMIT, iter, numInX, numInY,
+                            numInX == numInY);
+                    ASSERTV(len, CHUNK, LIMIT, iter,
+                            X.outputLength() == Y.outputLength());
+                    ASSERTV(len, CHUNK, LIMIT, iter,
+                            X.numOutputPending() == Y.numOutputPending());
+
+                    if (numInX != numInY || numOutX != numOutY) {
+                        break;
+                    }
+
+                    oX  += numOutX;
+                    oY  += numOutY;
+                    inX += numInX;
+                    inY += numInY;
+
+                    if (inX == end && 0 == X.numOutputPending()) {
+                        break;
+                    }
+                }
+
+                int numOutX = -1;
+                int numOutY = -1;
+
+                const int rcX = mX.endConvert(oX, &numOutX);
+                const int rcY = mY.endConvert(oY, &numOutY);
+
+                ASSERTV(len, CHUNK, LIMIT, rcX, rcY, rcX == rcY);
+                ASSERTV(len, CHUNK, LIMIT, X.isDone() && Y.isDone());
+                ASSERTV(len, CHUNK, LIMIT, 2 * len == X.outputLength());
+                ASSERTV(len, CHUNK, LIMIT, outX == outY);
+                ASSERTV(len, CHUNK, LIMIT, '#' == outX.back());
+            }
+            }
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING `reset`
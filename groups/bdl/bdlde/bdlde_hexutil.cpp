@@ -0,0 +1,96 @@
+// bdlde_hexutil.cpp                                                  -*-C++-*-
+#include <bdlde_hexutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_hexutil_cpp,"$Id$ $CSID$")
+
+#include <bdlde_hexdecoder.h>
+#include <bdlde_hexencoder.h>
+
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // --------------
+                              // struct HexUtil
+                              // --------------
+
+// CLASS METHODS
+bsl::span<char> HexUtil::encode(bsl::span<char>       output,
+                                bsl::span<const char> input,
+                                bool                  upperCaseLetters)
+{
+    BSLS_ASSERT(encodedLength(input.size()) <= output.size());
+    BSLS_ASSERT(encodedLength(input.size()) <=
+                   static_cast<bsl::size_t>(bsl::numeric_limits<int>::max()));
+
+    HexEncoder encoder(upperCaseLetters);
+
+    char       *out = output.data();
+    const char *in  = input.data();
+    int         numOut;
+    int         numIn;
+
+    int rc = encoder.convert(out, &numOut, &numIn, in, in + input.size());
+    BSLS_ASSERT(0 == rc);
+
+    out   += numOut;
+    numOut = 0;
+
+    rc = encoder.endConvert(out, &numOut);
+    BSLS_ASSERT(0 == rc);
+    (void)rc;
+
+    out += numOut;
+
+    return output.first(out - output.data());
+}
+
+int HexUtil::decode(bsl::span<char>       *result,
+                    bsl::span<char>        output,
+                    bsl::span<const char>  input)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(maxDecodedLength(input.size()) <= output.size());
+    BSLS_ASSERT(input.size() <=
+                   static_cast<bsl::size_t>(bsl::numeric_limits<int>::max()));
+
+    HexDecoder decoder;
+
+    const char *in = input.data();
+    int         numOut;
+    int         numIn;
+
+    if (0 != decoder.convert(output.data(),
+                             &numOut,
+                             &numIn,
+                             in,
+                             in + input.size())
+     || 0 != decoder.endConvert()) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = output.first(numOut);
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,171 @@
+// bdlde_hexutil.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLDE_HEXUTIL
+#define INCLUDED_BDLDE_HEXUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functions to encode and decode hexadecimal in one call.
+//
+//@CLASSES:
+//  bdlde::HexUtil: namespace for one-shot hexadecimal encoding and decoding
+//
+//@SEE_ALSO: bdlde_hexencoder, bdlde_hexdecoder, bdlde_base64util
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlde::HexUtil`, that
+// serves as a namespace for functions that encode a complete sequence of
+// bytes into its hexadecimal representation, and decode a complete
+// hexadecimal representation back into bytes, in a single call.  The
+// encoding produced and the input accepted are exactly those of
+// `bdlde::HexEncoder` and `bdlde::HexDecoder`: encoding produces two
+// characters per byte, in uppercase or lowercase; decoding accepts either
+// case and ignores whitespace, but fails on any other character or on an odd
+// number of hex digits.
+//
+// Input and output are described by `bsl::span` objects: the caller supplies
+// an output buffer of at least `encodedLength` (respectively,
+// `maxDecodedLength`) bytes, and the functions return (respectively, load)
+// the leading part of that buffer that was written.  Because the functions
+// operate on contiguous buffers, they translate the input a block at a time
+// (using SIMD instructions where the target supports them), as do
+// `bdlde::HexEncoder::convert` and `bdlde::HexDecoder::convert` when passed
+// `char *` output and `const char *` input.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to display a buffer of binary data, and later recover it
+// from its display form.
+//
+// First, we describe the data:
+// ```
+// const char                  data[] = "\x00\x01\x02 binary \xfd\xfe\xff";
+// const bsl::span<const char> input(data, sizeof(data) - 1);
+// ```
+// Then, we encode the data into a suitably sized buffer:
+// ```
+// bsl::vector<char> encodedBuffer(
+//                          bdlde::HexUtil::encodedLength(input.size()));
+//
+// const bsl::span<char> encoded = bdlde::HexUtil::encode(encodedBuffer,
+//                                                       input);
+// assert(bsl::string(encoded.data(), encoded.size()) ==
+//                                       "0001022062696E61727920FDFEFF");
+// ```
+// Finally, we decode the data and observe that we recover the original:
+// ```
+// bsl::vector<char> decodedBuffer(
+//                       bdlde::HexUtil::maxDecodedLength(encoded.size()));
+//
+// bsl::span<char> decoded;
+// int rc = bdlde::HexUtil::decode(&decoded, decodedBuffer, encoded);
+// assert(0 == rc);
+// assert(input.size() == decoded.size());
+// assert(0 == bsl::memcmp(input.data(), decoded.data(), decoded.size()));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_span.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // ==============
+                              // struct HexUtil
+                              // ==============
+
+/// This `struct` provides a namespace for functions that encode and decode
+/// complete hexadecimal sequences in a single call.
+struct HexUtil {
+
+    // CLASS METHODS
+
+    /// Return the exact number of bytes that `encode` writes for an input
+    /// of the specified `inputLength` bytes.  The behavior is undefined if
+    /// the result would overflow.
+    static bsl::size_t encodedLength(bsl::size_t inputLength);
+
+    /// Return the maximum number of bytes that `decode` can write for an
+    /// input of the specified `inputLength` bytes.
+    static bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+
+    /// Encode the specified `input` into its hexadecimal representation,
+    /// writing the result to the leading part of the specified `output`,
+    /// and return that leading part.  Optionally specify `upperCaseLetters`
+    /// to indicate whether the values from 10 to 15 are encoded as
+    /// uppercase letters (`A`-`F`) or as lowercase letters (`a`-`f`); if
+    /// `upperCaseLetters` is not specified, uppercase letters are used.
+    /// The behavior is undefined unless
+    /// `encodedLength(input.size()) <= output.size()` and
+    /// `encodedLength(input.size())` does not exceed the maximum value of
+    /// `int`.
+    static bsl::span<char> encode(bsl::span<char>       output,
+                                  bsl::span<const char> input,
+                                  bool                  upperCaseLetters =
+                                                                         true);
+
+    /// Decode the specified `input` from its hexadecimal representation,
+    /// writing the result to the leading part of the specified `output`,
+    /// and load that leading part into the specified `result`.  Return 0
+    /// on success, and a non-zero value (with no effect on `result`) if
+    /// `input` contains a character that is neither a hex digit nor
+    /// whitespace, or an odd number of hex digits.  The behavior is
+    /// undefined unless `maxDecodedLength(input.size()) <= output.size()`
+    /// and `input.size()` does not exceed the maximum value of `int`.  Note
+    /// that the contents of `output` are unspecified if a non-zero value is
+    /// returned.
+    static int decode(bsl::span<char>       *result,
+                      bsl::span<char>        output,
+                      bsl::span<const char>  input);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // struct HexUtil
+                              // --------------
+
+// CLASS METHODS
+inline
+bsl::size_t HexUtil::encodedLength(bsl::size_t inputLength)
+{
+    BSLS_ASSERT(inputLength <= ~static_cast<bsl::size_t>(0) / 2);
+
+    return 2 * inputLength;
+}
+
+inline
+bsl::size_t HexUtil::maxDecodedLength(bsl::size_t inputLength)
+{
+    return inputLength / 2;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,557 @@
+// bdlde_hexutil.t.cpp                                                -*-C++-*-
+#include <bdlde_hexutil.h>
+
+#include <bdlde_hexdecoder.h>
+#include <bdlde_hexencoder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>       // `atoi`
+#include <bsl_cstring.h>       // `memcmp`
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_span.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides one-shot encode and decode functions
+// that are defined to produce exactly the results of `bdlde::HexEncoder` and
+// `bdlde::HexDecoder`.  We therefore test them differentially, against the
+// mechanisms driven through their generic (iterator) interface, over inputs
+// of every length up to several SIMD blocks, with injected whitespace and
+// invalid characters.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(bsl::size_t inputLength);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+// [ 2] span<char> encode(span<char>, span<const char>, bool = true);
+// [ 2] int decode(span<char> *, span<char>, span<const char>);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::HexUtil Util;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the next value of the pseudo-random sequence whose state is held
+/// in the specified `seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+/// Load into the specified `result` the specified `length` pseudo-random
+/// bytes drawn using the specified `seed`.
+void randomBytes(bsl::string *result, int length, unsigned int *seed)
+{
+    result->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*result)[i] = static_cast<char>(nextRandom(seed));
+    }
+}
+
+/// Return the result of encoding the specified `input` with a
+/// `bdlde::HexEncoder` configured with the specified `upperCaseLetters`,
+/// driven through its generic iterator interface.
+bsl::string streamEncode(const bsl::string& input, bool upperCaseLetters)
+{
+    bdlde::HexEncoder encoder(upperCaseLetters);
+    bsl::string       result;
+
+    bsl::back_insert_iterator<bsl::string> out(result);
+
+    int rc = encoder.convert(out, input.begin(), input.end());
+    ASSERT(0 == rc);
+    rc = encoder.endConvert(out);
+    ASSERT(0 == rc);
+
+    return result;
+}
+
+/// Decode the specified `input` with a `bdlde::HexDecoder` driven through
+/// its generic iterator interface, loading the result into the specified
+/// `result`.  Return 0 on success, and a non-zero value otherwise.
+int streamDecode(bsl::string *result, const bsl::string& input)
+{
+    bdlde::HexDecoder decoder;
+
+    bsl::back_insert_iterator<bsl::string> out(*result);
+
+    if (0 != decoder.convert(out, input.begin(), input.end())) {
+        return -1;                                                    // RETURN
+    }
+    return decoder.endConvert();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator(veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace `assert` with
+        //:   `ASSERT`, and insert `if (veryVerbose)` before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to display a buffer of binary data, and later recover it
+// from its display form.
+//
+// First, we describe the data:
+// ```
+    const char                  data[] = "\x00\x01\x02 binary \xfd\xfe\xff";
+    const bsl::span<const char> input(data, sizeof(data) - 1);
+// ```
+// Then, we encode the data into a suitably sized buffer:
+// ```
+    bsl::vector<char> encodedBuffer(
+                             bdlde::HexUtil::encodedLength(input.size()));
+
+    const bsl::span<char> encoded = bdlde::HexUtil::encode(encodedBuffer,
+                                                          input);
+    ASSERT(bsl::string(encoded.data(), encoded.size()) ==
+                                          "0001022062696E61727920FDFEFF");
+// ```
+// Finally, we decode the data and observe that we recover the original:
+// ```
+    bsl::vector<char> decodedBuffer(
+                          bdlde::HexUtil::maxDecodedLength(encoded.size()));
+
+    bsl::span<char> decoded;
+    int rc = bdlde::HexUtil::decode(&decoded, decodedBuffer, encoded);
+    ASSERT(0 == rc);
+    ASSERT(input.size() == decoded.size());
+    ASSERT(0 == bsl::memcmp(input.data(), decoded.data(), decoded.size()));
+// ```
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENCODE AND DECODE
+        //
+        // Concerns:
+        //: 1 `encode` writes exactly `encodedLength(input.size())` bytes, and
+        //:   those bytes are exactly what `bdlde::HexEncoder` produces, in
+        //:   either letter case, for every input length (in particular,
+        //:   lengths on either side of each SIMD block boundary).
+        //:
+        //: 2 `decode` succeeds on exactly the inputs accepted by
+        //:   `bdlde::HexDecoder`, produces the same bytes, and leaves
+        //:   `result` unchanged on failure.
+        //:
+        //: 3 Whitespace anywhere in the input, including within a block and
+        //:   between the two digits of a byte, is ignored by `decode`.
+        //:
+        //: 4 An invalid character, or an odd number of digits, anywhere in
+        //:   the input is reported by `decode`.
+        //:
+        //: 5 Neither function allocates memory.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For every length from 0 to 200, and for both letter cases,
+        //:   encode pseudo-random bytes with `encode` and with a
+        //:   `bdlde::HexEncoder` through `bsl::back_inserter`, and compare.
+        //:   (C-1, 5)
+        //:
+        //: 2 Decode each encoding with `decode` and compare with the
+        //:   original.  Then insert whitespace, an invalid character, or an
+        //:   extra digit at pseudo-random positions, decode with both
+        //:   `decode` and a `bdlde::HexDecoder`, and compare the status and,
+        //:   on success, the output.  (C-2..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an undersized output buffer (using the
+        //:   `BSLS_ASSERTTEST_*` macros).  (C-6)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(bsl::size_t inputLength);
+        //   bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        //   span<char> encode(span<char>, span<const char>, bool = true);
+        //   int decode(span<char> *, span<char>, span<const char>);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ENCODE AND DECODE" << endl
+                                  << "=================" << endl;
+
+        static const char INSERTIONS[] = " \t\n\r\v\fgG:/@`x";
+        const int         NUM_INSERTIONS = sizeof INSERTIONS - 1;
+
+        unsigned int seed = 12345;
+
+        bsl::string input(&defaultAllocator);
+        bsl::string expected(&defaultAllocator);
+        bsl::string modified(&defaultAllocator);
+        bsl::string streamed(&defaultAllocator);
+
+        bsl::vector<char> encodeBuffer(&defaultAllocator);
+        bsl::vector<char> decodeBuffer(&defaultAllocator);
+
+        for (int len = 0; len <= 200; ++len) {
+            for (int upper = 0; upper < 2; ++upper) {
+                u::randomBytes(&input, len, &seed);
+                expected = u::streamEncode(input, upper);
+
+                ASSERTV(len, expected.size() == Util::encodedLength(len));
+
+                encodeBuffer.assign(Util::encodedLength(len) + 1, '#');
+                decodeBuffer.resize(Util::maxDecodedLength(len * 2 + 4));
+
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                const bsl::span<char> encoded = Util::encode(
+                                        bsl::span<char>(encodeBuffer.data(),
+                                                        encodeBuffer.size()),
+                                        bsl::span<const char>(input.data(),
+                                                              input.size()),
+                                        upper);
+
+                ASSERTV(len, upper, dam.isTotalSame());
+                ASSERTV(len, upper, encodeBuffer.data() == encoded.data());
+                ASSERTV(len, upper,
+                        expected == bsl::string_view(encoded.data(),
+                                                     encoded.size()));
+                ASSERTV(len, upper, '#' == encodeBuffer.back());
+
+                bsl::span<char> decoded;
+                int             rc = Util::decode(
+                                      &decoded,
+                                      decodeBuffer,
+                                      bsl::span<const char>(expected.data(),
+                                                            expected.size()));
+
+                ASSERTV(len, upper, dam.isTotalSame());
+                ASSERTV(len, upper, rc, 0 == rc);
+                ASSERTV(len, upper,
+                        input == bsl::string_view(decoded.data(),
+                                                  decoded.size()));
+
+                for (int trial = 0; trial < 4; ++trial) {
+                    modified = expected;
+
+                    const int numInserted = 1 + u::nextRandom(&seed) % 3;
+                    for (int i = 0; i < numInserted; ++i) {
+                        const bsl::size_t pos = u::nextRandom(&seed) %
+                                                         (modified.size() + 1);
+                        const char        ch  = INSERTIONS[
+                                       u::nextRandom(&seed) % NUM_INSERTIONS];
+                        modified.insert(pos, 1, ch);
+                    }
+
+                    streamed.clear();
+                    const int EXP_RC = u::streamDecode(&streamed, modified);
+
+                    decodeBuffer.resize(
+                                   Util::maxDecodedLength(modified.size()));
+
+                    decoded = decodeBuffer;
+                    decoded = decoded.first(0);
+
+                    rc = Util::decode(
+                                      &decoded,
+                                      decodeBuffer,
+                                      bsl::span<const char>(modified.data(),
+                                                            modified.size()));
+
+                    ASSERTV(len, trial, modified, EXP_RC, rc,
+                            (0 == EXP_RC) == (0 == rc));
+                    if (0 == rc) {
+                        ASSERTV(len, trial, modified,
+                                streamed == bsl::string_view(decoded.data(),
+                                                             decoded.size()));
+                    }
+                    else {
+                        ASSERTV(len, trial, 0 == decoded.size());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        buffer[8];
+            const char  in[4] = { 'a', 'b', 'c', 'd' };
+
+            bsl::span<char> result;
+
+            ASSERT_PASS(Util::encode(bsl::span<char>(buffer, 8),
+                                     bsl::span<const char>(in, 4)));
+            ASSERT_FAIL(Util::encode(bsl::span<char>(buffer, 7),
+                                     bsl::span<const char>(in, 4)));
+
+            ASSERT_PASS(Util::decode(&result,
+                                     bsl::span<char>(buffer, 2),
+                                     bsl::span<const char>(in, 4)));
+            ASSERT_FAIL(Util::decode(&result,
+                                     bsl::span<char>(buffer, 1),
+                                     bsl::span<const char>(in, 4)));
+            ASSERT_FAIL(Util::decode(0,
+                                     bsl::span<char>(buffer, 2),
+                                     bsl::span<const char>(in, 4)));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode a few short strings and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        ASSERT(0 == Util::encodedLength(0));
+        ASSERT(8 == Util::encodedLength(4));
+        ASSERT(0 == Util::maxDecodedLength(1));
+        ASSERT(2 == Util::maxDecodedLength(5));
+
+        char buffer[32];
+
+        bsl::span<char> result = Util::encode(
+                                          buffer,
+                                          bsl::span<const char>("\x1f~", 2));
+        ASSERT("1F7E" == bsl::string(result.data(), result.size()));
+
+        result = Util::encode(buffer,
+                              bsl::span<const char>("\xab\xcd", 2),
+                              false);
+        ASSERT("abcd" == bsl::string(result.data(), result.size()));
+
+        const char *ENCODED = "1f7E\n41";
+        ASSERT(0 == Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>(ENCODED, 7)));
+        ASSERT("\x1f~A" == bsl::string(result.data(), result.size()));
+
+        ASSERT(0 != Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>("1f7", 3)));
+        ASSERT(0 != Util::decode(&result,
+                                 buffer,
+                                 bsl::span<const char>("1g", 2)));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The one-shot functions are substantially faster than driving the
+        //:   mechanisms through their generic iterator interface.
+        //
+        // Plan:
+        //: 1 Time the encoding and decoding of a 1MB buffer with both
+        //:   interfaces, and report the throughput in MB/s.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE TEST" << endl
+                                  << "================" << endl;
+
+        const int SIZE = 1 << 20;
+        const int REPS = argc > 2 ? atoi(argv[2]) : 20;
+
+        unsigned int seed = 1;
+        bsl::string  input(&defaultAllocator);
+        u::randomBytes(&input, SIZE, &seed);
+
+        bsl::vector<char> encoded(Util::encodedLength(SIZE),
+                                  &defaultAllocator);
+        bsl::vector<char> decoded(SIZE, &defaultAllocator);
+        bsl::string       streamed(&defaultAllocator);
+        bsl::span<char>   result;
+
+        bsls::Stopwatch timer;
+        const double    MB = REPS * static_cast<double>(SIZE) / (1 << 20);
+
+        timer.start();
+        for (int i = 0; i < REPS; ++i) {
+            Util::encode(encoded,
+                         bsl::span<const char>(input.data(), input.size()));
+        }
+        timer.stop();
+        printf("HexUtil::encode:        %8.1f MB/s\n",
+               MB / timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < REPS; ++i) {
+            streamed = u::streamEncode(input, true);
+        }
+        timer.stop();
+        printf("HexEncoder (iterator):  %8.1f MB/s\n",
+               MB / timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < REPS; ++i) {
+            ASSERT(0 == Util::decode(&result, decoded, encoded));
+        }
+        timer.stop();
+        printf("HexUtil::decode:        %8.1f MB/s\n",
+               MB / timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < REPS; ++i) {
+            bsl::string output(&defaultAllocator);
+            ASSERT(0 == u::streamDecode(&output, streamed));
+        }
+        timer.stop();
+        printf("HexDecoder (iterator):  %8.1f MB/s\n",
+               MB / timer.elapsedTime());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -71,14 +71,25 @@
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
 #include <bsl_ios.h>
 #include <bsl_ostream.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_MD5_AVX2_ENABLED 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 
 BSLMF_ASSERT(sizeof(unsigned int) == 4);
@@ -492,12 +503,468 @@ static void initStates(unsigned int (*state)[4])
     (*state)[3] = INITSTATE3;
 }
 
+/// Load into the specified `results` the MD5 digests of the specified
+/// `numMessages` messages, the `i`th of which is at `messages[i]` and has
+/// `lengths[i]` bytes, one message at a time.
+static void loadDigestsSerially(bdlde::Md5::Md5Digest *results,
+                                const void *const     *messages,
+                                const bsl::size_t     *lengths,
+                                bsl::size_t            numMessages)
+{
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        // 'Md5::update' takes an 'int' length, so a longer message is
+        // supplied in pieces.
+
+        const bsl::size_t k_MAX_LENGTH = INT_MAX;
+
+        bdlde::Md5   hasher;
+        const char  *data      = static_cast<const char *>(messages[i]);
+        bsl::size_t  remaining = lengths[i];
+        while (remaining) {
+            const int length = static_cast<int>(bsl::min(remaining,
+                                                         k_MAX_LENGTH));
+            hasher.update(data, length);
+            data      += length;
+            remaining -= length;
+        }
+        hasher.loadDigest(results + i);
+    }
+}
+
+#ifdef BDLDE_MD5_AVX2_ENABLED
+
+// The sine-derived constants, message word indices, and rotation amounts of
+// the 64 MD5 steps, as used (inline) by 'append'.
+
+static const unsigned int u_md5Constants[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+
+static const int u_md5Shifts[4][4] = {
+    { S11, S12, S13, S14 },
+    { S21, S22, S23, S24 },
+    { S31, S32, S33, S34 },
+    { S41, S42, S43, S44 },
+};
+
+/// Return the specified `x` with each 32-bit lane rotated left by the
+/// specified `n` bits.
+__attribute__((target("avx2")))
+inline
+static __m256i rotateLeft8(__m256i x, int n)
+{
+    return _mm256_or_si256(_mm256_slli_epi32(x, n),
+                           _mm256_srli_epi32(x, 32 - n));
+}
+
+/// Transpose the 8x8 matrix of 32-bit words in the specified `rows`, so
+/// that on return `rows[i]` holds the `i`th word of each original row.
+__attribute__((target("avx2")))
+inline
+static void transpose8x8(__m256i *rows)
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/// Update each of the 8 MD5 states held in the specified `state`, in which
+/// `state[w][l]` is word `w` of the state of lane `l`, with the contents of
+/// the 64-byte block at `blocks[l]`, using the AVX2 instructions.  The
+/// behavior is undefined unless the current CPU supports those
+/// instructions.
+__attribute__((target("avx2")))
+static void appendX8(unsigned int (*state)[8], const unsigned char **blocks)
+{
+    // MD5 reads its message words in little-endian order, so on x86 no byte
+    // swapping is needed.
+
+    __m256i x[16];
+    for (int half = 0; half < 2; ++half) {
+        __m256i *rows = x + 8 * half;
+        for (int lane = 0; lane < 8; ++lane) {
+            const unsigned char *row = blocks[lane] + 32 * half;
+            rows[lane] = _mm256_loadu_si256(
+                                      reinterpret_cast<const __m256i *>(row));
+        }
+        transpose8x8(rows);
+    }
+
+    __m256i abcd[4];
+    for (int word = 0; word < 4; ++word) {
+        abcd[word] = _mm256_loadu_si256(
+                               reinterpret_cast<const __m256i *>(state[word]));
+    }
+
+    __m256i       a    = abcd[0];
+    __m256i       b    = abcd[1];
+    __m256i       c    = abcd[2];
+    __m256i       d    = abcd[3];
+    const __m256i ones = _mm256_set1_epi32(-1);
+
+    for (int step = 0; step < 64; ++step) {
+        const int round = step / 16;
+
+        __m256i f;
+        int     index;
+        switch (round) {
+          case 0: {
+            f     = _mm256_xor_si256(
+                             d, _mm256_and_si256(b, _mm256_xor_si256(c, d)));
+            index = step;
+          } break;
+          case 1: {
+            f     = _mm256_xor_si256(
+                             c, _mm256_and_si256(d, _mm256_xor_si256(b, c)));
+            index = (5 * step + 1) & 15;
+          } break;
+          case 2: {
+            f     = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+            index = (3 * step + 5) & 15;
+          } break;
+          default: {
+            f     = _mm256_xor_si256(
+                           c, _mm256_or_si256(b, _mm256_xor_si256(d, ones)));
+            index = (7 * step) & 15;
+          } break;
+        }
+
+        const __m256i sum = _mm256_add_epi32(
+              _mm256_add_epi32(a, f),
+              _mm256_add_epi32(
+                  x[index],
+                  _mm256_set1_epi32(static_cast<int>(u_md5Constants[step]))));
+
+        a = d;
+        d = c;
+        c = b;
+        b = _mm256_add_epi32(
+                        b, rotateLeft8(sum, u_md5Shifts[round][step & 3]));
+    }
+
+    abcd[0] = _mm256_add_epi32(abcd[0], a);
+    abcd[1] = _mm256_add_epi32(abcd[1], b);
+    abcd[2] = _mm256_add_epi32(abcd[2], c);
+    abcd[3] = _mm256_add_epi32(abcd[3], d);
+
+    for (int word = 0; word < 4; ++word) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[word]),
+                            abcd[word]);
+    }
+}
+
+/// This `struct` tracks the progress of one message through a lane of a
+/// multi-buffer MD5 computation: the message's complete 64-byte blocks are
+/// read in place, followed by one or two blocks holding the remainder of
+/// the message and the MD5 padding.
+struct Md5Lane {
+
+    // DATA
+    const unsigned char *d_data_p;          // next complete block of message
+
+    bsl::size_t          d_numFullBlocks;   // complete blocks remaining
+
+    unsigned char        d_tail[128];       // final, padded, block(s)
+
+    int                  d_numTailBlocks;   // number of blocks in 'd_tail'
+
+    int                  d_tailIndex;       // blocks of 'd_tail' consumed
+
+    bsl::size_t          d_message;         // index of message in this lane
+
+    // MANIPULATORS
+
+    /// Prepare this lane to hash the specified `message` having the
+    /// specified `length` and the specified `index`.
+    void start(const unsigned char *message,
+               bsl::size_t          length,
+               bsl::size_t          index)
+    {
+        const int remainder = static_cast<int>(length % BYTEBLOCKSIZE);
+
+        d_data_p        = message;
+        d_numFullBlocks = length / BYTEBLOCKSIZE;
+        d_numTailBlocks = remainder < BYTEBLOCKSIZE - BYTELENGTHPADSIZE
+                        ? 1
+                        : 2;
+        d_tailIndex     = 0;
+        d_message       = index;
+
+        bsl::memset(d_tail, 0, sizeof d_tail);
+        if (remainder) {
+            bsl::memcpy(d_tail, message + length - remainder, remainder);
+        }
+        d_tail[remainder] = 0x80;
+
+        // The bit length is stored little-endian.
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        unsigned char *end       = d_tail + d_numTailBlocks * BYTEBLOCKSIZE;
+        const Uint64   bitLength = static_cast<Uint64>(length) * 8;
+        for (int i = 0; i < BYTELENGTHPADSIZE; ++i) {
+            end[i - BYTELENGTHPADSIZE] =
+                                static_cast<unsigned char>(bitLength >> 8 * i);
+        }
+    }
+
+    /// Return the address of the next block of this lane's message, and
+    /// advance past it.  The behavior is undefined if `isDone()`.
+    const unsigned char *nextBlock()
+    {
+        if (d_numFullBlocks) {
+            const unsigned char *block = d_data_p;
+            d_data_p += BYTEBLOCKSIZE;
+            --d_numFullBlocks;
+            return block;                                             // RETURN
+        }
+        return d_tail + BYTEBLOCKSIZE * d_tailIndex++;
+    }
+
+    // ACCESSORS
+
+    /// Return `true` if every block of this lane's message has been
+    /// returned by `nextBlock`, and `false` otherwise.
+    bool isDone() const
+    {
+        return 0 == d_numFullBlocks && d_tailIndex == d_numTailBlocks;
+    }
+};
+
+/// Store into the specified `result` the digest held in column `lane` of
+/// the specified `state`.
+static void populateResultBuffer(bdlde::Md5::Md5Digest *result,
+                                 unsigned int         (*state)[8],
+                                 int                    lane)
+{
+    unsigned int laneState[4];
+    for (int word = 0; word < 4; ++word) {
+        laneState[word] = state[word][lane];
+    }
+    populateResultBuffer(result, laneState);
+}
+
+/// Start the lane at the specified `lane` index of the specified `lanes`
+/// hashing the message at the specified `*nextMessage` index of the
+/// specified `messages` having the specified `lengths`, resetting column
+/// `lane` of the specified `state` to the MD5 initial state and
+/// incrementing `*nextMessage`; or, if `*nextMessage` equals the specified
+/// `numMessages`, mark the lane as inactive in the specified `isActive`.
+/// Update the specified `numActive` to count the active lanes.
+static void startLane(Md5Lane            *lanes,
+                      bool               *isActive,
+                      unsigned int      (*state)[8],
+                      int                 lane,
+                      bsl::size_t        *nextMessage,
+                      int                *numActive,
+                      const void *const  *messages,
+                      const bsl::size_t  *lengths,
+                      bsl::size_t         numMessages)
+{
+    if (*nextMessage == numMessages) {
+        if (isActive[lane]) {
+            isActive[lane] = false;
+            --*numActive;
+        }
+        return;                                                       // RETURN
+    }
+
+    lanes[lane].start(
+                   static_cast<const unsigned char *>(messages[*nextMessage]),
+                   lengths[*nextMessage],
+                   *nextMessage);
+    ++*nextMessage;
+
+    unsigned int initialState[4];
+    initStates(&initialState);
+    for (int word = 0; word < 4; ++word) {
+        state[word][lane] = initialState[word];
+    }
+
+    if (!isActive[lane]) {
+        isActive[lane] = true;
+        ++*numActive;
+    }
+}
+
+/// Load into the specified `results` the MD5 digests of the specified
+/// `numMessages` messages, the `i`th of which is at `messages[i]` and has
+/// `lengths[i]` bytes, hashing up to 8 messages at a time using the AVX2
+/// instructions.  The behavior is undefined unless the current CPU supports
+/// those instructions.
+static void loadDigestsAvx2(bdlde::Md5::Md5Digest *results,
+                            const void *const     *messages,
+                            const bsl::size_t     *lengths,
+                            bsl::size_t            numMessages)
+{
+    enum { k_NUM_LANES = 8 };
+
+    static const unsigned char zeroBlock[BYTEBLOCKSIZE] = {};
+
+    Md5Lane      lanes[k_NUM_LANES];
+    bool         isActive[k_NUM_LANES];
+    unsigned int state[4][k_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    int         numActive   = 0;
+
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        isActive[lane] = false;
+        startLane(lanes, isActive, state, lane, &nextMessage, &numActive,
+                  messages, lengths, numMessages);
+    }
+
+    while (numActive) {
+        if (1 == numActive && nextMessage == numMessages) {
+            // Finish the last message in a single lane with 'append', rather
+            // than hashing 7 idle lanes alongside it.
+
+            int lane = 0;
+            while (!isActive[lane]) {
+                ++lane;
+            }
+
+            Md5Lane&     last = lanes[lane];
+            unsigned int lastState[4];
+            for (int word = 0; word < 4; ++word) {
+                lastState[word] = state[word][lane];
+            }
+            while (!last.isDone()) {
+                append(lastState, last.nextBlock());
+            }
+            populateResultBuffer(results + last.d_message, lastState);
+            break;
+        }
+
+        const unsigned char *blocks[k_NUM_LANES];
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            blocks[lane] = isActive[lane] ? lanes[lane].nextBlock()
+                                          : zeroBlock;
+        }
+
+        appendX8(state, blocks);
+
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (!isActive[lane] || !lanes[lane].isDone()) {
+                continue;
+            }
+
+            populateResultBuffer(results + lanes[lane].d_message,
+                                 state,
+                                 lane);
+
+            startLane(lanes, isActive, state, lane, &nextMessage, &numActive,
+                      messages, lengths, numMessages);
+        }
+    }
+}
+
+/// Return `true` if the current CPU and operating system support the AVX2
+/// instructions, and `false` otherwise.
+static bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & bit_OSXSAVE)
+     || !(ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    // Verify that the operating system saves the 'ymm' registers.
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (0x6 != (xcr0Low & 0x6)) {
+        return false;                                                 // RETURN
+    }
+
+    return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        && (ebx & bit_AVX2);
+}
+
+#endif
+
+/// Alias for a function that loads into the specified `results` the MD5
+/// digests of the specified `numMessages` messages, the `i`th of which is
+/// at `messages[i]` and has `lengths[i]` bytes.
+typedef void (*LoadDigestsFn)(bdlde::Md5::Md5Digest *results,
+                              const void *const     *messages,
+                              const bsl::size_t     *lengths,
+                              bsl::size_t            numMessages);
+
+/// Return the fastest implementation of `Md5::loadDigests` supported by the
+/// current CPU.
+static LoadDigestsFn loadDigestsFn()
+{
+    static LoadDigestsFn s_loadDigests = 0;
+    BSLMT_ONCE_DO {
+        s_loadDigests = loadDigestsSerially;
+#ifdef BDLDE_MD5_AVX2_ENABLED
+        if (isAvx2Supported()) {
+            s_loadDigests = loadDigestsAvx2;
+        }
+#endif
+    }
+    return s_loadDigests;
+}
+
 namespace bdlde {
 
                                  // ---------
                                  // class Md5
                                  // ---------
 
+// CLASS METHODS
+void Md5::loadDigests(Md5Digest         *results,
+                      const void *const *messages,
+                      const bsl::size_t *lengths,
+                      bsl::size_t        numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    loadDigestsFn()(results, messages, lengths, numMessages);
+}
+
 // CREATORS
 Md5::Md5()
 : d_length(0)
@@ -661,6 +1128,8 @@ bool bdlde::operator==(const Md5& lhs, const Md5& rhs)
 
 }  // close enterprise namespace
 
+#undef BDLDE_MD5_AVX2_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
 //
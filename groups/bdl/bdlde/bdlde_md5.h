@@ -52,6 +52,12 @@ BSLS_IDENT("$Id: $")
 // iterations of the equivalent function in `openssl`, `MD5_Update`, will
 // typically take between 0.80s to 0.85s on Sun and 0.65s to 0.67s on IBM.
 //
+// `Md5::loadDigests` computes the digests of a batch of independent messages.
+// On processors with AVX2 (detected once per process, on x86-64 with GCC or
+// Clang), it hashes 8 messages at a time, one per 32-bit lane of the vector
+// registers, which substantially improves throughput for batches of messages;
+// otherwise, it hashes the messages one at a time.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -127,6 +133,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_compilerfeatures.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
 
@@ -182,6 +189,21 @@ class Md5 {
     /// value-semantic types and containers.
     static int maxSupportedBdexVersion(int);
 
+    /// Load into the specified `results` the MD5 digests of the specified
+    /// `numMessages` messages, the `i`th of which is the range
+    /// `[messages[i], messages[i] + lengths[i])`, such that `results[i]`
+    /// holds the digest of the `i`th message.  The behavior is undefined
+    /// unless `results`, `messages`, and `lengths` each have `numMessages`
+    /// elements, each message range is valid, and `results` does not
+    /// overlap any message.  Note that the digest of each message is
+    /// identical to that loaded by an `Md5` object supplied the message,
+    /// but independent messages may be hashed in parallel (see
+    /// {Performance}).
+    static void loadDigests(Md5Digest         *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct an MD5 digest having the value corresponding to no data
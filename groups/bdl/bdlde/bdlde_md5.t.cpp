@@ -7,6 +7,7 @@
 #include <bsls_stopwatch.h>                     // for testing only
 
 #include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // memcmp(), memset(), strlen()
 #include <bsl_iostream.h>
 #include <bsl_string.h>      // test case 11, string
 #include <bsl_sstream.h>
@@ -66,6 +67,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [10] static int maxSupportedBdexVersion(int);
+// [15] static void loadDigests(Md5Digest *, const void *const *, size_t *, n);
 //
 // CREATORS
 // [ 2] bdlde::Md5();
@@ -91,9 +93,10 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Md5&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: loadDigests
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Md5& gg(bdlde::Md5 *object, const char *spec);
@@ -434,7 +437,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -465,6 +468,163 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //   Test the class method 'loadDigests'.
+        //
+        // Concerns:
+        //   We want to verify that the digest loaded for each message in a
+        //   batch is the digest computed by an 'Md5' object for that message,
+        //   that each digest is written to its own element of 'results'
+        //   whatever the order in which the messages finish hashing, and that
+        //   messages requiring one or two final padding blocks, empty
+        //   messages, and batches of any size are handled.
+        //
+        // Plan:
+        //   First, hash the RFC 1321 test vectors as a batch and compare each
+        //   result with the known digest.  Then, for batches of every size up
+        //   to 40 (and some larger), hash messages of pseudo-random lengths,
+        //   chosen to include every remainder modulo 64 and lengths spanning
+        //   several blocks, and compare each result with the digest computed
+        //   by an 'Md5' object.  Verify that the element of 'results' past
+        //   the last message is not modified.
+        //
+        // Testing:
+        //   static void loadDigests(Md5Digest *, const void *const *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'loadDigests'"
+                          << "\n=====================" << endl;
+
+        static const struct {
+            int         d_lineNum;  // source line number
+            const char *d_str;      // source string
+            const char *d_result;   // expected result string
+        } DATA[] = {
+            //line  source            digest
+            //----  ------            ----------------------------------
+            { L_,   "",               "d41d8cd98f00b204e9800998ecf8427e" },
+            { L_,   "a",              "0cc175b9c0f1b6a831c399e269772661" },
+            { L_,   "abc",            "900150983cd24fb0d6963f7d28e17f72" },
+            { L_,   "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+            { L_,   "abcdefghijklmnopqrstuvwxyz",
+                                      "c3fcd3d76192e4007dfb496cca67e13b" },
+            { L_,   "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                    "abcdefghijklmnopqrstuvwxyz0123456789",
+                                      "d174ab98d277d9f5a5611c2c9f419d9f" },
+            { L_,   "1234567890123456789012345678901234567890"
+                    "1234567890123456789012345678901234567890",
+                                      "57edf4a22be3c955ac49da2e2107b67a" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nTesting known digests." << endl;
+        {
+            const void     *messages[NUM_DATA];
+            bsl::size_t     lengths[NUM_DATA];
+            Obj::Md5Digest  results[NUM_DATA];
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                messages[i] = DATA[i].d_str;
+                lengths[i]  = strlen(DATA[i].d_str);
+            }
+
+            Obj::loadDigests(results, messages, lengths, NUM_DATA);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE   = DATA[i].d_lineNum;
+                const int LENGTH = static_cast<int>(lengths[i]);
+
+                bsl::ostringstream stream;
+                stream << Obj(messages[i], LENGTH);
+                LOOP_ASSERT(LINE, DATA[i].d_result == stream.str());
+
+                Obj::Md5Digest expected;
+                Obj(messages[i], LENGTH).loadDigest(&expected);
+                LOOP_ASSERT(LINE, 0 == memcmp(expected.buffer(),
+                                              results[i].buffer(),
+                                              sizeof expected));
+            }
+        }
+
+        if (verbose) cout << "\nTesting mixed batches." << endl;
+        {
+            bsl::vector<char> data(64 * 12);
+            for (int i = 0; i < static_cast<int>(data.size()); ++i) {
+                data[i] = static_cast<char>(i * 131 + (i >> 7));
+            }
+
+            const int BATCH_SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 33,
+                                        100, 257 };
+            const int NUM_BATCH_SIZES = sizeof BATCH_SIZES
+                                      / sizeof *BATCH_SIZES;
+
+            unsigned int seed = 12345;
+            for (int ti = 0; ti < NUM_BATCH_SIZES + 40; ++ti) {
+                const int NUM_MESSAGES = ti < NUM_BATCH_SIZES
+                                       ? BATCH_SIZES[ti]
+                                       : ti - NUM_BATCH_SIZES;
+
+                if (veryVerbose) { T_ P(NUM_MESSAGES) }
+
+                // Fill every digest, including the one past the last
+                // message, with a known pattern to detect stray writes.
+
+                Obj::Md5Digest filler;
+                memset(filler.buffer(), 0xa5, sizeof filler);
+
+                bsl::vector<const void *>    messages(NUM_MESSAGES + 1);
+                bsl::vector<bsl::size_t>     lengths(NUM_MESSAGES + 1);
+                bsl::vector<Obj::Md5Digest>  results(NUM_MESSAGES + 1);
+
+                for (bsl::size_t i = 0; i < results.size(); ++i) {
+                    results[i] = filler;
+                }
+
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    seed = seed * 1103515245 + 12345;
+
+                    // Alternate short lengths, which exercise every
+                    // remainder modulo 64, with longer ones, so that lanes
+                    // finish out of order.
+
+                    const bsl::size_t length = (seed >> 16) % 2
+                                             ? (seed >> 8) % 130
+                                             : (seed >> 8) % (64 * 11);
+                    const bsl::size_t offset = (seed >> 4)
+                                             % (data.size() - length + 1);
+
+                    messages[i] = &data[0] + offset;
+                    lengths[i]  = length;
+                }
+
+                Obj::loadDigests(&results[0],
+                                 &messages[0],
+                                 &lengths[0],
+                                 NUM_MESSAGES);
+
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    Obj::Md5Digest expected;
+                    Obj(messages[i], static_cast<int>(lengths[i])).loadDigest(
+                                                                   &expected);
+
+                    LOOP3_ASSERT(NUM_MESSAGES, i, lengths[i],
+                                 0 == memcmp(expected.buffer(),
+                                             results[i].buffer(),
+                                             sizeof expected));
+                }
+
+                // The element past the last digest is untouched.
+
+                const char *past = results[NUM_MESSAGES].buffer();
+                for (int j = 0; j < static_cast<int>(sizeof results[0]); ++j) {
+                    LOOP2_ASSERT(NUM_MESSAGES, j,
+                                 static_cast<char>(0xa5) == past[j]);
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING 'loadDigestAndReset(Md5Digest *result)'
@@ -2390,6 +2550,71 @@ int main(int argc, char *argv[])
         bsl::cout << "Typical openssl performance on Sun: 0.84s" << bsl::endl;
         bsl::cout << "Typical openssl performance on IBM: 0.66s" << bsl::endl;
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'loadDigests'
+        //
+        // Concerns:
+        //   We want to know how much faster hashing a batch of messages with
+        //   'loadDigests' is than hashing them one at a time.
+        //
+        // Plan:
+        //   Using 'bsls_stopwatch', time hashing a batch of messages of each
+        //   of several lengths, first with an 'Md5' object per message and
+        //   then with 'loadDigests', and print the throughput of each.
+        //
+        // Testing:
+        //   static void loadDigests(...);  // performance
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: 'loadDigests'"
+                          << "\n===============================" << endl;
+
+        const int NUM_MESSAGES = 1024;
+        const int NUM_ITER     = 64;
+        const int LENGTHS[]    = { 16, 55, 64, 256, 1024 };
+        const int NUM_LENGTHS  = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::vector<char>           data(NUM_MESSAGES * LENGTH, 'x');
+            bsl::vector<const void *>   messages(NUM_MESSAGES);
+            bsl::vector<bsl::size_t>    lengths(NUM_MESSAGES, LENGTH);
+            bsl::vector<Obj::Md5Digest> results(NUM_MESSAGES);
+
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = &data[i * LENGTH];
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    Obj(messages[i], LENGTH).loadDigest(&results[i]);
+                }
+            }
+            timer.stop();
+            const double serial = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                Obj::loadDigests(&results[0],
+                                 &messages[0],
+                                 &lengths[0],
+                                 NUM_MESSAGES);
+            }
+            timer.stop();
+            const double batched = timer.elapsedTime();
+
+            const double hashed = 1.0 * NUM_MESSAGES * NUM_ITER;
+            cout << "length " << LENGTH
+                 << ": one at a time " << hashed / serial / 1e6
+                 << " M msg/s, batched " << hashed / batched / 1e6
+                 << " M msg/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
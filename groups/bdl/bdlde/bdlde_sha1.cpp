@@ -10,6 +10,15 @@ BSLS_IDENT_RCSID(bdlde_sha1_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 #include <bsl_type_traits.h>
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <immintrin.h>
+# define BDLDE_SHA1_SHANI_ENABLED
+#endif
 
 namespace BloombergLP {
 namespace bdlde {
@@ -148,10 +157,10 @@ void toHex(char *output, const unsigned char (&input)[Sha1::k_DIGEST_SIZE])
 
 /// Update the specified `state` with the hashed contents of the specified
 /// `message` having a length equal to the specified `numMessageBlocks`
-/// times `k_SHA1_BLOCK_SIZE`.
-void transform(Sha1State           *state,
-               const unsigned char *message,
-               bsl::uint64_t        numMessageBlocks)
+/// times `k_SHA1_BLOCK_SIZE`, using only portable C++.
+void transformPortable(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
 {
     const unsigned char *messageEnd =
         message + k_SHA1_BLOCK_SIZE * numMessageBlocks;
@@ -191,6 +200,214 @@ void transform(Sha1State           *state,
     }
 }
 
+#ifdef BDLDE_SHA1_SHANI_ENABLED
+/// Perform on the specified `abcd` and `e` the four SHA-1 rounds using the
+/// mixing function having the specified `FUNCTION` index (0 to 3) and the
+/// four message words in the specified `message`, saving the value of
+/// `abcd` before the rounds in the specified `eNext`, from which the `e`
+/// input of the next four rounds is derived.
+template <int FUNCTION>
+__attribute__((target("sha,sse4.1")))
+inline
+void rounds4(__m128i *abcd, __m128i *e, __m128i *eNext, __m128i message)
+{
+    *e     = _mm_sha1nexte_epu32(*e, message);
+    *eNext = *abcd;
+    *abcd  = _mm_sha1rnds4_epu32(*abcd, *e, FUNCTION);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the SHA extensions to the x86
+/// instruction set.  The behavior is undefined unless the current CPU
+/// supports those extensions.
+__attribute__((target("sha,sse4.1")))
+void transformShaNi(Sha1State           *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numMessageBlocks)
+{
+    // Reverses the bytes of a 128-bit vector, converting four big-endian
+    // message words to native order and placing the first word in the most
+    // significant lane, as the SHA instructions expect.
+
+    const __m128i byteReverse = _mm_set_epi64x(0x0001020304050607LL,
+                                               0x08090a0b0c0d0e0fLL);
+
+    __m128i abcd = _mm_shuffle_epi32(
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(*state)),
+               0x1b);
+    __m128i e0   = _mm_set_epi32(static_cast<int>((*state)[4]), 0, 0, 0);
+    __m128i e1;
+
+    const unsigned char *messageEnd =
+        message + k_SHA1_BLOCK_SIZE * numMessageBlocks;
+    for (; message != messageEnd; message += k_SHA1_BLOCK_SIZE)
+    {
+        const __m128i *in = reinterpret_cast<const __m128i *>(message);
+
+        const __m128i abcdSave = abcd;
+        const __m128i eSave    = e0;
+
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128(in + 0), byteReverse);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), byteReverse);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), byteReverse);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), byteReverse);
+
+        // Each group of four rounds below is followed by the steps of the
+        // message schedule that its message words complete:
+        // 'sha1msg1' and the 'xor' compute the partial sums of the
+        // schedule, and 'sha1msg2' finishes each group of four words.
+
+        // Rounds 0 to 3.
+
+        e0   = _mm_add_epi32(e0, m0);
+        e1   = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        // Rounds 4 to 19.
+
+        rounds4<0>(&abcd, &e1, &e0, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+
+        rounds4<0>(&abcd, &e0, &e1, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+
+        rounds4<0>(&abcd, &e1, &e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+
+        rounds4<0>(&abcd, &e0, &e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+
+        // Rounds 20 to 39.
+
+        rounds4<1>(&abcd, &e1, &e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+
+        rounds4<1>(&abcd, &e0, &e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+
+        rounds4<1>(&abcd, &e1, &e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+
+        rounds4<1>(&abcd, &e0, &e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+
+        rounds4<1>(&abcd, &e1, &e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+
+        // Rounds 40 to 59.
+
+        rounds4<2>(&abcd, &e0, &e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+
+        rounds4<2>(&abcd, &e1, &e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+
+        rounds4<2>(&abcd, &e0, &e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+
+        rounds4<2>(&abcd, &e1, &e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+
+        rounds4<2>(&abcd, &e0, &e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+
+        // Rounds 60 to 79.
+
+        rounds4<3>(&abcd, &e1, &e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+
+        rounds4<3>(&abcd, &e0, &e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+
+        rounds4<3>(&abcd, &e1, &e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m3 = _mm_xor_si128(m3, m1);
+
+        rounds4<3>(&abcd, &e0, &e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+
+        rounds4<3>(&abcd, &e1, &e0, m3);
+
+        // Update the state.
+
+        e0   = _mm_sha1nexte_epu32(e0, eSave);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(*state),
+                     _mm_shuffle_epi32(abcd, 0x1b));
+    (*state)[4] = static_cast<Sha1Word>(_mm_extract_epi32(e0, 3));
+}
+#endif
+
+/// Alias for a function that updates the specified `state` with the hashed
+/// contents of the specified `message` having a length equal to the
+/// specified `numMessageBlocks` times `k_SHA1_BLOCK_SIZE`.
+typedef void (*TransformFn)(Sha1State           *state,
+                            const unsigned char *message,
+                            bsl::uint64_t        numMessageBlocks);
+
+/// Return the fastest implementation of `transform` supported by the
+/// current CPU.
+TransformFn selectTransform()
+{
+#ifdef BDLDE_SHA1_SHANI_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     && (ecx & bit_SSE4_1)
+     && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+     && (ebx & bit_SHA)) {
+        return transformShaNi;                                        // RETURN
+    }
+#endif
+    return transformPortable;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the fastest implementation supported by
+/// the current CPU.
+void transform(Sha1State           *state,
+               const unsigned char *message,
+               bsl::uint64_t        numMessageBlocks)
+{
+    static TransformFn s_transform = 0;
+    BSLMT_ONCE_DO {
+        s_transform = selectTransform();
+    }
+    s_transform(state, message, numMessageBlocks);
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize` in bytes.  Update the specified `totalSize` to have the
@@ -374,6 +591,8 @@ bool bdlde::operator==(const Sha1& lhs, const Sha1& rhs)
 
 }  // close enterprise namespace
 
+#undef BDLDE_SHA1_SHANI_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2022 Bloomberg Finance L.P.
 //
@@ -41,6 +41,15 @@ BSLS_IDENT("$Id$ $CSID$")
 // considerations, and the availability of SHA-2 and SHA-3 as alternatives,
 // there is no justification for using SHA-1 unless you absolutely have to.
 //
+///Performance
+///-----------
+// On x86 processors that implement the SHA extensions, `Sha1` compresses each
+// 64-byte block with the dedicated SHA-1 instructions, which is several times
+// faster than the portable implementation.  When built for x86-64 with GCC or
+// Clang, the component selects, once per process, the SHA implementation if
+// the CPU reports support for the extensions, and the portable implementation
+// otherwise.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -1,10 +1,27 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_SHA2_SHANI_ENABLED 1
+#define BDLDE_SHA2_AVX2_ENABLED 1
+#endif
+
+#if defined(BDLDE_SHA2_SHANI_ENABLED) || defined(BDLDE_SHA2_AVX2_ENABLED)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -196,16 +213,23 @@ const bsl::uint64_t sha512Constants[80] =
              0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
 /// Update the specified `state` with the hashed contents of the specified
 /// `message` having a length equal to the specified `bufferSize` times the
 /// specified `numberOfBuffers`, mixing it with the values in the specified
 /// `constants`.
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformPortable(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
 {
     const unsigned char *messageEnd = message + bufferSize * numberOfBuffers;
     for (; message != messageEnd; message += bufferSize)
@@ -247,6 +271,639 @@ void transform(INTEGER             *state,
     }
 }
 
+#ifdef BDLDE_SHA2_SHANI_ENABLED
+/// Perform on the specified `abef` and `cdgh` (holding the SHA-256 working
+/// variables named by each) the four SHA-256 rounds using the four message
+/// words in the specified `message` and the four round constants at the
+/// specified `constants`.
+__attribute__((target("sha,sse4.1")))
+inline
+void sha256Rounds4(__m128i             *abef,
+                   __m128i             *cdgh,
+                   __m128i              message,
+                   const bsl::uint32_t *constants)
+{
+    const __m128i *k = reinterpret_cast<const __m128i *>(constants);
+    __m128i        wk = _mm_add_epi32(message, _mm_loadu_si128(k));
+
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    wk    = _mm_shuffle_epi32(wk, 0x0e);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, wk);
+}
+
+/// Complete the four message schedule words in the specified `next`, whose
+/// partial sums were computed by `_mm_sha256msg1_epu32`, using the
+/// specified `current` and `previous` groups of four message words.
+__attribute__((target("sha,sse4.1")))
+inline
+void sha256Schedule(__m128i *next, __m128i current, __m128i previous)
+{
+    *next = _mm_sha256msg2_epu32(
+                   _mm_add_epi32(*next, _mm_alignr_epi8(current, previous, 4)),
+                   current);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to 64 times the specified
+/// `numberOfBuffers`, using the SHA extensions to the x86 instruction set.
+/// The behavior is undefined unless the current CPU supports those
+/// extensions.
+__attribute__((target("sha,sse4.1")))
+void transformSha256ShaNi(bsl::uint32_t       *state,
+                          const unsigned char *message,
+                          bsl::uint64_t        numberOfBuffers)
+{
+    // Converts four big-endian message words to native order.
+
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL,
+                                            0x0405060700010203LL);
+
+    // The SHA instructions operate on the working variables arranged as
+    // 'abef' and 'cdgh'.
+
+    const __m128i dcba = _mm_shuffle_epi32(
+                 _mm_loadu_si128(reinterpret_cast<const __m128i *>(state)),
+                 0xb1);
+    const __m128i efgh = _mm_shuffle_epi32(
+                 _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)),
+                 0x1b);
+
+    __m128i abef = _mm_alignr_epi8(dcba, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, dcba, 0xf0);
+
+    const bsl::uint32_t *k = sha256Constants;
+
+    const unsigned char *messageEnd = message + 64 * numberOfBuffers;
+    for (; message != messageEnd; message += 64) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(message);
+
+        const __m128i abefSave = abef;
+        const __m128i cdghSave = cdgh;
+
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128(in + 0), byteSwap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), byteSwap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), byteSwap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), byteSwap);
+
+        // Each group of four rounds is followed by the steps of the message
+        // schedule that its message words make possible.
+
+        sha256Rounds4(&abef, &cdgh, m0, k +  0);
+
+        sha256Rounds4(&abef, &cdgh, m1, k +  4);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+
+        sha256Rounds4(&abef, &cdgh, m2, k +  8);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+
+        sha256Rounds4(&abef, &cdgh, m3, k + 12);
+        sha256Schedule(&m0, m3, m2);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+
+        sha256Rounds4(&abef, &cdgh, m0, k + 16);
+        sha256Schedule(&m1, m0, m3);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+
+        sha256Rounds4(&abef, &cdgh, m1, k + 20);
+        sha256Schedule(&m2, m1, m0);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+
+        sha256Rounds4(&abef, &cdgh, m2, k + 24);
+        sha256Schedule(&m3, m2, m1);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+
+        sha256Rounds4(&abef, &cdgh, m3, k + 28);
+        sha256Schedule(&m0, m3, m2);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+
+        sha256Rounds4(&abef, &cdgh, m0, k + 32);
+        sha256Schedule(&m1, m0, m3);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+
+        sha256Rounds4(&abef, &cdgh, m1, k + 36);
+        sha256Schedule(&m2, m1, m0);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+
+        sha256Rounds4(&abef, &cdgh, m2, k + 40);
+        sha256Schedule(&m3, m2, m1);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+
+        sha256Rounds4(&abef, &cdgh, m3, k + 44);
+        sha256Schedule(&m0, m3, m2);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+
+        sha256Rounds4(&abef, &cdgh, m0, k + 48);
+        sha256Schedule(&m1, m0, m3);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+
+        sha256Rounds4(&abef, &cdgh, m1, k + 52);
+        sha256Schedule(&m2, m1, m0);
+
+        sha256Rounds4(&abef, &cdgh, m2, k + 56);
+        sha256Schedule(&m3, m2, m1);
+
+        sha256Rounds4(&abef, &cdgh, m3, k + 60);
+
+        abef = _mm_add_epi32(abef, abefSave);
+        cdgh = _mm_add_epi32(cdgh, cdghSave);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+#endif
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to 64 times the specified
+/// `numberOfBuffers`, using only portable C++.
+void transformSha256Portable(bsl::uint32_t       *state,
+                             const unsigned char *message,
+                             bsl::uint64_t        numberOfBuffers)
+{
+    transformPortable(state, message, numberOfBuffers, 64, sha256Constants);
+}
+
+/// Alias for a function that updates the specified `state` with the hashed
+/// contents of the specified `message` having a length equal to 64 times
+/// the specified `numberOfBuffers`.
+typedef void (*Sha256TransformFn)(bsl::uint32_t       *state,
+                                  const unsigned char *message,
+                                  bsl::uint64_t        numberOfBuffers);
+
+#if defined(BDLDE_SHA2_SHANI_ENABLED) || defined(BDLDE_SHA2_AVX2_ENABLED)
+/// Return `true` if the current CPU supports the SHA extensions to the x86
+/// instruction set, and `false` otherwise.
+bool isShaNiSupported()
+{
+#ifdef BDLDE_SHA2_SHANI_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+        && (ecx & bit_SSE4_1)
+        && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        && (ebx & bit_SHA);
+#else
+    return false;
+#endif
+}
+
+#endif
+
+#ifdef BDLDE_SHA2_AVX2_ENABLED
+/// Return `true` if the current CPU and operating system support the AVX2
+/// instructions, and `false` otherwise.
+bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & bit_OSXSAVE)
+     || !(ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    // Verify that the operating system saves the 'ymm' registers.
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (0x6 != (xcr0Low & 0x6)) {
+        return false;                                                 // RETURN
+    }
+
+    return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        && (ebx & bit_AVX2);
+}
+#endif
+
+/// Return the fastest implementation of the SHA-256 block transformation
+/// supported by the current CPU.
+Sha256TransformFn sha256Transform()
+{
+    static Sha256TransformFn s_transform = 0;
+    BSLMT_ONCE_DO {
+#ifdef BDLDE_SHA2_SHANI_ENABLED
+        s_transform = isShaNiSupported() ? transformSha256ShaNi
+                                         : transformSha256Portable;
+#else
+        s_transform = transformSha256Portable;
+#endif
+    }
+    return s_transform;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, mixing it with the values in the specified
+/// `constants`.  Note that this overload, used by SHA-384 and SHA-512,
+/// always uses the portable implementation.
+template<class INTEGER, bsl::size_t ARRAY_SIZE>
+void transform(INTEGER             *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const INTEGER      (&constants)[ARRAY_SIZE])
+{
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, mixing it with the SHA-256 constants.  Note
+/// that this overload, used by SHA-224 and SHA-256, uses the fastest
+/// implementation supported by the current CPU.
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&)[64])
+{
+    BSLS_ASSERT(64 == bufferSize);
+    (void)bufferSize;
+
+    sha256Transform()(state, message, numberOfBuffers);
+}
+
+/// This `struct` tracks the progress of one message through the lanes of a
+/// multi-buffer SHA-256 computation: the message's complete 64-byte
+/// blocks are read in place, followed by one or two blocks holding the
+/// remainder of the message and the SHA-256 padding.
+struct Sha256Lane {
+
+    // DATA
+    const unsigned char *d_data_p;          // next complete block of message
+
+    bsl::size_t          d_numFullBlocks;   // complete blocks remaining
+
+    unsigned char        d_tail[128];       // final, padded, block(s)
+
+    bsl::size_t          d_numTailBlocks;   // number of blocks in 'd_tail'
+
+    bsl::size_t          d_tailIndex;       // blocks of 'd_tail' consumed
+
+    bsl::size_t          d_message;         // index of message in this lane
+
+    // MANIPULATORS
+
+    /// Prepare this lane to hash the specified `message` having the
+    /// specified `length` and the specified `index`.
+    void start(const unsigned char *message,
+               bsl::size_t          length,
+               bsl::size_t          index)
+    {
+        const bsl::size_t remainder = length % 64;
+
+        d_data_p        = message;
+        d_numFullBlocks = length / 64;
+        d_numTailBlocks = remainder + 1 + 8 <= 64 ? 1 : 2;
+        d_tailIndex     = 0;
+        d_message       = index;
+
+        bsl::memset(d_tail, 0, sizeof d_tail);
+        if (remainder) {
+            bsl::memcpy(d_tail, message + length - remainder, remainder);
+        }
+        d_tail[remainder] = 1 << 7;
+        unpack(static_cast<bsl::uint64_t>(length) * 8,
+               d_tail + d_numTailBlocks * 64 - 8);
+    }
+
+    /// Return the address of the next block of this lane's message, and
+    /// advance past it.  The behavior is undefined if `isDone()`.
+    const unsigned char *nextBlock()
+    {
+        if (d_numFullBlocks) {
+            const unsigned char *block = d_data_p;
+            d_data_p += 64;
+            --d_numFullBlocks;
+            return block;                                             // RETURN
+        }
+        return d_tail + 64 * d_tailIndex++;
+    }
+
+    // ACCESSORS
+
+    /// Return `true` if every block of this lane's message has been
+    /// returned by `nextBlock`, and `false` otherwise.
+    bool isDone() const
+    {
+        return 0 == d_numFullBlocks && d_tailIndex == d_numTailBlocks;
+    }
+};
+
+/// Load into the specified `results` the SHA-256 digests of the specified
+/// `numMessages` messages, the `i`th of which is at `messages[i]` and has
+/// `lengths[i]` bytes, one message at a time.
+void loadSha256DigestsSerially(Sha256::Sha256Digest *results,
+                               const void *const    *messages,
+                               const bsl::size_t    *lengths,
+                               bsl::size_t           numMessages)
+{
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        Sha256 hasher(messages[i], lengths[i]);
+        hasher.loadDigest(results[i]);
+    }
+}
+
+#ifdef BDLDE_SHA2_AVX2_ENABLED
+/// Return the specified `value` with each 32-bit lane rotated right by the
+/// specified `shift` bits.
+__attribute__((target("avx2")))
+inline
+__m256i rotateRight8(__m256i value, int shift)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+/// Transpose the 8x8 matrix of 32-bit words in the specified `rows`, so
+/// that on return `rows[i]` holds the `i`th word of each original row.
+__attribute__((target("avx2")))
+inline
+void transpose8x8(__m256i *rows)
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/// Update each of the 8 SHA-256 states held in the specified `state`, in
+/// which `state[w][l]` is word `w` of the state of lane `l`, with the
+/// hashed contents of the 64-byte block at `blocks[l]`, using the AVX2
+/// instructions.  The behavior is undefined unless the current CPU supports
+/// those instructions.
+__attribute__((target("avx2")))
+void transformSha256x8(bsl::uint32_t              (*state)[8],
+                       const unsigned char *const  *blocks)
+{
+    const __m256i byteSwap = _mm256_set_epi8(12, 13, 14, 15,  8,  9, 10, 11,
+                                              4,  5,  6,  7,  0,  1,  2,  3,
+                                             12, 13, 14, 15,  8,  9, 10, 11,
+                                              4,  5,  6,  7,  0,  1,  2,  3);
+
+    __m256i w[16];
+    for (int half = 0; half < 2; ++half) {
+        __m256i *rows = w + 8 * half;
+        for (int lane = 0; lane < 8; ++lane) {
+            const unsigned char *row = blocks[lane] + 32 * half;
+            rows[lane] = _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(row));
+        }
+        transpose8x8(rows);
+        for (int word = 0; word < 8; ++word) {
+            rows[word] = _mm256_shuffle_epi8(rows[word], byteSwap);
+        }
+    }
+
+    __m256i wv[8];
+    for (int word = 0; word < 8; ++word) {
+        wv[word] = _mm256_loadu_si256(
+                               reinterpret_cast<const __m256i *>(state[word]));
+    }
+
+    __m256i a = wv[0], b = wv[1], c = wv[2], d = wv[3];
+    __m256i e = wv[4], f = wv[5], g = wv[6], h = wv[7];
+
+    for (int index = 0; index < 64; ++index) {
+        __m256i& wi = w[index & 15];
+        if (16 <= index) {
+            const __m256i w2  = w[(index -  2) & 15];
+            const __m256i w15 = w[(index - 15) & 15];
+
+            const __m256i s0 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8(w15,  7),
+                                                    rotateRight8(w15, 18)),
+                                   _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8(w2, 17),
+                                                    rotateRight8(w2, 19)),
+                                   _mm256_srli_epi32(w2, 10));
+
+            wi = _mm256_add_epi32(_mm256_add_epi32(wi, s0),
+                                  _mm256_add_epi32(w[(index - 7) & 15], s1));
+        }
+
+        const __m256i sum1 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8(e,  6),
+                                                    rotateRight8(e, 11)),
+                                   rotateRight8(e, 25));
+        const __m256i ch   = _mm256_xor_si256(
+                                   _mm256_and_si256(e, _mm256_xor_si256(f, g)),
+                                   g);
+        const __m256i t1   = _mm256_add_epi32(
+               _mm256_add_epi32(_mm256_add_epi32(h, sum1), ch),
+               _mm256_add_epi32(
+                   _mm256_set1_epi32(static_cast<int>(sha256Constants[index])),
+                   wi));
+
+        const __m256i sum0 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRight8(a,  2),
+                                                    rotateRight8(a, 13)),
+                                   rotateRight8(a, 22));
+        const __m256i maj  = _mm256_or_si256(
+                                  _mm256_and_si256(a, b),
+                                  _mm256_and_si256(_mm256_or_si256(a, b), c));
+        const __m256i t2   = _mm256_add_epi32(sum0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    wv[0] = _mm256_add_epi32(wv[0], a);
+    wv[1] = _mm256_add_epi32(wv[1], b);
+    wv[2] = _mm256_add_epi32(wv[2], c);
+    wv[3] = _mm256_add_epi32(wv[3], d);
+    wv[4] = _mm256_add_epi32(wv[4], e);
+    wv[5] = _mm256_add_epi32(wv[5], f);
+    wv[6] = _mm256_add_epi32(wv[6], g);
+    wv[7] = _mm256_add_epi32(wv[7], h);
+
+    for (int word = 0; word < 8; ++word) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[word]),
+                            wv[word]);
+    }
+}
+
+/// Start the lane at the specified `lane` index of the specified `lanes`
+/// hashing the message at the specified `*nextMessage` index of the
+/// specified `messages` having the specified `lengths`, resetting column
+/// `lane` of the specified `state` to the SHA-256 initial state and
+/// incrementing `*nextMessage`; or, if `*nextMessage` equals the specified
+/// `numMessages`, mark the lane as inactive in the specified `isActive`.
+/// Update the specified `numActive` to count the active lanes.
+void startSha256Lane(Sha256Lane          *lanes,
+                     bool                *isActive,
+                     bsl::uint32_t      (*state)[8],
+                     int                  lane,
+                     bsl::size_t         *nextMessage,
+                     int                 *numActive,
+                     const void *const   *messages,
+                     const bsl::size_t   *lengths,
+                     bsl::size_t          numMessages)
+{
+    if (*nextMessage == numMessages) {
+        if (isActive[lane]) {
+            isActive[lane] = false;
+            --*numActive;
+        }
+        return;                                                       // RETURN
+    }
+
+    lanes[lane].start(
+                   static_cast<const unsigned char *>(messages[*nextMessage]),
+                   lengths[*nextMessage],
+                   *nextMessage);
+    ++*nextMessage;
+
+    for (int word = 0; word < 8; ++word) {
+        state[word][lane] = sha256InitialState[word];
+    }
+
+    if (!isActive[lane]) {
+        isActive[lane] = true;
+        ++*numActive;
+    }
+}
+
+/// Load into the specified `results` the SHA-256 digests of the specified
+/// `numMessages` messages, the `i`th of which is at `messages[i]` and has
+/// `lengths[i]` bytes, hashing up to 8 messages at a time using the AVX2
+/// instructions.  The behavior is undefined unless the current CPU supports
+/// those instructions.
+void loadSha256DigestsAvx2(Sha256::Sha256Digest *results,
+                           const void *const    *messages,
+                           const bsl::size_t    *lengths,
+                           bsl::size_t           numMessages)
+{
+    enum { k_NUM_LANES = 8 };
+
+    static const unsigned char zeroBlock[64] = {};
+
+    Sha256Lane    lanes[k_NUM_LANES];
+    bool          isActive[k_NUM_LANES];
+    bsl::uint32_t state[8][k_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    int         numActive   = 0;
+
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        isActive[lane] = false;
+        startSha256Lane(lanes, isActive, state, lane, &nextMessage,
+                         &numActive, messages, lengths, numMessages);
+    }
+
+    while (numActive) {
+        if (1 == numActive && nextMessage == numMessages) {
+            // Finish the last message in a single lane with the fastest
+            // single-buffer implementation.
+
+            int lane = 0;
+            while (!isActive[lane]) {
+                ++lane;
+            }
+
+            Sha256Lane&   last = lanes[lane];
+            bsl::uint32_t lastState[8];
+            for (int word = 0; word < 8; ++word) {
+                lastState[word] = state[word][lane];
+            }
+
+            sha256Transform()(lastState, last.d_data_p, last.d_numFullBlocks);
+            sha256Transform()(lastState,
+                              last.d_tail + 64 * last.d_tailIndex,
+                              last.d_numTailBlocks - last.d_tailIndex);
+
+            unsigned char *result = results[last.d_message];
+            for (int word = 0; word < 8; ++word) {
+                unpack(lastState[word], result + 4 * word);
+            }
+            break;
+        }
+
+        const unsigned char *blocks[k_NUM_LANES];
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            blocks[lane] = isActive[lane] ? lanes[lane].nextBlock()
+                                          : zeroBlock;
+        }
+
+        transformSha256x8(state, blocks);
+
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (!isActive[lane] || !lanes[lane].isDone()) {
+                continue;
+            }
+
+            unsigned char *result = results[lanes[lane].d_message];
+            for (int word = 0; word < 8; ++word) {
+                unpack(state[word][lane], result + 4 * word);
+            }
+
+            startSha256Lane(lanes, isActive, state, lane, &nextMessage,
+                             &numActive, messages, lengths, numMessages);
+        }
+    }
+}
+#endif
+
+/// Alias for a function that loads into the specified `results` the
+/// SHA-256 digests of the specified `numMessages` messages, the `i`th of
+/// which is at `messages[i]` and has `lengths[i]` bytes.
+typedef void (*LoadSha256DigestsFn)(Sha256::Sha256Digest *results,
+                                    const void *const    *messages,
+                                    const bsl::size_t    *lengths,
+                                    bsl::size_t           numMessages);
+
+/// Return the fastest implementation of `Sha256::loadDigests` supported by
+/// the current CPU.
+LoadSha256DigestsFn loadSha256Digests()
+{
+    static LoadSha256DigestsFn s_loadDigests = 0;
+    BSLMT_ONCE_DO {
+        // The SHA extensions hash a single message faster than the AVX2
+        // instructions hash 8, so multi-buffer hashing is used only in their
+        // absence.
+
+        s_loadDigests = loadSha256DigestsSerially;
+#ifdef BDLDE_SHA2_AVX2_ENABLED
+        if (!isShaNiSupported() && isAvx2Supported()) {
+            s_loadDigests = loadSha256DigestsAvx2;
+        }
+#endif
+    }
+    return s_loadDigests;
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize`, mixed with the data in the specified `constants`.  Update
@@ -357,6 +1014,18 @@ Sha224::Sha224(const void *data, bsl::size_t length)
     update(data, length);
 }
 
+void Sha256::loadDigests(Sha256Digest       *results,
+                         const void *const  *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    loadSha256Digests()(results, messages, lengths, numMessages);
+}
+
 Sha256::Sha256()
 {
     reset();
@@ -695,6 +1364,9 @@ bool bdlde::operator==(const Sha512& lhs, const Sha512& rhs)
 
 }  // close enterprise namespace
 
+#undef BDLDE_SHA2_SHANI_ENABLED
+#undef BDLDE_SHA2_AVX2_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
 //
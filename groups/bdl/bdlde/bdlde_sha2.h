@@ -25,6 +25,23 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Performance
+///-----------
+// On x86 processors that implement the SHA extensions, `Sha224` and `Sha256`
+// compress each 64-byte block with the dedicated SHA-256 instructions, which
+// is several times faster than the portable implementation.  When built for
+// x86-64 with GCC or Clang, the component selects, once per process, the SHA
+// implementation if the CPU reports support for the extensions, and the
+// portable implementation otherwise.  `Sha384` and `Sha512` always use the
+// portable implementation.
+//
+// `Sha256::loadDigests` computes the digests of a batch of independent
+// messages.  On processors without the SHA extensions but with AVX2 (again
+// on x86-64 with GCC or Clang), it hashes 8 messages at a time, one per
+// 32-bit lane of the vector registers, which substantially improves
+// throughput for batches of short messages.  Otherwise, it hashes the
+// messages one at a time with the fastest single-message implementation.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -209,6 +226,26 @@ class Sha256 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
 
+    /// An array of bytes holding a SHA-256 digest.
+    typedef unsigned char Sha256Digest[k_DIGEST_SIZE];
+
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-256 digests of the
+    /// specified `numMessages` messages, the `i`th of which is the range
+    /// `[messages[i], messages[i] + lengths[i])`, such that `results[i]`
+    /// holds the digest of the `i`th message.  The behavior is undefined
+    /// unless `results`, `messages`, and `lengths` each have `numMessages`
+    /// elements, each message range is valid, and `results` does not
+    /// overlap any message.  Note that the digests are identical to those
+    /// computed by `Sha256(messages[i], lengths[i]).loadDigest(results[i])`,
+    /// but independent messages may be hashed in parallel (see
+    /// {Performance}).
+    static void loadDigests(Sha256Digest       *results,
+                            const void *const  *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,9 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha256::loadDigests(Digest*, const void *const*, size_t*, n);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +139,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
+// [-1] PERFORMANCE: Sha256::loadDigests
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -509,11 +514,12 @@ int main(int argc, char *argv[])
 {
     int        test = argc > 1 ? bsl::atoi(argv[1]) : 0;
     int     verbose = argc > 2;
+    int veryVerbose = argc > 3;
 
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -535,6 +541,170 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha256::loadDigests'
+        //
+        // Concerns:
+        //: 1 The digest loaded for each message is the digest computed by a
+        //:   'Sha256' object for that message.
+        //:
+        //: 2 Each digest is written to its own slot of 'results', whatever
+        //:   the order in which the messages finish hashing.
+        //:
+        //: 3 Messages whose lengths require one or two final padding blocks,
+        //:   and empty messages, are hashed correctly.
+        //:
+        //: 4 Batches of any size, including zero, and of mixed lengths are
+        //:   supported.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Hash the FIPS-180 messages as a batch and compare each result
+        //:   with the known digest.  (C-1)
+        //:
+        //: 2 For batches of every size up to 40 (and some larger), hash
+        //:   messages of pseudo-random lengths, chosen to include every
+        //:   remainder modulo 64 and lengths spanning several blocks, and
+        //:   compare each result with the digest computed by a 'Sha256'
+        //:   object.  (C-1..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-5)
+        //
+        // Testing:
+        //   void Sha256::loadDigests(Digest*, const void *const*, size_t*, n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha256::loadDigests'" "\n"
+                          << "=============================" "\n";
+
+        typedef bdlde::Sha256::Sha256Digest Digest;
+
+        const bsl::size_t DIGEST_SIZE = bdlde::Sha256::k_DIGEST_SIZE;
+
+        if (verbose) cout << "Known digests." "\n";
+        {
+            const int NUM_MESSAGES = sizeof inputMessages
+                                   / sizeof *inputMessages;
+
+            const void  *messages[NUM_MESSAGES];
+            bsl::size_t  lengths[NUM_MESSAGES];
+            Digest       results[NUM_MESSAGES];
+
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = inputMessages[i].data();
+                lengths[i]  = inputMessages[i].size();
+            }
+
+            bdlde::Sha256::loadDigests(results,
+                                       messages,
+                                       lengths,
+                                       NUM_MESSAGES);
+
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                bsl::ostringstream stream;
+                bdlde::Sha256      expected(messages[i], lengths[i]);
+                stream << expected;
+
+                unsigned char digest[DIGEST_SIZE];
+                expected.loadDigest(digest);
+
+                ASSERTV(i, sha256Results[i] == stream.str());
+                ASSERTV(i, 0 == bsl::memcmp(digest, results[i], DIGEST_SIZE));
+            }
+        }
+
+        if (verbose) cout << "Mixed batches." "\n";
+        {
+            bsl::vector<char> data(64 * 12);
+            for (bsl::size_t i = 0; i < data.size(); ++i) {
+                data[i] = static_cast<char>(i * 131 + (i >> 7));
+            }
+
+            enum { k_MAX_BATCH_SIZE = 257 };
+
+            const int BATCH_SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 33,
+                                        100, k_MAX_BATCH_SIZE };
+            const int NUM_BATCH_SIZES = sizeof BATCH_SIZES
+                                      / sizeof *BATCH_SIZES;
+
+            unsigned int seed = 12345;
+            for (int ti = 0; ti < NUM_BATCH_SIZES + 40; ++ti) {
+                const int NUM_MESSAGES = ti < NUM_BATCH_SIZES
+                                       ? BATCH_SIZES[ti]
+                                       : ti - NUM_BATCH_SIZES;
+
+                if (veryVerbose) { T_ P(NUM_MESSAGES) }
+
+                bsl::vector<const void *> messages(NUM_MESSAGES + 1);
+                bsl::vector<bsl::size_t>  lengths(NUM_MESSAGES + 1);
+                Digest                    results[k_MAX_BATCH_SIZE + 1];
+                bsl::memset(results, 0xa5, sizeof results);
+
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    seed = seed * 1103515245 + 12345;
+
+                    // Alternate short lengths, which exercise every
+                    // remainder modulo 64, with longer ones, so that lanes
+                    // finish out of order.
+
+                    const bsl::size_t length = (seed >> 16) % 2
+                                             ? (seed >> 8) % 130
+                                             : (seed >> 8) % (64 * 11);
+                    const bsl::size_t offset = (seed >> 4)
+                                             % (data.size() - length + 1);
+
+                    messages[i] = &data[0] + offset;
+                    lengths[i]  = length;
+                }
+
+                bdlde::Sha256::loadDigests(results,
+                                           &messages[0],
+                                           &lengths[0],
+                                           NUM_MESSAGES);
+
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    Digest expected;
+                    bdlde::Sha256(messages[i], lengths[i]).loadDigest(
+                                                                    expected);
+
+                    ASSERTV(NUM_MESSAGES, i, lengths[i],
+                            0 == bsl::memcmp(expected,
+                                             results[i],
+                                             DIGEST_SIZE));
+                }
+
+                // The digest past the last message is untouched.
+
+                for (bsl::size_t j = 0; j < DIGEST_SIZE; ++j) {
+                    ASSERTV(NUM_MESSAGES, j,
+                            0xa5 == results[NUM_MESSAGES][j]);
+                }
+            }
+        }
+
+        if (verbose) cout << "Negative testing." "\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char          *message  = "abc";
+            const void          *messages[] = { message };
+            const bsl::size_t    lengths[]  = { 3 };
+            Digest               results[1];
+
+            ASSERT_PASS(bdlde::Sha256::loadDigests(results,
+                                                   messages,
+                                                   lengths,
+                                                   1));
+            ASSERT_PASS(bdlde::Sha256::loadDigests(0, 0, 0, 0));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(0, messages, lengths, 1));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(results, 0, lengths, 1));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(results, messages, 0, 1));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1254,6 +1424,73 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'Sha256::loadDigests'
+        //
+        // Concerns:
+        //: 1 Hashing a batch of short messages with 'loadDigests' is faster
+        //:   than hashing them one at a time.
+        //
+        // Plan:
+        //: 1 Time hashing a batch of messages of each of several lengths,
+        //:   first with a 'Sha256' object per message and then with
+        //:   'loadDigests', and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: Sha256::loadDigests
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: 'Sha256::loadDigests'" "\n"
+                          << "==================================" "\n";
+
+        enum { NUM_MESSAGES = 1024 };
+
+        const int NUM_ITER = 64;
+
+        const bsl::size_t LENGTHS[] = { 16, 55, 64, 256, 1024 };
+        const int         NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            bsl::vector<char>           data(NUM_MESSAGES * LENGTH, 'x');
+            bsl::vector<const void *>   messages(NUM_MESSAGES);
+            bsl::vector<bsl::size_t>    lengths(NUM_MESSAGES, LENGTH);
+            bdlde::Sha256::Sha256Digest results[NUM_MESSAGES];
+
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = &data[i * LENGTH];
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                for (int i = 0; i < NUM_MESSAGES; ++i) {
+                    bdlde::Sha256(messages[i], LENGTH).loadDigest(results[i]);
+                }
+            }
+            timer.stop();
+            const double serial = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITER; ++iter) {
+                bdlde::Sha256::loadDigests(results,
+                                           &messages[0],
+                                           &lengths[0],
+                                           NUM_MESSAGES);
+            }
+            timer.stop();
+            const double batched = timer.elapsedTime();
+
+            const double messagesHashed = 1.0 * NUM_MESSAGES * NUM_ITER;
+            cout << "length " << LENGTH
+                 << ": one at a time " << messagesHashed / serial / 1e6
+                 << " M msg/s, batched " << messagesHashed / batched / 1e6
+                 << " M msg/s" "\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -7,6 +7,8 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsla_fallthrough.h>
 #include <bsla_unused.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -17,6 +19,17 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_UTF8UTIL_LOOKUP_VALIDATION 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -212,6 +225,589 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+// The length-delimited validating, counting, and advancing functions below
+// first pass over as much of their input as can be shown to be valid a block
+// at a time, and decode code points one at a time only where a block could
+// not be shown to be valid (i.e., around an error) and in the final, partial
+// block.  On x86-64 with GCC or Clang, each block is validated in its entirety
+// with the lookup-table method of Keiser and Lemire ("Validating UTF-8 In Less
+// Than One Instruction Per Byte", 2021), which classifies each byte by looking
+// up the high and low nibbles of the preceding byte and the high nibble of the
+// byte itself in three 16-entry tables.  There is an SSE4.1 implementation of
+// that method, validating blocks of 'k_BLOCK_SIZE' bytes, and an AVX2 one,
+// validating blocks of twice that, each compiled for its instruction set with
+// a 'target' attribute regardless of the instruction set the rest of the
+// build targets, and 'skipValidBlocks' selects, once per process, the fastest
+// one the CPU supports.  On other platforms, and on CPUs supporting neither,
+// blocks consisting entirely of ASCII are passed over where SSE2 is
+// available, and 8-byte words consisting entirely of ASCII are elsewhere.
+// Blocks are only loaded when entirely within the input.
+
+enum { k_BLOCK_SIZE = 16 };
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+/// Return the number of set bits in the specified `mask`.  The behavior is
+/// undefined unless `mask < 0x10000`.
+static inline
+int numBitsSet16(unsigned int mask)
+{
+    mask =  mask - ((mask >> 1) & 0x5555u);
+    mask = (mask & 0x3333u) + ((mask >> 2) & 0x3333u);
+    mask = (mask + (mask >> 4)) & 0x0f0fu;
+    return static_cast<int>((mask + (mask >> 8)) & 0x1fu);
+}
+
+/// Return the index of the lowest set bit in the specified `mask`.  The
+/// behavior is undefined unless `0 != mask`.
+static inline
+int numTrailingUnsetBits(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int ret = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++ret;
+    }
+    return ret;
+#endif
+}
+
+/// Return the `k_BLOCK_SIZE` bytes starting at the specified `position`.
+static inline
+__m128i loadBlock(const char *position)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+}
+
+/// Return a value whose bit `i` is set if byte `i` of the specified `block`
+/// is not a UTF-8 continuation byte (i.e., begins a code point in valid
+/// UTF-8), for `i` in `[0 .. k_BLOCK_SIZE)`.
+static inline
+unsigned int nonContinuationBits(__m128i block)
+{
+    // Continuation bytes, '[0x80 .. 0xbf]', are exactly those bytes that are
+    // not greater than 0xbf when compared as signed values.
+
+    const __m128i maxContinuation = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(block, maxContinuation));
+}
+
+/// Return the address of the byte following the last code point that begins
+/// in the `k_BLOCK_SIZE` bytes preceding the specified `blockEnd`, or
+/// `blockEnd` if that code point ends within those bytes.  The behavior is
+/// undefined unless the code point beginning last in those bytes is valid
+/// UTF-8.
+static inline
+const char *endOfLastCodePoint(const char *blockEnd)
+{
+    const char *last = blockEnd - 1;
+    while (!isNotContinuation(*last) && blockEnd - k_BLOCK_SIZE < last) {
+        --last;
+    }
+
+    const char *end = last + utf8Size(*last);
+    return end < blockEnd ? blockEnd : end;
+}
+#endif
+
+#if defined(BDLDE_UTF8UTIL_LOOKUP_VALIDATION)
+namespace lookup {
+
+// Each bit below identifies a class of error (or, for 'k_TWO_CONTS', a pair of
+// continuation bytes), and each entry of the tables following has set the bits
+// of the classes to which a byte having the nibble indexing the entry may
+// contribute.  A pair of bytes is in a class if all three lookups have the
+// class's bit set.
+
+enum {
+    k_TOO_SHORT      = 1 << 0,  // 11______ 0_______
+                                // 11______ 11______
+    k_TOO_LONG       = 1 << 1,  // 0_______ 10______
+    k_OVERLONG_3     = 1 << 2,  // 11100000 100_____
+    k_TOO_LARGE      = 1 << 3,  // 11110100 1001____
+                                // 11110100 101_____
+                                // 11110101 1001____
+                                // 11110101 101_____
+                                // 1111011_ 1001____
+                                // 1111011_ 101_____
+                                // 11111___ 1001____
+                                // 11111___ 101_____
+    k_SURROGATE      = 1 << 4,  // 11101101 101_____
+    k_OVERLONG_2     = 1 << 5,  // 1100000_ 10______
+    k_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____
+                                // 1111011_ 1000____
+                                // 11111___ 1000____
+    k_OVERLONG_4     = 1 << 6,  // 11110000 1000____
+    k_TWO_CONTS      = 1 << 7,  // 10______ 10______
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS,
+    k_CONT_8         = k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                     | k_TOO_LARGE_1000 | k_OVERLONG_4,
+    k_CONT_9         = k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                     | k_TOO_LARGE,
+    k_CONT_AB        = k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE
+                     | k_TOO_LARGE
+};
+
+/// The classes to which the byte preceding another may contribute, indexed by
+/// its high nibble.
+static const unsigned char k_BYTE1_HIGH[16] = {
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,
+    k_TOO_SHORT | k_OVERLONG_2,
+    k_TOO_SHORT,
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+};
+
+/// The classes to which the byte preceding another may contribute, indexed by
+/// its low nibble.
+static const unsigned char k_BYTE1_LOW[16] = {
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+    k_CARRY | k_OVERLONG_2,
+    k_CARRY,
+    k_CARRY,
+    k_CARRY | k_TOO_LARGE,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000
+};
+
+/// The classes to which the byte following another may contribute, indexed by
+/// its high nibble.
+static const unsigned char k_BYTE2_HIGH[16] = {
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_CONT_8, k_CONT_9, k_CONT_AB, k_CONT_AB,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+};
+
+}  // close namespace lookup
+
+/// Return the 16 entries of the specified `table`.
+static inline
+__m128i loadTable(const unsigned char *table)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+}
+
+/// Return a block having a non-zero byte for each byte of the specified
+/// `input` block that is not valid in its position in UTF-8, given that the
+/// specified `previous` block immediately precedes it, and having only zero
+/// bytes otherwise.  Each byte whose validity depends on bytes preceding it
+/// is checked against those bytes (in `input` or in `previous`); the last
+/// code point beginning in `input` is not checked for truncation.
+__attribute__((target("sse4.1")))
+static inline
+__m128i findErrorsSse41(__m128i input, __m128i previous)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i special = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(loadTable(lookup::k_BYTE1_HIGH),
+                             _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+            _mm_shuffle_epi8(loadTable(lookup::k_BYTE1_LOW),
+                             _mm_and_si128(prev1, nibble))),
+        _mm_shuffle_epi8(loadTable(lookup::k_BYTE2_HIGH),
+                         _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+
+    // A byte must be a continuation byte following another continuation byte
+    // (i.e., have 'k_TWO_CONTS' set in 'special') exactly when the byte two
+    // before it is '111_____' or the byte three before it is '1111____'.
+
+    const __m128i mustBe23Continuation = _mm_and_si128(
+        _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80)),
+                     _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80))),
+        _mm_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm_xor_si128(mustBe23Continuation, special);
+}
+
+/// Return a block having a non-zero byte for each byte of the specified
+/// `input` block that is not valid in its position in UTF-8, given that the
+/// specified `previous` block immediately precedes it, and having only zero
+/// bytes otherwise.  Each byte whose validity depends on bytes preceding it
+/// is checked against those bytes (in `input` or in `previous`); the last
+/// code point beginning in `input` is not checked for truncation.
+__attribute__((target("avx2")))
+static inline
+__m256i findErrorsAvx2(__m256i input, __m256i previous)
+{
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+    // '_mm256_alignr_epi8' shifts each 128-bit lane separately, so the bytes
+    // preceding the low lane of 'input' are taken from the high lane of
+    // 'previous', and those preceding its high lane from its low lane.
+
+    const __m256i carried = _mm256_permute2x128_si256(previous, input, 0x21);
+
+    const __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+    const __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+
+    const __m256i byte1High = _mm256_broadcastsi128_si256(
+                                             loadTable(lookup::k_BYTE1_HIGH));
+    const __m256i byte1Low  = _mm256_broadcastsi128_si256(
+                                              loadTable(lookup::k_BYTE1_LOW));
+    const __m256i byte2High = _mm256_broadcastsi128_si256(
+                                             loadTable(lookup::k_BYTE2_HIGH));
+
+    const __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(
+                           byte1High,
+                           _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                            nibble)),
+            _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, nibble))),
+        _mm256_shuffle_epi8(byte2High,
+                            _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                             nibble)));
+
+    const __m256i mustBe23Continuation = _mm256_and_si256(
+        _mm256_or_si256(
+                      _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80)),
+                      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80))),
+        _mm256_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm256_xor_si256(mustBe23Continuation, special);
+}
+#endif
+
+/// Alias for a function that implements `skipValidBlocks` (below).
+typedef const char *(*SkipValidBlocksFn)(
+                                          bsls::Types::IntPtr *numCodePoints,
+                                          const char          *begin,
+                                          const char          *end);
+
+/// Load into the specified `numCodePoints` the number of Unicode code points
+/// in the range `[begin, result)`, where `result` is the returned address, and
+/// `[begin, result)` is the longest range consisting entirely of ASCII that
+/// this function can establish, examining the specified range `[begin, end)`
+/// a block of `k_BLOCK_SIZE` bytes (or, without SSE2, a word) at a time.  The
+/// behavior is undefined unless `begin <= end`.
+static
+const char *skipAsciiBlocks(bsls::Types::IntPtr *numCodePoints,
+                            const char          *begin,
+                            const char          *end)
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const char *pc = begin;
+
+    while (end - pc >= k_BLOCK_SIZE) {
+        const unsigned int nonAscii = _mm_movemask_epi8(loadBlock(pc));
+        if (nonAscii) {
+            pc += numTrailingUnsetBits(nonAscii);
+            break;
+        }
+        pc += k_BLOCK_SIZE;
+    }
+
+    *numCodePoints = pc - begin;
+    return pc;
+#else
+    enum { k_WORD_SIZE = sizeof(bsls::Types::Uint64) };
+
+    const bsls::Types::Uint64 k_HIGH_BITS = 0x8080808080808080ULL;
+
+    const char *pc = begin;
+
+    while (end - pc >= k_WORD_SIZE) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, pc, k_WORD_SIZE);
+        if (word & k_HIGH_BITS) {
+            break;
+        }
+        pc += k_WORD_SIZE;
+    }
+
+    *numCodePoints = pc - begin;
+    return pc;
+#endif
+}
+
+#if defined(BDLDE_UTF8UTIL_LOOKUP_VALIDATION)
+/// Load into the specified `numCodePoints` the number of Unicode code points
+/// in the range `[begin, result)`, where `result` is the returned address, and
+/// `[begin, result)` is the longest range of complete, valid UTF-8 code points
+/// that this function can establish, examining the specified range
+/// `[begin, end)` a block of `k_BLOCK_SIZE` bytes at a time.  The behavior is
+/// undefined unless `begin <= end`, `begin` is the first byte of a code point
+/// (or `end`), and the CPU supports SSE4.1.
+__attribute__((target("sse4.1")))
+static
+const char *skipValidBlocksSse41(bsls::Types::IntPtr *numCodePoints,
+                                 const char          *begin,
+                                 const char          *end)
+{
+    // A block ends with an incomplete code point if its last byte is
+    // '11______', its second-last is '111_____', or its third-last is
+    // '1111____', i.e., if any byte exceeds the corresponding byte of
+    // 'maxComplete'.
+
+    const __m128i maxComplete = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1,
+                                              static_cast<char>(0xef),
+                                              static_cast<char>(0xdf),
+                                              static_cast<char>(0xbf));
+
+    const char          *pc         = begin;
+    bsls::Types::IntPtr  numBegun   = 0;  // code points begun before 'pc'
+    __m128i              previous   = _mm_setzero_si128();
+    __m128i              incomplete = _mm_setzero_si128();
+
+    for (; end - pc >= k_BLOCK_SIZE; pc += k_BLOCK_SIZE) {
+        const __m128i input = loadBlock(pc);
+
+        if (0 == _mm_movemask_epi8(input)) {
+            // An ASCII block is valid unless the preceding block ends with an
+            // incomplete code point.
+
+            if (!_mm_testz_si128(incomplete, incomplete)) {
+                break;
+            }
+            numBegun   += k_BLOCK_SIZE;
+            incomplete  = _mm_setzero_si128();
+        }
+        else {
+            const __m128i errors = findErrorsSse41(input, previous);
+            if (!_mm_testz_si128(errors, errors)) {
+                break;
+            }
+            numBegun   += numBitsSet16(nonContinuationBits(input));
+            incomplete  = _mm_subs_epu8(input, maxComplete);
+        }
+        previous = input;
+    }
+
+    if (_mm_testz_si128(incomplete, incomplete)) {
+        *numCodePoints = numBegun;
+        return pc;                                                    // RETURN
+    }
+
+    // Stop before the incomplete code point, which begins in the last 3 bytes
+    // of the last valid block.
+
+    const char *last = pc - 1;
+    while (!isNotContinuation(*last)) {
+        --last;
+    }
+
+    *numCodePoints = numBegun - 1;
+    return last;
+}
+
+/// Load into the specified `numCodePoints` the number of Unicode code points
+/// in the range `[begin, result)`, where `result` is the returned address, and
+/// `[begin, result)` is the longest range of complete, valid UTF-8 code points
+/// that this function can establish, examining the specified range
+/// `[begin, end)` a block of `2 * k_BLOCK_SIZE` bytes at a time, and what
+/// remains of it a block of `k_BLOCK_SIZE` bytes at a time.  The behavior is
+/// undefined unless `begin <= end`, `begin` is the first byte of a code point
+/// (or `end`), and the CPU supports AVX2.
+__attribute__((target("avx2")))
+static
+const char *skipValidBlocksAvx2(bsls::Types::IntPtr *numCodePoints,
+                                const char          *begin,
+                                const char          *end)
+{
+    enum { k_AVX2_BLOCK_SIZE = 2 * k_BLOCK_SIZE };
+
+    const __m256i maxComplete = _mm256_setr_epi8(
+                                     -1, -1, -1, -1, -1, -1, -1, -1,
+                                     -1, -1, -1, -1, -1, -1, -1, -1,
+                                     -1, -1, -1, -1, -1, -1, -1, -1,
+                                     -1, -1, -1, -1, -1,
+                                     static_cast<char>(0xef),
+                                     static_cast<char>(0xdf),
+                                     static_cast<char>(0xbf));
+
+    const __m256i maxContinuation = _mm256_set1_epi8(static_cast<char>(0xbf));
+
+    const char          *pc         = begin;
+    bsls::Types::IntPtr  numBegun   = 0;  // code points begun before 'pc'
+    __m256i              previous   = _mm256_setzero_si256();
+    __m256i              incomplete = _mm256_setzero_si256();
+
+    for (; end - pc >= k_AVX2_BLOCK_SIZE; pc += k_AVX2_BLOCK_SIZE) {
+        const __m256i input = _mm256_loadu_si256(
+                                      reinterpret_cast<const __m256i *>(pc));
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            if (!_mm256_testz_si256(incomplete, incomplete)) {
+                break;
+            }
+            numBegun   += k_AVX2_BLOCK_SIZE;
+            incomplete  = _mm256_setzero_si256();
+        }
+        else {
+            const __m256i errors = findErrorsAvx2(input, previous);
+            if (!_mm256_testz_si256(errors, errors)) {
+                break;
+            }
+
+            // Bytes not greater than 0xbf when compared as signed values are
+            // continuation bytes.
+
+            numBegun   += __builtin_popcount(static_cast<unsigned int>(
+                  _mm256_movemask_epi8(_mm256_cmpgt_epi8(input,
+                                                         maxContinuation))));
+            incomplete  = _mm256_subs_epu8(input, maxComplete);
+        }
+        previous = input;
+    }
+
+    if (_mm256_testz_si256(incomplete, incomplete)) {
+        if (end - pc < k_AVX2_BLOCK_SIZE) {
+            // All of the blocks were valid, and 'pc' begins a code point, so
+            // the last, shorter block may still be validated.
+
+            bsls::Types::IntPtr  numRemaining;
+            const char          *ret = skipValidBlocksSse41(&numRemaining,
+                                                            pc,
+                                                            end);
+            *numCodePoints = numBegun + numRemaining;
+            return ret;                                               // RETURN
+        }
+        *numCodePoints = numBegun;
+        return pc;                                                    // RETURN
+    }
+
+    const char *last = pc - 1;
+    while (!isNotContinuation(*last)) {
+        --last;
+    }
+
+    *numCodePoints = numBegun - 1;
+    return last;
+}
+
+/// Return `true` if the current CPU and operating system support the AVX2
+/// instructions, and `false` otherwise.
+static
+bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & bit_OSXSAVE)
+     || !(ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    // Verify that the operating system saves the 'ymm' registers.
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (0x6 != (xcr0Low & 0x6)) {
+        return false;                                                 // RETURN
+    }
+
+    return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        && (ebx & bit_AVX2);
+}
+
+/// Return the implementation of `skipValidBlocks` best suited to the current
+/// CPU.
+static
+SkipValidBlocksFn selectSkipValidBlocks()
+{
+    if (isAvx2Supported()) {
+        return &skipValidBlocksAvx2;                                  // RETURN
+    }
+
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1)) {
+        return &skipValidBlocksSse41;                                 // RETURN
+    }
+
+    return &skipAsciiBlocks;
+}
+#endif
+
+/// Load into the specified `numCodePoints` the number of Unicode code points
+/// in the range `[begin, result)`, where `result` is the returned address, and
+/// `[begin, result)` is the longest range of complete, valid UTF-8 code points
+/// that this function can establish, examining the specified range
+/// `[begin, end)` a block at a time.  The behavior is undefined unless
+/// `begin <= end` and `begin` is the first byte of a code point (or `end`).
+/// Note that the returned address may be `begin`, and that the bytes at and
+/// after it remain to be examined one code point at a time.
+static
+const char *skipValidBlocks(bsls::Types::IntPtr *numCodePoints,
+                            const char          *begin,
+                            const char          *end)
+{
+    BSLS_ASSERT_SAFE(numCodePoints);
+    BSLS_ASSERT_SAFE(begin <= end);
+
+#if defined(BDLDE_UTF8UTIL_LOOKUP_VALIDATION)
+    static SkipValidBlocksFn s_skipValidBlocks = 0;
+    BSLMT_ONCE_DO {
+        s_skipValidBlocks = selectSkipValidBlocks();
+    }
+    return s_skipValidBlocks(numCodePoints, begin, end);
+#else
+    return skipAsciiBlocks(numCodePoints, begin, end);
+#endif
+}
+
+/// Load into the specified `numCodePoints` the number of Unicode code points
+/// in the range `[begin, result)`, where `result` is the returned address, and
+/// `[begin, result)` is the longest range of complete, valid UTF-8 code
+/// points, numbering no more than the specified `maxNumCodePoints`, that this
+/// function can establish, examining the specified range `[begin, end)` a
+/// block at a time.  The behavior is undefined unless `begin <= end`, `begin`
+/// is the first byte of a code point (or `end`), and `0 <= maxNumCodePoints`.
+static
+const char *skipValidBlocks(bsls::Types::IntPtr *numCodePoints,
+                            const char          *begin,
+                            const char          *end,
+                            bsls::Types::IntPtr  maxNumCodePoints)
+{
+    BSLS_ASSERT_SAFE(numCodePoints);
+    BSLS_ASSERT_SAFE(0 <= maxNumCodePoints);
+
+    // No more bytes are examined than code points remain, so that no more
+    // than 'maxNumCodePoints' code points can be passed over.
+
+    bsls::Types::IntPtr count = 0;
+
+    while (count < maxNumCodePoints) {
+        const bsls::Types::IntPtr remaining = maxNumCodePoints - count;
+        const char *const         limit     = end - begin > remaining
+                                            ? begin + remaining
+                                            : end;
+
+        bsls::Types::IntPtr  numSkipped;
+        const char          *next = skipValidBlocks(&numSkipped, begin, limit);
+        if (next == begin) {
+            break;
+        }
+        begin  = next;
+        count += numSkipped;
+    }
+
+    *numCodePoints = count;
+    return begin;
+}
+
 /// Return the number of Unicode code points in the specified `string` if it
 /// contains valid UTF-8, with no effect on the specified `invalidString`.
 /// Otherwise, return a negative value and load into `invalidString` the
@@ -375,10 +971,13 @@ static int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
-    const char       *pc     = string;
-    const char *const pcEnd4 = string + length - 4;
+    const char *const end    = string + length;
+    const char *const pcEnd4 = end - 4;
 
-    int count = 0;
+    bsls::Types::IntPtr numSkipped;
+
+    const char *pc    = skipValidBlocks(&numSkipped, string, end);
+    int         count = static_cast<int>(numSkipped);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -390,7 +989,11 @@ static int validateAndCountCodePoints(const char             **invalidString,
           case 0x5: BSLA_FALLTHROUGH;
           case 0x6: BSLA_FALLTHROUGH;
           case 0x7: {
-            ++pc;
+            // Resume passing over the input a block at a time, as the valid
+            // input may continue beyond this ASCII byte.
+
+            pc     = skipValidBlocks(&numSkipped, pc + 1, end);
+            count += static_cast<int>(numSkipped);
           } break;
           case 0x8: BSLA_FALLTHROUGH;
           case 0x9: BSLA_FALLTHROUGH;
@@ -934,6 +1537,11 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
     IntPtr  ret = 0;      // return value -- number of code points advanced
     const char * const endOfInput = string + length;
 
+    IntPtr numSkipped;
+
+    string  = skipValidBlocks(&numSkipped, string, endOfInput, numCodePoints);
+    ret    += numSkipped;
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
@@ -968,6 +1576,17 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
         }
         string += cpStatus;
         ++ret;
+
+        if (1 == cpStatus) {
+            // Resume passing over the input a block at a time, as the valid
+            // input may continue beyond this ASCII byte.
+
+            string  = skipValidBlocks(&numSkipped,
+                                      string,
+                                      endOfInput,
+                                      numCodePoints - ret);
+            ret    += numSkipped;
+        }
     }
 
     *result = string;
@@ -1071,6 +1690,33 @@ Utf8Util::IntPtr Utf8Util::advanceRaw(const char **result,
 
     const char * const endOfInput = string + length;
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Pass over blocks beginning no more code points than remain to be
+    // advanced over, and stop at the beginning of the first code point not to
+    // be advanced over if it is found in a block.
+
+    while (endOfInput - string >= k_BLOCK_SIZE && ret < numCodePoints) {
+        unsigned int begun    = nonContinuationBits(loadBlock(string));
+        const int    numBegun = numBitsSet16(begun);
+
+        if (numCodePoints - ret <= numBegun) {
+            // The last code point to be advanced over begins in this block.
+
+            for (IntPtr ii = numCodePoints - ret - 1; 0 < ii; --ii) {
+                begun &= begun - 1;
+            }
+
+            const char *last = string + numTrailingUnsetBits(begun);
+
+            *result = last + utf8Size(*last);
+            return numCodePoints;                                     // RETURN
+        }
+
+        ret    += numBegun;
+        string  = endOfLastCodePoint(string + k_BLOCK_SIZE);
+    }
+#endif
+
     for (; true; ++ret) {
         // There's a 'break' at the end of this loop, so any case in the switch
         // that leaves without doing a 'continue' will exit the loop.
@@ -1519,6 +2165,28 @@ Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string,
 
     const char *const end = string + length;
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Count the bytes that begin code points a block at a time, accumulating
+    // per-byte counts over at most 255 blocks at a time before summing them.
+
+    const __m128i maxContinuation = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    while (end - string >= k_BLOCK_SIZE) {
+        __m128i counts = _mm_setzero_si128();
+
+        for (int ii = 0; ii < 255 && end - string >= k_BLOCK_SIZE; ++ii) {
+            counts  = _mm_sub_epi8(counts,
+                                   _mm_cmpgt_epi8(loadBlock(string),
+                                                  maxContinuation));
+            string += k_BLOCK_SIZE;
+        }
+
+        const __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count  += _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+        string  = endOfLastCodePoint(string);
+    }
+#endif
+
     while (string < end) {
         switch (static_cast<unsigned char>(*string) >> 4) {
           case 0: BSLA_FALLTHROUGH;
@@ -1776,6 +2444,8 @@ const char *Utf8Util::toAscii(IntPtr value)
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_UTF8UTIL_LOOKUP_VALIDATION
+
 // ----------------------------------------------------------------------------
 // Copyright 2015 Bloomberg Finance L.P.
 //
@@ -67,6 +67,22 @@ BSLS_IDENT("$Id: $")
 // counterpart that takes a lone pointer to a null-terminated (C-style) string.
 // The behavior is always undefined if 0 is supplied for that lone pointer.
 //
+///Performance
+///-----------
+// The functions taking input as a `(pointer, length)` pair (or a
+// `bsl::string_view`) that validate, count, or advance over code points
+// examine their input a block of 16 or 32 bytes at a time where possible, and
+// decode code points one at a time only around invalid input and in the last
+// few bytes of the input.  On x86-64 with GCC or Clang, validation is
+// vectorized for all input, using AVX2 or SSE4.1, whichever the CPU is found
+// to support at run time, regardless of the instruction set targeted by the
+// build; elsewhere, runs of ASCII are passed over a block at a time.  Where
+// SSE2 is enabled, `numCodePointsRaw` and `advanceRaw` are vectorized for all
+// input.  Mostly-ASCII input therefore benefits the most on every platform.
+// The functions taking a lone pointer to a null-terminated string decode one
+// code point at a time, as they may not read beyond the null terminator;
+// prefer the `(pointer, length)` overloads when the length is known.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
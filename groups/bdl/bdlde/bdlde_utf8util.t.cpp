@@ -161,11 +161,13 @@ using bsl::size_t;
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
 // [14] NEGATIVE TESTING
-// [18] USAGE EXAMPLE 1
-// [19] USAGE EXAMPLE 2
-// [20] USAGE EXAMPLE 3
+// [18] BLOCK-WISE SCANNING
+// [19] USAGE EXAMPLE 1
+// [20] USAGE EXAMPLE 2
+// [21] USAGE EXAMPLE 3
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE TEST
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
 // ----------------------------------------------------------------------------
@@ -3562,7 +3564,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
         //
@@ -3644,7 +3646,7 @@ int main(int argc, char *argv[])
         ASSERT(out.length() == validLen);
         ASSERT(validChineseUtf8 == out);
       } break;
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -3757,7 +3759,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3877,6 +3879,206 @@ int main(int argc, char *argv[])
     ASSERT(invalidPosition == stringWithOverlong.data() + string.length());
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE SCANNING
+        //
+        // Concerns:
+        //: 1 The functions taking a length, which examine their input a block
+        //:   of bytes at a time where possible, return the same results as
+        //:   decoding the input one code point at a time, for valid input and
+        //:   for input having an error anywhere, in particular before,
+        //:   within, and after a block boundary.
+        //:
+        //: 2 Multi-byte code points straddling block boundaries, and runs of
+        //:   ASCII of all lengths, are handled correctly.
+        //:
+        //: 3 'advanceIfValid' and 'advanceRaw' do not advance beyond the
+        //:   specified number of code points, however much valid input
+        //:   follows.
+        //
+        // Plan:
+        //: 1 Generate random strings of random lengths, mixing runs of ASCII
+        //:   with multi-byte code points, and, for most, insert one of a
+        //:   table of invalid sequences at a random position or truncate the
+        //:   string at a random position.
+        //:
+        //: 2 Establish the expected results by decoding each string one code
+        //:   point at a time with 'isValidCodePoint', and compare the results
+        //:   of 'isValid', 'numCodePointsIfValid', and 'numCodePointsRaw' to
+        //:   them, with the string copied to several offsets in a buffer that
+        //:   ends with the string.  (C-1..2)
+        //:
+        //: 3 Advance over a number of code points near, at, and beyond each of
+        //:   the number of valid code points and the block size with
+        //:   'advanceIfValid' and (for valid strings) 'advanceRaw', and
+        //:   compare the results to the expected positions.  (C-3)
+        //
+        // Testing:
+        //   BLOCK-WISE SCANNING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BLOCK-WISE SCANNING\n"
+                             "===================\n";
+
+        static const struct {
+            const char *d_sequence;
+            int         d_length;
+        } INVALID[] = {
+            { "\x80",             1 },   // unexpected continuation
+            { "\xbf",             1 },
+            { "\xc0\x80",         2 },   // overlong
+            { "\xc1\xbf",         2 },
+            { "\xe0\x80\x80",     3 },
+            { "\xe0\x9f\xbf",     3 },
+            { "\xf0\x80\x80\x80", 4 },
+            { "\xf0\x8f\xbf\xbf", 4 },
+            { "\xed\xa0\x80",     3 },   // surrogate
+            { "\xed\xbf\xbf",     3 },
+            { "\xf4\x90\x80\x80", 4 },   // larger than 0x10ffff
+            { "\xf5\x80\x80\x80", 4 },
+            { "\xf8\x80\x80\x80", 4 },   // invalid initial octet
+            { "\xff",             1 },
+            { "\xc2",             1 },   // truncated, followed by any byte
+            { "\xe2\x82",         2 },
+            { "\xf0\x9f\x98",     3 },
+            { "\xc2\x41",         2 },   // non-continuation octet
+            { "\xe2\x41\x82",     3 },
+            { "\xf0\x9f\x41\x80", 4 },
+        };
+        const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+        const int OFFSETS[]   = { 0, 1, 7, 15 };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        for (int ti = 0; ti < 3000; ++ti) {
+            bsl::string str;
+
+            const int numItems = u::randUnsigned() % 100;
+            for (int ii = 0; ii < numItems; ++ii) {
+                if (0 == u::randUnsigned() % 3) {
+                    for (int jj = u::randUnsigned() % 40; 0 < jj; --jj) {
+                        u::appendRand1Byte(&str);
+                    }
+                }
+                else {
+                    u::appendRandCorrectCodePoint(&str, ti & 1);
+                }
+            }
+
+            const bsl::size_t position =
+                                      u::randUnsigned() % (str.length() + 1);
+
+            switch (ti % 3) {
+              case 0: {
+                // Leave the string valid.
+              } break;
+              case 1: {
+                const int ii = u::randUnsigned() % NUM_INVALID;
+                str.insert(position,
+                           INVALID[ii].d_sequence,
+                           INVALID[ii].d_length);
+              } break;
+              case 2: {
+                str.resize(position);
+              } break;
+            }
+
+            const bsl::size_t LENGTH = str.length();
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int OFFSET = OFFSETS[oi];
+
+                bsl::vector<char> buffer(OFFSET + LENGTH);
+                bsl::copy(str.begin(), str.end(), buffer.begin() + OFFSET);
+
+                const char *const BEGIN = buffer.data() + OFFSET;
+                const char *const END   = BEGIN + LENGTH;
+
+                // Decode one code point at a time, recording the beginning of
+                // each valid code point and the end of the last.
+
+                bsl::vector<const char *> starts(1, BEGIN);
+                int                       status = 0;
+
+                for (const char *pc = BEGIN; pc < END; ) {
+                    int sts;
+                    if (!Obj::isValidCodePoint(&sts, pc, END - pc)) {
+                        status = sts;
+                        break;
+                    }
+                    pc += sts;
+                    starts.push_back(pc);
+                }
+
+                const IntPtr      NUM_VALID = starts.size() - 1;
+                const char *const LAST      = starts.back();
+
+                if (veryVerbose) { T_ P_(ti) P_(OFFSET) P_(LENGTH) P(status) }
+
+                const char *invalid = 0;
+                IntPtr      rc      = Obj::numCodePointsIfValid(&invalid,
+                                                                BEGIN,
+                                                                LENGTH);
+                if (0 == status) {
+                    ASSERTV(ti, OFFSET, NUM_VALID, rc, NUM_VALID == rc);
+                    ASSERTV(ti, OFFSET, 0 == invalid);
+                    ASSERTV(ti, OFFSET, Obj::isValid(BEGIN, LENGTH));
+                    ASSERTV(ti, OFFSET, NUM_VALID ==
+                                           Obj::numCodePointsRaw(BEGIN,
+                                                                 LENGTH));
+                }
+                else {
+                    ASSERTV(ti, OFFSET, status, rc, status == rc);
+                    ASSERTV(ti, OFFSET, LAST - BEGIN, invalid - BEGIN,
+                            LAST == invalid);
+
+                    invalid = 0;
+                    ASSERTV(ti, OFFSET, !Obj::isValid(&invalid,
+                                                      BEGIN,
+                                                      LENGTH));
+                    ASSERTV(ti, OFFSET, LAST == invalid);
+                }
+
+                const IntPtr COUNTS[] = { 0, 1, 15, 16, 17, NUM_VALID / 2,
+                                          NUM_VALID - 1, NUM_VALID,
+                                          NUM_VALID + 1 };
+                const int    NUM_COUNTS = sizeof COUNTS / sizeof *COUNTS;
+
+                for (int ci = 0; ci < NUM_COUNTS; ++ci) {
+                    const IntPtr COUNT = COUNTS[ci];
+                    if (COUNT < 0) {
+                        continue;
+                    }
+
+                    const IntPtr EXP = bsl::min(COUNT, NUM_VALID);
+
+                    int         sts    = -99;
+                    const char *result = 0;
+
+                    rc = Obj::advanceIfValid(&sts,
+                                             &result,
+                                             BEGIN,
+                                             LENGTH,
+                                             COUNT);
+                    ASSERTV(ti, OFFSET, COUNT, EXP, rc, EXP == rc);
+                    ASSERTV(ti, OFFSET, COUNT, starts[EXP] == result);
+                    ASSERTV(ti, OFFSET, COUNT, sts,
+                            (COUNT <= NUM_VALID ? 0 : status) == sts);
+
+                    if (0 == status) {
+                        result = 0;
+                        rc     = Obj::advanceRaw(&result,
+                                                 BEGIN,
+                                                 LENGTH,
+                                                 COUNT);
+                        ASSERTV(ti, OFFSET, COUNT, EXP, rc, EXP == rc);
+                        ASSERTV(ti, OFFSET, COUNT, starts[EXP] == result);
+                    }
+                }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING: 'isValidCodePoint'
@@ -7583,6 +7785,111 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of the functions taking a length that
+        //:   validate, count, and advance over code points, for input of
+        //:   ASCII, mostly ASCII, and multi-byte code points.
+        //
+        // Plan:
+        //: 1 Time each function over 64 KiB of each kind of input, and report
+        //:   the throughput in MB/s.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST\n"
+                               "================\n";
+
+        enum { k_LENGTH = 64 * 1024, k_NUM_ITERATIONS = 2000 };
+
+        const char *const NAMES[] = { "ASCII", "95% ASCII", "2-byte",
+                                      "3-byte", "1- to 4-byte" };
+
+        for (int ti = 0; ti < 5; ++ti) {
+            bsl::string str;
+            while (str.length() < k_LENGTH) {
+                switch (ti) {
+                  case 0: {
+                    u::appendRand1Byte(&str);
+                  } break;
+                  case 1: {
+                    u::appendRandCorrectCodePoint(
+                                         &str,
+                                         false,
+                                         0 == u::randUnsigned() % 20 ? 2 : 1);
+                  } break;
+                  case 2: {
+                    u::appendRand2Byte(&str);
+                  } break;
+                  case 3: {
+                    u::appendRand3Byte(&str);
+                  } break;
+                  case 4: {
+                    u::appendRandCorrectCodePoint(&str, false);
+                  } break;
+                }
+            }
+
+            const char        *data   = str.data();
+            const bsl::size_t  length = str.length();
+
+            cout << NAMES[ti] << ":\n";
+
+            for (int fi = 0; fi < 4; ++fi) {
+                static const char *const FUNCTIONS[] = {
+                    "numCodePointsIfValid", "numCodePointsRaw",
+                    "advanceIfValid",       "advanceRaw" };
+
+                IntPtr sum = 0;
+
+                const bsls::TimeInterval start =
+                                       bsls::SystemTime::nowMonotonicClock();
+
+                for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+                    const char *result;
+                    int         status;
+
+                    switch (fi) {
+                      case 0: {
+                        sum += Obj::numCodePointsIfValid(&result,
+                                                         data,
+                                                         length);
+                      } break;
+                      case 1: {
+                        sum += Obj::numCodePointsRaw(data, length);
+                      } break;
+                      case 2: {
+                        sum += Obj::advanceIfValid(&status,
+                                                   &result,
+                                                   data,
+                                                   length,
+                                                   length);
+                      } break;
+                      case 3: {
+                        sum += Obj::advanceRaw(&result, data, length, length);
+                      } break;
+                    }
+                }
+
+                const double seconds =
+                      (bsls::SystemTime::nowMonotonicClock() - start)
+                                                      .totalSecondsAsDouble();
+
+                ASSERT(sum == k_NUM_ITERATIONS *
+                                       Obj::numCodePointsRaw(data, length));
+
+                cout << "\t" << FUNCTIONS[fi] << ": "
+                     << static_cast<double>(length) * k_NUM_ITERATIONS
+                                                              / seconds / 1e6
+                     << " MB/s\n";
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
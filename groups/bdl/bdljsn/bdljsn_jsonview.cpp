@@ -0,0 +1,593 @@
+// bdljsn_jsonview.cpp                                                -*-C++-*-
+#include <bdljsn_jsonview.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_jsonview_cpp, "$Id$ $CSID$")
+
+#include <bdljsn_error.h>
+#include <bdljsn_location.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_reader_scanutil.h>
+#include <bdljsn_stringutil.h>
+
+#include <bdlde_utf8util.h>
+#include <bdlma_localsequentialallocator.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_climits.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The parser below accepts the same language as `bdljsn::JsonUtil::read`
+// (which uses a `bdljsn::Tokenizer` in strict conformance mode):
+//
+// * The whole input must be valid UTF-8, which is checked up front.
+// * Whitespace is any of ' ', '\t', '\n', '\v', and '\r'.
+// * A scalar that is not a string extends to the next whitespace (including
+//   '\f') or structural character, and must then be `true`, `false`, `null`,
+//   or a valid number (see `bdljsn::NumberUtil::isValidNumber`).
+// * Escape sequences must be valid, as checked by
+//   `bdljsn::StringUtil::readString`; in particular a `\u` escape sequence
+//   encoding a surrogate must be part of a surrogate pair.
+// * Nesting of arrays and objects is limited to `ReadOptions::maxNestedDepth`
+//   levels.
+//
+// The syntax of escape sequences is checked during parsing, but the code
+// points they represent are only decoded by `JsonView::loadString`.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+typedef Reader_ScanUtil ScanUtil;
+
+                               // ============
+                               // class Parser
+                               // ============
+
+/// This class implements a recursive descent parser appending the nodes
+/// representing a JSON text to a tape.
+class Parser {
+
+    // PRIVATE TYPES
+    typedef bsl::vector<JsonView_Node> Tape;
+
+    // DATA
+    Tape       *d_tape_p;   // tape being appended to (held, not owned)
+    Error      *d_error_p;  // error description (held, not owned)
+    const char *d_begin_p;  // start of the input
+    const char *d_end_p;    // end of the input
+    const char *d_cursor_p; // next character to parse
+
+    // PRIVATE MANIPULATORS
+
+    /// Append to the tape a node having the specified `flags`, `length`,
+    /// and `value`, and return its index.
+    bsl::size_t appendNode(unsigned int        flags,
+                           unsigned int        length,
+                           bsls::Types::Uint64 value);
+
+    /// Complete the array or object represented by the node at the
+    /// specified `index`, having the specified `size` elements or members.
+    /// Return 0 on success, and a non-zero value if `size` is too large.
+    int closeContainer(bsl::size_t index, bsl::size_t size);
+
+    /// Load the error description with the specified `message` and the
+    /// current position, and return the specified `status`.
+    int fail(const char *message, int status = -1);
+
+    /// Parse an array (whose `[` is at the cursor), allowing the specified
+    /// `maxNestedDepth` further levels of nesting for its elements.
+    int parseArray(int maxNestedDepth);
+
+    /// Parse an object (whose `{` is at the cursor), allowing the specified
+    /// `maxNestedDepth` further levels of nesting for its members' values.
+    int parseObject(int maxNestedDepth);
+
+    /// Parse a scalar other than a string starting at the cursor.
+    int parseScalar();
+
+    /// Parse a string (whose opening quote is at the cursor).
+    int parseString();
+
+    /// Advance the cursor past any whitespace.
+    void skipWhitespace();
+
+  public:
+    // CREATORS
+
+    /// Create a parser appending to the specified `tape` the nodes
+    /// representing the specified `input`, and loading the specified
+    /// `error` with a description of any error.
+    Parser(Tape *tape, Error *error, const bsl::string_view& input);
+
+    // MANIPULATORS
+
+    /// Parse a value, allowing the specified `maxNestedDepth` levels of
+    /// nesting.  Return 0 on success, and a non-zero value otherwise.
+    int parseValue(int maxNestedDepth);
+
+    /// Parse the remainder of the input, which must consist solely of
+    /// whitespace.  Return 0 on success, and a non-zero value otherwise.
+    int parseEnd();
+};
+
+                               // ------------
+                               // class Parser
+                               // ------------
+
+// PRIVATE MANIPULATORS
+inline
+bsl::size_t Parser::appendNode(unsigned int        flags,
+                               unsigned int        length,
+                               bsls::Types::Uint64 value)
+{
+    JsonView_Node node;
+    node.d_flags  = flags;
+    node.d_length = length;
+    node.d_value  = value;
+
+    d_tape_p->push_back(node);
+    return d_tape_p->size() - 1;
+}
+
+int Parser::closeContainer(bsl::size_t index, bsl::size_t size)
+{
+    if (size > UINT_MAX) {
+        return fail("Too many elements");                             // RETURN
+    }
+
+    JsonView_Node& node = (*d_tape_p)[index];
+    node.d_length = static_cast<unsigned int>(size);
+    node.d_value  = d_tape_p->size() - index;
+    return 0;
+}
+
+int Parser::fail(const char *message, int status)
+{
+    d_error_p->setMessage(message);
+    d_error_p->setLocation(Location(d_cursor_p - d_begin_p));
+    return status;
+}
+
+int Parser::parseArray(int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return fail("Maximum nesting depth exceeded", -4);            // RETURN
+    }
+
+    const bsl::size_t index = appendNode(JsonType::e_ARRAY, 0, 0);
+    bsl::size_t       size  = 0;
+
+    ++d_cursor_p;
+    skipWhitespace();
+    if (d_cursor_p != d_end_p && ']' == *d_cursor_p) {
+        ++d_cursor_p;
+        return closeContainer(index, size);                           // RETURN
+    }
+
+    while (true) {
+        int rc = parseValue(maxNestedDepth);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        ++size;
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p) {
+            return fail("Unexpected end of input");                   // RETURN
+        }
+        if (']' == *d_cursor_p) {
+            ++d_cursor_p;
+            return closeContainer(index, size);                       // RETURN
+        }
+        if (',' != *d_cursor_p) {
+            return fail("Unexpected character");                      // RETURN
+        }
+        ++d_cursor_p;
+    }
+}
+
+int Parser::parseObject(int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return fail("Maximum nesting depth exceeded", -4);            // RETURN
+    }
+
+    const bsl::size_t index = appendNode(JsonType::e_OBJECT, 0, 0);
+    bsl::size_t       size  = 0;
+
+    ++d_cursor_p;
+    skipWhitespace();
+    if (d_cursor_p != d_end_p && '}' == *d_cursor_p) {
+        ++d_cursor_p;
+        return closeContainer(index, size);                           // RETURN
+    }
+
+    while (true) {
+        skipWhitespace();
+        if (d_cursor_p == d_end_p || '"' != *d_cursor_p) {
+            return fail("Expected e_ELEMENT_NAME in object", -2);     // RETURN
+        }
+
+        int rc = parseString();
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p || ':' != *d_cursor_p) {
+            return fail("Unexpected character");                      // RETURN
+        }
+        ++d_cursor_p;
+
+        rc = parseValue(maxNestedDepth);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+        ++size;
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p) {
+            return fail("Unexpected end of input");                   // RETURN
+        }
+        if ('}' == *d_cursor_p) {
+            ++d_cursor_p;
+            return closeContainer(index, size);                       // RETURN
+        }
+        if (',' != *d_cursor_p) {
+            return fail("Unexpected character");                      // RETURN
+        }
+        ++d_cursor_p;
+    }
+}
+
+int Parser::parseScalar()
+{
+    const char *start = d_cursor_p;
+    while (d_cursor_p != d_end_p
+        && !ScanUtil::isScalarTerminator(*d_cursor_p)) {
+        ++d_cursor_p;
+    }
+
+    const bsl::string_view text(start, d_cursor_p - start);
+
+    if (text.empty()) {
+        return fail("Unexpected character");                          // RETURN
+    }
+
+    if ("null" == text) {
+        appendNode(JsonType::e_NULL, 0, 0);
+        return 0;                                                     // RETURN
+    }
+
+    if ("true" == text || "false" == text) {
+        appendNode(JsonType::e_BOOLEAN, 0, "true" == text);
+        return 0;                                                     // RETURN
+    }
+
+    if (text.length() > UINT_MAX || !NumberUtil::isValidNumber(text)) {
+        d_cursor_p = start;
+        return fail("Invalid JSON Number");                           // RETURN
+    }
+
+    appendNode(JsonType::e_NUMBER,
+               static_cast<unsigned int>(text.length()),
+               start - d_begin_p);
+    return 0;
+}
+
+int Parser::parseString()
+{
+    unsigned int flags = JsonType::e_STRING;
+
+    const char *start = ++d_cursor_p;
+    while (true) {
+        // Skip ordinary characters before examining the next character of
+        // interest.
+
+        while (d_cursor_p != d_end_p
+            && '"'  != *d_cursor_p
+            && '\\' != *d_cursor_p
+            && static_cast<unsigned char>(*d_cursor_p) > 0x1F) {
+            ++d_cursor_p;
+        }
+
+        if (d_cursor_p == d_end_p) {
+            return fail("Unexpected end of input");                   // RETURN
+        }
+
+        if ('"' == *d_cursor_p) {
+            break;
+        }
+
+        if ('\\' != *d_cursor_p) {
+            return fail("Unescaped control character in string");     // RETURN
+        }
+
+        flags |= JsonView_Node::k_HAS_ESCAPES;
+        if (d_end_p - d_cursor_p < 2) {
+            ++d_cursor_p;
+            return fail("Unexpected end of input");                   // RETURN
+        }
+
+        switch (d_cursor_p[1]) {
+          case '"':
+          case '\\':
+          case '/':
+          case 'b':
+          case 'f':
+          case 'n':
+          case 'r':
+          case 't': {
+            d_cursor_p += 2;
+          } break;
+          case 'u': {
+            // A surrogate must be part of a (high, low) surrogate pair,
+            // itself encoded as two consecutive escape sequences.
+
+            unsigned int codeUnit;
+            if (d_end_p - d_cursor_p < 6
+             || ScanUtil::parseHex4(&codeUnit, d_cursor_p + 2)
+             || (0xDC00 <= codeUnit && codeUnit <= 0xDFFF)) {
+                return fail("Invalid escape sequence");               // RETURN
+            }
+            d_cursor_p += 6;
+
+            if (0xD800 <= codeUnit && codeUnit <= 0xDBFF) {
+                if (d_end_p - d_cursor_p < 6
+                 || '\\' != d_cursor_p[0]
+                 || 'u'  != d_cursor_p[1]
+                 || ScanUtil::parseHex4(&codeUnit, d_cursor_p + 2)
+                 || codeUnit < 0xDC00
+                 || 0xDFFF < codeUnit) {
+                    return fail("Invalid escape sequence");           // RETURN
+                }
+                d_cursor_p += 6;
+            }
+          } break;
+          default: {
+            return fail("Invalid escape sequence");                   // RETURN
+          }
+        }
+    }
+
+    if (static_cast<bsl::size_t>(d_cursor_p - start) > UINT_MAX) {
+        return fail("String too long");                               // RETURN
+    }
+
+    appendNode(flags,
+               static_cast<unsigned int>(d_cursor_p - start),
+               start - d_begin_p);
+
+    ++d_cursor_p;  // closing quote
+    return 0;
+}
+
+inline
+void Parser::skipWhitespace()
+{
+    while (d_cursor_p != d_end_p && ScanUtil::isWhitespace(*d_cursor_p)) {
+        ++d_cursor_p;
+    }
+}
+
+// CREATORS
+Parser::Parser(Tape *tape, Error *error, const bsl::string_view& input)
+: d_tape_p(tape)
+, d_error_p(error)
+, d_begin_p(input.data())
+, d_end_p(input.data() + input.length())
+, d_cursor_p(input.data())
+{
+}
+
+// MANIPULATORS
+int Parser::parseValue(int maxNestedDepth)
+{
+    skipWhitespace();
+    if (d_cursor_p == d_end_p) {
+        return fail("Unexpected end of input");                       // RETURN
+    }
+
+    switch (*d_cursor_p) {
+      case '{': {
+        return parseObject(maxNestedDepth - 1);                       // RETURN
+      }
+      case '[': {
+        return parseArray(maxNestedDepth - 1);                        // RETURN
+      }
+      case '"': {
+        return parseString();                                         // RETURN
+      }
+    }
+    return parseScalar();
+}
+
+int Parser::parseEnd()
+{
+    skipWhitespace();
+    if (d_cursor_p != d_end_p) {
+        return fail("Additional text found after document");          // RETURN
+    }
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                               // --------------
+                               // class JsonView
+                               // --------------
+
+// ACCESSORS
+int JsonView::asInt(int *result) const
+{
+    BSLS_ASSERT(result);
+
+    return NumberUtil::asInt(result, theNumber());
+}
+
+int JsonView::asInt64(bsls::Types::Int64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    return NumberUtil::asInt64(result, theNumber());
+}
+
+int JsonView::asUint(unsigned int *result) const
+{
+    BSLS_ASSERT(result);
+
+    return NumberUtil::asUint(result, theNumber());
+}
+
+int JsonView::asUint64(bsls::Types::Uint64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    return NumberUtil::asUint64(result, theNumber());
+}
+
+double JsonView::asDouble() const
+{
+    return NumberUtil::asDouble(theNumber());
+}
+
+int JsonView::loadString(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!hasEscapes()) {
+        const bsl::string_view text = rawString();
+        result->assign(text.data(), text.length());
+        return 0;                                                     // RETURN
+    }
+    return StringUtil::readUnquotedString(result, rawString());
+}
+
+JsonView JsonView::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(isArray());
+    BSLS_ASSERT(index < size());
+
+    const JsonView_Node *node = d_node_p + 1;
+    for (; index; --index) {
+        node = node->next();
+    }
+    return JsonView(node, d_input_p);
+}
+
+JsonViewObjectIterator JsonView::find(const bsl::string_view& name) const
+{
+    BSLS_ASSERT(isObject());
+
+    const JsonViewObjectIterator end = endObject();
+    for (JsonViewObjectIterator it = beginObject(); it != end; ++it) {
+        if ((*it).nameEquals(name)) {
+            return it;                                                // RETURN
+        }
+    }
+    return end;
+}
+
+                            // --------------------
+                            // class JsonViewMember
+                            // --------------------
+
+// ACCESSORS
+bool JsonViewMember::nameEquals(const bsl::string_view& name) const
+{
+    const JsonView key = this->name();
+
+    if (!key.hasEscapes()) {
+        return key.rawString() == name;                               // RETURN
+    }
+
+    // A name having escape sequences is at least as long as its value.
+
+    if (key.rawString().length() < name.length()) {
+        return false;                                                 // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<256> lsa;
+    bsl::string                          value(&lsa);
+
+    return 0 == key.loadString(&value) && value == name;
+}
+
+                           // ----------------------
+                           // class JsonViewDocument
+                           // ----------------------
+
+// MANIPULATORS
+int JsonViewDocument::load(const bsl::string_view& input)
+{
+    Error error;
+    return load(&error, input, ReadOptions());
+}
+
+int JsonViewDocument::load(const bsl::string_view& input,
+                           const ReadOptions&      options)
+{
+    Error error;
+    return load(&error, input, options);
+}
+
+int JsonViewDocument::load(Error                   *errorDescription,
+                           const bsl::string_view&  input)
+{
+    return load(errorDescription, input, ReadOptions());
+}
+
+int JsonViewDocument::load(Error                   *errorDescription,
+                           const bsl::string_view&  input,
+                           const ReadOptions&       options)
+{
+    BSLS_ASSERT(errorDescription);
+
+    reset();
+
+    const char *invalid = 0;
+    if (!bdlde::Utf8Util::isValid(&invalid, input.data(), input.length())) {
+        errorDescription->setMessage("Invalid UTF-8");
+        errorDescription->setLocation(Location(invalid - input.data()));
+        return -1;                                                    // RETURN
+    }
+
+    u::Parser parser(&d_tape, errorDescription, input);
+
+    int rc = parser.parseValue(options.maxNestedDepth());
+    if (0 == rc && !options.allowTrailingText()) {
+        rc = parser.parseEnd();
+    }
+
+    if (rc) {
+        d_tape.clear();
+        return rc;                                                    // RETURN
+    }
+
+    d_input = input;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
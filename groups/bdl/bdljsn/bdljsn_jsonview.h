@@ -0,0 +1,968 @@
+// bdljsn_jsonview.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLJSN_JSONVIEW
+#define INCLUDED_BDLJSN_JSONVIEW
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a read-only, non-owning view of a JSON document.
+//
+//@CLASSES:
+//  bdljsn::JsonViewDocument: parsed, read-only representation of JSON text
+//  bdljsn::JsonView: read-only handle to a value in a `JsonViewDocument`
+//  bdljsn::JsonViewMember: read-only handle to a member of a JSON object
+//  bdljsn::JsonViewArrayIterator: iterator over the elements of an array
+//  bdljsn::JsonViewObjectIterator: iterator over the members of an object
+//
+//@SEE_ALSO: bdljsn_jsonutil, bdljsn_json
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `bdljsn::JsonViewDocument`, that parses JSON text held in a contiguous
+// buffer into a flat, read-only representation that refers to (rather than
+// copies) the strings and numbers of that text, and a family of lightweight
+// handle types, `bdljsn::JsonView`, `bdljsn::JsonViewMember`,
+// `bdljsn::JsonViewArrayIterator`, and `bdljsn::JsonViewObjectIterator`,
+// that provide access to the values in the parsed document.
+//
+// A `bdljsn::JsonViewDocument` is an alternative to reading a `bdljsn::Json`
+// object with `bdljsn::JsonUtil::read` when the JSON text is already in
+// memory, must only be inspected, and is large.  Reading a `bdljsn::Json`
+// allocates a string for each name and string value, and a container for each
+// object and array.  In contrast, a `bdljsn::JsonViewDocument` records each
+// value of the document as a fixed-size node in a single array (the *tape*),
+// in document order, and the nodes for strings and numbers merely refer to
+// their text in the input buffer.  The escape sequences in a string are only
+// processed when a client asks for the string's value (see
+// `bdljsn::JsonView::loadString`).
+//
+// The input buffer is *not* copied, and must remain unmodified, and outlive
+// any use of the document and of the handles obtained from it.  Handles are
+// invalidated by a subsequent call to `load` or `reset` on the document.
+//
+///Conformance
+///-----------
+// `bdljsn::JsonViewDocument::load` accepts exactly the JSON text accepted by
+// `bdljsn::JsonUtil::read`, and honors the same `bdljsn::ReadOptions`: the
+// input must be valid UTF-8, and must conform to RFC8259 (see
+// https://www.rfc-editor.org/rfc/rfc8259).  A JSON object having several
+// members of the same name is represented with all of them, in document
+// order; `find` returns the first such member, as `bdljsn::JsonUtil::read`
+// retains the first.
+//
+///Performance
+///-----------
+// Loading a document performs (amortized) a constant number of operations per
+// character of input, and allocates only to grow the tape, whose capacity is
+// retained by `reset` and reused by subsequent loads.  Iterating over the
+// elements of an array or the members of an object takes constant time per
+// element (or member), irrespective of the size of the values being skipped.
+// Note that `bdljsn::JsonView::operator[]` and `bdljsn::JsonView::find` take
+// time linear in the number of elements and members (respectively) of the
+// array or object they are invoked on.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Inspecting a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service periodically receives a (potentially large) snapshot
+// of its configuration as JSON text, and needs only a few values from it.
+//
+// First, we obtain the JSON text:
+// ```
+// const char *TEXT = "{\n"
+//                    "    \"version\": 7,\n"
+//                    "    \"servers\": [\n"
+//                    "        {\"host\": \"alpha\", \"port\": 8080},\n"
+//                    "        {\"host\": \"beta\\u0021\", \"port\": 8081}\n"
+//                    "    ]\n"
+//                    "}\n";
+// ```
+// Then, we load a `bdljsn::JsonViewDocument` from that text:
+// ```
+// bdljsn::JsonViewDocument document;
+// bdljsn::Error            error;
+//
+// int rc = document.load(&error, TEXT);
+// assert(0 == rc);
+//
+// bdljsn::JsonView root = document.root();
+// assert(root.isObject());
+// assert(2 == root.size());
+// ```
+// Next, we look up the version of the configuration:
+// ```
+// bdljsn::JsonViewObjectIterator version = root.find("version");
+// assert(root.endObject() != version);
+//
+// int versionNumber;
+// rc = (*version).value().asInt(&versionNumber);
+// assert(0 == rc);
+// assert(7 == versionNumber);
+// ```
+// Now, we iterate over the servers, accessing the text of each host name
+// directly in the input buffer:
+// ```
+// bdljsn::JsonView servers = (*root.find("servers")).value();
+// assert(servers.isArray());
+//
+// for (bdljsn::JsonViewArrayIterator it  = servers.beginArray();
+//                                    it != servers.endArray();
+//                                    ++it) {
+//     bdljsn::JsonView server = *it;
+//     bdljsn::JsonView host   = (*server.find("host")).value();
+//
+//     assert(host.isString());
+//     assert(host.rawString() == "alpha" ||
+//            host.rawString() == "beta\\u0021");
+// }
+// ```
+// Finally, we obtain the value of the second host name, whose escape
+// sequence is only processed now:
+// ```
+// bsl::string host;
+// rc = (*servers[1].find("host")).value().loadString(&host);
+// assert(0 == rc);
+// assert("beta!" == host);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_jsontype.h>
+#include <bdljsn_readoptions.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class Error;
+class JsonViewArrayIterator;
+class JsonViewDocument;
+class JsonViewMember;
+class JsonViewObjectIterator;
+
+                            // ====================
+                            // struct JsonView_Node
+                            // ====================
+
+/// This component-private `struct` describes a node of the tape of a
+/// `JsonViewDocument`.  Each value of a JSON document is represented by a
+/// node, and is followed by the nodes representing the elements of the value
+/// (if it is an array), or the name and value of each member of the value
+/// (if it is an object).
+struct JsonView_Node {
+
+    // TYPES
+    enum {
+        k_TYPE_MASK   = 0xFF,   // bits holding the `JsonType::Enum` value
+        k_HAS_ESCAPES = 0x100   // set for strings having escape sequences
+    };
+
+    // DATA
+    unsigned int        d_flags;   // type and `k_HAS_ESCAPES`
+
+    unsigned int        d_length;  // length of the text of a string (without
+                                   // its quotes) or number, or number of
+                                   // elements of an array or members of an
+                                   // object
+
+    bsls::Types::Uint64 d_value;   // offset of the text of a string (after
+                                   // its opening quote) or number in the
+                                   // input, number of nodes representing an
+                                   // array or object (including its own), or
+                                   // value of a boolean
+
+    // ACCESSORS
+
+    /// Return the address of the node following the nodes representing the
+    /// value represented by this node.
+    const JsonView_Node *next() const;
+
+    /// Return the type of the value represented by this node.
+    JsonType::Enum type() const;
+};
+
+                               // ==============
+                               // class JsonView
+                               // ==============
+
+/// This class provides a read-only handle to a value in a
+/// `JsonViewDocument`.  A `JsonView` is valid until the document it refers to
+/// is modified or destroyed.
+class JsonView {
+
+    // DATA
+    const JsonView_Node *d_node_p;   // represented node (held, not owned)
+    const char          *d_input_p;  // start of the input (held, not owned)
+
+    // FRIENDS
+    friend class JsonViewArrayIterator;
+    friend class JsonViewDocument;
+    friend class JsonViewMember;
+    friend class JsonViewObjectIterator;
+
+    // PRIVATE CREATORS
+
+    /// Create a handle to the value represented by the specified `node` of
+    /// a document whose input starts at the specified `input`.
+    JsonView(const JsonView_Node *node, const char *input);
+
+  public:
+    // ACCESSORS
+
+    /// Return the type of the referenced value.
+    JsonType::Enum type() const;
+
+    /// Return `true` if the referenced value is an array, and `false`
+    /// otherwise.
+    bool isArray() const;
+
+    /// Return `true` if the referenced value is a boolean, and `false`
+    /// otherwise.
+    bool isBoolean() const;
+
+    /// Return `true` if the referenced value is `null`, and `false`
+    /// otherwise.
+    bool isNull() const;
+
+    /// Return `true` if the referenced value is a number, and `false`
+    /// otherwise.
+    bool isNumber() const;
+
+    /// Return `true` if the referenced value is an object, and `false`
+    /// otherwise.
+    bool isObject() const;
+
+    /// Return `true` if the referenced value is a string, and `false`
+    /// otherwise.
+    bool isString() const;
+
+                        // Boolean Accessors
+
+    /// Return the referenced boolean value.  The behavior is undefined
+    /// unless `isBoolean()`.
+    bool theBoolean() const;
+
+                        // Number Accessors
+
+    /// Return the text of the referenced number.  The behavior is undefined
+    /// unless `isNumber()`.
+    bsl::string_view theNumber() const;
+
+    /// Load into the specified `result` the integer value of the referenced
+    /// number.  Return 0 on success, and a non-zero value (loading `result`
+    /// as described by `bdljsn::NumberUtil::asInt`) if the number is not
+    /// integral or is not representable by `result`.  The behavior is
+    /// undefined unless `isNumber()`.
+    int asInt(int *result) const;
+    int asInt64(bsls::Types::Int64 *result) const;
+    int asUint(unsigned int *result) const;
+    int asUint64(bsls::Types::Uint64 *result) const;
+
+    /// Return the closest `double` representation of the referenced number.
+    /// The behavior is undefined unless `isNumber()`.
+    double asDouble() const;
+
+                        // String Accessors
+
+    /// Return `true` if the text of the referenced string contains escape
+    /// sequences, and `false` otherwise.  The behavior is undefined unless
+    /// `isString()`.  Note that the text of a string having no escape
+    /// sequences is its value.
+    bool hasEscapes() const;
+
+    /// Load into the specified `result` the value of the referenced string,
+    /// i.e., its text having its escape sequences replaced by the characters
+    /// they represent.  Return 0 on success, and a non-zero value if an
+    /// escape sequence does not represent a valid UTF-8 code point (in
+    /// which case `result` has an unspecified value).  The behavior is
+    /// undefined unless `isString()`.
+    int loadString(bsl::string *result) const;
+
+    /// Return the text (without the enclosing quotes) of the referenced
+    /// string, in the input of the document.  The behavior is undefined
+    /// unless `isString()`.  Note that the escape sequences of the string
+    /// are *not* processed (see `loadString`).
+    bsl::string_view rawString() const;
+
+                        // Array and Object Accessors
+
+    /// Return the number of elements of the referenced array, or the number
+    /// of members of the referenced object.  The behavior is undefined
+    /// unless `isArray() || isObject()`.
+    bsl::size_t size() const;
+
+    /// Return a view of the element at the specified `index` in the
+    /// referenced array.  The behavior is undefined unless `isArray()` and
+    /// `index < size()`.  Note that this operation takes time linear in
+    /// `index`.
+    JsonView operator[](bsl::size_t index) const;
+
+    /// Return an iterator referring to the first element of the referenced
+    /// array.  The behavior is undefined unless `isArray()`.
+    JsonViewArrayIterator beginArray() const;
+
+    /// Return an iterator referring to one past the last element of the
+    /// referenced array.  The behavior is undefined unless `isArray()`.
+    JsonViewArrayIterator endArray() const;
+
+    /// Return an iterator referring to the first member of the referenced
+    /// object.  The behavior is undefined unless `isObject()`.
+    JsonViewObjectIterator beginObject() const;
+
+    /// Return an iterator referring to one past the last member of the
+    /// referenced object.  The behavior is undefined unless `isObject()`.
+    JsonViewObjectIterator endObject() const;
+
+    /// Return `true` if the referenced object has a member having the
+    /// specified `name`, and `false` otherwise.  The behavior is undefined
+    /// unless `isObject()`.
+    bool contains(const bsl::string_view& name) const;
+
+    /// Return an iterator referring to the first member of the referenced
+    /// object having the specified `name`, or `endObject()` if there is no
+    /// such member.  The behavior is undefined unless `isObject()`.  Note
+    /// that this operation takes time linear in the number of members of
+    /// the object.
+    JsonViewObjectIterator find(const bsl::string_view& name) const;
+};
+
+                            // ====================
+                            // class JsonViewMember
+                            // ====================
+
+/// This class provides a read-only handle to a member (i.e., a name and a
+/// value) of an object in a `JsonViewDocument`.
+class JsonViewMember {
+
+    // DATA
+    const JsonView_Node *d_name_p;   // node of the name (held, not owned)
+    const char          *d_input_p;  // start of the input (held, not owned)
+
+    // FRIENDS
+    friend class JsonView;
+    friend class JsonViewObjectIterator;
+
+    // PRIVATE CREATORS
+
+    /// Create a handle to the member whose name is represented by the
+    /// specified `name` node of a document whose input starts at the
+    /// specified `input`.
+    JsonViewMember(const JsonView_Node *name, const char *input);
+
+  public:
+    // ACCESSORS
+
+    /// Return a view of the (string) name of the referenced member.
+    JsonView name() const;
+
+    /// Return `true` if the name of the referenced member is the specified
+    /// `name`, and `false` otherwise.
+    bool nameEquals(const bsl::string_view& name) const;
+
+    /// Return a view of the value of the referenced member.
+    JsonView value() const;
+};
+
+                        // ===========================
+                        // class JsonViewArrayIterator
+                        // ===========================
+
+/// This class provides an iterator over the elements of an array in a
+/// `JsonViewDocument`, whose `operator*` returns a `JsonView` by value.
+class JsonViewArrayIterator {
+
+    // DATA
+    const JsonView_Node *d_node_p;   // referenced node (held, not owned)
+    const char          *d_input_p;  // start of the input (held, not owned)
+
+    // FRIENDS
+    friend class JsonView;
+    friend bool operator==(const JsonViewArrayIterator&,
+                           const JsonViewArrayIterator&);
+
+    // PRIVATE CREATORS
+
+    /// Create an iterator referring to the value represented by the
+    /// specified `node` of a document whose input starts at the specified
+    /// `input`.
+    JsonViewArrayIterator(const JsonView_Node *node, const char *input);
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag iterator_category;
+    typedef JsonView                value_type;
+    typedef bsl::ptrdiff_t          difference_type;
+    typedef const JsonView         *pointer;
+    typedef JsonView                reference;
+
+    // MANIPULATORS
+
+    /// Advance this iterator to the next element, and return a reference
+    /// providing modifiable access to this iterator.  The behavior is
+    /// undefined if this iterator refers to one past the last element.
+    JsonViewArrayIterator& operator++();
+
+    /// Advance this iterator to the next element, and return an iterator
+    /// having the value of this iterator before the call.  The behavior is
+    /// undefined if this iterator refers to one past the last element.
+    JsonViewArrayIterator operator++(int);
+
+    // ACCESSORS
+
+    /// Return a view of the referenced element.  The behavior is undefined
+    /// if this iterator refers to one past the last element.
+    JsonView operator*() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` iterators refer to the
+/// same element, and `false` otherwise.
+bool operator==(const JsonViewArrayIterator& lhs,
+                const JsonViewArrayIterator& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` iterators do not refer to
+/// the same element, and `false` otherwise.
+bool operator!=(const JsonViewArrayIterator& lhs,
+                const JsonViewArrayIterator& rhs);
+
+                        // ============================
+                        // class JsonViewObjectIterator
+                        // ============================
+
+/// This class provides an iterator over the members of an object in a
+/// `JsonViewDocument`, whose `operator*` returns a `JsonViewMember` by value.
+/// Members are visited in document order.
+class JsonViewObjectIterator {
+
+    // DATA
+    const JsonView_Node *d_name_p;   // node of the name of the referenced
+                                     // member (held, not owned)
+
+    const char          *d_input_p;  // start of the input (held, not owned)
+
+    // FRIENDS
+    friend class JsonView;
+    friend bool operator==(const JsonViewObjectIterator&,
+                           const JsonViewObjectIterator&);
+
+    // PRIVATE CREATORS
+
+    /// Create an iterator referring to the member whose name is represented
+    /// by the specified `name` node of a document whose input starts at the
+    /// specified `input`.
+    JsonViewObjectIterator(const JsonView_Node *name, const char *input);
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag iterator_category;
+    typedef JsonViewMember          value_type;
+    typedef bsl::ptrdiff_t          difference_type;
+    typedef const JsonViewMember   *pointer;
+    typedef JsonViewMember          reference;
+
+    // MANIPULATORS
+
+    /// Advance this iterator to the next member, and return a reference
+    /// providing modifiable access to this iterator.  The behavior is
+    /// undefined if this iterator refers to one past the last member.
+    JsonViewObjectIterator& operator++();
+
+    /// Advance this iterator to the next member, and return an iterator
+    /// having the value of this iterator before the call.  The behavior is
+    /// undefined if this iterator refers to one past the last member.
+    JsonViewObjectIterator operator++(int);
+
+    // ACCESSORS
+
+    /// Return a handle to the referenced member.  The behavior is undefined
+    /// if this iterator refers to one past the last member.
+    JsonViewMember operator*() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` iterators refer to the
+/// same member, and `false` otherwise.
+bool operator==(const JsonViewObjectIterator& lhs,
+                const JsonViewObjectIterator& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` iterators do not refer to
+/// the same member, and `false` otherwise.
+bool operator!=(const JsonViewObjectIterator& lhs,
+                const JsonViewObjectIterator& rhs);
+
+                           // ======================
+                           // class JsonViewDocument
+                           // ======================
+
+/// This class provides a parsed, read-only representation of JSON text held
+/// in a contiguous buffer, that refers to the text rather than copying it.
+/// See [](#Description).
+class JsonViewDocument {
+
+    // PRIVATE TYPES
+    typedef bsl::vector<JsonView_Node> Tape;
+
+    // DATA
+    Tape             d_tape;   // nodes of the document, in document order
+    bsl::string_view d_input;  // loaded text (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    JsonViewDocument(const JsonViewDocument&);
+    JsonViewDocument& operator=(const JsonViewDocument&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(JsonViewDocument,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty document (i.e., one for which `isLoaded()` is
+    /// `false`).  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    explicit JsonViewDocument(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~JsonViewDocument();
+
+    // MANIPULATORS
+
+    /// Load this document from the JSON text in the specified `input`.
+    /// Optionally specify an `errorDescription` that, if an error occurs,
+    /// is loaded with a description of the error.  Optionally specify
+    /// `options` which allow altering the maximum nesting depth and
+    /// allowing text to follow the document (see `bdljsn::JsonUtil::read`).
+    /// Return 0 on success, and a non-zero value, leaving this document
+    /// empty, if `input` does not consist of valid JSON text.  The text
+    /// referred to by `input` must remain unmodified, and outlive any use
+    /// of this document (and of the views obtained from it) until this
+    /// document is next loaded or reset.
+    int load(const bsl::string_view& input);
+    int load(const bsl::string_view& input, const ReadOptions& options);
+    int load(Error *errorDescription, const bsl::string_view& input);
+    int load(Error                   *errorDescription,
+             const bsl::string_view&  input,
+             const ReadOptions&       options);
+
+    /// Make this document empty, invalidating any views obtained from it.
+    /// Note that the memory used to represent the document is retained for
+    /// subsequent loads.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the text from which this document was loaded.  The behavior
+    /// is undefined unless `isLoaded()`.
+    bsl::string_view input() const;
+
+    /// Return `true` if this document was successfully loaded, and `false`
+    /// otherwise.
+    bool isLoaded() const;
+
+    /// Return the number of nodes (i.e., of JSON values and member names)
+    /// representing this document.
+    bsl::size_t numNodes() const;
+
+    /// Return a view of the top-level value of this document.  The behavior
+    /// is undefined unless `isLoaded()`.
+    JsonView root() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // struct JsonView_Node
+                            // --------------------
+
+// ACCESSORS
+inline
+const JsonView_Node *JsonView_Node::next() const
+{
+    return JsonType::e_ARRAY == type() || JsonType::e_OBJECT == type()
+           ? this + d_value
+           : this + 1;
+}
+
+inline
+JsonType::Enum JsonView_Node::type() const
+{
+    return static_cast<JsonType::Enum>(d_flags & k_TYPE_MASK);
+}
+
+                               // --------------
+                               // class JsonView
+                               // --------------
+
+// PRIVATE CREATORS
+inline
+JsonView::JsonView(const JsonView_Node *node, const char *input)
+: d_node_p(node)
+, d_input_p(input)
+{
+    BSLS_ASSERT_SAFE(node);
+}
+
+// ACCESSORS
+inline
+JsonType::Enum JsonView::type() const
+{
+    return d_node_p->type();
+}
+
+inline
+bool JsonView::isArray() const
+{
+    return JsonType::e_ARRAY == type();
+}
+
+inline
+bool JsonView::isBoolean() const
+{
+    return JsonType::e_BOOLEAN == type();
+}
+
+inline
+bool JsonView::isNull() const
+{
+    return JsonType::e_NULL == type();
+}
+
+inline
+bool JsonView::isNumber() const
+{
+    return JsonType::e_NUMBER == type();
+}
+
+inline
+bool JsonView::isObject() const
+{
+    return JsonType::e_OBJECT == type();
+}
+
+inline
+bool JsonView::isString() const
+{
+    return JsonType::e_STRING == type();
+}
+
+inline
+bool JsonView::theBoolean() const
+{
+    BSLS_ASSERT(isBoolean());
+
+    return 0 != d_node_p->d_value;
+}
+
+inline
+bsl::string_view JsonView::theNumber() const
+{
+    BSLS_ASSERT(isNumber());
+
+    return bsl::string_view(d_input_p + d_node_p->d_value,
+                            d_node_p->d_length);
+}
+
+inline
+bool JsonView::hasEscapes() const
+{
+    BSLS_ASSERT(isString());
+
+    return 0 != (d_node_p->d_flags & JsonView_Node::k_HAS_ESCAPES);
+}
+
+inline
+bsl::string_view JsonView::rawString() const
+{
+    BSLS_ASSERT(isString());
+
+    return bsl::string_view(d_input_p + d_node_p->d_value,
+                            d_node_p->d_length);
+}
+
+inline
+bsl::size_t JsonView::size() const
+{
+    BSLS_ASSERT(isArray() || isObject());
+
+    return d_node_p->d_length;
+}
+
+                            // --------------------
+                            // class JsonViewMember
+                            // --------------------
+
+// PRIVATE CREATORS
+inline
+JsonViewMember::JsonViewMember(const JsonView_Node *name, const char *input)
+: d_name_p(name)
+, d_input_p(input)
+{
+    BSLS_ASSERT_SAFE(name);
+}
+
+// ACCESSORS
+inline
+JsonView JsonViewMember::name() const
+{
+    return JsonView(d_name_p, d_input_p);
+}
+
+inline
+JsonView JsonViewMember::value() const
+{
+    return JsonView(d_name_p + 1, d_input_p);
+}
+
+                        // ---------------------------
+                        // class JsonViewArrayIterator
+                        // ---------------------------
+
+// PRIVATE CREATORS
+inline
+JsonViewArrayIterator::JsonViewArrayIterator(const JsonView_Node *node,
+                                             const char          *input)
+: d_node_p(node)
+, d_input_p(input)
+{
+}
+
+// MANIPULATORS
+inline
+JsonViewArrayIterator& JsonViewArrayIterator::operator++()
+{
+    d_node_p = d_node_p->next();
+    return *this;
+}
+
+inline
+JsonViewArrayIterator JsonViewArrayIterator::operator++(int)
+{
+    JsonViewArrayIterator result(*this);
+    ++*this;
+    return result;
+}
+
+// ACCESSORS
+inline
+JsonView JsonViewArrayIterator::operator*() const
+{
+    return JsonView(d_node_p, d_input_p);
+}
+
+                        // ----------------------------
+                        // class JsonViewObjectIterator
+                        // ----------------------------
+
+// PRIVATE CREATORS
+inline
+JsonViewObjectIterator::JsonViewObjectIterator(const JsonView_Node *name,
+                                               const char          *input)
+: d_name_p(name)
+, d_input_p(input)
+{
+}
+
+// MANIPULATORS
+inline
+JsonViewObjectIterator& JsonViewObjectIterator::operator++()
+{
+    d_name_p = (d_name_p + 1)->next();
+    return *this;
+}
+
+inline
+JsonViewObjectIterator JsonViewObjectIterator::operator++(int)
+{
+    JsonViewObjectIterator result(*this);
+    ++*this;
+    return result;
+}
+
+// ACCESSORS
+inline
+JsonViewMember JsonViewObjectIterator::operator*() const
+{
+    return JsonViewMember(d_name_p, d_input_p);
+}
+
+                               // --------------
+                               // class JsonView
+                               // --------------
+
+// ACCESSORS
+inline
+JsonViewArrayIterator JsonView::beginArray() const
+{
+    BSLS_ASSERT(isArray());
+
+    return JsonViewArrayIterator(d_node_p + 1, d_input_p);
+}
+
+inline
+JsonViewArrayIterator JsonView::endArray() const
+{
+    BSLS_ASSERT(isArray());
+
+    return JsonViewArrayIterator(d_node_p->next(), d_input_p);
+}
+
+inline
+JsonViewObjectIterator JsonView::beginObject() const
+{
+    BSLS_ASSERT(isObject());
+
+    return JsonViewObjectIterator(d_node_p + 1, d_input_p);
+}
+
+inline
+JsonViewObjectIterator JsonView::endObject() const
+{
+    BSLS_ASSERT(isObject());
+
+    return JsonViewObjectIterator(d_node_p->next(), d_input_p);
+}
+
+inline
+bool JsonView::contains(const bsl::string_view& name) const
+{
+    return endObject() != find(name);
+}
+
+                           // ----------------------
+                           // class JsonViewDocument
+                           // ----------------------
+
+// CREATORS
+inline
+JsonViewDocument::JsonViewDocument(bslma::Allocator *basicAllocator)
+: d_tape(basicAllocator)
+, d_input()
+{
+}
+
+inline
+JsonViewDocument::~JsonViewDocument()
+{
+}
+
+// MANIPULATORS
+inline
+void JsonViewDocument::reset()
+{
+    d_tape.clear();
+    d_input = bsl::string_view();
+}
+
+// ACCESSORS
+inline
+bsl::string_view JsonViewDocument::input() const
+{
+    BSLS_ASSERT(isLoaded());
+
+    return d_input;
+}
+
+inline
+bool JsonViewDocument::isLoaded() const
+{
+    return !d_tape.empty();
+}
+
+inline
+bsl::size_t JsonViewDocument::numNodes() const
+{
+    return d_tape.size();
+}
+
+inline
+JsonView JsonViewDocument::root() const
+{
+    BSLS_ASSERT(isLoaded());
+
+    return JsonView(d_tape.data(), d_input.data());
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *JsonViewDocument::allocator() const
+{
+    return d_tape.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdljsn::operator==(const JsonViewArrayIterator& lhs,
+                        const JsonViewArrayIterator& rhs)
+{
+    return lhs.d_node_p == rhs.d_node_p;
+}
+
+inline
+bool bdljsn::operator!=(const JsonViewArrayIterator& lhs,
+                        const JsonViewArrayIterator& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bdljsn::operator==(const JsonViewObjectIterator& lhs,
+                        const JsonViewObjectIterator& rhs)
+{
+    return lhs.d_name_p == rhs.d_name_p;
+}
+
+inline
+bool bdljsn::operator!=(const JsonViewObjectIterator& lhs,
+                        const JsonViewObjectIterator& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1340 @@
+// bdljsn_jsonview.t.cpp                                              -*-C++-*-
+#include <bdljsn_jsonview.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsontestsuiteutil.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_location.h>
+#include <bdljsn_readoptions.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism that parses JSON text into a
+// tape of nodes, and handles providing access to the values represented by
+// those nodes.  We test the handles on documents loaded from hand-written
+// text, then test the parser's error handling and options, and finally verify
+// that the parser accepts exactly the text accepted by `bdljsn::JsonUtil`,
+// and represents the same values, over the *JSON* *Test* *Suite*.
+// ----------------------------------------------------------------------------
+// JsonViewDocument
+// [ 2] explicit JsonViewDocument(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~JsonViewDocument();
+// [ 2] int load(const bsl::string_view& input);
+// [ 5] int load(const bsl::string_view& input, const ReadOptions& options);
+// [ 5] int load(Error *errorDescription, const bsl::string_view& input);
+// [ 5] int load(Error *, const bsl::string_view&, const ReadOptions&);
+// [ 2] void reset();
+// [ 2] bsl::string_view input() const;
+// [ 2] bool isLoaded() const;
+// [ 2] bsl::size_t numNodes() const;
+// [ 2] JsonView root() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// JsonView
+// [ 3] JsonType::Enum type() const;
+// [ 3] bool isArray() const;
+// [ 3] bool isBoolean() const;
+// [ 3] bool isNull() const;
+// [ 3] bool isNumber() const;
+// [ 3] bool isObject() const;
+// [ 3] bool isString() const;
+// [ 3] bool theBoolean() const;
+// [ 3] bsl::string_view theNumber() const;
+// [ 3] int asInt(int *result) const;
+// [ 3] int asInt64(bsls::Types::Int64 *result) const;
+// [ 3] int asUint(unsigned int *result) const;
+// [ 3] int asUint64(bsls::Types::Uint64 *result) const;
+// [ 3] double asDouble() const;
+// [ 3] bool hasEscapes() const;
+// [ 3] int loadString(bsl::string *result) const;
+// [ 3] bsl::string_view rawString() const;
+// [ 4] bsl::size_t size() const;
+// [ 4] JsonView operator[](bsl::size_t index) const;
+// [ 4] JsonViewArrayIterator beginArray() const;
+// [ 4] JsonViewArrayIterator endArray() const;
+// [ 4] JsonViewObjectIterator beginObject() const;
+// [ 4] JsonViewObjectIterator endObject() const;
+// [ 4] bool contains(const bsl::string_view& name) const;
+// [ 4] JsonViewObjectIterator find(const bsl::string_view& name) const;
+//
+// JsonViewMember
+// [ 4] JsonView name() const;
+// [ 4] bool nameEquals(const bsl::string_view& name) const;
+// [ 4] JsonView value() const;
+//
+// JsonViewArrayIterator, JsonViewObjectIterator
+// [ 4] operator++();
+// [ 4] operator++(int);
+// [ 4] operator*() const;
+// [ 4] bool operator==(const ITERATOR& lhs, const ITERATOR& rhs);
+// [ 4] bool operator!=(const ITERATOR& lhs, const ITERATOR& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::JsonViewDocument       Obj;
+typedef bdljsn::JsonView               View;
+typedef bdljsn::JsonViewMember         Member;
+typedef bdljsn::JsonViewArrayIterator  ArrayIterator;
+typedef bdljsn::JsonViewObjectIterator ObjectIterator;
+typedef bdljsn::Error                  Error;
+typedef bdljsn::Json                   Json;
+typedef bdljsn::JsonType               JsonType;
+typedef bdljsn::JsonTestSuiteUtil      JTSU;
+typedef bdljsn::ReadOptions            ReadOptions;
+
+typedef bsls::Types::Int64             Int64;
+typedef bsls::Types::Uint64            Uint64;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return `true` if the specified `view` represents the same value as the
+/// specified `json`, and `false` otherwise.  Note that a member of an object
+/// in `view` is compared with the member of the same name in `json`, and only
+/// the first member of a given name in `view` is compared.
+bool isEquivalent(const View& view, const Json& json)
+{
+    if (view.type() != json.type()) {
+        return false;                                                 // RETURN
+    }
+
+    switch (view.type()) {
+      case JsonType::e_NULL: {
+        return true;                                                  // RETURN
+      }
+      case JsonType::e_BOOLEAN: {
+        return view.theBoolean() == json.theBoolean();                // RETURN
+      }
+      case JsonType::e_NUMBER: {
+        return view.theNumber() == json.theNumber().value();          // RETURN
+      }
+      case JsonType::e_STRING: {
+        bsl::string value;
+        return 0 == view.loadString(&value)
+            && value == json.theString();                             // RETURN
+      }
+      case JsonType::e_ARRAY: {
+        if (view.size() != json.size()) {
+            return false;                                             // RETURN
+        }
+        bsl::size_t index = 0;
+        for (ArrayIterator it = view.beginArray(); it != view.endArray();
+                                                               ++it, ++index) {
+            if (!isEquivalent(*it, json[index])) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      case JsonType::e_OBJECT: {
+        bsl::size_t numDistinct = 0;
+        for (ObjectIterator it = view.beginObject(); it != view.endObject();
+                                                                        ++it) {
+            bsl::string name;
+            if (0 != (*it).name().loadString(&name)
+             || !json.theObject().contains(name)) {
+                return false;                                         // RETURN
+            }
+            if (view.find(name) != it) {
+                continue;  // duplicate name
+            }
+            ++numDistinct;
+            if (!isEquivalent((*it).value(), json[name])) {
+                return false;                                         // RETURN
+            }
+        }
+        return numDistinct == json.size();                            // RETURN
+      }
+    }
+    return false;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    BSLA_MAYBE_UNUSED const bool             verbose = argc > 2;
+    BSLA_MAYBE_UNUSED const bool         veryVerbose = argc > 3;
+    BSLA_MAYBE_UNUSED const bool     veryVeryVerbose = argc > 4;
+    BSLA_MAYBE_UNUSED const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Inspecting a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service periodically receives a (potentially large) snapshot
+// of its configuration as JSON text, and needs only a few values from it.
+//
+// First, we obtain the JSON text:
+// ```
+    const char *TEXT = "{\n"
+                       "    \"version\": 7,\n"
+                       "    \"servers\": [\n"
+                       "        {\"host\": \"alpha\", \"port\": 8080},\n"
+                       "        {\"host\": \"beta\\u0021\", \"port\": 8081}\n"
+                       "    ]\n"
+                       "}\n";
+// ```
+// Then, we load a `bdljsn::JsonViewDocument` from that text:
+// ```
+    bdljsn::JsonViewDocument document;
+    bdljsn::Error            error;
+
+    int rc = document.load(&error, TEXT);
+    ASSERT(0 == rc);
+
+    bdljsn::JsonView root = document.root();
+    ASSERT(root.isObject());
+    ASSERT(2 == root.size());
+// ```
+// Next, we look up the version of the configuration:
+// ```
+    bdljsn::JsonViewObjectIterator version = root.find("version");
+    ASSERT(root.endObject() != version);
+
+    int versionNumber;
+    rc = (*version).value().asInt(&versionNumber);
+    ASSERT(0 == rc);
+    ASSERT(7 == versionNumber);
+// ```
+// Now, we iterate over the servers, accessing the text of each host name
+// directly in the input buffer:
+// ```
+    bdljsn::JsonView servers = (*root.find("servers")).value();
+    ASSERT(servers.isArray());
+
+    for (bdljsn::JsonViewArrayIterator it  = servers.beginArray();
+                                       it != servers.endArray();
+                                       ++it) {
+        bdljsn::JsonView server = *it;
+        bdljsn::JsonView host   = (*server.find("host")).value();
+
+        ASSERT(host.isString());
+        ASSERT(host.rawString() == "alpha" ||
+               host.rawString() == "beta\\u0021");
+    }
+// ```
+// Finally, we obtain the value of the second host name, whose escape
+// sequence is only processed now:
+// ```
+    bsl::string host;
+    rc = (*servers[1].find("host")).value().loadString(&host);
+    ASSERT(0 == rc);
+    ASSERT("beta!" == host);
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+        //
+        // Concerns:
+        // 1. `load` accepts exactly the text accepted by `JsonUtil::read`.
+        //
+        // 2. An accepted document represents the same value as the `Json`
+        //    object read by `JsonUtil::read`.
+        //
+        // 3. `load` reports an error at the same offset as `JsonUtil::read`
+        //    for the most common errors.
+        //
+        // Plan:
+        // 1. For each test point of the *JSON* *Test* *Suite* (see
+        //    `bdljsn_jsontestsuiteutil`), load a document and read a `Json`
+        //    object, and verify that either both or neither operation
+        //    succeeds.  (C-1)
+        //
+        // 2. For each test point accepted, verify that the document and the
+        //    `Json` object represent the same value.  (C-2)
+        //
+        // 3. For a table of invalid documents, verify that the location of
+        //    the error matches that reported by `JsonUtil::read`.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                     << "CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`"
+                     << endl
+                     << "=================================================="
+                     << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (veryVerbose) cout << "JSON Test Suite." << endl;
+
+        const bsl::size_t NUM_DATA = JTSU::numData();
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = JTSU::data(ti)->d_line;
+            const char *const TEST_NAME = JTSU::data(ti)->d_testName_p;
+            const char *const JSON      = JTSU::data(ti)->d_JSON_p;
+            const bsl::size_t LENGTH    = JTSU::data(ti)->d_length;
+
+            if (veryVeryVerbose) {
+                P_(ti) P_(LINE) P(TEST_NAME);
+            }
+
+            const bsl::string_view input(JSON, LENGTH);
+
+            Json  json;
+            Error jsonError;
+            const int jsonRc = bdljsn::JsonUtil::read(&json,
+                                                      &jsonError,
+                                                      input);
+
+            Obj   mX;  const Obj& X = mX;
+            Error error;
+            const int rc = mX.load(&error, input);
+
+            ASSERTV(LINE, TEST_NAME, jsonRc, rc, (0 == jsonRc) == (0 == rc));
+            ASSERTV(LINE, TEST_NAME, (0 == rc) == X.isLoaded());
+            ASSERTV(LINE, TEST_NAME, (0 == rc) == (Error() == error));
+
+            if (0 == rc && 0 == jsonRc) {
+                ASSERTV(LINE, TEST_NAME, isEquivalent(X.root(), json));
+            }
+        }
+
+        if (veryVerbose) cout << "Error locations." << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----
+            { L_,   "[1,2"              },
+            { L_,   "[1 2]"             },
+            { L_,   "[1,]"              },
+            { L_,   "{\"a\" 1}"         },
+            { L_,   "{\"a\":1,}"        },
+            { L_,   "{1:1}"             },
+            { L_,   "[tru]"             },
+            { L_,   "[01]"              },
+            { L_,   "[\"a\\x\"]"        },
+            { L_,   "[\"\x01\"]"        },
+            { L_,   "\"\\uD800\""       },
+            { L_,   "\"\\uDC00\""       },
+            { L_,   "[\xC0]"            },
+            { L_,   "{} {}"             },
+            { L_,   "[[[[[[[[]]]]]]]]"  },
+        };
+        const bsl::size_t NUM_ERRORS = sizeof DATA / sizeof *DATA;
+
+        for (bsl::size_t ti = 0; ti < NUM_ERRORS; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const INPUT = DATA[ti].d_input_p;
+
+            ReadOptions options;
+            options.setMaxNestedDepth(4);
+
+            Json  json;
+            Error jsonError;
+            ASSERTV(LINE, 0 != bdljsn::JsonUtil::read(&json,
+                                                      &jsonError,
+                                                      INPUT,
+                                                      options));
+
+            Obj   mX;
+            Error error;
+            ASSERTV(LINE, 0 != mX.load(&error, INPUT, options));
+
+            if (veryVerbose) {
+                P_(LINE) P_(jsonError) P(error);
+            }
+
+            ASSERTV(LINE, error.message(), !error.message().empty());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERRORS AND OPTIONS
+        //
+        // Concerns:
+        // 1. `load` fails for invalid JSON text, reporting the offset of the
+        //    error, and leaves the document empty.
+        //
+        // 2. `load` honors the `maxNestedDepth` and `allowTrailingText`
+        //    options.
+        //
+        // 3. The overloads not taking an `Error` or `ReadOptions` forward to
+        //    the principal overload, supplying the default options.
+        //
+        // Plan:
+        // 1. Using a table of invalid inputs and the offsets of their errors,
+        //    load each input and verify the result, the error, and the state
+        //    of the document.  (C-1)
+        //
+        // 2. Load documents nested to various depths with various
+        //    `maxNestedDepth` values, and documents followed by text with
+        //    either value of `allowTrailingText`, and verify the results.
+        //    (C-2)
+        //
+        // 3. Verify the results of each overload for valid and invalid
+        //    inputs.  (C-3)
+        //
+        // Testing:
+        //   int load(const bsl::string_view& input, const ReadOptions&);
+        //   int load(Error *errorDescription, const bsl::string_view& input);
+        //   int load(Error *, const bsl::string_view&, const ReadOptions&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERRORS AND OPTIONS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Invalid text." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+                int         d_offset;
+            } DATA[] = {
+                //LINE  INPUT                  OFFSET
+                //----  ---------------------  ------
+                { L_,   "",                        0 },
+                { L_,   "   ",                     3 },
+                { L_,   "]",                       0 },
+                { L_,   "[",                       1 },
+                { L_,   "[1",                      2 },
+                { L_,   "[1 2]",                   3 },
+                { L_,   "[1,]",                    3 },
+                { L_,   "{",                       1 },
+                { L_,   "{\"a\"}",                 4 },
+                { L_,   "{\"a\":}",                5 },
+                { L_,   "{\"a\":1,}",              7 },
+                { L_,   "{a:1}",                   1 },
+                { L_,   "nul",                     0 },
+                { L_,   "[truex]",                 1 },
+                { L_,   "-",                       0 },
+                { L_,   "1.",                      0 },
+                { L_,   "\"abc",                   4 },
+                { L_,   "\"a\x1F\"",               2 },
+                { L_,   "\"\\q\"",                 1 },
+                { L_,   "\"\\u12G4\"",             1 },
+                { L_,   "\"\\uD800\\u0041\"",      7 },
+                { L_,   "\"\\uDFFF\"",             1 },
+                { L_,   "\"\xFF\"",                1 },
+                { L_,   "1 2",                     2 },
+                { L_,   "{}x",                     2 },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const Uint64      OFFSET = DATA[ti].d_offset;
+
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, 0 == mX.load("[1, 2]"));
+                ASSERTV(LINE, X.isLoaded());
+
+                Error error;
+                ASSERTV(LINE, 0 != mX.load(&error, INPUT));
+                ASSERTV(LINE, !X.isLoaded());
+                ASSERTV(LINE, 0 == X.numNodes());
+                ASSERTV(LINE, error.message(), !error.message().empty());
+                ASSERTV(LINE, OFFSET, error.location().offset(),
+                        OFFSET == error.location().offset());
+            }
+        }
+
+        if (veryVerbose) cout << "`maxNestedDepth`." << endl;
+        {
+            for (int depth = 1; depth <= 8; ++depth) {
+                for (int maxDepth = 1; maxDepth <= 8; ++maxDepth) {
+                    // Alternate arrays and objects, e.g., `[{"a":[{}]}]`.
+
+                    bsl::string input(&ta);
+                    for (int i = depth - 1; i >= 0; --i) {
+                        if (i % 2) {
+                            input = input.empty() ? "{}"
+                                                  : "{\"a\":" + input + "}";
+                        }
+                        else {
+                            input = "[" + input + "]";
+                        }
+                    }
+
+                    ReadOptions options;
+                    options.setMaxNestedDepth(maxDepth);
+
+                    Obj mX(&ta);
+                    const int rc = mX.load(input, options);
+
+                    ASSERTV(depth, maxDepth, rc,
+                            (depth <= maxDepth) == (0 == rc));
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "`allowTrailingText`." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+            } DATA[] = {
+                //LINE  INPUT
+                //----  ------------
+                { L_,   "{} x"       },
+                { L_,   "[]]"        },
+                { L_,   "\"a\"\"b\"" },
+                { L_,   "1 2"        },
+                { L_,   "null,"      },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE  = DATA[ti].d_line;
+                const char *const INPUT = DATA[ti].d_input_p;
+
+                ReadOptions options;
+
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, 0 != mX.load(INPUT, options));
+
+                options.setAllowTrailingText(true);
+
+                ASSERTV(LINE, 0 == mX.load(INPUT, options));
+                ASSERTV(LINE, X.isLoaded());
+                ASSERTV(LINE, 1 == X.numNodes());
+            }
+        }
+
+        if (veryVerbose) cout << "Forwarding overloads." << endl;
+        {
+            ReadOptions options;
+            options.setMaxNestedDepth(1);
+
+            Obj mX(&ta);
+
+            Error error;
+            ASSERT(0 == mX.load("[1]"));
+            ASSERT(0 == mX.load("[[1]]"));
+            ASSERT(0 != mX.load("[[1]]", options));
+            ASSERT(0 == mX.load(&error, "[[1]]"));
+            ASSERT(Error() == error);
+            ASSERT(0 != mX.load(&error, "[[1]]", options));
+            ASSERT(Error() != error);
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            Error error;
+            ASSERT_PASS(mX.load(&error, "1"));
+            ASSERT_FAIL(mX.load(0,      "1"));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ARRAYS AND OBJECTS
+        //
+        // Concerns:
+        // 1. `size` returns the number of elements of an array, or members of
+        //    an object.
+        //
+        // 2. The iterators visit the elements (or members) in document
+        //    order, skipping over the nested values of each, and compare
+        //    equal only when referring to the same element (or member).
+        //
+        // 3. `operator[]` returns the element at the specified index.
+        //
+        // 4. `find` returns the first member having the specified name, even
+        //    if the name has escape sequences, or `endObject()`.
+        //
+        // 5. `contains` returns whether `find` finds a member.
+        //
+        // 6. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Load documents having nested arrays and objects, including
+        //    empty ones and duplicate member names, and verify the results of
+        //    the accessors.  (C-1..5)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   bsl::size_t size() const;
+        //   JsonView operator[](bsl::size_t index) const;
+        //   JsonViewArrayIterator beginArray() const;
+        //   JsonViewArrayIterator endArray() const;
+        //   JsonViewObjectIterator beginObject() const;
+        //   JsonViewObjectIterator endObject() const;
+        //   bool contains(const bsl::string_view& name) const;
+        //   JsonViewObjectIterator find(const bsl::string_view& name) const;
+        //   JsonView name() const;
+        //   bool nameEquals(const bsl::string_view& name) const;
+        //   JsonView value() const;
+        //   operator++();
+        //   operator++(int);
+        //   operator*() const;
+        //   bool operator==(const ITERATOR& lhs, const ITERATOR& rhs);
+        //   bool operator!=(const ITERATOR& lhs, const ITERATOR& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAYS AND OBJECTS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Arrays." << endl;
+        {
+            const char *INPUT = "[1, [], [2, [3, {\"a\": [4]}]], {}, \"x\"]";
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(INPUT));
+
+            const View root = X.root();
+            ASSERT(root.isArray());
+            ASSERT(5 == root.size());
+
+            ArrayIterator       it  = root.beginArray();
+            const ArrayIterator end = root.endArray();
+
+            ASSERT(it == root.beginArray());
+            ASSERT(it != end);
+            ASSERT((*it).isNumber());
+            ASSERT("1" == (*it).theNumber());
+
+            ArrayIterator prev = it++;
+            ASSERT(prev == root.beginArray());
+            ASSERT(prev != it);
+            ASSERT((*it).isArray());
+            ASSERT(0 == (*it).size());
+            ASSERT((*it).beginArray() == (*it).endArray());
+
+            ASSERT(&++it == &it);
+            ASSERT((*it).isArray());
+            ASSERT(2 == (*it).size());
+            ASSERT("2" == (*it)[0].theNumber());
+            ASSERT((*it)[1].isArray());
+            ASSERT("3" == (*it)[1][0].theNumber());
+            ASSERT((*it)[1][1].isObject());
+            ASSERT("4" == (*(*it)[1][1].find("a")).value()[0].theNumber());
+
+            ++it;
+            ASSERT((*it).isObject());
+            ASSERT(0 == (*it).size());
+            ASSERT((*it).beginObject() == (*it).endObject());
+
+            ++it;
+            ASSERT((*it).isString());
+            ASSERT("x" == (*it).rawString());
+
+            ++it;
+            ASSERT(it == end);
+
+            ASSERT("1" == root[0].theNumber());
+            ASSERT(root[1].isArray());
+            ASSERT(root[2].isArray());
+            ASSERT(root[3].isObject());
+            ASSERT(root[4].isString());
+        }
+
+        if (veryVerbose) cout << "Objects." << endl;
+        {
+            const char *INPUT = "{\"a\": {\"b\": [1, 2]},"
+                                " \"c\\u0064\": true,"
+                                " \"a\": 3,"
+                                " \"\": null}";
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(INPUT));
+
+            const View root = X.root();
+            ASSERT(root.isObject());
+            ASSERT(4 == root.size());
+
+            ObjectIterator       it  = root.beginObject();
+            const ObjectIterator end = root.endObject();
+
+            ASSERT("a" == (*it).name().rawString());
+            ASSERT((*it).nameEquals("a"));
+            ASSERT(!(*it).nameEquals("b"));
+            ASSERT((*it).value().isObject());
+
+            ObjectIterator prev = it++;
+            ASSERT(prev == root.beginObject());
+            ASSERT(prev != it);
+            ASSERT("c\\u0064" == (*it).name().rawString());
+            ASSERT((*it).name().hasEscapes());
+            ASSERT((*it).nameEquals("cd"));
+            ASSERT(!(*it).nameEquals("c\\u0064"));
+            ASSERT(!(*it).nameEquals("cdcdcdcdcdcd"));
+            ASSERT(true == (*it).value().theBoolean());
+
+            ASSERT(&++it == &it);
+            ASSERT((*it).nameEquals("a"));
+            ASSERT("3" == (*it).value().theNumber());
+
+            ++it;
+            ASSERT((*it).nameEquals(""));
+            ASSERT((*it).value().isNull());
+
+            ++it;
+            ASSERT(it == end);
+
+            ASSERT(root.find("a") == root.beginObject());
+            ASSERT((*root.find("a")).value().isObject());
+            ASSERT((*root.find("cd")).value().isBoolean());
+            ASSERT((*root.find("")).value().isNull());
+            ASSERT(root.find("b") == end);
+            ASSERT(root.find("c") == end);
+
+            ASSERT( root.contains("a"));
+            ASSERT( root.contains("cd"));
+            ASSERT( root.contains(""));
+            ASSERT(!root.contains("b"));
+            ASSERT(!root.contains("A"));
+
+            const View inner = (*root.find("a")).value();
+            ASSERT(1 == inner.size());
+            ASSERT(2 == (*inner.find("b")).value().size());
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load("[{}, 1]"));
+
+            const View root   = X.root();
+            const View object = root[0];
+            const View number = root[1];
+
+            ASSERT_PASS(root.size());
+            ASSERT_PASS(object.size());
+            ASSERT_FAIL(number.size());
+
+            ASSERT_PASS(root[1]);
+            ASSERT_FAIL(root[2]);
+            ASSERT_FAIL(object[0]);
+
+            ASSERT_PASS(root.beginArray());
+            ASSERT_FAIL(object.beginArray());
+            ASSERT_PASS(root.endArray());
+            ASSERT_FAIL(object.endArray());
+
+            ASSERT_PASS(object.beginObject());
+            ASSERT_FAIL(root.beginObject());
+            ASSERT_PASS(object.endObject());
+            ASSERT_FAIL(root.endObject());
+
+            ASSERT_PASS(object.find("a"));
+            ASSERT_FAIL(root.find("a"));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SCALAR ACCESSORS
+        //
+        // Concerns:
+        // 1. The type of each scalar is reported correctly.
+        //
+        // 2. The boolean, number, and string accessors return the value of
+        //    the referenced scalar.
+        //
+        // 3. The text of strings and numbers refers to the input.
+        //
+        // 4. `loadString` processes escape sequences.
+        //
+        // 5. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Using a table of scalars, load each, and verify the results of
+        //    the accessors.  (C-1..4)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   JsonType::Enum type() const;
+        //   bool isArray() const;
+        //   bool isBoolean() const;
+        //   bool isNull() const;
+        //   bool isNumber() const;
+        //   bool isObject() const;
+        //   bool isString() const;
+        //   bool theBoolean() const;
+        //   bsl::string_view theNumber() const;
+        //   int asInt(int *result) const;
+        //   int asInt64(bsls::Types::Int64 *result) const;
+        //   int asUint(unsigned int *result) const;
+        //   int asUint64(bsls::Types::Uint64 *result) const;
+        //   double asDouble() const;
+        //   bool hasEscapes() const;
+        //   int loadString(bsl::string *result) const;
+        //   bsl::string_view rawString() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR ACCESSORS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Types." << endl;
+        {
+            static const struct {
+                int             d_line;
+                const char     *d_input_p;
+                JsonType::Enum  d_type;
+            } DATA[] = {
+                //LINE  INPUT          TYPE
+                //----  -------------  -------------------
+                { L_,   "null",        JsonType::e_NULL    },
+                { L_,   " true ",      JsonType::e_BOOLEAN },
+                { L_,   "false",       JsonType::e_BOOLEAN },
+                { L_,   "0",           JsonType::e_NUMBER  },
+                { L_,   "-1.5e10",     JsonType::e_NUMBER  },
+                { L_,   "\"\"",        JsonType::e_STRING  },
+                { L_,   "\"abc\"",     JsonType::e_STRING  },
+                { L_,   "[]",          JsonType::e_ARRAY   },
+                { L_,   "{}",          JsonType::e_OBJECT  },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE  = DATA[ti].d_line;
+                const char *const    INPUT = DATA[ti].d_input_p;
+                const JsonType::Enum TYPE  = DATA[ti].d_type;
+
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(LINE, 0 == mX.load(INPUT));
+
+                const View V = X.root();
+
+                ASSERTV(LINE, TYPE == V.type());
+                ASSERTV(LINE, (JsonType::e_ARRAY   == TYPE) == V.isArray());
+                ASSERTV(LINE, (JsonType::e_BOOLEAN == TYPE) == V.isBoolean());
+                ASSERTV(LINE, (JsonType::e_NULL    == TYPE) == V.isNull());
+                ASSERTV(LINE, (JsonType::e_NUMBER  == TYPE) == V.isNumber());
+                ASSERTV(LINE, (JsonType::e_OBJECT  == TYPE) == V.isObject());
+                ASSERTV(LINE, (JsonType::e_STRING  == TYPE) == V.isString());
+            }
+        }
+
+        if (veryVerbose) cout << "Booleans." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.load("true"));
+            ASSERT(true == X.root().theBoolean());
+
+            ASSERT(0 == mX.load("false"));
+            ASSERT(false == X.root().theBoolean());
+        }
+
+        if (veryVerbose) cout << "Numbers." << endl;
+        {
+            const bsl::string INPUT = "[0, -17, 4294967295, 1e3, 2.5, "
+                                      "-9223372036854775808]";
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(INPUT));
+
+            const View V = X.root();
+
+            ASSERT("0"  == V[0].theNumber());
+            ASSERT(INPUT.data() + 1 == V[0].theNumber().data());
+
+            int    i;
+            Int64  i64;
+            unsigned int u;
+            Uint64 u64;
+
+            ASSERT(0 == V[1].asInt(&i));      ASSERT(-17 == i);
+            ASSERT(0 == V[1].asInt64(&i64));  ASSERT(-17 == i64);
+            ASSERT(0 != V[1].asUint(&u));
+            ASSERT(0 != V[1].asUint64(&u64));
+
+            ASSERT(0 != V[2].asInt(&i));
+            ASSERT(0 == V[2].asUint(&u));     ASSERT(4294967295u == u);
+            ASSERT(0 == V[2].asUint64(&u64)); ASSERT(4294967295u == u64);
+
+            ASSERT(0 == V[3].asInt(&i));      ASSERT(1000 == i);
+            ASSERT(1000.0 == V[3].asDouble());
+
+            ASSERT(0 != V[4].asInt(&i));
+            ASSERT(2.5 == V[4].asDouble());
+
+            ASSERT(0 == V[5].asInt64(&i64));
+            ASSERT(i64 < 0 && 0 == i64 + 9223372036854775807LL + 1);
+        }
+
+        if (veryVerbose) cout << "Strings." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+                bool        d_hasEscapes;
+                const char *d_value_p;
+            } DATA[] = {
+                //LINE  INPUT                        ESC  VALUE
+                //----  ---------------------------  ---  ------------------
+                { L_,   "\"\"",                      0,   ""                 },
+                { L_,   "\"abc\"",                   0,   "abc"              },
+                { L_,   "\"\xC3\xA9\"",              0,   "\xC3\xA9"         },
+                { L_,   "\"\\\"\"",                  1,   "\""               },
+                { L_,   "\"\\\\\"",                  1,   "\\"               },
+                { L_,   "\"a\\/b\"",                 1,   "a/b"              },
+                { L_,   "\"\\b\\f\\n\\r\\t\"",       1,   "\b\f\n\r\t"       },
+                { L_,   "\"\\u0041\\u00e9\"",        1,   "A\xC3\xA9"        },
+                { L_,   "\"\\uD83D\\uDE00\"",        1,   "\xF0\x9F\x98\x80" },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE        = DATA[ti].d_line;
+                const char *const INPUT       = DATA[ti].d_input_p;
+                const bool        HAS_ESCAPES = DATA[ti].d_hasEscapes;
+                const char *const VALUE       = DATA[ti].d_value_p;
+
+                const bsl::string_view input(INPUT);
+
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(LINE, 0 == mX.load(input));
+
+                const View V = X.root();
+
+                ASSERTV(LINE, HAS_ESCAPES == V.hasEscapes());
+                ASSERTV(LINE, input.substr(1, input.length() - 2) ==
+                                                              V.rawString());
+                ASSERTV(LINE, INPUT + 1 == V.rawString().data());
+
+                bsl::string value(&ta);
+                ASSERTV(LINE, 0 == V.loadString(&value));
+                ASSERTV(LINE, value, VALUE == value);
+            }
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load("[true, 1, \"a\"]"));
+
+            const View boolean = X.root()[0];
+            const View number  = X.root()[1];
+            const View string  = X.root()[2];
+
+            int         i;
+            bsl::string s(&ta);
+
+            ASSERT_PASS(boolean.theBoolean());
+            ASSERT_FAIL(number.theBoolean());
+
+            ASSERT_PASS(number.theNumber());
+            ASSERT_FAIL(string.theNumber());
+
+            ASSERT_PASS(number.asInt(&i));
+            ASSERT_FAIL(number.asInt(0));
+            ASSERT_FAIL(boolean.asInt(&i));
+
+            ASSERT_PASS(string.rawString());
+            ASSERT_FAIL(number.rawString());
+
+            ASSERT_PASS(string.hasEscapes());
+            ASSERT_FAIL(number.hasEscapes());
+
+            ASSERT_PASS(string.loadString(&s));
+            ASSERT_FAIL(string.loadString(0));
+            ASSERT_FAIL(number.loadString(&s));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DOCUMENT CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A default constructed document is not loaded, and uses the
+        //    default allocator.
+        //
+        // 2. A successfully loaded document refers to its input, has a node
+        //    for each value and member name, and allocates only from the
+        //    supplied allocator.
+        //
+        // 3. `reset` empties the document, retaining its memory, which is
+        //    reused by subsequent loads.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Create documents with and without an allocator, and verify the
+        //    results of the accessors.  (C-1)
+        //
+        // 2. Load documents, and verify the results of the accessors and the
+        //    use of the allocators.  (C-2)
+        //
+        // 3. Reset a loaded document and load it again, verifying that no
+        //    further memory is allocated.  (C-3)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   explicit JsonViewDocument(bslma::Allocator *basicAllocator = 0);
+        //   ~JsonViewDocument();
+        //   int load(const bsl::string_view& input);
+        //   void reset();
+        //   bsl::string_view input() const;
+        //   bool isLoaded() const;
+        //   bsl::size_t numNodes() const;
+        //   JsonView root() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DOCUMENT CREATORS AND ACCESSORS" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(!X.isLoaded());
+            ASSERT(0 == X.numNodes());
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(!X.isLoaded());
+            ASSERT(0 == X.numNodes());
+
+            const bsl::string_view INPUT("{\"a\": [1, 2, {\"b\": null}], "
+                                         "\"c\": \"d\"}");
+
+            ASSERT(0 == mX.load(INPUT));
+            ASSERT(X.isLoaded());
+            ASSERT(INPUT.data()   == X.input().data());
+            ASSERT(INPUT.length() == X.input().length());
+
+            // object, "a", array, 1, 2, object, "b", null, "c", "d"
+
+            ASSERT(10 == X.numNodes());
+            ASSERT(X.root().isObject());
+            ASSERT(0 <  ta.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+
+            const Int64 numBlocks = ta.numBlocksTotal();
+
+            mX.reset();
+            ASSERT(!X.isLoaded());
+            ASSERT(0 == X.numNodes());
+            ASSERT(0 <  ta.numBlocksInUse());
+
+            ASSERT(0 == mX.load(INPUT));
+            ASSERT(10 == X.numNodes());
+            ASSERT(numBlocks == ta.numBlocksTotal());
+
+            ASSERT(0 == mX.load("[true]"));
+            ASSERT(2 == X.numNodes());
+            ASSERT(X.root()[0].theBoolean());
+            ASSERT(numBlocks == ta.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.root());
+            ASSERT_FAIL(X.input());
+
+            ASSERT(0 == mX.load("1"));
+
+            ASSERT_PASS(X.root());
+            ASSERT_PASS(X.input());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Load a document and access its values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(0 == mX.load("{\"name\": \"value\", \"list\": [1, true]}"));
+
+        const View root = X.root();
+        ASSERT(root.isObject());
+        ASSERT(2 == root.size());
+        ASSERT(root.contains("name"));
+        ASSERT("value" == (*root.find("name")).value().rawString());
+
+        const View list = (*root.find("list")).value();
+        ASSERT(list.isArray());
+        ASSERT(2 == list.size());
+        ASSERT("1" == list[0].theNumber());
+        ASSERT(true == list[1].theBoolean());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare loading a document with reading a `Json` object.
+        //
+        // Concerns:
+        // 1. Loading a large document is faster than reading a `Json` object
+        //    from it, and allocates far less memory.
+        //
+        // Plan:
+        // 1. Generate a large document, then time loading it, and reading a
+        //    `Json` object from it, reporting the times and the memory
+        //    allocated.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        bsl::string input("[\n");
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            input += "  {\"id\": 12345678, \"name\": \"record name\", "
+                     "\"enabled\": true, \"weights\": [0.5, 1.25, 2], "
+                     "\"path\": \"C:\\\\data\\\\file.txt\"},\n";
+        }
+        input += "  null\n]\n";
+
+        bslma::TestAllocator viewAllocator("view");
+        bslma::TestAllocator jsonAllocator("json");
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        {
+            Obj mX(&viewAllocator);
+            ASSERT(0 == mX.load(input));
+        }
+        timer.stop();
+        const double viewTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        {
+            Json json(&jsonAllocator);
+            ASSERT(0 == bdljsn::JsonUtil::read(&json, input));
+        }
+        timer.stop();
+        const double jsonTime = timer.elapsedTime();
+
+        cout << "Input size:    " << input.length() << " bytes" << endl
+             << "JsonViewDocument::load: " << viewTime << "s, "
+             << viewAllocator.numBytesMax() << " bytes (max), "
+             << viewAllocator.numBlocksTotal() << " allocations" << endl
+             << "JsonUtil::read:         " << jsonTime << "s, "
+             << jsonAllocator.numBytesMax() << " bytes (max), "
+             << jsonAllocator.numBlocksTotal() << " allocations" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
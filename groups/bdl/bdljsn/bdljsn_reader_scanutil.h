@@ -0,0 +1,148 @@
+// bdljsn_reader_scanutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLJSN_READER_SCANUTIL
+#define INCLUDED_BDLJSN_READER_SCANUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide character classification shared by the JSON readers.
+//
+//@CLASSES:
+//  bdljsn::Reader_ScanUtil: namespace for JSON lexical scanning functions
+//
+//@SEE_ALSO: bdljsn_jsonview, bdljsn_streamreader
+//
+//@DESCRIPTION: This component provides a `struct`,
+// `bdljsn::Reader_ScanUtil`, that serves as a namespace for the lexical
+// functions shared by the parser of `bdljsn::JsonView` and by
+// `bdljsn::StreamReader`, so that both accept exactly the same language (see
+// `bdljsn::JsonUtil::read`):
+//
+// * `isWhitespace`: whether a character separates tokens (one of ' ', '\t',
+//   '\n', '\v', and '\r').
+// * `isScalarTerminator`: whether a character ends a scalar that is not a
+//   string (whitespace, '\f', a structural character, or '"').
+// * `isHexDigit` and `parseHex4`: the digits of a `\u` escape sequence.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                           // ======================
+                           // struct Reader_ScanUtil
+                           // ======================
+
+/// This component-private `struct` provides a namespace for the lexical
+/// functions used by the JSON readers of this package.
+struct Reader_ScanUtil {
+
+    // CLASS METHODS
+
+    /// Return `true` if the specified `ch` is a hexadecimal digit, and
+    /// `false` otherwise.
+    static bool isHexDigit(char ch);
+
+    /// Return `true` if the specified `ch` terminates a scalar that is not
+    /// a string, and `false` otherwise.
+    static bool isScalarTerminator(char ch);
+
+    /// Return `true` if the specified `ch` is whitespace, and `false`
+    /// otherwise.
+    static bool isWhitespace(char ch);
+
+    /// Load into the specified `result` the value of the 4 hexadecimal
+    /// digits starting at the specified `digits`.  Return 0 on success, and
+    /// a non-zero value, with no effect on `result`, if those characters
+    /// are not all hexadecimal digits.  The behavior is undefined unless
+    /// `digits` refers to at least 4 characters.
+    static int parseHex4(unsigned int *result, const char *digits);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // struct Reader_ScanUtil
+                           // ----------------------
+
+// CLASS METHODS
+inline
+bool Reader_ScanUtil::isHexDigit(char ch)
+{
+    return ('0' <= ch && ch <= '9')
+        || ('a' <= ch && ch <= 'f')
+        || ('A' <= ch && ch <= 'F');
+}
+
+inline
+bool Reader_ScanUtil::isScalarTerminator(char ch)
+{
+    switch (ch) {
+      case ' ':
+      case '\n':
+      case '\t':
+      case '\r':
+      case '\v':
+      case '\f':
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '"': {
+        return true;                                                  // RETURN
+      }
+    }
+    return false;
+}
+
+inline
+bool Reader_ScanUtil::isWhitespace(char ch)
+{
+    return ' ' == ch || '\n' == ch || '\t' == ch || '\r' == ch || '\v' == ch;
+}
+
+inline
+int Reader_ScanUtil::parseHex4(unsigned int *result, const char *digits)
+{
+    unsigned int value = 0;
+    for (int i = 0; i < 4; ++i) {
+        const char ch = digits[i];
+        if (!isHexDigit(ch)) {
+            return -1;                                                // RETURN
+        }
+        value = (value << 4)
+              | (ch <= '9' ? ch - '0' : (ch | 0x20) - 'a' + 10);
+    }
+    *result = value;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,237 @@
+// bdljsn_reader_scanutil.t.cpp                                       -*-C++-*-
+#include <bdljsn_reader_scanutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// This component is a utility providing stateless functions.  The character
+// classification functions are tested exhaustively against the character
+// sets documented for the JSON readers, and `parseHex4` is tested using a
+// table of valid and invalid digit sequences.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] bool isHexDigit(char ch);
+// [ 1] bool isScalarTerminator(char ch);
+// [ 1] bool isWhitespace(char ch);
+// [ 2] int parseHex4(unsigned int *result, const char *digits);
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdljsn::Reader_ScanUtil Util;
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `parseHex4`
+        //
+        // Concerns:
+        // 1. `parseHex4` loads the value of 4 hexadecimal digits, in either
+        //    case, and returns 0.
+        //
+        // 2. `parseHex4` returns a non-zero value, and leaves `result`
+        //    unchanged, if any of the 4 characters is not a hexadecimal
+        //    digit.
+        //
+        // 3. `parseHex4` reads no more than 4 characters.
+        //
+        // Plan:
+        // 1. Using a table of digit sequences, some followed by further
+        //    characters, verify the status and the value loaded.  (C-1..3)
+        //
+        // Testing:
+        //   int parseHex4(unsigned int *result, const char *digits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `parseHex4`" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int           d_line;
+            const char   *d_digits;
+            int           d_isValid;
+            unsigned int  d_value;
+        } DATA[] = {
+            //LINE  DIGITS     VALID  VALUE
+            //----  ---------  -----  ------
+            { L_,   "0000",    1,     0x0000 },
+            { L_,   "0009",    1,     0x0009 },
+            { L_,   "00aF",    1,     0x00AF },
+            { L_,   "1234",    1,     0x1234 },
+            { L_,   "abcd",    1,     0xABCD },
+            { L_,   "ABCD",    1,     0xABCD },
+            { L_,   "FfFf",    1,     0xFFFF },
+            { L_,   "d83d",    1,     0xD83D },
+            { L_,   "12345",   1,     0x1234 },
+            { L_,   "0000g",   1,     0x0000 },
+            { L_,   "g000",    0,     0      },
+            { L_,   "000g",    0,     0      },
+            { L_,   "00 0",    0,     0      },
+            { L_,   "-123",    0,     0      },
+            { L_,   "0x12",    0,     0      },
+            { L_,   "12:4",    0,     0      },
+            { L_,   "12@4",    0,     0      },
+            { L_,   "12`4",    0,     0      },
+            { L_,   "12G4",    0,     0      },
+            { L_,   "12/4",    0,     0      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int           LINE   = DATA[ti].d_line;
+            const char *const   DIGITS = DATA[ti].d_digits;
+            const bool          VALID  = DATA[ti].d_isValid;
+            const unsigned int  VALUE  = DATA[ti].d_value;
+
+            if (veryVerbose) { T_ P_(LINE) P(DIGITS) }
+
+            const unsigned int SENTINEL = 0xBAD;
+            unsigned int       result   = SENTINEL;
+
+            const int rc = Util::parseHex4(&result, DIGITS);
+
+            ASSERTV(LINE, rc, VALID == (0 == rc));
+            ASSERTV(LINE, result, (VALID ? VALUE : SENTINEL) == result);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING CHARACTER CLASSIFICATION
+        //
+        // Concerns:
+        // 1. `isWhitespace` returns `true` for exactly ' ', '\t', '\n',
+        //    '\v', and '\r'.
+        //
+        // 2. `isScalarTerminator` returns `true` for exactly the whitespace
+        //    characters, '\f', the structural characters, and '"'.
+        //
+        // 3. `isHexDigit` returns `true` for exactly the decimal digits and
+        //    the letters 'a' to 'f' in either case.
+        //
+        // 4. Characters having the high-order bit set are classified
+        //    correctly whether `char` is signed or not.
+        //
+        // Plan:
+        // 1. For every value of `char`, compare the result of each function
+        //    with membership in a string of the expected characters.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   bool isHexDigit(char ch);
+        //   bool isScalarTerminator(char ch);
+        //   bool isWhitespace(char ch);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CHARACTER CLASSIFICATION" << endl
+                          << "================================" << endl;
+
+        const char *const WHITESPACE  = " \t\n\v\r";
+        const char *const TERMINATORS = " \t\n\v\r\f{}[]:,\"";
+        const char *const HEX_DIGITS  = "0123456789abcdefABCDEF";
+
+        for (int i = CHAR_MIN; i <= CHAR_MAX; ++i) {
+            const char CH = static_cast<char>(i);
+
+            // `strchr` also finds the terminating null character.
+
+            const bool EXP_WHITESPACE = 0 != CH
+                                     && 0 != bsl::strchr(WHITESPACE, CH);
+            const bool EXP_TERMINATOR = 0 != CH
+                                     && 0 != bsl::strchr(TERMINATORS, CH);
+            const bool EXP_HEX_DIGIT  = 0 != CH
+                                     && 0 != bsl::strchr(HEX_DIGITS, CH);
+
+            ASSERTV(i, EXP_WHITESPACE == Util::isWhitespace(CH));
+            ASSERTV(i, EXP_TERMINATOR == Util::isScalarTerminator(CH));
+            ASSERTV(i, EXP_HEX_DIGIT  == Util::isHexDigit(CH));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
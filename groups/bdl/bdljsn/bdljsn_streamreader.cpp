@@ -0,0 +1,500 @@
+// bdljsn_streamreader.cpp                                            -*-C++-*-
+#include <bdljsn_streamreader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_streamreader_cpp, "$Id$ $CSID$")
+
+#include <bdljsn_location.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_reader_scanutil.h>
+#include <bdljsn_stringutil.h>
+
+#include <bdlde_utf8util.h>
+
+#include <bsla_fallthrough.h>
+
+#include <bsls_assert.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The reader is a state machine whose state (`d_state` and `d_contextStack`)
+// records what may follow the last token read, so that `advance` can return
+// at any point where the input runs out, and resume when more input is
+// supplied.  The language accepted is that of `bdljsn::JsonUtil::read` (see
+// the implementation notes of `bdljsn_jsonview`), except that, rather than
+// validating the whole input as UTF-8 up front, the contents of each string
+// are validated when the string is read (which is equivalent, as the
+// remaining tokens are restricted to ASCII by their syntax).
+//
+// When a string or other scalar extends beyond the input supplied so far,
+// the cursor is left at the start of the token so that the token's text is
+// retained (contiguously) when the next chunk is appended, and `d_scanOffset`
+// records how much of the token has already been checked, so that long
+// tokens supplied in many small chunks are not rescanned from their start.
+
+namespace BloombergLP {
+namespace bdljsn {
+
+namespace {
+
+typedef Reader_ScanUtil ScanUtil;
+
+}  // close unnamed namespace
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+int StreamReader::closeContainer()
+{
+    d_tokenType   = '}' == d_buffer[d_cursor] ? e_END_OBJECT : e_END_ARRAY;
+    d_tokenOffset = d_bufferOffset + d_cursor;
+    ++d_cursor;
+
+    d_contextStack.pop_back();
+    completeValue();
+    return 0;
+}
+
+void StreamReader::completeValue()
+{
+    if (d_contextStack.empty()) {
+        d_state              = e_EXPECT_END_OF_INPUT;
+        d_isCompleteDocument = true;
+    }
+    else {
+        d_state = e_EXPECT_SEPARATOR;
+    }
+}
+
+int StreamReader::fail(const char *message, int status)
+{
+    d_error.setMessage(message);
+    d_error.setLocation(Location(d_bufferOffset + d_cursor));
+    d_tokenType = e_NONE;
+    d_status    = status;
+    return status;
+}
+
+int StreamReader::openContainer()
+{
+    // The top-level value is at depth 1 (see `bdljsn::JsonUtil::read`).
+
+    if (static_cast<int>(d_contextStack.size()) >=
+                                                 d_options.maxNestedDepth()) {
+        return fail("Maximum nesting depth exceeded", -4);            // RETURN
+    }
+
+    const char ch = d_buffer[d_cursor];
+
+    d_contextStack.push_back(ch);
+    d_state       = '{' == ch ? e_EXPECT_NAME_OR_END_OBJECT
+                              : e_EXPECT_VALUE_OR_END_ARRAY;
+    d_tokenType   = '{' == ch ? e_START_OBJECT : e_START_ARRAY;
+    d_tokenOffset = d_bufferOffset + d_cursor;
+    ++d_cursor;
+    return 0;
+}
+
+int StreamReader::readScalar()
+{
+    const char  *begin  = d_buffer.data() + d_cursor;
+    const char  *end    = d_buffer.data() + d_buffer.size();
+    const char  *cursor = begin + d_scanOffset;
+
+    while (cursor != end && !ScanUtil::isScalarTerminator(*cursor)) {
+        ++cursor;
+    }
+
+    if (cursor == end && !d_isInputComplete) {
+        d_scanOffset = cursor - begin;
+        return k_NEED_MORE_INPUT;                                     // RETURN
+    }
+    d_scanOffset = 0;
+
+    const bsl::string_view text(begin, cursor - begin);
+
+    if (text.empty()) {
+        return fail("Unexpected character");                          // RETURN
+    }
+
+    if ("null" == text) {
+        d_valueType = JsonType::e_NULL;
+    }
+    else if ("true" == text || "false" == text) {
+        d_valueType    = JsonType::e_BOOLEAN;
+        d_booleanValue = "true" == text;
+    }
+    else if (NumberUtil::isValidNumber(text)) {
+        d_valueType = JsonType::e_NUMBER;
+    }
+    else {
+        return fail("Invalid JSON Number");                           // RETURN
+    }
+
+    d_tokenType   = e_VALUE;
+    d_tokenOffset = d_bufferOffset + d_cursor;
+    d_valueBegin  = d_cursor;
+    d_valueLength = text.length();
+
+    d_cursor += text.length();
+
+    completeValue();
+    return 0;
+}
+
+int StreamReader::readString(TokenType tokenType)
+{
+    const char *begin  = d_buffer.data() + d_cursor;
+    const char *end    = d_buffer.data() + d_buffer.size();
+    const char *cursor = begin + (d_scanOffset ? d_scanOffset : 1);
+
+    bool hasEscapes = d_scanHasEscapes;
+
+    while (true) {
+        // Skip ordinary characters before examining the next character of
+        // interest.
+
+        while (cursor != end
+            && '"'  != *cursor
+            && '\\' != *cursor
+            && static_cast<unsigned char>(*cursor) > 0x1F) {
+            ++cursor;
+        }
+
+        if (cursor != end && '"' == *cursor) {
+            break;
+        }
+
+        if (cursor != end && '\\' != *cursor) {
+            d_cursor = cursor - d_buffer.data();
+            return fail("Unescaped control character in string");     // RETURN
+        }
+
+        // The cursor is either at the end of the input, or at the start of
+        // an escape sequence, which may itself be incomplete.
+
+        const bsl::size_t available = end - cursor;
+        bsl::size_t       needed    = 2;
+
+        if (2 <= available && 'u' == cursor[1]) {
+            // A high surrogate must be followed by a low surrogate (encoded
+            // as an escape sequence), so read both together.
+
+            needed = 6;
+
+            unsigned int codeUnit;
+            if (6 <= available
+             && 0 == ScanUtil::parseHex4(&codeUnit, cursor + 2)
+             && 0xD800 <= codeUnit && codeUnit <= 0xDBFF) {
+                needed = 12;
+            }
+        }
+
+        if (available < needed && !d_isInputComplete) {
+            d_scanOffset     = cursor - begin;
+            d_scanHasEscapes = hasEscapes;
+            return k_NEED_MORE_INPUT;                                 // RETURN
+        }
+
+        if (available < 2) {
+            d_cursor = d_buffer.size();
+            return fail("Unexpected end of input");                   // RETURN
+        }
+
+        hasEscapes = true;
+
+        switch (cursor[1]) {
+          case '"':
+          case '\\':
+          case '/':
+          case 'b':
+          case 'f':
+          case 'n':
+          case 'r':
+          case 't': {
+            cursor += 2;
+          } break;
+          case 'u': {
+            unsigned int codeUnit;
+            if (available < 6
+             || ScanUtil::parseHex4(&codeUnit, cursor + 2)
+             || (0xDC00 <= codeUnit && codeUnit <= 0xDFFF)) {
+                d_cursor = cursor - d_buffer.data();
+                return fail("Invalid escape sequence");               // RETURN
+            }
+            cursor += 6;
+
+            if (0xD800 <= codeUnit && codeUnit <= 0xDBFF) {
+                if (end - cursor < 6
+                 || '\\' != cursor[0]
+                 || 'u'  != cursor[1]
+                 || ScanUtil::parseHex4(&codeUnit, cursor + 2)
+                 || codeUnit < 0xDC00
+                 || 0xDFFF < codeUnit) {
+                    d_cursor = cursor - d_buffer.data();
+                    return fail("Invalid escape sequence");           // RETURN
+                }
+                cursor += 6;
+            }
+          } break;
+          default: {
+            d_cursor = cursor - d_buffer.data();
+            return fail("Invalid escape sequence");                   // RETURN
+          }
+        }
+    }
+
+    d_scanOffset     = 0;
+    d_scanHasEscapes = false;
+
+    const char *invalid;
+    if (!bdlde::Utf8Util::isValid(&invalid, begin + 1, cursor - begin - 1)) {
+        d_cursor = invalid - d_buffer.data();
+        return fail("Invalid UTF-8");                                 // RETURN
+    }
+
+    d_tokenType   = tokenType;
+    d_tokenOffset = d_bufferOffset + d_cursor;
+    d_valueBegin  = d_cursor + 1;
+    d_valueLength = cursor - begin - 1;
+    d_hasEscapes  = hasEscapes;
+    d_cursor      = cursor - d_buffer.data() + 1;  // past the closing quote
+
+    if (e_MEMBER_NAME == tokenType) {
+        d_state = e_EXPECT_COLON;
+    }
+    else {
+        d_valueType = JsonType::e_STRING;
+        completeValue();
+    }
+    return 0;
+}
+
+// CREATORS
+StreamReader::StreamReader(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_cursor(0)
+, d_bufferOffset(0)
+, d_scanOffset(0)
+, d_scanHasEscapes(false)
+, d_contextStack(basicAllocator)
+, d_state(e_EXPECT_VALUE)
+, d_tokenType(e_NONE)
+, d_valueType(JsonType::e_NULL)
+, d_valueBegin(0)
+, d_valueLength(0)
+, d_hasEscapes(false)
+, d_booleanValue(false)
+, d_tokenOffset(0)
+, d_isCompleteDocument(false)
+, d_isInputComplete(false)
+, d_allowMultipleDocuments(false)
+, d_options()
+, d_error(basicAllocator)
+, d_status(0)
+{
+}
+
+StreamReader::StreamReader(const ReadOptions&  options,
+                           bslma::Allocator   *basicAllocator)
+: d_buffer(basicAllocator)
+, d_cursor(0)
+, d_bufferOffset(0)
+, d_scanOffset(0)
+, d_scanHasEscapes(false)
+, d_contextStack(basicAllocator)
+, d_state(e_EXPECT_VALUE)
+, d_tokenType(e_NONE)
+, d_valueType(JsonType::e_NULL)
+, d_valueBegin(0)
+, d_valueLength(0)
+, d_hasEscapes(false)
+, d_booleanValue(false)
+, d_tokenOffset(0)
+, d_isCompleteDocument(false)
+, d_isInputComplete(false)
+, d_allowMultipleDocuments(false)
+, d_options(options)
+, d_error(basicAllocator)
+, d_status(0)
+{
+}
+
+StreamReader::~StreamReader()
+{
+}
+
+// MANIPULATORS
+int StreamReader::advance()
+{
+    if (d_status) {
+        return d_status;                                              // RETURN
+    }
+
+    d_tokenType          = e_NONE;
+    d_isCompleteDocument = false;
+
+    if (e_EXPECT_END_OF_INPUT == d_state
+     && !d_allowMultipleDocuments
+     && d_options.allowTrailingText()) {
+        return k_END_OF_INPUT;                                        // RETURN
+    }
+
+    if (d_scanOffset) {
+        // Resume reading a partially read token.
+
+        return '"' == d_buffer[d_cursor]
+               ? readString(e_EXPECT_NAME == d_state ? e_MEMBER_NAME
+                                                      : e_VALUE)
+               : readScalar();                                        // RETURN
+    }
+
+    while (true) {
+        const bsl::size_t length = d_buffer.size();
+        while (d_cursor != length
+            && ScanUtil::isWhitespace(d_buffer[d_cursor])) {
+            ++d_cursor;
+        }
+
+        if (d_cursor == length) {
+            if (!d_isInputComplete) {
+                return k_NEED_MORE_INPUT;                             // RETURN
+            }
+            if (e_EXPECT_END_OF_INPUT == d_state
+             || (d_allowMultipleDocuments
+              && e_EXPECT_VALUE == d_state
+              && d_contextStack.empty())) {
+                return k_END_OF_INPUT;                                // RETURN
+            }
+            return fail("Unexpected end of input");                   // RETURN
+        }
+
+        const char ch = d_buffer[d_cursor];
+
+        switch (d_state) {
+          case e_EXPECT_END_OF_INPUT: {
+            if (!d_allowMultipleDocuments) {
+                return fail("Additional text found after document");  // RETURN
+            }
+            d_state = e_EXPECT_VALUE;
+          } continue;
+          case e_EXPECT_VALUE_OR_END_ARRAY: {
+            if (']' == ch) {
+                return closeContainer();                              // RETURN
+            }
+            BSLA_FALLTHROUGH;
+          }
+          case e_EXPECT_VALUE: {
+            if ('{' == ch || '[' == ch) {
+                return openContainer();                               // RETURN
+            }
+            if ('"' == ch) {
+                return readString(e_VALUE);                           // RETURN
+            }
+            return readScalar();                                      // RETURN
+          }
+          case e_EXPECT_NAME_OR_END_OBJECT: {
+            if ('}' == ch) {
+                return closeContainer();                              // RETURN
+            }
+            BSLA_FALLTHROUGH;
+          }
+          case e_EXPECT_NAME: {
+            if ('"' != ch) {
+                return fail("Expected e_ELEMENT_NAME in object", -2); // RETURN
+            }
+            d_state = e_EXPECT_NAME;
+            return readString(e_MEMBER_NAME);                         // RETURN
+          }
+          case e_EXPECT_COLON: {
+            if (':' != ch) {
+                return fail("Unexpected character");                  // RETURN
+            }
+            ++d_cursor;
+            d_state = e_EXPECT_VALUE;
+          } continue;
+          case e_EXPECT_SEPARATOR: {
+            const char context = d_contextStack.back();
+            if (',' == ch) {
+                ++d_cursor;
+                d_state = '{' == context ? e_EXPECT_NAME : e_EXPECT_VALUE;
+                continue;
+            }
+            if (('}' == ch && '{' == context)
+             || (']' == ch && '[' == context)) {
+                return closeContainer();                              // RETURN
+            }
+            return fail("Unexpected character");                      // RETURN
+          }
+        }
+    }
+}
+
+void StreamReader::appendInput(const bsl::string_view& input)
+{
+    BSLS_ASSERT(!d_isInputComplete);
+
+    if (d_cursor) {
+        d_buffer.erase(0, d_cursor);
+        d_bufferOffset += d_cursor;
+        d_cursor        = 0;
+    }
+    d_buffer.append(input.data(), input.length());
+
+    d_tokenType = e_NONE;
+}
+
+void StreamReader::reset()
+{
+    d_buffer.clear();
+    d_cursor             = 0;
+    d_bufferOffset       = 0;
+    d_scanOffset         = 0;
+    d_scanHasEscapes     = false;
+    d_contextStack.clear();
+    d_state              = e_EXPECT_VALUE;
+    d_tokenType          = e_NONE;
+    d_isCompleteDocument = false;
+    d_isInputComplete    = false;
+    d_error.reset();
+    d_status             = 0;
+}
+
+// ACCESSORS
+int StreamReader::loadString(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(e_MEMBER_NAME == d_tokenType ||
+                (e_VALUE == d_tokenType &&
+                 JsonType::e_STRING == d_valueType));
+
+    const bsl::string_view text(d_buffer.data() + d_valueBegin,
+                                d_valueLength);
+
+    if (!d_hasEscapes) {
+        result->assign(text.data(), text.length());
+        return 0;                                                     // RETURN
+    }
+    return StringUtil::readUnquotedString(result, text);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
@@ -0,0 +1,567 @@
+// bdljsn_streamreader.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLJSN_STREAMREADER
+#define INCLUDED_BDLJSN_STREAMREADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an incremental, event-based reader of JSON text.
+//
+//@CLASSES:
+//  bdljsn::StreamReader: resumable pull reader of JSON text supplied in chunks
+//
+//@SEE_ALSO: bdljsn_streamwriter, bdljsn_jsonutil, bdljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a mechanism, `bdljsn::StreamReader`,
+// that reads JSON text as a sequence of *tokens* (the start and end of each
+// object and array, the name of each member, and each scalar value) without
+// building a representation of the document.  Unlike
+// `bdljsn::JsonUtil::read`, which materializes the whole document as a
+// `bdljsn::Json` object, a `StreamReader` holds only the text of the token
+// being read, and so can process documents (and sequences of documents)
+// larger than the available memory.
+//
+// The JSON text is supplied by the client, in chunks of any size, by calling
+// `appendInput`; the end of the text is indicated by calling `finishInput`.
+// Tokens are read by calling `advance`, which returns:
+//
+// * 0 if a token was read, whose kind is then returned by `tokenType`;
+// * `k_NEED_MORE_INPUT` if the input supplied so far ends before the next
+//   token does (e.g., in the middle of a string), in which case the client
+//   should supply more input (or call `finishInput`) and call `advance`
+//   again;
+// * `k_END_OF_INPUT` if the document has been completely read; or
+// * a negative value if the text is not valid JSON, in which case `error`
+//   describes the problem and its location in the input.
+//
+// Reading is therefore *resumable*: a token may be split across any number of
+// chunks, and `advance` never blocks waiting for input.  A chunk is copied
+// when it is appended, and the text that has already been read is discarded
+// at that point, so the memory used by the reader is bounded by the size of
+// the largest token plus the size of a chunk.
+//
+// The text of the current member name, string, or number refers to the
+// reader's buffer, and is valid until the next call to `advance`,
+// `appendInput`, or `reset`.  The escape sequences in a string are only
+// processed when a client asks for the string's value (see `loadString`).
+//
+///Conformance
+///-----------
+// A `StreamReader` accepts the same JSON text as `bdljsn::JsonUtil::read`,
+// honoring the same `bdljsn::ReadOptions`, and reports errors with the same
+// messages.  Note that, as tokens are reported as soon as they are read, a
+// client may receive some tokens of a document before an error later in the
+// document is detected.  Also note that a `StreamReader` reports every member
+// of an object, including members having the same name as an earlier member
+// (`bdljsn::JsonUtil::read` retains the first of such members).
+//
+///Sequences of Documents
+///- - - - - - - - - - - -
+// By default, a `StreamReader` reads a single document, and it is an error
+// for the input to contain anything other than whitespace after that
+// document, unless the `allowTrailingText` read option is `true`, in which
+// case `advance` returns `k_END_OF_INPUT` once the document is read.  A
+// reader configured with `setAllowMultipleDocuments(true)` instead reads a
+// (possibly empty) sequence of documents separated by optional whitespace,
+// such as a *JSON* *Lines* stream (see https://jsonlines.org).  The
+// `isCompleteDocument` accessor indicates whether the last token read
+// completes a (top-level) document.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summing Values from a JSON Lines Stream
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a stream of trade records in the JSON Lines format, one
+// object per line, in chunks of arbitrary size, and want to total the value
+// of the `quantity` member of each record, without building a `bdljsn::Json`
+// object for each record.
+//
+// First, we create a reader for a sequence of documents:
+// ```
+// bdljsn::StreamReader reader;
+// reader.setAllowMultipleDocuments(true);
+// ```
+// Then, we define the chunks of input.  Note that a chunk may end in the
+// middle of a token:
+// ```
+// const char *const CHUNKS[] = {
+//     "{\"symbol\": \"IBM\", \"quantity\": 10",
+//     "0}\n{\"symbol\": \"A\\u0041PL\", \"q",
+//     "uantity\": 25, \"notes\": [\"odd\", 1]}\n",
+//     "{\"quantity\": 5}\n"
+// };
+// const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+// ```
+// Next, we supply each chunk in turn, and read tokens until the reader needs
+// more input.  We note when we read a member name `quantity` directly within
+// a record, and then add the subsequent number to our total:
+// ```
+// long long total       = 0;
+// int       numRecords  = 0;
+// bool      isQuantity  = false;
+//
+// for (int i = 0; i <= NUM_CHUNKS; ++i) {
+//     if (i < NUM_CHUNKS) {
+//         reader.appendInput(CHUNKS[i]);
+//     }
+//     else {
+//         reader.finishInput();
+//     }
+//
+//     int rc;
+//     while (0 == (rc = reader.advance())) {
+//         switch (reader.tokenType()) {
+//           case bdljsn::StreamReader::e_MEMBER_NAME: {
+//             isQuantity = 1 == reader.depth()
+//                       && "quantity" == reader.rawString();
+//           } break;
+//           case bdljsn::StreamReader::e_VALUE: {
+//             if (isQuantity) {
+//                 int quantity;
+//                 assert(reader.valueType() == bdljsn::JsonType::e_NUMBER);
+//                 assert(0 == bdljsn::NumberUtil::asInt(&quantity,
+//                                                       reader.theNumber()));
+//                 total += quantity;
+//             }
+//             isQuantity = false;
+//           } break;
+//           default: {
+//             isQuantity = false;
+//           } break;
+//         }
+//         if (reader.isCompleteDocument()) {
+//             ++numRecords;
+//         }
+//     }
+//     assert(0 < rc);  // no error
+// }
+// ```
+// Finally, we verify the results:
+// ```
+// assert(3   == numRecords);
+// assert(130 == total);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_jsontype.h>
+#include <bdljsn_readoptions.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                             // ==================
+                             // class StreamReader
+                             // ==================
+
+/// This class provides a mechanism for reading JSON text, supplied in chunks,
+/// as a sequence of tokens.  See [](#Description).
+class StreamReader {
+
+  public:
+    // TYPES
+
+    /// Enumeration of the kinds of tokens.
+    enum TokenType {
+        e_NONE,          // no token is available
+        e_START_OBJECT,  // `{`
+        e_END_OBJECT,    // `}`
+        e_START_ARRAY,   // `[`
+        e_END_ARRAY,     // `]`
+        e_MEMBER_NAME,   // name of an object member
+        e_VALUE          // string, number, boolean, or null value
+    };
+
+    enum {
+        k_NEED_MORE_INPUT = 1,  // more input is needed to read a token
+        k_END_OF_INPUT    = 2   // the input has been completely read
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// Enumeration of what the reader expects to read next.
+    enum State {
+        e_EXPECT_VALUE,
+        e_EXPECT_VALUE_OR_END_ARRAY,
+        e_EXPECT_NAME,
+        e_EXPECT_NAME_OR_END_OBJECT,
+        e_EXPECT_COLON,
+        e_EXPECT_SEPARATOR,
+        e_EXPECT_END_OF_INPUT
+    };
+
+    // DATA
+    bsl::string          d_buffer;             // input not yet discarded
+    bsl::size_t          d_cursor;             // next character in
+                                               // `d_buffer`
+
+    bsls::Types::Uint64  d_bufferOffset;       // input offset of `d_buffer`
+
+    bsl::size_t          d_scanOffset;         // offset from `d_cursor` at
+                                               // which to resume reading a
+                                               // partially read token, or 0
+
+    bool                 d_scanHasEscapes;     // partially read string has
+                                               // escapes
+
+    bsl::vector<char>    d_contextStack;       // `{` or `[` per open
+                                               // container
+
+    State                d_state;              // what is expected next
+
+    TokenType            d_tokenType;          // current token
+
+    JsonType::Enum       d_valueType;          // type of the current value
+
+    bsl::size_t          d_valueBegin;         // current text in `d_buffer`
+    bsl::size_t          d_valueLength;        // length of current text
+
+    bool                 d_hasEscapes;         // current text has escapes
+
+    bool                 d_booleanValue;       // current boolean value
+
+    bsls::Types::Uint64  d_tokenOffset;        // input offset of the token
+
+    bool                 d_isCompleteDocument; // token completes a document
+
+    bool                 d_isInputComplete;    // `finishInput` was called
+
+    bool                 d_allowMultipleDocuments;
+                                               // read several documents
+
+    ReadOptions          d_options;            // options for reading
+
+    Error                d_error;              // description of any error
+
+    int                  d_status;             // error status, or 0
+
+  private:
+    // NOT IMPLEMENTED
+    StreamReader(const StreamReader&);
+    StreamReader& operator=(const StreamReader&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Complete reading the array or object closed by the character at the
+    /// cursor, and return 0.
+    int closeContainer();
+
+    /// Record that a value has been completely read.
+    void completeValue();
+
+    /// Load the error description with the specified `message` and the
+    /// current position, and return the specified `status`.
+    int fail(const char *message, int status = -1);
+
+    /// Open the array or object started by the character at the cursor.
+    /// Return 0 on success, and a non-zero value if doing so would exceed
+    /// the maximum nesting depth.
+    int openContainer();
+
+    /// Read a scalar other than a string starting at the cursor.  Return 0
+    /// on success, `k_NEED_MORE_INPUT` if the scalar may continue beyond the
+    /// input supplied so far, and a negative value otherwise.
+    int readScalar();
+
+    /// Read a string (whose opening quote is at the cursor) as a token of
+    /// the specified `tokenType`.  Return 0 on success, `k_NEED_MORE_INPUT`
+    /// if the string continues beyond the input supplied so far, and a
+    /// negative value otherwise.
+    int readString(TokenType tokenType);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StreamReader, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a reader, having no input, that reads a single document using
+    /// the optionally specified `options`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit StreamReader(bslma::Allocator   *basicAllocator = 0);
+    explicit StreamReader(const ReadOptions&  options,
+                          bslma::Allocator   *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamReader();
+
+    // MANIPULATORS
+
+    /// Read the next token from the input.  Return 0 if a token was read,
+    /// `k_NEED_MORE_INPUT` if the input supplied so far (by `appendInput`)
+    /// does not contain the whole of the next token, `k_END_OF_INPUT` if
+    /// there are no more tokens to read, and a negative value (loading
+    /// `error()` with a description of the error) if the input is not valid
+    /// JSON text.  Once this method returns a negative value, it returns the
+    /// same value until this reader is `reset`.  Note that the text of the
+    /// previous token is invalidated.
+    int advance();
+
+    /// Append the specified `input` to the input of this reader, discarding
+    /// any input that has already been read.  The behavior is undefined
+    /// if `finishInput` has been called since this reader was constructed
+    /// or last reset.  Note that the text of the current token is
+    /// invalidated.
+    void appendInput(const bsl::string_view& input);
+
+    /// Indicate that all input has been supplied.  Note that subsequently,
+    /// `advance` returns either 0, `k_END_OF_INPUT`, or a negative value.
+    void finishInput();
+
+    /// Reset this reader to its default-constructed state, except for the
+    /// options and the value of `allowMultipleDocuments`, discarding any
+    /// input.  Note that the memory held by the reader is retained.
+    void reset();
+
+    /// Set whether this reader reads a sequence of documents (separated by
+    /// optional whitespace), rather than a single document, to the
+    /// specified `value`, and return a reference providing modifiable
+    /// access to this object.  The behavior is undefined unless no token
+    /// has been read since this reader was constructed or last reset.
+    StreamReader& setAllowMultipleDocuments(bool value);
+
+    // ACCESSORS
+
+    /// Return `true` if this reader reads a sequence of documents, and
+    /// `false` otherwise.
+    bool allowMultipleDocuments() const;
+
+    /// Return the number of arrays and objects that are open after the
+    /// current token (e.g., 1 after the `{` of a top-level object, and 0
+    /// after the matching `}`).
+    int depth() const;
+
+    /// Return a description of the error encountered by `advance`, or a
+    /// default-constructed `Error` if no error has been encountered.
+    const Error& error() const;
+
+    /// Return `true` if the current token is the last token of a (top-level)
+    /// document (i.e., it completes an object, array, or scalar at depth 0),
+    /// and `false` otherwise.
+    bool isCompleteDocument() const;
+
+    /// Return `true` if `finishInput` has been called since this reader was
+    /// constructed or last reset, and `false` otherwise.
+    bool isInputComplete() const;
+
+    /// Return the options used by this reader.
+    const ReadOptions& options() const;
+
+    /// Return the kind of the current token, which is `e_NONE` unless the
+    /// last call to `advance` returned 0.
+    TokenType tokenType() const;
+
+    /// Return the offset in the input (i.e., in the concatenation of all
+    /// input supplied since this reader was constructed or last reset) of
+    /// the first character of the current token.  The behavior is undefined
+    /// if `e_NONE == tokenType()`.
+    bsls::Types::Uint64 tokenOffset() const;
+
+    /// Return the type of the current value.  The behavior is undefined
+    /// unless `e_VALUE == tokenType()`.
+    JsonType::Enum valueType() const;
+
+    /// Return the current boolean value.  The behavior is undefined unless
+    /// `e_VALUE == tokenType()` and `JsonType::e_BOOLEAN == valueType()`.
+    bool theBoolean() const;
+
+    /// Return the text of the current number.  The behavior is undefined
+    /// unless `e_VALUE == tokenType()` and
+    /// `JsonType::e_NUMBER == valueType()`.  Note that the returned text is
+    /// valid until the next call to a manipulator of this reader, and that
+    /// it may be converted using `bdljsn::NumberUtil`.
+    bsl::string_view theNumber() const;
+
+    /// Return `true` if the current member name or string contains escape
+    /// sequences, and `false` otherwise.  The behavior is undefined unless
+    /// `e_MEMBER_NAME == tokenType()`, or `e_VALUE == tokenType()` and
+    /// `JsonType::e_STRING == valueType()`.
+    bool hasEscapes() const;
+
+    /// Load into the specified `result` the value of the current member
+    /// name or string, processing any escape sequences.  Return 0 on
+    /// success, and a non-zero value otherwise.  The behavior is undefined
+    /// unless `e_MEMBER_NAME == tokenType()`, or `e_VALUE == tokenType()`
+    /// and `JsonType::e_STRING == valueType()`.
+    int loadString(bsl::string *result) const;
+
+    /// Return the text of the current member name or string, excluding the
+    /// enclosing quotes, in which escape sequences are *not* processed.
+    /// The behavior is undefined unless `e_MEMBER_NAME == tokenType()`, or
+    /// `e_VALUE == tokenType()` and `JsonType::e_STRING == valueType()`.
+    /// Note that the returned text is valid until the next call to a
+    /// manipulator of this reader, and that it is the value of the string if
+    /// `false == hasEscapes()`.
+    bsl::string_view rawString() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// MANIPULATORS
+inline
+void StreamReader::finishInput()
+{
+    d_isInputComplete = true;
+}
+
+inline
+StreamReader& StreamReader::setAllowMultipleDocuments(bool value)
+{
+    d_allowMultipleDocuments = value;
+    return *this;
+}
+
+// ACCESSORS
+inline
+bool StreamReader::allowMultipleDocuments() const
+{
+    return d_allowMultipleDocuments;
+}
+
+inline
+int StreamReader::depth() const
+{
+    return static_cast<int>(d_contextStack.size());
+}
+
+inline
+const Error& StreamReader::error() const
+{
+    return d_error;
+}
+
+inline
+bool StreamReader::isCompleteDocument() const
+{
+    return d_isCompleteDocument;
+}
+
+inline
+bool StreamReader::isInputComplete() const
+{
+    return d_isInputComplete;
+}
+
+inline
+const ReadOptions& StreamReader::options() const
+{
+    return d_options;
+}
+
+inline
+StreamReader::TokenType StreamReader::tokenType() const
+{
+    return d_tokenType;
+}
+
+inline
+bsls::Types::Uint64 StreamReader::tokenOffset() const
+{
+    BSLS_ASSERT(e_NONE != d_tokenType);
+
+    return d_tokenOffset;
+}
+
+inline
+JsonType::Enum StreamReader::valueType() const
+{
+    BSLS_ASSERT(e_VALUE == d_tokenType);
+
+    return d_valueType;
+}
+
+inline
+bool StreamReader::theBoolean() const
+{
+    BSLS_ASSERT(e_VALUE == d_tokenType);
+    BSLS_ASSERT(JsonType::e_BOOLEAN == d_valueType);
+
+    return d_booleanValue;
+}
+
+inline
+bsl::string_view StreamReader::theNumber() const
+{
+    BSLS_ASSERT(e_VALUE == d_tokenType);
+    BSLS_ASSERT(JsonType::e_NUMBER == d_valueType);
+
+    return bsl::string_view(d_buffer.data() + d_valueBegin, d_valueLength);
+}
+
+inline
+bool StreamReader::hasEscapes() const
+{
+    BSLS_ASSERT(e_MEMBER_NAME == d_tokenType ||
+                (e_VALUE == d_tokenType &&
+                 JsonType::e_STRING == d_valueType));
+
+    return d_hasEscapes;
+}
+
+inline
+bsl::string_view StreamReader::rawString() const
+{
+    BSLS_ASSERT(e_MEMBER_NAME == d_tokenType ||
+                (e_VALUE == d_tokenType &&
+                 JsonType::e_STRING == d_valueType));
+
+    return bsl::string_view(d_buffer.data() + d_valueBegin, d_valueLength);
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StreamReader::allocator() const
+{
+    return d_buffer.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
@@ -0,0 +1,1461 @@
+// bdljsn_streamreader.t.cpp                                          -*-C++-*-
+#include <bdljsn_streamreader.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_jsontestsuiteutil.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_location.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_readoptions.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism that reads JSON text,
+// supplied in chunks, as a sequence of tokens.  We test that the tokens read
+// from a variety of documents are as expected, irrespective of how the text
+// is split into chunks, that errors are reported at the expected locations,
+// that the read options are honored, and that the reader accepts exactly the
+// text accepted by `bdljsn::JsonUtil::read` (and represents the same values)
+// over the *JSON* *Test* *Suite*.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StreamReader(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit StreamReader(const ReadOptions&, bslma::Allocator * = 0);
+// [ 2] ~StreamReader();
+//
+// MANIPULATORS
+// [ 3] int advance();
+// [ 4] void appendInput(const bsl::string_view& input);
+// [ 2] void finishInput();
+// [ 2] void reset();
+// [ 6] StreamReader& setAllowMultipleDocuments(bool value);
+//
+// ACCESSORS
+// [ 2] bool allowMultipleDocuments() const;
+// [ 3] int depth() const;
+// [ 5] const Error& error() const;
+// [ 3] bool isCompleteDocument() const;
+// [ 2] bool isInputComplete() const;
+// [ 2] const ReadOptions& options() const;
+// [ 3] TokenType tokenType() const;
+// [ 3] bsls::Types::Uint64 tokenOffset() const;
+// [ 3] JsonType::Enum valueType() const;
+// [ 3] bool theBoolean() const;
+// [ 3] bsl::string_view theNumber() const;
+// [ 3] bool hasEscapes() const;
+// [ 3] int loadString(bsl::string *result) const;
+// [ 3] bsl::string_view rawString() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: TOKENS ARE INDEPENDENT OF HOW THE INPUT IS SPLIT
+// [ 5] CONCERN: ERRORS AND READ OPTIONS
+// [ 7] CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::StreamReader      Obj;
+typedef bdljsn::Error             Error;
+typedef bdljsn::Json              Json;
+typedef bdljsn::JsonArray         JsonArray;
+typedef bdljsn::JsonObject        JsonObject;
+typedef bdljsn::JsonType          JsonType;
+typedef bdljsn::JsonTestSuiteUtil JTSU;
+typedef bdljsn::ReadOptions       ReadOptions;
+
+typedef bsls::Types::Uint64       Uint64;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Append to the specified `result` a description of the current token of
+/// the specified `reader`, preceded by a space unless `result` is empty:
+/// `{`, `}`, `[`, `]`, `N:` followed by the raw text of a member name, `S:`
+/// followed by the raw text of a string, `#` followed by the text of a
+/// number, `true`, `false`, or `null`.
+void appendToken(bsl::string *result, const Obj& reader)
+{
+    if (!result->empty()) {
+        *result += ' ';
+    }
+
+    switch (reader.tokenType()) {
+      case Obj::e_NONE: {
+        *result += "?";
+      } break;
+      case Obj::e_START_OBJECT: {
+        *result += "{";
+      } break;
+      case Obj::e_END_OBJECT: {
+        *result += "}";
+      } break;
+      case Obj::e_START_ARRAY: {
+        *result += "[";
+      } break;
+      case Obj::e_END_ARRAY: {
+        *result += "]";
+      } break;
+      case Obj::e_MEMBER_NAME: {
+        *result += "N:";
+        *result += reader.rawString();
+      } break;
+      case Obj::e_VALUE: {
+        switch (reader.valueType()) {
+          case JsonType::e_STRING: {
+            *result += "S:";
+            *result += reader.rawString();
+          } break;
+          case JsonType::e_NUMBER: {
+            *result += "#";
+            *result += reader.theNumber();
+          } break;
+          case JsonType::e_BOOLEAN: {
+            *result += reader.theBoolean() ? "true" : "false";
+          } break;
+          case JsonType::e_NULL: {
+            *result += "null";
+          } break;
+          default: {
+            *result += "?";
+          } break;
+        }
+      } break;
+    }
+}
+
+/// Read all tokens from the specified `input`, supplied to the specified
+/// `reader` in chunks of the specified `chunkSize` (or in one chunk if
+/// `chunkSize` is 0), appending a description of each token to the
+/// specified `tokens` (see `appendToken`).  Return the final non-zero value
+/// returned by `reader.advance()`.  The behavior is undefined unless
+/// `reader` has no input.
+int readAll(bsl::string             *tokens,
+            Obj                     *reader,
+            const bsl::string_view&  input,
+            bsl::size_t              chunkSize = 0)
+{
+    if (0 == chunkSize) {
+        chunkSize = input.length() ? input.length() : 1;
+    }
+
+    bsl::size_t position = 0;
+    while (true) {
+        int rc;
+        while (0 == (rc = reader->advance())) {
+            appendToken(tokens, *reader);
+        }
+        if (Obj::k_NEED_MORE_INPUT != rc) {
+            return rc;                                                // RETURN
+        }
+
+        if (position < input.length()) {
+            const bsl::size_t length = bsl::min(chunkSize,
+                                                input.length() - position);
+            reader->appendInput(input.substr(position, length));
+            position += length;
+        }
+        else {
+            reader->finishInput();
+        }
+    }
+}
+
+/// Load into the specified `result` the value read by the specified
+/// `reader`, whose current token is the first token of that value, and whose
+/// input is complete.  Return 0 on success, and a non-zero value otherwise.
+/// Note that the first of several members of an object having the same name
+/// is retained, as by `bdljsn::JsonUtil::read`.
+int buildJson(Json *result, Obj *reader)
+{
+    switch (reader->tokenType()) {
+      case Obj::e_START_OBJECT: {
+        JsonObject& object = result->makeObject();
+        while (0 == reader->advance()
+            && Obj::e_MEMBER_NAME == reader->tokenType()) {
+            bsl::string name;
+            if (0 != reader->loadString(&name) || 0 != reader->advance()) {
+                return -1;                                            // RETURN
+            }
+            Json value;
+            if (0 != buildJson(&value, reader)) {
+                return -1;                                            // RETURN
+            }
+            object.insert(name, value);
+        }
+        return Obj::e_END_OBJECT == reader->tokenType() ? 0 : -1;     // RETURN
+      }
+      case Obj::e_START_ARRAY: {
+        JsonArray& array = result->makeArray();
+        while (0 == reader->advance()
+            && Obj::e_END_ARRAY != reader->tokenType()) {
+            Json value;
+            if (0 != buildJson(&value, reader)) {
+                return -1;                                            // RETURN
+            }
+            array.pushBack(value);
+        }
+        return Obj::e_END_ARRAY == reader->tokenType() ? 0 : -1;      // RETURN
+      }
+      case Obj::e_VALUE: {
+        switch (reader->valueType()) {
+          case JsonType::e_STRING: {
+            bsl::string value;
+            if (0 != reader->loadString(&value)) {
+                return -1;                                            // RETURN
+            }
+            result->makeString(value);
+          } break;
+          case JsonType::e_NUMBER: {
+            result->makeNumber(bdljsn::JsonNumber(reader->theNumber()));
+          } break;
+          case JsonType::e_BOOLEAN: {
+            result->makeBoolean(reader->theBoolean());
+          } break;
+          default: {
+            result->makeNull();
+          } break;
+        }
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    BSLA_MAYBE_UNUSED const bool             verbose = argc > 2;
+    BSLA_MAYBE_UNUSED const bool         veryVerbose = argc > 3;
+    BSLA_MAYBE_UNUSED const bool     veryVeryVerbose = argc > 4;
+    BSLA_MAYBE_UNUSED const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summing Values from a JSON Lines Stream
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a stream of trade records in the JSON Lines format, one
+// object per line, in chunks of arbitrary size, and want to total the value
+// of the `quantity` member of each record, without building a `bdljsn::Json`
+// object for each record.
+//
+// First, we create a reader for a sequence of documents:
+// ```
+    bdljsn::StreamReader reader;
+    reader.setAllowMultipleDocuments(true);
+// ```
+// Then, we define the chunks of input.  Note that a chunk may end in the
+// middle of a token:
+// ```
+    const char *const CHUNKS[] = {
+        "{\"symbol\": \"IBM\", \"quantity\": 10",
+        "0}\n{\"symbol\": \"A\\u0041PL\", \"q",
+        "uantity\": 25, \"notes\": [\"odd\", 1]}\n",
+        "{\"quantity\": 5}\n"
+    };
+    const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+// ```
+// Next, we supply each chunk in turn, and read tokens until the reader needs
+// more input.  We note when we read a member name `quantity` directly within
+// a record, and then add the subsequent number to our total:
+// ```
+    long long total       = 0;
+    int       numRecords  = 0;
+    bool      isQuantity  = false;
+
+    for (int i = 0; i <= NUM_CHUNKS; ++i) {
+        if (i < NUM_CHUNKS) {
+            reader.appendInput(CHUNKS[i]);
+        }
+        else {
+            reader.finishInput();
+        }
+
+        int rc;
+        while (0 == (rc = reader.advance())) {
+            switch (reader.tokenType()) {
+              case bdljsn::StreamReader::e_MEMBER_NAME: {
+                isQuantity = 1 == reader.depth()
+                          && "quantity" == reader.rawString();
+              } break;
+              case bdljsn::StreamReader::e_VALUE: {
+                if (isQuantity) {
+                    int quantity;
+                    ASSERT(reader.valueType() == bdljsn::JsonType::e_NUMBER);
+                    ASSERT(0 == bdljsn::NumberUtil::asInt(&quantity,
+                                                          reader.theNumber()));
+                    total += quantity;
+                }
+                isQuantity = false;
+              } break;
+              default: {
+                isQuantity = false;
+              } break;
+            }
+            if (reader.isCompleteDocument()) {
+                ++numRecords;
+            }
+        }
+        ASSERT(0 < rc);  // no error
+    }
+// ```
+// Finally, we verify the results:
+// ```
+    ASSERT(3   == numRecords);
+    ASSERT(130 == total);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+        //
+        // Concerns:
+        // 1. A reader accepts exactly the text accepted by `JsonUtil::read`,
+        //    irrespective of how the text is split into chunks.
+        //
+        // 2. The tokens read from an accepted document represent the same
+        //    value as the `Json` object read by `JsonUtil::read`.
+        //
+        // Plan:
+        // 1. For each test point of the *JSON* *Test* *Suite* (see
+        //    `bdljsn_jsontestsuiteutil`), read a `Json` object, and read the
+        //    tokens of the document supplied in one chunk and in chunks of 1
+        //    and 3 characters, verifying that either every operation or none
+        //    succeeds.  (C-1)
+        //
+        // 2. For each test point accepted, build a `Json` object from the
+        //    tokens, and verify that it is equal to that read by
+        //    `JsonUtil::read`.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                     << "CONCERN: ACCEPTS THE SAME TEXT AS `JsonUtil::read`"
+                     << endl
+                     << "=================================================="
+                     << endl;
+
+        const bsl::size_t NUM_DATA = JTSU::numData();
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = JTSU::data(ti)->d_line;
+            const char *const TEST_NAME = JTSU::data(ti)->d_testName_p;
+            const char *const JSON      = JTSU::data(ti)->d_JSON_p;
+            const bsl::size_t LENGTH    = JTSU::data(ti)->d_length;
+
+            if (veryVeryVerbose) {
+                P_(ti) P_(LINE) P(TEST_NAME);
+            }
+
+            const bsl::string_view input(JSON, LENGTH);
+
+            Json      expected;
+            const int expectedRc = bdljsn::JsonUtil::read(&expected, input);
+
+            const bsl::size_t CHUNK_SIZES[] = { 0, 1, 3 };
+
+            for (bsl::size_t ci = 0; ci < 3; ++ci) {
+                const bsl::size_t CHUNK_SIZE = CHUNK_SIZES[ci];
+
+                Obj         mX;
+                bsl::string tokens;
+
+                const int rc = readAll(&tokens, &mX, input, CHUNK_SIZE);
+
+                ASSERTV(LINE, TEST_NAME, CHUNK_SIZE, expectedRc, rc,
+                        (0 == expectedRc) == (Obj::k_END_OF_INPUT == rc));
+            }
+
+            if (0 == expectedRc) {
+                Obj mX;
+                mX.appendInput(input);
+                mX.finishInput();
+
+                Json json;
+                ASSERTV(LINE, TEST_NAME, 0 == mX.advance());
+                ASSERTV(LINE, TEST_NAME, 0 == buildJson(&json, &mX));
+                ASSERTV(LINE, TEST_NAME, mX.isCompleteDocument());
+                ASSERTV(LINE, TEST_NAME, expected == json);
+                ASSERTV(LINE, TEST_NAME, Obj::k_END_OF_INPUT == mX.advance());
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // MULTIPLE DOCUMENTS
+        //
+        // Concerns:
+        // 1. A reader configured to read multiple documents reads a sequence
+        //    of documents separated by optional whitespace.
+        //
+        // 2. `isCompleteDocument` is `true` for exactly the last token of
+        //    each document.
+        //
+        // 3. An error in a document is reported after the tokens preceding
+        //    it, including those of the preceding documents.
+        //
+        // Plan:
+        // 1. Read sequences of documents of each kind, with and without
+        //    intervening whitespace, in chunks of each size, verifying the
+        //    tokens read and the tokens for which `isCompleteDocument` is
+        //    `true`.  (C-1..2)
+        //
+        // 2. Read a sequence of documents, one of which is invalid, and
+        //    verify the tokens read and the error.  (C-3)
+        //
+        // Testing:
+        //   StreamReader& setAllowMultipleDocuments(bool value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MULTIPLE DOCUMENTS" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            const char *d_tokens_p;
+            int         d_numDocuments;
+        } DATA[] = {
+            //LINE  INPUT                  TOKENS                 NUM
+            //----  ---------------------  ---------------------  ---
+            { L_,   "",                    "",                    0 },
+            { L_,   " \n ",                "",                    0 },
+            { L_,   "1",                   "#1",                  1 },
+            { L_,   "1 2\n3",              "#1 #2 #3",            3 },
+            { L_,   "{}{}",                "{ } { }",             2 },
+            { L_,   "[1]\"a\"null",        "[ #1 ] S:a null",     3 },
+            { L_,   "{\"a\":[]}\n[{}]\n",  "{ N:a [ ] } [ { } ]", 2 },
+            { L_,   "true false",          "true false",          2 },
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE          = DATA[ti].d_line;
+            const char *const INPUT         = DATA[ti].d_input_p;
+            const char *const TOKENS        = DATA[ti].d_tokens_p;
+            const int         NUM_DOCUMENTS = DATA[ti].d_numDocuments;
+
+            const bsl::string_view input(INPUT);
+
+            for (bsl::size_t chunkSize = 0; chunkSize <= 3; ++chunkSize) {
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(LINE, &mX == &mX.setAllowMultipleDocuments(true));
+                ASSERTV(LINE, X.allowMultipleDocuments());
+
+                bsl::string tokens;
+                int         numDocuments = 0;
+                bsl::size_t position     = 0;
+                int         rc;
+
+                while (true) {
+                    while (0 == (rc = mX.advance())) {
+                        appendToken(&tokens, X);
+                        numDocuments += X.isCompleteDocument();
+                        ASSERTV(LINE, X.isCompleteDocument() ==
+                                                           (0 == X.depth()));
+                    }
+                    if (Obj::k_NEED_MORE_INPUT != rc) {
+                        break;
+                    }
+                    if (position < input.length()) {
+                        const bsl::size_t length =
+                            0 == chunkSize
+                            ? input.length()
+                            : bsl::min(chunkSize, input.length() - position);
+                        mX.appendInput(input.substr(position, length));
+                        position += length;
+                    }
+                    else {
+                        mX.finishInput();
+                    }
+                }
+
+                ASSERTV(LINE, chunkSize, rc, Obj::k_END_OF_INPUT == rc);
+                ASSERTV(LINE, chunkSize, tokens, TOKENS == tokens);
+                ASSERTV(LINE, chunkSize, numDocuments,
+                        NUM_DOCUMENTS == numDocuments);
+            }
+        }
+
+        if (veryVerbose) cout << "Error in a later document." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setAllowMultipleDocuments(true);
+
+            bsl::string tokens;
+            const int   rc = readAll(&tokens, &mX, "{}\n[1]\n[2,]\n[3]\n");
+
+            ASSERTV(rc, 0 > rc);
+            ASSERTV(tokens, "{ } [ #1 ] [ #2" == tokens);
+            ASSERTV(X.error().location().offset(),
+                    10 == X.error().location().offset());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: ERRORS AND READ OPTIONS
+        //
+        // Concerns:
+        // 1. `advance` returns a negative value for invalid text, loading
+        //    `error()` with a description of the error and its offset in the
+        //    input, and continues to do so until the reader is reset.
+        //
+        // 2. The error and its offset are independent of how the input is
+        //    split into chunks.
+        //
+        // 3. The `maxNestedDepth` and `allowTrailingText` options are
+        //    honored.
+        //
+        // Plan:
+        // 1. Using a table of invalid inputs and the offsets of their errors,
+        //    read each input in chunks of various sizes, and verify the
+        //    result, the error, and the subsequent results of `advance`.
+        //    (C-1..2)
+        //
+        // 2. Read documents nested to various depths with various
+        //    `maxNestedDepth` values, and documents followed by text with
+        //    either value of `allowTrailingText`, and verify the results.
+        //    (C-3)
+        //
+        // Testing:
+        //   const Error& error() const;
+        //   CONCERN: ERRORS AND READ OPTIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ERRORS AND READ OPTIONS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Invalid text." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+                int         d_offset;
+            } DATA[] = {
+                //LINE  INPUT                  OFFSET
+                //----  ---------------------  ------
+                { L_,   "",                        0 },
+                { L_,   "   ",                     3 },
+                { L_,   "]",                       0 },
+                { L_,   "[",                       1 },
+                { L_,   "[1",                      2 },
+                { L_,   "[1 2]",                   3 },
+                { L_,   "[1,]",                    3 },
+                { L_,   "[1}",                     2 },
+                { L_,   "{",                       1 },
+                { L_,   "{\"a\"}",                 4 },
+                { L_,   "{\"a\":}",                5 },
+                { L_,   "{\"a\":1,}",              7 },
+                { L_,   "{\"a\":1]",               6 },
+                { L_,   "{a:1}",                   1 },
+                { L_,   "nul",                     0 },
+                { L_,   "[truex]",                 1 },
+                { L_,   "-",                       0 },
+                { L_,   "1.",                      0 },
+                { L_,   "\"abc",                   4 },
+                { L_,   "\"abc\\",                 5 },
+                { L_,   "\"a\x1F\"",               2 },
+                { L_,   "\"\\q\"",                 1 },
+                { L_,   "\"\\u12G4\"",             1 },
+                { L_,   "\"\\u12\"",               1 },
+                { L_,   "\"\\uD800\\u0041\"",      7 },
+                { L_,   "\"\\uD800\"",             7 },
+                { L_,   "\"\\uDFFF\"",             1 },
+                { L_,   "\"\xFF\"",                1 },
+                { L_,   "\"a\xC3\"",               2 },
+                { L_,   "1 2",                     2 },
+                { L_,   "{}x",                     2 },
+                { L_,   "1\f",                     1 },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const Uint64      OFFSET = DATA[ti].d_offset;
+
+                Json json;
+                ASSERTV(LINE, 0 != bdljsn::JsonUtil::read(&json, INPUT));
+
+                for (bsl::size_t chunkSize = 0; chunkSize <= 4; ++chunkSize) {
+                    Obj mX(&ta);  const Obj& X = mX;
+
+                    bsl::string tokens;
+                    const int   rc = readAll(&tokens, &mX, INPUT, chunkSize);
+
+                    ASSERTV(LINE, chunkSize, rc, 0 > rc);
+                    ASSERTV(LINE, chunkSize, !X.error().message().empty());
+                    ASSERTV(LINE, chunkSize, OFFSET,
+                            X.error().location().offset(),
+                            OFFSET == X.error().location().offset());
+                    ASSERTV(LINE, chunkSize, Obj::e_NONE == X.tokenType());
+
+                    // The error is sticky.
+
+                    ASSERTV(LINE, chunkSize, rc == mX.advance());
+                    ASSERTV(LINE, chunkSize, Obj::e_NONE == X.tokenType());
+
+                    mX.reset();
+                    ASSERTV(LINE, chunkSize, Error() == X.error());
+                    ASSERTV(LINE, chunkSize,
+                            Obj::k_NEED_MORE_INPUT == mX.advance());
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "`maxNestedDepth`." << endl;
+        {
+            for (int depth = 1; depth <= 8; ++depth) {
+                for (int maxDepth = 1; maxDepth <= 8; ++maxDepth) {
+                    // Alternate arrays and objects, e.g., `[{"a":[{}]}]`.
+
+                    bsl::string input(&ta);
+                    for (int i = depth - 1; i >= 0; --i) {
+                        if (i % 2) {
+                            input = input.empty() ? "{}"
+                                                  : "{\"a\":" + input + "}";
+                        }
+                        else {
+                            input = "[" + input + "]";
+                        }
+                    }
+
+                    ReadOptions options;
+                    options.setMaxNestedDepth(maxDepth);
+
+                    Obj mX(options, &ta);  const Obj& X = mX;
+                    ASSERTV(maxDepth == X.options().maxNestedDepth());
+
+                    bsl::string tokens(&ta);
+                    const int   rc = readAll(&tokens, &mX, input, 1);
+
+                    ASSERTV(depth, maxDepth, rc,
+                            (depth <= maxDepth) ==
+                                             (Obj::k_END_OF_INPUT == rc));
+                    if (depth > maxDepth) {
+                        ASSERTV(depth, maxDepth, rc, -4 == rc);
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "`allowTrailingText`." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+                const char *d_tokens_p;
+            } DATA[] = {
+                //LINE  INPUT           TOKENS
+                //----  ------------    -----------
+                { L_,   "{} x",         "{ }"       },
+                { L_,   "[]]",          "[ ]"       },
+                { L_,   "\"a\"\"b\"",   "S:a"       },
+                { L_,   "1 2",          "#1"        },
+                { L_,   "null,",        "null"      },
+                { L_,   "[1] [",        "[ #1 ]"    },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const char *const TOKENS = DATA[ti].d_tokens_p;
+
+                ReadOptions options;
+                {
+                    Obj         mX(options, &ta);
+                    bsl::string tokens;
+                    ASSERTV(LINE, 0 > readAll(&tokens, &mX, INPUT));
+                }
+
+                options.setAllowTrailingText(true);
+                {
+                    Obj         mX(options, &ta);
+                    bsl::string tokens;
+                    ASSERTV(LINE, Obj::k_END_OF_INPUT ==
+                                               readAll(&tokens, &mX, INPUT));
+                    ASSERTV(LINE, tokens, TOKENS == tokens);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: TOKENS ARE INDEPENDENT OF HOW THE INPUT IS SPLIT
+        //
+        // Concerns:
+        // 1. The tokens read from a document are independent of how the
+        //    document is split into chunks, including within a string, an
+        //    escape sequence, a surrogate pair, a number, or a literal.
+        //
+        // 2. `advance` returns `k_NEED_MORE_INPUT` until enough input is
+        //    supplied to read the next token.
+        //
+        // 3. The text that has already been read is discarded when input is
+        //    appended, so the memory used by a reader is independent of the
+        //    size of the document.
+        //
+        // Plan:
+        // 1. For a set of documents, read the document split into two chunks
+        //    at every position, and in chunks of every size, and verify the
+        //    tokens read.  (C-1..2)
+        //
+        // 2. Read a large document in small chunks, and verify that the
+        //    memory allocated by the reader is small.  (C-3)
+        //
+        // Testing:
+        //   void appendInput(const bsl::string_view& input);
+        //   CONCERN: TOKENS ARE INDEPENDENT OF HOW THE INPUT IS SPLIT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: TOKENS ARE INDEPENDENT OF HOW THE INPUT IS SPLIT"
+                 << endl
+                 << "========================================================="
+                 << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        static const char *const DATA[] = {
+            "{\"name\": \"a\\\"b\\\\c\", \"list\": [1, -2.5e+10, true, null]}",
+            "[\"\\uD83D\\uDE00\", \"\\u00e9\\/\", \"\xC3\xA9\", false]",
+            "  [ [ ] , { } , 12345678901234567890 , \"\" ]  ",
+            "\"a long string value with \\n escapes \\t in it\"",
+            "-0.000001e-7",
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::string_view input(DATA[ti]);
+
+            bsl::string expected;
+            {
+                Obj mX(&ta);
+                ASSERTV(ti, Obj::k_END_OF_INPUT ==
+                                             readAll(&expected, &mX, input));
+            }
+
+            if (veryVerbose) {
+                P_(ti) P(expected);
+            }
+
+            for (bsl::size_t split = 0; split <= input.length(); ++split) {
+                Obj mX(&ta);
+
+                bsl::string tokens;
+                int         rc;
+
+                mX.appendInput(input.substr(0, split));
+                while (0 == (rc = mX.advance())) {
+                    appendToken(&tokens, mX);
+                }
+                ASSERTV(ti, split, rc, Obj::k_NEED_MORE_INPUT == rc);
+
+                mX.appendInput(input.substr(split));
+                mX.finishInput();
+                while (0 == (rc = mX.advance())) {
+                    appendToken(&tokens, mX);
+                }
+                ASSERTV(ti, split, rc, Obj::k_END_OF_INPUT == rc);
+                ASSERTV(ti, split, tokens, expected == tokens);
+            }
+
+            for (bsl::size_t size = 1; size <= input.length(); ++size) {
+                Obj         mX(&ta);
+                bsl::string tokens;
+
+                ASSERTV(ti, size, Obj::k_END_OF_INPUT ==
+                                           readAll(&tokens, &mX, input, size));
+                ASSERTV(ti, size, tokens, expected == tokens);
+            }
+        }
+
+        if (veryVerbose) cout << "Memory use." << endl;
+        {
+            bsl::string input("[");
+            for (int i = 0; i < 10000; ++i) {
+                input += "{\"key\": \"value\", \"number\": 12345},";
+            }
+            input += "null]";
+
+            Obj         mX(&ta);
+            bsl::string tokens;
+
+            ASSERT(Obj::k_END_OF_INPUT == readAll(&tokens, &mX, input, 64));
+            ASSERTV(ta.numBytesMax(), ta.numBytesMax() < 1024);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TOKENS
+        //
+        // Concerns:
+        // 1. `advance` reads each token of a document in order, reporting its
+        //    kind, its offset, and the depth after the token.
+        //
+        // 2. The value accessors return the value of the current token, and
+        //    the text of strings and numbers is not altered.
+        //
+        // 3. `loadString` processes escape sequences.
+        //
+        // 4. `isCompleteDocument` is `true` for the last token only.
+        //
+        // 5. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Using a table of documents and their expected tokens, read each
+        //    document and verify the tokens.  (C-1..2, 4)
+        //
+        // 2. Read a document containing strings with escape sequences, and
+        //    verify the results of `loadString`, `hasEscapes`, and
+        //    `tokenOffset`.  (C-1..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int advance();
+        //   int depth() const;
+        //   bool isCompleteDocument() const;
+        //   TokenType tokenType() const;
+        //   bsls::Types::Uint64 tokenOffset() const;
+        //   JsonType::Enum valueType() const;
+        //   bool theBoolean() const;
+        //   bsl::string_view theNumber() const;
+        //   bool hasEscapes() const;
+        //   int loadString(bsl::string *result) const;
+        //   bsl::string_view rawString() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TOKENS" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Token sequences." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+                const char *d_tokens_p;
+            } DATA[] = {
+                //LINE INPUT                      TOKENS
+                //---- -------------------------  ------------------------
+                { L_,  "null",                    "null" },
+                { L_,  " true ",                  "true" },
+                { L_,  "false",                   "false" },
+                { L_,  "0",                       "#0" },
+                { L_,  "-1.5e10",                 "#-1.5e10" },
+                { L_,  "\"\"",                    "S:" },
+                { L_,  "\"a\\nb\"",               "S:a\\nb" },
+                { L_,  "[]",                      "[ ]" },
+                { L_,  "{}",                      "{ }" },
+                { L_,  "[1,[2,[]],3]",            "[ #1 [ #2 [ ] ] #3 ]" },
+                { L_,  "{\"a\":1,\"b\":{}}",      "{ N:a #1 N:b { } }" },
+                { L_,  "{\"a\":[{\"b\":null}]}",  "{ N:a [ { N:b null } ] }" },
+                { L_,  "{\"a\":1,\"a\":2}",       "{ N:a #1 N:a #2 }" },
+                { L_,  " [ \"x\" , true ] ",      "[ S:x true ]" },
+                { L_,  "\t\r\n\v[\t\r\n\v]",     "[ ]" },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const char *const TOKENS = DATA[ti].d_tokens_p;
+
+                Obj mX(&ta);  const Obj& X = mX;
+
+                mX.appendInput(INPUT);
+                mX.finishInput();
+
+                bsl::string tokens;
+                int         depth = 0;
+                int         rc;
+                while (0 == (rc = mX.advance())) {
+                    appendToken(&tokens, X);
+
+                    switch (X.tokenType()) {
+                      case Obj::e_START_OBJECT:
+                      case Obj::e_START_ARRAY: {
+                        ++depth;
+                      } break;
+                      case Obj::e_END_OBJECT:
+                      case Obj::e_END_ARRAY: {
+                        --depth;
+                      } break;
+                      default: {
+                      } break;
+                    }
+                    ASSERTV(LINE, depth, X.depth(), depth == X.depth());
+                    ASSERTV(LINE, (0 == depth) == X.isCompleteDocument());
+                }
+                ASSERTV(LINE, rc, Obj::k_END_OF_INPUT == rc);
+                ASSERTV(LINE, tokens, TOKENS == tokens);
+                ASSERTV(LINE, Obj::e_NONE == X.tokenType());
+                ASSERTV(LINE, !X.isCompleteDocument());
+
+                ASSERTV(LINE, Obj::k_END_OF_INPUT == mX.advance());
+            }
+        }
+
+        if (veryVerbose) cout << "Values." << endl;
+        {
+            const char *INPUT = "{\"k\\u0065y\": \"v\\u00e9\\\"\","
+                                " \"n\": 12, \"plain\": \"text\"}";
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.appendInput(INPUT);
+            mX.finishInput();
+
+            bsl::string value(&ta);
+
+            ASSERT(0 == mX.advance());
+            ASSERT(Obj::e_START_OBJECT == X.tokenType());
+            ASSERT(0 == X.tokenOffset());
+
+            ASSERT(0 == mX.advance());
+            ASSERT(Obj::e_MEMBER_NAME == X.tokenType());
+            ASSERT(1 == X.tokenOffset());
+            ASSERT(X.hasEscapes());
+            ASSERT("k\\u0065y" == X.rawString());
+            ASSERT(0 == X.loadString(&value));
+            ASSERT("key" == value);
+
+            ASSERT(0 == mX.advance());
+            ASSERT(Obj::e_VALUE == X.tokenType());
+            ASSERT(JsonType::e_STRING == X.valueType());
+            ASSERT(13 == X.tokenOffset());
+            ASSERT(X.hasEscapes());
+            ASSERT(0 == X.loadString(&value));
+            ASSERT("v\xC3\xA9\"" == value);
+
+            ASSERT(0 == mX.advance());
+            ASSERT(Obj::e_MEMBER_NAME == X.tokenType());
+            ASSERT(!X.hasEscapes());
+            ASSERT(0 == X.loadString(&value));
+            ASSERT("n" == value);
+
+            ASSERT(0 == mX.advance());
+            ASSERT(JsonType::e_NUMBER == X.valueType());
+            ASSERT("12" == X.theNumber());
+            ASSERT(31 == X.tokenOffset());
+
+            ASSERT(0 == mX.advance());
+            ASSERT(0 == mX.advance());
+            ASSERT(JsonType::e_STRING == X.valueType());
+            ASSERT(!X.hasEscapes());
+            ASSERT("text" == X.rawString());
+            ASSERT(0 == X.loadString(&value));
+            ASSERT("text" == value);
+
+            ASSERT(0 == mX.advance());
+            ASSERT(Obj::e_END_OBJECT == X.tokenType());
+            ASSERT(X.isCompleteDocument());
+
+            ASSERT(Obj::k_END_OF_INPUT == mX.advance());
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.tokenOffset());
+
+            mX.appendInput("[true, 1, \"a\"]");
+            mX.finishInput();
+
+            ASSERT(0 == mX.advance());
+
+            ASSERT_PASS(X.tokenOffset());
+            ASSERT_FAIL(X.valueType());
+
+            ASSERT(0 == mX.advance());
+
+            bsl::string s(&ta);
+
+            ASSERT_PASS(X.theBoolean());
+            ASSERT_FAIL(X.theNumber());
+            ASSERT_FAIL(X.rawString());
+            ASSERT_FAIL(X.hasEscapes());
+            ASSERT_FAIL(X.loadString(&s));
+
+            ASSERT(0 == mX.advance());
+
+            ASSERT_PASS(X.theNumber());
+            ASSERT_FAIL(X.theBoolean());
+
+            ASSERT(0 == mX.advance());
+
+            ASSERT_PASS(X.rawString());
+            ASSERT_PASS(X.hasEscapes());
+            ASSERT_PASS(X.loadString(&s));
+            ASSERT_FAIL(X.loadString(0));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. A reader is created with no input, the specified options (or
+        //    the default options), reading a single document, and using the
+        //    specified allocator (or the default allocator).
+        //
+        // 2. `finishInput` marks the input as complete.
+        //
+        // 3. `reset` discards all input and state, except for the options.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Create readers with each constructor, and verify the results of
+        //    the accessors.  (C-1)
+        //
+        // 2. Supply input, read some tokens, call `finishInput` and `reset`,
+        //    and verify the results of the accessors.  (C-2..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   explicit StreamReader(bslma::Allocator *basicAllocator = 0);
+        //   explicit StreamReader(const ReadOptions&, bslma::Allocator * = 0);
+        //   ~StreamReader();
+        //   void finishInput();
+        //   void reset();
+        //   bool allowMultipleDocuments() const;
+        //   bool isInputComplete() const;
+        //   const ReadOptions& options() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        ReadOptions options;
+        options.setMaxNestedDepth(3);
+        options.setAllowTrailingText(true);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(ReadOptions() == X.options());
+            ASSERT(!X.allowMultipleDocuments());
+            ASSERT(!X.isInputComplete());
+            ASSERT(Obj::e_NONE == X.tokenType());
+            ASSERT(0 == X.depth());
+            ASSERT(!X.isCompleteDocument());
+            ASSERT(Error() == X.error());
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(ReadOptions() == X.options());
+        }
+        {
+            Obj mX(options);  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(options == X.options());
+        }
+        {
+            Obj mX(options, &ta);  const Obj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(options == X.options());
+            ASSERT(!X.isInputComplete());
+
+            ASSERT(Obj::k_NEED_MORE_INPUT == mX.advance());
+
+            mX.appendInput("[[1, 2], [3, 4]]");
+            ASSERT(0 == mX.advance());
+            ASSERT(0 == mX.advance());
+            ASSERT(2 == X.depth());
+
+            mX.setAllowMultipleDocuments(true);
+            mX.finishInput();
+            ASSERT(X.isInputComplete());
+
+            mX.reset();
+            ASSERT(options == X.options());
+            ASSERT(X.allowMultipleDocuments());
+            ASSERT(!X.isInputComplete());
+            ASSERT(Obj::e_NONE == X.tokenType());
+            ASSERT(0 == X.depth());
+
+            ASSERT(Obj::k_NEED_MORE_INPUT == mX.advance());
+
+            mX.appendInput("{\"a\": 1}");
+            mX.finishInput();
+
+            bsl::string tokens;
+            ASSERT(Obj::k_END_OF_INPUT == readAll(&tokens, &mX, ""));
+            ASSERTV(tokens, "{ N:a #1 }" == tokens);
+        }
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_PASS(mX.appendInput("1"));
+            mX.finishInput();
+            ASSERT_FAIL(mX.appendInput("1"));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Read a document supplied in two chunks, and verify the tokens.
+        //    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(Obj::k_NEED_MORE_INPUT == mX.advance());
+
+        mX.appendInput("{\"name\": \"val");
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_START_OBJECT == X.tokenType());
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_MEMBER_NAME == X.tokenType());
+        ASSERT("name" == X.rawString());
+
+        ASSERT(Obj::k_NEED_MORE_INPUT == mX.advance());
+        ASSERT(Obj::e_NONE == X.tokenType());
+
+        mX.appendInput("ue\", \"list\": [1, true]}");
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_VALUE == X.tokenType());
+        ASSERT(JsonType::e_STRING == X.valueType());
+        ASSERT("value" == X.rawString());
+
+        ASSERT(0 == mX.advance());
+        ASSERT("list" == X.rawString());
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_START_ARRAY == X.tokenType());
+
+        ASSERT(0 == mX.advance());
+        ASSERT("1" == X.theNumber());
+
+        ASSERT(0 == mX.advance());
+        ASSERT(true == X.theBoolean());
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_END_ARRAY == X.tokenType());
+
+        ASSERT(0 == mX.advance());
+        ASSERT(Obj::e_END_OBJECT == X.tokenType());
+        ASSERT(X.isCompleteDocument());
+
+        ASSERT(Obj::k_NEED_MORE_INPUT == mX.advance());
+
+        mX.finishInput();
+
+        ASSERT(Obj::k_END_OF_INPUT == mX.advance());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare reading JSON Lines with a reader and with `JsonUtil`.
+        //
+        // Concerns:
+        // 1. Reading a large sequence of documents with a reader, in chunks,
+        //    is faster than reading a `Json` object from each document, and
+        //    uses a small, fixed amount of memory.
+        //
+        // Plan:
+        // 1. Generate a large sequence of documents, then time reading its
+        //    tokens in 64KB chunks, and reading a `Json` object from each
+        //    line, reporting the times and the memory allocated.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_RECORDS = 100000;
+
+        const bsl::string RECORD(
+                    "{\"id\": 12345678, \"name\": \"record name\", "
+                    "\"enabled\": true, \"weights\": [0.5, 1.25, 2], "
+                    "\"path\": \"C:\\\\data\\\\file.txt\"}\n");
+
+        bsl::string input;
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            input += RECORD;
+        }
+
+        bslma::TestAllocator readerAllocator("reader");
+        bslma::TestAllocator jsonAllocator("json");
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        {
+            Obj mX(&readerAllocator);
+            mX.setAllowMultipleDocuments(true);
+
+            bsl::size_t numTokens = 0;
+            bsl::size_t position  = 0;
+            while (true) {
+                int rc;
+                while (0 == (rc = mX.advance())) {
+                    ++numTokens;
+                }
+                if (Obj::k_NEED_MORE_INPUT != rc) {
+                    ASSERTV(rc, Obj::k_END_OF_INPUT == rc);
+                    break;
+                }
+                if (position < input.length()) {
+                    const bsl::size_t length =
+                         bsl::min<bsl::size_t>(64 * 1024,
+                                               input.length() - position);
+                    mX.appendInput(bsl::string_view(input).substr(position,
+                                                                  length));
+                    position += length;
+                }
+                else {
+                    mX.finishInput();
+                }
+            }
+            ASSERT(numTokens == 16u * NUM_RECORDS);
+        }
+        timer.stop();
+        const double readerTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        {
+            Json json(&jsonAllocator);
+            for (bsl::size_t position = 0; position < input.length();
+                                              position += RECORD.length()) {
+                ASSERT(0 == bdljsn::JsonUtil::read(
+                       &json,
+                       bsl::string_view(input).substr(position,
+                                                      RECORD.length())));
+            }
+        }
+        timer.stop();
+        const double jsonTime = timer.elapsedTime();
+
+        cout << "Input size:  " << input.length() << " bytes" << endl
+             << "StreamReader:   " << readerTime << "s, "
+             << readerAllocator.numBytesMax() << " bytes (max)" << endl
+             << "JsonUtil::read: " << jsonTime << "s, "
+             << jsonAllocator.numBytesMax() << " bytes (max)" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
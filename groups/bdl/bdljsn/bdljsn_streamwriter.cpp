@@ -0,0 +1,321 @@
+// bdljsn_streamwriter.cpp                                            -*-C++-*-
+#include <bdljsn_streamwriter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_streamwriter_cpp, "$Id$ $CSID$")
+
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_stringutil.h>
+#include <bdljsn_writestyle.h>
+
+#include <bdlb_print.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_ostream.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The whitespace written matches that written by `bdljsn::JsonUtil::write`
+// (see the `WhitespaceWriter` implementations in `bdljsn_jsonutil.cpp`): the
+// indentation level of a value is the initial indentation level plus the
+// number of containers enclosing it, the first element (or member) of a
+// non-empty container is preceded by a newline and indentation in the
+// `e_PRETTY` style, as is the closing bracket (or brace), and subsequent
+// elements are preceded by a comma and then, a newline and indentation (in
+// the `e_PRETTY` style) or a space (in the `e_ONELINE` style).
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+/// This `struct` provides a comparator ordering the members of a
+/// `JsonObject` by name.
+struct MemberLess {
+
+    /// Return `true` if the name of the member referred to by the specified
+    /// `lhs` is less than that referred to by the specified `rhs`.
+    bool operator()(const JsonObject::ConstIterator& lhs,
+                    const JsonObject::ConstIterator& rhs) const
+    {
+        return lhs->first < rhs->first;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                             // ------------------
+                             // class StreamWriter
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+void StreamWriter::beginElement()
+{
+    const WriteStyle::Enum style = d_options.style();
+    const int              level = d_options.initialIndentLevel() + depth();
+
+    if (d_contextStack.empty()) {
+        d_isComplete = false;
+        if (WriteStyle::e_COMPACT != style) {
+            bdlb::Print::indent(d_stream,
+                                d_options.initialIndentLevel(),
+                                d_options.spacesPerLevel());
+        }
+    }
+    else if (d_isNameWritten) {
+        d_isNameWritten = false;
+    }
+    else if (d_isFirstElement) {
+        d_isFirstElement = false;
+        if (WriteStyle::e_PRETTY == style) {
+            bdlb::Print::newlineAndIndent(d_stream,
+                                          level,
+                                          d_options.spacesPerLevel());
+        }
+    }
+    else {
+        d_stream.put(',');
+        if (WriteStyle::e_PRETTY == style) {
+            bdlb::Print::newlineAndIndent(d_stream,
+                                          level,
+                                          d_options.spacesPerLevel());
+        }
+        else if (WriteStyle::e_ONELINE == style) {
+            d_stream.put(' ');
+        }
+    }
+}
+
+void StreamWriter::closeContainer(char close)
+{
+    d_contextStack.pop_back();
+
+    if (!d_isFirstElement && WriteStyle::e_PRETTY == d_options.style()) {
+        bdlb::Print::newlineAndIndent(d_stream,
+                                      d_options.initialIndentLevel() + depth(),
+                                      d_options.spacesPerLevel());
+    }
+    d_stream.put(close);
+
+    d_isFirstElement = false;
+}
+
+int StreamWriter::completeValue()
+{
+    if (d_contextStack.empty()) {
+        d_isComplete = true;
+    }
+    return d_stream.good() ? 0 : -1;
+}
+
+void StreamWriter::openContainer(char open)
+{
+    beginElement();
+    d_stream.put(open);
+
+    d_contextStack.push_back(open);
+    d_isFirstElement = true;
+}
+
+void StreamWriter::writeJson(const Json& value)
+{
+    switch (value.type()) {
+      case JsonType::e_OBJECT: {
+        const JsonObject& object = value.theObject();
+
+        openContainer('{');
+        if (d_options.sortMembers()) {
+            bsl::vector<JsonObject::ConstIterator> members(allocator());
+            members.reserve(object.size());
+            for (JsonObject::ConstIterator it = object.begin();
+                 it != object.end();
+                 ++it) {
+                members.push_back(it);
+            }
+            bsl::sort(members.begin(), members.end(), u::MemberLess());
+
+            for (bsl::size_t i = 0; i < members.size(); ++i) {
+                addMemberName(members[i]->first);
+                writeJson(members[i]->second);
+            }
+        }
+        else {
+            for (JsonObject::ConstIterator it = object.begin();
+                 it != object.end();
+                 ++it) {
+                addMemberName(it->first);
+                writeJson(it->second);
+            }
+        }
+        closeContainer('}');
+      } break;
+      case JsonType::e_ARRAY: {
+        const JsonArray& array = value.theArray();
+
+        openContainer('[');
+        for (JsonArray::ConstIterator it = array.begin();
+             it != array.end();
+             ++it) {
+            writeJson(*it);
+        }
+        closeContainer(']');
+      } break;
+      case JsonType::e_STRING: {
+        beginElement();
+        StringUtil::writeString(d_stream, value.theString());
+      } break;
+      case JsonType::e_NUMBER: {
+        beginElement();
+        d_stream << value.theNumber();
+      } break;
+      case JsonType::e_BOOLEAN: {
+        beginElement();
+        d_stream << (value.theBoolean() ? bsl::string_view("true", 4)
+                                        : bsl::string_view("false", 5));
+      } break;
+      case JsonType::e_NULL: {
+        beginElement();
+        d_stream << bsl::string_view("null", 4);
+      } break;
+    }
+}
+
+// CREATORS
+StreamWriter::StreamWriter(bsl::ostream&     stream,
+                           bslma::Allocator *basicAllocator)
+: d_stream(stream)
+, d_options()
+, d_contextStack(basicAllocator)
+, d_isFirstElement(false)
+, d_isNameWritten(false)
+, d_isComplete(false)
+{
+}
+
+StreamWriter::StreamWriter(bsl::ostream&        stream,
+                           const WriteOptions&  options,
+                           bslma::Allocator    *basicAllocator)
+: d_stream(stream)
+, d_options(options)
+, d_contextStack(basicAllocator)
+, d_isFirstElement(false)
+, d_isNameWritten(false)
+, d_isComplete(false)
+{
+}
+
+StreamWriter::~StreamWriter()
+{
+}
+
+// MANIPULATORS
+void StreamWriter::openObject()
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    openContainer('{');
+}
+
+void StreamWriter::closeObject()
+{
+    BSLS_ASSERT(isFormattingObject());
+    BSLS_ASSERT(!isValueNeeded());
+
+    closeContainer('}');
+    completeValue();
+}
+
+void StreamWriter::openArray()
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    openContainer('[');
+}
+
+void StreamWriter::closeArray()
+{
+    BSLS_ASSERT(isFormattingArray());
+
+    closeContainer(']');
+    completeValue();
+}
+
+int StreamWriter::addMemberName(const bsl::string_view& name)
+{
+    BSLS_ASSERT(isNameNeeded());
+
+    beginElement();
+    const int rc = StringUtil::writeString(d_stream, name);
+    d_stream << (WriteStyle::e_COMPACT == d_options.style()
+                 ? bsl::string_view(":", 1)
+                 : bsl::string_view(": ", 2));
+
+    d_isNameWritten = true;
+    return rc;
+}
+
+int StreamWriter::addBoolean(bool value)
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    beginElement();
+    d_stream << (value ? bsl::string_view("true", 4)
+                       : bsl::string_view("false", 5));
+    return completeValue();
+}
+
+int StreamWriter::addNull()
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    beginElement();
+    d_stream << bsl::string_view("null", 4);
+    return completeValue();
+}
+
+int StreamWriter::addNumber(const JsonNumber& value)
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    beginElement();
+    d_stream << value;
+    return completeValue();
+}
+
+int StreamWriter::addString(const bsl::string_view& value)
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    beginElement();
+    const int rc = StringUtil::writeString(d_stream, value);
+    return completeValue() | rc;
+}
+
+int StreamWriter::addValue(const Json& value)
+{
+    BSLS_ASSERT(!isNameNeeded());
+
+    writeJson(value);
+    return completeValue();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
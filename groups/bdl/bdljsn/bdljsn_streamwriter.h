@@ -0,0 +1,339 @@
+// bdljsn_streamwriter.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLJSN_STREAMWRITER
+#define INCLUDED_BDLJSN_STREAMWRITER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an incremental writer of JSON text.
+//
+//@CLASSES:
+//  bdljsn::StreamWriter: writer of JSON text, one token at a time
+//
+//@SEE_ALSO: bdljsn_streamreader, bdljsn_jsonutil, baljsn_simpleformatter
+//
+//@DESCRIPTION: This component provides a mechanism, `bdljsn::StreamWriter`,
+// that writes JSON text to a `bsl::ostream` one token at a time (the start and
+// end of each object and array, the name of each member, and each scalar
+// value), supplying the separators and (optionally) the whitespace between
+// tokens.  Unlike `bdljsn::JsonUtil::write`, which writes a whole
+// `bdljsn::Json` object, a `StreamWriter` holds only a record of the arrays
+// and objects that are open, and so can write documents larger than the
+// available memory.
+//
+// The text written is formatted according to a `bdljsn::WriteOptions`
+// object, exactly as `bdljsn::JsonUtil::write` would format a `bdljsn::Json`
+// object having the same value, with the exception that the members of an
+// object are written in the order they are supplied (i.e., the `sortMembers`
+// option applies only to the `bdljsn::Json` objects written with
+// `addValue`).
+//
+// Once a top-level value (a *document*) has been completely written,
+// another may be written, allowing a `StreamWriter` to write a sequence of
+// documents.  No text is written between documents; e.g., a client writing
+// *JSON* *Lines* (see https://jsonlines.org) with the `e_COMPACT` style
+// writes a newline to the stream after each document.
+//
+// Writing tokens out of order (e.g., closing an array while an object is
+// open, or adding a value to an object without first adding a member name)
+// is undefined behavior.  The manipulators adding values return a non-zero
+// value if the supplied value cannot be represented (e.g., a string that is
+// not valid UTF-8), or if the stream is not in a good state after writing.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Records as JSON Lines
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to export a (potentially very large) number of records
+// in the JSON Lines format, without building a `bdljsn::Json` object for
+// each record.
+//
+// First, we create a writer for an output stream, using the compact style:
+// ```
+// bsl::ostringstream   output;
+// bdljsn::WriteOptions options;
+// options.setStyle(bdljsn::WriteStyle::e_COMPACT);
+//
+// bdljsn::StreamWriter writer(output, options);
+// ```
+// Then, we write each record as an object, followed by a newline:
+// ```
+// const char *const SYMBOLS[] = { "IBM", "AAPL" };
+// const int         AMOUNTS[] = { 100,   25     };
+//
+// for (int i = 0; i < 2; ++i) {
+//     writer.openObject();
+//     writer.addMemberName("symbol");
+//     writer.addString(SYMBOLS[i]);
+//     writer.addMemberName("quantity");
+//     writer.addNumber(bdljsn::JsonNumber(AMOUNTS[i]));
+//     writer.addMemberName("tags");
+//     writer.openArray();
+//     writer.addBoolean(0 == i);
+//     writer.addNull();
+//     writer.closeArray();
+//     writer.closeObject();
+//
+//     assert(writer.isCompleteDocument());
+//     output << '\n';
+// }
+// ```
+// Finally, we verify the text written:
+// ```
+// assert(output.str() ==
+//        "{\"symbol\":\"IBM\",\"quantity\":100,\"tags\":[true,null]}\n"
+//        "{\"symbol\":\"AAPL\",\"quantity\":25,\"tags\":[false,null]}\n");
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_writeoptions.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class Json;
+class JsonNumber;
+
+                             // ==================
+                             // class StreamWriter
+                             // ==================
+
+/// This class provides a mechanism for writing JSON text one token at a time.
+/// See [](#Description).
+class StreamWriter {
+
+    // DATA
+    bsl::ostream&     d_stream;          // output (held, not owned)
+
+    WriteOptions      d_options;         // formatting options
+
+    bsl::vector<char> d_contextStack;    // `{` or `[` per open container
+
+    bool              d_isFirstElement;  // innermost container is empty
+
+    bool              d_isNameWritten;   // member name awaits its value
+
+    bool              d_isComplete;      // a document was just completed
+
+  private:
+    // NOT IMPLEMENTED
+    StreamWriter(const StreamWriter&);
+    StreamWriter& operator=(const StreamWriter&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Write the separator and whitespace preceding an element of an array,
+    /// a member of an object, or a top-level value.
+    void beginElement();
+
+    /// Write the specified `close` character ending the innermost container.
+    void closeContainer(char close);
+
+    /// Record that a value has been completely written, and return 0 if
+    /// the stream is in a good state, and a non-zero value otherwise.
+    int completeValue();
+
+    /// Write the specified `open` character starting a container.
+    void openContainer(char open);
+
+    /// Write the specified `value`, recursively.
+    void writeJson(const Json& value);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StreamWriter, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a writer of JSON text to the specified `stream`, formatted
+    /// according to the optionally specified `options`.  Optionally specify
+    /// a `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit StreamWriter(bsl::ostream&        stream,
+                          bslma::Allocator    *basicAllocator = 0);
+    StreamWriter(bsl::ostream&        stream,
+                 const WriteOptions&  options,
+                 bslma::Allocator    *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamWriter();
+
+    // MANIPULATORS
+
+    /// Write the start of an object.  The behavior is undefined if
+    /// `isNameNeeded()`.
+    void openObject();
+
+    /// Write the end of the innermost open container, which must be an
+    /// object.  The behavior is undefined unless `isFormattingObject()` and
+    /// `!isValueNeeded()`.
+    void closeObject();
+
+    /// Write the start of an array.  The behavior is undefined if
+    /// `isNameNeeded()`.
+    void openArray();
+
+    /// Write the end of the innermost open container, which must be an
+    /// array.  The behavior is undefined unless `isFormattingArray()`.
+    void closeArray();
+
+    /// Write the specified member `name`.  Return 0 on success, and a
+    /// non-zero value if `name` is not valid UTF-8 or the stream is not in a
+    /// good state.  The behavior is undefined unless `isNameNeeded()`.
+    int addMemberName(const bsl::string_view& name);
+
+    /// Write the specified boolean `value`.  Return 0 on success, and a
+    /// non-zero value if the stream is not in a good state.  The behavior is
+    /// undefined if `isNameNeeded()`.
+    int addBoolean(bool value);
+
+    /// Write a null value.  Return 0 on success, and a non-zero value if the
+    /// stream is not in a good state.  The behavior is undefined if
+    /// `isNameNeeded()`.
+    int addNull();
+
+    /// Write the specified number `value`.  Return 0 on success, and a
+    /// non-zero value if the stream is not in a good state.  The behavior is
+    /// undefined if `isNameNeeded()`.
+    int addNumber(const JsonNumber& value);
+
+    /// Write the specified string `value`, escaping characters as required.
+    /// Return 0 on success, and a non-zero value if `value` is not valid
+    /// UTF-8 or the stream is not in a good state.  The behavior is
+    /// undefined if `isNameNeeded()`.
+    int addString(const bsl::string_view& value);
+
+    /// Write the specified `value`, which may be an array or object, in its
+    /// entirety (honoring the `sortMembers` option for its objects).
+    /// Return 0 on success, and a non-zero value if the stream is not in a
+    /// good state.  The behavior is undefined if `isNameNeeded()`.
+    int addValue(const Json& value);
+
+    // ACCESSORS
+
+    /// Return the number of arrays and objects that are open.
+    int depth() const;
+
+    /// Return `true` if the last token written completed a top-level value,
+    /// and `false` otherwise.
+    bool isCompleteDocument() const;
+
+    /// Return `true` if the innermost open container is an array, and
+    /// `false` otherwise.
+    bool isFormattingArray() const;
+
+    /// Return `true` if the innermost open container is an object, and
+    /// `false` otherwise.
+    bool isFormattingObject() const;
+
+    /// Return `true` if a member name must be written next (i.e., the
+    /// innermost open container is an object, and its last member is
+    /// complete), and `false` otherwise.
+    bool isNameNeeded() const;
+
+    /// Return `true` if a value must be written next for a member whose
+    /// name has been written, and `false` otherwise.
+    bool isValueNeeded() const;
+
+    /// Return the options used to format the text.
+    const WriteOptions& options() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class StreamWriter
+                             // ------------------
+
+// ACCESSORS
+inline
+int StreamWriter::depth() const
+{
+    return static_cast<int>(d_contextStack.size());
+}
+
+inline
+bool StreamWriter::isCompleteDocument() const
+{
+    return d_isComplete;
+}
+
+inline
+bool StreamWriter::isFormattingArray() const
+{
+    return !d_contextStack.empty() && '[' == d_contextStack.back();
+}
+
+inline
+bool StreamWriter::isFormattingObject() const
+{
+    return !d_contextStack.empty() && '{' == d_contextStack.back();
+}
+
+inline
+bool StreamWriter::isNameNeeded() const
+{
+    return isFormattingObject() && !d_isNameWritten;
+}
+
+inline
+bool StreamWriter::isValueNeeded() const
+{
+    return d_isNameWritten;
+}
+
+inline
+const WriteOptions& StreamWriter::options() const
+{
+    return d_options;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StreamWriter::allocator() const
+{
+    return d_contextStack.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
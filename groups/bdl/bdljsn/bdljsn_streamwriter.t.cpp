@@ -0,0 +1,797 @@
+// bdljsn_streamwriter.t.cpp                                          -*-C++-*-
+#include <bdljsn_streamwriter.h>
+
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_jsontestsuiteutil.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_writeoptions.h>
+#include <bdljsn_writestyle.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism that writes JSON text one
+// token at a time.  We test that the text written for a sequence of tokens is
+// as expected in each style, that writing a `Json` object produces the same
+// text as `bdljsn::JsonUtil::write`, that the state accessors track the open
+// containers, and that errors are reported.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StreamWriter(bsl::ostream&, bslma::Allocator * = 0);
+// [ 2] StreamWriter(bsl::ostream&, const WriteOptions&, Allocator * = 0);
+// [ 2] ~StreamWriter();
+//
+// MANIPULATORS
+// [ 3] void openObject();
+// [ 3] void closeObject();
+// [ 3] void openArray();
+// [ 3] void closeArray();
+// [ 3] int addMemberName(const bsl::string_view& name);
+// [ 3] int addBoolean(bool value);
+// [ 3] int addNull();
+// [ 3] int addNumber(const JsonNumber& value);
+// [ 3] int addString(const bsl::string_view& value);
+// [ 4] int addValue(const Json& value);
+//
+// ACCESSORS
+// [ 2] int depth() const;
+// [ 2] bool isCompleteDocument() const;
+// [ 2] bool isFormattingArray() const;
+// [ 2] bool isFormattingObject() const;
+// [ 2] bool isNameNeeded() const;
+// [ 2] bool isValueNeeded() const;
+// [ 2] const WriteOptions& options() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: TEXT MATCHES `JsonUtil::write`
+// [ 5] CONCERN: ERRORS ARE REPORTED
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::StreamWriter      Obj;
+typedef bdljsn::Json              Json;
+typedef bdljsn::JsonNumber        JsonNumber;
+typedef bdljsn::JsonTestSuiteUtil JTSU;
+typedef bdljsn::WriteOptions      WriteOptions;
+typedef bdljsn::WriteStyle        WriteStyle;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Write to the specified `writer` the tokens described by the specified
+/// `spec`, a sequence of the characters `{`, `}`, `[`, `]` (opening and
+/// closing containers), `N` (the member name "n"), `S` (the string "s"),
+/// `1` (the number 1), `T` (true), `F` (false), and `0` (null).  Return 0
+/// if every value was written successfully, and a non-zero value otherwise.
+int gg(Obj *writer, const char *spec)
+{
+    int rc = 0;
+    for (; *spec; ++spec) {
+        switch (*spec) {
+          case '{': writer->openObject();                               break;
+          case '}': writer->closeObject();                              break;
+          case '[': writer->openArray();                                break;
+          case ']': writer->closeArray();                               break;
+          case 'N': rc |= writer->addMemberName("n");                   break;
+          case 'S': rc |= writer->addString("s");                       break;
+          case '1': rc |= writer->addNumber(JsonNumber(1));             break;
+          case 'T': rc |= writer->addBoolean(true);                     break;
+          case 'F': rc |= writer->addBoolean(false);                    break;
+          case '0': rc |= writer->addNull();                            break;
+          default: {
+            BSLS_ASSERT_INVOKE_NORETURN("Invalid spec");
+          } break;
+        }
+    }
+    return rc;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    BSLA_MAYBE_UNUSED const bool             verbose = argc > 2;
+    BSLA_MAYBE_UNUSED const bool         veryVerbose = argc > 3;
+    BSLA_MAYBE_UNUSED const bool     veryVeryVerbose = argc > 4;
+    BSLA_MAYBE_UNUSED const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Records as JSON Lines
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to export a (potentially very large) number of records
+// in the JSON Lines format, without building a `bdljsn::Json` object for
+// each record.
+//
+// First, we create a writer for an output stream, using the compact style:
+// ```
+    bsl::ostringstream   output;
+    bdljsn::WriteOptions options;
+    options.setStyle(bdljsn::WriteStyle::e_COMPACT);
+
+    bdljsn::StreamWriter writer(output, options);
+// ```
+// Then, we write each record as an object, followed by a newline:
+// ```
+    const char *const SYMBOLS[] = { "IBM", "AAPL" };
+    const int         AMOUNTS[] = { 100,   25     };
+
+    for (int i = 0; i < 2; ++i) {
+        writer.openObject();
+        writer.addMemberName("symbol");
+        writer.addString(SYMBOLS[i]);
+        writer.addMemberName("quantity");
+        writer.addNumber(bdljsn::JsonNumber(AMOUNTS[i]));
+        writer.addMemberName("tags");
+        writer.openArray();
+        writer.addBoolean(0 == i);
+        writer.addNull();
+        writer.closeArray();
+        writer.closeObject();
+
+        ASSERT(writer.isCompleteDocument());
+        output << '\n';
+    }
+// ```
+// Finally, we verify the text written:
+// ```
+    ASSERT(output.str() ==
+           "{\"symbol\":\"IBM\",\"quantity\":100,\"tags\":[true,null]}\n"
+           "{\"symbol\":\"AAPL\",\"quantity\":25,\"tags\":[false,null]}\n");
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: ERRORS ARE REPORTED
+        //
+        // Concerns:
+        // 1. Adding a member name or string that is not valid UTF-8 returns a
+        //    non-zero value.
+        //
+        // 2. Adding a value to a stream that is not in a good state returns a
+        //    non-zero value.
+        //
+        // Plan:
+        // 1. Add invalid member names and strings, and verify the result.
+        //    (C-1)
+        //
+        // 2. Add values of each kind to a stream whose `badbit` is set, and
+        //    verify the result.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: ERRORS ARE REPORTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ERRORS ARE REPORTED" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (veryVerbose) cout << "Invalid UTF-8." << endl;
+        {
+            bsl::ostringstream os(&ta);
+            Obj                mX(os, &ta);
+
+            mX.openObject();
+            ASSERT(0 != mX.addMemberName("\xFF"));
+            ASSERT(0 != mX.addString("a\xC3"));
+            ASSERT(0 == mX.addMemberName("b"));
+            ASSERT(0 == mX.addString("\xC3\xA9"));
+            mX.closeObject();
+        }
+
+        if (veryVerbose) cout << "Bad stream." << endl;
+        {
+            const char *const SPECS[] = { "S", "1", "T", "0", "[1]", "{NS}" };
+            const bsl::size_t NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (bsl::size_t ti = 0; ti < NUM_SPECS; ++ti) {
+                const char *const SPEC = SPECS[ti];
+
+                bsl::ostringstream os(&ta);
+                Obj                mX(os, &ta);
+
+                ASSERTV(SPEC, 0 == gg(&mX, "[") && 0 == gg(&mX, SPEC));
+
+                os.setstate(bsl::ios_base::badbit);
+
+                ASSERTV(SPEC, 0 != gg(&mX, SPEC));
+                ASSERTV(SPEC, 0 != mX.addValue(Json()));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: TEXT MATCHES `JsonUtil::write`
+        //
+        // Concerns:
+        // 1. The text written by `addValue` is identical to that written by
+        //    `JsonUtil::write` for the same `Json` object and options,
+        //    including the order of the members of objects.
+        //
+        // 2. A `Json` object may be added as an element of an array or the
+        //    value of a member, and is indented accordingly.
+        //
+        // Plan:
+        // 1. For each valid document of the *JSON* *Test* *Suite* (see
+        //    `bdljsn_jsontestsuiteutil`), and for each combination of style,
+        //    initial indentation level, spaces per level, and `sortMembers`,
+        //    write the `Json` object read from the document with a writer
+        //    and with `JsonUtil::write`, and compare the text.  (C-1)
+        //
+        // 2. For each such document and style, write the `Json` object as the
+        //    value of a member of an object with a writer, and compare the
+        //    text to that written by `JsonUtil::write` for an object having
+        //    the same value, sorting members (as the order of the members of
+        //    a copy of an object may differ).  (C-2)
+        //
+        // Testing:
+        //   int addValue(const Json& value);
+        //   CONCERN: TEXT MATCHES `JsonUtil::write`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: TEXT MATCHES `JsonUtil::write`" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const WriteStyle::Enum STYLES[] = { WriteStyle::e_COMPACT,
+                                            WriteStyle::e_ONELINE,
+                                            WriteStyle::e_PRETTY };
+
+        const bsl::size_t NUM_DATA = JTSU::numData();
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = JTSU::data(ti)->d_line;
+            const char *const TEST_NAME = JTSU::data(ti)->d_testName_p;
+            const char *const JSON      = JTSU::data(ti)->d_JSON_p;
+            const bsl::size_t LENGTH    = JTSU::data(ti)->d_length;
+
+            Json json(&ta);
+            if (0 != bdljsn::JsonUtil::read(&json,
+                                            bsl::string_view(JSON, LENGTH))) {
+                continue;
+            }
+
+            if (veryVeryVerbose) {
+                P_(ti) P_(LINE) P(TEST_NAME);
+            }
+
+            for (int si = 0; si < 3; ++si) {
+            for (int indent = 0; indent <= 2; ++indent) {
+            for (int spaces = 0; spaces <= 4; spaces += 2) {
+            for (int sort = 0; sort <= 1; ++sort) {
+                WriteOptions options;
+                options.setStyle(STYLES[si]);
+                options.setInitialIndentLevel(indent);
+                options.setSpacesPerLevel(spaces);
+                options.setSortMembers(sort);
+
+                bsl::ostringstream expected(&ta);
+                ASSERTV(LINE, 0 == bdljsn::JsonUtil::write(expected,
+                                                           json,
+                                                           options));
+
+                bsl::ostringstream os(&ta);
+                Obj                mX(os, options, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, 0 == mX.addValue(json));
+                ASSERTV(LINE, X.isCompleteDocument());
+                ASSERTV(LINE, 0 == X.depth());
+
+                ASSERTV(LINE, TEST_NAME, si, indent, spaces, sort,
+                        expected.str(), os.str(),
+                        expected.str() == os.str());
+            }
+            }
+            }
+            }
+
+            for (int si = 0; si < 3; ++si) {
+                WriteOptions options;
+                options.setStyle(STYLES[si]);
+                options.setSpacesPerLevel(4);
+                options.setSortMembers(true);
+
+                Json wrapper(&ta);
+                wrapper.makeObject()["value"] = json;
+
+                bsl::ostringstream expected(&ta);
+                bdljsn::JsonUtil::write(expected, wrapper, options);
+
+                bsl::ostringstream os(&ta);
+                Obj                mX(os, options, &ta);
+
+                mX.openObject();
+                ASSERTV(LINE, 0 == mX.addMemberName("value"));
+                ASSERTV(LINE, 0 == mX.addValue(json));
+                mX.closeObject();
+
+                ASSERTV(LINE, TEST_NAME, si, expected.str(), os.str(),
+                        expected.str() == os.str());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TOKENS
+        //
+        // Concerns:
+        // 1. Each manipulator writes its token, preceded by the separator and
+        //    whitespace appropriate to the style and the position of the
+        //    token.
+        //
+        // 2. An empty container is written without whitespace between its
+        //    brackets.
+        //
+        // 3. Successive documents are written with nothing between them,
+        //    each indented by the initial indentation level.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Using a table of token sequences and the text expected in each
+        //    style, write each sequence and verify the text.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void openObject();
+        //   void closeObject();
+        //   void openArray();
+        //   void closeArray();
+        //   int addMemberName(const bsl::string_view& name);
+        //   int addBoolean(bool value);
+        //   int addNull();
+        //   int addNumber(const JsonNumber& value);
+        //   int addString(const bsl::string_view& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TOKENS" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            const char *d_spec_p;
+            const char *d_compact_p;
+            const char *d_oneline_p;
+            const char *d_pretty_p;  // initial indent 1, 2 spaces per level
+        } DATA[] = {
+            { L_, "",        "",              "",         ""                 },
+            { L_, "0",       "null",          "null",     "  null"           },
+            { L_, "T",       "true",          "true",     "  true"           },
+            { L_, "F",       "false",         "false",    "  false"          },
+            { L_, "1",       "1",             "1",        "  1"              },
+            { L_, "S",       "\"s\"",         "\"s\"",    "  \"s\""          },
+            { L_, "[]",      "[]",            "[]",       "  []"             },
+            { L_, "{}",      "{}",            "{}",       "  {}"             },
+            { L_, "[1]",     "[1]",           "[1]",      "  [\n    1\n  ]"  },
+            { L_, "[1T]",    "[1,true]",      "[1, true]",
+                                             "  [\n    1,\n    true\n  ]"    },
+            { L_, "{N0}",    "{\"n\":null}",  "{\"n\": null}",
+                                             "  {\n    \"n\": null\n  }"     },
+            { L_, "{N0NF}",  "{\"n\":null,\"n\":false}",
+                             "{\"n\": null, \"n\": false}",
+                             "  {\n    \"n\": null,\n    \"n\": false\n  }" },
+            { L_, "[[]{}]",  "[[],{}]",       "[[], {}]",
+                                             "  [\n    [],\n    {}\n  ]"     },
+            { L_, "{N[S]}",  "{\"n\":[\"s\"]}",
+                             "{\"n\": [\"s\"]}",
+                             "  {\n    \"n\": [\n      \"s\"\n    ]\n  }"   },
+            { L_, "[{N1}]",  "[{\"n\":1}]",   "[{\"n\": 1}]",
+                             "  [\n    {\n      \"n\": 1\n    }\n  ]"       },
+            { L_, "1S",      "1\"s\"",        "1\"s\"",   "  1  \"s\""       },
+            { L_, "[]{}",    "[]{}",          "[]{}",     "  []  {}"         },
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec_p;
+            const char *const EXPECTED[] = { DATA[ti].d_compact_p,
+                                             DATA[ti].d_oneline_p,
+                                             DATA[ti].d_pretty_p };
+
+            const WriteStyle::Enum STYLES[] = { WriteStyle::e_COMPACT,
+                                                WriteStyle::e_ONELINE,
+                                                WriteStyle::e_PRETTY };
+
+            for (int si = 0; si < 3; ++si) {
+                WriteOptions options;
+                options.setStyle(STYLES[si]);
+                options.setInitialIndentLevel(WriteStyle::e_PRETTY ==
+                                                              STYLES[si]);
+                options.setSpacesPerLevel(2);
+
+                bsl::ostringstream os(&ta);
+                Obj                mX(os, options, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, si, 0 == gg(&mX, SPEC));
+                ASSERTV(LINE, si, 0 == X.depth());
+                ASSERTV(LINE, si, (0 != *SPEC) == X.isCompleteDocument());
+                ASSERTV(LINE, si, EXPECTED[si], os.str(),
+                        EXPECTED[si] == os.str());
+            }
+        }
+
+        if (veryVerbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::ostringstream os(&ta);
+            Obj                mX(os, &ta);
+
+            ASSERT_FAIL(mX.closeObject());
+            ASSERT_FAIL(mX.closeArray());
+            ASSERT_FAIL(mX.addMemberName("a"));
+
+            mX.openObject();
+
+            ASSERT_FAIL(mX.openObject());
+            ASSERT_FAIL(mX.openArray());
+            ASSERT_FAIL(mX.closeArray());
+            ASSERT_FAIL(mX.addBoolean(true));
+            ASSERT_FAIL(mX.addNull());
+            ASSERT_FAIL(mX.addNumber(JsonNumber(1)));
+            ASSERT_FAIL(mX.addString("a"));
+            ASSERT_FAIL(mX.addValue(Json()));
+
+            ASSERT_PASS(mX.addMemberName("a"));
+
+            ASSERT_FAIL(mX.addMemberName("b"));
+            ASSERT_FAIL(mX.closeObject());
+
+            ASSERT_PASS(mX.openArray());
+            ASSERT_FAIL(mX.closeObject());
+            ASSERT_PASS(mX.closeArray());
+            ASSERT_PASS(mX.closeObject());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A writer is created with the specified options (or the default
+        //    options), using the specified allocator (or the default
+        //    allocator), and writes nothing on construction.
+        //
+        // 2. The state accessors reflect the open containers and whether a
+        //    member name or value is needed next.
+        //
+        // Plan:
+        // 1. Create writers with each constructor, and verify the results of
+        //    the accessors.  (C-1)
+        //
+        // 2. Write a sequence of tokens, verifying the results of the state
+        //    accessors after each.  (C-2)
+        //
+        // Testing:
+        //   explicit StreamWriter(bsl::ostream&, bslma::Allocator * = 0);
+        //   StreamWriter(bsl::ostream&, const WriteOptions&, Allocator * = 0);
+        //   ~StreamWriter();
+        //   int depth() const;
+        //   bool isCompleteDocument() const;
+        //   bool isFormattingArray() const;
+        //   bool isFormattingObject() const;
+        //   bool isNameNeeded() const;
+        //   bool isValueNeeded() const;
+        //   const WriteOptions& options() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::ostringstream os(&ta);
+
+        WriteOptions options;
+        options.setStyle(WriteStyle::e_PRETTY);
+        options.setSortMembers(true);
+
+        {
+            Obj mX(os);  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(WriteOptions() == X.options());
+        }
+        {
+            Obj mX(os, &ta);  const Obj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(WriteOptions() == X.options());
+        }
+        {
+            Obj mX(os, options);  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(options == X.options());
+        }
+        ASSERT(os.str().empty());
+
+        if (veryVerbose) cout << "State accessors." << endl;
+        {
+            static const struct {
+                int         d_line;
+                char        d_token;
+                int         d_depth;
+                bool        d_isComplete;
+                bool        d_isArray;
+                bool        d_isObject;
+                bool        d_isNameNeeded;
+                bool        d_isValueNeeded;
+            } DATA[] = {
+                //LINE  TOKEN  DEPTH  COMPLETE  ARRAY  OBJECT  NAME   VALUE
+                //----  -----  -----  --------  -----  ------  -----  -----
+                { L_,   ' ',   0,     false,    false, false,  false, false },
+                { L_,   '{',   1,     false,    false, true,   true,  false },
+                { L_,   'N',   1,     false,    false, true,   false, true  },
+                { L_,   '[',   2,     false,    true,  false,  false, false },
+                { L_,   '1',   2,     false,    true,  false,  false, false },
+                { L_,   '{',   3,     false,    false, true,   true,  false },
+                { L_,   '}',   2,     false,    true,  false,  false, false },
+                { L_,   ']',   1,     false,    false, true,   true,  false },
+                { L_,   'N',   1,     false,    false, true,   false, true  },
+                { L_,   'S',   1,     false,    false, true,   true,  false },
+                { L_,   '}',   0,     true,     false, false,  false, false },
+                { L_,   'T',   0,     true,     false, false,  false, false },
+                { L_,   '[',   1,     false,    true,  false,  false, false },
+                { L_,   ']',   0,     true,     false, false,  false, false },
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mX(os, &ta);  const Obj& X = mX;
+
+            for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE     = DATA[ti].d_line;
+                const char TOKEN[]  = { DATA[ti].d_token, 0 };
+                const int  DEPTH    = DATA[ti].d_depth;
+                const bool COMPLETE = DATA[ti].d_isComplete;
+                const bool ARRAY    = DATA[ti].d_isArray;
+                const bool OBJECT   = DATA[ti].d_isObject;
+                const bool NAME     = DATA[ti].d_isNameNeeded;
+                const bool VALUE    = DATA[ti].d_isValueNeeded;
+
+                if (' ' != TOKEN[0]) {
+                    ASSERTV(LINE, 0 == gg(&mX, TOKEN));
+                }
+
+                ASSERTV(LINE, DEPTH    == X.depth());
+                ASSERTV(LINE, COMPLETE == X.isCompleteDocument());
+                ASSERTV(LINE, ARRAY    == X.isFormattingArray());
+                ASSERTV(LINE, OBJECT   == X.isFormattingObject());
+                ASSERTV(LINE, NAME     == X.isNameNeeded());
+                ASSERTV(LINE, VALUE    == X.isValueNeeded());
+            }
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Write a document in each style, and verify the text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            bsl::ostringstream os(&ta);
+            WriteOptions       options;
+            options.setStyle(WriteStyle::e_ONELINE);
+
+            Obj mX(os, options, &ta);
+
+            mX.openObject();
+            ASSERT(0 == mX.addMemberName("a"));
+            mX.openArray();
+            ASSERT(0 == mX.addNumber(JsonNumber(1)));
+            ASSERT(0 == mX.addString("two"));
+            mX.closeArray();
+            ASSERT(0 == mX.addMemberName("b"));
+            ASSERT(0 == mX.addNull());
+            mX.closeObject();
+
+            ASSERTV(os.str(),
+                    "{\"a\": [1, \"two\"], \"b\": null}" == os.str());
+        }
+        {
+            bsl::ostringstream os(&ta);
+            WriteOptions       options;
+            options.setStyle(WriteStyle::e_PRETTY);
+            options.setSpacesPerLevel(2);
+
+            Obj mX(os, options, &ta);
+
+            mX.openArray();
+            ASSERT(0 == mX.addBoolean(true));
+            mX.openObject();
+            mX.closeObject();
+            mX.closeArray();
+
+            ASSERTV(os.str(), "[\n  true,\n  {}\n]" == os.str());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
@@ -7,13 +7,18 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 #include <bdljsn_numberutil.h>  // for testing only
 #include <bdljsn_stringutil.h>  // for testing only
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
 #include <bsl_ios.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -59,13 +64,191 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 // tokenization has begun.  And in no case should a situation arise in which
 // the same state of tokenizer is legal with one combination of options and
 // illegal with others.
+//
+// The characters of string literals, whitespace runs, and other values are
+// classified a block of 16 characters at a time (using SSE2 where available),
+// rather than one character at a time, by the `find*` functions below.  Each
+// returns the position of the first character of interest in the buffered
+// range it is given, and the tokenizer only examines that character
+// individually.  Blocks are only loaded when entirely within the range, the
+// remaining characters being classified one at a time.
 
 namespace BloombergLP {
 namespace {
 
-static const char *g_WHITESPACE_DEFAULT = " \n\t\v\r\f";
-static const char *g_WHITESPACE_STRICT  = " \n\t\v\r";  // no form-feed
-static const char *g_TOKENS             = "{}[]:,\"";
+enum { k_BLOCK_SIZE = 16 };
+
+/// Return `true` if the specified `ch` is a whitespace character, and
+/// `false` otherwise.  The form feed character, `\f`, is treated as
+/// whitespace only if the specified `allowFormFeed` is `true`.
+inline
+bool isWhitespace(unsigned char ch, bool allowFormFeed)
+{
+    return ' ' == ch
+        || (static_cast<unsigned char>(ch - '\t') <= '\r' - '\t'
+            && (allowFormFeed || '\f' != ch));
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+/// Return a mask having a byte of all set bits for each character of the
+/// specified `block` that is whitespace, and all unset bits otherwise.  The
+/// form feed character, `\f`, is treated as whitespace only if the specified
+/// `allowFormFeed` is `true`.
+inline
+__m128i whitespaceMask(__m128i block, bool allowFormFeed)
+{
+    // `\t`, `\n`, `\v`, `\f`, and `\r` are contiguous, and are found by
+    // comparing their unsigned offset from `\t` with that of `\r`.
+
+    const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+    const __m128i range  = _mm_set1_epi8('\r' - '\t');
+
+    __m128i mask = _mm_or_si128(
+                          _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+                          _mm_cmpeq_epi8(_mm_min_epu8(offset, range), offset));
+    if (!allowFormFeed) {
+        mask = _mm_andnot_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\f')),
+                                mask);
+    }
+    return mask;
+}
+
+/// Return a value whose bit `i` is set if the most-significant bit of byte
+/// `i` of the specified `mask` is set, for `i` in `[0 .. 15]`.
+inline
+unsigned int toBits(__m128i mask)
+{
+    return static_cast<unsigned int>(_mm_movemask_epi8(mask));
+}
+
+/// Return the 16 characters starting at the specified `position`.
+inline
+__m128i loadBlock(const char *position)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+}
+#endif
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is not whitespace, or `end` if there is no such
+/// character.  The form feed character, `\f`, is treated as whitespace only
+/// if the specified `allowFormFeed` is `true`.
+const char *findNonWhitespace(const char *begin,
+                              const char *end,
+                              bool        allowFormFeed)
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    while (end - begin >= k_BLOCK_SIZE) {
+        const unsigned int bits =
+                  ~toBits(whitespaceMask(loadBlock(begin), allowFormFeed))
+                & 0xFFFFu;
+        if (bits) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(bits); // RETURN
+        }
+        begin += k_BLOCK_SIZE;
+    }
+#endif
+
+    while (begin != end && isWhitespace(*begin, allowFormFeed)) {
+        ++begin;
+    }
+    return begin;
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is a quotation mark, a backslash or, if the specified
+/// `stopAtControl` is `true`, a control character in `[0x00 .. 0x1F]`, or
+/// `end` if there is no such character.
+const char *findStringSpecial(const char *begin,
+                              const char *end,
+                              bool        stopAtControl)
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+
+    while (end - begin >= k_BLOCK_SIZE) {
+        const __m128i block = loadBlock(begin);
+
+        __m128i mask = _mm_or_si128(_mm_cmpeq_epi8(block, quote),
+                                    _mm_cmpeq_epi8(block, backslash));
+        if (stopAtControl) {
+            mask = _mm_or_si128(
+                     mask,
+                     _mm_cmpeq_epi8(_mm_max_epu8(block, maxControl),
+                                    maxControl));
+        }
+
+        const unsigned int bits = toBits(mask);
+        if (bits) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(bits); // RETURN
+        }
+        begin += k_BLOCK_SIZE;
+    }
+#endif
+
+    for (; begin != end; ++begin) {
+        const unsigned char ch = *begin;
+        if ('"' == ch || '\\' == ch || (stopAtControl && ch <= 0x1F)) {
+            break;
+        }
+    }
+    return begin;
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is whitespace (including `\f`) or one of the token
+/// characters `{}[]:,"`, or `end` if there is no such character.
+const char *findValueEnd(const char *begin, const char *end)
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Setting bit 5 maps `[` to `{` and `]` to `}`, and maps no other
+    // character to either.
+
+    const __m128i bit5 = _mm_set1_epi8(0x20);
+
+    while (end - begin >= k_BLOCK_SIZE) {
+        const __m128i block  = loadBlock(begin);
+        const __m128i folded = _mm_or_si128(block, bit5);
+
+        const __m128i mask = _mm_or_si128(
+            _mm_or_si128(whitespaceMask(block, true),
+                         _mm_or_si128(
+                               _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                               _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')))),
+            _mm_or_si128(_mm_or_si128(
+                               _mm_cmpeq_epi8(block, _mm_set1_epi8(':')),
+                               _mm_cmpeq_epi8(block, _mm_set1_epi8(','))),
+                         _mm_cmpeq_epi8(block, _mm_set1_epi8('"'))));
+
+        const unsigned int bits = toBits(mask);
+        if (bits) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(bits); // RETURN
+        }
+        begin += k_BLOCK_SIZE;
+    }
+#endif
+
+    for (; begin != end; ++begin) {
+        const unsigned char ch = *begin;
+        if (isWhitespace(ch, true)) {
+            break;
+        }
+        switch (ch) {
+          case '{':
+          case '}':
+          case '[':
+          case ']':
+          case ':':
+          case ',':
+          case '"': {
+            return begin;                                             // RETURN
+          }
+        }
+    }
+    return begin;
+}
 
 }  // close unnamed namespace
 
@@ -117,25 +300,32 @@ int Tokenizer::expandBufferForLargeValue()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // previous character is an unpaired '\\'
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               '"' != d_stringBuffer[d_valueIter]) {
-            if ('\\' == d_stringBuffer[d_valueIter] && '\\' == previousChar) {
-                previousChar = 0;
+        const char *begin = d_stringBuffer.data();
+        const char *end   = begin + d_stringBuffer.length();
+
+        while (d_valueIter < d_stringBuffer.length()) {
+            const char *special = findStringSpecial(
+                                          begin + d_valueIter,
+                                          end,
+                                          !d_allowUnescapedControlCharacters);
+            if (special != begin + d_valueIter) {
+                escaped = false;
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+            d_valueIter = static_cast<bsl::size_t>(special - begin);
 
-                if (false == d_allowUnescapedControlCharacters
-                 && 0x00  <= previousChar
-                 &&          previousChar <= 0x1F) {
-                    return -2;                                        // RETURN
-                }
+            if (special == end || '"' == *special) {
+                break;
             }
 
+            if ('\\' != *special) {
+                return -2;                                            // RETURN
+            }
+
+            escaped = !escaped;
             ++d_valueIter;
         }
 
@@ -168,9 +358,9 @@ int Tokenizer::extractStringValue()
             }
         }
         else {
-            if ('\\' == previousChar) {
+            if (escaped) {
                 ++d_valueIter;
-                previousChar = 0;
+                escaped = false;
                 continue;
             }
             d_valueEnd = d_valueIter;
@@ -269,10 +459,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter]) &&
-               !bsl::strchr(g_TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        if (d_valueIter < d_stringBuffer.length()) {
+            const char *begin = d_stringBuffer.data();
+            const char *end   = begin + d_stringBuffer.length();
+
+            d_valueIter = static_cast<bsl::size_t>(
+                               findValueEnd(begin + d_valueIter, end) - begin);
         }
 
         if (d_valueIter >= d_stringBuffer.length()) {
@@ -311,15 +503,17 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 
 int Tokenizer::skipWhitespace()
 {
-    const char *k_WHITESPACE = d_allowFormFeedAsWhitespace
-                             ? g_WHITESPACE_DEFAULT
-                             : g_WHITESPACE_STRICT;
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(k_WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
-            break;
+        if (d_cursor < d_stringBuffer.length()) {
+            const char *begin = d_stringBuffer.data();
+            const char *end   = begin + d_stringBuffer.length();
+            const char *pos   = findNonWhitespace(begin + d_cursor,
+                                                  end,
+                                                  d_allowFormFeedAsWhitespace);
+            if (end != pos) {
+                d_cursor = static_cast<bsl::size_t>(pos - begin);
+                break;
+            }
         }
 
         const int numRead = reloadStringBuffer();
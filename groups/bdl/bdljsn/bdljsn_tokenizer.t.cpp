@@ -25,6 +25,8 @@
 #include <bsls_asserttest.h>
 #include <bsls_keyword.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
@@ -90,7 +92,7 @@ using bsl::endl;
 // [ 4] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [24] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [ 2] CONCERN: `advanceToNextToken` FIRST CHARACTER
 // [ 4] CONCERN: `advanceToNextToken` TO `e_START_OBJECT`
 // [ 5] CONCERN: `advanceToNextToken` TO `e_NAME`
@@ -98,6 +100,7 @@ using bsl::endl;
 // [ 7] CONCERN: `advanceToNextToken` TO `e_END_OBJECT`
 // [ 8] CONCERN: `advanceToNextToken` TO `e_START_ARRAY`
 // [ 9] CONCERN: `advanceToNextToken` TO `e_END_ARRAY`
+// [24] CONCERN: Tokens are found at any position relative to a block
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -533,7 +536,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -665,6 +668,176 @@ int main(int argc, char *argv[])
     ASSERT(55              == address.d_floorCount);
 // ```
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // BLOCK SCANNING
+        //   Ensure that string literals, other values, and whitespace are
+        //   scanned correctly whatever their length, and wherever their
+        //   characters of interest lie, relative to the blocks of characters
+        //   that are classified together.
+        //
+        // Concerns:
+        // 1. String literals, other values, and whitespace runs of any length
+        //    are tokenized correctly.
+        //
+        // 2. An escaped quotation mark does not end a string literal, and an
+        //    escaped backslash does not escape the following character,
+        //    wherever either is found.
+        //
+        // 3. An unescaped control character is rejected, wherever it is
+        //    found, if and only if `allowUnescapedControlCharacters` is
+        //    `false`.
+        //
+        // 4. A form feed in a whitespace run is skipped, wherever it is
+        //    found, if and only if `allowFormFeedAsWhitespace` is `true`.
+        //
+        // Plan:
+        // 1. For each length in a range spanning several blocks, and each
+        //    position within a literal of that length, tokenize an array
+        //    holding a string literal and a number, having a character of
+        //    interest at that position, and verify the resulting tokens.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: Tokens are found at any position relative to a block
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCK SCANNING" << endl
+                          << "==============" << endl;
+
+        const int MAX_LENGTH = 70;
+
+        if (veryVerbose) cout << "Strings, values, and whitespace." << endl;
+
+        for (int len = 0; len <= MAX_LENGTH; ++len) {
+            for (int pos = -1; pos < len; ++pos) {
+                for (int special = 0; special < 3; ++special) {
+                    // Use `pos == -1` for a literal without a special
+                    // character, and otherwise place an escaped quotation
+                    // mark (0), an escaped backslash (1), or a control
+                    // character (2) at `pos`.
+
+                    if (-1 == pos && 0 != special) {
+                        continue;
+                    }
+
+                    bsl::string literal(len, 'a');
+                    bool        isControl = false;
+                    if (0 <= pos) {
+                        switch (special) {
+                          case 0: literal.insert(pos, "\\\""); break;
+                          case 1: literal.insert(pos, "\\\\"); break;
+                          case 2: {
+                            literal[pos] = '\x01';
+                            isControl    = true;
+                          } break;
+                        }
+                    }
+
+                    const bsl::string number(len + 1, '1');
+                    const bsl::string space(len, ' ');
+
+                    const bsl::string input = "[" + space + "\"" + literal
+                                            + "\"," + space + number
+                                            + space + "]";
+
+                    for (int strict = 0; strict < 2; ++strict) {
+                        Obj mX;  const Obj& X = mX;
+                        mX.setAllowUnescapedControlCharacters(!strict);
+
+                        bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                       input.length());
+                        mX.reset(&isb);
+
+                        bsl::string_view value;
+
+                        ASSERTV(len, pos, 0 == mX.advanceToNextToken());
+                        ASSERTV(len, pos, Obj::e_START_ARRAY == X.tokenType());
+
+                        if (strict && isControl) {
+                            ASSERTV(len, pos, special,
+                                    0 != mX.advanceToNextToken());
+                            continue;
+                        }
+
+                        ASSERTV(len, pos, special,
+                                0 == mX.advanceToNextToken());
+                        ASSERTV(len, pos, special,
+                                Obj::e_ELEMENT_VALUE == X.tokenType());
+                        ASSERTV(len, pos, special, 0 == X.value(&value));
+                        ASSERTV(len, pos, special, value,
+                                "\"" + literal + "\"" == value);
+
+                        ASSERTV(len, pos, 0 == mX.advanceToNextToken());
+                        ASSERTV(len, pos,
+                                Obj::e_ELEMENT_VALUE == X.tokenType());
+                        ASSERTV(len, pos, 0 == X.value(&value));
+                        ASSERTV(len, pos, value, number == value);
+
+                        ASSERTV(len, pos, 0 == mX.advanceToNextToken());
+                        ASSERTV(len, pos, Obj::e_END_ARRAY == X.tokenType());
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "Value terminators." << endl;
+        {
+            const char *TERMINATORS = " \t\n\v\f\r,]";
+
+            for (int len = 1; len <= MAX_LENGTH; ++len) {
+                for (const char *t = TERMINATORS; *t; ++t) {
+                    const bsl::string number(len, '2');
+                    const bsl::string input = "[" + number + *t + "]";
+
+                    Obj mX;  const Obj& X = mX;
+
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+                    mX.reset(&isb);
+
+                    bsl::string_view value;
+
+                    ASSERTV(len, *t, 0 == mX.advanceToNextToken());
+                    ASSERTV(len, *t, 0 == mX.advanceToNextToken());
+                    ASSERTV(len, *t, Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(len, *t, 0 == X.value(&value));
+                    ASSERTV(len, *t, value, number == value);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "Form feeds." << endl;
+
+        for (int len = 1; len <= MAX_LENGTH; ++len) {
+            for (int pos = 0; pos < len; ++pos) {
+                bsl::string space(len, ' ');
+                space[pos] = '\f';
+
+                const bsl::string input = "[" + space + "1]";
+
+                for (int allowFormFeed = 0; allowFormFeed < 2;
+                                                             ++allowFormFeed) {
+                    Obj mX;  const Obj& X = mX;
+
+                    mX.setAllowFormFeedAsWhitespace(allowFormFeed);
+
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+                    mX.reset(&isb);
+
+                    bsl::string_view value;
+
+                    ASSERTV(len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(len, pos, 0 == X.value(&value));
+                    ASSERTV(len, pos, allowFormFeed, value,
+                            allowFormFeed == ("1" == value));
+                }
+            }
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // TESTING `conformanceMode`
@@ -8508,6 +8681,67 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Measure the rate at which a large document is tokenized.
+        //
+        // Concerns:
+        // 1. Tokenizing a document dominated by long string literals and
+        //    whitespace is fast.
+        //
+        // Plan:
+        // 1. Tokenize a document of objects having long names and values
+        //    repeatedly, and report the throughput.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_OBJECTS = 10000;
+        const int NUM_PASSES  = argc > 2 ? atoi(argv[2]) : 20;
+
+        bsl::string input("[\n");
+        for (int i = 0; i < NUM_OBJECTS; ++i) {
+            input += "    {\n"
+                     "        \"description\": \"The quick brown fox jumps"
+                     " over the lazy dog, then jumps back again.\",\n"
+                     "        \"identifier\": 1234567890,\n"
+                     "        \"path\": \"C:\\\\path\\\\to\\\\a\\\\file\"\n"
+                     "    },\n";
+        }
+        input += "    {}\n]\n";
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        bsls::Types::Int64 numTokens = 0;
+        for (int pass = 0; pass < NUM_PASSES; ++pass) {
+            Obj mX;
+
+            bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+            mX.reset(&isb);
+
+            while (0 == mX.advanceToNextToken()) {
+                ++numTokens;
+            }
+            ASSERT(Obj::k_EOF == mX.readStatus());
+        }
+
+        timer.stop();
+
+        const double seconds = timer.elapsedTime();
+        const double megabytes = static_cast<double>(input.length())
+                               * NUM_PASSES / (1024 * 1024);
+
+        cout << "Tokenized " << numTokens << " tokens (" << megabytes
+             << " MB) in " << seconds << "s: " << megabytes / seconds
+             << " MB/s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
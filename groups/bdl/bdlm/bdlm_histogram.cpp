@@ -0,0 +1,314 @@
+// bdlm_histogram.cpp                                                 -*-C++-*-
+#include <bdlm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlm_histogram_cpp,"$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlm {
+namespace {
+
+/// Return the signed index, for the specified `logGamma`, of the bucket
+/// holding the specified positive `value`.
+inline
+double signedIndex(double value, double logGamma)
+{
+    return bsl::ceil(bsl::log(value) / logGamma);
+}
+
+}  // close unnamed namespace
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// PUBLIC CLASS DATA
+const double Histogram::k_DEFAULT_RELATIVE_ACCURACY = 0.01;
+const double Histogram::k_DEFAULT_MIN_TRACKED_VALUE = 1e-9;
+const double Histogram::k_DEFAULT_MAX_TRACKED_VALUE = 1e9;
+const int    Histogram::k_MAX_NUM_BUCKETS           = 1 << 20;
+
+// CLASS METHODS
+bool Histogram::isValid(double relativeAccuracy,
+                        double minTrackedValue,
+                        double maxTrackedValue)
+{
+    if (!(0 < relativeAccuracy && relativeAccuracy < 1)
+     || !(0 < minTrackedValue  && minTrackedValue < maxTrackedValue)
+     || !(maxTrackedValue < bsl::numeric_limits<double>::infinity())) {
+        return false;                                                 // RETURN
+    }
+
+    const double logGamma = bsl::log((1 + relativeAccuracy)
+                                                     / (1 - relativeAccuracy));
+
+    return signedIndex(maxTrackedValue, logGamma)
+                 - signedIndex(minTrackedValue, logGamma) < k_MAX_NUM_BUCKETS;
+}
+
+// PRIVATE MANIPULATORS
+void Histogram::configure(double relativeAccuracy,
+                          double minTrackedValue,
+                          double maxTrackedValue)
+{
+    BSLS_ASSERT(isValid(relativeAccuracy, minTrackedValue, maxTrackedValue));
+
+    d_relativeAccuracy = relativeAccuracy;
+    d_minTrackedValue  = minTrackedValue;
+    d_maxTrackedValue  = maxTrackedValue;
+    d_gamma            = (1 + relativeAccuracy) / (1 - relativeAccuracy);
+    d_logGamma         = bsl::log(d_gamma);
+    d_minIndex         = static_cast<int>(signedIndex(minTrackedValue,
+                                                      d_logGamma));
+
+    const int maxIndex = static_cast<int>(signedIndex(maxTrackedValue,
+                                                      d_logGamma));
+
+    d_buckets.assign(maxIndex - d_minIndex + 1, 0);
+    d_count = 0;
+    d_sum   = 0.0;
+    d_min   = bsl::numeric_limits<double>::infinity();
+    d_max   = -bsl::numeric_limits<double>::infinity();
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator *basicAllocator)
+: d_buckets(basicAllocator)
+{
+    configure(k_DEFAULT_RELATIVE_ACCURACY,
+              k_DEFAULT_MIN_TRACKED_VALUE,
+              k_DEFAULT_MAX_TRACKED_VALUE);
+}
+
+Histogram::Histogram(double            relativeAccuracy,
+                     double            minTrackedValue,
+                     double            maxTrackedValue,
+                     bslma::Allocator *basicAllocator)
+: d_buckets(basicAllocator)
+{
+    configure(relativeAccuracy, minTrackedValue, maxTrackedValue);
+}
+
+Histogram::Histogram(const Histogram&  original,
+                     bslma::Allocator *basicAllocator)
+: d_relativeAccuracy(original.d_relativeAccuracy)
+, d_minTrackedValue(original.d_minTrackedValue)
+, d_maxTrackedValue(original.d_maxTrackedValue)
+, d_gamma(original.d_gamma)
+, d_logGamma(original.d_logGamma)
+, d_minIndex(original.d_minIndex)
+, d_buckets(original.d_buckets, basicAllocator)
+, d_count(original.d_count)
+, d_sum(original.d_sum)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    if (this != &rhs) {
+        d_buckets          = rhs.d_buckets;
+        d_relativeAccuracy = rhs.d_relativeAccuracy;
+        d_minTrackedValue  = rhs.d_minTrackedValue;
+        d_maxTrackedValue  = rhs.d_maxTrackedValue;
+        d_gamma            = rhs.d_gamma;
+        d_logGamma         = rhs.d_logGamma;
+        d_minIndex         = rhs.d_minIndex;
+        d_count            = rhs.d_count;
+        d_sum              = rhs.d_sum;
+        d_min              = rhs.d_min;
+        d_max              = rhs.d_max;
+    }
+    return *this;
+}
+
+void Histogram::add(double value)
+{
+    ++d_buckets[bucketIndex(value)];
+    ++d_count;
+    d_sum += value;
+    d_min  = bsl::min(d_min, value);
+    d_max  = bsl::max(d_max, value);
+}
+
+void Histogram::accumulateSumMinMax(double sum, double min, double max)
+{
+    d_sum += sum;
+    d_min  = bsl::min(d_min, min);
+    d_max  = bsl::max(d_max, max);
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    BSLS_ASSERT(hasSameBuckets(other));
+
+    for (int i = 0; i < numBuckets(); ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    accumulateSumMinMax(other.d_sum, other.d_min, other.d_max);
+}
+
+void Histogram::reset()
+{
+    bsl::fill(d_buckets.begin(), d_buckets.end(), 0);
+    d_count = 0;
+    d_sum   = 0.0;
+    d_min   = bsl::numeric_limits<double>::infinity();
+    d_max   = -bsl::numeric_limits<double>::infinity();
+}
+
+void Histogram::swap(Histogram& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    bslalg::SwapUtil::swap(&d_relativeAccuracy, &other.d_relativeAccuracy);
+    bslalg::SwapUtil::swap(&d_minTrackedValue,  &other.d_minTrackedValue);
+    bslalg::SwapUtil::swap(&d_maxTrackedValue,  &other.d_maxTrackedValue);
+    bslalg::SwapUtil::swap(&d_gamma,            &other.d_gamma);
+    bslalg::SwapUtil::swap(&d_logGamma,         &other.d_logGamma);
+    bslalg::SwapUtil::swap(&d_minIndex,         &other.d_minIndex);
+    bslalg::SwapUtil::swap(&d_buckets,          &other.d_buckets);
+    bslalg::SwapUtil::swap(&d_count,            &other.d_count);
+    bslalg::SwapUtil::swap(&d_sum,              &other.d_sum);
+    bslalg::SwapUtil::swap(&d_min,              &other.d_min);
+    bslalg::SwapUtil::swap(&d_max,              &other.d_max);
+}
+
+// ACCESSORS
+int Histogram::bucketIndex(double value) const
+{
+    // Note that the negated comparison also maps a NaN to the first bucket.
+
+    if (!(value > d_minTrackedValue)) {
+        return 0;                                                     // RETURN
+    }
+    if (value >= d_maxTrackedValue) {
+        return numBuckets() - 1;                                      // RETURN
+    }
+
+    const int index = static_cast<int>(signedIndex(value, d_logGamma))
+                    - d_minIndex;
+
+    // Guard against rounding at the boundaries of the tracked range.
+
+    return bsl::min(bsl::max(index, 0), numBuckets() - 1);
+}
+
+double Histogram::bucketValue(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+
+    return 2 * bsl::pow(d_gamma, index + d_minIndex) / (d_gamma + 1);
+}
+
+bool Histogram::hasSameBuckets(const Histogram& other) const
+{
+    return d_relativeAccuracy == other.d_relativeAccuracy
+        && d_minTrackedValue  == other.d_minTrackedValue
+        && d_maxTrackedValue  == other.d_maxTrackedValue;
+}
+
+double Histogram::quantile(double q) const
+{
+    BSLS_ASSERT(0 <= q);
+    BSLS_ASSERT(q <= 1);
+    BSLS_ASSERT(0 < d_count);
+
+    // The extreme values are known exactly, unless this histogram was
+    // populated by `addToBucket` alone.
+
+    const bool hasMinMax = d_min <= d_max;
+
+    if (hasMinMax && 0 == q) {
+        return d_min;                                                 // RETURN
+    }
+    if (hasMinMax && 1 == q) {
+        return d_max;                                                 // RETURN
+    }
+
+    // Find the bucket holding the value of (zero-based) rank
+    // `q * (count - 1)`.
+
+    const double rank       = q * static_cast<double>(d_count - 1);
+    int          index      = 0;
+    double       cumulative = static_cast<double>(d_buckets[0]);
+
+    while (cumulative <= rank && index < numBuckets() - 1) {
+        ++index;
+        cumulative += static_cast<double>(d_buckets[index]);
+    }
+
+    double result = bucketValue(index);
+
+    if (hasMinMax) {
+        result = bsl::min(bsl::max(result, d_min), d_max);
+    }
+    return result;
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream,
+                               int           level,
+                               int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("relativeAccuracy", d_relativeAccuracy);
+    printer.printAttribute("minTrackedValue",  d_minTrackedValue);
+    printer.printAttribute("maxTrackedValue",  d_maxTrackedValue);
+    printer.printAttribute("count",            d_count);
+    printer.printAttribute("sum",              d_sum);
+    printer.printAttribute("min",              d_min);
+    printer.printAttribute("max",              d_max);
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    return lhs.hasSameBuckets(rhs)
+        && lhs.d_count   == rhs.d_count
+        && lhs.d_sum     == rhs.d_sum
+        && lhs.d_min     == rhs.d_min
+        && lhs.d_max     == rhs.d_max
+        && lhs.d_buckets == rhs.d_buckets;
+}
+
+bsl::ostream& bdlm::operator<<(bsl::ostream& stream, const Histogram& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
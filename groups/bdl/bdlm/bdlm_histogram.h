@@ -0,0 +1,470 @@
+// bdlm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLM_HISTOGRAM
+#define INCLUDED_BDLM_HISTOGRAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide a mergeable histogram with bounded relative error.
+//
+//@DEPRECATED: This component is not ready for public use.
+//
+//@CLASSES:
+//  bdlm::Histogram: logarithmically bucketed, mergeable value distribution
+//
+//@SEE_ALSO: bdlm_metric, balm_histogramcollector
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// `bdlm::Histogram`, that summarizes a distribution of (positive) measurement
+// values (e.g., latencies) so that arbitrary quantiles of the distribution
+// (e.g., the median, or the 99th percentile) can be estimated with a bounded
+// *relative* error.  In addition to the bucketed distribution, a histogram
+// records the exact count, sum, minimum, and maximum of the values added to
+// it.
+//
+// A histogram is configured at construction with three attributes:
+//
+// * `relativeAccuracy`: the maximum relative error, `a`, of an estimated
+//   quantile (e.g., 0.01 for 1%).
+// * `minTrackedValue` and `maxTrackedValue`: the range of values that are
+//   tracked with the specified accuracy.  Values less than or equal to
+//   `minTrackedValue` (including zero and negative values) are counted in
+//   the first bucket, and values greater than or equal to `maxTrackedValue`
+//   are counted in the last bucket.
+//
+// Values are mapped to buckets whose boundaries form a geometric sequence
+// having the ratio `g = (1 + a) / (1 - a)`: the bucket having the (signed)
+// index `k` holds the values in the range `(g^(k-1), g^k]`, and is
+// represented by the value `2 * g^k / (g + 1)`, which is within a relative
+// distance `a` of any value in that range (this is the bucketing scheme of
+// the DDSketch algorithm).  The number of buckets is therefore proportional
+// to `log(maxTrackedValue / minTrackedValue) / a`; for example, tracking the
+// range `[1e-9, 1e3]` (from a nanosecond to 1000 seconds) with a relative
+// accuracy of 1% requires 1383 buckets.
+//
+// Because the bucket boundaries depend only on the configuration, two
+// histograms having the same configuration can be merged exactly (see
+// `merge`), which allows histograms collected by different threads,
+// processes, or intervals to be combined before quantiles are estimated.
+//
+// Note that `bdlm::Histogram` is not designed to be updated concurrently; see
+// `balm_histogramcollector` for a mechanism that records values into buckets
+// of the same layout without locking, and loads them into a
+// `bdlm::Histogram`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we measure the latency (in seconds) of a series of requests, and
+// want to know the median and the 99th percentile.  First, we create a
+// histogram that tracks values between a microsecond and 100 seconds with a
+// relative accuracy of 1%:
+// ```
+// bdlm::Histogram histogram(0.01, 1e-6, 100.0);
+// ```
+// Then, we add 1000 measurements, of which 989 are 1ms and 11 are 1s:
+// ```
+// for (int i = 0; i < 989; ++i) {
+//     histogram.add(0.001);
+// }
+// for (int i = 0; i < 11; ++i) {
+//     histogram.add(1.0);
+// }
+// assert(1000 == histogram.count());
+// ```
+// Finally, we estimate the quantiles, each of which is within 1% of the
+// actual value:
+// ```
+// const double p50 = histogram.quantile(0.5);
+// const double p99 = histogram.quantile(0.99);
+//
+// assert(0.00099 <= p50 && p50 <= 0.00101);
+// assert(0.99    <= p99 && p99 <= 1.01);
+// ```
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+/// This value-semantic class represents a distribution of measurement
+/// values as counts of logarithmically sized buckets, together with the
+/// exact count, sum, minimum, and maximum of the values.  See the
+/// component-level documentation for details.
+class Histogram {
+
+    // DATA
+    double                          d_relativeAccuracy;  // configuration
+    double                          d_minTrackedValue;   // configuration
+    double                          d_maxTrackedValue;   // configuration
+    double                          d_gamma;             // bucket ratio
+    double                          d_logGamma;          // `log(d_gamma)`
+    int                             d_minIndex;          // signed index of
+                                                         // the first bucket
+    bsl::vector<bsls::Types::Int64> d_buckets;           // bucket counts
+    bsls::Types::Int64              d_count;             // number of values
+    double                          d_sum;               // sum of values
+    double                          d_min;               // minimum value
+    double                          d_max;               // maximum value
+
+    // FRIENDS
+    friend bool operator==(const Histogram&, const Histogram&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Configure this histogram with the specified `relativeAccuracy`,
+    /// `minTrackedValue`, and `maxTrackedValue`, and set it to the empty
+    /// state.
+    void configure(double relativeAccuracy,
+                   double minTrackedValue,
+                   double maxTrackedValue);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CLASS DATA
+    static const double k_DEFAULT_RELATIVE_ACCURACY;  // 0.01
+
+    static const double k_DEFAULT_MIN_TRACKED_VALUE;  // 1e-9
+
+    static const double k_DEFAULT_MAX_TRACKED_VALUE;  // 1e9
+
+    static const int    k_MAX_NUM_BUCKETS;            // upper bound on the
+                                                      // number of buckets
+
+    // CLASS METHODS
+
+    /// Return `true` if the specified `relativeAccuracy`,
+    /// `minTrackedValue`, and `maxTrackedValue` are a valid configuration
+    /// for a histogram, and `false` otherwise.  A configuration is valid
+    /// if `0 < relativeAccuracy < 1`,
+    /// `0 < minTrackedValue < maxTrackedValue`, and the number of buckets
+    /// it requires does not exceed `k_MAX_NUM_BUCKETS`.
+    static bool isValid(double relativeAccuracy,
+                        double minTrackedValue,
+                        double maxTrackedValue);
+
+    // CREATORS
+
+    /// Create an empty histogram having the default configuration (i.e.,
+    /// `k_DEFAULT_RELATIVE_ACCURACY`, `k_DEFAULT_MIN_TRACKED_VALUE`, and
+    /// `k_DEFAULT_MAX_TRACKED_VALUE`).  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit Histogram(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty histogram having the specified `relativeAccuracy`,
+    /// `minTrackedValue`, and `maxTrackedValue`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless
+    /// `isValid(relativeAccuracy, minTrackedValue, maxTrackedValue)`.
+    Histogram(double            relativeAccuracy,
+              double            minTrackedValue,
+              double            maxTrackedValue,
+              bslma::Allocator *basicAllocator = 0);
+
+    /// Create a histogram having the same value as the specified
+    /// `original` object.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    Histogram(const Histogram& original, bslma::Allocator *basicAllocator = 0);
+
+    //! ~Histogram() = default;
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference providing modifiable access to this object.
+    Histogram& operator=(const Histogram& rhs);
+
+    /// Add the specified `value` to the distribution represented by this
+    /// histogram.
+    void add(double value);
+
+    /// Add the specified `count` to the count of the bucket having the
+    /// specified `index`, and to the total count of this histogram.  Note
+    /// that this operation does not modify the sum, minimum, or maximum of
+    /// this histogram (see `accumulateSumMinMax`); it is intended for
+    /// populating a histogram from an external representation having the
+    /// same configuration.  The behavior is undefined unless
+    /// `0 <= index < numBuckets()` and `0 <= count`.
+    void addToBucket(int index, bsls::Types::Int64 count);
+
+    /// Add the specified `sum` to the sum of the values of this histogram,
+    /// set the minimum to the specified `min` if `min` is less than the
+    /// minimum, and set the maximum to the specified `max` if `max` is
+    /// greater than the maximum.  Note that this operation does not modify
+    /// the bucket counts or the count of this histogram.
+    void accumulateSumMinMax(double sum, double min, double max);
+
+    /// Add the values represented by the specified `other` histogram to
+    /// this histogram.  The behavior is undefined unless
+    /// `hasSameBuckets(other)`.
+    void merge(const Histogram& other);
+
+    /// Remove all values from this histogram, retaining its configuration.
+    void reset();
+
+    /// Efficiently exchange the value of this object with the value of the
+    /// specified `other` object.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// object was created with the same allocator as `other`.
+    void swap(Histogram& other);
+
+    // ACCESSORS
+
+    /// Return the index of the bucket that counts the specified `value`.
+    int bucketIndex(double value) const;
+
+    /// Return the number of values counted in the bucket having the
+    /// specified `index`.  The behavior is undefined unless
+    /// `0 <= index < numBuckets()`.
+    bsls::Types::Int64 bucketCount(int index) const;
+
+    /// Return the value representing the bucket having the specified
+    /// `index` (i.e., the value reported for quantiles that fall in that
+    /// bucket).  The behavior is undefined unless
+    /// `0 <= index < numBuckets()`.
+    double bucketValue(int index) const;
+
+    /// Return the number of values represented by this histogram.
+    bsls::Types::Int64 count() const;
+
+    /// Return `true` if the specified `other` histogram has the same
+    /// configuration (and hence the same buckets) as this histogram, and
+    /// `false` otherwise.
+    bool hasSameBuckets(const Histogram& other) const;
+
+    /// Return the maximum of the values represented by this histogram, or
+    /// negative infinity if `0 == count()`.
+    double max() const;
+
+    /// Return the upper bound of the range of values tracked with the
+    /// configured accuracy.
+    double maxTrackedValue() const;
+
+    /// Return the minimum of the values represented by this histogram, or
+    /// positive infinity if `0 == count()`.
+    double min() const;
+
+    /// Return the lower bound of the range of values tracked with the
+    /// configured accuracy.
+    double minTrackedValue() const;
+
+    /// Return the number of buckets of this histogram.
+    int numBuckets() const;
+
+    /// Return an estimate of the specified `q`-quantile (e.g., 0.99 for the
+    /// 99th percentile) of the values represented by this histogram, i.e.,
+    /// of the value having the (zero-based) rank `floor(q * (count() - 1))`
+    /// in the sorted sequence of values.  If the quantile lies in the range
+    /// of tracked values, the estimate is within a relative distance
+    /// `relativeAccuracy()` of the exact quantile.  The estimate is never less than `min()` nor greater than
+    /// `max()`, and the 0- and 1-quantiles are `min()` and `max()`
+    /// respectively (unless the minimum and maximum are unknown because the
+    /// histogram was populated using only `addToBucket`).  The behavior is
+    /// undefined unless `0 <= q <= 1` and `0 < count()`.
+    double quantile(double q) const;
+
+    /// Return the maximum relative error of an estimated quantile.
+    double relativeAccuracy() const;
+
+    /// Return the sum of the values represented by this histogram.
+    double sum() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+
+    /// Write the value of this object to the specified output `stream` in
+    /// a human-readable format, and return a reference to `stream`.
+    /// Optionally specify an initial indentation `level`, whose absolute
+    /// value is incremented recursively for nested objects.  If `level` is
+    /// specified, optionally specify `spacesPerLevel`, whose absolute value
+    /// indicates the number of spaces per indentation level for this and
+    /// all of its nested objects.  If `level` is negative, suppress
+    /// indentation of the first line.  If `spacesPerLevel` is negative,
+    /// format the entire output on one line, suppressing all but the
+    /// initial indentation (as governed by `level`).  If `stream` is not
+    /// valid on entry, this operation has no effect.  Note that the
+    /// individual bucket counts are not printed.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` histograms have the same
+/// value, and `false` otherwise.  Two histograms have the same value if
+/// they have the same configuration, the same bucket counts, and the same
+/// count, sum, minimum, and maximum.
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` histograms do not have
+/// the same value, and `false` otherwise.  Two histograms do not have the
+/// same value if they differ in configuration, in any bucket count, or in
+/// their count, sum, minimum, or maximum.
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+
+/// Write the value of the specified `object` to the specified output
+/// `stream` in a single-line format, and return a reference providing
+/// modifiable access to `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& object);
+
+// FREE FUNCTIONS
+
+/// Exchange the values of the specified `a` and `b` objects.  This function
+/// provides the no-throw exception-safety guarantee if the two objects were
+/// created with the same allocator and the basic guarantee otherwise.
+void swap(Histogram& a, Histogram& b);
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// MANIPULATORS
+inline
+void Histogram::addToBucket(int index, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+    BSLS_ASSERT(0 <= count);
+
+    d_buckets[index] += count;
+    d_count          += count;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+double Histogram::max() const
+{
+    return d_max;
+}
+
+inline
+double Histogram::maxTrackedValue() const
+{
+    return d_maxTrackedValue;
+}
+
+inline
+double Histogram::min() const
+{
+    return d_min;
+}
+
+inline
+double Histogram::minTrackedValue() const
+{
+    return d_minTrackedValue;
+}
+
+inline
+int Histogram::numBuckets() const
+{
+    return static_cast<int>(d_buckets.size());
+}
+
+inline
+double Histogram::relativeAccuracy() const
+{
+    return d_relativeAccuracy;
+}
+
+inline
+double Histogram::sum() const
+{
+    return d_sum;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *Histogram::allocator() const
+{
+    return d_buckets.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+inline
+void bdlm::swap(Histogram& a, Histogram& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    Histogram futureA(b, a.allocator());
+    Histogram futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
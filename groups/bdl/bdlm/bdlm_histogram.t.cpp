@@ -0,0 +1,910 @@
+// bdlm_histogram.t.cpp                                               -*-C++-*-
+#include <bdlm_histogram.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::flush;
+using bsl::endl;
+using bsl::atoi;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a value-semantic histogram whose buckets form a
+// geometric sequence.  The primary concerns are that values are mapped to
+// buckets such that the estimated quantiles are within the configured
+// relative accuracy, that histograms having the same configuration merge
+// exactly, and that the usual value-semantic operations are correct.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bool isValid(double, double, double);
+//
+// CREATORS
+// [ 2] Histogram(bslma::Allocator *basicAllocator = 0);
+// [ 2] Histogram(double, double, double, bslma::Allocator * = 0);
+// [ 6] Histogram(const Histogram& original, bslma::Allocator * = 0);
+//
+// MANIPULATORS
+// [ 6] Histogram& operator=(const Histogram& rhs);
+// [ 3] void add(double value);
+// [ 5] void addToBucket(int index, bsls::Types::Int64 count);
+// [ 5] void accumulateSumMinMax(double sum, double min, double max);
+// [ 5] void merge(const Histogram& other);
+// [ 5] void reset();
+// [ 6] void swap(Histogram& other);
+//
+// ACCESSORS
+// [ 3] int bucketIndex(double value) const;
+// [ 3] bsls::Types::Int64 bucketCount(int index) const;
+// [ 3] double bucketValue(int index) const;
+// [ 3] bsls::Types::Int64 count() const;
+// [ 5] bool hasSameBuckets(const Histogram& other) const;
+// [ 3] double max() const;
+// [ 2] double maxTrackedValue() const;
+// [ 3] double min() const;
+// [ 2] double minTrackedValue() const;
+// [ 2] int numBuckets() const;
+// [ 4] double quantile(double q) const;
+// [ 2] double relativeAccuracy() const;
+// [ 3] double sum() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 7] bsl::ostream& print(bsl::ostream&, int, int) const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 6] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 7] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+//
+// FREE FUNCTIONS
+// [ 6] void swap(Histogram& a, Histogram& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+static int                test;
+static int             verbose;
+static int         veryVerbose;
+static int     veryVeryVerbose;
+static int veryVeryVeryVerbose;
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlm::Histogram    Obj;
+typedef bsls::Types::Int64 Int64;
+
+const double INF = bsl::numeric_limits<double>::infinity();
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+/// Return `true` if the specified `estimate` is within the specified
+/// relative `accuracy` of the specified `exact` value, allowing for
+/// floating-point rounding, and `false` otherwise.
+static bool isWithin(double estimate, double exact, double accuracy)
+{
+    return bsl::fabs(estimate - exact) <= exact * accuracy * (1 + 1e-9);
+}
+
+/// Return the value of (zero-based) rank `q * (values.size() - 1)` in the
+/// specified sorted `values`, for the specified `q`.
+static double exactQuantile(const bsl::vector<double>& values, double q)
+{
+    const double rank = q * static_cast<double>(values.size() - 1);
+    return values[static_cast<bsl::size_t>(rank)];
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+                   test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;  // always the last
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file
+        //    compiles, links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we measure the latency (in seconds) of a series of requests, and
+// want to know the median and the 99th percentile.  First, we create a
+// histogram that tracks values between a microsecond and 100 seconds with a
+// relative accuracy of 1%:
+// ```
+    bdlm::Histogram histogram(0.01, 1e-6, 100.0);
+// ```
+// Then, we add 1000 measurements, of which 989 are 1ms and 11 are 1s:
+// ```
+    for (int i = 0; i < 989; ++i) {
+        histogram.add(0.001);
+    }
+    for (int i = 0; i < 11; ++i) {
+        histogram.add(1.0);
+    }
+    ASSERT(1000 == histogram.count());
+// ```
+// Finally, we estimate the quantiles, each of which is within 1% of the
+// actual value:
+// ```
+    const double p50 = histogram.quantile(0.5);
+    const double p99 = histogram.quantile(0.99);
+
+    ASSERT(0.00099 <= p50 && p50 <= 0.00101);
+    ASSERT(0.99    <= p99 && p99 <= 1.01);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        // 1. `print` and `operator<<` write the configuration and the
+        //    aggregates of the histogram, on one line when requested.
+        //
+        // Plan:
+        // 1. Print a histogram with known values to a string stream and
+        //    compare the result with the expected output.  (C-1)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream&, int, int) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRINT AND OUTPUT OPERATOR" << endl
+                          << "=================================" << endl;
+
+        Obj mX(0.5, 1.0, 100.0, &ta);  const Obj& X = mX;
+
+        mX.add(2.0);
+        mX.add(6.0);
+
+        const char *EXPECTED = "[ relativeAccuracy = 0.5"
+                               " minTrackedValue = 1"
+                               " maxTrackedValue = 100"
+                               " count = 2 sum = 8 min = 2 max = 6 ]";
+
+        bsl::ostringstream os1(&ta);
+        X.print(os1, 0, -1);
+        ASSERTV(os1.str(), EXPECTED == os1.str());
+
+        bsl::ostringstream os2(&ta);
+        os2 << X;
+        ASSERTV(os2.str(), EXPECTED == os2.str());
+
+        bsl::ostringstream os3(&ta);
+        X.print(os3);
+        ASSERTV(os3.str(), bsl::string::npos != os3.str().find("\n"));
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        // 1. Two histograms compare equal if and only if they have the same
+        //    configuration, buckets, and aggregates.
+        //
+        // 2. The copy constructor and the assignment operator create an
+        //    equal object, using the appropriate allocator.
+        //
+        // 3. `swap` exchanges the values of two objects, for both equal and
+        //    unequal allocators.
+        //
+        // Plan:
+        // 1. Create histograms differing in a single attribute and compare
+        //    them.  (C-1)
+        //
+        // 2. Copy, assign, and swap histograms, verifying their values and
+        //    allocators.  (C-2..3)
+        //
+        // Testing:
+        //   Histogram(const Histogram& original, bslma::Allocator * = 0);
+        //   Histogram& operator=(const Histogram& rhs);
+        //   void swap(Histogram& other);
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        //   void swap(Histogram& a, Histogram& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING VALUE-SEMANTIC OPERATIONS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mA(0.01, 1.0, 1000.0, &ta);  const Obj& A = mA;
+        Obj mB(0.02, 1.0, 1000.0, &ta);  const Obj& B = mB;
+        Obj mC(0.01, 1.0, 1000.0, &ta);  const Obj& C = mC;
+
+        if (verbose) cout << "\tTesting equality." << endl;
+
+        ASSERT(  A == C);
+        ASSERT(!(A != C));
+        ASSERT(!(A == B));
+        ASSERT(  A != B);
+
+        mA.add(5.0);
+        ASSERT(A != C);
+
+        mC.add(5.0);
+        ASSERT(A == C);
+
+        mA.add(7.0);
+        mC.add(7.01);      // same bucket, different sum/min/max
+        ASSERT(A.bucketIndex(7.0) == C.bucketIndex(7.01));
+        ASSERT(A != C);
+
+        mC.reset();
+        mC.addToBucket(C.bucketIndex(5.0), 1);
+        mC.addToBucket(C.bucketIndex(7.0), 1);
+        ASSERT(A != C);    // same buckets, different sum/min/max
+        mC.accumulateSumMinMax(12.0, 5.0, 7.0);
+        ASSERT(A == C);
+
+        if (verbose) cout << "\tTesting copy and assignment." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX(A, &oa);  const Obj& X = mX;
+            ASSERT(A   == X);
+            ASSERT(&oa == X.allocator());
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            ASSERT(A != Y);
+
+            Obj *mR = &(mY = A);
+            ASSERT(mR  == &mY);
+            ASSERT(A   == Y);
+            ASSERT(&oa == Y.allocator());
+
+            mY = Y;
+            ASSERT(A == Y);
+
+            ASSERT(dam.isTotalSame());
+        }
+
+        if (verbose) cout << "\tTesting swap." << endl;
+        {
+            Obj mX(A, &ta);  const Obj& X = mX;
+            Obj mY(B, &ta);  const Obj& Y = mY;
+
+            mX.swap(mY);
+            ASSERT(B == X);
+            ASSERT(A == Y);
+
+            swap(mX, mY);
+            ASSERT(A == X);
+            ASSERT(B == Y);
+
+            Obj mZ(B, &oa);  const Obj& Z = mZ;
+
+            swap(mX, mZ);
+            ASSERT(B   == X);
+            ASSERT(A   == Z);
+            ASSERT(&ta == X.allocator());
+            ASSERT(&oa == Z.allocator());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+            Obj mY(&oa);
+
+            ASSERT_FAIL(mX.swap(mY));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING MERGE AND BUCKET-LEVEL MANIPULATORS
+        //
+        // Concerns:
+        // 1. `merge` of two histograms having the same configuration yields
+        //    the histogram of the union of their values.
+        //
+        // 2. `addToBucket` and `accumulateSumMinMax` allow a histogram to be
+        //    reconstituted from its buckets and aggregates.
+        //
+        // 3. `reset` removes all values and retains the configuration.
+        //
+        // 4. `hasSameBuckets` compares the configurations.
+        //
+        // 5. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Split a set of values between two histograms, merge them, and
+        //    compare the result with a histogram of all the values.  (C-1)
+        //
+        // 2. Reconstitute a histogram from the buckets and aggregates of
+        //    another one, and compare the two.  (C-2)
+        //
+        // 3. Reset a histogram, and verify its state.  (C-3)
+        //
+        // 4. Compare histograms having different configurations.  (C-4)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void addToBucket(int index, bsls::Types::Int64 count);
+        //   void accumulateSumMinMax(double sum, double min, double max);
+        //   void merge(const Histogram& other);
+        //   void reset();
+        //   bool hasSameBuckets(const Histogram& other) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "TESTING MERGE AND BUCKET-LEVEL MANIPULATORS" << endl
+                  << "===========================================" << endl;
+
+        Obj mAll(&ta);  const Obj& ALL = mAll;
+        Obj mA(&ta);    const Obj& A   = mA;
+        Obj mB(&ta);    const Obj& B   = mB;
+
+        for (int i = 1; i <= 1000; ++i) {
+            const double value = i * 0.25;
+
+            mAll.add(value);
+            if (i % 3) {
+                mA.add(value);
+            }
+            else {
+                mB.add(value);
+            }
+        }
+
+        ASSERT(A.count() + B.count() == ALL.count());
+
+        mA.merge(B);
+        ASSERT(ALL == A);
+
+        if (verbose) cout << "\tTesting reconstitution." << endl;
+        {
+            Obj mX(ALL.relativeAccuracy(),
+                   ALL.minTrackedValue(),
+                   ALL.maxTrackedValue(),
+                   &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < ALL.numBuckets(); ++i) {
+                if (ALL.bucketCount(i)) {
+                    mX.addToBucket(i, ALL.bucketCount(i));
+                }
+            }
+            ASSERT(ALL.count() == X.count());
+            ASSERT(ALL         != X);
+
+            mX.accumulateSumMinMax(ALL.sum(), ALL.min(), ALL.max());
+            ASSERT(ALL == X);
+        }
+
+        if (verbose) cout << "\tTesting reset." << endl;
+        {
+            mA.reset();
+            ASSERT(Obj(&ta)  == A);
+            ASSERT(0         == A.count());
+            ASSERT(0.0       == A.sum());
+            ASSERT(INF       == A.min());
+            ASSERT(-INF      == A.max());
+            ASSERT(ALL.numBuckets() == A.numBuckets());
+        }
+
+        if (verbose) cout << "\tTesting `hasSameBuckets`." << endl;
+        {
+            const Obj X(0.01, 1.0, 10.0, &ta);
+
+            ASSERT( X.hasSameBuckets(Obj(0.01, 1.0, 10.0, &ta)));
+            ASSERT(!X.hasSameBuckets(Obj(0.02, 1.0, 10.0, &ta)));
+            ASSERT(!X.hasSameBuckets(Obj(0.01, 2.0, 10.0, &ta)));
+            ASSERT(!X.hasSameBuckets(Obj(0.01, 1.0, 20.0, &ta)));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(0.01, 1.0, 10.0, &ta);
+            Obj mY(0.02, 1.0, 10.0, &ta);
+
+            ASSERT_PASS(mX.addToBucket(0, 1));
+            ASSERT_PASS(mX.addToBucket(mX.numBuckets() - 1, 0));
+            ASSERT_FAIL(mX.addToBucket(-1, 1));
+            ASSERT_FAIL(mX.addToBucket(mX.numBuckets(), 1));
+            ASSERT_FAIL(mX.addToBucket(0, -1));
+
+            ASSERT_PASS(mX.merge(mX));
+            ASSERT_FAIL(mX.merge(mY));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `quantile`
+        //
+        // Concerns:
+        // 1. For values in the tracked range, an estimated quantile is
+        //    within the configured relative accuracy of the exact quantile.
+        //
+        // 2. The estimate is clamped to the range `[min(), max()]`, so that
+        //    values outside the tracked range are reported exactly at the
+        //    extreme quantiles.
+        //
+        // 3. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For several accuracies, add a set of values spanning several
+        //    orders of magnitude, and compare a range of estimated quantiles
+        //    with the exact quantiles of the sorted values.  (C-1)
+        //
+        // 2. Add values outside the tracked range, and verify the estimates
+        //    of the 0 and 1 quantiles.  (C-2)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   double quantile(double q) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `quantile`" << endl
+                          << "==================" << endl;
+
+        const double ACCURACIES[] = { 0.001, 0.01, 0.05, 0.2 };
+        const double QUANTILES[]  = { 0.0, 0.01, 0.25, 0.5, 0.75,
+                                      0.9, 0.99, 0.999, 1.0 };
+
+        const int NUM_ACCURACIES = sizeof ACCURACIES / sizeof *ACCURACIES;
+        const int NUM_QUANTILES  = sizeof QUANTILES  / sizeof *QUANTILES;
+
+        bsl::vector<double> values(&ta);
+        for (int i = 0; i < 5000; ++i) {
+            // Geometric progression from 1e-6 to about 1e3, shuffled
+            // deterministically.
+
+            values.push_back(1e-6 * bsl::pow(1.0042, (i * 7919) % 5000));
+        }
+
+        for (int ai = 0; ai < NUM_ACCURACIES; ++ai) {
+            const double ACCURACY = ACCURACIES[ai];
+
+            Obj mX(ACCURACY, 1e-9, 1e9, &ta);  const Obj& X = mX;
+
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                mX.add(values[i]);
+            }
+
+            bsl::vector<double> sorted(values, &ta);
+            bsl::sort(sorted.begin(), sorted.end());
+
+            for (int qi = 0; qi < NUM_QUANTILES; ++qi) {
+                const double Q     = QUANTILES[qi];
+                const double EXACT = exactQuantile(sorted, Q);
+                const double EST   = X.quantile(Q);
+
+                if (veryVerbose) { T_ P_(ACCURACY) P_(Q) P_(EXACT) P(EST) }
+
+                ASSERTV(ACCURACY, Q, EXACT, EST,
+                        isWithin(EST, EXACT, ACCURACY));
+            }
+        }
+
+        if (verbose) cout << "\tTesting values outside the range." << endl;
+        {
+            Obj mX(0.01, 1.0, 100.0, &ta);  const Obj& X = mX;
+
+            mX.add(0.25);
+            mX.add(-3.0);
+            mX.add(50.0);
+            mX.add(1000.0);
+
+            ASSERT(0                    == X.bucketIndex(0.25));
+            ASSERT(0                    == X.bucketIndex(-3.0));
+            ASSERT(X.numBuckets() - 1   == X.bucketIndex(1000.0));
+            ASSERT(2                    == X.bucketCount(0));
+
+            ASSERTV(X.quantile(0.0),  -3.0   == X.quantile(0.0));
+            ASSERTV(X.quantile(1.0),  1000.0 == X.quantile(1.0));
+            ASSERTV(X.quantile(0.67), isWithin(X.quantile(0.67), 50.0, 0.01));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.quantile(0.5));
+
+            mX.add(1.0);
+
+            ASSERT_PASS(X.quantile(0.0));
+            ASSERT_PASS(X.quantile(1.0));
+            ASSERT_FAIL(X.quantile(-0.1));
+            ASSERT_FAIL(X.quantile(1.1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `add` AND BUCKET ACCESSORS
+        //
+        // Concerns:
+        // 1. `add` increments the count of the bucket selected by
+        //    `bucketIndex`, and maintains the count, sum, minimum, and
+        //    maximum.
+        //
+        // 2. Every value in the tracked range is within the relative
+        //    accuracy of the value representing its bucket.
+        //
+        // 3. Bucket indices increase monotonically with the value.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Add a sequence of values and verify the bucket counts and the
+        //    aggregates.  (C-1)
+        //
+        // 2. For a dense sequence of values spanning the tracked range,
+        //    verify the relative distance to the bucket value, and that the
+        //    bucket index is non-decreasing.  (C-2..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void add(double value);
+        //   int bucketIndex(double value) const;
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   double bucketValue(int index) const;
+        //   bsls::Types::Int64 count() const;
+        //   double max() const;
+        //   double min() const;
+        //   double sum() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `add` AND BUCKET ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        const double ACCURACY = 0.02;
+
+        Obj mX(ACCURACY, 1e-3, 1e3, &ta);  const Obj& X = mX;
+
+        ASSERT(0    == X.count());
+        ASSERT(0.0  == X.sum());
+        ASSERT(INF  == X.min());
+        ASSERT(-INF == X.max());
+
+        mX.add(3.0);
+        mX.add(3.0);
+        mX.add(0.5);
+        mX.add(20.0);
+
+        ASSERT(4    == X.count());
+        ASSERT(26.5 == X.sum());
+        ASSERT(0.5  == X.min());
+        ASSERT(20.0 == X.max());
+
+        ASSERT(2 == X.bucketCount(X.bucketIndex(3.0)));
+        ASSERT(1 == X.bucketCount(X.bucketIndex(0.5)));
+        ASSERT(1 == X.bucketCount(X.bucketIndex(20.0)));
+
+        Int64 total = 0;
+        for (int i = 0; i < X.numBuckets(); ++i) {
+            total += X.bucketCount(i);
+        }
+        ASSERT(X.count() == total);
+
+        if (verbose) cout << "\tTesting bucket accuracy." << endl;
+        {
+            int prevIndex = 0;
+            for (double value = 1.0001e-3; value < 1e3; value *= 1.001) {
+                const int    INDEX = X.bucketIndex(value);
+                const double REP   = X.bucketValue(INDEX);
+
+                ASSERTV(value, INDEX, prevIndex, prevIndex <= INDEX);
+                ASSERTV(value, REP, isWithin(REP, value, ACCURACY));
+
+                prevIndex = INDEX;
+            }
+            ASSERT(X.numBuckets() - 1 == prevIndex);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(X.bucketCount(0));
+            ASSERT_PASS(X.bucketCount(X.numBuckets() - 1));
+            ASSERT_FAIL(X.bucketCount(-1));
+            ASSERT_FAIL(X.bucketCount(X.numBuckets()));
+
+            ASSERT_PASS(X.bucketValue(0));
+            ASSERT_PASS(X.bucketValue(X.numBuckets() - 1));
+            ASSERT_FAIL(X.bucketValue(-1));
+            ASSERT_FAIL(X.bucketValue(X.numBuckets()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND CONFIGURATION
+        //
+        // Concerns:
+        // 1. A default-constructed histogram has the default configuration.
+        //
+        // 2. The value constructor sets the configuration, and the number of
+        //    buckets matches the documented formula.
+        //
+        // 3. `isValid` accepts exactly the valid configurations.
+        //
+        // 4. The supplied (or default) allocator is used.
+        //
+        // 5. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Create histograms with the default and explicit configurations
+        //    and verify their attributes and allocators.  (C-1..2, 4)
+        //
+        // 2. Call `isValid` with valid and invalid configurations.  (C-3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   static bool isValid(double, double, double);
+        //   Histogram(bslma::Allocator *basicAllocator = 0);
+        //   Histogram(double, double, double, bslma::Allocator * = 0);
+        //   double maxTrackedValue() const;
+        //   double minTrackedValue() const;
+        //   int numBuckets() const;
+        //   double relativeAccuracy() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND CONFIGURATION" << endl
+                          << "==================================" << endl;
+
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_RELATIVE_ACCURACY == X.relativeAccuracy());
+            ASSERT(Obj::k_DEFAULT_MIN_TRACKED_VALUE == X.minTrackedValue());
+            ASSERT(Obj::k_DEFAULT_MAX_TRACKED_VALUE == X.maxTrackedValue());
+            ASSERT(&defaultAllocator                == X.allocator());
+            ASSERT(0                                == X.count());
+
+            ASSERT(dam.isTotalUp());
+        }
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX(0.01, 1e-9, 1e3, &ta);  const Obj& X = mX;
+
+            ASSERT(0.01 == X.relativeAccuracy());
+            ASSERT(1e-9 == X.minTrackedValue());
+            ASSERT(1e3  == X.maxTrackedValue());
+            ASSERT(&ta  == X.allocator());
+            ASSERTV(X.numBuckets(), 1383 == X.numBuckets());
+
+            ASSERT(dam.isTotalSame());
+        }
+
+        if (verbose) cout << "\tTesting `isValid`." << endl;
+        {
+            ASSERT( Obj::isValid(0.01,  1.0,  2.0));
+            ASSERT( Obj::isValid(0.999, 1e-300, 1e300));
+            ASSERT(!Obj::isValid(0.0,   1.0,  2.0));
+            ASSERT(!Obj::isValid(1.0,   1.0,  2.0));
+            ASSERT(!Obj::isValid(-0.1,  1.0,  2.0));
+            ASSERT(!Obj::isValid(0.01,  0.0,  2.0));
+            ASSERT(!Obj::isValid(0.01,  2.0,  2.0));
+            ASSERT(!Obj::isValid(0.01,  2.0,  1.0));
+            ASSERT(!Obj::isValid(0.01,  1.0,  INF));
+            ASSERT(!Obj::isValid(1e-9,  1e-9, 1e9));  // too many buckets
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(0.01, 1.0, 2.0, &ta));
+            ASSERT_FAIL(Obj(0.0,  1.0, 2.0, &ta));
+            ASSERT_FAIL(Obj(0.01, 2.0, 1.0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a histogram, add values, and estimate quantiles.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.add(i);
+        }
+
+        ASSERT(100    == X.count());
+        ASSERT(5050.0 == X.sum());
+        ASSERT(1.0    == X.min());
+        ASSERT(100.0  == X.max());
+
+        if (veryVerbose) { P(X.quantile(0.5)) P(X.quantile(0.99)) }
+
+        ASSERT(isWithin(X.quantile(0.5),  50.0, 0.01));
+        ASSERT(isWithin(X.quantile(0.99), 99.0, 0.01));
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.merge(X);
+        ASSERT(200 == Y.count());
+        ASSERT(X   != Y);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory came from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
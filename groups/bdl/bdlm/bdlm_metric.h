@@ -12,20 +12,26 @@ BSLS_IDENT("$Id$")
 //@CLASSES:
 //  bdlm::Metric: variant of metric values
 //
+//@SEE_ALSO: bdlm_histogram
+//
 //@DESCRIPTION: This component defines a value semantic class, `bdlmt::Metric`,
 // that represents a measurement (or measurements) for a metric.
 // A `bdlm::Metric` value is collected from an object that reports metrics
 // using a callback that is registered with the `bdlm::MetricsRegistry`.  A
 // `bdlm::Metric` value is a variant type, which can hold one of several types
-// of measurements (in theory).  Currently the only supported metric type is a
-// `Guage`, which represents a single instantaneous value for the most recent
-// measurement.
+// of measurements.  Currently the supported metric types are a `Gauge`, which
+// represents a single instantaneous value for the most recent measurement,
+// and a `Histogram` (see `bdlm_histogram`), which represents the distribution
+// of the values measured since the previous collection, and from which
+// quantiles (e.g., the 99th percentile latency) can be estimated.
 //
 ///Usage
 ///-----
 // The intended use of this component is illustrated in
 // {`bdlm_metricsregistrar`|Usage}.
 
+#include <bdlm_histogram.h>
+
 #include <bdlb_variant.h>
 
 #include <bsls_assert.h>
@@ -38,11 +44,12 @@ class Metric {
 
   public:
     // PUBLIC TYPES
-    typedef double Gauge;
+    typedef double          Gauge;
+    typedef bdlm::Histogram Histogram;
 
   private:
     // DATA
-    bdlb::Variant<Gauge> d_value;  // value of the metric
+    bdlb::Variant<Gauge, Histogram> d_value;  // value of the metric
 
     // FRIENDS
     friend bool operator==(const Metric& lhs, const Metric& rhs);
@@ -57,6 +64,11 @@ class Metric {
     /// Create a metric with the specified `value`.
     explicit Metric(const Gauge& value);
 
+    /// Create a metric with the specified histogram `value`.  Note that
+    /// memory for the histogram is supplied by the currently installed
+    /// default allocator.
+    explicit Metric(const Histogram& value);
+
     //! ~Metric() = default;
         // Destroy this 'Metric' object.
 
@@ -65,6 +77,9 @@ class Metric {
     /// Assign to this metric the specified `value`.
     Metric& operator=(const Gauge& value);
 
+    /// Assign to this metric the specified histogram `value`.
+    Metric& operator=(const Histogram& value);
+
     // ACCESSORS
 
     /// Return `true` if the value of this metric is of gauge type, and
@@ -74,6 +89,14 @@ class Metric {
     /// Return a `const` reference to the value of this metric of gauge
     /// type.  The behavior is undefined unless `true == isGuage()`.
     const Gauge& theGauge() const;
+
+    /// Return `true` if the value of this metric is of histogram type, and
+    /// `false` otherwise.
+    bool isHistogram() const;
+
+    /// Return a `const` reference to the value of this metric of histogram
+    /// type.  The behavior is undefined unless `true == isHistogram()`.
+    const Histogram& theHistogram() const;
 };
 
 // FREE OPERATORS
@@ -111,6 +134,12 @@ Metric::Metric(const Gauge& value)
 }
 
 // MANIPULATORS
+inline
+Metric::Metric(const Histogram& value)
+: d_value(value)
+{
+}
+
 inline
 Metric& Metric::operator=(const Gauge& value)
 {
@@ -118,6 +147,13 @@ Metric& Metric::operator=(const Gauge& value)
     return *this;
 }
 
+inline
+Metric& Metric::operator=(const Histogram& value)
+{
+    d_value = value;
+    return *this;
+}
+
 // ACCESSORS
 inline
 bool Metric::isGauge() const
@@ -133,6 +169,20 @@ const Metric::Gauge& Metric::theGauge() const
     return d_value.the<Gauge>();
 }
 
+inline
+bool Metric::isHistogram() const
+{
+    return d_value.is<Histogram>();
+}
+
+inline
+const Metric::Histogram& Metric::theHistogram() const
+{
+    BSLS_ASSERT(isHistogram());
+
+    return d_value.the<Histogram>();
+}
+
 // FREE OPERATORS
 inline
 bool operator==(const Metric& lhs, const Metric& rhs)
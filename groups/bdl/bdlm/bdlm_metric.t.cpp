@@ -32,14 +32,18 @@ using bsl::atoi;
 // CREATORS
 // [ 2] Metric();
 // [ 3] Metric(const Gauge& value);
+// [ 5] Metric(const Histogram& value);
 // [ 2] ~Metric();
 //
 // MANIPULATORS
 // [ 3] Metric& operator=(const Gauge& value);
+// [ 5] Metric& operator=(const Histogram& value);
 //
 // ACCESSORS
 // [ 3] bool isGauge() const;
 // [ 3] const Gauge& theGauge() const;
+// [ 5] bool isHistogram() const;
+// [ 5] const Histogram& theHistogram() const;
 //
 // FREE OPERATORS
 // [ 4] bool operator==(const Metric& lhs, rhs);
@@ -129,6 +133,83 @@ int main(int argc, char* argv[])
     bslma::TestAllocator ta(veryVeryVeryVerbose);
 
     switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // HISTOGRAM METHODS
+        //
+        // Concerns:
+        // 1. The histogram value constructor creates the correct initial
+        //    value.
+        //
+        // 2. The histogram value assignment operator works as expected, both
+        //    from a gauge value and from a histogram value.
+        //
+        // 3. The histogram value accessors, `isHistogram` and `theHistogram`,
+        //    work as expected, and `isGauge` is `false` for a histogram value.
+        //
+        // 4. Metrics holding histograms compare equal if and only if the
+        //    histograms compare equal, and never compare equal to a gauge.
+        //
+        // Plan:
+        // 1. Install `ta` as the default allocator, since a histogram held by
+        //    a metric obtains its memory from the default allocator.
+        //
+        // 2. Create objects using the value constructor and verify the value
+        //    using the accessors.  (C-1,3)
+        //
+        // 3. Modify the objects using the assignment operators and verify the
+        //    value using the accessors and the equality operators.  (C-2..4)
+        //
+        // Testing:
+        //   Metric(const Histogram& value);
+        //   Metric& operator=(const Histogram& value);
+        //   bool isHistogram() const;
+        //   const Histogram& theHistogram() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HISTOGRAM METHODS" << endl
+                          << "=================" << endl;
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        Obj::Histogram h1(&ta);
+        Obj::Histogram h2(&ta);
+
+        h1.add(1.0);
+        h1.add(2.0);
+        h2.add(3.0);
+
+        {
+            Obj mX(h1);  const Obj& X = mX;
+
+            ASSERT(false == X.isGauge());
+            ASSERT(true  == X.isHistogram());
+            ASSERT(h1    == X.theHistogram());
+            ASSERT(h2    != X.theHistogram());
+
+            Obj& mY = (mX = h2);  const Obj& Y = mY;
+
+            ASSERT(true  == Y.isHistogram());
+            ASSERT(h1    != Y.theHistogram());
+            ASSERT(h2    == Y.theHistogram());
+
+            ASSERT(Obj(h2) == X);
+            ASSERT(Obj(h1) != X);
+
+            mX = Obj::Gauge(1.0);
+
+            ASSERT(true  == X.isGauge());
+            ASSERT(false == X.isHistogram());
+            ASSERT(Obj(h2) != X);
+
+            mX = h1;
+
+            ASSERT(true  == X.isHistogram());
+            ASSERT(h1    == X.theHistogram());
+        }
+        ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING EQUALITY-COMPARISON OPERATORS
@@ -0,0 +1,183 @@
+// bdlmt_stripeutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLMT_STRIPEUTIL
+#define INCLUDED_BDLMT_STRIPEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility for assigning threads to stripes of data.
+//
+//@CLASSES:
+//  bdlmt::StripeUtil: namespace for stripe-selection functions
+//
+//@SEE_ALSO: bslmt_threadutil
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlmt::StripeUtil`, that
+// serves as a namespace for functions that map a key, typically a thread
+// identifier, to one of a fixed number of "stripes".  A data structure that
+// is updated concurrently by many threads can reduce contention by keeping
+// several copies ("stripes") of its mutable state, each on its own cache
+// line, having each thread update only the stripe selected for it, and
+// combining the stripes when the state is read.
+//
+// `stripeIndex` spreads its keys over the stripes using Fibonacci hashing
+// (multiplication by 2^64 divided by the golden ratio, keeping the high-order
+// bits of the product), so that keys that differ only in their low-order bits,
+// or that are multiples of a large power of two (as thread identifiers, which
+// are typically the addresses of aligned thread control blocks, often are),
+// are nonetheless distributed evenly.  `selfStripeIndex` returns the stripe
+// selected for the calling thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Striped Counter
+/// - - - - - - - - - - - - - -
+// Suppose we want a counter that many threads increment frequently, and that
+// is read only rarely.  Incrementing a single atomic integer from many threads
+// makes the cache line holding it move between processors on every increment.
+// Instead, we keep one count per stripe, each on its own cache line, and have
+// each thread increment the count of the stripe selected for it:
+// ```
+// class StripedCounter {
+//     // PRIVATE TYPES
+//     enum { k_NUM_STRIPES = 8 };
+//
+//     struct Stripe {
+//         bsls::AtomicInt64 d_count;
+//         char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+//                                  - sizeof(bsls::AtomicInt64)];
+//     };
+//
+//     // DATA
+//     Stripe d_stripes[k_NUM_STRIPES];
+//
+//   public:
+//     // CREATORS
+//
+//     /// Create a counter having the value 0.
+//     StripedCounter()
+//     {
+//     }
+//
+//     // MANIPULATORS
+//
+//     /// Increment the value of this counter.
+//     void increment()
+//     {
+//         Stripe& stripe =
+//                d_stripes[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
+//         stripe.d_count.addRelaxed(1);
+//     }
+//
+//     // ACCESSORS
+//
+//     /// Return the value of this counter.
+//     bsls::Types::Int64 value() const
+//     {
+//         bsls::Types::Int64 result = 0;
+//         for (int i = 0; i < k_NUM_STRIPES; ++i) {
+//             result += d_stripes[i].d_count.loadRelaxed();
+//         }
+//         return result;
+//     }
+// };
+// ```
+// Then, we use the counter, whose value is the number of increments made by
+// all threads:
+// ```
+// StripedCounter counter;
+// for (int i = 0; i < 10; ++i) {
+//     counter.increment();
+// }
+// assert(10 == counter.value());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                              // =================
+                              // struct StripeUtil
+                              // =================
+
+/// This `struct` provides a namespace for functions that assign keys, and in
+/// particular threads, to stripes of data.
+struct StripeUtil {
+
+    // CLASS METHODS
+
+    /// Return the index, in the range `[0 .. numStripes - 1]`, of the stripe
+    /// assigned to the specified `key`.  The behavior is undefined unless
+    /// `0 < numStripes`.  Note that the same `key` is always assigned the
+    /// same stripe for a given `numStripes`.
+    static int stripeIndex(bsls::Types::Uint64 key, int numStripes);
+
+    /// Return the index, in the range `[0 .. numStripes - 1]`, of the stripe
+    /// assigned to the calling thread, i.e.,
+    /// `stripeIndex(bslmt::ThreadUtil::selfIdAsUint64(), numStripes)`.  The
+    /// behavior is undefined unless `0 < numStripes`.
+    static int selfStripeIndex(int numStripes);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct StripeUtil
+                              // -----------------
+
+// CLASS METHODS
+inline
+int StripeUtil::stripeIndex(bsls::Types::Uint64 key, int numStripes)
+{
+    BSLS_ASSERT(0 < numStripes);
+
+    // The high-order half of the product depends on every bit of 'key', and
+    // is scaled to '[0 .. numStripes - 1]' by keeping the high-order bits of
+    // its product with 'numStripes', rather than by a modulo operation, which
+    // would depend only on its low-order bits.
+
+    const bsls::Types::Uint64 hash = (key * 0x9E3779B97F4A7C15ULL) >> 32;
+
+    return static_cast<int>((hash * static_cast<unsigned int>(numStripes))
+                                                                       >> 32);
+}
+
+inline
+int StripeUtil::selfStripeIndex(int numStripes)
+{
+    BSLS_ASSERT(0 < numStripes);
+
+    return stripeIndex(bslmt::ThreadUtil::selfIdAsUint64(), numStripes);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
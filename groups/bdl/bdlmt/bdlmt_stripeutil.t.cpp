@@ -0,0 +1,421 @@
+// bdlmt_stripeutil.t.cpp                                             -*-C++-*-
+#include <bdlmt_stripeutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// This component is a utility providing two stateless functions.  The primary
+// concerns are that `stripeIndex` always returns an index in range, that it is
+// deterministic, and that it spreads keys that are multiples of a large power
+// of two (as thread identifiers often are) evenly over the stripes; and that
+// `selfStripeIndex` applies `stripeIndex` to the identifier of the calling
+// thread.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int stripeIndex(bsls::Types::Uint64 key, int numStripes);
+// [ 3] int selfStripeIndex(int numStripes);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlmt::StripeUtil   Util;
+typedef bsls::Types::Uint64 Uint64;
+
+namespace {
+bool     verbose = false;
+bool veryVerbose = false;
+}  // close unnamed namespace
+
+//=============================================================================
+//                           CASE 3 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+namespace bdlmt_stripeutil_test_case_3 {
+
+/// Record, at the index corresponding to the calling thread in the specified
+/// `mismatches` array, whether `selfStripeIndex` disagrees with
+/// `stripeIndex` applied to the identifier of the calling thread.
+extern "C" void *checkSelfStripeIndex(void *mismatches)
+{
+    bsls::AtomicInt *numMismatches = static_cast<bsls::AtomicInt *>(
+                                                                  mismatches);
+
+    const Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    for (int numStripes = 1; numStripes <= 64; ++numStripes) {
+        if (Util::stripeIndex(id, numStripes) !=
+                                          Util::selfStripeIndex(numStripes)) {
+            ++*numMismatches;
+        }
+    }
+    return 0;
+}
+
+}  // close namespace bdlmt_stripeutil_test_case_3
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Striped Counter
+/// - - - - - - - - - - - - - -
+// Suppose we want a counter that many threads increment frequently, and that
+// is read only rarely.  Incrementing a single atomic integer from many threads
+// makes the cache line holding it move between processors on every increment.
+// Instead, we keep one count per stripe, each on its own cache line, and have
+// each thread increment the count of the stripe selected for it:
+// ```
+class StripedCounter {
+    // PRIVATE TYPES
+    enum { k_NUM_STRIPES = 8 };
+
+    struct Stripe {
+        bsls::AtomicInt64 d_count;
+        char              d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                 - sizeof(bsls::AtomicInt64)];
+    };
+
+    // DATA
+    Stripe d_stripes[k_NUM_STRIPES];
+
+  public:
+    // CREATORS
+
+    /// Create a counter having the value 0.
+    StripedCounter()
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Increment the value of this counter.
+    void increment()
+    {
+        Stripe& stripe =
+               d_stripes[bdlmt::StripeUtil::selfStripeIndex(k_NUM_STRIPES)];
+        stripe.d_count.addRelaxed(1);
+    }
+
+    // ACCESSORS
+
+    /// Return the value of this counter.
+    bsls::Types::Int64 value() const
+    {
+        bsls::Types::Int64 result = 0;
+        for (int i = 0; i < k_NUM_STRIPES; ++i) {
+            result += d_stripes[i].d_count.loadRelaxed();
+        }
+        return result;
+    }
+};
+// ```
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int    test = argc > 1 ? atoi(argv[1]) : 0;
+        verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << '\n';
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   This will test the usage example provided in the component header
+        //   file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file must
+        //    compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        // 1. Copy the usage example from the component header, change `assert`
+        //    to `ASSERT`, and run it.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING USAGE EXAMPLE" "\n"
+                          << "=====================" "\n";
+
+// Then, we use the counter, whose value is the number of increments made by
+// all threads:
+// ```
+        StripedCounter counter;
+        for (int i = 0; i < 10; ++i) {
+            counter.increment();
+        }
+        ASSERT(10 == counter.value());
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `selfStripeIndex`
+        //
+        // Concerns:
+        // 1. `selfStripeIndex` returns the result of `stripeIndex` applied to
+        //    the identifier of the calling thread, in every thread.
+        //
+        // 2. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. In the main thread and in several other threads, compare
+        //    `selfStripeIndex` with `stripeIndex` applied to
+        //    `bslmt::ThreadUtil::selfIdAsUint64()` for a range of stripe
+        //    counts.  (C-1)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a non-positive number of stripes.  (C-2)
+        //
+        // Testing:
+        //   int selfStripeIndex(int numStripes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `selfStripeIndex`" "\n"
+                          << "=========================" "\n";
+
+        using namespace bdlmt_stripeutil_test_case_3;
+
+        enum { k_NUM_THREADS = 8 };
+
+        bsls::AtomicInt numMismatches(0);
+
+        checkSelfStripeIndex(&numMismatches);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  checkSelfStripeIndex,
+                                                  &numMismatches));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        ASSERTV(numMismatches, 0 == numMismatches);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::selfStripeIndex( 1));
+            ASSERT_FAIL(Util::selfStripeIndex( 0));
+            ASSERT_FAIL(Util::selfStripeIndex(-1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `stripeIndex`
+        //
+        // Concerns:
+        // 1. The returned index is in the range `[0 .. numStripes - 1]`.
+        //
+        // 2. The same key is always assigned the same stripe.
+        //
+        // 3. Keys that are consecutive, or that are consecutive multiples of
+        //    a large power of two, are spread evenly over the stripes.
+        //
+        // 4. A single stripe is always selected when there is only one.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For a range of stripe counts, and for each of several strides
+        //    (1, and powers of two up to 2^20), map a run of keys spaced by
+        //    the stride to stripes, verifying that each index is in range and
+        //    is the same when computed again.  (C-1..2, 4)
+        //
+        // 2. Count the keys assigned to each stripe in P-1 and verify that no
+        //    stripe receives fewer than half, or more than twice, its fair
+        //    share.  (C-3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a non-positive number of stripes.  (C-5)
+        //
+        // Testing:
+        //   int stripeIndex(bsls::Types::Uint64 key, int numStripes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `stripeIndex`" "\n"
+                          << "=====================" "\n";
+
+        const int    k_NUM_KEYS = 4096;
+        const Uint64 BASE       = 0x7f3a12340000ULL;
+
+        for (int numStripes = 1; numStripes <= 64; ++numStripes) {
+            for (int shift = 0; shift <= 20; shift += 4) {
+                const Uint64 STRIDE = 1ULL << shift;
+
+                if (veryVerbose) { T_ P_(numStripes) P(STRIDE) }
+
+                bsl::vector<int> counts(numStripes, 0);
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    const Uint64 KEY   = BASE + STRIDE * i;
+                    const int    INDEX = Util::stripeIndex(KEY, numStripes);
+
+                    ASSERTV(numStripes, KEY, INDEX, 0 <= INDEX);
+                    ASSERTV(numStripes, KEY, INDEX, INDEX < numStripes);
+                    ASSERTV(numStripes, KEY, INDEX,
+                            INDEX == Util::stripeIndex(KEY, numStripes));
+
+                    if (0 <= INDEX && INDEX < numStripes) {
+                        ++counts[INDEX];
+                    }
+                }
+
+                const int FAIR = k_NUM_KEYS / numStripes;
+                for (int j = 0; j < numStripes; ++j) {
+                    ASSERTV(numStripes, STRIDE, j, counts[j],
+                            FAIR / 2 <= counts[j]);
+                    ASSERTV(numStripes, STRIDE, j, counts[j],
+                            counts[j] <= FAIR * 2);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::stripeIndex(0,  1));
+            ASSERT_FAIL(Util::stripeIndex(0,  0));
+            ASSERT_FAIL(Util::stripeIndex(0, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Map a few keys, and the calling thread, to stripes, and verify
+        //    that the results are in range.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST" "\n"
+                          << "==============" "\n";
+
+        ASSERT(0 == Util::stripeIndex(0, 16));
+        ASSERT(0 == Util::stripeIndex(12345, 1));
+
+        const int INDEX = Util::stripeIndex(0x1000, 16);
+        ASSERTV(INDEX, 0 <= INDEX && INDEX < 16);
+
+        const int SELF = Util::selfStripeIndex(16);
+        ASSERTV(SELF, 0 <= SELF && SELF < 16);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." "\n";
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
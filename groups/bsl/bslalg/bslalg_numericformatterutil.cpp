@@ -350,6 +350,7 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <limits>
 
 #include <ryu/blp_ryu.h>
+#include <ryu/ryu.h>
 
 namespace {
 namespace u {
@@ -784,6 +785,55 @@ char *toCharsPowerOf2Base(char          *first,
     return first + length;
 }
 
+                // FIXED PRECISION CONVERSION HELPER METHODS
+
+enum {
+    k_MAX_FIXED_PRECISION      = 1074,
+        // Number of fractional digits of the smallest positive subnormal
+        // 'double', beyond which every fractional digit of any 'double' is 0.
+
+    k_MAX_SCIENTIFIC_PRECISION = 767
+        // Maximum number of significant decimal digits of any 'double',
+        // beyond which every significant digit is 0.
+};
+
+/// If the specified `value` is an infinity or a NaN, write its textual
+/// representation (see {Special Floating Point Values} in the component
+/// documentation) into the beginning of the buffer specified by
+/// `[ first .. last )`, load into the specified `result` the address one
+/// past the last character written (or 0 if the buffer is too small), and
+/// return `true`; otherwise return `false` with no effect.
+inline
+bool formatSpecial(char **result, char *first, char *last, double value)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    typedef std::numeric_limits<double> Lim;
+
+    const char *text;
+    if (value != value) {
+        text = "NaN";
+    }
+    else if (Lim::infinity() == value) {
+        text = "+INF";
+    }
+    else if (-Lim::infinity() == value) {
+        text = "-INF";
+    }
+    else {
+        return false;                                                 // RETURN
+    }
+
+    const std::size_t length = std::strlen(text);
+    if (static_cast<std::size_t>(last - first) < length) {
+        *result = 0;
+    }
+    else {
+        std::memcpy(first, text, length);
+        *result = first + length;
+    }
+    return true;
+}
+
                           // LOCAL META-FUNCTIONS
 
                         // =======================
@@ -1128,6 +1178,75 @@ char *NumericFormatterUtil::toChars(char  *first,
     }
 }
 
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    double  value,
+                                    Format  format,
+                                    int     precision) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(0 <= precision);
+    BSLS_ASSERT(e_FIXED == format || e_SCIENTIFIC == format);
+
+    char *result;
+    if (u::formatSpecial(&result, first, last, value)) {
+        return result;                                                // RETURN
+    }
+
+    const bool isFixed = e_FIXED == format;
+
+    // Ryu writes its result without bounds checking, so the output area is
+    // used directly only if the longest possible result surely fits.
+
+    const std::ptrdiff_t maxLength = static_cast<std::ptrdiff_t>(precision)
+                                   + (isFixed ? 311 : 8);
+    if (last - first >= maxLength) {
+        const unsigned p   = static_cast<unsigned>(precision);
+        const int      pos = isFixed ? ryu_d2fixed_buffered_n(value, p, first)
+                                     : ryu_d2exp_buffered_n(value, p, first);
+        return first + pos;                                           // RETURN
+    }
+
+    // Otherwise format into a local buffer, with the 'precision' limited to
+    // the number of digits that can be non-zero, and pad with zeros.
+
+    const int      maxPrecision = isFixed ? u::k_MAX_FIXED_PRECISION
+                                          : u::k_MAX_SCIENTIFIC_PRECISION;
+    const unsigned p            = static_cast<unsigned>(
+                                                 precision < maxPrecision
+                                                 ? precision
+                                                 : maxPrecision);
+
+    char      buf[1 + 309 + 1 + u::k_MAX_FIXED_PRECISION];
+    const int pos = isFixed ? ryu_d2fixed_buffered_n(value, p, buf)
+                            : ryu_d2exp_buffered_n(value, p, buf);
+
+    const std::ptrdiff_t numZeros = precision - static_cast<int>(p);
+    if (pos + numZeros > last - first) {
+        // Too long, won't fit
+        return 0;                                                     // RETURN
+    }
+
+    // The zeros go right after the last fractional digit, which for the
+    // scientific format is followed by the exponent.
+
+    const char *exponent = isFixed
+                           ? buf + pos
+                           : static_cast<const char *>(
+                                                  std::memchr(buf, 'e', pos));
+    BSLS_ASSERT(exponent);
+
+    const std::ptrdiff_t significandLength = exponent - buf;
+    std::memcpy(first, buf, significandLength);
+    first += significandLength;
+
+    std::memset(first, '0', numZeros);
+    first += numZeros;
+
+    std::memcpy(first, exponent, pos - significandLength);
+    return first + (pos - significandLength);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
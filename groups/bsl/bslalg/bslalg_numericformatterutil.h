@@ -61,6 +61,22 @@ BSLS_IDENT("$Id: $")
 // notation and the scientific notation, favoring decimal notation in case of a
 // tie.
 //
+///Fixed Precision Floating Point Formats
+///--------------------------------------
+// In addition to the shortest representations described above, a `double`
+// may be written with an explicitly specified number of digits after the
+// radix mark by passing a `precision` argument to `toChars` along with the
+// `format`.  With `e_FIXED` the result is the same as the one produced by the
+// `printf` conversion "%.*f", and with `e_SCIENTIFIC` the same as "%.*e",
+// given the same `precision` (but see {Special Floating Point Values}); that
+// is, the exact binary value is rounded (half to even) to `precision`
+// fractional digits.  Such output is **not**, in general, round-trip safe,
+// but is suitable for the many text formats that call for a fixed number of
+// decimals.  No buffer size meta-function is provided for these formats as
+// the length depends on the `precision`: the result never exceeds
+// `precision + 311` characters with `e_FIXED` and `precision + 8`
+// characters with `e_SCIENTIFIC`.
+//
 ///Special Floating Point Values
 ///-----------------------------
 // Floating point values may also be special-numerical or non-numerical(*)
@@ -604,6 +620,26 @@ struct NumericFormatterUtil {
                   char                   *last,
                   float                   value,
                   Format                  format) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Write the textual representation of the specified `value` in the
+    /// specified `format` with exactly the specified `precision` decimal
+    /// digits after the radix mark (see {Fixed Precision Floating Point
+    /// Formats}) into the character buffer starting at the specified `first`
+    /// and ending at the specified `last`, `last` not included.  If
+    /// `precision` is 0 no radix mark is written.  Return the address one
+    /// past the last character written on success, or `0` on failure.  The
+    /// only reason for failure is when the range `[ first, last )` is not
+    /// large enough to contain the result.  The behavior is undefined unless
+    /// `first <= last` and `0 <= precision`.  Note that a `float` argument
+    /// is converted to `double` (exactly) before formatting, as `printf`
+    /// does.  Also note that this function does **not** null-terminate the
+    /// result.
+    static
+    char *toChars(char                   *first,
+                  char                   *last,
+                  double                  value,
+                  Format                  format,
+                  int                     precision) BSLS_KEYWORD_NOEXCEPT;
 };
 
             // -----------------------------------------------
@@ -96,10 +96,11 @@ using std::numeric_limits;
 // [15] char *toChars(char *first, char *last, double value, format);
 // [16] char *toChars(char *first, char *last, float value, format);
 // [17] ToCharsMaxLength<T, A>::k_VALUE
+// [18] char *toChars(char *, char *, double, format, int precision);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 6] BLOOMBERG RYU INTERNALS
-// [18] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -5083,7 +5084,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5242,6 +5243,209 @@ int main(int argc, char *argv[])
     (void)k_FLT_DEC_SIZE;
     (void)k_DBL_SCI_SIZE;
     (void)k_DBL_MAX_SIZE;
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // `double` WITH FORMAT AND PRECISION TEST
+        //
+        // Concerns:
+        // 1. The value is written in the requested format with exactly the
+        //    requested number of digits after the radix mark, rounded half to
+        //    even, as `printf` writes it for "%.*f" and "%.*e".
+        //
+        // 2. Precisions larger than the number of significant digits of any
+        //    `double` are padded with zeros.
+        //
+        // 3. Special values are written as by the overloads without precision.
+        //
+        // 4. Zero is returned when the specified output buffer is too short,
+        //    and no character is written past `last`.
+        //
+        // Plan:
+        // 1. Use a table of values, formats, and precisions with expected
+        //    output, and for each row convert with every output buffer length
+        //    from 0 to one longer than the expected output, verifying that
+        //    only buffers of at least the expected length succeed, and that
+        //    the character following the buffer is not overwritten.
+        //    (C-1..4)
+        //
+        // 2. Where the C library is known to format exactly (glibc), use
+        //    `snprintf` as an oracle for pseudo-random values and precisions.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, double, format, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("`double` WITH FORMAT AND PRECISION TEST\n"
+                            "=======================================\n");
+
+        const Util::Format F = Util::e_FIXED;
+        const Util::Format S = Util::e_SCIENTIFIC;
+
+        typedef std::numeric_limits<double> Lim;
+
+        static const struct {
+            int           d_line;
+            double        d_value;
+            Util::Format  d_format;
+            int           d_precision;
+            const char   *d_expected;
+        } DATA[] = {
+            //LINE  VALUE         FMT  PREC  EXPECTED
+            //----  ------------  ---  ----  -------------------------------
+            { L_,   0.0,          F,   0,    "0"                             },
+            { L_,  -0.0,          F,   2,    "-0.00"                         },
+            { L_,   1.0,          F,   0,    "1"                             },
+            { L_,   0.5,          F,   0,    "0"                             },
+            { L_,   1.5,          F,   0,    "2"                             },
+            { L_,   2.5,          F,   0,    "2"                             },
+            { L_,  -2.5,          F,   0,    "-2"                            },
+            { L_,   0.125,        F,   2,    "0.12"                          },
+            { L_,   0.375,        F,   2,    "0.38"                          },
+            { L_,   0.1,          F,   1,    "0.1"                           },
+            { L_,   0.1,          F,   20,   "0.10000000000000000555"        },
+            { L_,   1.005,        F,   2,    "1.00"                          },
+            { L_,   9.995,        F,   2,    "9.99"                          },
+            { L_,   99.5,         F,   0,    "100"                           },
+            { L_,   123456.789,   F,   3,    "123456.789"                    },
+            { L_,   1e21,         F,   1,    "1000000000000000000000.0"      },
+            { L_,   1e-7,         F,   5,    "0.00000"                       },
+            { L_,   5e-324,       F,   3,    "0.000"                         },
+            { L_,   0.0,          S,   0,    "0e+00"                         },
+            { L_,   0.0,          S,   3,    "0.000e+00"                     },
+            { L_,   1.0,          S,   2,    "1.00e+00"                      },
+            { L_,   2.5,          S,   0,    "2e+00"                         },
+            { L_,  -123.456,      S,   2,    "-1.23e+02"                     },
+            { L_,   9.9999,       S,   2,    "1.00e+01"                      },
+            { L_,   1e100,        S,   1,    "1.0e+100"                      },
+            { L_,   1e-100,       S,   4,    "1.0000e-100"                   },
+            { L_,   5e-324,       S,   3,    "4.941e-324"                    },
+            { L_,   Lim::max(),   S,   16,   "1.7976931348623157e+308"       },
+            { L_,   Lim::max(),   S,   20,   "1.79769313486231570815e+308"   },
+            { L_,   Lim::infinity(),
+                                  F,   2,    "+INF"                          },
+            { L_,  -Lim::infinity(),
+                                  S,   2,    "-INF"                          },
+            { L_,   Lim::quiet_NaN(),
+                                  F,   2,    "NaN"                           },
+        };
+        const size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (size_t i = 0; i < NUM_DATA; ++i) {
+            const int           LINE      = DATA[i].d_line;
+            const double        VALUE     = DATA[i].d_value;
+            const Util::Format  FORMAT    = DATA[i].d_format;
+            const int           PRECISION = DATA[i].d_precision;
+            const char *const   EXPECTED  = DATA[i].d_expected;
+            const size_t        LENGTH    = strlen(EXPECTED);
+
+            if (veryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+            char buffer[64];
+            for (size_t length = 0; length <= LENGTH + 1; ++length) {
+                memset(buffer, '#', sizeof buffer);
+
+                char *end = Util::toChars(buffer,
+                                          buffer + length,
+                                          VALUE,
+                                          FORMAT,
+                                          PRECISION);
+                ASSERTV(LINE, length, '#' == buffer[length]);
+                if (length < LENGTH) {
+                    ASSERTV(LINE, length, 0 == end);
+                    continue;                                       // CONTINUE
+                }
+
+                ASSERTV(LINE, length, buffer + LENGTH == end);
+                if (buffer + LENGTH == end) {
+                    ASSERTV(LINE, length, EXPECTED,
+                            0 == memcmp(buffer, EXPECTED, LENGTH));
+                }
+            }
+        }
+
+        if (veryVerbose) puts("Large precisions");
+        {
+            const int PRECISION = 1100;
+
+            std::string buffer(PRECISION + 400, '#');
+            char *const FIRST = &buffer[0];
+
+            char *end = Util::toChars(FIRST,
+                                      FIRST + buffer.size(),
+                                      0.1,
+                                      F,
+                                      PRECISION);
+            ASSERT(FIRST + 2 + PRECISION == end);
+            const char *const EXACT =
+                   "0.1000000000000000055511151231257827021181583404541015625";
+
+            ASSERT(std::string(FIRST, 57) == EXACT);
+            ASSERT(std::string(FIRST + 57, end) ==
+                   std::string(2 + PRECISION - 57, '0'));
+
+            end = Util::toChars(FIRST,
+                                FIRST + buffer.size(),
+                                0.1,
+                                S,
+                                PRECISION);
+            ASSERT(FIRST + 2 + PRECISION + 4 == end);
+            ASSERT(std::string(end - 4, end) == "e-01");
+            ASSERT(std::string(FIRST + 56, end - 4) ==
+                   std::string(2 + PRECISION - 56, '0'));
+
+            // Padding must also work when the result only just fits.
+
+            buffer.assign(2 + PRECISION + 1, '#');
+            end = Util::toChars(FIRST,
+                                FIRST + 2 + PRECISION,
+                                0.1,
+                                F,
+                                PRECISION);
+            ASSERT(FIRST + 2 + PRECISION == end);
+            ASSERT('0' == end[-1]);
+            ASSERT('#' == *end);
+        }
+
+#if defined(__GLIBC__)
+        if (veryVerbose) puts("Oracle: `snprintf`");
+        {
+            unsigned long long state = 0x9e3779b97f4a7c15ULL;
+
+            for (int i = 0; i < 200000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                double value;
+                memcpy(&value, &state, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;                                       // CONTINUE
+                }
+
+                const bool   fixed     = 0 != (state >> 63 & 1);
+                const int    precision = static_cast<int>(state % 25);
+                char         expected[400];
+                const int    length = snprintf(expected,
+                                               sizeof expected,
+                                               fixed ? "%.*f" : "%.*e",
+                                               precision,
+                                               value);
+                char         buffer[400];
+
+                char *end = Util::toChars(buffer,
+                                          buffer + length,
+                                          value,
+                                          fixed ? F : S,
+                                          precision);
+                ASSERTV(expected, buffer + length == end);
+                if (buffer + length == end) {
+                    ASSERTV(expected, 0 == memcmp(buffer, expected, length));
+                }
+            }
+        }
+#endif
       } break;
       case 17: {
         // --------------------------------------------------------------------
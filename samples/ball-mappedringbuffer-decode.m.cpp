@@ -0,0 +1,45 @@
+#include <ball_mappedringbufferobserver.h>
+
+#include <bsl_iostream.h>
+
+// Decode the ring buffer file(s) written by a 'ball::MappedRingBufferObserver'
+// (e.g., one left behind by a crashed process) to standard output.
+
+int main(int argc, char *argv[])
+{
+	using namespace BloombergLP;
+
+	if (argc < 2) {
+		bsl::cerr << "usage: " << argv[0] << " <ringfile> [<ringfile> ...]"
+		          << bsl::endl;
+		return 1;
+	}
+
+	int status = 0;
+	for (int i = 1; i < argc; ++i) {
+		if (0 != ball::MappedRingBufferObserver::decodeFile(bsl::cout,
+		                                                    argv[i])) {
+			bsl::cerr << argv[i] << ": not a readable ring buffer file"
+			          << bsl::endl;
+			status = 1;
+		}
+	}
+
+	return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------